@@ -52,4 +52,56 @@ TOOLCHAIN=GCC_ARM
 # for your IDE.
 CONFIG=Debug
 
+# Console and user button handling. Options include:
+#
+# 0 -- CM7_0 owns the debug UART and the buttons
+# 1 -- CM0+ runs as I/O co-processor: it owns the debug UART and the buttons and
+#      forwards the console and button events to CM7_0 over IPC
+IO_COPROCESSOR=0
+
+# Execution time profiler of CM7_0. Options include:
+#
+# 0 -- profiling zones and counters compiled out
+# 1 -- zones and counters measured with the DWT cycle counter, hot spots
+#      reported by the `profile` command of the 'Parameter console' demo,
+#      cleared by `profile clear`
+PROFILER=1
+
+# Benchmark build of CM7_0. Options include:
+#
+# 0 -- the demos run as usual
+# 1 -- CM7_0 runs the benchmark suite once instead of the demos and prints one
+#      JSON result per line on the console
+BENCH=0
+
+# Memory placement of CM7_0 (GCC_ARM only). Options include:
+#
+# 0 -- the default sections of the BSP linker script
+# 1 -- hot interrupt handlers in ITCM, hot buffers in DTCM and DMA buffers in a
+#      non-cacheable SRAM section, see proj_cm7_0/placement_gcc.ld
+PLACEMENT=1
+
+# Hardware flow control of the debug UART of CM7_0. Options include:
+#
+# 0 -- RX and TX only
+# 1 -- RTS/CTS on CYBSP_DEBUG_UART_RTS/CTS; the KitProg3 USB-UART bridge or
+#      the adapter on the PC side must use flow control as well
+CONSOLE_FLOW_CONTROL=0
+
+# Static memory model of all cores (GCC_ARM only). Options include:
+#
+# 0 -- malloc and free of newlib use the heap section of the BSP
+# 1 -- malloc, calloc, realloc and free are wrapped at link time and trap in
+#      shared/mem_guard.c; the post-build memory report fails the build if the
+#      newlib allocator is linked
+STATIC_MEMORY=1
+
+# Watchdog of CM7_0. Options include:
+#
+# 0 -- no watchdog
+# 1 -- the hardware watchdog resets the device when a supervised task of the
+#      demos overruns its deadline or the interrupts stay blocked; the next
+#      boot reports the task, see proj_cm7_0/source/watchdog.h
+WATCHDOG=1
+
 include ../common_app.mk
@@ -0,0 +1,769 @@
+/******************************************************************************
+* File Name:   cy_pdl.h
+*
+* Description: Host stand-in of the XMC7000 peripheral driver library. Only
+*              the types, registers and functions used by proj_cm7_0 and the
+*              shared directory are provided; they are implemented by the
+*              simulation in host/source.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _CY_PDL_H_
+#define _CY_PDL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <sched.h>
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Result codes */
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS                     ((cy_rslt_t)0x00000000U)
+#define CY_RSLT_TYPE_ERROR                  (0x2U)
+#define CY_RSLT_MODULE_MIDDLEWARE_BASE      (0x0A00U)
+#define CY_RSLT_CREATE(type, module, code)  \
+    ((((uint32_t)(type) & 0x3U) << 16) | (((uint32_t)(module) & 0xFFFU) << 18) | ((uint32_t)(code) & 0xFFFFU))
+
+/* A failed assertion stops the simulation with an error */
+#define CY_ASSERT(x)                        do { if (!(x)) { sim_fail(__FILE__, __LINE__, #x); } } while (0)
+
+#define CY_SECTION_SHAREDMEM
+
+#define CY_SYSLIB_RESET_HWWDT               (0x0001UL)
+#define CY_SYSLIB_RESET_HIB_WAKEUP          (0x40000UL)
+
+/* Large sectors of the work flash */
+#define CY_WFLASH_LG_SBM_TOP                (0x14000000UL)
+
+/* IPC channels and interrupt structures free for the application */
+#define CY_IPC_CHANNELS                     (16UL)
+#define CY_IPC_INTERRUPTS                   (8UL)
+#define CY_IPC_CHAN_USER                    (8UL)
+#define CY_IPC_INTR_USER                    (4UL)
+
+/* Core functions, interrupts are emulated by the simulation thread */
+#define __enable_irq()                      sim_irq_enable()
+#define __disable_irq()                     sim_irq_disable()
+#define __WFI()                             sim_wait_for_interrupt()
+#define __WFE()                             sim_wait_for_event()
+#define __SEV()                             sim_send_event()
+#define __DMB()                             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()                             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB()                             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+/* Polling loops give the simulation thread the CPU on single-core hosts */
+#define __NOP()                             ((void)sched_yield())
+
+/* The host has no D-cache to maintain */
+#define __DCACHE_PRESENT                    (0U)
+#define SCB_CleanDCache_by_Addr(addr, size)         ((void)(addr), (void)(size))
+#define SCB_InvalidateDCache_by_Addr(addr, size)    ((void)(addr), (void)(size))
+
+/* Register field access */
+#define _VAL2FLD(field, value)              (((uint32_t)(value) << field##_Pos) & field##_Msk)
+#define _FLD2VAL(field, value)              (((uint32_t)(value) & field##_Msk) >> field##_Pos)
+#define CY_REG32_CLR_SET(reg, field, value) ((reg) = (((reg) & ~field##_Msk) | _VAL2FLD(field, (value))))
+
+/* Debug and trace registers */
+#define CoreDebug_DEMCR_TRCENA_Msk          (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk              (1UL)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    NvicMux0_IRQn = 0,
+    NvicMux1_IRQn = 1,
+    NvicMux2_IRQn = 2,
+    NvicMux3_IRQn = 3,
+    NvicMux4_IRQn = 4,
+    NvicMux5_IRQn = 5,
+    NvicMux6_IRQn = 6,
+    NvicMux7_IRQn = 7,
+} IRQn_Type;
+
+/* System interrupt sources routed to the CPU interrupts */
+typedef enum
+{
+    cpuss_interrupts_ipc_0_IRQn     = 0x100,
+    canfd_0_interrupts0_0_IRQn      = 0x200,
+    canfd_0_interrupts0_1_IRQn      = 0x201,
+    ioss_interrupts_gpio_0_IRQn     = 0x300,    /* One per port */
+    tcpwm_0_interrupts_0_IRQn       = 0x400,    /* One per counter of group 0 */
+    tcpwm_0_interrupts_256_IRQn     = 0x500,    /* One per counter of group 1 */
+    pass_0_interrupts_sar_0_IRQn    = 0x600,    /* One per channel of SAR 0 */
+    pass_0_interrupts_sar_32_IRQn   = 0x620,    /* One per channel of SAR 1 */
+} cy_en_intr_t;
+
+typedef enum
+{
+    CY_IPC_DRV_SUCCESS      = 0x0UL,
+    CY_IPC_DRV_ERROR        = 0x00430001UL,
+} cy_en_ipcdrv_status_t;
+
+typedef enum
+{
+    CY_SYSCLK_DIV_8_BIT     = 0,
+    CY_SYSCLK_DIV_16_BIT    = 1,
+    CY_SYSCLK_DIV_16_5_BIT  = 2,
+    CY_SYSCLK_DIV_24_5_BIT  = 3,
+} cy_en_divider_types_t;
+
+typedef enum
+{
+    PCLK_TCPWM0_CLOCKS0     = 0x100,
+    PCLK_TCPWM0_CLOCKS256   = 0x200,
+    PCLK_TCPWM0_CLOCKS257   = 0x201,
+    PCLK_TCPWM0_CLOCKS258   = 0x202,
+    PCLK_TCPWM0_CLOCKS259   = 0x203,
+    PCLK_PASS0_CLOCK_SAR0   = 0x300,
+    PCLK_PASS0_CLOCK_SAR1   = 0x301,
+} en_clk_dst_t;
+
+typedef enum
+{
+    CY_CANFD_SUCCESS        = 0x00UL,
+    CY_CANFD_BAD_PARAM      = 0x00610001UL,
+} cy_en_canfd_status_t;
+
+typedef enum
+{
+    CY_CANFD_RTR_DATA_FRAME     = 0,
+    CY_CANFD_RTR_REMOTE_FRAME   = 1,
+} cy_en_canfd_rtr_t;
+
+typedef enum
+{
+    CY_CANFD_TEST_MODE_DISABLE              = 0,
+    CY_CANFD_TEST_MODE_BUS_MONITORING       = 1,
+    CY_CANFD_TEST_MODE_EXTERNAL_LOOP_BACK   = 2,
+    CY_CANFD_TEST_MODE_INTERNAL_LOOP_BACK   = 3,
+} cy_en_canfd_test_mode_t;
+
+typedef enum
+{
+    TRIGGER_TYPE_LEVEL      = 0,
+    TRIGGER_TYPE_EDGE       = 1,
+} en_trig_type_t;
+
+typedef enum
+{
+    CY_TRIGMUX_SUCCESS      = 0x00UL,
+    CY_TRIGMUX_BAD_PARAM    = 0x00330001UL,
+} cy_en_trigmux_status_t;
+
+typedef enum
+{
+    CY_SAR2_SUCCESS         = 0x00UL,
+    CY_SAR2_BAD_PARAM       = 0x00D10001UL,
+} cy_en_sar2_status_t;
+
+typedef enum
+{
+    CY_SAR2_TRIGGER_OFF         = 0,
+    CY_SAR2_TRIGGER_TCPWM       = 1,
+    CY_SAR2_TRIGGER_GENERIC0    = 2,
+    CY_SAR2_TRIGGER_GENERIC1    = 3,
+    CY_SAR2_TRIGGER_GENERIC2    = 4,
+    CY_SAR2_TRIGGER_GENERIC3    = 5,
+    CY_SAR2_TRIGGER_GENERIC4    = 6,
+    CY_SAR2_TRIGGER_CONTINUOUS  = 15,
+} cy_en_sar2_trigger_selection_t;
+
+typedef enum
+{
+    CY_SAR2_PIN_ADDRESS_AN0 = 0,
+    CY_SAR2_PIN_ADDRESS_AN1,
+    CY_SAR2_PIN_ADDRESS_AN2,
+    CY_SAR2_PIN_ADDRESS_AN3,
+    CY_SAR2_PIN_ADDRESS_AN4,
+    CY_SAR2_PIN_ADDRESS_AN5,
+    CY_SAR2_PIN_ADDRESS_AN6,
+    CY_SAR2_PIN_ADDRESS_AN7,
+} cy_en_sar2_pin_address_t;
+
+/* Range detection of a result: BELOW_LO is result < LO, INSIDE_RANGE is
+ * LO <= result < HI, ABOVE_HI is result >= HI, OUTSIDE_RANGE is either end */
+typedef enum
+{
+    CY_SAR2_RANGE_DETECTION_MODE_BELOW_LO       = 0,
+    CY_SAR2_RANGE_DETECTION_MODE_INSIDE_RANGE   = 1,
+    CY_SAR2_RANGE_DETECTION_MODE_ABOVE_HI       = 2,
+    CY_SAR2_RANGE_DETECTION_MODE_OUTSIDE_RANGE  = 3,
+} cy_en_sar2_range_detection_mode_t;
+
+typedef enum
+{
+    CY_SAR2_PREEMPTION_ABORT_CANCEL     = 0,
+    CY_SAR2_PREEMPTION_ABORT_RESTART    = 1,
+    CY_SAR2_PREEMPTION_ABORT_RESUME     = 2,
+    CY_SAR2_PREEMPTION_FINISH_RESUME    = 3,
+} cy_en_sar2_preemption_type_t;
+
+typedef enum
+{
+    CY_SAR2_DONE_LEVEL_PULSE    = 0,
+    CY_SAR2_DONE_LEVEL_LEVEL    = 1,
+} cy_en_sar2_done_level_t;
+
+typedef enum
+{
+    CY_SAR2_PORT_ADDRESS_SARMUX0 = 0,
+} cy_en_sar2_port_address_t;
+
+typedef enum
+{
+    CY_SAR2_PRECONDITION_MODE_OFF = 0,
+} cy_en_sar2_precondition_mode_t;
+
+typedef enum
+{
+    CY_SAR2_OVERLAP_DIAG_MODE_OFF = 0,
+} cy_en_sar2_overlap_diag_mode_t;
+
+typedef enum
+{
+    CY_SAR2_CALIBRATION_VALUE_REGULAR = 0,
+} cy_en_sar2_calibration_value_select_t;
+
+typedef enum
+{
+    CY_SAR2_POST_PROCESSING_MODE_NONE = 0,
+} cy_en_sar2_post_processing_mode_t;
+
+typedef enum
+{
+    CY_SAR2_RESULT_ALIGNMENT_RIGHT = 0,
+} cy_en_sar2_result_alignment_t;
+
+typedef enum
+{
+    CY_SAR2_SIGN_EXTENTION_UNSIGNED = 0,
+} cy_en_sar2_sign_extention_t;
+
+typedef enum
+{
+    CY_SAR2_MSB_STRETCH_MODE_1CYCLE = 0,
+} cy_en_sar2_msb_stretch_mode_t;
+
+typedef enum
+{
+    CY_SAR2_REF_BUF_MODE_OFF    = 0,
+    CY_SAR2_REF_BUF_MODE_ON     = 1,
+} cy_en_sar2_ref_buf_mode_t;
+
+/* SAR channel interrupts */
+#define CY_SAR2_INT_GRP_DONE                (1UL << 0)
+#define CY_SAR2_INT_GRP_CANCELLED           (1UL << 1)
+#define CY_SAR2_INT_GRP_OVERFLOW            (1UL << 2)
+#define CY_SAR2_INT_CH_RANGE                (1UL << 8)
+#define CY_SAR2_INT_CH_PULSE                (1UL << 9)
+#define CY_SAR2_INT_CH_OVERFLOW             (1UL << 10)
+
+/* Status flags of a result */
+#define CY_SAR2_STATUS_VALID                (1UL << 31)
+#define CY_SAR2_STATUS_RANGE                (1UL << 30)
+
+#define CY_SAR2_CHAN_NUM                    (32u)
+
+/* Fields of the SAR channel registers */
+#define PASS_SAR_CH_POST_CTL_RANGE_MODE_Pos (22UL)
+#define PASS_SAR_CH_POST_CTL_RANGE_MODE_Msk (0x00C00000UL)
+#define PASS_SAR_CH_RANGE_CTL_RANGE_LO_Pos  (0UL)
+#define PASS_SAR_CH_RANGE_CTL_RANGE_LO_Msk  (0x0000FFFFUL)
+#define PASS_SAR_CH_RANGE_CTL_RANGE_HI_Pos  (16UL)
+#define PASS_SAR_CH_RANGE_CTL_RANGE_HI_Msk  (0xFFFF0000UL)
+
+/* Data words of a CAN FD frame */
+enum
+{
+    CANFD_DATA_0 = 0,
+    CANFD_DATA_1,
+    CANFD_DATA_2,
+    CANFD_DATA_3,
+};
+
+#define CY_CANFD_DATA_ELEMENTS_MAX          (64U)
+
+/* TCPWM counter configuration values */
+#define CY_TCPWM_COUNTER_PRESCALER_DIVBY_1  (0UL)
+#define CY_TCPWM_COUNTER_CONTINUOUS         (0UL)
+#define CY_TCPWM_COUNTER_ONESHOT            (1UL)
+#define CY_TCPWM_COUNTER_COUNT_UP           (0UL)
+#define CY_TCPWM_COUNTER_MODE_CAPTURE       (2UL)
+#define CY_TCPWM_COUNTER_MODE_COMPARE       (0UL)
+#define CY_TCPWM_INT_NONE                   (0UL)
+#define CY_TCPWM_INT_ON_TC                  (1UL)
+#define CY_TCPWM_INPUT_RISINGEDGE           (0UL)
+#define CY_TCPWM_INPUT_FALLINGEDGE          (1UL)
+#define CY_TCPWM_INPUT_EITHEREDGE           (2UL)
+#define CY_TCPWM_INPUT_LEVEL                (3UL)
+#define CY_TCPWM_INPUT_0                    (0UL)
+#define CY_TCPWM_INPUT_1                    (1UL)
+/* All-counter trigger input n of the TCPWM, from trigger group 5 */
+#define CY_TCPWM_INPUT_TRIG(n)              ((uint32_t)(n) + 2UL)
+#define CY_TCPWM_SUCCESS                    (0UL)
+#define CY_TCPWM_INT_ON_CC0                 (2UL)
+#define CY_TCPWM_INT_ON_CC1                 (4UL)
+
+/* TCPWM PWM configuration values */
+#define CY_TCPWM_PWM_MODE_PWM               (4UL)
+#define CY_TCPWM_PWM_PRESCALER_DIVBY_1      (0UL)
+#define CY_TCPWM_PWM_LEFT_ALIGN             (0UL)
+#define CY_TCPWM_PWM_CONTINUOUS             (0UL)
+#define CY_TCPWM_PWM_INVERT_DISABLE         (0UL)
+#define CY_TCPWM_PWM_STOP_ON_KILL           (1UL)
+
+/* Events driving the TR_OUT0 and TR_OUT1 lines of a counter */
+#define CY_TCPWM_CNT_TRIGGER_ON_OVERFLOW    (0UL)
+#define CY_TCPWM_CNT_TRIGGER_ON_TC          (2UL)
+#define CY_TCPWM_CNT_TRIGGER_ON_CC0_MATCH   (3UL)
+#define CY_TCPWM_CNT_TRIGGER_ON_CC1_MATCH   (4UL)
+#define CY_TCPWM_CNT_TRIGGER_ON_DISABLED    (7UL)
+
+/* Trigger multiplexer lines: group 6 routes the TR_OUT1 lines of the TCPWM0
+ * group 1 counters to the generic trigger inputs of the PASS */
+#define TRIG_IN_MUX_6_TCPWM_0_TR_OUT1256    (0x00000600UL)
+#define TRIG_IN_MUX_6_TCPWM_0_TR_OUT1258    (0x00000602UL)
+#define TRIG_OUT_MUX_6_PASS_GEN_TR_I0       (0x40000600UL)
+#define TRIG_OUT_MUX_6_PASS_GEN_TR_I1       (0x40000601UL)
+
+/* Trigger multiplexer lines: group 5 routes the trigger inputs of the pins to
+ * the all-counter trigger inputs of TCPWM0. The pins of the user buttons
+ * reach them through their PERI_TR_IO_INPUT function. */
+#define TRIG_IN_MUX_5_PERI_TR_IO_INPUT17    (0x00000511UL)
+#define TRIG_IN_MUX_5_PERI_TR_IO_INPUT22    (0x00000516UL)
+#define TRIG_OUT_MUX_5_TCPWM_0_TR_ALL_CNT_IN0 (0x40000500UL)
+#define TRIG_OUT_MUX_5_TCPWM_0_TR_ALL_CNT_IN1 (0x40000501UL)
+
+/* GPIO drive modes and HSIOM connection */
+#define CY_GPIO_DM_ANALOG                   (0UL)
+#define HSIOM_SEL_GPIO                      (0UL)
+#define P17_3_PERI_TR_IO_INPUT17            (25UL)
+#define P21_4_PERI_TR_IO_INPUT22            (25UL)
+
+/* GPIO interrupt edges */
+#define CY_GPIO_INTR_DISABLE                (0UL)
+#define CY_GPIO_INTR_RISING                 (1UL)
+#define CY_GPIO_INTR_FALLING                (2UL)
+#define CY_GPIO_INTR_BOTH                   (3UL)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+    volatile uint32_t LAR;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+/* IPC channel: lock, notify mask and data word */
+typedef struct
+{
+    volatile uint32_t ACQUIRED;
+    volatile uint32_t NOTIFY;
+    volatile uint32_t DATA0;
+} IPC_STRUCT_Type;
+
+typedef struct
+{
+    volatile uint32_t INTR;
+    volatile uint32_t INTR_MASK;
+} IPC_INTR_STRUCT_Type;
+
+typedef struct
+{
+    uint32_t intrSrc;                       /* (CPU interrupt << 16) | system interrupt */
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+
+typedef void (*cy_israddress)(void);
+
+typedef struct
+{
+    volatile uint32_t COUNTER[2][256];
+} TCPWM_Type;
+
+/* Backup registers, kept across the runs with HOST_SIM_BACKUP_FILE */
+typedef struct
+{
+    volatile uint32_t BREG_SET0[4];
+    volatile uint32_t BREG_SET1[4];
+    volatile uint32_t BREG_SET2[8];
+    volatile uint32_t BREG_SET3[16];
+} BACKUP_Type;
+
+/* GPIO port, only its number is modelled */
+typedef struct
+{
+    uint32_t port;
+} GPIO_PRT_Type;
+
+/* SAR channel registers, only those the range detection uses */
+typedef struct
+{
+    volatile uint32_t POST_CTL;
+    volatile uint32_t RANGE_CTL;
+    volatile uint32_t INTR;
+    volatile uint32_t INTR_MASK;
+    volatile uint32_t WORK;
+    volatile uint32_t RESULT;
+    volatile uint32_t ENABLE;
+} PASS_SAR_CH_Type;
+
+typedef struct
+{
+    PASS_SAR_CH_Type CH[32];
+} PASS_SAR_Type;
+
+typedef struct
+{
+    volatile uint32_t REF_BUF_MODE;
+    volatile uint32_t SAR_TR_IN_SEL[2];     /* PASS trigger input of each generic trigger, 4 bits each */
+} PASS_EPASS_MMIO_Type;
+
+typedef struct
+{
+    bool                                  channelHwEnable;
+    cy_en_sar2_trigger_selection_t        triggerSelection;
+    uint8_t                               channelPriority;
+    cy_en_sar2_preemption_type_t          preenptionType;
+    bool                                  isGroupEnd;
+    cy_en_sar2_done_level_t               doneLevel;
+    cy_en_sar2_pin_address_t              pinAddress;
+    cy_en_sar2_port_address_t             portAddress;
+    uint8_t                               extMuxSelect;
+    bool                                  extMuxEnable;
+    cy_en_sar2_precondition_mode_t        preconditionMode;
+    cy_en_sar2_overlap_diag_mode_t        overlapDiagMode;
+    uint16_t                              sampleTime;
+    cy_en_sar2_calibration_value_select_t calibrationValueSelect;
+    cy_en_sar2_post_processing_mode_t     postProcessingMode;
+    cy_en_sar2_result_alignment_t         resultAlignment;
+    cy_en_sar2_sign_extention_t           signExtention;
+    uint8_t                               averageCount;
+    uint8_t                               rightShift;
+    cy_en_sar2_range_detection_mode_t     rangeDetectionMode;
+    uint16_t                              rangeDetectionLoThreshold;
+    uint16_t                              rangeDetectionHiThreshold;
+    uint32_t                              interruptMask;
+} cy_stc_sar2_channel_config_t;
+
+typedef struct
+{
+    uint16_t                              preconditionTime;
+    uint16_t                              powerupTime;
+    bool                                  enableIdlePowerDown;
+    cy_en_sar2_msb_stretch_mode_t         msbStretchMode;
+    bool                                  enableHalfLsbConv;
+    bool                                  sarMuxEnable;
+    bool                                  adcEnable;
+    bool                                  sarIpEnable;
+    const cy_stc_sar2_channel_config_t   *channelConfig[CY_SAR2_CHAN_NUM];
+} cy_stc_sar2_config_t;
+
+typedef struct
+{
+    uint32_t period;
+    uint32_t clockPrescaler;
+    uint32_t runMode;
+    uint32_t countDirection;
+    uint32_t compareOrCapture;
+    uint32_t compare0;
+    uint32_t compare1;
+    bool     enableCompareSwap;
+    uint32_t interruptSources;
+    uint32_t captureInputMode;
+    uint32_t captureInput;
+    uint32_t capture1InputMode;
+    uint32_t capture1Input;
+    uint32_t reloadInputMode;
+    uint32_t reloadInput;
+    uint32_t startInputMode;
+    uint32_t startInput;
+    uint32_t stopInputMode;
+    uint32_t stopInput;
+    uint32_t countInputMode;
+    uint32_t countInput;
+} cy_stc_tcpwm_counter_config_t;
+
+typedef struct
+{
+    uint32_t pwmMode;
+    uint32_t clockPrescaler;
+    uint32_t pwmAlignment;
+    uint32_t deadTimeClocks;
+    uint32_t runMode;
+    uint32_t period0;
+    uint32_t period1;
+    bool     enablePeriodSwap;
+    uint32_t compare0;
+    uint32_t compare1;
+    bool     enableCompareSwap;
+    uint32_t interruptSources;
+    uint32_t invertPWMOut;
+    uint32_t invertPWMOutN;
+    uint32_t killMode;
+    uint32_t swapInputMode;
+    uint32_t swapInput;
+    uint32_t reloadInputMode;
+    uint32_t reloadInput;
+    uint32_t startInputMode;
+    uint32_t startInput;
+    uint32_t killInputMode;
+    uint32_t killInput;
+    uint32_t countInputMode;
+    uint32_t countInput;
+    uint32_t trigger0Event;
+    uint32_t trigger1Event;
+} cy_stc_tcpwm_pwm_config_t;
+
+/* CAN FD message buffers, as laid out by the device configurator */
+typedef struct
+{
+    uint32_t          id;
+    cy_en_canfd_rtr_t rtr;
+    uint32_t          xtd;
+    uint32_t          esi;
+} cy_stc_canfd_r0_t;
+
+typedef struct
+{
+    uint32_t rxts;
+    uint32_t dlc;
+    bool     brs;
+    uint32_t fdf;
+    uint32_t fidx;
+    bool     anmf;
+} cy_stc_canfd_r1_t;
+
+typedef struct
+{
+    cy_stc_canfd_r0_t *r0_f;
+    cy_stc_canfd_r1_t *r1_f;
+    uint32_t          *data_area_f;
+} cy_stc_canfd_rx_buffer_t;
+
+typedef struct
+{
+    uint32_t          id;
+    cy_en_canfd_rtr_t rtr;
+    uint32_t          xtd;
+    uint32_t          esi;
+} cy_stc_canfd_t0_t;
+
+typedef struct
+{
+    uint32_t dlc;
+    bool     brs;
+    uint32_t fdf;
+    uint32_t efc;
+    uint32_t mm;
+} cy_stc_canfd_t1_t;
+
+typedef struct
+{
+    cy_stc_canfd_t0_t *t0_f;
+    cy_stc_canfd_t1_t *t1_f;
+    uint32_t          *data_area_f;
+} cy_stc_canfd_tx_buffer_t;
+
+typedef void (*cy_canfd_rx_msg_func_ptr_t)(bool rxFIFOMsg, uint8_t msgBufOrRxFIFONum,
+                                           cy_stc_canfd_rx_buffer_t *basemsg);
+typedef void (*cy_canfd_tx_msg_func_ptr_t)(void);
+typedef void (*cy_canfd_error_func_ptr_t)(uint32_t errorMask);
+
+typedef struct
+{
+    cy_canfd_tx_msg_func_ptr_t txCallback;
+    cy_canfd_rx_msg_func_ptr_t rxCallback;
+    cy_canfd_error_func_ptr_t  errorCallback;
+    bool                       canFDMode;
+} cy_stc_canfd_config_t;
+
+typedef struct
+{
+    struct
+    {
+        cy_canfd_tx_msg_func_ptr_t canFDTxInterruptFunction;
+        cy_canfd_rx_msg_func_ptr_t canFDRxInterruptFunction;
+        cy_canfd_error_func_ptr_t  canFDErrorInterruptFunction;
+    } canFDInterruptHandling;
+} cy_stc_canfd_context_t;
+
+typedef struct
+{
+    volatile uint32_t CTL;
+} CANFD_Type;
+
+/*******************************************************************************
+* External Variables
+*******************************************************************************/
+extern uint32_t SystemCoreClock;
+extern CoreDebug_Type sim_core_debug;
+extern TCPWM_Type sim_tcpwm0;
+extern BACKUP_Type sim_backup;
+extern CANFD_Type sim_canfd0;
+extern PASS_SAR_Type sim_pass_sar[2];
+extern PASS_EPASS_MMIO_Type sim_pass_epass;
+
+#define CoreDebug                           (&sim_core_debug)
+/* Refreshes CYCCNT from the host clock on every access */
+#define DWT                                 (sim_dwt())
+#define TCPWM0                              (&sim_tcpwm0)
+#define BACKUP                              (&sim_backup)
+#define CANFD0                              (&sim_canfd0)
+#define PASS0_SAR0                          (&sim_pass_sar[0])
+#define PASS0_SAR1                          (&sim_pass_sar[1])
+#define PASS0_EPASS_MMIO                    (&sim_pass_epass)
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern DWT_Type *sim_dwt(void);
+
+/* SysLib */
+extern void Cy_SysLib_Delay(uint32_t milliseconds);
+extern void Cy_SysLib_DelayUs(uint16_t microseconds);
+extern uint32_t Cy_SysLib_EnterCriticalSection(void);
+extern void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
+extern uint32_t Cy_SysLib_GetResetReason(void);
+
+/* SysInt and NVIC */
+extern uint32_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr);
+extern void NVIC_EnableIRQ(IRQn_Type IRQn);
+extern void NVIC_DisableIRQ(IRQn_Type IRQn);
+
+/* IPC driver */
+extern IPC_STRUCT_Type *Cy_IPC_Drv_GetIpcBaseAddress(uint32_t ipcIndex);
+extern IPC_INTR_STRUCT_Type *Cy_IPC_Drv_GetIntrBaseAddr(uint32_t ipcIntrIndex);
+extern cy_en_ipcdrv_status_t Cy_IPC_Drv_SendMsgWord(IPC_STRUCT_Type *base, uint32_t notifyEventIntr,
+                                                    uint32_t message);
+extern cy_en_ipcdrv_status_t Cy_IPC_Drv_ReadMsgWord(IPC_STRUCT_Type const *base, uint32_t *message);
+extern cy_en_ipcdrv_status_t Cy_IPC_Drv_AcquireNotify(IPC_STRUCT_Type *base, uint32_t notifyEventIntr);
+extern void Cy_IPC_Drv_SetInterruptMask(IPC_INTR_STRUCT_Type *base, uint32_t ipcReleaseMask,
+                                        uint32_t ipcAcquireMask);
+extern uint32_t Cy_IPC_Drv_GetInterruptStatusMasked(IPC_INTR_STRUCT_Type const *base);
+extern void Cy_IPC_Drv_ClearInterrupt(IPC_INTR_STRUCT_Type *base, uint32_t ipcReleaseMask,
+                                      uint32_t ipcAcquireMask);
+#define Cy_IPC_Drv_ExtractAcquireMask(intMask)  (((intMask) >> 16) & 0xFFFFUL)
+
+/* Clocks and TCPWM */
+extern uint32_t Cy_SysClk_PeriPclkAssignDivider(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                                uint32_t dividerNum);
+extern uint32_t Cy_SysClk_PeriPclkSetDivider(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                             uint32_t dividerNum, uint32_t dividerValue);
+extern uint32_t Cy_SysClk_PeriPclkEnableDivider(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                                uint32_t dividerNum);
+extern uint32_t Cy_SysClk_PeriPclkGetFrequency(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                               uint32_t dividerNum);
+extern uint32_t Cy_TCPWM_Counter_Init(TCPWM_Type *base, uint32_t cntNum,
+                                      cy_stc_tcpwm_counter_config_t const *config);
+extern void Cy_TCPWM_Counter_Enable(TCPWM_Type *base, uint32_t cntNum);
+extern void Cy_TCPWM_Counter_Disable(TCPWM_Type *base, uint32_t cntNum);
+extern void Cy_TCPWM_TriggerStart_Single(TCPWM_Type *base, uint32_t cntNum);
+extern uint32_t Cy_TCPWM_Counter_GetCounter(TCPWM_Type const *base, uint32_t cntNum);
+extern uint32_t Cy_TCPWM_GetInterruptStatusMasked(TCPWM_Type const *base, uint32_t cntNum);
+extern void Cy_TCPWM_ClearInterrupt(TCPWM_Type *base, uint32_t cntNum, uint32_t source);
+extern uint32_t Cy_TCPWM_Counter_GetCapture0Val(TCPWM_Type const *base, uint32_t cntNum);
+extern uint32_t Cy_TCPWM_Counter_GetCapture0BufVal(TCPWM_Type const *base, uint32_t cntNum);
+extern uint32_t Cy_TCPWM_Counter_GetCapture1Val(TCPWM_Type const *base, uint32_t cntNum);
+extern uint32_t Cy_TCPWM_Counter_GetCapture1BufVal(TCPWM_Type const *base, uint32_t cntNum);
+extern uint32_t Cy_TCPWM_PWM_Init(TCPWM_Type *base, uint32_t cntNum, cy_stc_tcpwm_pwm_config_t const *config);
+extern void Cy_TCPWM_PWM_Enable(TCPWM_Type *base, uint32_t cntNum);
+extern void Cy_TCPWM_PWM_Disable(TCPWM_Type *base, uint32_t cntNum);
+extern void Cy_TCPWM_PWM_SetCompare1Val(TCPWM_Type *base, uint32_t cntNum, uint32_t compare1);
+extern uint32_t Cy_TCPWM_PWM_GetCounter(TCPWM_Type const *base, uint32_t cntNum);
+
+/* Trigger multiplexer */
+extern cy_en_trigmux_status_t Cy_TrigMux_Connect(uint32_t inTrig, uint32_t outTrig, bool invert,
+                                                 en_trig_type_t trigType);
+
+/* GPIO */
+extern GPIO_PRT_Type *Cy_GPIO_PortToAddr(uint32_t portNum);
+extern void Cy_GPIO_Inv(GPIO_PRT_Type *base, uint32_t pinNum);
+extern void Cy_GPIO_SetInterruptEdge(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+extern void Cy_GPIO_SetInterruptMask(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+extern uint32_t Cy_GPIO_GetInterruptStatusMasked(GPIO_PRT_Type const *base, uint32_t pinNum);
+extern void Cy_GPIO_ClearInterrupt(GPIO_PRT_Type *base, uint32_t pinNum);
+/* Port register writes of pin.h: OUT_SET, OUT_CLR and OUT_INV in one store */
+extern void sim_gpio_port_out(GPIO_PRT_Type *base, uint32_t set, uint32_t clr, uint32_t inv);
+extern uint32_t sim_gpio_port_read(GPIO_PRT_Type const *base);
+extern void Cy_GPIO_Pin_FastInit(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t driveMode, uint32_t outVal,
+                                 uint32_t hsiom);
+extern void Cy_GPIO_SetHSIOM(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+
+/* SAR ADC, converted by the simulation thread */
+extern cy_en_sar2_status_t Cy_SAR2_Init(PASS_SAR_Type *base, const cy_stc_sar2_config_t *config);
+extern void Cy_SAR2_DeInit(PASS_SAR_Type *base);
+extern void Cy_SAR2_Enable(PASS_SAR_Type *base);
+extern void Cy_SAR2_Disable(PASS_SAR_Type *base);
+extern void Cy_SAR2_SetReferenceBufferMode(PASS_EPASS_MMIO_Type *base, cy_en_sar2_ref_buf_mode_t mode);
+extern void Cy_SAR2_SetGenericTriggerInput(PASS_EPASS_MMIO_Type *base, uint8_t sarIndex,
+                                           uint8_t genericTriggerInputNumber, uint8_t triggerInputNumber);
+extern void Cy_SAR2_Channel_SoftwareTrigger(PASS_SAR_Type *base, uint32_t channel);
+extern uint16_t Cy_SAR2_Channel_GetResult(const PASS_SAR_Type *base, uint32_t channel, uint32_t *status);
+extern void Cy_SAR2_Channel_SetInterruptMask(PASS_SAR_Type *base, uint32_t channel, uint32_t intrMask);
+extern uint32_t Cy_SAR2_Channel_GetInterruptStatusMasked(const PASS_SAR_Type *base, uint32_t channel);
+extern void Cy_SAR2_Channel_ClearInterrupt(PASS_SAR_Type *base, uint32_t channel, uint32_t intrMask);
+
+/* CAN FD */
+extern cy_en_canfd_status_t Cy_CANFD_Init(CANFD_Type *base, uint32_t chan,
+                                          const cy_stc_canfd_config_t *config,
+                                          cy_stc_canfd_context_t *context);
+extern cy_en_canfd_status_t Cy_CANFD_DeInit(CANFD_Type *base, uint32_t chan,
+                                            cy_stc_canfd_context_t *context);
+extern cy_en_canfd_status_t Cy_CANFD_UpdateAndTransmitMsgBuffer(CANFD_Type *base, uint32_t chan,
+                                                                const cy_stc_canfd_tx_buffer_t *txBuffer,
+                                                                uint8_t index,
+                                                                cy_stc_canfd_context_t const *context);
+extern void Cy_CANFD_IrqHandler(CANFD_Type *base, uint32_t chan, cy_stc_canfd_context_t const *context);
+extern cy_en_canfd_status_t Cy_CANFD_ConfigChangesEnable(CANFD_Type *base, uint32_t chan);
+extern cy_en_canfd_status_t Cy_CANFD_ConfigChangesDisable(CANFD_Type *base, uint32_t chan);
+extern void Cy_CANFD_TestModeConfig(CANFD_Type *base, uint32_t chan, cy_en_canfd_test_mode_t testMode);
+
+#endif
@@ -0,0 +1,82 @@
+/******************************************************************************
+* File Name:   cybsp.h
+*
+* Description: Host stand-in of the KIT_XMC72_EVK board support package: pin
+*              assignment of the kit and board initialization, which starts
+*              the simulation.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _CYBSP_H_
+#define _CYBSP_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* LEDs and buttons are active low */
+#define CYBSP_LED_STATE_ON                  (0U)
+#define CYBSP_LED_STATE_OFF                 (1U)
+#define CYBSP_BTN_PRESSED                   (0U)
+#define CYBSP_BTN_OFF                       (1U)
+
+#define CYBSP_USER_LED1                     CYHAL_GET_GPIO(16u, 1u)
+#define CYBSP_USER_LED2                     CYHAL_GET_GPIO(16u, 2u)
+#define CYBSP_USER_LED3                     CYHAL_GET_GPIO(16u, 3u)
+#define CYBSP_USER_LED                      CYBSP_USER_LED1
+#define CYBSP_USER_BTN1                     CYHAL_GET_GPIO(21u, 4u)
+#define CYBSP_USER_BTN2                     CYHAL_GET_GPIO(17u, 3u)
+#define CYBSP_USER_BTN                      CYBSP_USER_BTN1
+#define CYBSP_DEBUG_UART_RX                 CYHAL_GET_GPIO(13u, 0u)
+#define CYBSP_DEBUG_UART_TX                 CYHAL_GET_GPIO(13u, 1u)
+#define CYBSP_DEBUG_UART_RTS                CYHAL_GET_GPIO(13u, 2u)
+#define CYBSP_DEBUG_UART_CTS                CYHAL_GET_GPIO(13u, 3u)
+#define CYBSP_POT                           CYHAL_GET_GPIO(12u, 0u)
+#define CYBSP_CANFD_STB                     CYHAL_GET_GPIO(2u, 2u)
+#define CYBSP_QSPI_SCK                      CYHAL_GET_GPIO(7u, 1u)
+#define CYBSP_QSPI_SS                       CYHAL_GET_GPIO(7u, 2u)
+#define CYBSP_QSPI_D0                       CYHAL_GET_GPIO(7u, 3u)
+#define CYBSP_QSPI_D1                       CYHAL_GET_GPIO(7u, 4u)
+#define CYBSP_QSPI_D2                       CYHAL_GET_GPIO(7u, 5u)
+#define CYBSP_QSPI_D3                       CYHAL_GET_GPIO(7u, 6u)
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t cybsp_init(void);
+
+#endif
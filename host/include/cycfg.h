@@ -0,0 +1,65 @@
+/******************************************************************************
+* File Name:   cycfg.h
+*
+* Description: Host stand-in of the device configurator output: the CAN FD
+*              channel of the CAN FD demo, with its message buffers.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _CYCFG_H_
+#define _CYCFG_H_
+
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CANFD_HW                            CANFD0
+#define CANFD_IRQ_0                         canfd_0_interrupts0_1_IRQn
+
+/*******************************************************************************
+* External Variables
+*******************************************************************************/
+extern const cy_stc_canfd_config_t CANFD_config;
+extern cy_stc_canfd_t0_t CANFD_T0RegisterBuffer_0;
+extern cy_stc_canfd_t1_t CANFD_T1RegisterBuffer_0;
+extern uint32_t CANFD_dataBuffer_0[];
+extern cy_stc_canfd_tx_buffer_t CANFD_txBuffer_0;
+
+/* Reception callback of the application, set in CANFD_config */
+extern void canfd_rx_callback(bool rxFIFOMsg, uint8_t msgBufOrRxFIFONum,
+                              cy_stc_canfd_rx_buffer_t *basemsg);
+
+#endif
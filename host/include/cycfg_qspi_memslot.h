@@ -0,0 +1,73 @@
+/******************************************************************************
+* File Name:   cycfg_qspi_memslot.h
+*
+* Description: Host stand-in of the QSPI configurator output: one serial NOR
+*              flash in slot 0.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _CYCFG_QSPI_MEMSLOT_H_
+#define _CYCFG_QSPI_MEMSLOT_H_
+
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CY_SMIF_DEVICE_NUM                  (1U)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t memSize;                       /* Size of the memory in bytes */
+    uint32_t eraseSize;                     /* Size of an erase sector in bytes */
+    uint32_t programSize;                   /* Size of a program page in bytes */
+} cy_stc_smif_mem_device_cfg_t;
+
+typedef struct
+{
+    uint32_t                      slaveSelect;
+    uint32_t                      flags;
+    cy_stc_smif_mem_device_cfg_t *deviceCfg;
+} cy_stc_smif_mem_config_t;
+
+/*******************************************************************************
+* External Variables
+*******************************************************************************/
+extern cy_stc_smif_mem_config_t *smifMemConfigs[CY_SMIF_DEVICE_NUM];
+
+#endif
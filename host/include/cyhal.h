@@ -0,0 +1,510 @@
+/******************************************************************************
+* File Name:   cyhal.h
+*
+* Description: Host stand-in of the hardware abstraction layer. Only the
+*              drivers used by proj_cm7_0 are provided; they are implemented
+*              by the simulation in host/source.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _CYHAL_H_
+#define _CYHAL_H_
+
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Pin numbering of the HAL: (port << 3) | pin */
+#define CYHAL_GET_GPIO(port, pin)           ((int32_t)(((port) << 3) | (pin)))
+#define CYHAL_GET_PORT(gpio)                ((uint32_t)(gpio) >> 3)
+#define CYHAL_GET_PIN(gpio)                 ((uint32_t)(gpio) & 0x7u)
+#define CYHAL_GET_PORTADDR(gpio)            (Cy_GPIO_PortToAddr(CYHAL_GET_PORT(gpio)))
+#define NC                                  ((cyhal_gpio_t)(-1))
+
+#define CYHAL_ISR_PRIORITY_DEFAULT          (7u)
+
+/* Error returned for a resource that is already in use or not available */
+#define CYHAL_HWMGR_RSLT_ERR_INUSE          (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0x0100u, 1u))
+#define CYHAL_GPIO_RSLT_ERR_BAD_PARAM       (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0x0200u, 1u))
+#define CYHAL_FLASH_RSLT_ERR_ADDRESS        (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0x0300u, 1u))
+#define CYHAL_UART_RSLT_ERR_TIMEOUT         (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0x0101u, 1u))
+#define CYHAL_SYSPM_RSLT_ERR_NOT_READY      (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0x0102u, 1u))
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef int32_t cyhal_gpio_t;
+
+typedef enum
+{
+    CYHAL_GPIO_DIR_INPUT,
+    CYHAL_GPIO_DIR_OUTPUT,
+    CYHAL_GPIO_DIR_BIDIRECTIONAL,
+} cyhal_gpio_direction_t;
+
+typedef enum
+{
+    CYHAL_GPIO_DRIVE_NONE,
+    CYHAL_GPIO_DRIVE_ANALOG,
+    CYHAL_GPIO_DRIVE_PULLUP,
+    CYHAL_GPIO_DRIVE_PULLDOWN,
+    CYHAL_GPIO_DRIVE_OPENDRAINDRIVESLOW,
+    CYHAL_GPIO_DRIVE_OPENDRAINDRIVESHIGH,
+    CYHAL_GPIO_DRIVE_STRONG,
+    CYHAL_GPIO_DRIVE_PULLUPDOWN,
+} cyhal_gpio_drive_mode_t;
+
+typedef enum
+{
+    CYHAL_GPIO_IRQ_NONE = 0,
+    CYHAL_GPIO_IRQ_RISE = 1 << 0,
+    CYHAL_GPIO_IRQ_FALL = 1 << 1,
+    CYHAL_GPIO_IRQ_BOTH = (1 << 0) | (1 << 1),
+} cyhal_gpio_event_t;
+
+typedef enum
+{
+    CYHAL_UART_PARITY_NONE,
+    CYHAL_UART_PARITY_EVEN,
+    CYHAL_UART_PARITY_ODD,
+} cyhal_uart_parity_t;
+
+typedef enum
+{
+    CYHAL_UART_IRQ_NONE           = 0,
+    CYHAL_UART_IRQ_TX_TRANSMIT_IN_FIFO = 1 << 1,
+    CYHAL_UART_IRQ_TX_DONE        = 1 << 2,
+    CYHAL_UART_IRQ_TX_ERROR       = 1 << 3,
+    CYHAL_UART_IRQ_RX_FULL        = 1 << 4,
+    CYHAL_UART_IRQ_RX_DONE        = 1 << 5,
+    CYHAL_UART_IRQ_RX_ERROR       = 1 << 6,
+    CYHAL_UART_IRQ_RX_NOT_EMPTY   = 1 << 7,
+    CYHAL_UART_IRQ_TX_EMPTY       = 1 << 8,
+} cyhal_uart_event_t;
+
+typedef enum
+{
+    CYHAL_TIMER_DIR_UP,
+    CYHAL_TIMER_DIR_DOWN,
+    CYHAL_TIMER_DIR_UP_DOWN,
+} cyhal_timer_direction_t;
+
+typedef enum
+{
+    CYHAL_TIMER_IRQ_NONE            = 0,
+    CYHAL_TIMER_IRQ_TERMINAL_COUNT  = 1 << 0,
+    CYHAL_TIMER_IRQ_CAPTURE_COMPARE = 1 << 1,
+    CYHAL_TIMER_IRQ_ALL             = (1 << 2) - 1,
+} cyhal_timer_event_t;
+
+typedef enum
+{
+    CYHAL_ADC_REF_INTERNAL,
+    CYHAL_ADC_REF_EXTERNAL,
+    CYHAL_ADC_REF_VDDA,
+    CYHAL_ADC_REF_VDDA_DIV_2,
+} cyhal_adc_vref_t;
+
+typedef enum
+{
+    CYHAL_ADC_VNEG_VSSA,
+    CYHAL_ADC_VNEG_VREF,
+} cyhal_adc_vneg_t;
+
+/* Negative input of a single-ended channel */
+#define CYHAL_ADC_VNEG                      ((cyhal_gpio_t)(-2))
+
+typedef enum
+{
+    CYHAL_RTC_ALARM = 1,
+} cyhal_rtc_event_t;
+
+typedef enum
+{
+    CYHAL_LPTIMER_COMPARE_MATCH = 1,
+} cyhal_lptimer_event_t;
+
+typedef enum
+{
+    CYHAL_SYSPM_CB_CPU_SLEEP            = 0x01U,
+    CYHAL_SYSPM_CB_CPU_DEEPSLEEP        = 0x02U,
+    CYHAL_SYSPM_CB_CPU_DEEPSLEEP_RAM    = 0x04U,
+    CYHAL_SYSPM_CB_SYSTEM_HIBERNATE     = 0x08U,
+    CYHAL_SYSPM_CB_SYSTEM_NORMAL        = 0x10U,
+    CYHAL_SYSPM_CB_SYSTEM_LOW           = 0x20U,
+} cyhal_syspm_callback_state_t;
+
+typedef enum
+{
+    CYHAL_SYSPM_CHECK_READY             = 0x01U,
+    CYHAL_SYSPM_CHECK_FAIL              = 0x02U,
+    CYHAL_SYSPM_BEFORE_TRANSITION       = 0x04U,
+    CYHAL_SYSPM_AFTER_TRANSITION        = 0x08U,
+} cyhal_syspm_callback_mode_t;
+
+typedef enum
+{
+    CYHAL_SYSPM_HIBERNATE_LPCOMP0_LOW   = 0x01U,
+    CYHAL_SYSPM_HIBERNATE_LPCOMP0_HIGH  = 0x02U,
+    CYHAL_SYSPM_HIBERNATE_RTC_ALARM     = 0x40U,
+    CYHAL_SYSPM_HIBERNATE_WDT           = 0x80U,
+    CYHAL_SYSPM_HIBERNATE_PINA_LOW      = 0x100U,
+    CYHAL_SYSPM_HIBERNATE_PINA_HIGH     = 0x200U,
+} cyhal_syspm_hibernate_source_t;
+
+typedef enum
+{
+    CYHAL_RSC_ADC,
+    CYHAL_RSC_CAN,
+    CYHAL_RSC_CLOCK,
+    CYHAL_RSC_GPIO,
+    CYHAL_RSC_SCB,
+    CYHAL_RSC_SMIF,
+    CYHAL_RSC_TCPWM,
+    CYHAL_RSC_RTC,
+    CYHAL_RSC_LPTIMER,
+} cyhal_resource_t;
+
+typedef enum
+{
+    CYHAL_CLOCK_BLOCK_PERIPHERAL0_8BIT,
+    CYHAL_CLOCK_BLOCK_PERIPHERAL0_16BIT,
+    CYHAL_CLOCK_BLOCK_PERIPHERAL1_8BIT,
+    CYHAL_CLOCK_BLOCK_PERIPHERAL1_16BIT,
+} cyhal_clock_block_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    cyhal_resource_t type;
+    uint8_t          block_num;
+    uint8_t          channel_num;
+} cyhal_resource_inst_t;
+
+typedef struct
+{
+    cyhal_clock_block_t block;
+    uint8_t             channel;
+    uint32_t            frequency_hz;
+    bool                enabled;
+} cyhal_clock_t;
+
+typedef void (*cyhal_gpio_event_callback_t)(void *callback_arg, cyhal_gpio_event_t event);
+
+typedef struct cyhal_gpio_callback_data_s
+{
+    cyhal_gpio_event_callback_t         callback;
+    void                               *callback_arg;
+    struct cyhal_gpio_callback_data_s  *next;
+    cyhal_gpio_t                        pin;
+} cyhal_gpio_callback_data_t;
+
+typedef void (*cyhal_uart_event_callback_t)(void *callback_arg, cyhal_uart_event_t event);
+
+typedef struct
+{
+    uint32_t             data_bits;
+    uint32_t             stop_bits;
+    cyhal_uart_parity_t  parity;
+    uint8_t             *rx_buffer;
+    uint32_t             rx_buffer_size;
+} cyhal_uart_cfg_t;
+
+typedef struct
+{
+    cyhal_gpio_t                tx;
+    cyhal_gpio_t                rx;
+    uint32_t                    baud_rate;
+    cyhal_uart_event_callback_t callback;
+    void                       *callback_arg;
+    uint32_t                    event_mask;
+    bool                        initialized;
+} cyhal_uart_t;
+
+typedef void (*cyhal_timer_event_callback_t)(void *callback_arg, cyhal_timer_event_t event);
+
+typedef struct
+{
+    bool                    is_continuous;
+    cyhal_timer_direction_t direction;
+    bool                    is_compare;
+    uint32_t                period;
+    uint32_t                compare_value;
+    uint32_t                value;
+} cyhal_timer_cfg_t;
+
+typedef struct
+{
+    uint32_t                     frequency_hz;
+    cyhal_timer_cfg_t            config;
+    cyhal_timer_event_callback_t callback;
+    void                        *callback_arg;
+    uint32_t                     event_mask;
+    bool                         running;
+    uint64_t                     start_us;          /* Virtual time of the last start */
+    uint64_t                     periods_done;      /* Terminal counts since the last start */
+    void                        *next;              /* Running timers, for the simulation */
+} cyhal_timer_t;
+
+typedef struct
+{
+    cyhal_gpio_t pin;
+    uint32_t     frequency_hz;
+    float        duty_cycle;
+    bool         running;
+} cyhal_pwm_t;
+
+typedef struct
+{
+    uint8_t          resolution;
+    uint8_t          average_count;
+    uint32_t         average_mode_flags;
+    bool             continuous_scanning;
+    cyhal_adc_vneg_t vneg;
+    cyhal_adc_vref_t vref;
+    cyhal_gpio_t     ext_vref;
+    uint32_t         ext_vref_mv;
+    bool             is_bypassed;
+    cyhal_gpio_t     bypass_pin;
+} cyhal_adc_config_t;
+
+typedef struct
+{
+    bool     enable_averaging;
+    uint32_t min_acquisition_ns;
+    bool     enabled;
+} cyhal_adc_channel_config_t;
+
+typedef struct
+{
+    cyhal_gpio_t       pin;
+    cyhal_adc_config_t config;
+    bool               initialized;
+} cyhal_adc_t;
+
+typedef struct
+{
+    cyhal_adc_t  *adc;
+    cyhal_gpio_t  vplus;
+    cyhal_gpio_t  vminus;
+} cyhal_adc_channel_t;
+
+typedef void (*cyhal_rtc_event_callback_t)(void *callback_arg, cyhal_rtc_event_t event);
+
+typedef struct
+{
+    cyhal_rtc_event_callback_t callback;
+    void                      *callback_arg;
+    bool                       alarm_enabled;
+    uint64_t                   alarm_us;            /* Virtual time of the alarm, 0 if none */
+} cyhal_rtc_t;
+
+typedef void (*cyhal_lptimer_event_callback_t)(void *callback_arg, cyhal_lptimer_event_t event);
+
+typedef struct
+{
+    bool                           initialized;
+    cyhal_lptimer_event_callback_t callback;
+    void                          *callback_arg;
+    bool                           match_enabled;
+    uint64_t                       match_us;        /* Virtual time of the match, 0 if none */
+    void                          *next;
+} cyhal_lptimer_t;
+
+typedef struct
+{
+    uint32_t frequency_hz;
+    uint8_t  min_set_delay;
+    uint32_t max_counter_value;
+} cyhal_lptimer_info_t;
+
+typedef struct
+{
+    bool     initialized;
+} cyhal_flash_t;
+
+/* Watchdog, modelled by the simulation thread */
+typedef struct
+{
+    bool     initialized;
+    uint32_t timeout_ms;
+} cyhal_wdt_t;
+
+typedef struct
+{
+    uint32_t start_address;
+    uint32_t size;
+    uint32_t sector_size;
+    uint32_t page_size;
+    uint8_t  erase_value;
+} cyhal_flash_block_info_t;
+
+typedef struct
+{
+    uint8_t                         block_count;
+    const cyhal_flash_block_info_t *blocks;
+} cyhal_flash_info_t;
+
+typedef bool (*cyhal_syspm_callback_t)(cyhal_syspm_callback_state_t state,
+                                       cyhal_syspm_callback_mode_t mode, void *callback_arg);
+
+typedef struct cyhal_syspm_callback_data
+{
+    cyhal_syspm_callback_t              callback;
+    cyhal_syspm_callback_state_t        states;
+    cyhal_syspm_callback_mode_t         ignore_modes;
+    void                               *args;
+    struct cyhal_syspm_callback_data   *next;
+} cyhal_syspm_callback_data_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+/* GPIO */
+extern cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                                 cyhal_gpio_drive_mode_t drive_mode, bool init_val);
+extern void cyhal_gpio_free(cyhal_gpio_t pin);
+extern cy_rslt_t cyhal_gpio_configure(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                                      cyhal_gpio_drive_mode_t drive_mode);
+extern void cyhal_gpio_write(cyhal_gpio_t pin, bool value);
+extern bool cyhal_gpio_read(cyhal_gpio_t pin);
+extern void cyhal_gpio_toggle(cyhal_gpio_t pin);
+extern void cyhal_gpio_register_callback(cyhal_gpio_t pin, cyhal_gpio_callback_data_t *callback_data);
+extern void cyhal_gpio_enable_event(cyhal_gpio_t pin, cyhal_gpio_event_t event,
+                                    uint8_t intr_priority, bool enable);
+
+/* UART */
+extern cy_rslt_t cyhal_uart_init(cyhal_uart_t *obj, cyhal_gpio_t tx, cyhal_gpio_t rx,
+                                 cyhal_gpio_t cts, cyhal_gpio_t rts, const cyhal_clock_t *clk,
+                                 const cyhal_uart_cfg_t *cfg);
+extern void cyhal_uart_free(cyhal_uart_t *obj);
+extern cy_rslt_t cyhal_uart_set_baud(cyhal_uart_t *obj, uint32_t baudrate, uint32_t *actualbaud);
+extern cy_rslt_t cyhal_uart_getc(cyhal_uart_t *obj, uint8_t *value, uint32_t timeout);
+extern uint32_t cyhal_uart_readable(cyhal_uart_t *obj);
+extern cy_rslt_t cyhal_uart_putc(cyhal_uart_t *obj, uint32_t value);
+extern bool cyhal_uart_is_tx_active(cyhal_uart_t *obj);
+extern void cyhal_uart_register_callback(cyhal_uart_t *obj, cyhal_uart_event_callback_t callback,
+                                         void *callback_arg);
+extern void cyhal_uart_enable_event(cyhal_uart_t *obj, cyhal_uart_event_t event,
+                                    uint8_t intr_priority, bool enable);
+
+/* Timer */
+extern cy_rslt_t cyhal_timer_init(cyhal_timer_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk);
+extern void cyhal_timer_free(cyhal_timer_t *obj);
+extern cy_rslt_t cyhal_timer_configure(cyhal_timer_t *obj, const cyhal_timer_cfg_t *cfg);
+extern cy_rslt_t cyhal_timer_set_frequency(cyhal_timer_t *obj, uint32_t hz);
+extern cy_rslt_t cyhal_timer_start(cyhal_timer_t *obj);
+extern cy_rslt_t cyhal_timer_stop(cyhal_timer_t *obj);
+extern uint32_t cyhal_timer_read(const cyhal_timer_t *obj);
+extern void cyhal_timer_register_callback(cyhal_timer_t *obj, cyhal_timer_event_callback_t callback,
+                                          void *callback_arg);
+extern void cyhal_timer_enable_event(cyhal_timer_t *obj, cyhal_timer_event_t event,
+                                     uint8_t intr_priority, bool enable);
+
+/* PWM */
+extern cy_rslt_t cyhal_pwm_init(cyhal_pwm_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk);
+extern void cyhal_pwm_free(cyhal_pwm_t *obj);
+extern cy_rslt_t cyhal_pwm_set_duty_cycle(cyhal_pwm_t *obj, float duty_cycle, uint32_t frequencyhal_hz);
+extern cy_rslt_t cyhal_pwm_start(cyhal_pwm_t *obj);
+extern cy_rslt_t cyhal_pwm_stop(cyhal_pwm_t *obj);
+
+/* ADC */
+extern cy_rslt_t cyhal_adc_init(cyhal_adc_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk);
+extern void cyhal_adc_free(cyhal_adc_t *obj);
+extern cy_rslt_t cyhal_adc_configure(cyhal_adc_t *obj, const cyhal_adc_config_t *config);
+extern cy_rslt_t cyhal_adc_channel_init_diff(cyhal_adc_channel_t *obj, cyhal_adc_t *adc,
+                                             cyhal_gpio_t vplus, cyhal_gpio_t vminus,
+                                             const cyhal_adc_channel_config_t *cfg);
+extern void cyhal_adc_channel_free(cyhal_adc_channel_t *obj);
+extern int32_t cyhal_adc_read_uv(const cyhal_adc_channel_t *obj);
+
+/* RTC */
+extern cy_rslt_t cyhal_rtc_init(cyhal_rtc_t *obj);
+extern void cyhal_rtc_free(cyhal_rtc_t *obj);
+extern cy_rslt_t cyhal_rtc_set_alarm_by_seconds(cyhal_rtc_t *obj, const uint32_t seconds);
+extern void cyhal_rtc_register_callback(cyhal_rtc_t *obj, cyhal_rtc_event_callback_t callback,
+                                        void *callback_arg);
+extern void cyhal_rtc_enable_event(cyhal_rtc_t *obj, cyhal_rtc_event_t event,
+                                   uint8_t intr_priority, bool enable);
+
+/* Low-power timer */
+extern cy_rslt_t cyhal_lptimer_init(cyhal_lptimer_t *obj);
+extern void cyhal_lptimer_free(cyhal_lptimer_t *obj);
+extern uint32_t cyhal_lptimer_read(const cyhal_lptimer_t *obj);
+extern void cyhal_lptimer_get_info(cyhal_lptimer_t *obj, cyhal_lptimer_info_t *info);
+extern cy_rslt_t cyhal_lptimer_set_delay(cyhal_lptimer_t *obj, uint32_t delay);
+extern void cyhal_lptimer_register_callback(cyhal_lptimer_t *obj, cyhal_lptimer_event_callback_t callback,
+                                            void *callback_arg);
+extern void cyhal_lptimer_enable_event(cyhal_lptimer_t *obj, cyhal_lptimer_event_t event,
+                                       uint8_t intr_priority, bool enable);
+
+/* Watchdog */
+extern cy_rslt_t cyhal_wdt_init(cyhal_wdt_t *obj, uint32_t timeout_ms);
+extern void cyhal_wdt_free(cyhal_wdt_t *obj);
+extern void cyhal_wdt_kick(cyhal_wdt_t *obj);
+extern void cyhal_wdt_start(cyhal_wdt_t *obj);
+extern void cyhal_wdt_stop(cyhal_wdt_t *obj);
+extern bool cyhal_wdt_is_enabled(cyhal_wdt_t *obj);
+
+/* Flash */
+extern cy_rslt_t cyhal_flash_init(cyhal_flash_t *obj);
+extern void cyhal_flash_free(cyhal_flash_t *obj);
+extern void cyhal_flash_get_info(const cyhal_flash_t *obj, cyhal_flash_info_t *info);
+extern cy_rslt_t cyhal_flash_read(cyhal_flash_t *obj, uint32_t address, uint8_t *data, size_t size);
+extern cy_rslt_t cyhal_flash_erase(cyhal_flash_t *obj, uint32_t address);
+extern cy_rslt_t cyhal_flash_program(cyhal_flash_t *obj, uint32_t address, const uint32_t *data);
+
+/* System power management */
+extern cy_rslt_t cyhal_syspm_init(void);
+extern void cyhal_syspm_register_callback(cyhal_syspm_callback_data_t *callback_data);
+extern void cyhal_syspm_unregister_callback(cyhal_syspm_callback_data_t *callback_data);
+extern cy_rslt_t cyhal_syspm_sleep(void);
+extern cy_rslt_t cyhal_syspm_deepsleep(void);
+extern cy_rslt_t cyhal_syspm_hibernate(cyhal_syspm_hibernate_source_t wakeup_source);
+
+/* System, clocks and resources */
+extern cy_rslt_t cyhal_system_delay_ms(uint32_t milliseconds);
+extern cy_rslt_t cyhal_clock_allocate(cyhal_clock_t *clock, cyhal_clock_block_t block);
+extern cy_rslt_t cyhal_clock_set_frequency(cyhal_clock_t *clock, uint32_t hz, const void *tolerance);
+extern uint32_t cyhal_clock_get_frequency(const cyhal_clock_t *clock);
+extern cy_rslt_t cyhal_clock_set_enabled(cyhal_clock_t *clock, bool enabled, bool wait_for_lock);
+extern void cyhal_clock_free(cyhal_clock_t *clock);
+extern cy_rslt_t cyhal_hwmgr_reserve(const cyhal_resource_inst_t *obj);
+extern void cyhal_hwmgr_free(const cyhal_resource_inst_t *obj);
+
+#endif
@@ -0,0 +1,136 @@
+/******************************************************************************
+* File Name:   sim.h
+*
+* Description: Host simulation of the XMC7000 peripherals used by proj_cm7_0.
+*              A simulation thread advances a virtual clock, models the
+*              peripherals and runs their interrupt callbacks. Every HAL and
+*              PDL call is recorded in a trace that can be checked by name.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _SIM_H_
+#define _SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Resolution of the virtual clock */
+#define SIM_TICK_US                 (100u)
+
+/* Simulated CPU clock, reported through SystemCoreClock and DWT->CYCCNT */
+#define SIM_CORE_CLOCK_HZ           (350000000u)
+
+/* Trace records kept in memory for sim_trace_count() and sim_trace_find() */
+#define SIM_TRACE_DEPTH             (4096u)
+#define SIM_TRACE_TEXT_SIZE         (96u)
+
+/* Arguments of a "P%u_%u" pin name in the trace */
+#define SIM_PIN(pin)                (unsigned int)((uint32_t)(pin) >> 3), (unsigned int)((uint32_t)(pin) & 0x7u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint64_t time_us;                       /* Virtual time of the call */
+    char     text[SIM_TRACE_TEXT_SIZE];     /* "<function> <arguments>" */
+} sim_trace_record_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+/* Simulation core */
+extern void sim_start(void);
+extern uint64_t sim_now_us(void);
+extern void sim_wait_us(uint64_t us);
+extern void sim_wait_for_interrupt(void);
+extern void sim_wait_for_event(void);
+extern void sim_send_event(void);
+extern void sim_lock(void);
+extern void sim_unlock(void);
+extern void sim_irq_disable(void);
+extern void sim_irq_enable(void);
+extern void sim_isr_done(void);
+extern bool sim_in_isr(void);
+extern void sim_fail(const char *file, int line, const char *reason);
+extern void sim_quit(int status);
+
+/* Call trace */
+extern void sim_trace(const char *format, ...) __attribute__((format(printf, 1, 2)));
+extern uint32_t sim_trace_count(const char *prefix);
+extern bool sim_trace_find(const char *prefix, sim_trace_record_t *record);
+extern void sim_trace_clear(void);
+extern void sim_trace_close(void);
+
+/* Stimuli, also reachable through the HOST_SIM_SCRIPT file */
+extern void sim_uart_rx(const char *text, uint32_t length);
+extern void sim_gpio_set_input(int32_t pin, bool level);
+extern void sim_gpio_set_pulse(int32_t pin, uint32_t hz, uint32_t duty_permille);
+extern void sim_adc_set_mv(int32_t mv);
+extern bool sim_adc_set_wave(const char *shape, int32_t min_mv, int32_t max_mv, uint32_t period_ms);
+extern void sim_canfd_rx(uint32_t id, const uint8_t *data, uint8_t dlc);
+
+/* Pseudo-terminal of the debug UART, see HOST_SIM_UART_PTY */
+extern bool sim_uart_open(void);
+
+/* Pin reservation shared by the GPIO and the PWM models */
+extern bool sim_gpio_reserve(int32_t pin);
+extern void sim_gpio_unreserve(int32_t pin);
+
+/* Peripheral models, run by the simulation thread with the lock held */
+extern void sim_gpio_tick(void);
+extern void sim_timer_tick(uint64_t now_us);
+extern void sim_uart_tick(void);
+extern void sim_adc_tick(uint64_t now_us);
+extern void sim_canfd_tick(void);
+extern void sim_ipc_tick(void);
+extern void sim_sysint_raise(uint32_t source);
+
+/* Watchdog, checked by the simulation thread even while interrupts are
+ * masked, and the backup registers that survive its reset */
+extern void sim_wdt_tick(uint64_t now_us);
+extern void sim_backup_load(void);
+extern void sim_backup_save(void);
+
+/* Trigger lines, pulsed by the simulation thread with the lock held */
+extern void sim_trigmux_fire(uint32_t in_trig);
+extern void sim_adc_trigger(uint32_t pass_input);
+extern void sim_trigmux_edge(uint32_t in_trig, bool rising, uint64_t time_ns);
+extern void sim_tcpwm_capture(uint32_t all_cnt_input, bool rising, uint64_t time_ns);
+
+#endif
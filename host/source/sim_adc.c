@@ -0,0 +1,547 @@
+/*******************************************************************************
+* File Name:   sim_adc.c
+*
+* Description: SAR ADC model of the host simulation. Every channel converts
+*              the potentiometer voltage, set by the script (1650 mV, half of
+*              the supply, by default) or following a waveform.
+*
+*              The PDL SAR channels of a continuous group convert once per
+*              simulation step, and their range detection sets the range
+*              interrupt of a channel whose result meets the mode and limits
+*              of its registers, as the hardware does after each conversion.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "cyhal.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_ADC_DEFAULT_MV          (1650)
+
+/* 12-bit PDL results against the VDDA reference */
+#define SIM_ADC_VREF_MV             (3300)
+#define SIM_ADC_FULL_SCALE          (4096)
+
+/* The potentiometer is input 0 of SAR 1, as on KIT_XMC72_EVK */
+#define SIM_ADC_POT_SAR             (1u)
+#define SIM_ADC_POT_INPUT           (CY_SAR2_PIN_ADDRESS_AN0)
+
+#define SIM_ADC_SARS                (2u)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    SIM_ADC_WAVE_NONE = 0,
+    SIM_ADC_WAVE_SINE,
+    SIM_ADC_WAVE_SQUARE,
+    SIM_ADC_WAVE_TRIANGLE,
+} sim_adc_wave_shape_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    sim_adc_wave_shape_t shape;
+    int32_t              min_mv;
+    int32_t              max_mv;
+    uint64_t             period_us;
+    uint64_t             start_us;
+} sim_adc_wave_t;
+
+typedef struct
+{
+    bool                     enabled;
+    bool                     continuous;    /* Channel 0 retriggers the group */
+    uint32_t                 trigger;       /* cy_en_sar2_trigger_selection_t of channel 0 */
+    uint32_t                 channels;      /* Channels up to the group end */
+    cy_en_sar2_pin_address_t input[CY_SAR2_CHAN_NUM];
+} sim_sar_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static int32_t sim_adc_mv = SIM_ADC_DEFAULT_MV;
+static sim_adc_wave_t sim_adc_wave;
+
+PASS_SAR_Type sim_pass_sar[SIM_ADC_SARS];
+PASS_EPASS_MMIO_Type sim_pass_epass;
+static sim_sar_t sim_sar[SIM_ADC_SARS];
+
+
+cy_rslt_t cyhal_adc_init(cyhal_adc_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk)
+{
+    (void)clk;
+
+    obj->pin = pin;
+    obj->initialized = true;
+    sim_trace("adc_init P%u_%u", SIM_PIN(pin));
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_adc_free(cyhal_adc_t *obj)
+{
+    obj->initialized = false;
+    sim_trace("adc_free");
+}
+
+cy_rslt_t cyhal_adc_configure(cyhal_adc_t *obj, const cyhal_adc_config_t *config)
+{
+    obj->config = *config;
+    sim_trace("adc_configure %u %d", (unsigned int)config->resolution, (int)config->continuous_scanning);
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_adc_channel_init_diff(cyhal_adc_channel_t *obj, cyhal_adc_t *adc,
+                                      cyhal_gpio_t vplus, cyhal_gpio_t vminus,
+                                      const cyhal_adc_channel_config_t *cfg)
+{
+    (void)cfg;
+
+    obj->adc = adc;
+    obj->vplus = vplus;
+    obj->vminus = vminus;
+    sim_trace("adc_channel_init P%u_%u", SIM_PIN(vplus));
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_adc_channel_free(cyhal_adc_channel_t *obj)
+{
+    obj->adc = NULL;
+    sim_trace("adc_channel_free");
+}
+
+int32_t cyhal_adc_read_uv(const cyhal_adc_channel_t *obj)
+{
+    int32_t mv = __atomic_load_n(&sim_adc_mv, __ATOMIC_RELAXED);
+
+    CY_ASSERT((NULL != obj->adc) && obj->adc->initialized);
+    sim_trace("adc_read_uv %ld", (long)mv * 1000);
+
+    return mv * 1000;
+}
+
+/*******************************************************************************
+* Function Name: sim_adc_set_mv
+********************************************************************************
+* Summary:
+*  Sets the voltage converted by the ADC channels.
+*
+* Parameters:
+*  mv: input voltage in millivolts
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_adc_set_mv(int32_t mv)
+{
+    sim_adc_wave.shape = SIM_ADC_WAVE_NONE;
+    __atomic_store_n(&sim_adc_mv, mv, __ATOMIC_RELAXED);
+    sim_trace("stim_adc %ld", (long)mv);
+}
+
+/*******************************************************************************
+* Function Name: sim_adc_set_wave
+********************************************************************************
+* Summary:
+*  Makes the potentiometer voltage follow a periodic waveform from now on,
+*  until the next sim_adc_set_mv().
+*
+* Parameters:
+*  shape: "sine", "square" (max first) or "triangle" (rising first)
+*  min_mv: lowest voltage in millivolts
+*  max_mv: highest voltage in millivolts
+*  period_ms: period
+*
+* Return:
+*  bool: false if the shape is unknown or the period is 0
+*
+*******************************************************************************/
+bool sim_adc_set_wave(const char *shape, int32_t min_mv, int32_t max_mv, uint32_t period_ms)
+{
+    sim_adc_wave_shape_t wave;
+
+    if (0 == strcmp(shape, "sine"))
+    {
+        wave = SIM_ADC_WAVE_SINE;
+    }
+    else if (0 == strcmp(shape, "square"))
+    {
+        wave = SIM_ADC_WAVE_SQUARE;
+    }
+    else if (0 == strcmp(shape, "triangle"))
+    {
+        wave = SIM_ADC_WAVE_TRIANGLE;
+    }
+    else
+    {
+        return false;
+    }
+    if (0u == period_ms)
+    {
+        return false;
+    }
+
+    sim_adc_wave.min_mv = min_mv;
+    sim_adc_wave.max_mv = max_mv;
+    sim_adc_wave.period_us = (uint64_t)period_ms * 1000u;
+    sim_adc_wave.start_us = sim_now_us();
+    sim_adc_wave.shape = wave;
+    sim_trace("stim_adc_wave %s %ld %ld %lu", shape, (long)min_mv, (long)max_mv, (unsigned long)period_ms);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_sar_convert
+********************************************************************************
+* Summary:
+*  Converts the group of a PDL SAR: stores each result with its valid and
+*  range flags, sets the range interrupt of the channels whose result meets
+*  their range detection and the group done interrupt of the last channel,
+*  and raises the masked interrupts.
+*
+* Parameters:
+*  sar: SAR index
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_sar_convert(uint32_t sar)
+{
+    PASS_SAR_Type *base = &sim_pass_sar[sar];
+    int32_t mv = __atomic_load_n(&sim_adc_mv, __ATOMIC_RELAXED);
+
+    for (uint32_t channel = 0u; channel < sim_sar[sar].channels; channel++)
+    {
+        PASS_SAR_CH_Type *ch = &base->CH[channel];
+        int32_t counts = 0;
+        uint32_t low = _FLD2VAL(PASS_SAR_CH_RANGE_CTL_RANGE_LO, ch->RANGE_CTL);
+        uint32_t high = _FLD2VAL(PASS_SAR_CH_RANGE_CTL_RANGE_HI, ch->RANGE_CTL);
+        bool in_range;
+
+        if (0u == ch->ENABLE)
+        {
+            continue;
+        }
+        if ((SIM_ADC_POT_SAR == sar) && (SIM_ADC_POT_INPUT == sim_sar[sar].input[channel]))
+        {
+            counts = (mv * SIM_ADC_FULL_SCALE) / SIM_ADC_VREF_MV;
+            counts = (counts < 0) ? 0 : ((counts >= SIM_ADC_FULL_SCALE) ? (SIM_ADC_FULL_SCALE - 1) : counts);
+        }
+
+        switch (_FLD2VAL(PASS_SAR_CH_POST_CTL_RANGE_MODE, ch->POST_CTL))
+        {
+            case CY_SAR2_RANGE_DETECTION_MODE_BELOW_LO:
+                in_range = ((uint32_t)counts < low);
+                break;
+            case CY_SAR2_RANGE_DETECTION_MODE_INSIDE_RANGE:
+                in_range = ((uint32_t)counts >= low) && ((uint32_t)counts < high);
+                break;
+            case CY_SAR2_RANGE_DETECTION_MODE_ABOVE_HI:
+                in_range = ((uint32_t)counts >= high);
+                break;
+            default:
+                in_range = ((uint32_t)counts < low) || ((uint32_t)counts >= high);
+                break;
+        }
+
+        ch->RESULT = (uint32_t)counts | CY_SAR2_STATUS_VALID | (in_range ? CY_SAR2_STATUS_RANGE : 0u);
+        if (in_range)
+        {
+            ch->INTR |= CY_SAR2_INT_CH_RANGE;
+        }
+    }
+
+    if (0u != sim_sar[sar].channels)
+    {
+        base->CH[sim_sar[sar].channels - 1u].INTR |= CY_SAR2_INT_GRP_DONE;
+    }
+
+    for (uint32_t channel = 0u; channel < sim_sar[sar].channels; channel++)
+    {
+        if (0u != (base->CH[channel].INTR & base->CH[channel].INTR_MASK))
+        {
+            sim_sysint_raise(((0u == sar) ? (uint32_t)pass_0_interrupts_sar_0_IRQn :
+                                            (uint32_t)pass_0_interrupts_sar_32_IRQn) + channel);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_adc_tick
+********************************************************************************
+* Summary:
+*  Advances the waveform of the potentiometer and converts the continuous
+*  groups of the PDL SARs, once per simulation step.
+*
+* Parameters:
+*  now_us: virtual time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_adc_tick(uint64_t now_us)
+{
+    if (SIM_ADC_WAVE_NONE != sim_adc_wave.shape)
+    {
+        double phase = (double)((now_us - sim_adc_wave.start_us) % sim_adc_wave.period_us) /
+                       (double)sim_adc_wave.period_us;
+        double span = (double)(sim_adc_wave.max_mv - sim_adc_wave.min_mv);
+        double mv;
+
+        switch (sim_adc_wave.shape)
+        {
+            case SIM_ADC_WAVE_SINE:
+                mv = sim_adc_wave.min_mv + (span * (1.0 + sin(2.0 * M_PI * phase)) / 2.0);
+                break;
+            case SIM_ADC_WAVE_SQUARE:
+                mv = (phase < 0.5) ? sim_adc_wave.max_mv : sim_adc_wave.min_mv;
+                break;
+            default:
+                mv = sim_adc_wave.min_mv + (span * ((phase < 0.5) ? (2.0 * phase) : (2.0 - (2.0 * phase))));
+                break;
+        }
+        __atomic_store_n(&sim_adc_mv, (int32_t)lround(mv), __ATOMIC_RELAXED);
+    }
+
+    for (uint32_t sar = 0u; sar < SIM_ADC_SARS; sar++)
+    {
+        if (sim_sar[sar].enabled && sim_sar[sar].continuous)
+        {
+            sim_sar_convert(sar);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_adc_trigger
+********************************************************************************
+* Summary:
+*  Pulses a PASS generic trigger input: converts the group of every enabled
+*  SAR whose channel 0 waits for a generic trigger mapped to that input by
+*  Cy_SAR2_SetGenericTriggerInput().
+*
+* Parameters:
+*  pass_input: PASS generic trigger input, driven by the trigger multiplexer
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_adc_trigger(uint32_t pass_input)
+{
+    for (uint32_t sar = 0u; sar < SIM_ADC_SARS; sar++)
+    {
+        uint32_t generic = sim_sar[sar].trigger - (uint32_t)CY_SAR2_TRIGGER_GENERIC0;
+
+        if (sim_sar[sar].enabled && (generic <= 4u) &&
+            (pass_input == ((sim_pass_epass.SAR_TR_IN_SEL[sar] >> (generic * 4u)) & 0xFu)))
+        {
+            sim_sar_convert(sar);
+        }
+    }
+}
+
+static uint32_t sim_sar_index(const PASS_SAR_Type *base)
+{
+    uint32_t sar = (uint32_t)(base - sim_pass_sar);
+
+    CY_ASSERT(sar < SIM_ADC_SARS);
+    return sar;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SAR2_Init
+********************************************************************************
+* Summary:
+*  Loads the channel configurations into the channel registers. The group of
+*  channel 0 ends at the first channel marked as group end.
+*
+* Parameters:
+*  base: SAR
+*  config: SAR and channel configuration
+*
+* Return:
+*  cy_en_sar2_status_t: CY_SAR2_SUCCESS
+*
+*******************************************************************************/
+cy_en_sar2_status_t Cy_SAR2_Init(PASS_SAR_Type *base, const cy_stc_sar2_config_t *config)
+{
+    uint32_t sar = sim_sar_index(base);
+
+    sim_lock();
+    memset(base, 0, sizeof(*base));
+    memset(&sim_sar[sar], 0, sizeof(sim_sar[sar]));
+    for (uint32_t channel = 0u; channel < CY_SAR2_CHAN_NUM; channel++)
+    {
+        const cy_stc_sar2_channel_config_t *cfg = config->channelConfig[channel];
+
+        if (NULL == cfg)
+        {
+            break;
+        }
+        base->CH[channel].POST_CTL = _VAL2FLD(PASS_SAR_CH_POST_CTL_RANGE_MODE, cfg->rangeDetectionMode);
+        base->CH[channel].RANGE_CTL = _VAL2FLD(PASS_SAR_CH_RANGE_CTL_RANGE_LO, cfg->rangeDetectionLoThreshold) |
+                                      _VAL2FLD(PASS_SAR_CH_RANGE_CTL_RANGE_HI, cfg->rangeDetectionHiThreshold);
+        base->CH[channel].INTR_MASK = cfg->interruptMask;
+        base->CH[channel].ENABLE = cfg->channelHwEnable ? 1u : 0u;
+        sim_sar[sar].input[channel] = cfg->pinAddress;
+        if (0u == channel)
+        {
+            sim_sar[sar].continuous = (CY_SAR2_TRIGGER_CONTINUOUS == cfg->triggerSelection);
+            sim_sar[sar].trigger = (uint32_t)cfg->triggerSelection;
+        }
+        if (0u == sim_sar[sar].channels)
+        {
+            sim_sar[sar].channels = cfg->isGroupEnd ? (channel + 1u) : 0u;
+        }
+    }
+    sim_trace("sar_init %lu %lu %d", (unsigned long)sar, (unsigned long)sim_sar[sar].channels,
+              (int)sim_sar[sar].continuous);
+    sim_unlock();
+
+    return CY_SAR2_SUCCESS;
+}
+
+void Cy_SAR2_DeInit(PASS_SAR_Type *base)
+{
+    uint32_t sar = sim_sar_index(base);
+
+    sim_lock();
+    memset(base, 0, sizeof(*base));
+    memset(&sim_sar[sar], 0, sizeof(sim_sar[sar]));
+    sim_trace("sar_deinit %lu", (unsigned long)sar);
+    sim_unlock();
+}
+
+void Cy_SAR2_Enable(PASS_SAR_Type *base)
+{
+    uint32_t sar = sim_sar_index(base);
+
+    sim_lock();
+    sim_sar[sar].enabled = true;
+    sim_trace("sar_enable %lu", (unsigned long)sar);
+    sim_unlock();
+}
+
+void Cy_SAR2_Disable(PASS_SAR_Type *base)
+{
+    uint32_t sar = sim_sar_index(base);
+
+    sim_lock();
+    sim_sar[sar].enabled = false;
+    sim_trace("sar_disable %lu", (unsigned long)sar);
+    sim_unlock();
+}
+
+void Cy_SAR2_SetReferenceBufferMode(PASS_EPASS_MMIO_Type *base, cy_en_sar2_ref_buf_mode_t mode)
+{
+    base->REF_BUF_MODE = (uint32_t)mode;
+}
+
+/* Generic trigger of a SAR from a PASS trigger input */
+void Cy_SAR2_SetGenericTriggerInput(PASS_EPASS_MMIO_Type *base, uint8_t sarIndex,
+                                    uint8_t genericTriggerInputNumber, uint8_t triggerInputNumber)
+{
+    uint32_t shift = (uint32_t)genericTriggerInputNumber * 4u;
+
+    sim_lock();
+    base->SAR_TR_IN_SEL[sarIndex] = (base->SAR_TR_IN_SEL[sarIndex] & ~(0xFu << shift)) |
+                                    (((uint32_t)triggerInputNumber & 0xFu) << shift);
+    sim_trace("sar_generic_trigger %u %u %u", (unsigned int)sarIndex, (unsigned int)genericTriggerInputNumber,
+              (unsigned int)triggerInputNumber);
+    sim_unlock();
+}
+
+/* Converts the group at once, a continuous group goes on at the next step */
+void Cy_SAR2_Channel_SoftwareTrigger(PASS_SAR_Type *base, uint32_t channel)
+{
+    uint32_t sar = sim_sar_index(base);
+
+    (void)channel;
+    sim_lock();
+    if (sim_sar[sar].enabled)
+    {
+        sim_sar_convert(sar);
+    }
+    sim_unlock();
+}
+
+uint16_t Cy_SAR2_Channel_GetResult(const PASS_SAR_Type *base, uint32_t channel, uint32_t *status)
+{
+    uint32_t result = base->CH[channel].RESULT;
+
+    if (NULL != status)
+    {
+        *status = result & (CY_SAR2_STATUS_VALID | CY_SAR2_STATUS_RANGE);
+    }
+
+    return (uint16_t)result;
+}
+
+void Cy_SAR2_Channel_SetInterruptMask(PASS_SAR_Type *base, uint32_t channel, uint32_t intrMask)
+{
+    base->CH[channel].INTR_MASK = intrMask;
+}
+
+uint32_t Cy_SAR2_Channel_GetInterruptStatusMasked(const PASS_SAR_Type *base, uint32_t channel)
+{
+    return base->CH[channel].INTR & base->CH[channel].INTR_MASK;
+}
+
+void Cy_SAR2_Channel_ClearInterrupt(PASS_SAR_Type *base, uint32_t channel, uint32_t intrMask)
+{
+    sim_lock();
+    base->CH[channel].INTR &= ~intrMask;
+    sim_unlock();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,374 @@
+/*******************************************************************************
+* File Name:   sim_canfd.c
+*
+* Description: CAN FD model of the host simulation, with the stand-in of the
+*              device configurator CAN FD data. Transmitted frames are traced.
+*              Frames injected by the script are received in Rx FIFO 0: the
+*              channel interrupt is raised, and Cy_CANFD_IrqHandler() passes
+*              the frame to the reception callback of the configuration.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include "cy_pdl.h"
+#include "cycfg.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_CANFD_RX_FRAMES         (16u)
+#define SIM_CANFD_DATA_WORDS        (CY_CANFD_DATA_ELEMENTS_MAX / 4u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t id;
+    uint8_t  dlc;
+    uint32_t data[SIM_CANFD_DATA_WORDS];
+} sim_canfd_frame_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+CANFD_Type sim_canfd0;
+
+/* Device configurator output */
+const cy_stc_canfd_config_t CANFD_config =
+{
+    .txCallback    = NULL,
+    .rxCallback    = canfd_rx_callback,
+    .errorCallback = NULL,
+    .canFDMode     = true,
+};
+cy_stc_canfd_t0_t CANFD_T0RegisterBuffer_0 =
+{
+    .id  = 0x22u,
+    .rtr = CY_CANFD_RTR_DATA_FRAME,
+    .xtd = 0u,
+    .esi = 0u,
+};
+cy_stc_canfd_t1_t CANFD_T1RegisterBuffer_0 =
+{
+    .dlc = 8u,
+    .brs = true,
+    .fdf = 1u,
+    .efc = 0u,
+    .mm  = 0u,
+};
+uint32_t CANFD_dataBuffer_0[SIM_CANFD_DATA_WORDS];
+cy_stc_canfd_tx_buffer_t CANFD_txBuffer_0 =
+{
+    .t0_f        = &CANFD_T0RegisterBuffer_0,
+    .t1_f        = &CANFD_T1RegisterBuffer_0,
+    .data_area_f = CANFD_dataBuffer_0,
+};
+
+static bool sim_canfd_initialized = false;
+static bool sim_canfd_config_change = false;
+static cy_en_canfd_test_mode_t sim_canfd_test_mode = CY_CANFD_TEST_MODE_DISABLE;
+
+static sim_canfd_frame_t sim_canfd_rx_fifo[SIM_CANFD_RX_FRAMES];
+static uint32_t sim_canfd_rx_head = 0u;
+static uint32_t sim_canfd_rx_tail = 0u;
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void sim_canfd_queue(uint32_t id, const uint8_t *data, uint8_t dlc);
+
+
+cy_en_canfd_status_t Cy_CANFD_Init(CANFD_Type *base, uint32_t chan,
+                                   const cy_stc_canfd_config_t *config,
+                                   cy_stc_canfd_context_t *context)
+{
+    (void)base;
+
+    sim_lock();
+    context->canFDInterruptHandling.canFDTxInterruptFunction = config->txCallback;
+    context->canFDInterruptHandling.canFDRxInterruptFunction = config->rxCallback;
+    context->canFDInterruptHandling.canFDErrorInterruptFunction = config->errorCallback;
+    sim_canfd_initialized = true;
+    sim_canfd_config_change = false;
+    sim_canfd_test_mode = CY_CANFD_TEST_MODE_DISABLE;
+    sim_trace("canfd_init %lu", (unsigned long)chan);
+    sim_unlock();
+
+    return CY_CANFD_SUCCESS;
+}
+
+cy_en_canfd_status_t Cy_CANFD_DeInit(CANFD_Type *base, uint32_t chan,
+                                     cy_stc_canfd_context_t *context)
+{
+    (void)base;
+
+    sim_lock();
+    memset(context, 0, sizeof(*context));
+    sim_canfd_initialized = false;
+    sim_trace("canfd_deinit %lu", (unsigned long)chan);
+    sim_unlock();
+
+    return CY_CANFD_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_CANFD_UpdateAndTransmitMsgBuffer
+********************************************************************************
+* Summary:
+*  Traces the frame as "canfd_tx <id> <dlc> <bytes>". There is no other node
+*  on the bus, so nothing answers; in the internal loop-back test mode the
+*  frame is received by the channel itself.
+*
+* Parameters:
+*  base: CAN FD block
+*  chan: channel
+*  txBuffer: frame to send
+*  index: message buffer
+*  context: channel context
+*
+* Return:
+*  cy_en_canfd_status_t: CY_CANFD_BAD_PARAM if the channel is not initialized
+*
+*******************************************************************************/
+cy_en_canfd_status_t Cy_CANFD_UpdateAndTransmitMsgBuffer(CANFD_Type *base, uint32_t chan,
+                                                         const cy_stc_canfd_tx_buffer_t *txBuffer,
+                                                         uint8_t index,
+                                                         cy_stc_canfd_context_t const *context)
+{
+    char bytes[(3u * 16u) + 1u] = "";
+    const uint8_t *data = (const uint8_t *)txBuffer->data_area_f;
+    uint32_t dlc = txBuffer->t1_f->dlc;
+
+    (void)base;
+    (void)chan;
+    (void)index;
+    (void)context;
+
+    if (!sim_canfd_initialized || (dlc > CY_CANFD_DATA_ELEMENTS_MAX))
+    {
+        return CY_CANFD_BAD_PARAM;
+    }
+
+    for (uint32_t byte = 0u; (byte < dlc) && (byte < 16u); byte++)
+    {
+        snprintf(&bytes[3u * byte], 4u, " %02x", (unsigned int)data[byte]);
+    }
+    sim_trace("canfd_tx 0x%03lx %lu%s", (unsigned long)txBuffer->t0_f->id, (unsigned long)dlc, bytes);
+
+    if (CY_CANFD_TEST_MODE_INTERNAL_LOOP_BACK == sim_canfd_test_mode)
+    {
+        sim_lock();
+        sim_canfd_queue(txBuffer->t0_f->id, data, (uint8_t)dlc);
+        sim_unlock();
+    }
+
+    return CY_CANFD_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_CANFD_IrqHandler
+********************************************************************************
+* Summary:
+*  Delivers the oldest received frame to the reception callback.
+*
+* Parameters:
+*  base: CAN FD block
+*  chan: channel
+*  context: channel context, holds the reception callback
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void Cy_CANFD_IrqHandler(CANFD_Type *base, uint32_t chan, cy_stc_canfd_context_t const *context)
+{
+    static cy_stc_canfd_r0_t r0;
+    static cy_stc_canfd_r1_t r1;
+    static uint32_t data[SIM_CANFD_DATA_WORDS];
+    cy_stc_canfd_rx_buffer_t message = { &r0, &r1, data };
+    sim_canfd_frame_t *frame;
+
+    (void)base;
+    (void)chan;
+
+    if (sim_canfd_rx_head == sim_canfd_rx_tail)
+    {
+        return;
+    }
+
+    frame = &sim_canfd_rx_fifo[sim_canfd_rx_tail % SIM_CANFD_RX_FRAMES];
+    r0.id = frame->id;
+    r0.rtr = CY_CANFD_RTR_DATA_FRAME;
+    r0.xtd = 0u;
+    r0.esi = 0u;
+    r1.dlc = frame->dlc;
+    r1.brs = true;
+    r1.fdf = 1u;
+    r1.fidx = 0u;
+    r1.anmf = false;
+    memcpy(data, frame->data, sizeof(data));
+    sim_canfd_rx_tail++;
+
+    if (NULL != context->canFDInterruptHandling.canFDRxInterruptFunction)
+    {
+        context->canFDInterruptHandling.canFDRxInterruptFunction(true, 0u, &message);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_canfd_rx
+********************************************************************************
+* Summary:
+*  Queues a data frame received from the bus. Frames are lost while the
+*  channel is not initialized or the FIFO is full.
+*
+* Parameters:
+*  id: standard identifier
+*  data: data bytes
+*  dlc: number of data bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_canfd_rx(uint32_t id, const uint8_t *data, uint8_t dlc)
+{
+    sim_lock();
+    sim_trace("stim_canfd_rx 0x%03lx %u", (unsigned long)id, (unsigned int)dlc);
+    sim_canfd_queue(id, data, dlc);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_canfd_queue
+********************************************************************************
+* Summary:
+*  Stores a frame in the reception FIFO. Called with the lock held.
+*
+* Parameters:
+*  id: standard identifier
+*  data: data bytes
+*  dlc: number of data bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_canfd_queue(uint32_t id, const uint8_t *data, uint8_t dlc)
+{
+    if (sim_canfd_initialized && ((sim_canfd_rx_head - sim_canfd_rx_tail) < SIM_CANFD_RX_FRAMES))
+    {
+        sim_canfd_frame_t *frame = &sim_canfd_rx_fifo[sim_canfd_rx_head % SIM_CANFD_RX_FRAMES];
+
+        frame->id = id;
+        frame->dlc = (dlc <= CY_CANFD_DATA_ELEMENTS_MAX) ? dlc : CY_CANFD_DATA_ELEMENTS_MAX;
+        memset(frame->data, 0, sizeof(frame->data));
+        memcpy(frame->data, data, frame->dlc);
+        sim_canfd_rx_head++;
+    }
+}
+
+cy_en_canfd_status_t Cy_CANFD_ConfigChangesEnable(CANFD_Type *base, uint32_t chan)
+{
+    (void)base;
+    sim_canfd_config_change = true;
+    sim_trace("canfd_config_changes_enable %lu", (unsigned long)chan);
+
+    return CY_CANFD_SUCCESS;
+}
+
+cy_en_canfd_status_t Cy_CANFD_ConfigChangesDisable(CANFD_Type *base, uint32_t chan)
+{
+    (void)base;
+    sim_canfd_config_change = false;
+    sim_trace("canfd_config_changes_disable %lu", (unsigned long)chan);
+
+    return CY_CANFD_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_CANFD_TestModeConfig
+********************************************************************************
+* Summary:
+*  Selects a test mode. As on the target, it only takes effect while the
+*  configuration changes are enabled.
+*
+* Parameters:
+*  base: CAN FD block
+*  chan: channel
+*  testMode: test mode
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void Cy_CANFD_TestModeConfig(CANFD_Type *base, uint32_t chan, cy_en_canfd_test_mode_t testMode)
+{
+    (void)base;
+    if (sim_canfd_config_change)
+    {
+        sim_canfd_test_mode = testMode;
+    }
+    sim_trace("canfd_test_mode %lu %d", (unsigned long)chan, (int)testMode);
+}
+
+/*******************************************************************************
+* Function Name: sim_canfd_tick
+********************************************************************************
+* Summary:
+*  Raises the channel interrupt while received frames are waiting.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_canfd_tick(void)
+{
+    if (sim_canfd_rx_head != sim_canfd_rx_tail)
+    {
+        sim_sysint_raise((uint32_t)CANFD_IRQ_0);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,1030 @@
+/*******************************************************************************
+* File Name:   sim_core.c
+*
+* Description: Core of the host simulation.
+*
+*              The application runs unchanged on the main thread. A simulation
+*              thread advances a virtual clock in SIM_TICK_US steps, applies
+*              the stimuli of the script and of the standard input, and runs
+*              the peripheral models, which call the interrupt callbacks of the
+*              application.
+*
+*              Interrupt masking is a lock shared by both threads: the
+*              simulation thread only runs callbacks while the application is
+*              outside its critical sections, as on the target. The virtual
+*              clock keeps running while interrupts are masked, so delays in
+*              critical sections still end.
+*
+*              Environment variables:
+*              HOST_SIM_SPEED         virtual/real time ratio, 0 = run as fast
+*                                     as possible (default 1)
+*              HOST_SIM_SCRIPT        stimulus script, see README.md
+*              HOST_SIM_TRACE         file receiving the call trace
+*              HOST_SIM_TIME_LIMIT_MS virtual time after which the run stops
+*              HOST_SIM_RESET_REASON  "hib" simulates a wake-up from Hibernate,
+*                                     "wdt" a watchdog reset
+*              HOST_SIM_BACKUP_FILE   file keeping the backup registers from
+*                                     one run to the next
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_SCRIPT_LINE_SIZE        (256u)
+#define SIM_SCRIPT_MAX_EVENTS       (1024u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* One line of the stimulus script */
+typedef struct
+{
+    uint64_t time_us;
+    char     command[16];
+    char     args[SIM_SCRIPT_LINE_SIZE];
+} sim_event_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void *sim_thread(void *arg);
+static void sim_load_script(const char *path);
+static bool sim_run_event(const sim_event_t *event);
+static void sim_poll_stdin(void);
+static void sim_restore_tty(void);
+static uint32_t sim_unescape(const char *text, char *out, uint32_t size);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t SystemCoreClock = SIM_CORE_CLOCK_HZ;
+CoreDebug_Type sim_core_debug;
+
+/* Interrupt mask: a recursive lock built on sim_mutex */
+static pthread_mutex_t sim_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  sim_free_cv = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  sim_irq_cv = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  sim_time_cv = PTHREAD_COND_INITIALIZER;
+static pthread_t       sim_owner;
+static bool            sim_owned = false;
+static uint32_t        sim_depth = 0u;
+static uint32_t        sim_irq_count = 0u;
+static bool            sim_irq_masked = false;
+static bool            sim_event_register = false;
+
+static pthread_t       sim_thread_id;
+static bool            sim_started = false;
+static uint64_t        sim_time_us = 0u;
+
+static double          sim_speed = 1.0;
+static uint64_t        sim_time_limit_us = 0u;
+static uint32_t        sim_reset_reason = 0u;
+
+static sim_event_t    *sim_events = NULL;
+static uint32_t        sim_event_count = 0u;
+static uint32_t        sim_event_next = 0u;
+
+static bool            sim_stdin_open = true;
+static bool            sim_tty_raw = false;
+static struct termios  sim_tty_saved;
+
+static DWT_Type        sim_dwt_regs;
+
+
+/*******************************************************************************
+* Function Name: sim_start
+********************************************************************************
+* Summary:
+*  Reads the configuration from the environment and starts the simulation
+*  thread. Called by cybsp_init().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_start(void)
+{
+    const char *value;
+
+    if (sim_started)
+    {
+        return;
+    }
+
+    value = getenv("HOST_SIM_SPEED");
+    if (NULL != value)
+    {
+        sim_speed = strtod(value, NULL);
+    }
+    value = getenv("HOST_SIM_TIME_LIMIT_MS");
+    if (NULL != value)
+    {
+        sim_time_limit_us = strtoull(value, NULL, 0) * 1000u;
+    }
+    value = getenv("HOST_SIM_RESET_REASON");
+    if ((NULL != value) && (0 == strcmp(value, "hib")))
+    {
+        sim_reset_reason = CY_SYSLIB_RESET_HIB_WAKEUP;
+    }
+    else if ((NULL != value) && (0 == strcmp(value, "wdt")))
+    {
+        sim_reset_reason = CY_SYSLIB_RESET_HWWDT;
+    }
+    sim_backup_load();
+    value = getenv("HOST_SIM_SCRIPT");
+    if (NULL != value)
+    {
+        sim_load_script(value);
+    }
+
+    /* A pseudo-terminal replaces the standard input of the debug UART */
+    if (sim_uart_open())
+    {
+        sim_stdin_open = false;
+    }
+
+    /* Keys reach the application one by one, without echo */
+    if (isatty(STDIN_FILENO) && (0 == tcgetattr(STDIN_FILENO, &sim_tty_saved)))
+    {
+        struct termios raw = sim_tty_saved;
+
+        raw.c_lflag &= ~(tcflag_t)(ICANON | ECHO);
+        raw.c_cc[VMIN] = 0;
+        raw.c_cc[VTIME] = 0;
+        (void)tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+        sim_tty_raw = true;
+    }
+    (void)fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+    atexit(sim_restore_tty);
+
+    sim_started = true;
+    if (0 != pthread_create(&sim_thread_id, NULL, sim_thread, NULL))
+    {
+        sim_fail(__FILE__, __LINE__, "cannot start the simulation thread");
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_now_us
+********************************************************************************
+* Summary:
+*  Returns the virtual time.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint64_t: microseconds since the simulation started
+*
+*******************************************************************************/
+uint64_t sim_now_us(void)
+{
+    return __atomic_load_n(&sim_time_us, __ATOMIC_ACQUIRE);
+}
+
+/*******************************************************************************
+* Function Name: sim_in_isr
+********************************************************************************
+* Summary:
+*  Checks whether the caller is an interrupt callback.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  true on the simulation thread
+*
+*******************************************************************************/
+bool sim_in_isr(void)
+{
+    return sim_started && pthread_equal(pthread_self(), sim_thread_id);
+}
+
+/*******************************************************************************
+* Function Name: sim_wait_us
+********************************************************************************
+* Summary:
+*  Busy-wait of the application: returns once the virtual clock has advanced
+*  by the given time. Interrupt callbacks only advance the clock, as they
+*  block the simulation thread.
+*
+* Parameters:
+*  us: time to wait
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_wait_us(uint64_t us)
+{
+    uint64_t target;
+
+    if (sim_in_isr() || !sim_started)
+    {
+        __atomic_add_fetch(&sim_time_us, us, __ATOMIC_RELEASE);
+        return;
+    }
+
+    pthread_mutex_lock(&sim_mutex);
+    target = sim_time_us + us;
+    while (sim_time_us < target)
+    {
+        pthread_cond_wait(&sim_time_cv, &sim_mutex);
+    }
+    pthread_mutex_unlock(&sim_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_lock
+********************************************************************************
+* Summary:
+*  Masks the interrupts: waits until the other thread leaves its critical
+*  section. Nests.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_lock(void)
+{
+    pthread_t self = pthread_self();
+
+    pthread_mutex_lock(&sim_mutex);
+    while (sim_owned && !pthread_equal(sim_owner, self))
+    {
+        pthread_cond_wait(&sim_free_cv, &sim_mutex);
+    }
+    sim_owner = self;
+    sim_owned = true;
+    sim_depth++;
+    pthread_mutex_unlock(&sim_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_unlock
+********************************************************************************
+* Summary:
+*  Leaves a critical section entered with sim_lock().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_unlock(void)
+{
+    pthread_mutex_lock(&sim_mutex);
+    if (sim_owned && pthread_equal(sim_owner, pthread_self()) && (0u != sim_depth))
+    {
+        sim_depth--;
+        if (0u == sim_depth)
+        {
+            sim_owned = false;
+            pthread_cond_broadcast(&sim_free_cv);
+        }
+    }
+    pthread_mutex_unlock(&sim_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_try_lock
+********************************************************************************
+* Summary:
+*  Enters a critical section of the simulation thread unless the application
+*  masks the interrupts.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  true if the lock was taken
+*
+*******************************************************************************/
+static bool sim_try_lock(void)
+{
+    bool taken = false;
+
+    pthread_mutex_lock(&sim_mutex);
+    if (!sim_owned)
+    {
+        sim_owner = pthread_self();
+        sim_owned = true;
+        sim_depth = 1u;
+        taken = true;
+    }
+    pthread_mutex_unlock(&sim_mutex);
+
+    return taken;
+}
+
+/*******************************************************************************
+* Function Name: sim_irq_disable
+********************************************************************************
+* Summary:
+*  __disable_irq(): masks the interrupts until __enable_irq().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_irq_disable(void)
+{
+    if (!sim_irq_masked && !sim_in_isr())
+    {
+        sim_lock();
+        sim_irq_masked = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_irq_enable
+********************************************************************************
+* Summary:
+*  __enable_irq(): ends the masking of __disable_irq().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_irq_enable(void)
+{
+    if (sim_irq_masked && !sim_in_isr())
+    {
+        sim_irq_masked = false;
+        sim_unlock();
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_isr_done
+********************************************************************************
+* Summary:
+*  Called by the peripheral models after an interrupt callback. Wakes the
+*  application from __WFI().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_isr_done(void)
+{
+    pthread_mutex_lock(&sim_mutex);
+    sim_irq_count++;
+    pthread_cond_broadcast(&sim_irq_cv);
+    pthread_mutex_unlock(&sim_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_wait_for_interrupt
+********************************************************************************
+* Summary:
+*  __WFI(): sleeps until the next interrupt callback. As on the target, an
+*  interrupt masked by the caller still ends the wait; the callback runs
+*  during the wait instead of after the critical section.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_wait_for_interrupt(void)
+{
+    pthread_t self = pthread_self();
+    uint32_t saved_depth = 0u;
+    uint32_t count;
+
+    if (sim_in_isr())
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&sim_mutex);
+    if (sim_owned && pthread_equal(sim_owner, self))
+    {
+        saved_depth = sim_depth;
+        sim_depth = 0u;
+        sim_owned = false;
+        pthread_cond_broadcast(&sim_free_cv);
+    }
+
+    count = sim_irq_count;
+    while (sim_irq_count == count)
+    {
+        pthread_cond_wait(&sim_irq_cv, &sim_mutex);
+    }
+
+    if (0u != saved_depth)
+    {
+        while (sim_owned)
+        {
+            pthread_cond_wait(&sim_free_cv, &sim_mutex);
+        }
+        sim_owner = self;
+        sim_owned = true;
+        sim_depth = saved_depth;
+    }
+    pthread_mutex_unlock(&sim_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_wait_for_event
+********************************************************************************
+* Summary:
+*  __WFE(): returns at once and clears the event register if an event was
+*  signalled since the last call, else sleeps until the next __SEV() or
+*  interrupt callback. Not meant for a caller that masks the interrupts.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_wait_for_event(void)
+{
+    uint32_t count;
+
+    if (sim_in_isr())
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&sim_mutex);
+    count = sim_irq_count;
+    while (!sim_event_register && (sim_irq_count == count))
+    {
+        pthread_cond_wait(&sim_irq_cv, &sim_mutex);
+    }
+    sim_event_register = false;
+    pthread_mutex_unlock(&sim_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_send_event
+********************************************************************************
+* Summary:
+*  __SEV(): sets the event register and wakes a sleeping __WFE(). Callable
+*  from any thread, including the simulation thread during a callback.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_send_event(void)
+{
+    pthread_mutex_lock(&sim_mutex);
+    sim_event_register = true;
+    pthread_cond_broadcast(&sim_irq_cv);
+    pthread_mutex_unlock(&sim_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_fail
+********************************************************************************
+* Summary:
+*  Stops the simulation on a failed assertion.
+*
+* Parameters:
+*  file: source file
+*  line: source line
+*  reason: failed expression
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_fail(const char *file, int line, const char *reason)
+{
+    fflush(stdout);
+    fprintf(stderr, "\r\n[sim] %s:%d: assertion failed: %s\r\n", file, line, reason);
+    sim_trace("assert %s:%d %s", file, line, reason);
+    sim_quit(2);
+}
+
+/*******************************************************************************
+* Function Name: sim_quit
+********************************************************************************
+* Summary:
+*  Ends the simulation: saves the backup registers, closes the trace and
+*  exits the process.
+*
+* Parameters:
+*  status: exit status
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_quit(int status)
+{
+    fflush(stdout);
+    sim_backup_save();
+    sim_trace("quit %d", status);
+    sim_trace_close();
+    exit(status);
+}
+
+/*******************************************************************************
+* Function Name: sim_thread
+********************************************************************************
+* Summary:
+*  Simulation thread: paces and advances the virtual clock, then applies the
+*  stimuli and runs the peripheral models unless interrupts are masked.
+*
+* Parameters:
+*  arg: unused
+*
+* Return:
+*  never
+*
+*******************************************************************************/
+static void *sim_thread(void *arg)
+{
+    struct timespec next;
+    uint64_t now;
+
+    (void)arg;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    for (;;)
+    {
+        if (sim_speed > 0.0)
+        {
+            uint64_t step_ns = (uint64_t)((double)SIM_TICK_US * 1000.0 / sim_speed);
+
+            next.tv_nsec += (long)(step_ns % 1000000000u);
+            next.tv_sec += (time_t)(step_ns / 1000000000u) + (next.tv_nsec / 1000000000L);
+            next.tv_nsec %= 1000000000L;
+            while (EINTR == clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL))
+            {
+            }
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+
+        pthread_mutex_lock(&sim_mutex);
+        sim_time_us += SIM_TICK_US;
+        now = sim_time_us;
+        pthread_cond_broadcast(&sim_time_cv);
+        pthread_mutex_unlock(&sim_mutex);
+
+        if ((0u != sim_time_limit_us) && (now >= sim_time_limit_us))
+        {
+            sim_quit(0);
+        }
+        /* The watchdog resets the device even while interrupts are masked */
+        sim_wdt_tick(now);
+        /* A quit ends the run even while the application masks interrupts */
+        if ((sim_event_next < sim_event_count) && (sim_events[sim_event_next].time_us <= now) &&
+            (0 == strcmp(sim_events[sim_event_next].command, "quit")))
+        {
+            sim_quit(atoi(sim_events[sim_event_next].args));
+        }
+
+        if (!sim_try_lock())
+        {
+            continue;
+        }
+
+        while ((sim_event_next < sim_event_count) && (sim_events[sim_event_next].time_us <= now))
+        {
+            (void)sim_run_event(&sim_events[sim_event_next]);
+            sim_event_next++;
+        }
+        sim_poll_stdin();
+
+        sim_gpio_tick();
+        sim_timer_tick(now);
+        sim_uart_tick();
+        sim_adc_tick(now);
+        sim_canfd_tick();
+        sim_ipc_tick();
+        sim_unlock();
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: sim_load_script
+********************************************************************************
+* Summary:
+*  Reads the stimulus script: one "<time_ms> <command> [arguments]" per line,
+*  in time order. Lines starting with '#' are comments.
+*
+* Parameters:
+*  path: script file
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_load_script(const char *path)
+{
+    char line[SIM_SCRIPT_LINE_SIZE];
+    FILE *file = fopen(path, "r");
+
+    if (NULL == file)
+    {
+        fprintf(stderr, "[sim] cannot open script %s\n", path);
+        exit(2);
+    }
+
+    sim_events = calloc(SIM_SCRIPT_MAX_EVENTS, sizeof(sim_event_t));
+    while ((NULL != fgets(line, sizeof(line), file)) && (sim_event_count < SIM_SCRIPT_MAX_EVENTS))
+    {
+        sim_event_t *event = &sim_events[sim_event_count];
+        unsigned long long time_ms;
+        int used = 0;
+
+        line[strcspn(line, "\r\n")] = '\0';
+        if (('#' == line[0]) || (2 != sscanf(line, "%llu %15s %n", &time_ms, event->command, &used)))
+        {
+            continue;
+        }
+        event->time_us = (uint64_t)time_ms * 1000u;
+        snprintf(event->args, sizeof(event->args), "%s", &line[used]);
+        sim_event_count++;
+    }
+    fclose(file);
+}
+
+/*******************************************************************************
+* Function Name: sim_run_event
+********************************************************************************
+* Summary:
+*  Applies one script line:
+*   key <text>            characters received by the debug UART (\r, \n, \xHH)
+*   press <1|2>           presses a user button
+*   release <1|2>         releases a user button
+*   pulse <1|2> <Hz> <duty permille>
+*                         pulse train on the pin of a user button, 0 Hz stops
+*   adc <mV>              voltage at the potentiometer input
+*   adc_wave <shape> <min mV> <max mV> <period ms>
+*                         potentiometer waveform: sine, square or triangle
+*   can <id> <bytes...>   CAN FD data frame received, bytes in hex
+*   quit [status]         ends the run
+*
+* Parameters:
+*  event: script line
+*
+* Return:
+*  false if the command is unknown
+*
+*******************************************************************************/
+static bool sim_run_event(const sim_event_t *event)
+{
+    char text[SIM_SCRIPT_LINE_SIZE];
+    uint32_t length;
+
+    if (0 == strcmp(event->command, "key"))
+    {
+        length = sim_unescape(event->args, text, sizeof(text));
+        sim_uart_rx(text, length);
+    }
+    else if ((0 == strcmp(event->command, "press")) || (0 == strcmp(event->command, "release")))
+    {
+        cyhal_gpio_t pin = (2 == atoi(event->args)) ? CYBSP_USER_BTN2 : CYBSP_USER_BTN1;
+
+        sim_gpio_set_input(pin, ('r' == event->command[0]) ? CYBSP_BTN_OFF : CYBSP_BTN_PRESSED);
+    }
+    else if (0 == strcmp(event->command, "pulse"))
+    {
+        unsigned int button;
+        unsigned long hz;
+        unsigned long duty;
+
+        if (3 != sscanf(event->args, "%u %lu %lu", &button, &hz, &duty))
+        {
+            fprintf(stderr, "[sim] bad pulse arguments '%s'\n", event->args);
+            return false;
+        }
+        sim_gpio_set_pulse((2u == button) ? CYBSP_USER_BTN2 : CYBSP_USER_BTN1, (uint32_t)hz, (uint32_t)duty);
+    }
+    else if (0 == strcmp(event->command, "adc"))
+    {
+        sim_adc_set_mv((int32_t)strtol(event->args, NULL, 0));
+    }
+    else if (0 == strcmp(event->command, "adc_wave"))
+    {
+        char shape[16];
+        long min_mv;
+        long max_mv;
+        unsigned long period_ms;
+
+        if ((4 != sscanf(event->args, "%15s %ld %ld %lu", shape, &min_mv, &max_mv, &period_ms)) ||
+            !sim_adc_set_wave(shape, (int32_t)min_mv, (int32_t)max_mv, (uint32_t)period_ms))
+        {
+            fprintf(stderr, "[sim] bad adc_wave arguments '%s'\n", event->args);
+            return false;
+        }
+    }
+    else if (0 == strcmp(event->command, "can"))
+    {
+        uint8_t data[CY_CANFD_DATA_ELEMENTS_MAX];
+        uint8_t dlc = 0u;
+        char *cursor = NULL;
+        uint32_t id = (uint32_t)strtoul(event->args, &cursor, 0);
+
+        while ((dlc < sizeof(data)) && (NULL != cursor) && ('\0' != *cursor))
+        {
+            char *end;
+            unsigned long byte = strtoul(cursor, &end, 16);
+
+            if (end == cursor)
+            {
+                break;
+            }
+            data[dlc++] = (uint8_t)byte;
+            cursor = end;
+        }
+        sim_canfd_rx(id, data, dlc);
+    }
+    else
+    {
+        fprintf(stderr, "[sim] unknown script command '%s'\n", event->command);
+        return false;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_poll_stdin
+********************************************************************************
+* Summary:
+*  Passes the characters typed on the standard input to the debug UART.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_poll_stdin(void)
+{
+    char buffer[64];
+    ssize_t count;
+
+    if (!sim_stdin_open)
+    {
+        return;
+    }
+
+    count = read(STDIN_FILENO, buffer, sizeof(buffer));
+    if (count > 0)
+    {
+        sim_uart_rx(buffer, (uint32_t)count);
+    }
+    else if ((0 == count) || ((EAGAIN != errno) && (EWOULDBLOCK != errno)))
+    {
+        sim_stdin_open = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_restore_tty
+********************************************************************************
+* Summary:
+*  Restores the terminal settings on exit.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_restore_tty(void)
+{
+    if (sim_tty_raw)
+    {
+        (void)tcsetattr(STDIN_FILENO, TCSANOW, &sim_tty_saved);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_unescape
+********************************************************************************
+* Summary:
+*  Converts the \r, \n, \t, \\ and \xHH escapes of a script argument.
+*
+* Parameters:
+*  text: script argument
+*  out: converted characters, not terminated
+*  size: size of out
+*
+* Return:
+*  uint32_t: number of characters in out
+*
+*******************************************************************************/
+static uint32_t sim_unescape(const char *text, char *out, uint32_t size)
+{
+    uint32_t length = 0u;
+
+    while (('\0' != *text) && (length < size))
+    {
+        char c = *text++;
+
+        if (('\\' == c) && ('\0' != *text))
+        {
+            c = *text++;
+            switch (c)
+            {
+                case 'r': c = '\r'; break;
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'x': c = (char)strtol(text, (char **)&text, 16); break;
+                default: break;
+            }
+        }
+        out[length++] = c;
+    }
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: sim_dwt
+********************************************************************************
+* Summary:
+*  DWT registers. CYCCNT counts host time at SIM_CORE_CLOCK_HZ, so cycle
+*  measurements of the application report the host execution time.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  DWT_Type*: registers, CYCCNT refreshed
+*
+*******************************************************************************/
+DWT_Type *sim_dwt(void)
+{
+    struct timespec now;
+    uint64_t ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    ns = ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+    sim_dwt_regs.CYCCNT = (uint32_t)((ns * (SIM_CORE_CLOCK_HZ / 1000000u)) / 1000u);
+
+    return &sim_dwt_regs;
+}
+
+/*******************************************************************************
+* Function Name: cybsp_init
+********************************************************************************
+* Summary:
+*  Board initialization: starts the simulation.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    sim_start();
+    sim_trace("cybsp_init");
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_Delay
+********************************************************************************
+* Summary:
+*  Waits in virtual time.
+*
+* Parameters:
+*  milliseconds: delay
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void Cy_SysLib_Delay(uint32_t milliseconds)
+{
+    sim_wait_us((uint64_t)milliseconds * 1000u);
+}
+
+void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    sim_wait_us(microseconds);
+}
+
+cy_rslt_t cyhal_system_delay_ms(uint32_t milliseconds)
+{
+    sim_wait_us((uint64_t)milliseconds * 1000u);
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_EnterCriticalSection
+********************************************************************************
+* Summary:
+*  Masks the interrupt callbacks.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: value to pass to Cy_SysLib_ExitCriticalSection()
+*
+*******************************************************************************/
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    sim_lock();
+    return 0u;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    (void)savedIntrStatus;
+    sim_unlock();
+}
+
+uint32_t Cy_SysLib_GetResetReason(void)
+{
+    return sim_reset_reason;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,240 @@
+/*******************************************************************************
+* File Name:   sim_flash.c
+*
+* Description: Work flash model of the host simulation, backed by a file
+*              (HOST_SIM_FLASH_FILE, work_flash.bin by default) that is only
+*              created by the first erase or program, so that a run without
+*              saved data leaves no file behind. Programming only clears bits
+*              and erasing sets a sector to 0xFF.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cyhal.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_FLASH_WORK_SIZE         (0x00040000u)       /* 256 KB work flash */
+#define SIM_FLASH_SECTOR_SIZE       (2048u)             /* Large sectors */
+#define SIM_FLASH_PAGE_SIZE         (4u)                /* One word per program */
+#define SIM_FLASH_ERASE_VALUE       (0xFFu)
+#define SIM_FLASH_DEFAULT_FILE      "work_flash.bin"
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static cy_rslt_t sim_flash_check(const cyhal_flash_t *obj, uint32_t address, size_t size);
+static void sim_flash_store(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const cyhal_flash_block_info_t sim_flash_blocks[] =
+{
+    {
+        .start_address = CY_WFLASH_LG_SBM_TOP,
+        .size          = SIM_FLASH_WORK_SIZE,
+        .sector_size   = SIM_FLASH_SECTOR_SIZE,
+        .page_size     = SIM_FLASH_PAGE_SIZE,
+        .erase_value   = SIM_FLASH_ERASE_VALUE,
+    },
+};
+
+static uint8_t sim_flash_image[SIM_FLASH_WORK_SIZE];
+static bool sim_flash_loaded = false;
+
+
+/*******************************************************************************
+* Function Name: cyhal_flash_init
+********************************************************************************
+* Summary:
+*  Loads the backing file on the first call, else starts from an erased
+*  work flash.
+*
+* Parameters:
+*  obj: flash object
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cyhal_flash_init(cyhal_flash_t *obj)
+{
+    if (!sim_flash_loaded)
+    {
+        const char *path = getenv("HOST_SIM_FLASH_FILE");
+        FILE *file;
+
+        memset(sim_flash_image, SIM_FLASH_ERASE_VALUE, sizeof(sim_flash_image));
+        file = fopen((NULL != path) ? path : SIM_FLASH_DEFAULT_FILE, "rb");
+        if (NULL != file)
+        {
+            (void)fread(sim_flash_image, 1u, sizeof(sim_flash_image), file);
+            fclose(file);
+        }
+        sim_flash_loaded = true;
+    }
+    obj->initialized = true;
+    sim_trace("flash_init");
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_flash_free(cyhal_flash_t *obj)
+{
+    obj->initialized = false;
+    sim_trace("flash_free");
+}
+
+void cyhal_flash_get_info(const cyhal_flash_t *obj, cyhal_flash_info_t *info)
+{
+    (void)obj;
+    info->block_count = (uint8_t)(sizeof(sim_flash_blocks) / sizeof(sim_flash_blocks[0]));
+    info->blocks = sim_flash_blocks;
+}
+
+cy_rslt_t cyhal_flash_read(cyhal_flash_t *obj, uint32_t address, uint8_t *data, size_t size)
+{
+    cy_rslt_t result = sim_flash_check(obj, address, size);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memcpy(data, &sim_flash_image[address - CY_WFLASH_LG_SBM_TOP], size);
+    }
+    sim_trace("flash_read 0x%08lx %lu", (unsigned long)address, (unsigned long)size);
+
+    return result;
+}
+
+cy_rslt_t cyhal_flash_erase(cyhal_flash_t *obj, uint32_t address)
+{
+    cy_rslt_t result = sim_flash_check(obj, address, SIM_FLASH_SECTOR_SIZE);
+
+    if ((CY_RSLT_SUCCESS == result) && (0u != ((address - CY_WFLASH_LG_SBM_TOP) % SIM_FLASH_SECTOR_SIZE)))
+    {
+        result = CYHAL_FLASH_RSLT_ERR_ADDRESS;
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memset(&sim_flash_image[address - CY_WFLASH_LG_SBM_TOP], SIM_FLASH_ERASE_VALUE, SIM_FLASH_SECTOR_SIZE);
+        sim_flash_store();
+    }
+    sim_trace("flash_erase 0x%08lx", (unsigned long)address);
+
+    return result;
+}
+
+cy_rslt_t cyhal_flash_program(cyhal_flash_t *obj, uint32_t address, const uint32_t *data)
+{
+    cy_rslt_t result = sim_flash_check(obj, address, SIM_FLASH_PAGE_SIZE);
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    if ((CY_RSLT_SUCCESS == result) && (0u != (address % SIM_FLASH_PAGE_SIZE)))
+    {
+        result = CYHAL_FLASH_RSLT_ERR_ADDRESS;
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        for (uint32_t index = 0u; index < SIM_FLASH_PAGE_SIZE; index++)
+        {
+            sim_flash_image[address - CY_WFLASH_LG_SBM_TOP + index] &= bytes[index];
+        }
+        sim_flash_store();
+    }
+    sim_trace("flash_program 0x%08lx", (unsigned long)address);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: sim_flash_check
+********************************************************************************
+* Summary:
+*  Checks that the flash object is initialized and the range inside the work
+*  flash.
+*
+* Parameters:
+*  obj: flash object
+*  address: start address
+*  size: number of bytes
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or CYHAL_FLASH_RSLT_ERR_ADDRESS
+*
+*******************************************************************************/
+static cy_rslt_t sim_flash_check(const cyhal_flash_t *obj, uint32_t address, size_t size)
+{
+    if (!obj->initialized || (address < CY_WFLASH_LG_SBM_TOP) ||
+        (((uint64_t)address + size) > ((uint64_t)CY_WFLASH_LG_SBM_TOP + SIM_FLASH_WORK_SIZE)))
+    {
+        return CYHAL_FLASH_RSLT_ERR_ADDRESS;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_flash_store
+********************************************************************************
+* Summary:
+*  Writes the work flash image back to its file.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_flash_store(void)
+{
+    const char *path = getenv("HOST_SIM_FLASH_FILE");
+    FILE *file = fopen((NULL != path) ? path : SIM_FLASH_DEFAULT_FILE, "wb");
+
+    if (NULL != file)
+    {
+        (void)fwrite(sim_flash_image, 1u, sizeof(sim_flash_image), file);
+        fclose(file);
+    }
+}
+
+/* [] END OF FILE */
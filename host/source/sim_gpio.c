@@ -0,0 +1,668 @@
+/*******************************************************************************
+* File Name:   sim_gpio.c
+*
+* Description: GPIO model of the host simulation. Outputs keep the written
+*              level, inputs follow the levels set by the script (buttons
+*              idle high). An input change calls the registered callback on
+*              the enabled edges, from the simulation thread. A pin set to
+*              its trigger input function passes its edges, at the
+*              nanosecond for a pulse train, to the trigger multiplexer.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_GPIO_PORTS              (32u)
+#define SIM_GPIO_NUM                (SIM_GPIO_PORTS * 8u)
+#define SIM_GPIO_TRIGGER_PINS       (2u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    bool                        initialized;
+    cyhal_gpio_direction_t      direction;
+    bool                        level;          /* Level seen by cyhal_gpio_read() */
+    bool                        out;            /* Output register, driven by an output */
+    bool                        input;          /* Level driven by the script */
+    bool                        seen;           /* Level at the last edge detection */
+    uint32_t                    events;         /* Enabled cyhal_gpio_event_t */
+    cyhal_gpio_callback_data_t *callback;
+    uint32_t                    intr_edge;      /* PDL CY_GPIO_INTR_* */
+    bool                        intr_mask;      /* PDL interrupt enabled */
+    bool                        intr_status;    /* PDL interrupt pending */
+    uint32_t                    trig_line;      /* Trigger input driven, 0 for none */
+    uint64_t                    pulse_period_ns;/* Pulse train on the input, 0 for none */
+    uint64_t                    pulse_high_ns;
+    uint64_t                    pulse_start_ns;
+} sim_gpio_t;
+
+/* Pin and line of the PERI_TR_IO_INPUT functions that are modelled */
+typedef struct
+{
+    cyhal_gpio_t pin;
+    uint32_t     trig_line;
+} sim_gpio_trigger_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static sim_gpio_t sim_gpio[SIM_GPIO_NUM];
+static bool sim_gpio_defaults = false;
+
+/* Virtual time of the last tick, the start of the pulse edges of the next */
+static uint64_t sim_gpio_tick_ns = 0u;
+
+static const sim_gpio_trigger_t sim_gpio_triggers[SIM_GPIO_TRIGGER_PINS] =
+{
+    { CYBSP_USER_BTN1, TRIG_IN_MUX_5_PERI_TR_IO_INPUT22 },
+    { CYBSP_USER_BTN2, TRIG_IN_MUX_5_PERI_TR_IO_INPUT17 },
+};
+
+/* Port registers handed out by Cy_GPIO_PortToAddr() */
+static GPIO_PRT_Type sim_gpio_prt[SIM_GPIO_PORTS];
+
+
+/*******************************************************************************
+* Function Name: sim_gpio_get
+********************************************************************************
+* Summary:
+*  Returns the model of a pin, with the inputs idle high on first use.
+*
+* Parameters:
+*  pin: HAL pin
+*
+* Return:
+*  sim_gpio_t*: pin model
+*
+*******************************************************************************/
+static sim_gpio_t *sim_gpio_get(cyhal_gpio_t pin)
+{
+    CY_ASSERT((pin >= 0) && ((uint32_t)pin < SIM_GPIO_NUM));
+
+    if (!sim_gpio_defaults)
+    {
+        for (uint32_t index = 0u; index < SIM_GPIO_NUM; index++)
+        {
+            sim_gpio[index].level = true;
+            sim_gpio[index].input = true;
+            sim_gpio[index].seen = true;
+        }
+        sim_gpio_defaults = true;
+    }
+
+    return &sim_gpio[pin];
+}
+
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                          cyhal_gpio_drive_mode_t drive_mode, bool init_val)
+{
+    sim_gpio_t *gpio;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    sim_lock();
+    gpio = sim_gpio_get(pin);
+    if (gpio->initialized)
+    {
+        result = CYHAL_HWMGR_RSLT_ERR_INUSE;
+    }
+    else
+    {
+        gpio->initialized = true;
+        gpio->direction = direction;
+        gpio->out = init_val;
+        gpio->level = (CYHAL_GPIO_DIR_INPUT == direction) ? gpio->input : init_val;
+        gpio->seen = gpio->level;
+    }
+    sim_trace("gpio_init P%u_%u %d %d %d", SIM_PIN(pin), (int)direction, (int)drive_mode, (int)init_val);
+    sim_unlock();
+
+    return result;
+}
+
+void cyhal_gpio_free(cyhal_gpio_t pin)
+{
+    sim_gpio_t *gpio;
+
+    sim_lock();
+    gpio = sim_gpio_get(pin);
+    gpio->initialized = false;
+    gpio->events = 0u;
+    gpio->callback = NULL;
+    gpio->intr_edge = CY_GPIO_INTR_DISABLE;
+    gpio->intr_mask = false;
+    gpio->intr_status = false;
+    gpio->level = gpio->input;
+    gpio->seen = gpio->level;
+    sim_trace("gpio_free P%u_%u", SIM_PIN(pin));
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: cyhal_gpio_configure
+********************************************************************************
+* Summary:
+*  Changes the direction of an initialized pin. An input reads the level
+*  driven by the script again, an output drives its output register.
+*
+* Parameters:
+*  pin: HAL pin
+*  direction: new direction
+*  drive_mode: new drive mode (traced only)
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, or CYHAL_GPIO_RSLT_ERR_BAD_PARAM if the pin
+*             is not initialized
+*
+*******************************************************************************/
+cy_rslt_t cyhal_gpio_configure(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                               cyhal_gpio_drive_mode_t drive_mode)
+{
+    sim_gpio_t *gpio;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    sim_lock();
+    gpio = sim_gpio_get(pin);
+    if (!gpio->initialized)
+    {
+        result = CYHAL_GPIO_RSLT_ERR_BAD_PARAM;
+    }
+    else
+    {
+        gpio->direction = direction;
+        if (CYHAL_GPIO_DIR_INPUT == direction)
+        {
+            gpio->level = gpio->input;
+            gpio->seen = gpio->level;
+        }
+        else
+        {
+            gpio->level = gpio->out;
+        }
+    }
+    sim_trace("gpio_configure P%u_%u %d %d", SIM_PIN(pin), (int)direction, (int)drive_mode);
+    sim_unlock();
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: sim_gpio_reserve
+********************************************************************************
+* Summary:
+*  Reserves a pin for another HAL driver, such as a PWM output, so that
+*  cyhal_gpio_init() of the pin fails as on the device.
+*
+* Parameters:
+*  pin: HAL pin
+*
+* Return:
+*  bool: false if the pin is already in use
+*
+*******************************************************************************/
+bool sim_gpio_reserve(int32_t pin)
+{
+    sim_gpio_t *gpio;
+    bool reserved = false;
+
+    sim_lock();
+    gpio = sim_gpio_get(pin);
+    if (!gpio->initialized)
+    {
+        gpio->initialized = true;
+        reserved = true;
+    }
+    sim_unlock();
+
+    return reserved;
+}
+
+void sim_gpio_unreserve(int32_t pin)
+{
+    sim_lock();
+    sim_gpio_get(pin)->initialized = false;
+    sim_unlock();
+}
+
+/* The output register is written also while the pin is an input, as on the
+ * device, and is driven once the pin is configured as an output */
+void cyhal_gpio_write(cyhal_gpio_t pin, bool value)
+{
+    sim_lock();
+    sim_gpio_get(pin)->out = value;
+    if (CYHAL_GPIO_DIR_INPUT != sim_gpio_get(pin)->direction)
+    {
+        sim_gpio_get(pin)->level = value;
+    }
+    sim_trace("gpio_write P%u_%u %d", SIM_PIN(pin), (int)value);
+    sim_unlock();
+}
+
+/* Reads are frequent in polling loops and are not traced */
+bool cyhal_gpio_read(cyhal_gpio_t pin)
+{
+    bool level;
+
+    sim_lock();
+    level = sim_gpio_get(pin)->level;
+    sim_unlock();
+
+    return level;
+}
+
+void cyhal_gpio_toggle(cyhal_gpio_t pin)
+{
+    sim_gpio_t *gpio;
+
+    sim_lock();
+    gpio = sim_gpio_get(pin);
+    if (CYHAL_GPIO_DIR_INPUT != gpio->direction)
+    {
+        gpio->level = !gpio->level;
+        gpio->out = gpio->level;
+    }
+    sim_trace("gpio_toggle P%u_%u %d", SIM_PIN(pin), (int)gpio->level);
+    sim_unlock();
+}
+
+void cyhal_gpio_register_callback(cyhal_gpio_t pin, cyhal_gpio_callback_data_t *callback_data)
+{
+    sim_lock();
+    sim_gpio_get(pin)->callback = callback_data;
+    sim_trace("gpio_register_callback P%u_%u %s", SIM_PIN(pin), (NULL != callback_data) ? "set" : "none");
+    sim_unlock();
+}
+
+void cyhal_gpio_enable_event(cyhal_gpio_t pin, cyhal_gpio_event_t event,
+                             uint8_t intr_priority, bool enable)
+{
+    sim_gpio_t *gpio;
+
+    sim_lock();
+    gpio = sim_gpio_get(pin);
+    if (enable)
+    {
+        gpio->events |= (uint32_t)event;
+    }
+    else
+    {
+        gpio->events &= ~(uint32_t)event;
+    }
+    sim_trace("gpio_enable_event P%u_%u %d %u %d", SIM_PIN(pin), (int)event,
+              (unsigned int)intr_priority, (int)enable);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: Cy_GPIO_PortToAddr
+********************************************************************************
+* Summary:
+*  PDL access to the pin models, used by the handlers that bypass the HAL
+*  interrupt dispatch. A port is only its number.
+*
+* Parameters:
+*  portNum: port number
+*
+* Return:
+*  GPIO_PRT_Type*: port
+*
+*******************************************************************************/
+GPIO_PRT_Type *Cy_GPIO_PortToAddr(uint32_t portNum)
+{
+    CY_ASSERT(portNum < SIM_GPIO_PORTS);
+    sim_gpio_prt[portNum].port = portNum;
+
+    return &sim_gpio_prt[portNum];
+}
+
+void Cy_GPIO_Inv(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    cyhal_gpio_toggle(CYHAL_GET_GPIO(base->port, pinNum));
+}
+
+void Cy_GPIO_SetInterruptEdge(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    sim_lock();
+    sim_gpio_get(CYHAL_GET_GPIO(base->port, pinNum))->intr_edge = value;
+    sim_trace("gpio_set_interrupt_edge P%u_%u %lu", (unsigned int)base->port, (unsigned int)pinNum,
+              (unsigned long)value);
+    sim_unlock();
+}
+
+void Cy_GPIO_SetInterruptMask(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    sim_lock();
+    sim_gpio_get(CYHAL_GET_GPIO(base->port, pinNum))->intr_mask = (0u != value);
+    sim_trace("gpio_set_interrupt_mask P%u_%u %lu", (unsigned int)base->port, (unsigned int)pinNum,
+              (unsigned long)value);
+    sim_unlock();
+}
+
+/* Called from the handlers, not traced */
+uint32_t Cy_GPIO_GetInterruptStatusMasked(GPIO_PRT_Type const *base, uint32_t pinNum)
+{
+    sim_gpio_t *gpio = sim_gpio_get(CYHAL_GET_GPIO(base->port, pinNum));
+
+    return (gpio->intr_mask && gpio->intr_status) ? 1u : 0u;
+}
+
+void Cy_GPIO_ClearInterrupt(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    sim_gpio_get(CYHAL_GET_GPIO(base->port, pinNum))->intr_status = false;
+}
+
+/* Only the analog inputs use it, the pin is just traced */
+void Cy_GPIO_Pin_FastInit(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t driveMode, uint32_t outVal,
+                          uint32_t hsiom)
+{
+    (void)outVal;
+    sim_trace("gpio_pin_fast_init P%u_%u %lu %lu", (unsigned int)base->port, (unsigned int)pinNum,
+              (unsigned long)driveMode, (unsigned long)hsiom);
+}
+
+/*******************************************************************************
+* Function Name: Cy_GPIO_SetHSIOM
+********************************************************************************
+* Summary:
+*  Selects the function of a pin. The trigger input function of a pin of
+*  sim_gpio_triggers connects its edges to the trigger multiplexer; any
+*  other function disconnects them.
+*
+* Parameters:
+*  base: port
+*  pinNum: pin in the port
+*  value: HSIOM function
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void Cy_GPIO_SetHSIOM(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    cyhal_gpio_t pin = CYHAL_GET_GPIO(base->port, pinNum);
+    sim_gpio_t *gpio;
+
+    sim_lock();
+    gpio = sim_gpio_get(pin);
+    gpio->trig_line = 0u;
+    for (uint32_t index = 0u; (HSIOM_SEL_GPIO != value) && (index < SIM_GPIO_TRIGGER_PINS); index++)
+    {
+        if (sim_gpio_triggers[index].pin == pin)
+        {
+            gpio->trig_line = sim_gpio_triggers[index].trig_line;
+        }
+    }
+    sim_trace("gpio_set_hsiom P%u_%u %lu", (unsigned int)base->port, (unsigned int)pinNum, (unsigned long)value);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_gpio_port_out
+********************************************************************************
+* Summary:
+*  Port register store of pin.h. The output pins of the mask change together
+*  and the store is traced as "gpio_port_out P<port> <set> <clr> <inv>".
+*
+* Parameters:
+*  base: port
+*  set: pins driven high (OUT_SET)
+*  clr: pins driven low (OUT_CLR)
+*  inv: pins inverted (OUT_INV)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_gpio_port_out(GPIO_PRT_Type *base, uint32_t set, uint32_t clr, uint32_t inv)
+{
+    sim_lock();
+    for (uint32_t pin = 0u; pin < 8u; pin++)
+    {
+        sim_gpio_t *gpio = sim_gpio_get(CYHAL_GET_GPIO(base->port, pin));
+        uint32_t mask = 1UL << pin;
+
+        if (CYHAL_GPIO_DIR_INPUT == gpio->direction)
+        {
+            continue;
+        }
+        if (0u != (set & mask))
+        {
+            gpio->level = true;
+        }
+        if (0u != (clr & mask))
+        {
+            gpio->level = false;
+        }
+        if (0u != (inv & mask))
+        {
+            gpio->level = !gpio->level;
+        }
+        gpio->out = gpio->level;
+    }
+    sim_trace("gpio_port_out P%u 0x%02lx 0x%02lx 0x%02lx", (unsigned int)base->port,
+              (unsigned long)set, (unsigned long)clr, (unsigned long)inv);
+    sim_unlock();
+}
+
+/* Output register of a port, not traced */
+uint32_t sim_gpio_port_read(GPIO_PRT_Type const *base)
+{
+    uint32_t out = 0u;
+
+    sim_lock();
+    for (uint32_t pin = 0u; pin < 8u; pin++)
+    {
+        if (sim_gpio_get(CYHAL_GET_GPIO(base->port, pin))->level)
+        {
+            out |= 1UL << pin;
+        }
+    }
+    sim_unlock();
+
+    return out;
+}
+
+/*******************************************************************************
+* Function Name: sim_gpio_set_input
+********************************************************************************
+* Summary:
+*  Drives a pin from outside. The change is applied on the next tick.
+*
+* Parameters:
+*  pin: HAL pin
+*  level: new level
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_gpio_set_input(int32_t pin, bool level)
+{
+    sim_lock();
+    sim_gpio_get(pin)->input = level;
+    sim_trace("stim_gpio P%u_%u %d", SIM_PIN(pin), (int)level);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_gpio_set_pulse
+********************************************************************************
+* Summary:
+*  Drives a pin with a pulse train from the next tick on: high from the start
+*  of each period for the duty cycle, then low. A frequency of 0 ends the
+*  train and leaves the pin idle high.
+*
+* Parameters:
+*  pin: HAL pin
+*  hz: frequency, 0 to stop
+*  duty_permille: high time, 1/1000 of the period
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_gpio_set_pulse(int32_t pin, uint32_t hz, uint32_t duty_permille)
+{
+    sim_gpio_t *gpio;
+
+    sim_lock();
+    gpio = sim_gpio_get(pin);
+    gpio->pulse_period_ns = (0u != hz) ? (1000000000u / hz) : 0u;
+    gpio->pulse_high_ns = (gpio->pulse_period_ns * ((duty_permille < 1000u) ? duty_permille : 1000u)) / 1000u;
+    gpio->pulse_start_ns = sim_gpio_tick_ns + 1u;
+    if (0u == hz)
+    {
+        gpio->input = true;
+    }
+    sim_trace("stim_pulse P%u_%u %lu %lu", SIM_PIN(pin), (unsigned long)hz, (unsigned long)duty_permille);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_gpio_pulse_tick
+********************************************************************************
+* Summary:
+*  Passes the edges of the pulse train of a pin since the last tick to its
+*  trigger input in time order, and sets the input to the level at the
+*  end of the tick.
+*
+* Parameters:
+*  gpio: pin model with a pulse train
+*  now_ns: virtual time of the tick
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_gpio_pulse_tick(sim_gpio_t *gpio, uint64_t now_ns)
+{
+    const uint64_t period = gpio->pulse_period_ns;
+    const uint64_t high = gpio->pulse_high_ns;
+    uint64_t first = (sim_gpio_tick_ns > gpio->pulse_start_ns)
+                     ? ((sim_gpio_tick_ns - gpio->pulse_start_ns) / period) : 0u;
+
+    if (now_ns < gpio->pulse_start_ns)
+    {
+        return;
+    }
+
+    /* A duty cycle of 0 or 1000 has no edge */
+    for (uint64_t rise = gpio->pulse_start_ns + (first * period);
+         (0u != gpio->trig_line) && (0u != high) && (high < period) && (rise <= now_ns); rise += period)
+    {
+        if (rise > sim_gpio_tick_ns)
+        {
+            sim_trigmux_edge(gpio->trig_line, true, rise);
+        }
+        if (((rise + high) > sim_gpio_tick_ns) && ((rise + high) <= now_ns))
+        {
+            sim_trigmux_edge(gpio->trig_line, false, rise + high);
+        }
+    }
+    gpio->input = (((now_ns - gpio->pulse_start_ns) % period) < high);
+}
+
+/*******************************************************************************
+* Function Name: sim_gpio_tick
+********************************************************************************
+* Summary:
+*  Applies the input changes and calls the callbacks of the enabled edges. As
+*  the input buffer stays on in the strong drive mode, edges written to an
+*  output pin are detected as well. Edges enabled through the PDL raise the
+*  system interrupt of the port instead. The callbacks see at most one edge
+*  of a pulse train per tick; its trigger input sees all of them.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_gpio_tick(void)
+{
+    uint64_t now_ns = sim_now_us() * 1000u;
+
+    for (uint32_t index = 0u; sim_gpio_defaults && (index < SIM_GPIO_NUM); index++)
+    {
+        sim_gpio_t *gpio = &sim_gpio[index];
+        cyhal_gpio_event_t edge;
+
+        if (0u != gpio->pulse_period_ns)
+        {
+            sim_gpio_pulse_tick(gpio, now_ns);
+        }
+        if (CYHAL_GPIO_DIR_OUTPUT != gpio->direction)
+        {
+            gpio->level = gpio->input;
+        }
+        if (gpio->level == gpio->seen)
+        {
+            continue;
+        }
+
+        gpio->seen = gpio->level;
+        edge = gpio->level ? CYHAL_GPIO_IRQ_RISE : CYHAL_GPIO_IRQ_FALL;
+        if ((0u != gpio->trig_line) && (0u == gpio->pulse_period_ns))
+        {
+            sim_trigmux_edge(gpio->trig_line, gpio->level, now_ns);
+        }
+        if ((0u != (gpio->events & (uint32_t)edge)) && (NULL != gpio->callback) &&
+            (NULL != gpio->callback->callback))
+        {
+            sim_trace("gpio_irq P%u_%u %d", SIM_PIN(index), (int)edge);
+            gpio->callback->callback(gpio->callback->callback_arg, edge);
+            sim_isr_done();
+        }
+        if (gpio->intr_mask && (0u != (gpio->intr_edge & (uint32_t)edge)))
+        {
+            gpio->intr_status = true;
+            sim_trace("gpio_pdl_irq P%u_%u %d", SIM_PIN(index), (int)edge);
+            sim_sysint_raise((uint32_t)ioss_interrupts_gpio_0_IRQn + (index >> 3));
+        }
+    }
+    sim_gpio_tick_ns = now_ns;
+}
+
+/* [] END OF FILE */
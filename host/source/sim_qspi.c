@@ -0,0 +1,265 @@
+/*******************************************************************************
+* File Name:   sim_qspi.c
+*
+* Description: Serial flash model of the host simulation, backed by a file
+*              (HOST_SIM_QSPI_FILE, qspi_flash.bin by default) so that the
+*              memory content survives between runs. Programming only clears
+*              bits and erasing sets a sector to 0xFF, as on NOR flash.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cy_serial_flash_qspi.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_QSPI_MEM_SIZE           (0x04000000u)       /* 64 MB, S25FL512S */
+#define SIM_QSPI_ERASE_SIZE         (0x00040000u)       /* 256 KB sectors */
+#define SIM_QSPI_PROGRAM_SIZE       (512u)
+#define SIM_QSPI_DEFAULT_FILE       "qspi_flash.bin"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Memory configurator output */
+static cy_stc_smif_mem_device_cfg_t sim_qspi_device_cfg =
+{
+    .memSize     = SIM_QSPI_MEM_SIZE,
+    .eraseSize   = SIM_QSPI_ERASE_SIZE,
+    .programSize = SIM_QSPI_PROGRAM_SIZE,
+};
+static cy_stc_smif_mem_config_t sim_qspi_mem_config =
+{
+    .slaveSelect = 0u,
+    .flags       = 0u,
+    .deviceCfg   = &sim_qspi_device_cfg,
+};
+cy_stc_smif_mem_config_t *smifMemConfigs[CY_SMIF_DEVICE_NUM] = { &sim_qspi_mem_config };
+
+static FILE *sim_qspi_file = NULL;
+static const cy_stc_smif_mem_config_t *sim_qspi_config = NULL;
+
+
+/*******************************************************************************
+* Function Name: cy_serial_flash_qspi_init
+********************************************************************************
+* Summary:
+*  Opens the backing file, creating it erased if needed.
+*
+* Parameters:
+*  mem_config: memory configuration
+*  io0..io7, sclk, ssel: QSPI pins (traced only)
+*  hz: bus frequency
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or CY_RSLT_SERIAL_FLASH_ERR_IO
+*
+*******************************************************************************/
+cy_rslt_t cy_serial_flash_qspi_init(const cy_stc_smif_mem_config_t *mem_config,
+                                    cyhal_gpio_t io0, cyhal_gpio_t io1, cyhal_gpio_t io2,
+                                    cyhal_gpio_t io3, cyhal_gpio_t io4, cyhal_gpio_t io5,
+                                    cyhal_gpio_t io6, cyhal_gpio_t io7, cyhal_gpio_t sclk,
+                                    cyhal_gpio_t ssel, uint32_t hz)
+{
+    const char *path = getenv("HOST_SIM_QSPI_FILE");
+    uint32_t size = mem_config->deviceCfg->memSize;
+
+    (void)io1;
+    (void)io2;
+    (void)io3;
+    (void)io4;
+    (void)io5;
+    (void)io6;
+    (void)io7;
+    (void)ssel;
+
+    sim_trace("qspi_init P%u_%u P%u_%u %lu", SIM_PIN(io0), SIM_PIN(sclk), (unsigned long)hz);
+    if (NULL != sim_qspi_file)
+    {
+        return CY_RSLT_SERIAL_FLASH_ERR_QSPI_BUSY;
+    }
+
+    path = (NULL != path) ? path : SIM_QSPI_DEFAULT_FILE;
+    sim_qspi_file = fopen(path, "r+b");
+    if (NULL == sim_qspi_file)
+    {
+        static uint8_t erased[4096];
+
+        sim_qspi_file = fopen(path, "w+b");
+        if (NULL == sim_qspi_file)
+        {
+            return CY_RSLT_SERIAL_FLASH_ERR_IO;
+        }
+        memset(erased, 0xFF, sizeof(erased));
+        for (uint32_t offset = 0u; offset < size; offset += sizeof(erased))
+        {
+            (void)fwrite(erased, 1u, sizeof(erased), sim_qspi_file);
+        }
+    }
+    sim_qspi_config = mem_config;
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cy_serial_flash_qspi_deinit(void)
+{
+    if (NULL != sim_qspi_file)
+    {
+        fclose(sim_qspi_file);
+        sim_qspi_file = NULL;
+    }
+    sim_qspi_config = NULL;
+    sim_trace("qspi_deinit");
+}
+
+size_t cy_serial_flash_qspi_get_size(void)
+{
+    return (NULL != sim_qspi_config) ? sim_qspi_config->deviceCfg->memSize : 0u;
+}
+
+size_t cy_serial_flash_qspi_get_erase_size(uint32_t addr)
+{
+    (void)addr;
+    return (NULL != sim_qspi_config) ? sim_qspi_config->deviceCfg->eraseSize : 0u;
+}
+
+/*******************************************************************************
+* Function Name: sim_qspi_check
+********************************************************************************
+* Summary:
+*  Checks that the memory is open and the range inside it.
+*
+* Parameters:
+*  addr: start address
+*  length: number of bytes
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or CY_RSLT_SERIAL_FLASH_ERR_BAD_PARAM
+*
+*******************************************************************************/
+static cy_rslt_t sim_qspi_check(uint32_t addr, size_t length)
+{
+    if ((NULL == sim_qspi_file) ||
+        (((uint64_t)addr + length) > sim_qspi_config->deviceCfg->memSize))
+    {
+        return CY_RSLT_SERIAL_FLASH_ERR_BAD_PARAM;
+    }
+
+    return (0 == fseek(sim_qspi_file, (long)addr, SEEK_SET)) ? CY_RSLT_SUCCESS : CY_RSLT_SERIAL_FLASH_ERR_IO;
+}
+
+cy_rslt_t cy_serial_flash_qspi_read(uint32_t addr, size_t length, uint8_t *buf)
+{
+    cy_rslt_t result = sim_qspi_check(addr, length);
+
+    if ((CY_RSLT_SUCCESS == result) && (length != fread(buf, 1u, length, sim_qspi_file)))
+    {
+        result = CY_RSLT_SERIAL_FLASH_ERR_IO;
+    }
+    sim_trace("qspi_read 0x%08lx %lu", (unsigned long)addr, (unsigned long)length);
+
+    return result;
+}
+
+cy_rslt_t cy_serial_flash_qspi_write(uint32_t addr, size_t length, const uint8_t *buf)
+{
+    cy_rslt_t result = sim_qspi_check(addr, length);
+    uint8_t *merged = NULL;
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        merged = malloc(length);
+        if ((NULL == merged) || (length != fread(merged, 1u, length, sim_qspi_file)))
+        {
+            result = CY_RSLT_SERIAL_FLASH_ERR_IO;
+        }
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        for (size_t index = 0u; index < length; index++)
+        {
+            merged[index] &= buf[index];
+        }
+        (void)fseek(sim_qspi_file, (long)addr, SEEK_SET);
+        if ((length != fwrite(merged, 1u, length, sim_qspi_file)) || (0 != fflush(sim_qspi_file)))
+        {
+            result = CY_RSLT_SERIAL_FLASH_ERR_IO;
+        }
+    }
+    free(merged);
+    sim_trace("qspi_write 0x%08lx %lu", (unsigned long)addr, (unsigned long)length);
+
+    return result;
+}
+
+cy_rslt_t cy_serial_flash_qspi_erase(uint32_t addr, size_t length)
+{
+    static uint8_t erased[4096];
+    cy_rslt_t result;
+    uint32_t sector = cy_serial_flash_qspi_get_erase_size(addr);
+
+    if ((0u == sector) || (0u != (addr % sector)) || (0u != (length % sector)))
+    {
+        result = CY_RSLT_SERIAL_FLASH_ERR_BAD_PARAM;
+    }
+    else
+    {
+        result = sim_qspi_check(addr, length);
+    }
+
+    memset(erased, 0xFF, sizeof(erased));
+    for (size_t offset = 0u; (CY_RSLT_SUCCESS == result) && (offset < length); offset += sizeof(erased))
+    {
+        if (sizeof(erased) != fwrite(erased, 1u, sizeof(erased), sim_qspi_file))
+        {
+            result = CY_RSLT_SERIAL_FLASH_ERR_IO;
+        }
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        (void)fflush(sim_qspi_file);
+    }
+    sim_trace("qspi_erase 0x%08lx %lu", (unsigned long)addr, (unsigned long)length);
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,677 @@
+/*******************************************************************************
+* File Name:   sim_system.c
+*
+* Description: System models of the host simulation: interrupt routing
+*              (SysInt and NVIC), IPC channels and interrupt structures, the
+*              power modes, the watchdog and the backup registers. Only CM7_0
+*              is simulated, so IPC notifications reach CM7_0 itself and
+*              requests to the other cores time out. A watchdog reset ends
+*              the run with status 3; the backup registers are saved to
+*              HOST_SIM_BACKUP_FILE, if set, at the end of each run and loaded
+*              at the start of the next one.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cyhal.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_SYSINT_SLOTS            (16u)
+#define SIM_NVIC_LINES              (8u)
+
+/* Outputs of trigger group 6 to the PASS generic trigger inputs, and of
+ * group 5 to the all-counter trigger inputs of TCPWM0 */
+#define SIM_TRIGMUX_GROUP           (0x40000600UL)
+#define SIM_TRIGMUX_TCPWM_GROUP     (0x40000500UL)
+#define SIM_TRIGMUX_OUTPUTS         (8u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t      source;           /* System interrupt */
+    uint32_t      cpu_irq;          /* CPU interrupt it is routed to */
+    cy_israddress handler;
+} sim_sysint_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static sim_sysint_t sim_sysint[SIM_SYSINT_SLOTS];
+static uint32_t sim_sysint_count = 0u;
+static bool sim_nvic_enabled[SIM_NVIC_LINES];
+
+static IPC_STRUCT_Type sim_ipc_channel[CY_IPC_CHANNELS];
+static IPC_INTR_STRUCT_Type sim_ipc_intr[CY_IPC_INTERRUPTS];
+
+static cyhal_syspm_callback_data_t *sim_syspm_callbacks = NULL;
+
+/* Input line connected to each output of the trigger groups */
+static uint32_t sim_trigmux_input[SIM_TRIGMUX_OUTPUTS];
+static bool sim_trigmux_connected[SIM_TRIGMUX_OUTPUTS];
+static uint32_t sim_trigmux_tcpwm_input[SIM_TRIGMUX_OUTPUTS];
+static bool sim_trigmux_tcpwm_connected[SIM_TRIGMUX_OUTPUTS];
+
+BACKUP_Type sim_backup;
+
+/* Virtual time at which the watchdog resets the device, 0 while stopped.
+ * Kicked from both threads, read by the simulation thread even while the
+ * application masks the interrupts. */
+static uint64_t sim_wdt_expiry_us = 0u;
+static uint32_t sim_wdt_timeout_ms = 0u;
+
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_Init
+********************************************************************************
+* Summary:
+*  Routes a system interrupt to a CPU interrupt and sets its handler.
+*
+* Parameters:
+*  config: (CPU interrupt << 16) | system interrupt, and priority
+*  userIsr: handler
+*
+* Return:
+*  uint32_t: 0
+*
+*******************************************************************************/
+uint32_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr)
+{
+    uint32_t source = config->intrSrc & 0xFFFFu;
+    uint32_t slot;
+
+    sim_lock();
+    for (slot = 0u; slot < sim_sysint_count; slot++)
+    {
+        if (sim_sysint[slot].source == source)
+        {
+            break;
+        }
+    }
+    CY_ASSERT(slot < SIM_SYSINT_SLOTS);
+    if (slot == sim_sysint_count)
+    {
+        sim_sysint_count++;
+    }
+    sim_sysint[slot].source = source;
+    sim_sysint[slot].cpu_irq = config->intrSrc >> 16;
+    sim_sysint[slot].handler = userIsr;
+    sim_trace("sysint_init 0x%03lx %lu %lu", (unsigned long)source, (unsigned long)(config->intrSrc >> 16),
+              (unsigned long)config->intrPriority);
+    sim_unlock();
+
+    return 0u;
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    sim_lock();
+    sim_nvic_enabled[(uint32_t)IRQn % SIM_NVIC_LINES] = true;
+    sim_trace("nvic_enable %d", (int)IRQn);
+    sim_unlock();
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    sim_lock();
+    sim_nvic_enabled[(uint32_t)IRQn % SIM_NVIC_LINES] = false;
+    sim_trace("nvic_disable %d", (int)IRQn);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_sysint_raise
+********************************************************************************
+* Summary:
+*  Runs the handler of a system interrupt if its CPU interrupt is enabled.
+*  Called by the simulation thread.
+*
+* Parameters:
+*  source: system interrupt
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_sysint_raise(uint32_t source)
+{
+    for (uint32_t slot = 0u; slot < sim_sysint_count; slot++)
+    {
+        if ((sim_sysint[slot].source == source) && (NULL != sim_sysint[slot].handler) &&
+            sim_nvic_enabled[sim_sysint[slot].cpu_irq % SIM_NVIC_LINES])
+        {
+            sim_sysint[slot].handler();
+            sim_isr_done();
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_TrigMux_Connect
+********************************************************************************
+* Summary:
+*  Connects an input line of the trigger multiplexer to an output. Only the
+*  group from the TCPWM counters to the PASS generic triggers and the group
+*  from the pins to the TCPWM counters are modelled.
+*
+* Parameters:
+*  inTrig: input line
+*  outTrig: output line
+*  invert: not modelled
+*  trigType: not modelled, a trigger is one conversion either way
+*
+* Return:
+*  cy_en_trigmux_status_t: CY_TRIGMUX_BAD_PARAM for another output
+*
+*******************************************************************************/
+cy_en_trigmux_status_t Cy_TrigMux_Connect(uint32_t inTrig, uint32_t outTrig, bool invert,
+                                          en_trig_type_t trigType)
+{
+    uint32_t output = outTrig - SIM_TRIGMUX_GROUP;
+    uint32_t tcpwm_output = outTrig - SIM_TRIGMUX_TCPWM_GROUP;
+
+    (void)invert;
+    (void)trigType;
+    sim_trace("trigmux_connect 0x%08lx 0x%08lx", (unsigned long)inTrig, (unsigned long)outTrig);
+    if ((output >= SIM_TRIGMUX_OUTPUTS) && (tcpwm_output >= SIM_TRIGMUX_OUTPUTS))
+    {
+        return CY_TRIGMUX_BAD_PARAM;
+    }
+    sim_lock();
+    if (output < SIM_TRIGMUX_OUTPUTS)
+    {
+        sim_trigmux_input[output] = inTrig;
+        sim_trigmux_connected[output] = true;
+    }
+    else
+    {
+        sim_trigmux_tcpwm_input[tcpwm_output] = inTrig;
+        sim_trigmux_tcpwm_connected[tcpwm_output] = true;
+    }
+    sim_unlock();
+
+    return CY_TRIGMUX_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_trigmux_fire
+********************************************************************************
+* Summary:
+*  Pulses an input line of the trigger multiplexer: every output connected
+*  to it triggers its PASS generic trigger input. Called by the simulation
+*  thread.
+*
+* Parameters:
+*  in_trig: input line
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_trigmux_fire(uint32_t in_trig)
+{
+    for (uint32_t output = 0u; output < SIM_TRIGMUX_OUTPUTS; output++)
+    {
+        if (sim_trigmux_connected[output] && (sim_trigmux_input[output] == in_trig))
+        {
+            sim_adc_trigger(output);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_trigmux_edge
+********************************************************************************
+* Summary:
+*  Passes an edge of a pin trigger input to every all-counter trigger input
+*  of TCPWM0 connected to it. Called by the simulation thread.
+*
+* Parameters:
+*  in_trig: input line
+*  rising: edge direction
+*  time_ns: virtual time of the edge
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_trigmux_edge(uint32_t in_trig, bool rising, uint64_t time_ns)
+{
+    for (uint32_t output = 0u; output < SIM_TRIGMUX_OUTPUTS; output++)
+    {
+        if (sim_trigmux_tcpwm_connected[output] && (sim_trigmux_tcpwm_input[output] == in_trig))
+        {
+            sim_tcpwm_capture(output, rising, time_ns);
+        }
+    }
+}
+
+IPC_STRUCT_Type *Cy_IPC_Drv_GetIpcBaseAddress(uint32_t ipcIndex)
+{
+    CY_ASSERT(ipcIndex < CY_IPC_CHANNELS);
+    return &sim_ipc_channel[ipcIndex];
+}
+
+IPC_INTR_STRUCT_Type *Cy_IPC_Drv_GetIntrBaseAddr(uint32_t ipcIntrIndex)
+{
+    CY_ASSERT(ipcIntrIndex < CY_IPC_INTERRUPTS);
+    return &sim_ipc_intr[ipcIntrIndex];
+}
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Drv_SendMsgWord
+********************************************************************************
+* Summary:
+*  Locks the channel, stores the message and notifies the interrupt
+*  structures.
+*
+* Parameters:
+*  base: channel
+*  notifyEventIntr: interrupt structures to notify
+*  message: data word
+*
+* Return:
+*  cy_en_ipcdrv_status_t: CY_IPC_DRV_ERROR if the channel is already locked
+*
+*******************************************************************************/
+cy_en_ipcdrv_status_t Cy_IPC_Drv_SendMsgWord(IPC_STRUCT_Type *base, uint32_t notifyEventIntr,
+                                             uint32_t message)
+{
+    cy_en_ipcdrv_status_t status = CY_IPC_DRV_ERROR;
+
+    sim_lock();
+    if (0u == base->ACQUIRED)
+    {
+        base->ACQUIRED = 1u;
+        base->DATA0 = message;
+        status = Cy_IPC_Drv_AcquireNotify(base, notifyEventIntr);
+    }
+    sim_trace("ipc_send_msg %ld 0x%08lx", (long)(base - sim_ipc_channel), (unsigned long)message);
+    sim_unlock();
+
+    return status;
+}
+
+cy_en_ipcdrv_status_t Cy_IPC_Drv_ReadMsgWord(IPC_STRUCT_Type const *base, uint32_t *message)
+{
+    if (0u == base->ACQUIRED)
+    {
+        return CY_IPC_DRV_ERROR;
+    }
+    *message = base->DATA0;
+
+    return CY_IPC_DRV_SUCCESS;
+}
+
+cy_en_ipcdrv_status_t Cy_IPC_Drv_AcquireNotify(IPC_STRUCT_Type *base, uint32_t notifyEventIntr)
+{
+    uint32_t channel = (uint32_t)(base - sim_ipc_channel);
+
+    sim_lock();
+    for (uint32_t intr = 0u; intr < CY_IPC_INTERRUPTS; intr++)
+    {
+        if (0u != (notifyEventIntr & (1u << intr)))
+        {
+            sim_ipc_intr[intr].INTR |= 1u << (16u + channel);
+        }
+    }
+    sim_trace("ipc_notify %lu 0x%02lx", (unsigned long)channel, (unsigned long)notifyEventIntr);
+    sim_unlock();
+
+    return CY_IPC_DRV_SUCCESS;
+}
+
+void Cy_IPC_Drv_SetInterruptMask(IPC_INTR_STRUCT_Type *base, uint32_t ipcReleaseMask,
+                                 uint32_t ipcAcquireMask)
+{
+    base->INTR_MASK = (ipcAcquireMask << 16) | ipcReleaseMask;
+}
+
+uint32_t Cy_IPC_Drv_GetInterruptStatusMasked(IPC_INTR_STRUCT_Type const *base)
+{
+    return base->INTR & base->INTR_MASK;
+}
+
+void Cy_IPC_Drv_ClearInterrupt(IPC_INTR_STRUCT_Type *base, uint32_t ipcReleaseMask,
+                               uint32_t ipcAcquireMask)
+{
+    sim_lock();
+    base->INTR &= ~((ipcAcquireMask << 16) | ipcReleaseMask);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_ipc_tick
+********************************************************************************
+* Summary:
+*  Raises the interrupts of the IPC interrupt structures with unmasked
+*  notifications.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_ipc_tick(void)
+{
+    for (uint32_t intr = 0u; intr < CY_IPC_INTERRUPTS; intr++)
+    {
+        if (0u != (sim_ipc_intr[intr].INTR & sim_ipc_intr[intr].INTR_MASK))
+        {
+            sim_sysint_raise((uint32_t)cpuss_interrupts_ipc_0_IRQn + intr);
+        }
+    }
+}
+
+cy_rslt_t cyhal_syspm_init(void)
+{
+    sim_trace("syspm_init");
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_syspm_register_callback(cyhal_syspm_callback_data_t *callback_data)
+{
+    sim_lock();
+    callback_data->next = sim_syspm_callbacks;
+    sim_syspm_callbacks = callback_data;
+    sim_unlock();
+}
+
+void cyhal_syspm_unregister_callback(cyhal_syspm_callback_data_t *callback_data)
+{
+    cyhal_syspm_callback_data_t **link = &sim_syspm_callbacks;
+
+    sim_lock();
+    while (NULL != *link)
+    {
+        if (*link == callback_data)
+        {
+            *link = callback_data->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_syspm_notify
+********************************************************************************
+* Summary:
+*  Calls the power mode callbacks registered for a state, in one mode. A
+*  CHECK_READY failure calls CHECK_FAIL on the callbacks already asked.
+*
+* Parameters:
+*  state: low-power state
+*  mode: callback mode
+*
+* Return:
+*  false if a callback refused CHECK_READY
+*
+*******************************************************************************/
+static bool sim_syspm_notify(cyhal_syspm_callback_state_t state, cyhal_syspm_callback_mode_t mode)
+{
+    for (cyhal_syspm_callback_data_t *data = sim_syspm_callbacks; NULL != data; data = data->next)
+    {
+        if ((0u == ((uint32_t)data->states & (uint32_t)state)) ||
+            (0u != ((uint32_t)data->ignore_modes & (uint32_t)mode)))
+        {
+            continue;
+        }
+        if (!data->callback(state, mode, data->args) && (CYHAL_SYSPM_CHECK_READY == mode))
+        {
+            for (cyhal_syspm_callback_data_t *asked = sim_syspm_callbacks; asked != data; asked = asked->next)
+            {
+                if ((0u != ((uint32_t)asked->states & (uint32_t)state)) &&
+                    (0u == ((uint32_t)asked->ignore_modes & (uint32_t)CYHAL_SYSPM_CHECK_FAIL)))
+                {
+                    (void)asked->callback(state, CYHAL_SYSPM_CHECK_FAIL, asked->args);
+                }
+            }
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_syspm_enter
+********************************************************************************
+* Summary:
+*  CPU Sleep or Deep Sleep: runs the callbacks and waits for an interrupt.
+*
+* Parameters:
+*  state: CYHAL_SYSPM_CB_CPU_SLEEP or CYHAL_SYSPM_CB_CPU_DEEPSLEEP
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or CYHAL_SYSPM_RSLT_ERR_NOT_READY
+*
+*******************************************************************************/
+static cy_rslt_t sim_syspm_enter(cyhal_syspm_callback_state_t state)
+{
+    const char *name = (CYHAL_SYSPM_CB_CPU_SLEEP == state) ? "sleep" : "deepsleep";
+
+    if (!sim_syspm_notify(state, CYHAL_SYSPM_CHECK_READY))
+    {
+        sim_trace("syspm_%s refused", name);
+        return CYHAL_SYSPM_RSLT_ERR_NOT_READY;
+    }
+    (void)sim_syspm_notify(state, CYHAL_SYSPM_BEFORE_TRANSITION);
+    sim_trace("syspm_%s enter", name);
+    sim_wait_for_interrupt();
+    sim_trace("syspm_%s exit", name);
+    (void)sim_syspm_notify(state, CYHAL_SYSPM_AFTER_TRANSITION);
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_syspm_sleep(void)
+{
+    return sim_syspm_enter(CYHAL_SYSPM_CB_CPU_SLEEP);
+}
+
+cy_rslt_t cyhal_syspm_deepsleep(void)
+{
+    return sim_syspm_enter(CYHAL_SYSPM_CB_CPU_DEEPSLEEP);
+}
+
+/*******************************************************************************
+* Function Name: cyhal_syspm_hibernate
+********************************************************************************
+* Summary:
+*  Hibernate ends the run, as a wake-up from Hibernate is a reset. Restart the
+*  simulation with HOST_SIM_RESET_REASON=hib to follow the wake-up path.
+*
+* Parameters:
+*  wakeup_source: wake-up sources
+*
+* Return:
+*  cy_rslt_t: CYHAL_SYSPM_RSLT_ERR_NOT_READY if a callback refused
+*
+*******************************************************************************/
+cy_rslt_t cyhal_syspm_hibernate(cyhal_syspm_hibernate_source_t wakeup_source)
+{
+    if (!sim_syspm_notify(CYHAL_SYSPM_CB_SYSTEM_HIBERNATE, CYHAL_SYSPM_CHECK_READY))
+    {
+        sim_trace("syspm_hibernate refused");
+        return CYHAL_SYSPM_RSLT_ERR_NOT_READY;
+    }
+    (void)sim_syspm_notify(CYHAL_SYSPM_CB_SYSTEM_HIBERNATE, CYHAL_SYSPM_BEFORE_TRANSITION);
+    sim_trace("syspm_hibernate 0x%x", (unsigned int)wakeup_source);
+    sim_quit(0);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_backup_load
+********************************************************************************
+* Summary:
+*  Loads the backup registers saved by the previous run in
+*  HOST_SIM_BACKUP_FILE. Without the file they start cleared, as after a
+*  power-on reset.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_backup_load(void)
+{
+    const char *path = getenv("HOST_SIM_BACKUP_FILE");
+    FILE *file = (NULL != path) ? fopen(path, "rb") : NULL;
+
+    if (NULL != file)
+    {
+        (void)fread((void *)&sim_backup, 1u, sizeof(sim_backup), file);
+        fclose(file);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_backup_save
+********************************************************************************
+* Summary:
+*  Saves the backup registers to HOST_SIM_BACKUP_FILE, if set, for the next
+*  run. Called when the run ends.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_backup_save(void)
+{
+    const char *path = getenv("HOST_SIM_BACKUP_FILE");
+    FILE *file = (NULL != path) ? fopen(path, "wb") : NULL;
+
+    if (NULL != file)
+    {
+        (void)fwrite((const void *)&sim_backup, 1u, sizeof(sim_backup), file);
+        fclose(file);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_wdt_tick
+********************************************************************************
+* Summary:
+*  Resets the device, that is ends the run, once the watchdog expires.
+*  Called by the simulation thread on every tick, interrupts masked or not.
+*
+* Parameters:
+*  now_us: virtual time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_wdt_tick(uint64_t now_us)
+{
+    uint64_t expiry_us = __atomic_load_n(&sim_wdt_expiry_us, __ATOMIC_ACQUIRE);
+
+    if ((0u != expiry_us) && (now_us >= expiry_us))
+    {
+        fflush(stdout);
+        fprintf(stderr, "\r\n[sim] watchdog reset\r\n");
+        sim_trace("wdt_reset");
+        sim_quit(3);
+    }
+}
+
+/* The HAL watchdog starts at initialization */
+cy_rslt_t cyhal_wdt_init(cyhal_wdt_t *obj, uint32_t timeout_ms)
+{
+    obj->initialized = true;
+    obj->timeout_ms = timeout_ms;
+    sim_wdt_timeout_ms = timeout_ms;
+    sim_trace("wdt_init %lu", (unsigned long)timeout_ms);
+    cyhal_wdt_start(obj);
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_wdt_free(cyhal_wdt_t *obj)
+{
+    cyhal_wdt_stop(obj);
+    obj->initialized = false;
+    sim_trace("wdt_free");
+}
+
+void cyhal_wdt_kick(cyhal_wdt_t *obj)
+{
+    (void)obj;
+    if (0u != __atomic_load_n(&sim_wdt_expiry_us, __ATOMIC_ACQUIRE))
+    {
+        __atomic_store_n(&sim_wdt_expiry_us, sim_now_us() + ((uint64_t)sim_wdt_timeout_ms * 1000u),
+                         __ATOMIC_RELEASE);
+    }
+}
+
+void cyhal_wdt_start(cyhal_wdt_t *obj)
+{
+    __atomic_store_n(&sim_wdt_expiry_us, sim_now_us() + ((uint64_t)obj->timeout_ms * 1000u), __ATOMIC_RELEASE);
+    sim_trace("wdt_start");
+}
+
+void cyhal_wdt_stop(cyhal_wdt_t *obj)
+{
+    (void)obj;
+    __atomic_store_n(&sim_wdt_expiry_us, 0u, __ATOMIC_RELEASE);
+    sim_trace("wdt_stop");
+}
+
+bool cyhal_wdt_is_enabled(cyhal_wdt_t *obj)
+{
+    (void)obj;
+    return (0u != __atomic_load_n(&sim_wdt_expiry_us, __ATOMIC_ACQUIRE));
+}
+
+/* [] END OF FILE */
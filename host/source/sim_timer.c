@@ -0,0 +1,1092 @@
+/*******************************************************************************
+* File Name:   sim_timer.c
+*
+* Description: Timer models of the host simulation, all driven by the virtual
+*              clock: HAL timers (one terminal count callback per elapsed
+*              period), PWM (state only), RTC alarm, low-power timer, the PDL
+*              TCPWM counters, and the clock and resource bookkeeping.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_TIMER_DEFAULT_HZ        (1000000u)
+#define SIM_LPTIMER_HZ              (32768u)
+#define SIM_TCPWM_COUNTERS          (512u)
+#define SIM_TCPWM_DEFAULT_HZ        (1000000u)
+#define SIM_CLOCK_CHANNELS          (256u)
+/* Peripheral clock group feeding the dividers set with the PDL */
+#define SIM_PERI_CLOCK_HZ           (100000000u)
+#define SIM_HWMGR_SLOTS             (64u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* PDL TCPWM counter, group 1 counters follow the 256 of group 0 */
+typedef struct
+{
+    uint64_t start_us;          /* Virtual time of the start, 0 when stopped */
+    uint32_t hz;                /* Clock of the assigned divider, 0 for 1 MHz */
+    uint32_t period;
+    uint32_t intr_mask;         /* CY_TCPWM_INT_* */
+    uint32_t intr_status;
+    uint64_t tc_done;           /* Terminal counts raised since the start */
+    bool     pwm;               /* PWM mode: compare 1 drives TR_OUT1 and CC1 */
+    uint32_t compare1;
+    uint32_t trigger1;          /* CY_TCPWM_CNT_TRIGGER_ON_* of TR_OUT1 */
+    uint64_t cc1_done;          /* Compare 1 matches raised since the start */
+    bool     in_event;          /* A match is being dispatched at event_ticks */
+    uint64_t event_ticks;
+    bool     capture;           /* Capture mode: the capture inputs latch the count */
+    uint32_t capture0_input;    /* CY_TCPWM_INPUT_* into CC0 */
+    uint32_t capture0_mode;     /* CY_TCPWM_INPUT_*EDGE */
+    uint32_t capture1_input;    /* CY_TCPWM_INPUT_* into CC1 */
+    uint32_t capture1_mode;
+    uint32_t cc0;
+    uint32_t cc0_buf;           /* CC0 before the last capture */
+    uint32_t cc1;
+    uint32_t cc1_buf;
+} sim_tcpwm_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+TCPWM_Type sim_tcpwm0;
+
+/* Running HAL timers, linked through cyhal_timer_t.next */
+static cyhal_timer_t *sim_timer_list = NULL;
+
+static cyhal_rtc_t *sim_rtc = NULL;
+
+/* Initialized low-power timers, linked through cyhal_lptimer_t.next */
+static cyhal_lptimer_t *sim_lptimer_list = NULL;
+
+static sim_tcpwm_t sim_tcpwm[SIM_TCPWM_COUNTERS];
+
+/* Frequency set on each allocated divider */
+static uint32_t sim_clock_hz[SIM_CLOCK_CHANNELS];
+
+static cyhal_resource_inst_t sim_hwmgr_reserved[SIM_HWMGR_SLOTS];
+static bool sim_hwmgr_used[SIM_HWMGR_SLOTS];
+static uint8_t sim_clock_next_channel = 0u;
+
+
+/*******************************************************************************
+* Function Name: sim_timer_period_us
+********************************************************************************
+* Summary:
+*  Returns the duration of one timer period.
+*
+* Parameters:
+*  obj: timer
+*
+* Return:
+*  uint64_t: microseconds, at least 1
+*
+*******************************************************************************/
+static uint64_t sim_timer_period_us(const cyhal_timer_t *obj)
+{
+    uint64_t us = (((uint64_t)obj->config.period + 1u) * 1000000u) / obj->frequency_hz;
+
+    return (0u != us) ? us : 1u;
+}
+
+/*******************************************************************************
+* Function Name: sim_timer_unlink
+********************************************************************************
+* Summary:
+*  Removes a timer from the running list.
+*
+* Parameters:
+*  obj: timer
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_timer_unlink(cyhal_timer_t *obj)
+{
+    cyhal_timer_t **link = &sim_timer_list;
+
+    while (NULL != *link)
+    {
+        if (*link == obj)
+        {
+            *link = (cyhal_timer_t *)obj->next;
+            break;
+        }
+        link = (cyhal_timer_t **)&(*link)->next;
+    }
+    obj->next = NULL;
+    obj->running = false;
+}
+
+/*******************************************************************************
+* Function Name: sim_tcpwm_ticks
+********************************************************************************
+* Summary:
+*  Returns the clock ticks counted by a PDL TCPWM counter since its start.
+*
+* Parameters:
+*  counter: TCPWM counter
+*
+* Return:
+*  uint64_t: ticks, 0 when stopped
+*
+*******************************************************************************/
+static uint64_t sim_tcpwm_ticks(const sim_tcpwm_t *counter)
+{
+    uint64_t hz = (0u != counter->hz) ? counter->hz : SIM_TCPWM_DEFAULT_HZ;
+
+    if (0u == counter->start_us)
+    {
+        return 0u;
+    }
+    /* The handlers of a match read the counter at the match */
+    if (counter->in_event)
+    {
+        return counter->event_ticks;
+    }
+    return ((sim_now_us() + 1u - counter->start_us) * hz) / 1000000u;
+}
+
+/*******************************************************************************
+* Function Name: sim_tcpwm_cc1_matches
+********************************************************************************
+* Summary:
+*  Returns the compare 1 matches of a PWM counter up to a number of ticks:
+*  the counter equals compare 1 at the ticks k * (period + 1) + compare 1.
+*
+* Parameters:
+*  counter: TCPWM counter in PWM mode
+*  ticks: ticks since the start
+*
+* Return:
+*  uint64_t: matches
+*
+*******************************************************************************/
+static uint64_t sim_tcpwm_cc1_matches(const sim_tcpwm_t *counter, uint64_t ticks)
+{
+    if (ticks < counter->compare1)
+    {
+        return 0u;
+    }
+    return ((ticks - counter->compare1) / ((uint64_t)counter->period + 1u)) + 1u;
+}
+
+cy_rslt_t cyhal_timer_init(cyhal_timer_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk)
+{
+    (void)pin;
+
+    sim_lock();
+    memset(obj, 0, sizeof(*obj));
+    obj->frequency_hz = ((NULL != clk) && (0u != clk->frequency_hz)) ? clk->frequency_hz : SIM_TIMER_DEFAULT_HZ;
+    obj->config.period = 0xFFFFFFFFu;
+    obj->config.is_continuous = true;
+    sim_trace("timer_init");
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_timer_free(cyhal_timer_t *obj)
+{
+    sim_lock();
+    sim_timer_unlink(obj);
+    obj->callback = NULL;
+    obj->event_mask = 0u;
+    sim_trace("timer_free");
+    sim_unlock();
+}
+
+cy_rslt_t cyhal_timer_configure(cyhal_timer_t *obj, const cyhal_timer_cfg_t *cfg)
+{
+    sim_lock();
+    obj->config = *cfg;
+    sim_trace("timer_configure %lu %d", (unsigned long)cfg->period, (int)cfg->is_continuous);
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_timer_set_frequency(cyhal_timer_t *obj, uint32_t hz)
+{
+    sim_lock();
+    obj->frequency_hz = (0u != hz) ? hz : SIM_TIMER_DEFAULT_HZ;
+    sim_trace("timer_set_frequency %lu", (unsigned long)hz);
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_timer_start(cyhal_timer_t *obj)
+{
+    sim_lock();
+    if (!obj->running)
+    {
+        obj->running = true;
+        obj->start_us = sim_now_us();
+        obj->periods_done = 0u;
+        obj->next = sim_timer_list;
+        sim_timer_list = obj;
+    }
+    sim_trace("timer_start");
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_timer_stop(cyhal_timer_t *obj)
+{
+    sim_lock();
+    sim_timer_unlink(obj);
+    sim_trace("timer_stop");
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+uint32_t cyhal_timer_read(const cyhal_timer_t *obj)
+{
+    uint64_t elapsed_us;
+
+    if (!obj->running)
+    {
+        return obj->config.value;
+    }
+
+    elapsed_us = (sim_now_us() - obj->start_us) % sim_timer_period_us(obj);
+    return obj->config.value + (uint32_t)((elapsed_us * obj->frequency_hz) / 1000000u);
+}
+
+void cyhal_timer_register_callback(cyhal_timer_t *obj, cyhal_timer_event_callback_t callback,
+                                   void *callback_arg)
+{
+    sim_lock();
+    obj->callback = callback;
+    obj->callback_arg = callback_arg;
+    sim_trace("timer_register_callback %s", (NULL != callback) ? "set" : "none");
+    sim_unlock();
+}
+
+void cyhal_timer_enable_event(cyhal_timer_t *obj, cyhal_timer_event_t event,
+                              uint8_t intr_priority, bool enable)
+{
+    sim_lock();
+    if (enable)
+    {
+        obj->event_mask |= (uint32_t)event;
+    }
+    else
+    {
+        obj->event_mask &= ~(uint32_t)event;
+    }
+    sim_trace("timer_enable_event %d %u %d", (int)event, (unsigned int)intr_priority, (int)enable);
+    sim_unlock();
+}
+
+cy_rslt_t cyhal_pwm_init(cyhal_pwm_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk)
+{
+    (void)clk;
+
+    sim_trace("pwm_init P%u_%u", SIM_PIN(pin));
+    if (!sim_gpio_reserve(pin))
+    {
+        return CYHAL_HWMGR_RSLT_ERR_INUSE;
+    }
+    obj->pin = pin;
+    obj->frequency_hz = 0u;
+    obj->duty_cycle = 0.0f;
+    obj->running = false;
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_pwm_free(cyhal_pwm_t *obj)
+{
+    obj->running = false;
+    sim_gpio_unreserve(obj->pin);
+    sim_trace("pwm_free P%u_%u", SIM_PIN(obj->pin));
+}
+
+cy_rslt_t cyhal_pwm_set_duty_cycle(cyhal_pwm_t *obj, float duty_cycle, uint32_t frequencyhal_hz)
+{
+    obj->duty_cycle = duty_cycle;
+    obj->frequency_hz = frequencyhal_hz;
+    sim_trace("pwm_set_duty_cycle P%u_%u %.1f %lu", SIM_PIN(obj->pin), (double)duty_cycle,
+              (unsigned long)frequencyhal_hz);
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_pwm_start(cyhal_pwm_t *obj)
+{
+    obj->running = true;
+    sim_trace("pwm_start P%u_%u", SIM_PIN(obj->pin));
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_pwm_stop(cyhal_pwm_t *obj)
+{
+    obj->running = false;
+    sim_trace("pwm_stop P%u_%u", SIM_PIN(obj->pin));
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_rtc_init(cyhal_rtc_t *obj)
+{
+    sim_lock();
+    memset(obj, 0, sizeof(*obj));
+    sim_rtc = obj;
+    sim_trace("rtc_init");
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_rtc_free(cyhal_rtc_t *obj)
+{
+    sim_lock();
+    if (sim_rtc == obj)
+    {
+        sim_rtc = NULL;
+    }
+    sim_trace("rtc_free");
+    sim_unlock();
+}
+
+cy_rslt_t cyhal_rtc_set_alarm_by_seconds(cyhal_rtc_t *obj, const uint32_t seconds)
+{
+    sim_lock();
+    obj->alarm_us = sim_now_us() + ((uint64_t)seconds * 1000000u);
+    sim_trace("rtc_set_alarm_by_seconds %lu", (unsigned long)seconds);
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_rtc_register_callback(cyhal_rtc_t *obj, cyhal_rtc_event_callback_t callback,
+                                 void *callback_arg)
+{
+    sim_lock();
+    obj->callback = callback;
+    obj->callback_arg = callback_arg;
+    sim_trace("rtc_register_callback %s", (NULL != callback) ? "set" : "none");
+    sim_unlock();
+}
+
+void cyhal_rtc_enable_event(cyhal_rtc_t *obj, cyhal_rtc_event_t event,
+                            uint8_t intr_priority, bool enable)
+{
+    sim_lock();
+    obj->alarm_enabled = enable;
+    sim_trace("rtc_enable_event %d %u %d", (int)event, (unsigned int)intr_priority, (int)enable);
+    sim_unlock();
+}
+
+cy_rslt_t cyhal_lptimer_init(cyhal_lptimer_t *obj)
+{
+    sim_lock();
+    memset(obj, 0, sizeof(*obj));
+    obj->initialized = true;
+    obj->next = sim_lptimer_list;
+    sim_lptimer_list = obj;
+    sim_trace("lptimer_init");
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_lptimer_free(cyhal_lptimer_t *obj)
+{
+    cyhal_lptimer_t **link = &sim_lptimer_list;
+
+    sim_lock();
+    while (NULL != *link)
+    {
+        if (*link == obj)
+        {
+            *link = (cyhal_lptimer_t *)obj->next;
+            break;
+        }
+        link = (cyhal_lptimer_t **)&(*link)->next;
+    }
+    obj->next = NULL;
+    obj->initialized = false;
+    sim_trace("lptimer_free");
+    sim_unlock();
+}
+
+uint32_t cyhal_lptimer_read(const cyhal_lptimer_t *obj)
+{
+    (void)obj;
+    return (uint32_t)((sim_now_us() * SIM_LPTIMER_HZ) / 1000000u);
+}
+
+void cyhal_lptimer_get_info(cyhal_lptimer_t *obj, cyhal_lptimer_info_t *info)
+{
+    (void)obj;
+    info->frequency_hz = SIM_LPTIMER_HZ;
+    info->min_set_delay = 3u;
+    info->max_counter_value = 0xFFFFFFFFu;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_lptimer_set_delay
+********************************************************************************
+* Summary:
+*  Arms a single compare match the given number of counter ticks from now.
+*
+* Parameters:
+*  obj: low-power timer
+*  delay: ticks of the low-power clock
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cyhal_lptimer_set_delay(cyhal_lptimer_t *obj, uint32_t delay)
+{
+    sim_lock();
+    obj->match_us = sim_now_us() + (((uint64_t)delay * 1000000u) / SIM_LPTIMER_HZ) + 1u;
+    sim_trace("lptimer_set_delay %lu", (unsigned long)delay);
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_lptimer_register_callback(cyhal_lptimer_t *obj, cyhal_lptimer_event_callback_t callback,
+                                     void *callback_arg)
+{
+    sim_lock();
+    obj->callback = callback;
+    obj->callback_arg = callback_arg;
+    sim_trace("lptimer_register_callback %s", (NULL != callback) ? "set" : "none");
+    sim_unlock();
+}
+
+void cyhal_lptimer_enable_event(cyhal_lptimer_t *obj, cyhal_lptimer_event_t event,
+                                uint8_t intr_priority, bool enable)
+{
+    sim_lock();
+    obj->match_enabled = enable;
+    sim_trace("lptimer_enable_event %d %u %d", (int)event, (unsigned int)intr_priority, (int)enable);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_tcpwm_pwm_tick
+********************************************************************************
+* Summary:
+*  Dispatches the compare 1 matches of a PWM counter since the last step, in
+*  order: each pulses TR_OUT1 into the trigger multiplexer if it is selected
+*  and raises the CC1 interrupt if it is enabled. While a match is
+*  dispatched, the counter reads as at the match, so that the handlers see
+*  the timing of the hardware rather than the step of the simulation.
+*
+* Parameters:
+*  cnt: counter number
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_tcpwm_pwm_tick(uint32_t cnt)
+{
+    sim_tcpwm_t *counter = &sim_tcpwm[cnt];
+    uint64_t matches = sim_tcpwm_cc1_matches(counter, sim_tcpwm_ticks(counter));
+
+    /* The handlers may stop the counter */
+    while ((0u != counter->start_us) && (counter->cc1_done < matches))
+    {
+        counter->event_ticks = (counter->cc1_done * ((uint64_t)counter->period + 1u)) + counter->compare1;
+        counter->in_event = true;
+        counter->cc1_done++;
+        if ((CY_TCPWM_CNT_TRIGGER_ON_CC1_MATCH == counter->trigger1) && (cnt >= 256u))
+        {
+            sim_trigmux_fire((uint32_t)TRIG_IN_MUX_6_TCPWM_0_TR_OUT1256 + cnt - 256u);
+        }
+        if (0u != (counter->intr_mask & CY_TCPWM_INT_ON_CC1))
+        {
+            counter->intr_status |= CY_TCPWM_INT_ON_CC1;
+            sim_sysint_raise((cnt < 256u) ? ((uint32_t)tcpwm_0_interrupts_0_IRQn + cnt)
+                                          : ((uint32_t)tcpwm_0_interrupts_256_IRQn + cnt - 256u));
+        }
+        counter->in_event = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_timer_tick
+********************************************************************************
+* Summary:
+*  Calls the terminal count callbacks of the elapsed timer periods, the RTC
+*  alarm callback and the compare match callbacks of the low-power timers.
+*
+* Parameters:
+*  now_us: virtual time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_timer_tick(uint64_t now_us)
+{
+    cyhal_timer_t *timer = sim_timer_list;
+
+    while (NULL != timer)
+    {
+        cyhal_timer_t *next = (cyhal_timer_t *)timer->next;
+        uint64_t periods = (now_us - timer->start_us) / sim_timer_period_us(timer);
+
+        /* The callback may stop or free the timer */
+        while (timer->running && (timer->periods_done < periods))
+        {
+            timer->periods_done++;
+            if (!timer->config.is_continuous)
+            {
+                sim_timer_unlink(timer);
+            }
+            if ((0u != (timer->event_mask & (uint32_t)CYHAL_TIMER_IRQ_TERMINAL_COUNT)) &&
+                (NULL != timer->callback))
+            {
+                timer->callback(timer->callback_arg, CYHAL_TIMER_IRQ_TERMINAL_COUNT);
+                sim_isr_done();
+            }
+        }
+        timer = next;
+    }
+
+    if ((NULL != sim_rtc) && (0u != sim_rtc->alarm_us) && (now_us >= sim_rtc->alarm_us))
+    {
+        sim_rtc->alarm_us = 0u;
+        if (sim_rtc->alarm_enabled && (NULL != sim_rtc->callback))
+        {
+            sim_trace("rtc_irq");
+            sim_rtc->callback(sim_rtc->callback_arg, CYHAL_RTC_ALARM);
+            sim_isr_done();
+        }
+    }
+
+    for (cyhal_lptimer_t *lptimer = sim_lptimer_list; NULL != lptimer;
+         lptimer = (cyhal_lptimer_t *)lptimer->next)
+    {
+        if ((0u == lptimer->match_us) || (now_us < lptimer->match_us))
+        {
+            continue;
+        }
+        lptimer->match_us = 0u;
+        if (lptimer->match_enabled && (NULL != lptimer->callback))
+        {
+            sim_trace("lptimer_irq");
+            lptimer->callback(lptimer->callback_arg, CYHAL_LPTIMER_COMPARE_MATCH);
+            sim_isr_done();
+        }
+    }
+
+    for (uint32_t cnt = 0u; cnt < SIM_TCPWM_COUNTERS; cnt++)
+    {
+        sim_tcpwm_t *counter = &sim_tcpwm[cnt];
+        uint64_t periods;
+
+        if (counter->pwm && (0u != counter->start_us))
+        {
+            sim_tcpwm_pwm_tick(cnt);
+        }
+        if ((0u == (counter->intr_mask & CY_TCPWM_INT_ON_TC)) || (0u == counter->start_us))
+        {
+            continue;
+        }
+
+        /* The handler may stop the counter */
+        periods = sim_tcpwm_ticks(counter) / ((uint64_t)counter->period + 1u);
+        while ((0u != counter->start_us) && (counter->tc_done < periods))
+        {
+            counter->tc_done++;
+            counter->intr_status |= CY_TCPWM_INT_ON_TC;
+            sim_trace("tcpwm_irq %lu", (unsigned long)cnt);
+            sim_sysint_raise((cnt < 256u) ? ((uint32_t)tcpwm_0_interrupts_0_IRQn + cnt)
+                                          : ((uint32_t)tcpwm_0_interrupts_256_IRQn + cnt - 256u));
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_Counter_Init
+********************************************************************************
+* Summary:
+*  PDL TCPWM counters. They count the virtual time at the frequency of the
+*  divider assigned to them, 1 MHz by default, wrap at the period and raise
+*  the terminal count interrupt of the counter.
+*
+* Parameters:
+*  base: TCPWM block
+*  cntNum: counter number
+*  config: counter configuration
+*
+* Return:
+*  uint32_t: CY_TCPWM_SUCCESS
+*
+*******************************************************************************/
+uint32_t Cy_TCPWM_Counter_Init(TCPWM_Type *base, uint32_t cntNum,
+                               cy_stc_tcpwm_counter_config_t const *config)
+{
+    sim_tcpwm_t *counter = &sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS];
+
+    (void)base;
+    sim_lock();
+    counter->period = config->period;
+    counter->intr_mask = config->interruptSources;
+    counter->intr_status = 0u;
+    counter->pwm = false;
+    counter->capture = (CY_TCPWM_COUNTER_MODE_CAPTURE == config->compareOrCapture);
+    counter->capture0_input = config->captureInput;
+    counter->capture0_mode = config->captureInputMode;
+    counter->capture1_input = config->capture1Input;
+    counter->capture1_mode = config->capture1InputMode;
+    counter->cc0 = 0u;
+    counter->cc0_buf = 0u;
+    counter->cc1 = 0u;
+    counter->cc1_buf = 0u;
+    sim_trace("tcpwm_counter_init %lu %lu", (unsigned long)cntNum, (unsigned long)config->period);
+    sim_unlock();
+
+    return CY_TCPWM_SUCCESS;
+}
+
+void Cy_TCPWM_Counter_Enable(TCPWM_Type *base, uint32_t cntNum)
+{
+    (void)base;
+    sim_trace("tcpwm_counter_enable %lu", (unsigned long)cntNum);
+}
+
+void Cy_TCPWM_Counter_Disable(TCPWM_Type *base, uint32_t cntNum)
+{
+    (void)base;
+    sim_lock();
+    sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS].start_us = 0u;
+    sim_trace("tcpwm_counter_disable %lu", (unsigned long)cntNum);
+    sim_unlock();
+}
+
+void Cy_TCPWM_TriggerStart_Single(TCPWM_Type *base, uint32_t cntNum)
+{
+    sim_tcpwm_t *counter = &sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS];
+
+    (void)base;
+    sim_lock();
+    /* Offset by one so that a start at time 0 is told from a stopped counter */
+    counter->start_us = sim_now_us() + 1u;
+    counter->tc_done = 0u;
+    counter->cc1_done = 0u;
+    sim_trace("tcpwm_trigger_start %lu", (unsigned long)cntNum);
+    sim_unlock();
+}
+
+uint32_t Cy_TCPWM_Counter_GetCounter(TCPWM_Type const *base, uint32_t cntNum)
+{
+    const sim_tcpwm_t *counter = &sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS];
+    uint64_t ticks = sim_tcpwm_ticks(counter);
+
+    (void)base;
+    return (0xFFFFFFFFu != counter->period) ? (uint32_t)(ticks % ((uint64_t)counter->period + 1u))
+                                            : (uint32_t)ticks;
+}
+
+/* Called from the handlers, not traced */
+uint32_t Cy_TCPWM_GetInterruptStatusMasked(TCPWM_Type const *base, uint32_t cntNum)
+{
+    const sim_tcpwm_t *counter = &sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS];
+
+    (void)base;
+    return counter->intr_status & counter->intr_mask;
+}
+
+void Cy_TCPWM_ClearInterrupt(TCPWM_Type *base, uint32_t cntNum, uint32_t source)
+{
+    (void)base;
+    sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS].intr_status &= ~source;
+}
+
+/* Captured counts, called from the handlers, not traced */
+uint32_t Cy_TCPWM_Counter_GetCapture0Val(TCPWM_Type const *base, uint32_t cntNum)
+{
+    (void)base;
+    return sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS].cc0;
+}
+
+uint32_t Cy_TCPWM_Counter_GetCapture0BufVal(TCPWM_Type const *base, uint32_t cntNum)
+{
+    (void)base;
+    return sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS].cc0_buf;
+}
+
+uint32_t Cy_TCPWM_Counter_GetCapture1Val(TCPWM_Type const *base, uint32_t cntNum)
+{
+    (void)base;
+    return sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS].cc1;
+}
+
+uint32_t Cy_TCPWM_Counter_GetCapture1BufVal(TCPWM_Type const *base, uint32_t cntNum)
+{
+    (void)base;
+    return sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS].cc1_buf;
+}
+
+/*******************************************************************************
+* Function Name: sim_tcpwm_capture
+********************************************************************************
+* Summary:
+*  Edge on an all-counter trigger input of TCPWM0. Each running counter in
+*  capture mode whose capture 0 or capture 1 input selects the line and the
+*  edge copies CC0 or CC1 to its buffer, latches the count at the time of
+*  the edge and raises the CC0 or CC1 interrupt if it is enabled. The
+*  counter reads as at the edge while the handler runs.
+*
+* Parameters:
+*  all_cnt_input: trigger input of the counters
+*  rising: edge direction
+*  time_ns: virtual time of the edge
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_tcpwm_capture(uint32_t all_cnt_input, bool rising, uint64_t time_ns)
+{
+    const uint32_t line = CY_TCPWM_INPUT_TRIG(all_cnt_input);
+    const uint32_t edge = rising ? CY_TCPWM_INPUT_RISINGEDGE : CY_TCPWM_INPUT_FALLINGEDGE;
+
+    for (uint32_t cnt = 0u; cnt < SIM_TCPWM_COUNTERS; cnt++)
+    {
+        sim_tcpwm_t *counter = &sim_tcpwm[cnt];
+        uint64_t start_ns = (counter->start_us - 1u) * 1000u;
+        uint64_t hz = (0u != counter->hz) ? counter->hz : SIM_TCPWM_DEFAULT_HZ;
+        uint32_t events = 0u;
+        uint32_t count;
+
+        if (!counter->capture || (0u == counter->start_us) || (time_ns < start_ns))
+        {
+            continue;
+        }
+        counter->event_ticks = ((time_ns - start_ns) * hz) / 1000000000u;
+        count = (0xFFFFFFFFu != counter->period)
+                ? (uint32_t)(counter->event_ticks % ((uint64_t)counter->period + 1u))
+                : (uint32_t)counter->event_ticks;
+        if ((line == counter->capture0_input) &&
+            ((edge == counter->capture0_mode) || (CY_TCPWM_INPUT_EITHEREDGE == counter->capture0_mode)))
+        {
+            counter->cc0_buf = counter->cc0;
+            counter->cc0 = count;
+            events |= CY_TCPWM_INT_ON_CC0;
+        }
+        if ((line == counter->capture1_input) &&
+            ((edge == counter->capture1_mode) || (CY_TCPWM_INPUT_EITHEREDGE == counter->capture1_mode)))
+        {
+            counter->cc1_buf = counter->cc1;
+            counter->cc1 = count;
+            events |= CY_TCPWM_INT_ON_CC1;
+        }
+        counter->intr_status |= events;
+        if (0u == (events & counter->intr_mask))
+        {
+            continue;
+        }
+        counter->in_event = true;
+        sim_sysint_raise((cnt < 256u) ? ((uint32_t)tcpwm_0_interrupts_0_IRQn + cnt)
+                                      : ((uint32_t)tcpwm_0_interrupts_256_IRQn + cnt - 256u));
+        counter->in_event = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_TCPWM_PWM_Init
+********************************************************************************
+* Summary:
+*  PDL TCPWM counters in PWM mode. Like the counters, they count the virtual
+*  time from 0 to period 0 and wrap. Compare 1 is modelled for the trigger
+*  line TR_OUT1 and the CC1 interrupt; the PWM line itself is not.
+*
+* Parameters:
+*  base: TCPWM block
+*  cntNum: counter number
+*  config: PWM configuration
+*
+* Return:
+*  uint32_t: CY_TCPWM_SUCCESS
+*
+*******************************************************************************/
+uint32_t Cy_TCPWM_PWM_Init(TCPWM_Type *base, uint32_t cntNum, cy_stc_tcpwm_pwm_config_t const *config)
+{
+    sim_tcpwm_t *counter = &sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS];
+
+    (void)base;
+    sim_lock();
+    counter->period = config->period0;
+    counter->compare1 = config->compare1;
+    counter->trigger1 = config->trigger1Event;
+    counter->intr_mask = config->interruptSources;
+    counter->intr_status = 0u;
+    counter->pwm = true;
+    counter->capture = false;
+    sim_trace("tcpwm_pwm_init %lu %lu %lu %lu", (unsigned long)cntNum, (unsigned long)config->period0,
+              (unsigned long)config->compare1, (unsigned long)config->trigger1Event);
+    sim_unlock();
+
+    return CY_TCPWM_SUCCESS;
+}
+
+void Cy_TCPWM_PWM_Enable(TCPWM_Type *base, uint32_t cntNum)
+{
+    (void)base;
+    sim_trace("tcpwm_pwm_enable %lu", (unsigned long)cntNum);
+}
+
+void Cy_TCPWM_PWM_Disable(TCPWM_Type *base, uint32_t cntNum)
+{
+    Cy_TCPWM_Counter_Disable(base, cntNum);
+}
+
+/* Takes effect at once: the matches already passed are not raised again */
+void Cy_TCPWM_PWM_SetCompare1Val(TCPWM_Type *base, uint32_t cntNum, uint32_t compare1)
+{
+    sim_tcpwm_t *counter = &sim_tcpwm[cntNum % SIM_TCPWM_COUNTERS];
+
+    (void)base;
+    sim_lock();
+    counter->compare1 = compare1;
+    counter->cc1_done = sim_tcpwm_cc1_matches(counter, sim_tcpwm_ticks(counter));
+    sim_trace("tcpwm_pwm_set_compare1 %lu %lu", (unsigned long)cntNum, (unsigned long)compare1);
+    sim_unlock();
+}
+
+uint32_t Cy_TCPWM_PWM_GetCounter(TCPWM_Type const *base, uint32_t cntNum)
+{
+    return Cy_TCPWM_Counter_GetCounter(base, cntNum);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_PeriPclkAssignDivider
+********************************************************************************
+* Summary:
+*  Clocks a TCPWM counter from a divider. The counter takes the frequency set
+*  on the divider with cyhal_clock_set_frequency().
+*
+* Parameters:
+*  ipBlock: peripheral clock of the counter
+*  dividerType: divider type
+*  dividerNum: divider, the channel of the cyhal_clock_t
+*
+* Return:
+*  uint32_t: 0
+*
+*******************************************************************************/
+uint32_t Cy_SysClk_PeriPclkAssignDivider(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                         uint32_t dividerNum)
+{
+    uint32_t cnt = ((uint32_t)ipBlock >= (uint32_t)PCLK_TCPWM0_CLOCKS256)
+                   ? (256u + (uint32_t)ipBlock - (uint32_t)PCLK_TCPWM0_CLOCKS256)
+                   : ((uint32_t)ipBlock - (uint32_t)PCLK_TCPWM0_CLOCKS0);
+
+    sim_lock();
+    sim_tcpwm[cnt % SIM_TCPWM_COUNTERS].hz = sim_clock_hz[dividerNum % SIM_CLOCK_CHANNELS];
+    sim_unlock();
+    sim_trace("sysclk_pclk_assign 0x%x %d %lu", (unsigned int)ipBlock, (int)dividerType,
+              (unsigned long)dividerNum);
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_PeriPclkSetDivider
+********************************************************************************
+* Summary:
+*  Divides SIM_PERI_CLOCK_HZ on a divider. Counters assigned to the divider
+*  afterwards take the divided frequency.
+*
+* Parameters:
+*  ipBlock: peripheral clock
+*  dividerType: divider type
+*  dividerNum: divider
+*  dividerValue: divide by dividerValue + 1
+*
+* Return:
+*  uint32_t: 0
+*
+*******************************************************************************/
+uint32_t Cy_SysClk_PeriPclkSetDivider(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                      uint32_t dividerNum, uint32_t dividerValue)
+{
+    sim_lock();
+    sim_clock_hz[dividerNum % SIM_CLOCK_CHANNELS] = SIM_PERI_CLOCK_HZ / (dividerValue + 1u);
+    sim_unlock();
+    sim_trace("sysclk_pclk_set_divider 0x%x %d %lu %lu", (unsigned int)ipBlock, (int)dividerType,
+              (unsigned long)dividerNum, (unsigned long)dividerValue);
+
+    return 0u;
+}
+
+uint32_t Cy_SysClk_PeriPclkEnableDivider(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                         uint32_t dividerNum)
+{
+    sim_trace("sysclk_pclk_enable_divider 0x%x %d %lu", (unsigned int)ipBlock, (int)dividerType,
+              (unsigned long)dividerNum);
+
+    return 0u;
+}
+
+uint32_t Cy_SysClk_PeriPclkGetFrequency(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                        uint32_t dividerNum)
+{
+    (void)ipBlock;
+    (void)dividerType;
+
+    return sim_clock_hz[dividerNum % SIM_CLOCK_CHANNELS];
+}
+
+cy_rslt_t cyhal_clock_allocate(cyhal_clock_t *clock, cyhal_clock_block_t block)
+{
+    clock->block = block;
+    clock->channel = sim_clock_next_channel++;
+    clock->frequency_hz = 0u;
+    clock->enabled = false;
+    sim_trace("clock_allocate %d %u", (int)block, (unsigned int)clock->channel);
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_clock_set_frequency(cyhal_clock_t *clock, uint32_t hz, const void *tolerance)
+{
+    (void)tolerance;
+    clock->frequency_hz = hz;
+    sim_clock_hz[clock->channel % SIM_CLOCK_CHANNELS] = hz;
+    sim_trace("clock_set_frequency %u %lu", (unsigned int)clock->channel, (unsigned long)hz);
+
+    return CY_RSLT_SUCCESS;
+}
+
+uint32_t cyhal_clock_get_frequency(const cyhal_clock_t *clock)
+{
+    return clock->frequency_hz;
+}
+
+cy_rslt_t cyhal_clock_set_enabled(cyhal_clock_t *clock, bool enabled, bool wait_for_lock)
+{
+    (void)wait_for_lock;
+    clock->enabled = enabled;
+    sim_trace("clock_set_enabled %u %d", (unsigned int)clock->channel, (int)enabled);
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_clock_free(cyhal_clock_t *clock)
+{
+    clock->enabled = false;
+    sim_trace("clock_free %u", (unsigned int)clock->channel);
+}
+
+/*******************************************************************************
+* Function Name: cyhal_hwmgr_reserve
+********************************************************************************
+* Summary:
+*  Reserves a resource, failing if it is already reserved.
+*
+* Parameters:
+*  obj: resource
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or CYHAL_HWMGR_RSLT_ERR_INUSE
+*
+*******************************************************************************/
+cy_rslt_t cyhal_hwmgr_reserve(const cyhal_resource_inst_t *obj)
+{
+    cy_rslt_t result = CYHAL_HWMGR_RSLT_ERR_INUSE;
+    int32_t free_slot = -1;
+
+    sim_lock();
+    for (uint32_t slot = 0u; slot < SIM_HWMGR_SLOTS; slot++)
+    {
+        if (!sim_hwmgr_used[slot])
+        {
+            free_slot = (free_slot < 0) ? (int32_t)slot : free_slot;
+        }
+        else if ((sim_hwmgr_reserved[slot].type == obj->type) &&
+                 (sim_hwmgr_reserved[slot].block_num == obj->block_num) &&
+                 (sim_hwmgr_reserved[slot].channel_num == obj->channel_num))
+        {
+            free_slot = -1;
+            break;
+        }
+    }
+    if (free_slot >= 0)
+    {
+        sim_hwmgr_reserved[free_slot] = *obj;
+        sim_hwmgr_used[free_slot] = true;
+        result = CY_RSLT_SUCCESS;
+    }
+    sim_trace("hwmgr_reserve %d %u %u %s", (int)obj->type, (unsigned int)obj->block_num,
+              (unsigned int)obj->channel_num, (CY_RSLT_SUCCESS == result) ? "ok" : "inuse");
+    sim_unlock();
+
+    return result;
+}
+
+void cyhal_hwmgr_free(const cyhal_resource_inst_t *obj)
+{
+    sim_lock();
+    for (uint32_t slot = 0u; slot < SIM_HWMGR_SLOTS; slot++)
+    {
+        if (sim_hwmgr_used[slot] && (sim_hwmgr_reserved[slot].type == obj->type) &&
+            (sim_hwmgr_reserved[slot].block_num == obj->block_num) &&
+            (sim_hwmgr_reserved[slot].channel_num == obj->channel_num))
+        {
+            sim_hwmgr_used[slot] = false;
+        }
+    }
+    sim_trace("hwmgr_free %d %u %u", (int)obj->type, (unsigned int)obj->block_num,
+              (unsigned int)obj->channel_num);
+    sim_unlock();
+}
+
+/* [] END OF FILE */
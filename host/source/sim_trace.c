@@ -0,0 +1,226 @@
+/*******************************************************************************
+* File Name:   sim_trace.c
+*
+* Description: Call trace of the host simulation. Every simulated HAL and PDL
+*              call appends "<function> <arguments>" with its virtual time to
+*              a ring kept in memory and, when HOST_SIM_TRACE names a file, to
+*              that file, one call per line.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static pthread_mutex_t sim_trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+static sim_trace_record_t sim_trace_ring[SIM_TRACE_DEPTH];
+static uint32_t sim_trace_total = 0u;
+static FILE *sim_trace_file = NULL;
+static bool sim_trace_opened = false;
+
+
+/*******************************************************************************
+* Function Name: sim_trace
+********************************************************************************
+* Summary:
+*  Records a call.
+*
+* Parameters:
+*  format: printf() format of "<function> <arguments>"
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_trace(const char *format, ...)
+{
+    sim_trace_record_t *record;
+    va_list args;
+
+    pthread_mutex_lock(&sim_trace_mutex);
+    if (!sim_trace_opened)
+    {
+        const char *path = getenv("HOST_SIM_TRACE");
+
+        sim_trace_opened = true;
+        if (NULL != path)
+        {
+            sim_trace_file = fopen(path, "w");
+        }
+    }
+
+    record = &sim_trace_ring[sim_trace_total % SIM_TRACE_DEPTH];
+    record->time_us = sim_now_us();
+    va_start(args, format);
+    (void)vsnprintf(record->text, sizeof(record->text), format, args);
+    va_end(args);
+    sim_trace_total++;
+
+    if (NULL != sim_trace_file)
+    {
+        fprintf(sim_trace_file, "%10llu %s\n", (unsigned long long)record->time_us, record->text);
+    }
+    pthread_mutex_unlock(&sim_trace_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_trace_count
+********************************************************************************
+* Summary:
+*  Counts the recorded calls starting with a prefix, among the last
+*  SIM_TRACE_DEPTH ones.
+*
+* Parameters:
+*  prefix: start of the record, e.g. "gpio_write P16_1"
+*
+* Return:
+*  uint32_t: number of matching records
+*
+*******************************************************************************/
+uint32_t sim_trace_count(const char *prefix)
+{
+    uint32_t count = 0u;
+    uint32_t first;
+    size_t length = strlen(prefix);
+
+    pthread_mutex_lock(&sim_trace_mutex);
+    first = (sim_trace_total > SIM_TRACE_DEPTH) ? (sim_trace_total - SIM_TRACE_DEPTH) : 0u;
+    for (uint32_t index = first; index < sim_trace_total; index++)
+    {
+        if (0 == strncmp(sim_trace_ring[index % SIM_TRACE_DEPTH].text, prefix, length))
+        {
+            count++;
+        }
+    }
+    pthread_mutex_unlock(&sim_trace_mutex);
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: sim_trace_find
+********************************************************************************
+* Summary:
+*  Finds the most recent call starting with a prefix.
+*
+* Parameters:
+*  prefix: start of the record
+*  record: copy of the record found, may be NULL
+*
+* Return:
+*  true if a record matches
+*
+*******************************************************************************/
+bool sim_trace_find(const char *prefix, sim_trace_record_t *record)
+{
+    bool found = false;
+    uint32_t first;
+    size_t length = strlen(prefix);
+
+    pthread_mutex_lock(&sim_trace_mutex);
+    first = (sim_trace_total > SIM_TRACE_DEPTH) ? (sim_trace_total - SIM_TRACE_DEPTH) : 0u;
+    for (uint32_t index = sim_trace_total; index > first; index--)
+    {
+        const sim_trace_record_t *entry = &sim_trace_ring[(index - 1u) % SIM_TRACE_DEPTH];
+
+        if (0 == strncmp(entry->text, prefix, length))
+        {
+            if (NULL != record)
+            {
+                *record = *entry;
+            }
+            found = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&sim_trace_mutex);
+
+    return found;
+}
+
+/*******************************************************************************
+* Function Name: sim_trace_clear
+********************************************************************************
+* Summary:
+*  Forgets the records kept in memory. The trace file is not affected.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_trace_clear(void)
+{
+    pthread_mutex_lock(&sim_trace_mutex);
+    sim_trace_total = 0u;
+    pthread_mutex_unlock(&sim_trace_mutex);
+}
+
+/*******************************************************************************
+* Function Name: sim_trace_close
+********************************************************************************
+* Summary:
+*  Flushes and closes the trace file.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_trace_close(void)
+{
+    pthread_mutex_lock(&sim_trace_mutex);
+    if (NULL != sim_trace_file)
+    {
+        fclose(sim_trace_file);
+        sim_trace_file = NULL;
+    }
+    pthread_mutex_unlock(&sim_trace_mutex);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,674 @@
+/*******************************************************************************
+* File Name:   sim_uart.c
+*
+* Description: Debug UART model of the host simulation, with the retarget-io
+*              stand-in. Transmitted characters go to the host standard output
+*              at once, and each completed line is traced as "uart_tx <line>".
+*              Received characters come from the script and the host standard
+*              input and enter a 128-entry RX FIFO at the baud rate; with RTS
+*              and CTS pins the line holds them back while the FIFO is full,
+*              without them they are lost. With HOST_SIM_UART_PTY the UART is
+*              a pseudo-terminal instead of the standard input and output.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#include "cyhal.h"
+#include "cy_retarget_io.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_UART_RX_SIZE            (1024u)
+#define SIM_UART_LINE_SIZE          (SIM_TRACE_TEXT_SIZE - 8u)
+
+/* RX FIFO of the SCB */
+#define SIM_UART_FIFO_SIZE          (128u)
+
+/* Start, 8 data and stop bits */
+#define SIM_UART_BITS_PER_CHAR      (10u)
+
+/* Largest rate difference of the two ends of the pseudo-terminal that still
+ * samples correctly, in percent */
+#define SIM_UART_PTY_TOLERANCE      (2u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void sim_uart_tx(const char *text, size_t length);
+static ssize_t sim_uart_stdout_write(void *cookie, const char *buf, size_t size);
+static void sim_uart_line_rx(cyhal_uart_t *uart);
+static void sim_uart_pty_poll(void);
+static bool sim_uart_pty_in_step(void);
+static void sim_uart_pty_close(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+cyhal_uart_t cy_retarget_io_uart_obj;
+
+/* UARTs with events enabled, only the debug UART is used */
+static cyhal_uart_t *sim_uart_active = NULL;
+
+/* Characters on their way, not yet in the RX FIFO */
+static uint8_t  sim_uart_rx_buf[SIM_UART_RX_SIZE];
+static uint32_t sim_uart_rx_head = 0u;
+static uint32_t sim_uart_rx_tail = 0u;
+
+/* RX FIFO, filled at the baud rate */
+static uint8_t  sim_uart_fifo[SIM_UART_FIFO_SIZE];
+static uint32_t sim_uart_fifo_head = 0u;
+static uint32_t sim_uart_fifo_tail = 0u;
+static uint64_t sim_uart_rx_credit = 0u;        /* Bit times x 1 000 000 */
+static bool     sim_uart_flow_control = false;
+static bool     sim_uart_rx_error = false;
+
+/* Pseudo-terminal of HOST_SIM_UART_PTY. The slave stays open, so that the
+ * rate set by the program on the other end can be read. */
+static int          sim_uart_pty_master = -1;
+static int          sim_uart_pty_slave = -1;
+static const char  *sim_uart_pty_link = NULL;
+
+/* Rates a pseudo-terminal can be set to */
+static const struct
+{
+    speed_t  speed;
+    uint32_t baud;
+} sim_uart_pty_rates[] =
+{
+    { B9600, 9600u }, { B19200, 19200u }, { B38400, 38400u }, { B57600, 57600u },
+    { B115200, 115200u }, { B230400, 230400u }, { B460800, 460800u }, { B500000, 500000u },
+    { B921600, 921600u }, { B1000000, 1000000u }, { B1500000, 1500000u }, { B2000000, 2000000u },
+    { B2500000, 2500000u }, { B3000000, 3000000u }, { B4000000, 4000000u },
+};
+
+static pthread_mutex_t sim_uart_tx_mutex = PTHREAD_MUTEX_INITIALIZER;
+static char     sim_uart_line[SIM_UART_LINE_SIZE];
+static uint32_t sim_uart_line_length = 0u;
+
+
+cy_rslt_t cyhal_uart_init(cyhal_uart_t *obj, cyhal_gpio_t tx, cyhal_gpio_t rx,
+                          cyhal_gpio_t cts, cyhal_gpio_t rts, const cyhal_clock_t *clk,
+                          const cyhal_uart_cfg_t *cfg)
+{
+    (void)clk;
+    (void)cfg;
+
+    sim_lock();
+    sim_uart_flow_control = (NC != cts) && (NC != rts);
+    obj->tx = tx;
+    obj->rx = rx;
+    obj->baud_rate = CY_RETARGET_IO_BAUDRATE;
+    obj->callback = NULL;
+    obj->callback_arg = NULL;
+    obj->event_mask = 0u;
+    obj->initialized = true;
+    sim_uart_active = obj;
+    sim_trace("uart_init P%u_%u P%u_%u", SIM_PIN(tx), SIM_PIN(rx));
+    if (sim_uart_flow_control)
+    {
+        sim_trace("uart_flow_control P%u_%u P%u_%u", SIM_PIN(cts), SIM_PIN(rts));
+    }
+    sim_unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_uart_free(cyhal_uart_t *obj)
+{
+    sim_lock();
+    obj->initialized = false;
+    obj->event_mask = 0u;
+    if (sim_uart_active == obj)
+    {
+        sim_uart_active = NULL;
+    }
+    sim_trace("uart_free");
+    sim_unlock();
+}
+
+cy_rslt_t cyhal_uart_set_baud(cyhal_uart_t *obj, uint32_t baudrate, uint32_t *actualbaud)
+{
+    sim_lock();
+    obj->baud_rate = baudrate;
+    sim_unlock();
+    if (NULL != actualbaud)
+    {
+        *actualbaud = baudrate;
+    }
+    sim_trace("uart_set_baud %lu", (unsigned long)baudrate);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_uart_getc
+********************************************************************************
+* Summary:
+*  Takes a received character, waiting up to the timeout in virtual time.
+*
+* Parameters:
+*  obj: UART
+*  value: received character
+*  timeout: milliseconds to wait, 0 waits forever
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or CYHAL_UART_RSLT_ERR_TIMEOUT
+*
+*******************************************************************************/
+cy_rslt_t cyhal_uart_getc(cyhal_uart_t *obj, uint8_t *value, uint32_t timeout)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t waited = 0u;
+
+    (void)obj;
+
+    sim_lock();
+    while (sim_uart_fifo_head == sim_uart_fifo_tail)
+    {
+        if ((0u != timeout) && (waited >= timeout))
+        {
+            result = CYHAL_UART_RSLT_ERR_TIMEOUT;
+            break;
+        }
+        sim_unlock();
+        sim_wait_us(1000u);
+        sim_lock();
+        waited++;
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        *value = sim_uart_fifo[sim_uart_fifo_tail % SIM_UART_FIFO_SIZE];
+        sim_uart_fifo_tail++;
+        sim_trace("uart_getc 0x%02x", (unsigned int)*value);
+    }
+    sim_unlock();
+
+    return result;
+}
+
+uint32_t cyhal_uart_readable(cyhal_uart_t *obj)
+{
+    (void)obj;
+    return sim_uart_fifo_head - sim_uart_fifo_tail;
+}
+
+cy_rslt_t cyhal_uart_putc(cyhal_uart_t *obj, uint32_t value)
+{
+    char c = (char)value;
+
+    (void)obj;
+    sim_uart_tx(&c, 1u);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Output leaves at once, there is never anything in flight */
+bool cyhal_uart_is_tx_active(cyhal_uart_t *obj)
+{
+    (void)obj;
+    return false;
+}
+
+void cyhal_uart_register_callback(cyhal_uart_t *obj, cyhal_uart_event_callback_t callback,
+                                  void *callback_arg)
+{
+    sim_lock();
+    obj->callback = callback;
+    obj->callback_arg = callback_arg;
+    sim_uart_active = obj;
+    sim_trace("uart_register_callback %s", (NULL != callback) ? "set" : "none");
+    sim_unlock();
+}
+
+void cyhal_uart_enable_event(cyhal_uart_t *obj, cyhal_uart_event_t event,
+                             uint8_t intr_priority, bool enable)
+{
+    sim_lock();
+    if (enable)
+    {
+        obj->event_mask |= (uint32_t)event;
+    }
+    else
+    {
+        obj->event_mask &= ~(uint32_t)event;
+    }
+    sim_trace("uart_enable_event 0x%03x %u %d", (unsigned int)event, (unsigned int)intr_priority,
+              (int)enable);
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_uart_rx
+********************************************************************************
+* Summary:
+*  Queues characters received by the debug UART. Characters that do not fit
+*  are lost, as on a UART overrun.
+*
+* Parameters:
+*  text: received characters
+*  length: number of characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_uart_rx(const char *text, uint32_t length)
+{
+    sim_lock();
+    for (uint32_t index = 0u; index < length; index++)
+    {
+        if ((sim_uart_rx_head - sim_uart_rx_tail) < SIM_UART_RX_SIZE)
+        {
+            sim_uart_rx_buf[sim_uart_rx_head % SIM_UART_RX_SIZE] = (uint8_t)text[index];
+            sim_uart_rx_head++;
+        }
+        sim_trace("stim_uart_rx 0x%02x", (unsigned int)(uint8_t)text[index]);
+    }
+    sim_unlock();
+}
+
+/*******************************************************************************
+* Function Name: sim_uart_tick
+********************************************************************************
+* Summary:
+*  Moves the characters on their way into the RX FIFO and raises the enabled
+*  UART events: RX_NOT_EMPTY while the FIFO is not empty, RX_ERROR after a
+*  lost character and TX_EMPTY always, as the output never waits.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_uart_tick(void)
+{
+    cyhal_uart_t *uart = sim_uart_active;
+    uint32_t events = 0u;
+
+    sim_uart_pty_poll();
+    if ((NULL == uart) || (NULL == uart->callback))
+    {
+        return;
+    }
+    sim_uart_line_rx(uart);
+
+    if (sim_uart_fifo_head != sim_uart_fifo_tail)
+    {
+        events |= (uint32_t)CYHAL_UART_IRQ_RX_NOT_EMPTY;
+    }
+    if (sim_uart_rx_error)
+    {
+        events |= (uint32_t)CYHAL_UART_IRQ_RX_ERROR;
+        sim_uart_rx_error = false;
+    }
+    events |= (uint32_t)CYHAL_UART_IRQ_TX_EMPTY;
+    events &= uart->event_mask;
+
+    if (0u != events)
+    {
+        uart->callback(uart->callback_arg, (cyhal_uart_event_t)events);
+        sim_isr_done();
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_uart_tx
+********************************************************************************
+* Summary:
+*  Writes characters to the host standard output, or to the pseudo-terminal
+*  if its other end runs at the same rate, and traces complete lines.
+*
+* Parameters:
+*  text: characters
+*  length: number of characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_uart_tx(const char *text, size_t length)
+{
+    pthread_mutex_lock(&sim_uart_tx_mutex);
+    if (sim_uart_pty_master < 0)
+    {
+        (void)!write(STDOUT_FILENO, text, length);
+    }
+    else if (sim_uart_pty_in_step())
+    {
+        /* Nobody reading: the characters are lost, as on a real line */
+        (void)!write(sim_uart_pty_master, text, length);
+    }
+    for (size_t index = 0u; index < length; index++)
+    {
+        char c = text[index];
+
+        if (('\n' == c) || ('\r' == c) || (sim_uart_line_length == (SIM_UART_LINE_SIZE - 1u)))
+        {
+            if (0u != sim_uart_line_length)
+            {
+                sim_uart_line[sim_uart_line_length] = '\0';
+                sim_trace("uart_tx %s", sim_uart_line);
+                sim_uart_line_length = 0u;
+            }
+        }
+        if (('\n' != c) && ('\r' != c))
+        {
+            sim_uart_line[sim_uart_line_length++] = c;
+        }
+    }
+    pthread_mutex_unlock(&sim_uart_tx_mutex);
+}
+
+static ssize_t sim_uart_stdout_write(void *cookie, const char *buf, size_t size)
+{
+    (void)cookie;
+    sim_uart_tx(buf, size);
+
+    return (ssize_t)size;
+}
+
+/*******************************************************************************
+* Function Name: cy_retarget_io_init
+********************************************************************************
+* Summary:
+*  Initializes the debug UART and sends stdout through it, unbuffered, as the
+*  retarget-io library does on the target.
+*
+* Parameters:
+*  tx: TX pin
+*  rx: RX pin
+*  baudrate: baud rate
+*
+* Return:
+*  cy_rslt_t: result of cyhal_uart_init()
+*
+*******************************************************************************/
+cy_rslt_t cy_retarget_io_init(cyhal_gpio_t tx, cyhal_gpio_t rx, uint32_t baudrate)
+{
+    return cy_retarget_io_init_fc(tx, rx, NC, NC, baudrate);
+}
+
+/*******************************************************************************
+* Function Name: cy_retarget_io_init_fc
+********************************************************************************
+* Summary:
+*  Initializes the debug UART with RTS/CTS flow control, see
+*  cy_retarget_io_init().
+*
+* Parameters:
+*  tx: TX pin
+*  rx: RX pin
+*  cts: CTS pin
+*  rts: RTS pin
+*  baudrate: baud rate
+*
+* Return:
+*  cy_rslt_t: result of cyhal_uart_init()
+*
+*******************************************************************************/
+cy_rslt_t cy_retarget_io_init_fc(cyhal_gpio_t tx, cyhal_gpio_t rx, cyhal_gpio_t cts,
+                                 cyhal_gpio_t rts, uint32_t baudrate)
+{
+    static const cookie_io_functions_t functions = { .write = sim_uart_stdout_write };
+    cy_rslt_t result = cyhal_uart_init(&cy_retarget_io_uart_obj, tx, rx, cts, rts, NULL, NULL);
+    FILE *stream;
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        (void)cyhal_uart_set_baud(&cy_retarget_io_uart_obj, baudrate, NULL);
+        stream = fopencookie(NULL, "w", functions);
+        if (NULL != stream)
+        {
+            fflush(stdout);
+            stdout = stream;
+        }
+        setvbuf(stdout, NULL, _IONBF, 0);
+    }
+
+    return result;
+}
+
+void cy_retarget_io_deinit(void)
+{
+    cyhal_uart_free(&cy_retarget_io_uart_obj);
+}
+
+/*******************************************************************************
+* Function Name: sim_uart_open
+********************************************************************************
+* Summary:
+*  Creates the pseudo-terminal of the debug UART if HOST_SIM_UART_PTY names
+*  a link to it. A terminal program or host/tools/baud_switch then opens the
+*  link, and the rate it sets on its end must match the rate of the UART.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  bool: true if the UART uses the pseudo-terminal instead of the standard
+*  input and output
+*
+*******************************************************************************/
+bool sim_uart_open(void)
+{
+    const char *link = getenv("HOST_SIM_UART_PTY");
+    struct termios settings;
+    const char *name;
+
+    if (NULL == link)
+    {
+        return false;
+    }
+
+    sim_uart_pty_master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if ((sim_uart_pty_master < 0) || (0 != grantpt(sim_uart_pty_master)) ||
+        (0 != unlockpt(sim_uart_pty_master)) || (NULL == (name = ptsname(sim_uart_pty_master))))
+    {
+        sim_fail(__FILE__, __LINE__, "cannot create the pseudo-terminal of the debug UART");
+    }
+    sim_uart_pty_slave = open(name, O_RDWR | O_NOCTTY);
+    if ((sim_uart_pty_slave < 0) || (0 != tcgetattr(sim_uart_pty_slave, &settings)))
+    {
+        sim_fail(__FILE__, __LINE__, "cannot open the pseudo-terminal of the debug UART");
+    }
+    cfmakeraw(&settings);
+    (void)cfsetspeed(&settings, B115200);
+    (void)tcsetattr(sim_uart_pty_slave, TCSANOW, &settings);
+
+    (void)unlink(link);
+    if (0 != symlink(name, link))
+    {
+        sim_fail(__FILE__, __LINE__, "cannot create the link to the pseudo-terminal");
+    }
+    sim_uart_pty_link = link;
+    atexit(sim_uart_pty_close);
+    fprintf(stderr, "Debug UART on %s, linked from %s\n", name, link);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_uart_line_rx
+********************************************************************************
+* Summary:
+*  Moves the characters on their way into the RX FIFO, as many per tick as
+*  the baud rate allows. A full FIFO holds the line back with flow control
+*  and loses the character without, which raises RX_ERROR.
+*
+* Parameters:
+*  uart: debug UART
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_uart_line_rx(cyhal_uart_t *uart)
+{
+    const uint64_t char_time = (uint64_t)SIM_UART_BITS_PER_CHAR * 1000000u;
+
+    if (sim_uart_rx_head == sim_uart_rx_tail)
+    {
+        /* Idle line */
+        sim_uart_rx_credit = 0u;
+        return;
+    }
+
+    sim_uart_rx_credit += (uint64_t)uart->baud_rate * SIM_TICK_US;
+    while ((sim_uart_rx_credit >= char_time) && (sim_uart_rx_head != sim_uart_rx_tail))
+    {
+        if ((sim_uart_fifo_head - sim_uart_fifo_tail) == SIM_UART_FIFO_SIZE)
+        {
+            if (sim_uart_flow_control)
+            {
+                /* RTS deasserted, the sender waits */
+                sim_uart_rx_credit = char_time;
+                break;
+            }
+            sim_uart_rx_error = true;
+            sim_trace("uart_rx_overflow 0x%02x", (unsigned int)sim_uart_rx_buf[sim_uart_rx_tail % SIM_UART_RX_SIZE]);
+        }
+        else
+        {
+            sim_uart_fifo[sim_uart_fifo_head % SIM_UART_FIFO_SIZE] = sim_uart_rx_buf[sim_uart_rx_tail % SIM_UART_RX_SIZE];
+            sim_uart_fifo_head++;
+        }
+        sim_uart_rx_tail++;
+        sim_uart_rx_credit -= char_time;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_uart_pty_poll
+********************************************************************************
+* Summary:
+*  Passes the characters written to the pseudo-terminal to the debug UART.
+*  Characters sent at another rate than the UART runs at are lost with a
+*  frame error.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void sim_uart_pty_poll(void)
+{
+    char buffer[64];
+    ssize_t count;
+
+    if (sim_uart_pty_master < 0)
+    {
+        return;
+    }
+
+    count = read(sim_uart_pty_master, buffer, sizeof(buffer));
+    if (count <= 0)
+    {
+        return;
+    }
+    if (sim_uart_pty_in_step())
+    {
+        sim_uart_rx(buffer, (uint32_t)count);
+    }
+    else
+    {
+        sim_uart_rx_error = true;
+        sim_trace("uart_rx_frame_error %ld", (long)count);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_uart_pty_in_step
+********************************************************************************
+* Summary:
+*  Checks that the program on the other end of the pseudo-terminal set the
+*  rate the UART runs at.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  bool: true if the rates match within SIM_UART_PTY_TOLERANCE
+*
+*******************************************************************************/
+static bool sim_uart_pty_in_step(void)
+{
+    struct termios settings;
+    speed_t speed;
+    uint32_t device = cy_retarget_io_uart_obj.baud_rate;
+    uint32_t other = 0u;
+    uint32_t deviation;
+
+    if (0 != tcgetattr(sim_uart_pty_slave, &settings))
+    {
+        return false;
+    }
+    speed = cfgetospeed(&settings);
+    for (uint32_t index = 0u; index < (sizeof(sim_uart_pty_rates) / sizeof(sim_uart_pty_rates[0])); index++)
+    {
+        if (sim_uart_pty_rates[index].speed == speed)
+        {
+            other = sim_uart_pty_rates[index].baud;
+        }
+    }
+    deviation = (other > device) ? (other - device) : (device - other);
+
+    return ((uint64_t)deviation * 100u) <= ((uint64_t)device * SIM_UART_PTY_TOLERANCE);
+}
+
+static void sim_uart_pty_close(void)
+{
+    if (NULL != sim_uart_pty_link)
+    {
+        (void)unlink(sim_uart_pty_link);
+    }
+}
+
+/* [] END OF FILE */
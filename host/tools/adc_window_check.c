@@ -0,0 +1,632 @@
+/*******************************************************************************
+* File Name:   adc_window_check.c
+*
+* Description: Host check of the window comparator alarms (adc_window.h) on
+*              the SAR model of the simulation. Injects sine, triangle,
+*              square, dithered ramp and noise waveforms one conversion at a
+*              time and compares each alarm, its zone and its sample with a
+*              reference comparator that applies the window and the
+*              hysteresis to the same samples. Also checks the limits at the
+*              ends of the scale, a window narrower than the hysteresis, a
+*              change of the limits, a second channel, the full event queue
+*              and the parameter errors. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include "cyhal.h"
+#include "cycfg.h"
+#include "sim.h"
+#include "oob_demo.h"
+#include "adc_window.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define ADC_WINDOW_CHECK_PRINT      (10u)
+
+/* Scale of the SAR model of sim_adc.c */
+#define ADC_WINDOW_CHECK_VREF_MV    (3300)
+#define ADC_WINDOW_CHECK_COUNTS     (4096)
+
+/* Input of a second channel, converted as 0 by the model */
+#define ADC_WINDOW_CHECK_GND_INPUT  (CY_SAR2_PIN_ADDRESS_AN1)
+
+#define ADC_WINDOW_CHECK(condition, what) \
+    adc_window_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef enum
+{
+    ADC_WINDOW_CHECK_SINE,
+    ADC_WINDOW_CHECK_TRIANGLE,
+    ADC_WINDOW_CHECK_SQUARE,
+    ADC_WINDOW_CHECK_CONSTANT,
+} adc_window_check_shape_t;
+
+/* Input waveform, in millivolts, sampled once per conversion */
+typedef struct
+{
+    const char               *name;
+    adc_window_check_shape_t  shape;
+    int32_t                   min_mv;
+    int32_t                   max_mv;
+    uint32_t                  period;       /* Samples per period */
+    uint32_t                  samples;
+    int32_t                   noise_mv;     /* Uniform noise added, +/- */
+    uint32_t                  low_mv;       /* Window of channel 0 */
+    uint32_t                  high_mv;
+} adc_window_check_wave_t;
+
+/* Reference comparator of one channel */
+typedef struct
+{
+    uint16_t          low;
+    uint16_t          high;
+    adc_window_zone_t zone;
+} adc_window_model_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void adc_window_check_expect(bool condition, const char *what, int line);
+static uint32_t adc_window_check_rand(uint32_t *state);
+static int32_t adc_window_check_mv(const adc_window_check_wave_t *wave, uint32_t index, uint32_t *noise);
+static uint16_t adc_window_check_counts(int32_t mv);
+static void adc_window_check_convert(int32_t mv);
+static adc_window_zone_t adc_window_model_zone(const adc_window_model_t *model, uint16_t sample);
+static bool adc_window_model_sample(adc_window_model_t *model, uint16_t sample);
+static bool adc_window_check_compare(adc_window_model_t *model, uint32_t count, int32_t mv, uint32_t *alarms);
+static uint32_t adc_window_check_run(const adc_window_check_wave_t *wave, bool ground_channel);
+static void adc_window_check_waves(void);
+static void adc_window_check_limits(void);
+static void adc_window_check_queue(void);
+static void adc_window_check_params(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t adc_window_check_cases = 0u;
+static uint32_t adc_window_check_failures = 0u;
+
+/* Posted by the range interrupt handler of adc_window.c */
+event_flags_t demo_events = EVENT_FLAGS_INIT(0u);
+
+/* Virtual time of the conversions */
+static uint64_t adc_window_check_now_us = 0u;
+
+
+/* Counts a check and prints the first failures */
+static void adc_window_check_expect(bool condition, const char *what, int line)
+{
+    adc_window_check_cases++;
+    if (!condition)
+    {
+        adc_window_check_failures++;
+        if (adc_window_check_failures <= ADC_WINDOW_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/* xorshift32, the same sequence on every run */
+static uint32_t adc_window_check_rand(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+/* The simulated HAL is linked without the CAN FD demo that CANFD_config refers to */
+void canfd_rx_callback(bool rxFIFOMsg, uint8_t msgBufOrRxFIFONum, cy_stc_canfd_rx_buffer_t *basemsg)
+{
+    (void)rxFIFOMsg;
+    (void)msgBufOrRxFIFONum;
+    (void)basemsg;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_check_mv
+********************************************************************************
+* Summary:
+*  Returns a sample of a waveform. The square wave starts high and the
+*  triangle rising, as the adc_wave command of the simulation.
+*
+* Parameters:
+*  wave: waveform
+*  index: sample number
+*  noise: state of the noise generator
+*
+* Return:
+*  int32_t: input voltage in millivolts
+*
+*******************************************************************************/
+static int32_t adc_window_check_mv(const adc_window_check_wave_t *wave, uint32_t index, uint32_t *noise)
+{
+    double phase = (double)(index % wave->period) / (double)wave->period;
+    double span = (double)(wave->max_mv - wave->min_mv);
+    double mv;
+
+    switch (wave->shape)
+    {
+        case ADC_WINDOW_CHECK_SINE:
+            mv = wave->min_mv + (span * (1.0 + sin(2.0 * M_PI * phase)) / 2.0);
+            break;
+        case ADC_WINDOW_CHECK_TRIANGLE:
+            mv = wave->min_mv + (span * ((phase < 0.5) ? (2.0 * phase) : (2.0 - (2.0 * phase))));
+            break;
+        case ADC_WINDOW_CHECK_SQUARE:
+            mv = (phase < 0.5) ? wave->max_mv : wave->min_mv;
+            break;
+        default:
+            mv = wave->min_mv;
+            break;
+    }
+    if (0 != wave->noise_mv)
+    {
+        mv += (double)((int32_t)(adc_window_check_rand(noise) % (uint32_t)((2 * wave->noise_mv) + 1)) -
+                       wave->noise_mv);
+    }
+
+    return (int32_t)lround(mv);
+}
+
+/* Result of the SAR model for an input voltage, clipped to the scale */
+static uint16_t adc_window_check_counts(int32_t mv)
+{
+    int32_t counts = (mv * ADC_WINDOW_CHECK_COUNTS) / ADC_WINDOW_CHECK_VREF_MV;
+
+    return (uint16_t)((counts < 0) ? 0 : ((counts >= ADC_WINDOW_CHECK_COUNTS) ? (ADC_WINDOW_CHECK_COUNTS - 1) :
+                                                                                 counts));
+}
+
+/* Sets the input and lets the SAR convert its group once. The range
+ * interrupts run before the call returns. */
+static void adc_window_check_convert(int32_t mv)
+{
+    sim_adc_set_mv(mv);
+    adc_window_check_now_us += SIM_TICK_US;
+    sim_lock();
+    sim_adc_tick(adc_window_check_now_us);
+    sim_unlock();
+}
+
+/* Zone of a sample: low <= sample < high is inside */
+static adc_window_zone_t adc_window_model_zone(const adc_window_model_t *model, uint16_t sample)
+{
+    if (sample < model->low)
+    {
+        return ADC_WINDOW_BELOW;
+    }
+
+    return (sample >= model->high) ? ADC_WINDOW_ABOVE : ADC_WINDOW_INSIDE;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_model_sample
+********************************************************************************
+* Summary:
+*  Reference comparator: from inside the window a sample outside of it is an
+*  alarm; after an alarm below, a sample at least ADC_WINDOW_HYSTERESIS above
+*  the low limit ends it, and after an alarm above, a sample more than
+*  ADC_WINDOW_HYSTERESIS below the high limit. The new zone is that of the
+*  sample, so a step can go from below to above at once.
+*
+* Parameters:
+*  model: comparator of the channel
+*  sample: converted sample
+*
+* Return:
+*  bool: true if the sample changes the zone
+*
+*******************************************************************************/
+static bool adc_window_model_sample(adc_window_model_t *model, uint16_t sample)
+{
+    bool crossed;
+
+    switch (model->zone)
+    {
+        case ADC_WINDOW_BELOW:
+            crossed = (sample >= (model->low + ADC_WINDOW_HYSTERESIS));
+            break;
+        case ADC_WINDOW_ABOVE:
+            crossed = (model->high > ADC_WINDOW_HYSTERESIS) && (sample < (model->high - ADC_WINDOW_HYSTERESIS));
+            break;
+        default:
+            crossed = (ADC_WINDOW_INSIDE != adc_window_model_zone(model, sample));
+            break;
+    }
+    if (crossed)
+    {
+        model->zone = adc_window_model_zone(model, sample);
+    }
+
+    return crossed;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_check_compare
+********************************************************************************
+* Summary:
+*  Steps the reference comparators with a converted input and reads the
+*  queued alarms, which must be those of the reference, in channel order.
+*  Reads the whole queue even after a difference.
+*
+* Parameters:
+*  model: comparators of the channels, channel 0 on the potentiometer and
+*         the others on grounded inputs
+*  count: number of channels
+*  mv: converted input voltage
+*  alarms: incremented by the alarms of the reference
+*
+* Return:
+*  bool: true if the queued alarms match
+*
+*******************************************************************************/
+static bool adc_window_check_compare(adc_window_model_t *model, uint32_t count, int32_t mv, uint32_t *alarms)
+{
+    adc_window_event_t event;
+    bool matched = true;
+
+    /* The handler queues the channels in order */
+    for (uint32_t channel = 0u; channel < count; channel++)
+    {
+        uint16_t sample = (0u == channel) ? adc_window_check_counts(mv) : 0u;
+
+        if (adc_window_model_sample(&model[channel], sample))
+        {
+            (*alarms)++;
+            matched = adc_window_read_event(&event) && (channel == event.channel) &&
+                      (model[channel].zone == event.zone) && (sample == event.sample) && matched;
+        }
+    }
+    while (adc_window_read_event(&event))
+    {
+        matched = false;
+    }
+
+    return matched;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_check_run
+********************************************************************************
+* Summary:
+*  Converts a waveform on channel 0, optionally with a grounded channel 1
+*  watching the window 100 to 200 mV, and compares the alarms after each
+*  conversion with the reference comparators.
+*
+* Parameters:
+*  wave: waveform and window of channel 0
+*  ground_channel: true to add channel 1
+*
+* Return:
+*  uint32_t: alarms of the reference comparators, or UINT32_MAX if the
+*  alarms differ
+*
+*******************************************************************************/
+static uint32_t adc_window_check_run(const adc_window_check_wave_t *wave, bool ground_channel)
+{
+    const adc_window_channel_t channels[2] =
+    {
+        { ADC_WINDOW_POT_INPUT, adc_window_mv_to_counts(wave->low_mv), adc_window_mv_to_counts(wave->high_mv) },
+        { ADC_WINDOW_CHECK_GND_INPUT, adc_window_mv_to_counts(100u), adc_window_mv_to_counts(200u) },
+    };
+    uint32_t count = ground_channel ? 2u : 1u;
+    adc_window_model_t model[2];
+    adc_window_stats_t stats;
+    uint32_t noise = 0x9E3779B9u;
+    uint32_t alarms = 0u;
+    int32_t mv = adc_window_check_mv(wave, 0u, &noise);
+    bool matched;
+
+    for (uint32_t channel = 0u; channel < count; channel++)
+    {
+        model[channel].low = channels[channel].low;
+        model[channel].high = channels[channel].high;
+        model[channel].zone = ADC_WINDOW_INSIDE;
+    }
+
+    /* The init converts the first sample */
+    sim_adc_set_mv(mv);
+    if (CY_RSLT_SUCCESS != adc_window_init(channels, count))
+    {
+        return UINT32_MAX;
+    }
+    matched = adc_window_check_compare(model, count, mv, &alarms);
+
+    for (uint32_t index = 1u; index < wave->samples; index++)
+    {
+        mv = adc_window_check_mv(wave, index, &noise);
+        adc_window_check_convert(mv);
+        matched = adc_window_check_compare(model, count, mv, &alarms) && matched;
+    }
+
+    adc_window_get_stats(&stats);
+    adc_window_free();
+    matched = matched && (alarms == stats.interrupts) && (0u == stats.dropped);
+    if (!matched && (adc_window_check_failures < ADC_WINDOW_CHECK_PRINT))
+    {
+        printf("     %s: %u alarms expected, %u interrupts, %u dropped\n", wave->name, alarms, stats.interrupts,
+               stats.dropped);
+    }
+
+    return matched ? alarms : UINT32_MAX;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_check_waves
+********************************************************************************
+* Summary:
+*  Compares the alarms of the waveforms with the reference. A dither
+*  smaller than the hysteresis crosses each limit once per ramp, a larger
+*  one may chatter, but only as the reference does.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void adc_window_check_waves(void)
+{
+    /* Name, shape, min, max, period, samples, noise, window */
+    static const adc_window_check_wave_t sine = {
+        "sine", ADC_WINDOW_CHECK_SINE, 0, 3300, 400u, 2000u, 0, 1000u, 2300u };
+    static const adc_window_check_wave_t triangle = {
+        "triangle", ADC_WINDOW_CHECK_TRIANGLE, 0, 3300, 500u, 2000u, 0, 1000u, 2300u };
+    static const adc_window_check_wave_t square = {
+        "square", ADC_WINDOW_CHECK_SQUARE, 200, 3100, 40u, 400u, 0, 1000u, 2300u };
+    static const adc_window_check_wave_t dither = {
+        "dither", ADC_WINDOW_CHECK_TRIANGLE, 0, 3300, 2000u, 2000u, 8, 1000u, 2300u };
+    static const adc_window_check_wave_t noise = {
+        "noise", ADC_WINDOW_CHECK_CONSTANT, 1000, 1000, 1u, 4000u, 40, 1000u, 2300u };
+    static const adc_window_check_wave_t narrow = {
+        "narrow", ADC_WINDOW_CHECK_SINE, 1400, 1800, 200u, 2000u, 5, 1600u, 1610u };
+    static const adc_window_check_wave_t inside = {
+        "inside", ADC_WINDOW_CHECK_SINE, 1100, 2200, 100u, 1000u, 20, 1000u, 2300u };
+    static const adc_window_check_wave_t clipped = {
+        "clipped", ADC_WINDOW_CHECK_SINE, -300, 3600, 300u, 1500u, 0, 1000u, 2300u };
+    uint32_t alarms;
+
+    alarms = adc_window_check_run(&sine, false);
+    ADC_WINDOW_CHECK((UINT32_MAX != alarms) && (alarms >= 10u), "alarms of a sine");
+    alarms = adc_window_check_run(&triangle, false);
+    ADC_WINDOW_CHECK((UINT32_MAX != alarms) && (alarms >= 8u), "alarms of a triangle");
+    alarms = adc_window_check_run(&square, false);
+    ADC_WINDOW_CHECK(20u == alarms, "a square wave jumps between above and below");
+
+    /* Start below, then inside, above, inside and below again */
+    alarms = adc_window_check_run(&dither, false);
+    ADC_WINDOW_CHECK(5u == alarms, "a dither within the hysteresis crosses each limit once");
+    alarms = adc_window_check_run(&noise, false);
+    ADC_WINDOW_CHECK((UINT32_MAX != alarms) && (alarms > 2u), "noise past the hysteresis at a limit");
+    alarms = adc_window_check_run(&narrow, false);
+    ADC_WINDOW_CHECK((UINT32_MAX != alarms) && (alarms >= 10u), "a window narrower than the hysteresis");
+    alarms = adc_window_check_run(&inside, false);
+    ADC_WINDOW_CHECK(0u == alarms, "a waveform inside the window raises no alarm");
+    alarms = adc_window_check_run(&clipped, false);
+    ADC_WINDOW_CHECK((UINT32_MAX != alarms) && (alarms >= 10u), "a waveform clipped by the scale");
+
+    /* The grounded channel is below its window from the first conversion */
+    alarms = adc_window_check_run(&sine, true);
+    ADC_WINDOW_CHECK((UINT32_MAX != alarms) && (alarms == (adc_window_check_run(&sine, false) + 1u)),
+                     "a second channel alarms on its own");
+}
+
+/*******************************************************************************
+* Function Name: adc_window_check_limits
+********************************************************************************
+* Summary:
+*  Checks a window over the whole scale, which never alarms, and a change of
+*  the limits while converting, which re-arms the channel as inside the new
+*  window.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void adc_window_check_limits(void)
+{
+    static const adc_window_check_wave_t full = {
+        "full scale", ADC_WINDOW_CHECK_TRIANGLE, -100, 3400, 100u, 500u, 0, 0u, 3300u };
+    adc_window_channel_t channel = { ADC_WINDOW_POT_INPUT, 0u, 0u };
+    adc_window_event_t event;
+
+    ADC_WINDOW_CHECK(0u == adc_window_check_run(&full, false), "a window over the whole scale never alarms");
+
+    /* The init converts the input at once */
+    channel.low = adc_window_mv_to_counts(1000u);
+    channel.high = adc_window_mv_to_counts(2300u);
+    sim_adc_set_mv(500);
+    ADC_WINDOW_CHECK(CY_RSLT_SUCCESS == adc_window_init(&channel, 1u), "init of the window");
+    ADC_WINDOW_CHECK(adc_window_read_event(&event) && (ADC_WINDOW_BELOW == event.zone),
+                     "the conversion of the init alarms");
+    adc_window_check_convert(2000);
+    ADC_WINDOW_CHECK(adc_window_read_event(&event) && (ADC_WINDOW_INSIDE == event.zone),
+                     "a sample inside ends the alarm");
+    adc_window_check_convert(2000);
+    ADC_WINDOW_CHECK(!adc_window_read_event(&event), "a sample inside raises no alarm");
+
+    /* The held sample is now below the new window */
+    ADC_WINDOW_CHECK(CY_RSLT_SUCCESS == adc_window_set_limits(0u, adc_window_mv_to_counts(2500u),
+                     adc_window_mv_to_counts(3000u)), "change of the limits");
+    adc_window_check_convert(2000);
+    ADC_WINDOW_CHECK(adc_window_read_event(&event) && (ADC_WINDOW_BELOW == event.zone),
+                     "a sample outside the new window alarms");
+    adc_window_check_convert(2000);
+    ADC_WINDOW_CHECK(!adc_window_read_event(&event), "an alarm is raised once");
+
+    /* Back to a window holding the sample: re-armed inside, no alarm */
+    ADC_WINDOW_CHECK(CY_RSLT_SUCCESS == adc_window_set_limits(0u, adc_window_mv_to_counts(1000u),
+                     adc_window_mv_to_counts(2300u)), "change back of the limits");
+    adc_window_check_convert(2000);
+    ADC_WINDOW_CHECK(!adc_window_read_event(&event), "a sample inside the new window raises no alarm");
+    adc_window_check_convert(2400);
+    ADC_WINDOW_CHECK(adc_window_read_event(&event) && (ADC_WINDOW_ABOVE == event.zone),
+                     "the re-armed channel alarms above");
+    adc_window_free();
+}
+
+/*******************************************************************************
+* Function Name: adc_window_check_queue
+********************************************************************************
+* Summary:
+*  Alarms while nobody reads them: the queue keeps the oldest ones and counts
+*  the others as dropped.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void adc_window_check_queue(void)
+{
+    adc_window_channel_t channel =
+    {
+        ADC_WINDOW_POT_INPUT, adc_window_mv_to_counts(1000u), adc_window_mv_to_counts(2300u)
+    };
+    adc_window_event_t event;
+    adc_window_stats_t stats;
+    uint32_t read = 0u;
+    bool ordered = true;
+
+    sim_adc_set_mv(1500);
+    ADC_WINDOW_CHECK(CY_RSLT_SUCCESS == adc_window_init(&channel, 1u), "init of the window");
+    for (uint32_t crossing = 0u; crossing < 40u; crossing++)
+    {
+        adc_window_check_convert((0u == (crossing % 2u)) ? 3000 : 200);
+    }
+    while (adc_window_read_event(&event))
+    {
+        ordered = ordered && (event.zone == ((0u == (read % 2u)) ? ADC_WINDOW_ABOVE : ADC_WINDOW_BELOW));
+        read++;
+    }
+    adc_window_get_stats(&stats);
+    adc_window_free();
+
+    ADC_WINDOW_CHECK((ADC_WINDOW_EVENTS - 1u) == read, "a full queue keeps its alarms");
+    ADC_WINDOW_CHECK(ordered, "the queue keeps the oldest alarms in order");
+    ADC_WINDOW_CHECK((40u - read) == stats.dropped, "the alarms past a full queue are counted");
+    ADC_WINDOW_CHECK(40u == stats.interrupts, "each crossing interrupts once");
+}
+
+/*******************************************************************************
+* Function Name: adc_window_check_params
+********************************************************************************
+* Summary:
+*  Checks the parameter errors of the init and of the limit change.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void adc_window_check_params(void)
+{
+    adc_window_channel_t channel = { ADC_WINDOW_POT_INPUT, 2000u, 1000u };
+    adc_window_channel_t channels[ADC_WINDOW_CHANNELS + 1u];
+
+    ADC_WINDOW_CHECK(ADC_WINDOW_RSLT_ERR_PARAM == adc_window_init(&channel, 1u), "low above high is refused");
+    channel.high = ADC_WINDOW_FULL_SCALE + 1u;
+    ADC_WINDOW_CHECK(ADC_WINDOW_RSLT_ERR_PARAM == adc_window_init(&channel, 1u), "high past the scale is refused");
+    channel.low = 1000u;
+    channel.high = 2000u;
+    ADC_WINDOW_CHECK(ADC_WINDOW_RSLT_ERR_PARAM == adc_window_init(&channel, 0u), "no channel is refused");
+    for (uint32_t index = 0u; index <= ADC_WINDOW_CHANNELS; index++)
+    {
+        channels[index] = channel;
+    }
+    ADC_WINDOW_CHECK(ADC_WINDOW_RSLT_ERR_PARAM == adc_window_init(channels, ADC_WINDOW_CHANNELS + 1u),
+                     "too many channels are refused");
+
+    ADC_WINDOW_CHECK(CY_RSLT_SUCCESS == adc_window_init(&channel, 1u), "init of the window");
+    ADC_WINDOW_CHECK(ADC_WINDOW_RSLT_ERR_PARAM == adc_window_init(&channel, 1u), "a second init is refused");
+    ADC_WINDOW_CHECK(ADC_WINDOW_RSLT_ERR_PARAM == adc_window_set_limits(1u, 1000u, 2000u),
+                     "limits of an unused channel are refused");
+    ADC_WINDOW_CHECK(ADC_WINDOW_RSLT_ERR_PARAM == adc_window_set_limits(0u, 2000u, 1000u),
+                     "limits with low above high are refused");
+    adc_window_free();
+    ADC_WINDOW_CHECK(CY_RSLT_SUCCESS == adc_window_init(&channel, 1u), "init after the free");
+    adc_window_free();
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the cases. The SAR model converts once per adc_window_check_convert()
+*  and runs the range interrupts in the call, without the simulation thread.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if all checks pass, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    adc_window_check_params();
+    adc_window_check_waves();
+    adc_window_check_limits();
+    adc_window_check_queue();
+
+    printf("adc_window_check: %u cases, %u failures\n", adc_window_check_cases, adc_window_check_failures);
+
+    return (0u == adc_window_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
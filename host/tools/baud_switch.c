@@ -0,0 +1,427 @@
+/*******************************************************************************
+* File Name:   baud_switch.c
+*
+* Description: PC end of the console baud-rate handshake (console_baud.h).
+*              Switches a serial port and the CM7_0 parameter console to a
+*              higher rate together, optionally measures the throughput of the
+*              console at the new rate. Runs on Linux against the kit's
+*              USB-UART bridge or the pseudo-terminal of the host simulation.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "console_baud.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BAUD_SWITCH_DEFAULT_FROM    (115200u)
+
+/* Pause between two polls of the handshake */
+#define BAUD_SWITCH_POLL_US         (1000u)
+
+/* Longest wait for the summary line of the throughput test */
+#define BAUD_SWITCH_STREAM_TIMEOUT_MS   (30000u)
+
+/* Line of the throughput test: "<7-digit number> <pattern>\r\n" */
+#define BAUD_SWITCH_STREAM_LINE     (64u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t baud_switch_now_ms(void);
+static uint32_t baud_switch_set_baud(void *arg, uint32_t baud);
+static void baud_switch_write(void *arg, const char *text, uint32_t length);
+static bool baud_switch_tx_idle(void *arg);
+static bool baud_switch_run(int fd, uint32_t from, uint32_t to);
+static int baud_switch_stream(int fd, uint32_t bytes);
+static bool baud_switch_stream_line(const char *line, uint32_t length, uint32_t *number);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Rates of the termios interface, the highest first for "auto" */
+static const struct
+{
+    speed_t  speed;
+    uint32_t baud;
+} baud_switch_rates[] =
+{
+    { B3000000, 3000000u }, { B2000000, 2000000u }, { B1500000, 1500000u },
+    { B1000000, 1000000u }, { B921600, 921600u }, { B460800, 460800u },
+    { B230400, 230400u }, { B115200, 115200u }, { B57600, 57600u },
+    { B38400, 38400u }, { B19200, 19200u }, { B9600, 9600u },
+};
+
+#define BAUD_SWITCH_RATE_NUM        (sizeof(baud_switch_rates) / sizeof(baud_switch_rates[0]))
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  baud_switch <port> <rate|auto> [from <rate>] [stream <bytes>]
+*  The parameter console (demo 9) must be running. "auto" tries the rates
+*  from 3 Mbaud down and keeps the first one both ends agree on.
+*
+* Parameters:
+*  argc: number of arguments
+*  argv: arguments
+*
+* Return:
+*  int: 0 on success
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    struct termios settings;
+    uint32_t from = BAUD_SWITCH_DEFAULT_FROM;
+    uint32_t stream = 0u;
+    bool automatic;
+    bool done = false;
+    int fd;
+
+    if ((argc < 3) || (0 != ((argc - 3) % 2)))
+    {
+        fprintf(stderr, "usage: %s <port> <rate|auto> [from <rate>] [stream <bytes>]\n", argv[0]);
+        return 2;
+    }
+    for (int arg = 3; arg < argc; arg += 2)
+    {
+        if (0 == strcmp(argv[arg], "from"))
+        {
+            from = (uint32_t)strtoul(argv[arg + 1], NULL, 0);
+        }
+        else if (0 == strcmp(argv[arg], "stream"))
+        {
+            stream = (uint32_t)strtoul(argv[arg + 1], NULL, 0);
+        }
+    }
+    automatic = (0 == strcmp(argv[2], "auto"));
+
+    fd = open(argv[1], O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if ((fd < 0) || (0 != tcgetattr(fd, &settings)))
+    {
+        fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+        return 1;
+    }
+    cfmakeraw(&settings);
+    settings.c_cc[VMIN] = 0;
+    settings.c_cc[VTIME] = 0;
+    (void)tcsetattr(fd, TCSANOW, &settings);
+    if (from != baud_switch_set_baud(&fd, from))
+    {
+        fprintf(stderr, "%s: %lu baud not supported\n", argv[1], (unsigned long)from);
+        return 1;
+    }
+
+    /* Escape clears a partly typed line of the parameter console */
+    baud_switch_write(&fd, "\x1b", 1u);
+    (void)tcflush(fd, TCIFLUSH);
+
+    if (automatic)
+    {
+        for (uint32_t index = 0u; (index < BAUD_SWITCH_RATE_NUM) && !done; index++)
+        {
+            if (baud_switch_rates[index].baud > from)
+            {
+                done = baud_switch_run(fd, from, baud_switch_rates[index].baud);
+            }
+        }
+    }
+    else
+    {
+        done = baud_switch_run(fd, from, (uint32_t)strtoul(argv[2], NULL, 0));
+    }
+
+    if (done && (0u != stream))
+    {
+        return baud_switch_stream(fd, stream);
+    }
+
+    return done ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: baud_switch_run
+********************************************************************************
+* Summary:
+*  Runs one handshake.
+*
+* Parameters:
+*  fd: serial port
+*  from: current rate
+*  to: requested rate
+*
+* Return:
+*  bool: true if both ends run at the new rate
+*
+*******************************************************************************/
+static bool baud_switch_run(int fd, uint32_t from, uint32_t to)
+{
+    static const char *const errors[] = { "", "rate not supported", "timeout", "refused by the device" };
+    const console_baud_port_t port =
+    {
+        .set_baud = baud_switch_set_baud,
+        .write    = baud_switch_write,
+        .tx_idle  = baud_switch_tx_idle,
+        .arg      = &fd,
+    };
+    console_baud_t handshake;
+    uint8_t buffer[64];
+    ssize_t count;
+
+    console_baud_pc_start(&handshake, &port, from, to, baud_switch_now_ms());
+    while (CONSOLE_BAUD_SYNC >= console_baud_poll(&handshake, baud_switch_now_ms()))
+    {
+        count = read(fd, buffer, sizeof(buffer));
+        for (ssize_t index = 0; index < count; index++)
+        {
+            console_baud_rx(&handshake, buffer[index]);
+        }
+        if (count <= 0)
+        {
+            (void)usleep(BAUD_SWITCH_POLL_US);
+        }
+    }
+
+    if (CONSOLE_BAUD_DONE == handshake.state)
+    {
+        printf("%lu baud\n", (unsigned long)to);
+        return true;
+    }
+    printf("%lu baud failed: %s\n", (unsigned long)to, errors[handshake.error]);
+
+    /* Let the device time out and report FAIL at the old rate */
+    (void)usleep(CONSOLE_BAUD_SYNC_MS * 1000u);
+    (void)tcflush(fd, TCIFLUSH);
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: baud_switch_stream
+********************************************************************************
+* Summary:
+*  Runs the "stream" command of the parameter console and checks the
+*  numbered lines: a garbled or a missing line counts as an error.
+*  Prints the throughput seen by the PC and the summary of the device.
+*
+* Parameters:
+*  fd: serial port
+*  bytes: bytes to request
+*
+* Return:
+*  int: 0 if every line arrived intact
+*
+*******************************************************************************/
+static int baud_switch_stream(int fd, uint32_t bytes)
+{
+    char command[32];
+    char line[128];
+    uint32_t length = 0u;
+    uint32_t expected = 0u;
+    uint32_t number;
+    uint32_t good = 0u;
+    uint32_t bad = 0u;
+    uint32_t first_ms = 0u;
+    uint32_t last_ms = 0u;
+    uint32_t start = baud_switch_now_ms();
+    bool summary = false;
+    uint8_t data;
+    int written;
+
+    written = snprintf(command, sizeof(command), "stream %lu\r", (unsigned long)bytes);
+    baud_switch_write(&fd, command, (uint32_t)written);
+
+    while (!summary && ((baud_switch_now_ms() - start) < BAUD_SWITCH_STREAM_TIMEOUT_MS))
+    {
+        if (1 != read(fd, &data, 1u))
+        {
+            (void)usleep(BAUD_SWITCH_POLL_US);
+            continue;
+        }
+        if ('\n' != data)
+        {
+            if (length < (sizeof(line) - 1u))
+            {
+                line[length++] = (char)data;
+            }
+            continue;
+        }
+
+        line[length] = '\0';
+        if (0 == strncmp(line, "Sent ", 5u))
+        {
+            printf("device: %s\n", line);
+            summary = true;
+        }
+        else if (baud_switch_stream_line(line, length, &number))
+        {
+            if (0u == good + bad)
+            {
+                first_ms = baud_switch_now_ms();
+            }
+            last_ms = baud_switch_now_ms();
+            good++;
+            /* Lines lost before this one */
+            bad += (number > expected) ? (number - expected) : 0u;
+            expected = number + 1u;
+        }
+        else if ((0u != good + bad) && (0u != length))
+        {
+            last_ms = baud_switch_now_ms();
+            bad++;
+        }
+        length = 0u;
+    }
+
+    printf("PC: %lu lines intact, %lu with errors", (unsigned long)good, (unsigned long)bad);
+    if ((good > 1u) && (last_ms > first_ms))
+    {
+        printf(", %lu B/s", (unsigned long)(((uint64_t)(good - 1u) * BAUD_SWITCH_STREAM_LINE * 1000u) /
+                                           (last_ms - first_ms)));
+    }
+    printf("%s\n", summary ? "" : ", no summary");
+
+    return (summary && (0u == bad)) ? 0 : 1;
+}
+
+/* True for an intact "<7-digit number> <pattern>\r" line, without "\n" */
+static bool baud_switch_stream_line(const char *line, uint32_t length, uint32_t *number)
+{
+    char *end;
+
+    if ((length != (BAUD_SWITCH_STREAM_LINE - 1u)) || ('\r' != line[length - 1u]) || (' ' != line[7]))
+    {
+        return false;
+    }
+    *number = (uint32_t)strtoul(line, &end, 10);
+    if (end != &line[7])
+    {
+        return false;
+    }
+    for (uint32_t index = 8u; index < (BAUD_SWITCH_STREAM_LINE - 2u); index++)
+    {
+        if (line[index] != (char)('A' + ((*number + index) % 26u)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static uint32_t baud_switch_now_ms(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)((now.tv_sec * 1000) + (now.tv_nsec / 1000000));
+}
+
+/*******************************************************************************
+* Function Name: baud_switch_set_baud
+********************************************************************************
+* Summary:
+*  Switches the serial port once the characters written have left.
+*
+* Parameters:
+*  arg: file descriptor of the port
+*  baud: requested rate
+*
+* Return:
+*  uint32_t: rate set, 0 if termios does not have it
+*
+*******************************************************************************/
+static uint32_t baud_switch_set_baud(void *arg, uint32_t baud)
+{
+    int fd = *(int *)arg;
+    struct termios settings;
+
+    for (uint32_t index = 0u; index < BAUD_SWITCH_RATE_NUM; index++)
+    {
+        if ((baud_switch_rates[index].baud == baud) && (0 == tcgetattr(fd, &settings)) &&
+            (0 == cfsetspeed(&settings, baud_switch_rates[index].speed)) &&
+            (0 == tcsetattr(fd, TCSADRAIN, &settings)))
+        {
+            return baud;
+        }
+    }
+
+    return 0u;
+}
+
+static void baud_switch_write(void *arg, const char *text, uint32_t length)
+{
+    int fd = *(int *)arg;
+    ssize_t written;
+
+    while (0u != length)
+    {
+        written = write(fd, text, length);
+        if (written > 0)
+        {
+            text += written;
+            length -= (uint32_t)written;
+        }
+        else
+        {
+            (void)usleep(BAUD_SWITCH_POLL_US);
+        }
+    }
+}
+
+/* Writes are drained by set_baud, with TCSADRAIN */
+static bool baud_switch_tx_idle(void *arg)
+{
+    (void)arg;
+    return true;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,492 @@
+/*******************************************************************************
+* File Name:   deadline_check.c
+*
+* Description: Host check of the deadline accounting of the watchdog service
+*              (deadline.h). Runs fixed cases for single runs, budgets,
+*              nesting, check-ins, pauses, counter wrap and misuse, then
+*              random sequences against a reference model that adds the
+*              elapsed time to the innermost run instead of moving the start
+*              times. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "deadline.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define DEADLINE_CHECK_PRINT        (10u)
+
+/* Random sequences, their operations and tasks */
+#define DEADLINE_CHECK_SEQUENCES    (2000u)
+#define DEADLINE_CHECK_STEPS        (500u)
+#define DEADLINE_CHECK_TASKS        (6u)
+
+#define DEADLINE_CHECK(condition, what) \
+    deadline_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Reference model: each run keeps the time spent in it, outside the runs
+ * nested in it and the pauses */
+typedef struct
+{
+    deadline_task_t task[DEADLINE_MAX_TASKS];
+    uint32_t        task_count;
+    uint32_t        depth;
+    uint32_t        running[DEADLINE_MAX_DEPTH];
+    uint32_t        own_us[DEADLINE_MAX_DEPTH];
+    uint32_t        overflows;
+    bool            paused;
+} deadline_model_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void deadline_check_expect(bool condition, const char *what, int line);
+static void deadline_check_fixed(void);
+static void deadline_model_init(deadline_model_t *model, const uint32_t *budget_us, uint32_t count);
+static bool deadline_model_begin(deadline_model_t *model, uint32_t task);
+static bool deadline_model_end(deadline_model_t *model, uint32_t task, deadline_miss_t *miss);
+static void deadline_check_random(uint32_t seed);
+static uint32_t deadline_check_rand(uint32_t *state);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t deadline_check_cases = 0u;
+static uint32_t deadline_check_failures = 0u;
+
+
+/* Counts a check and prints the first failures */
+static void deadline_check_expect(bool condition, const char *what, int line)
+{
+    deadline_check_cases++;
+    if (!condition)
+    {
+        deadline_check_failures++;
+        if (deadline_check_failures <= DEADLINE_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: deadline_check_fixed
+********************************************************************************
+* Summary:
+*  Checks the accounting on hand-written sequences.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void deadline_check_fixed(void)
+{
+    static const uint32_t budget_us[] = { 1000u, 200u, 50u, 10u, 5u };
+    deadline_monitor_t monitor;
+    deadline_miss_t miss;
+
+    /* A run within its budget, then one just over it */
+    deadline_init(&monitor, budget_us, 5u);
+    DEADLINE_CHECK(deadline_begin(&monitor, 0u, 100u), "begin");
+    DEADLINE_CHECK(deadline_end(&monitor, 0u, 1100u, &miss), "run of exactly the budget is in time");
+    DEADLINE_CHECK(DEADLINE_NO_TASK == miss.task, "no miss reported");
+    DEADLINE_CHECK(deadline_begin(&monitor, 0u, 2000u), "begin again");
+    DEADLINE_CHECK(!deadline_end(&monitor, 0u, 3001u, &miss), "run over the budget misses");
+    DEADLINE_CHECK((0u == miss.task) && (1001u == miss.ran_us) && (1000u == miss.budget_us), "miss record");
+    DEADLINE_CHECK((2u == monitor.task[0].runs) && (1u == monitor.task[0].misses) &&
+                   (1001u == monitor.task[0].longest_us), "task statistics");
+    DEADLINE_CHECK(0u == monitor.depth, "no run left");
+
+    /* A nested run stops the clock of the outer one */
+    deadline_init(&monitor, budget_us, 5u);
+    (void)deadline_begin(&monitor, 1u, 0u);
+    (void)deadline_begin(&monitor, 0u, 10u);
+    DEADLINE_CHECK(deadline_check(&monitor, 900u, &miss) && (0u == miss.task) && (890u == miss.ran_us),
+                   "check sees the innermost run");
+    DEADLINE_CHECK(deadline_end(&monitor, 0u, 910u, NULL), "inner run in time");
+    DEADLINE_CHECK(deadline_check(&monitor, 950u, &miss) && (1u == miss.task) && (50u == miss.ran_us),
+                   "outer run excludes the inner one");
+    DEADLINE_CHECK(deadline_end(&monitor, 1u, 1000u, &miss), "outer run in time despite the inner run");
+    DEADLINE_CHECK(100u == monitor.task[1].longest_us, "outer run time");
+
+    /* Three levels: the outermost run excludes both nested runs */
+    deadline_init(&monitor, budget_us, 5u);
+    (void)deadline_begin(&monitor, 0u, 0u);
+    (void)deadline_begin(&monitor, 1u, 10u);
+    (void)deadline_begin(&monitor, 2u, 20u);
+    (void)deadline_end(&monitor, 2u, 120u, NULL);
+    (void)deadline_end(&monitor, 1u, 130u, NULL);
+    (void)deadline_end(&monitor, 0u, 140u, NULL);
+    DEADLINE_CHECK((100u == monitor.task[2].longest_us) && (20u == monitor.task[1].longest_us) &&
+                   (20u == monitor.task[0].longest_us), "three nested runs");
+
+    /* Ending the outer run ends the runs inside it, the innermost miss is
+     * the one reported */
+    deadline_init(&monitor, budget_us, 5u);
+    (void)deadline_begin(&monitor, 0u, 0u);
+    (void)deadline_begin(&monitor, 1u, 0u);
+    (void)deadline_begin(&monitor, 2u, 0u);
+    DEADLINE_CHECK(!deadline_check(&monitor, 300u, &miss) && (2u == miss.task), "innermost run over budget");
+    DEADLINE_CHECK(!deadline_end(&monitor, 0u, 300u, &miss), "popped runs missed");
+    DEADLINE_CHECK((2u == miss.task) && (300u == miss.ran_us) && (50u == miss.budget_us), "innermost miss");
+    DEADLINE_CHECK((1u == monitor.task[0].runs) && (1u == monitor.task[1].runs) && (1u == monitor.task[2].runs) &&
+                   (0u == monitor.task[0].misses) && (0u == monitor.task[1].misses) &&
+                   (1u == monitor.task[2].misses), "each popped run accounted");
+    DEADLINE_CHECK((0u == monitor.task[1].longest_us) && (0u == monitor.task[0].longest_us),
+                   "popped outer runs exclude the inner ones");
+    DEADLINE_CHECK(0u == monitor.depth, "all runs ended");
+
+    /* Ending a task that is not running changes nothing */
+    DEADLINE_CHECK(deadline_end(&monitor, 3u, 400u, &miss) && (DEADLINE_NO_TASK == miss.task),
+                   "end of a task not running");
+    (void)deadline_begin(&monitor, 0u, 500u);
+    DEADLINE_CHECK(deadline_end(&monitor, 1u, 600u, NULL) && (1u == monitor.depth), "end of another task");
+    (void)deadline_end(&monitor, 0u, 600u, NULL);
+
+    /* Check-ins of a periodic task */
+    deadline_init(&monitor, budget_us, 5u);
+    DEADLINE_CHECK(deadline_checkin(&monitor, 1u, 0u, &miss) && (0u == monitor.task[1].runs),
+                   "first check-in starts a run");
+    DEADLINE_CHECK(deadline_checkin(&monitor, 1u, 150u, &miss) && (1u == monitor.task[1].runs),
+                   "check-in in time");
+    DEADLINE_CHECK(!deadline_checkin(&monitor, 1u, 400u, &miss) && (250u == miss.ran_us),
+                   "check-in over budget");
+    DEADLINE_CHECK((1u == monitor.depth) && (2u == monitor.task[1].runs), "check-in restarts the run");
+
+    /* A pause does not count against the runs */
+    deadline_init(&monitor, budget_us, 5u);
+    (void)deadline_begin(&monitor, 2u, 0u);
+    deadline_pause(&monitor, 40u);
+    DEADLINE_CHECK(deadline_check(&monitor, 100000u, &miss) && (40u == miss.ran_us), "clock stands during pause");
+    deadline_pause(&monitor, 500u);
+    deadline_resume(&monitor, 100000u);
+    deadline_resume(&monitor, 200000u);
+    DEADLINE_CHECK(deadline_end(&monitor, 2u, 100010u, &miss), "pause excluded");
+    DEADLINE_CHECK(50u == monitor.task[2].longest_us, "run time around the pause");
+    deadline_pause(&monitor, 100020u);
+    (void)deadline_begin(&monitor, 2u, 100030u);
+    deadline_resume(&monitor, 200000u);
+    DEADLINE_CHECK(deadline_check(&monitor, 200050u, &miss) && (50u == miss.ran_us), "run begun while paused");
+
+    /* The microsecond counter wraps */
+    deadline_init(&monitor, budget_us, 5u);
+    (void)deadline_begin(&monitor, 0u, 0xFFFFFF00u);
+    (void)deadline_begin(&monitor, 1u, 0xFFFFFFF0u);
+    DEADLINE_CHECK(deadline_end(&monitor, 1u, 0x00000050u, NULL) && (0x60u == monitor.task[1].longest_us),
+                   "inner run across the wrap");
+    DEADLINE_CHECK(deadline_end(&monitor, 0u, 0x00000300u, NULL) && (0x3A0u == monitor.task[0].longest_us),
+                   "outer run across the wrap");
+
+    /* Misuse: unknown task, task already running, runs nested too deep */
+    deadline_init(&monitor, budget_us, 5u);
+    DEADLINE_CHECK(!deadline_begin(&monitor, 5u, 0u), "unknown task");
+    DEADLINE_CHECK(!deadline_begin(&monitor, DEADLINE_NO_TASK, 0u), "no task");
+    for (uint32_t task = 0u; task < DEADLINE_MAX_DEPTH; task++)
+    {
+        DEADLINE_CHECK(deadline_begin(&monitor, task, 0u), "nested begin");
+    }
+    DEADLINE_CHECK(!deadline_begin(&monitor, 0u, 0u), "task already running");
+    DEADLINE_CHECK(!deadline_begin(&monitor, 4u, 0u) && (1u == monitor.overflows), "nested too deep");
+    DEADLINE_CHECK(deadline_end(&monitor, 4u, 0u, NULL) && (DEADLINE_MAX_DEPTH == monitor.depth),
+                   "end of a run not timed");
+
+    /* More tasks than the monitor keeps */
+    {
+        uint32_t many_us[DEADLINE_MAX_TASKS + 2u] = { 0u };
+
+        deadline_init(&monitor, many_us, DEADLINE_MAX_TASKS + 2u);
+        DEADLINE_CHECK(DEADLINE_MAX_TASKS == monitor.task_count, "task count capped");
+    }
+}
+
+/*******************************************************************************
+* Function Name: deadline_model_begin
+********************************************************************************
+* Summary:
+*  Reference model of deadline_begin().
+*
+* Parameters:
+*  model: model
+*  task: task index
+*
+* Return:
+*  bool: as deadline_begin()
+*
+*******************************************************************************/
+static bool deadline_model_begin(deadline_model_t *model, uint32_t task)
+{
+    if (task >= model->task_count)
+    {
+        return false;
+    }
+    for (uint32_t level = 0u; level < model->depth; level++)
+    {
+        if (task == model->running[level])
+        {
+            return false;
+        }
+    }
+    if (model->depth >= DEADLINE_MAX_DEPTH)
+    {
+        model->overflows++;
+        return false;
+    }
+    model->running[model->depth] = task;
+    model->own_us[model->depth] = 0u;
+    model->depth++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: deadline_model_end
+********************************************************************************
+* Summary:
+*  Reference model of deadline_end().
+*
+* Parameters:
+*  model: model
+*  task: task index
+*  miss: receives the innermost run over budget
+*
+* Return:
+*  bool: as deadline_end()
+*
+*******************************************************************************/
+static bool deadline_model_end(deadline_model_t *model, uint32_t task, deadline_miss_t *miss)
+{
+    bool found = false;
+    bool in_time = true;
+
+    miss->task = DEADLINE_NO_TASK;
+    miss->ran_us = 0u;
+    miss->budget_us = 0u;
+    for (uint32_t level = 0u; level < model->depth; level++)
+    {
+        found = found || (task == model->running[level]);
+    }
+    while (found && (0u != model->depth))
+    {
+        uint32_t level = model->depth - 1u;
+        deadline_task_t *run_task = &model->task[model->running[level]];
+        uint32_t ran_us = model->own_us[level];
+
+        run_task->runs++;
+        if (ran_us > run_task->longest_us)
+        {
+            run_task->longest_us = ran_us;
+        }
+        if (ran_us > run_task->budget_us)
+        {
+            run_task->misses++;
+            if (in_time)
+            {
+                miss->task = model->running[level];
+                miss->ran_us = ran_us;
+                miss->budget_us = run_task->budget_us;
+            }
+            in_time = false;
+        }
+        model->depth = level;
+        found = (task != model->running[level]);
+    }
+
+    return in_time;
+}
+
+/* Reference model of deadline_init() */
+static void deadline_model_init(deadline_model_t *model, const uint32_t *budget_us, uint32_t count)
+{
+    memset(model, 0, sizeof(*model));
+    model->task_count = count;
+    for (uint32_t task = 0u; task < count; task++)
+    {
+        model->task[task].budget_us = budget_us[task];
+    }
+}
+
+/* xorshift32, so that a failing seed can be replayed */
+static uint32_t deadline_check_rand(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/*******************************************************************************
+* Function Name: deadline_check_random
+********************************************************************************
+* Summary:
+*  Applies one random sequence of operations and time steps to the monitor
+*  and the model, and compares them after each operation.
+*
+* Parameters:
+*  seed: seed of the sequence, not 0
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void deadline_check_random(uint32_t seed)
+{
+    uint32_t state = seed;
+    uint32_t budget_us[DEADLINE_CHECK_TASKS];
+    deadline_monitor_t monitor;
+    deadline_model_t model;
+    deadline_miss_t miss;
+    deadline_miss_t model_miss;
+    /* Start close to the wrap of the counter in one sequence out of four */
+    uint32_t now_us = ((seed & 3u) == 0u) ? (0u - (deadline_check_rand(&state) % 100000u))
+                                          : deadline_check_rand(&state);
+    bool failed = false;
+
+    for (uint32_t task = 0u; task < DEADLINE_CHECK_TASKS; task++)
+    {
+        budget_us[task] = 1u + (deadline_check_rand(&state) % 2000u);
+    }
+    deadline_init(&monitor, budget_us, DEADLINE_CHECK_TASKS);
+    deadline_model_init(&model, budget_us, DEADLINE_CHECK_TASKS);
+
+    for (uint32_t step = 0u; (step < DEADLINE_CHECK_STEPS) && !failed; step++)
+    {
+        uint32_t choice = deadline_check_rand(&state) % 16u;
+        /* One task more than the monitor has, to exercise the refusals */
+        uint32_t task = deadline_check_rand(&state) % (DEADLINE_CHECK_TASKS + 1u);
+        uint32_t elapsed_us = deadline_check_rand(&state) % 700u;
+        bool result = true;
+        bool expected = true;
+        bool check;
+        bool model_check;
+
+        if (choice < 5u)
+        {
+            result = deadline_begin(&monitor, task, now_us);
+            expected = deadline_model_begin(&model, task);
+        }
+        else if (choice < 9u)
+        {
+            result = deadline_end(&monitor, task, now_us, &miss);
+            expected = deadline_model_end(&model, task, &model_miss);
+            failed = (miss.task != model_miss.task) || (miss.ran_us != model_miss.ran_us);
+        }
+        else if (choice < 12u)
+        {
+            result = deadline_checkin(&monitor, task, now_us, &miss);
+            expected = deadline_model_end(&model, task, &model_miss);
+            (void)deadline_model_begin(&model, task);
+            failed = (miss.task != model_miss.task) || (miss.ran_us != model_miss.ran_us);
+        }
+        else if (choice < 13u)
+        {
+            deadline_pause(&monitor, now_us);
+            model.paused = true;
+        }
+        else if (choice < 14u)
+        {
+            deadline_resume(&monitor, now_us);
+            model.paused = false;
+        }
+
+        /* Time passes; only the innermost run of the model advances */
+        now_us += elapsed_us;
+        if (!model.paused && (0u != model.depth))
+        {
+            model.own_us[model.depth - 1u] += elapsed_us;
+        }
+
+        check = deadline_check(&monitor, now_us, &miss);
+        model_check = (0u == model.depth) ||
+                      (model.own_us[model.depth - 1u] <= model.task[model.running[model.depth - 1u]].budget_us);
+        failed = failed || (result != expected) || (check != model_check) || (monitor.depth != model.depth) ||
+                 (monitor.overflows != model.overflows) ||
+                 ((0u != model.depth) && (miss.ran_us != model.own_us[model.depth - 1u])) ||
+                 (0 != memcmp(monitor.task, model.task, sizeof(model.task)));
+        for (uint32_t level = 0u; level < model.depth; level++)
+        {
+            failed = failed || (monitor.running[level] != model.running[level]);
+        }
+    }
+
+    DEADLINE_CHECK(!failed, "random sequence matches the model");
+    if (failed && (deadline_check_failures <= DEADLINE_CHECK_PRINT))
+    {
+        printf("     seed %u\n", seed);
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the fixed cases and the random sequences.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if all checks pass, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    deadline_check_fixed();
+    for (uint32_t seed = 1u; seed <= DEADLINE_CHECK_SEQUENCES; seed++)
+    {
+        deadline_check_random(seed * 2654435761u);
+    }
+
+    printf("deadline_check: %u cases, %u failures\n", deadline_check_cases, deadline_check_failures);
+
+    return (0u == deadline_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
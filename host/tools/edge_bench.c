@@ -0,0 +1,458 @@
+/*******************************************************************************
+* File Name:   edge_bench.c
+*
+* Description: Host benchmark of the edge statistics of the GPIO edge
+*              capture. "gen" writes a synthetic edge stream in the format
+*              of the 'x' export of the GPIO interrupt demo; given a stream,
+*              recorded on the kit, in the host simulation or generated, the
+*              tool pairs the edges into periods as the capture handler does
+*              and reduces them with edge_stats.c and with a plain loop over
+*              an array of periods, reports the time per period of both and
+*              fails if they disagree.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "edge_stats.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Timestamp clock without a clock_hz header, that of the capture counter */
+#define EDGE_BENCH_CLOCK_HZ         (100000000u)
+
+/* Longest line of a stream */
+#define EDGE_BENCH_LINE_SIZE        (256u)
+
+/* Reductions timed, and the least number of periods reduced in total */
+#define EDGE_BENCH_ROUNDS           (16u)
+#define EDGE_BENCH_MIN_PERIODS      (4000000u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* One period of the reference, the edges side by side */
+typedef struct
+{
+    uint32_t rise;
+    uint32_t fall;
+    uint32_t next;
+} edge_bench_period_t;
+
+/* Periods of a stream, one array per edge as read from the capture ring */
+typedef struct
+{
+    uint32_t *rise;
+    uint32_t *fall;
+    uint32_t *next;
+    edge_bench_period_t *periods;
+    uint32_t count;
+    uint32_t size;
+    uint32_t edges;
+    uint32_t missed;
+} edge_bench_stream_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void edge_bench_usage(void);
+static int edge_bench_gen(uint32_t periods, uint32_t period, uint32_t high, uint32_t jitter, uint32_t seed);
+static bool edge_bench_push(edge_bench_stream_t *stream, uint32_t rise, uint32_t fall, uint32_t next);
+static bool edge_bench_load(const char *path, edge_bench_stream_t *stream, uint32_t *clock_hz);
+static void edge_bench_reference(const edge_bench_period_t *periods, uint32_t count, edge_stats_t *stats);
+static double edge_bench_now_ns(void);
+static int edge_bench_run(const char *path);
+
+
+static void edge_bench_usage(void)
+{
+    fprintf(stderr,
+            "usage: edge_bench gen <periods> <period> <high> <jitter> [<seed>]\n"
+            "       edge_bench <stream>\n"
+            "gen writes a stream with the period and high time in ticks, each edge moved by up to jitter ticks.\n"
+            "A stream has one r,<ticks> or f,<ticks> line per edge, as exported by 'x' in the GPIO interrupt\n"
+            "demo; other lines are ignored, so a whole console log can be given.\n");
+}
+
+/*******************************************************************************
+* Function Name: edge_bench_gen
+********************************************************************************
+* Summary:
+*  Writes a synthetic edge stream to stdout, starting shortly before the
+*  32-bit timestamps wrap.
+*
+* Parameters:
+*  periods: number of periods
+*  period: period, ticks
+*  high: high time, ticks, above jitter and below period - jitter
+*  jitter: largest delay of an edge, ticks
+*  seed: seed of the jitter
+*
+* Return:
+*  int: exit status, 0
+*
+*******************************************************************************/
+static int edge_bench_gen(uint32_t periods, uint32_t period, uint32_t high, uint32_t jitter, uint32_t seed)
+{
+    uint32_t time = 0u - ((periods / 2u) * period);
+
+    srand(seed);
+    printf("# edges clock_hz=%lu periods=%lu\n", (unsigned long)EDGE_BENCH_CLOCK_HZ, (unsigned long)periods);
+    for (uint32_t index = 0u; index < periods; index++)
+    {
+        uint32_t delay = (0u != jitter) ? ((uint32_t)rand() % (jitter + 1u)) : 0u;
+
+        printf("r,%lu\n", (unsigned long)(time + delay));
+        delay = (0u != jitter) ? ((uint32_t)rand() % (jitter + 1u)) : 0u;
+        printf("f,%lu\n", (unsigned long)(time + high + delay));
+        time += period;
+    }
+    printf("r,%lu\n", (unsigned long)time);
+
+    return 0;
+}
+
+/* Appends a period, growing the arrays */
+static bool edge_bench_push(edge_bench_stream_t *stream, uint32_t rise, uint32_t fall, uint32_t next)
+{
+    if (stream->count == stream->size)
+    {
+        uint32_t size = (0u != stream->size) ? (stream->size * 2u) : 4096u;
+        uint32_t *grown_rise = realloc(stream->rise, size * sizeof(uint32_t));
+        uint32_t *grown_fall = (NULL != grown_rise) ? realloc(stream->fall, size * sizeof(uint32_t)) : NULL;
+        uint32_t *grown_next = (NULL != grown_fall) ? realloc(stream->next, size * sizeof(uint32_t)) : NULL;
+        edge_bench_period_t *grown_periods =
+            (NULL != grown_next) ? realloc(stream->periods, size * sizeof(edge_bench_period_t)) : NULL;
+
+        stream->rise = (NULL != grown_rise) ? grown_rise : stream->rise;
+        stream->fall = (NULL != grown_fall) ? grown_fall : stream->fall;
+        stream->next = (NULL != grown_next) ? grown_next : stream->next;
+        stream->periods = (NULL != grown_periods) ? grown_periods : stream->periods;
+        if (NULL == grown_periods)
+        {
+            return false;
+        }
+        stream->size = size;
+    }
+
+    stream->rise[stream->count] = rise;
+    stream->fall[stream->count] = fall;
+    stream->next[stream->count] = next;
+    stream->periods[stream->count].rise = rise;
+    stream->periods[stream->count].fall = fall;
+    stream->periods[stream->count].next = next;
+    stream->count++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: edge_bench_load
+********************************************************************************
+* Summary:
+*  Reads an edge stream and pairs its edges into periods like the capture
+*  handler: a rising edge ends the period of the last rising edge if a
+*  falling edge came between them, and two edges of the same direction in
+*  a row count as a missed edge.
+*
+* Parameters:
+*  path: stream file
+*  stream: receives the periods
+*  clock_hz: receives the timestamp clock of the header, if there is one
+*
+* Return:
+*  bool: false if the file cannot be read or memory runs out
+*
+*******************************************************************************/
+static bool edge_bench_load(const char *path, edge_bench_stream_t *stream, uint32_t *clock_hz)
+{
+    FILE *in = fopen(path, "r");
+    char line[EDGE_BENCH_LINE_SIZE];
+    bool have_rise = false;
+    bool have_fall = false;
+    uint32_t rise = 0u;
+    uint32_t fall = 0u;
+    bool ok = true;
+
+    if (NULL == in)
+    {
+        perror(path);
+        return false;
+    }
+
+    while (ok && (NULL != fgets(line, sizeof(line), in)))
+    {
+        const char *header = strstr(line, "clock_hz=");
+        char *end;
+        uint32_t time;
+
+        if ((NULL != header) && ('#' == line[0]))
+        {
+            *clock_hz = (uint32_t)strtoul(header + strlen("clock_hz="), NULL, 10);
+            continue;
+        }
+        if ((('r' != line[0]) && ('f' != line[0])) || (',' != line[1]))
+        {
+            continue;
+        }
+        time = (uint32_t)strtoul(&line[2], &end, 10);
+        if (end == &line[2])
+        {
+            continue;
+        }
+        stream->edges++;
+
+        if ('r' == line[0])
+        {
+            if (have_rise && have_fall)
+            {
+                ok = edge_bench_push(stream, rise, fall, time);
+            }
+            else if (have_rise)
+            {
+                stream->missed++;
+            }
+            rise = time;
+            have_rise = true;
+            have_fall = false;
+        }
+        else if (have_fall)
+        {
+            stream->missed++;
+            have_rise = false;
+            have_fall = false;
+        }
+        else if (have_rise)
+        {
+            fall = time;
+            have_fall = true;
+        }
+    }
+    fclose(in);
+
+    if (!ok)
+    {
+        fprintf(stderr, "edge_bench: out of memory\n");
+    }
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: edge_bench_reference
+********************************************************************************
+* Summary:
+*  Statistics of the periods with a plain loop: one period at a time, its
+*  edges next to each other in memory.
+*
+* Parameters:
+*  periods: periods
+*  count: number of periods
+*  stats: statistics, reset by the caller
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void edge_bench_reference(const edge_bench_period_t *periods, uint32_t count, edge_stats_t *stats)
+{
+    for (uint32_t index = 0u; index < count; index++)
+    {
+        uint32_t high = periods[index].fall - periods[index].rise;
+        uint32_t period = periods[index].next - periods[index].rise;
+
+        if (high < stats->high_min)
+        {
+            stats->high_min = high;
+        }
+        if (high > stats->high_max)
+        {
+            stats->high_max = high;
+        }
+        if (period < stats->period_min)
+        {
+            stats->period_min = period;
+        }
+        if (period > stats->period_max)
+        {
+            stats->period_max = period;
+        }
+        stats->high_total += high;
+        stats->period_total += period;
+        stats->periods++;
+    }
+}
+
+static double edge_bench_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double)now.tv_sec * 1e9) + (double)now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: edge_bench_run
+********************************************************************************
+* Summary:
+*  Reduces the periods of a stream with both reducers, repeated so that at
+*  least EDGE_BENCH_MIN_PERIODS periods are timed, and prints the statistics
+*  and the best time per period of each.
+*
+* Parameters:
+*  path: stream file
+*
+* Return:
+*  int: exit status, 0 if the reducers agree, 1 if they do not or the
+*  stream has no period
+*
+*******************************************************************************/
+static int edge_bench_run(const char *path)
+{
+    edge_bench_stream_t stream = { .count = 0u };
+    uint32_t clock_hz = EDGE_BENCH_CLOCK_HZ;
+    uint32_t repeat;
+    edge_stats_t stats;
+    edge_stats_t check;
+    double best_stats = 0.0;
+    double best_check = 0.0;
+    bool same;
+
+    if (!edge_bench_load(path, &stream, &clock_hz) || (0u == stream.count) || (0u == clock_hz))
+    {
+        fprintf(stderr, "edge_bench: no period in %s\n", path);
+        return 1;
+    }
+    repeat = (EDGE_BENCH_MIN_PERIODS / (EDGE_BENCH_ROUNDS * stream.count)) + 1u;
+
+    for (uint32_t round = 0u; round < EDGE_BENCH_ROUNDS; round++)
+    {
+        double start = edge_bench_now_ns();
+        double elapsed;
+
+        for (uint32_t pass = 0u; pass < repeat; pass++)
+        {
+            edge_stats_reset(&stats);
+            edge_stats_add(&stats, stream.rise, stream.fall, stream.next, stream.count);
+        }
+        elapsed = edge_bench_now_ns() - start;
+        best_stats = ((0u == round) || (elapsed < best_stats)) ? elapsed : best_stats;
+
+        start = edge_bench_now_ns();
+        for (uint32_t pass = 0u; pass < repeat; pass++)
+        {
+            edge_stats_reset(&check);
+            edge_bench_reference(stream.periods, stream.count, &check);
+        }
+        elapsed = edge_bench_now_ns() - start;
+        best_check = ((0u == round) || (elapsed < best_check)) ? elapsed : best_check;
+    }
+
+    same = (stats.periods == check.periods) && (stats.high_min == check.high_min) &&
+           (stats.high_max == check.high_max) && (stats.high_total == check.high_total) &&
+           (stats.period_min == check.period_min) && (stats.period_max == check.period_max) &&
+           (stats.period_total == check.period_total);
+
+    printf("%lu edges, %lu periods, %lu missed, clock %lu Hz\n", (unsigned long)stream.edges,
+           (unsigned long)stream.count, (unsigned long)stream.missed, (unsigned long)clock_hz);
+    printf("%lu Hz, duty %lu permille, high %lu/%lu/%lu ns, period %lu/%lu ns\n",
+           (unsigned long)edge_stats_frequency_hz(&stats, clock_hz),
+           (unsigned long)edge_stats_duty_permille(&stats),
+           (unsigned long)edge_stats_ticks_to_ns(stats.high_min, clock_hz),
+           (unsigned long)edge_stats_ticks_to_ns(stats.high_total / stats.periods, clock_hz),
+           (unsigned long)edge_stats_ticks_to_ns(stats.high_max, clock_hz),
+           (unsigned long)edge_stats_ticks_to_ns(stats.period_min, clock_hz),
+           (unsigned long)edge_stats_ticks_to_ns(stats.period_max, clock_hz));
+    printf("edge_stats %.3f ns/period, reference %.3f ns/period, %lu lanes, %s\n",
+           best_stats / ((double)repeat * stream.count), best_check / ((double)repeat * stream.count),
+           (unsigned long)EDGE_STATS_LANES, same ? "match" : "MISMATCH");
+
+    free(stream.rise);
+    free(stream.fall);
+    free(stream.next);
+    free(stream.periods);
+
+    return same ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs gen or the benchmark of a stream.
+*
+* Parameters:
+*  argc: argument count
+*  argv: arguments, see edge_bench_usage()
+*
+* Return:
+*  int: 0 on success, 1 on a mismatch or without period, 2 on a usage error
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    if ((argc >= 6) && (argc <= 7) && (0 == strcmp(argv[1], "gen")))
+    {
+        uint32_t period = (uint32_t)strtoul(argv[3], NULL, 0);
+        uint32_t high = (uint32_t)strtoul(argv[4], NULL, 0);
+        uint32_t jitter = (uint32_t)strtoul(argv[5], NULL, 0);
+
+        if ((high > jitter) && ((high + jitter) < period))
+        {
+            return edge_bench_gen((uint32_t)strtoul(argv[2], NULL, 0), period, high, jitter,
+                                  (7 == argc) ? (uint32_t)strtoul(argv[6], NULL, 0) : 1u);
+        }
+    }
+    else if ((2 == argc) && (0 != strcmp(argv[1], "gen")))
+    {
+        return edge_bench_run(argv[1]);
+    }
+
+    edge_bench_usage();
+
+    return 2;
+}
+
+
+/* [] END OF FILE */
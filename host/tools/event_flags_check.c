@@ -0,0 +1,505 @@
+/*******************************************************************************
+* File Name:   event_flags_check.c
+*
+* Description: Host check of the event-flag group of CM7_0 (event_flags.h).
+*              Runs fixed cases for set, clear, test, take, the waits and the
+*              idle hook, then threads that play interrupt handlers post their
+*              bits while the main thread takes them, sets and clears a bit of
+*              its own, and sleeps in the waits. The tool provides __WFE() and
+*              __SEV(), a model of the event register that reports a wait no
+*              event woke. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "event_flags.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define EVENT_FLAGS_CHECK_PRINT     (10u)
+
+/* Threads playing interrupt handlers, and their posts */
+#define EVENT_FLAGS_CHECK_PRODUCERS (4u)
+#define EVENT_FLAGS_CHECK_POSTS     (50000u)
+#define EVENT_FLAGS_CHECK_WAITS     (20000u)
+
+/* Bit set and cleared by the main thread between the takes */
+#define EVENT_FLAGS_CHECK_MAIN_BIT  (1UL << 31)
+
+/* A __WFE() sleeping this long was not woken by the __SEV() of a post. The
+ * check gives up after a few of them instead of sleeping on. */
+#define EVENT_FLAGS_CHECK_WAKE_MS   (200u)
+#define EVENT_FLAGS_CHECK_STUCK_MAX (5u)
+
+#define EVENT_FLAGS_CHECK(condition, what) \
+    event_flags_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Model of the event register of the core */
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t  cv;
+    bool            event;          /* Set by __SEV(), consumed by __WFE() */
+    uint32_t        waits;          /* __WFE() calls */
+    uint32_t        sleeps;         /* __WFE() calls that found no event */
+    uint32_t        stuck;          /* Sleeps that no __SEV() ended */
+} event_flags_check_core_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void event_flags_check_expect(bool condition, const char *what, int line);
+static void event_flags_check_reset(void);
+static void event_flags_check_fixed(void);
+static void event_flags_check_hook(void);
+static void event_flags_check_hook_all(void);
+static void *event_flags_check_producer(void *arg);
+static void event_flags_check_race(void);
+static void event_flags_check_waits(bool all);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t event_flags_check_cases = 0u;
+static uint32_t event_flags_check_failures = 0u;
+
+static event_flags_check_core_t event_flags_check_core =
+{
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, false, 0u, 0u, 0u
+};
+
+/* Group of the threaded cases and the posts of each producer */
+static event_flags_t event_flags_check_group = EVENT_FLAGS_INIT(0u);
+static uint32_t event_flags_check_posts = 0u;
+static volatile uint32_t event_flags_check_posted[EVENT_FLAGS_CHECK_PRODUCERS];
+static volatile uint32_t event_flags_check_refused[EVENT_FLAGS_CHECK_PRODUCERS];
+static volatile uint32_t event_flags_check_done = 0u;
+
+/* Calls of the idle hook */
+static uint32_t event_flags_check_hook_calls = 0u;
+
+
+/* Counts a check and prints the first failures */
+static void event_flags_check_expect(bool condition, const char *what, int line)
+{
+    event_flags_check_cases++;
+    if (!condition)
+    {
+        event_flags_check_failures++;
+        if (event_flags_check_failures <= EVENT_FLAGS_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_wait_for_event
+********************************************************************************
+* Summary:
+*  __WFE() of event_flags.c: returns at once and clears the event register if
+*  an event was signalled, else sleeps until the next __SEV(). A sleep that
+*  no __SEV() ends within EVENT_FLAGS_CHECK_WAKE_MS is counted as stuck; too
+*  many of them end the check.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void sim_wait_for_event(void)
+{
+    event_flags_check_core_t *core = &event_flags_check_core;
+    struct timespec deadline;
+    int status = 0;
+
+    pthread_mutex_lock(&core->mutex);
+    core->waits++;
+    if (!core->event)
+    {
+        core->sleeps++;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += (long)EVENT_FLAGS_CHECK_WAKE_MS * 1000000L;
+        deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+        deadline.tv_nsec %= 1000000000L;
+        while (!core->event && (0 == status))
+        {
+            status = pthread_cond_timedwait(&core->cv, &core->mutex, &deadline);
+        }
+        if (!core->event)
+        {
+            core->stuck++;
+        }
+    }
+    core->event = false;
+    if (core->stuck > EVENT_FLAGS_CHECK_STUCK_MAX)
+    {
+        pthread_mutex_unlock(&core->mutex);
+        EVENT_FLAGS_CHECK(false, "a post wakes the wait");
+        printf("event_flags_check: %u cases, %u failures, %u waits not woken\n", event_flags_check_cases,
+               event_flags_check_failures, core->stuck);
+        exit(1);
+    }
+    pthread_mutex_unlock(&core->mutex);
+}
+
+/* __SEV() of event_flags.c: sets the event register and wakes a sleep */
+void sim_send_event(void)
+{
+    event_flags_check_core_t *core = &event_flags_check_core;
+
+    pthread_mutex_lock(&core->mutex);
+    core->event = true;
+    pthread_cond_broadcast(&core->cv);
+    pthread_mutex_unlock(&core->mutex);
+}
+
+/* Clears the event register and the counts of the model */
+static void event_flags_check_reset(void)
+{
+    event_flags_check_core_t *core = &event_flags_check_core;
+
+    pthread_mutex_lock(&core->mutex);
+    core->event = false;
+    core->waits = 0u;
+    core->sleeps = 0u;
+    core->stuck = 0u;
+    pthread_mutex_unlock(&core->mutex);
+}
+
+/*******************************************************************************
+* Function Name: event_flags_check_fixed
+********************************************************************************
+* Summary:
+*  Checks the returned bits and the group after each operation, waits that
+*  find their bits pending, and the idle hook that runs before each sleep.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void event_flags_check_fixed(void)
+{
+    event_flags_t group = EVENT_FLAGS_INIT(0x05u);
+
+    EVENT_FLAGS_CHECK(0x05u == event_flags_test(&group, 0xFFFFFFFFu), "the initializer sets the bits");
+    EVENT_FLAGS_CHECK(0x04u == event_flags_test(&group, 0x0Cu), "test returns the pending bits of the mask");
+    EVENT_FLAGS_CHECK(0x05u == event_flags_set(&group, 0x12u), "set returns the bits before");
+    EVENT_FLAGS_CHECK(0x17u == group.bits, "set adds the bits");
+    EVENT_FLAGS_CHECK(0x17u == event_flags_clear(&group, 0x03u), "clear returns the bits before");
+    EVENT_FLAGS_CHECK(0x14u == group.bits, "clear removes only its bits");
+    EVENT_FLAGS_CHECK(0x04u == event_flags_take(&group, 0x06u), "take returns the pending bits of the mask");
+    EVENT_FLAGS_CHECK(0x10u == group.bits, "take clears only the bits of the mask");
+    EVENT_FLAGS_CHECK(0u == event_flags_take(&group, 0x06u), "take of no pending bit");
+    EVENT_FLAGS_CHECK(0x10u == group.bits, "take of no pending bit leaves the group");
+
+    /* Pending bits end the waits without a sleep */
+    event_flags_check_reset();
+    EVENT_FLAGS_CHECK(0x10u == event_flags_wait_any(&group, 0x30u, false), "wait for any pending bit");
+    EVENT_FLAGS_CHECK(0x10u == group.bits, "wait for any without clear leaves the bits");
+    EVENT_FLAGS_CHECK(0x10u == event_flags_wait_any(&group, 0x30u, true), "wait for any pending bit, clear");
+    EVENT_FLAGS_CHECK(0u == group.bits, "wait for any with clear takes the bits");
+    (void)event_flags_set(&group, 0x43u);
+    EVENT_FLAGS_CHECK(0x03u == event_flags_wait_all(&group, 0x03u, false), "wait for all pending bits");
+    EVENT_FLAGS_CHECK(0x43u == group.bits, "wait for all without clear leaves the bits");
+    EVENT_FLAGS_CHECK(0x03u == event_flags_wait_all(&group, 0x03u, true), "wait for all pending bits, clear");
+    EVENT_FLAGS_CHECK(0x40u == group.bits, "wait for all with clear takes only its bits");
+    EVENT_FLAGS_CHECK(0u == event_flags_check_core.waits, "pending bits end a wait without __WFE()");
+
+    /* The hook posts another bit twice, then the awaited one */
+    event_flags_check_reset();
+    event_flags_check_group.bits = 0u;
+    event_flags_check_hook_calls = 0u;
+    event_flags_set_idle_hook(event_flags_check_hook);
+    EVENT_FLAGS_CHECK(0x08u == event_flags_wait_any(&event_flags_check_group, 0x08u, true),
+                      "wait for any returns the bit posted by the hook");
+    EVENT_FLAGS_CHECK(3u == event_flags_check_hook_calls, "the hook runs before each sleep");
+    EVENT_FLAGS_CHECK(3u == event_flags_check_core.waits, "each hook call is followed by __WFE()");
+    EVENT_FLAGS_CHECK(0x04u == event_flags_check_group.bits, "another bit does not end the wait");
+
+    /* The wait for all needs both bits */
+    event_flags_check_reset();
+    event_flags_check_group.bits = 0u;
+    event_flags_check_hook_calls = 0u;
+    event_flags_set_idle_hook(event_flags_check_hook_all);
+    EVENT_FLAGS_CHECK(0x03u == event_flags_wait_all(&event_flags_check_group, 0x03u, true),
+                      "wait for all returns once both bits are posted");
+    EVENT_FLAGS_CHECK(2u == event_flags_check_hook_calls, "wait for all sleeps until the last bit");
+    EVENT_FLAGS_CHECK(0u == event_flags_check_group.bits, "wait for all with clear takes the bits");
+    EVENT_FLAGS_CHECK(0u == event_flags_check_core.stuck, "each post of the hook wakes the wait");
+
+    event_flags_set_idle_hook(NULL);
+    event_flags_check_hook_calls = 0u;
+    event_flags_idle();
+    EVENT_FLAGS_CHECK(0u == event_flags_check_hook_calls, "a removed hook is not called");
+}
+
+/* Idle hook: posts 0x04 on the first calls and 0x08 on the third */
+static void event_flags_check_hook(void)
+{
+    event_flags_check_hook_calls++;
+    (void)event_flags_set(&event_flags_check_group, (event_flags_check_hook_calls < 3u) ? 0x04u : 0x08u);
+}
+
+/* Idle hook: posts 0x01, then 0x02 */
+static void event_flags_check_hook_all(void)
+{
+    event_flags_check_hook_calls++;
+    (void)event_flags_set(&event_flags_check_group, (1u == event_flags_check_hook_calls) ? 0x01u : 0x02u);
+}
+
+/*******************************************************************************
+* Function Name: event_flags_check_producer
+********************************************************************************
+* Summary:
+*  Plays the interrupt handler of one bit: posts it event_flags_check_posts
+*  times, each time once the main thread took the previous post, so that no
+*  post merges with another.
+*
+* Parameters:
+*  arg: index of the producer, and of its bit
+*
+* Return:
+*  void*: NULL
+*
+*******************************************************************************/
+static void *event_flags_check_producer(void *arg)
+{
+    uint32_t producer = (uint32_t)(uintptr_t)arg;
+    uint32_t bit = 1UL << producer;
+
+    for (uint32_t post = 0u; post < event_flags_check_posts; post++)
+    {
+        if (0u == (event_flags_set(&event_flags_check_group, bit) & bit))
+        {
+            event_flags_check_posted[producer]++;
+        }
+        else
+        {
+            event_flags_check_refused[producer]++;
+        }
+        while (0u != event_flags_test(&event_flags_check_group, bit))
+        {
+            sched_yield();
+        }
+    }
+    (void)__atomic_add_fetch(&event_flags_check_done, 1u, __ATOMIC_SEQ_CST);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: event_flags_check_race
+********************************************************************************
+* Summary:
+*  Takes the bits of the producers while they post, and sets and clears a bit
+*  of the main thread in between. A read-modify-write that loses the update
+*  of another thread shows up as a post taken twice or never, or as a main
+*  bit changed behind the main thread.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void event_flags_check_race(void)
+{
+    const uint32_t producer_mask = (1UL << EVENT_FLAGS_CHECK_PRODUCERS) - 1u;
+    pthread_t threads[EVENT_FLAGS_CHECK_PRODUCERS];
+    uint32_t taken[EVENT_FLAGS_CHECK_PRODUCERS] = { 0u };
+    uint32_t main_lost = 0u;
+    uint32_t bits;
+    bool matched = true;
+
+    event_flags_check_group.bits = 0u;
+    event_flags_check_posts = EVENT_FLAGS_CHECK_POSTS;
+    event_flags_check_done = 0u;
+    for (uint32_t producer = 0u; producer < EVENT_FLAGS_CHECK_PRODUCERS; producer++)
+    {
+        event_flags_check_posted[producer] = 0u;
+        event_flags_check_refused[producer] = 0u;
+        EVENT_FLAGS_CHECK(0 == pthread_create(&threads[producer], NULL, event_flags_check_producer,
+                                              (void *)(uintptr_t)producer), "producer thread");
+    }
+
+    /* Take until the producers are done, then once more for the last posts */
+    do
+    {
+        bits = event_flags_take(&event_flags_check_group, producer_mask);
+        for (uint32_t producer = 0u; producer < EVENT_FLAGS_CHECK_PRODUCERS; producer++)
+        {
+            if (0u != (bits & (1UL << producer)))
+            {
+                taken[producer]++;
+            }
+        }
+        if (0u != (event_flags_set(&event_flags_check_group, EVENT_FLAGS_CHECK_MAIN_BIT) &
+                   EVENT_FLAGS_CHECK_MAIN_BIT))
+        {
+            main_lost++;
+        }
+        if (0u == (event_flags_clear(&event_flags_check_group, EVENT_FLAGS_CHECK_MAIN_BIT) &
+                   EVENT_FLAGS_CHECK_MAIN_BIT))
+        {
+            main_lost++;
+        }
+        if (0u == bits)
+        {
+            sched_yield();
+        }
+    } while ((EVENT_FLAGS_CHECK_PRODUCERS != event_flags_check_done) ||
+             (0u != event_flags_test(&event_flags_check_group, producer_mask)));
+
+    for (uint32_t producer = 0u; producer < EVENT_FLAGS_CHECK_PRODUCERS; producer++)
+    {
+        (void)pthread_join(threads[producer], NULL);
+        matched = matched && (taken[producer] == event_flags_check_posted[producer]) &&
+                  (EVENT_FLAGS_CHECK_POSTS == event_flags_check_posted[producer]);
+        if (taken[producer] != event_flags_check_posted[producer])
+        {
+            printf("     bit %u: %u posted, %u refused, %u taken\n", producer, event_flags_check_posted[producer],
+                   event_flags_check_refused[producer], taken[producer]);
+        }
+    }
+    EVENT_FLAGS_CHECK(matched, "each post of the producers is taken once");
+    EVENT_FLAGS_CHECK(0u == main_lost, "the main bit changes only with the main thread");
+    EVENT_FLAGS_CHECK(0u == event_flags_check_group.bits, "the group is empty after the last take");
+}
+
+/*******************************************************************************
+* Function Name: event_flags_check_waits
+********************************************************************************
+* Summary:
+*  Waits for the posts of two producers, for any of their bits or for both.
+*  The waits sleep in __WFE() while the producers post, so a post that does
+*  not wake a wait that checked the bits just before it leaves the wait
+*  asleep.
+*
+* Parameters:
+*  all: true to wait for both bits, false for any
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void event_flags_check_waits(bool all)
+{
+    pthread_t threads[2];
+    uint32_t taken[2] = { 0u };
+    uint32_t rounds = 0u;
+    uint32_t bits;
+    bool own_bits = true;
+
+    event_flags_check_reset();
+    event_flags_check_group.bits = 0u;
+    event_flags_check_posts = EVENT_FLAGS_CHECK_WAITS;
+    event_flags_check_done = 0u;
+    for (uint32_t producer = 0u; producer < 2u; producer++)
+    {
+        event_flags_check_posted[producer] = 0u;
+        EVENT_FLAGS_CHECK(0 == pthread_create(&threads[producer], NULL, event_flags_check_producer,
+                                              (void *)(uintptr_t)producer), "producer thread");
+    }
+
+    while ((taken[0] + taken[1]) < (2u * EVENT_FLAGS_CHECK_WAITS))
+    {
+        bits = all ? event_flags_wait_all(&event_flags_check_group, 0x03u, true) :
+                     event_flags_wait_any(&event_flags_check_group, 0x03u, true);
+        own_bits = own_bits && (0u != bits) && (0u == (bits & ~0x03u)) && (!all || (0x03u == bits));
+        taken[0] += bits & 0x01u;
+        taken[1] += (bits >> 1) & 0x01u;
+        rounds++;
+    }
+
+    for (uint32_t producer = 0u; producer < 2u; producer++)
+    {
+        (void)pthread_join(threads[producer], NULL);
+    }
+    EVENT_FLAGS_CHECK(own_bits, "a wait returns its own bits");
+    EVENT_FLAGS_CHECK((EVENT_FLAGS_CHECK_WAITS == taken[0]) && (EVENT_FLAGS_CHECK_WAITS == taken[1]),
+                      "each post ends a wait");
+    EVENT_FLAGS_CHECK(!all || (EVENT_FLAGS_CHECK_WAITS == rounds), "wait for all returns once per pair");
+    EVENT_FLAGS_CHECK(0u == event_flags_check_core.stuck, "each post wakes the wait");
+    printf("     wait %s: %u returns, %u sleeps\n", all ? "all" : "any", rounds, event_flags_check_core.sleeps);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the fixed cases, the race of the takes with the posts and the
+*  threaded waits.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if all checks pass, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    event_flags_check_fixed();
+    event_flags_check_race();
+    event_flags_check_waits(false);
+    event_flags_check_waits(true);
+
+    printf("event_flags_check: %u cases, %u failures\n", event_flags_check_cases, event_flags_check_failures);
+
+    return (0u == event_flags_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
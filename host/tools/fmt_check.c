@@ -0,0 +1,550 @@
+/*******************************************************************************
+* File Name:   fmt_check.c
+*
+* Description: Host check of the integer-only console formatter
+*              (console_fmt.h) against the snprintf of the C library. Random
+*              format strings, each with one conversion of random flags,
+*              width, precision and length modifier between random text, are
+*              formatted by both into buffers of random sizes, and the
+*              results and returned lengths must be equal; the same output
+*              must come out through a sink with a small buffer. Then times
+*              both on the formats of the console hot paths. Exits with 1 if
+*              a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "console_fmt.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define FMT_CHECK_PRINT             (10u)
+
+/* Random formats, and calls of each timed format */
+#define FMT_CHECK_RUNS              (200000u)
+#define FMT_CHECK_TIMED_CALLS       (200000u)
+
+/* Output buffers, larger than the widest output of a random format */
+#define FMT_CHECK_OUT_SIZE          (256u)
+#define FMT_CHECK_FORMAT_SIZE       (64u)
+
+/* Formats both and compares, with the arguments given */
+#define FMT_CHECK_CALL(format, size, ...) \
+    fmt_check_compare((format), (size), \
+                      snprintf(fmt_check_expected, (size), (format), __VA_ARGS__), \
+                      console_fmt_snprintf(fmt_check_actual, (size), (format), __VA_ARGS__), \
+                      fmt_check_sink_format((format), __VA_ARGS__))
+
+/* Passes the '*' arguments the format takes before the value */
+#define FMT_CHECK_STARS(format, size, stars, width, precision, value) \
+    do \
+    { \
+        switch (stars) \
+        { \
+            case 0u:  FMT_CHECK_CALL(format, size, value);                   break; \
+            case 1u:  FMT_CHECK_CALL(format, size, width, value);            break; \
+            case 2u:  FMT_CHECK_CALL(format, size, precision, value);        break; \
+            default:  FMT_CHECK_CALL(format, size, width, precision, value); break; \
+        } \
+    } while (0)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Output collected from the sink */
+typedef struct
+{
+    char     text[FMT_CHECK_OUT_SIZE];
+    uint32_t length;
+} fmt_check_sink_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void fmt_check_sink(void *arg, const char *text, uint32_t length);
+static uint32_t fmt_check_sink_format(const char *format, ...);
+static void fmt_check_compare(const char *format, uint32_t size, int expected_length, uint32_t actual_length,
+                              uint32_t sink_length);
+static uint64_t fmt_check_value(void);
+static void fmt_check_text(char *format, uint32_t *length);
+static void fmt_check_run(void);
+static uint64_t fmt_check_ns(void);
+static void fmt_check_time(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static char fmt_check_expected[FMT_CHECK_OUT_SIZE];
+static char fmt_check_actual[FMT_CHECK_OUT_SIZE];
+static fmt_check_sink_t fmt_check_sunk;
+
+static const char *const fmt_check_strings[] = { "", "a", "SAR ADC", "Channel 0 input", "(null)" };
+
+static uint32_t fmt_check_cases = 0u;
+static uint32_t fmt_check_failures = 0u;
+
+
+/* Appends the output of the sink, whose buffer is only a few characters */
+static void fmt_check_sink(void *arg, const char *text, uint32_t length)
+{
+    fmt_check_sink_t *sunk = (fmt_check_sink_t *)arg;
+
+    if ((sunk->length + length) < sizeof(sunk->text))
+    {
+        memcpy(&sunk->text[sunk->length], text, length);
+    }
+    sunk->length += length;
+}
+
+/* Formats through the sink, with a buffer of 1 to 8 characters */
+static uint32_t fmt_check_sink_format(const char *format, ...)
+{
+    char buffer[8];
+    va_list args;
+    uint32_t length;
+
+    fmt_check_sunk.length = 0u;
+    va_start(args, format);
+    length = console_fmt_vformat(fmt_check_sink, &fmt_check_sunk, buffer, 1u + ((uint32_t)rand() % sizeof(buffer)),
+                                 format, args);
+    va_end(args);
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: fmt_check_compare
+********************************************************************************
+* Summary:
+*  Compares the results of one format: the lengths returned, the buffer
+*  contents up to the terminator and the output of the sink.
+*
+* Parameters:
+*  format: format string
+*  size: size of the output buffers
+*  expected_length: length returned by snprintf()
+*  actual_length: length returned by console_fmt_snprintf()
+*  sink_length: length returned by console_fmt_vformat() with a sink
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void fmt_check_compare(const char *format, uint32_t size, int expected_length, uint32_t actual_length,
+                              uint32_t sink_length)
+{
+    bool same = (expected_length >= 0) && ((uint32_t)expected_length == actual_length) &&
+                (actual_length == sink_length) && (fmt_check_sunk.length == actual_length);
+
+    fmt_check_cases++;
+    if (same && (0u != size))
+    {
+        same = (0 == strcmp(fmt_check_expected, fmt_check_actual));
+    }
+    if (same && (actual_length < sizeof(fmt_check_sunk.text)))
+    {
+        uint32_t cut = (0u != size) ? (uint32_t)strlen(fmt_check_expected) : 0u;
+
+        same = (0 == memcmp(fmt_check_sunk.text, fmt_check_expected, cut));
+    }
+
+    if (!same)
+    {
+        fmt_check_failures++;
+        if (fmt_check_failures <= FMT_CHECK_PRINT)
+        {
+            printf("FAIL \"%s\" size %u: snprintf %d \"%s\", console_fmt %u \"%.*s\", sink %u\n", format, size,
+                   expected_length, (0u != size) ? fmt_check_expected : "", actual_length,
+                   (0u != size) ? (int)size : 0, fmt_check_actual, sink_length);
+        }
+    }
+}
+
+/* Values around the limits of every width, and random ones */
+static uint64_t fmt_check_value(void)
+{
+    static const uint64_t limits[] =
+    {
+        0u, 1u, 7u, 8u, 9u, 10u, 15u, 16u, 99u, 100u, 0x7Fu, 0x80u, 0xFFu, 0x7FFFu, 0x8000u, 0xFFFFu,
+        0x7FFFFFFFu, 0x80000000u, 0xFFFFFFFFu, 0x7FFFFFFFFFFFFFFFu, 0x8000000000000000u, 0xFFFFFFFFFFFFFFFFu,
+        999999999u, 1000000000u, 4294967296u, 18446744073709551615u,
+    };
+    uint64_t value = ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 11) ^ (uint64_t)rand();
+
+    if (0 == (rand() % 2))
+    {
+        return limits[(uint32_t)rand() % (sizeof(limits) / sizeof(limits[0]))];
+    }
+
+    return value >> (rand() % 64);
+}
+
+/* Appends a few characters of text, some of them blanks or escaped '%' */
+static void fmt_check_text(char *format, uint32_t *length)
+{
+    uint32_t count = (uint32_t)rand() % 4u;
+
+    for (uint32_t index = 0u; index < count; index++)
+    {
+        uint32_t pick = (uint32_t)rand() % 8u;
+
+        if (0u == pick)
+        {
+            format[(*length)++] = '%';
+            format[(*length)++] = '%';
+        }
+        else
+        {
+            format[(*length)++] = (1u == pick) ? ' ' : (char)('A' + (rand() % 58));
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: fmt_check_run
+********************************************************************************
+* Summary:
+*  Builds one random format and compares both formatters on it. Flags that
+*  the C standard leaves undefined for a conversion are not generated: '#'
+*  only for o, x and X, '0' not for c, s and p, and no flags but '-' for p.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void fmt_check_run(void)
+{
+    static const char conversions[] = "diuoxXcsp%";
+    static const char *const lengths[] = { "", "hh", "h", "l", "ll", "j", "z", "t" };
+    char format[FMT_CHECK_FORMAT_SIZE];
+    uint32_t length = 0u;
+    uint32_t stars = 0u;
+    char conversion = conversions[(uint32_t)rand() % (sizeof(conversions) - 1u)];
+    const char *modifier = "";
+    int width = (rand() % 41) - 20;
+    int precision = (rand() % 41) - 20;
+    uint32_t size = (0 == (rand() % 4)) ? ((uint32_t)rand() % 8u) : FMT_CHECK_OUT_SIZE;
+    uint64_t value = fmt_check_value();
+
+    fmt_check_text(format, &length);
+    format[length++] = '%';
+
+    if ('%' != conversion)
+    {
+        static const char flags[] = "-+ #0";
+
+        for (uint32_t index = 0u; index < (sizeof(flags) - 1u); index++)
+        {
+            char flag = flags[index];
+
+            if ((0 == (rand() % 3)) &&
+                (('#' != flag) || ('o' == conversion) || ('x' == conversion) || ('X' == conversion)) &&
+                (('0' != flag) || (NULL == strchr("csp", conversion))) &&
+                (('-' == flag) || ('p' != conversion)))
+            {
+                format[length++] = flag;
+            }
+        }
+    }
+
+    if ('%' != conversion)
+    {
+        switch (rand() % 3)
+        {
+            case 0:
+                length += (uint32_t)sprintf(&format[length], "%d", abs(width));
+                break;
+            case 1:
+                format[length++] = '*';
+                stars |= 1u;
+                break;
+            default:
+                break;
+        }
+        if ((0 == (rand() % 2)) && ('c' != conversion) && ('p' != conversion))
+        {
+            format[length++] = '.';
+            switch (rand() % 3)
+            {
+                case 0:
+                    length += (uint32_t)sprintf(&format[length], "%d", abs(precision));
+                    break;
+                case 1:
+                    format[length++] = '*';
+                    stars |= 2u;
+                    break;
+                default:
+                    break;
+            }
+        }
+        if (NULL != strchr("diuoxX", conversion))
+        {
+            modifier = lengths[(uint32_t)rand() % (sizeof(lengths) / sizeof(lengths[0]))];
+            length += (uint32_t)sprintf(&format[length], "%s", modifier);
+        }
+    }
+    format[length++] = conversion;
+    fmt_check_text(format, &length);
+    format[length] = '\0';
+
+    /* The value with the type the conversion and the modifier take */
+    if (('d' == conversion) || ('i' == conversion))
+    {
+        if ((0 == strcmp(modifier, "ll")) || (0 == strcmp(modifier, "j")))
+        {
+            FMT_CHECK_STARS(format, size, stars, width, precision, (long long)value);
+        }
+        else if (0 == strcmp(modifier, "l"))
+        {
+            FMT_CHECK_STARS(format, size, stars, width, precision, (long)value);
+        }
+        else if ((0 == strcmp(modifier, "z")) || (0 == strcmp(modifier, "t")))
+        {
+            FMT_CHECK_STARS(format, size, stars, width, precision, (ptrdiff_t)value);
+        }
+        else
+        {
+            FMT_CHECK_STARS(format, size, stars, width, precision, (int)value);
+        }
+    }
+    else if (NULL != strchr("uoxX", conversion))
+    {
+        if ((0 == strcmp(modifier, "ll")) || (0 == strcmp(modifier, "j")))
+        {
+            FMT_CHECK_STARS(format, size, stars, width, precision, (unsigned long long)value);
+        }
+        else if (0 == strcmp(modifier, "l"))
+        {
+            FMT_CHECK_STARS(format, size, stars, width, precision, (unsigned long)value);
+        }
+        else if ((0 == strcmp(modifier, "z")) || (0 == strcmp(modifier, "t")))
+        {
+            FMT_CHECK_STARS(format, size, stars, width, precision, (size_t)value);
+        }
+        else
+        {
+            FMT_CHECK_STARS(format, size, stars, width, precision, (unsigned int)value);
+        }
+    }
+    else if ('c' == conversion)
+    {
+        /* A terminator in the output ends the comparison early, skip it */
+        FMT_CHECK_STARS(format, size, stars, width, precision, (int)(' ' + (value % 95u)));
+    }
+    else if ('s' == conversion)
+    {
+        FMT_CHECK_STARS(format, size, stars, width, precision,
+                        fmt_check_strings[value % (sizeof(fmt_check_strings) / sizeof(fmt_check_strings[0]))]);
+    }
+    else if ('p' == conversion)
+    {
+        /* A null pointer is "(nil)" in the C library of the host */
+        FMT_CHECK_STARS(format, size, stars, width, precision, (void *)(uintptr_t)((0u != value) ? value : 1u));
+    }
+    else
+    {
+        FMT_CHECK_CALL(format, size, 0);
+    }
+}
+
+/* Monotonic time in nanoseconds */
+static uint64_t fmt_check_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: fmt_check_time
+********************************************************************************
+* Summary:
+*  Times the formats of the console hot paths with snprintf() and with the
+*  formatter, and the fast paths that replace them, in ns per call.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void fmt_check_time(void)
+{
+    static volatile int32_t millivolts = 1234;
+    static volatile uint32_t byte = 0xA5u;
+    char out[FMT_CHECK_OUT_SIZE];
+    uint64_t start;
+    uint64_t ns[3];
+
+    /* Line of the SAR ADC demo */
+    start = fmt_check_ns();
+    for (uint32_t call = 0u; call < FMT_CHECK_TIMED_CALLS; call++)
+    {
+        (void)snprintf(out, sizeof(out), "Channel 0 input: %4ldmV", (long)millivolts);
+    }
+    ns[0] = fmt_check_ns() - start;
+    start = fmt_check_ns();
+    for (uint32_t call = 0u; call < FMT_CHECK_TIMED_CALLS; call++)
+    {
+        (void)console_fmt_snprintf(out, sizeof(out), "Channel 0 input: %4ldmV", (long)millivolts);
+    }
+    ns[1] = fmt_check_ns() - start;
+    start = fmt_check_ns();
+    for (uint32_t call = 0u; call < FMT_CHECK_TIMED_CALLS; call++)
+    {
+        memcpy(out, "Channel 0 input: ", 17u);
+        (void)console_fmt_dec(&out[17], millivolts, 4u);
+    }
+    ns[2] = fmt_check_ns() - start;
+    printf("fmt_check: \"Channel 0 input: %%4ldmV\": snprintf %.1f ns, console_fmt %.1f ns, fast path %.1f ns\n",
+           (double)ns[0] / FMT_CHECK_TIMED_CALLS, (double)ns[1] / FMT_CHECK_TIMED_CALLS,
+           (double)ns[2] / FMT_CHECK_TIMED_CALLS);
+
+    /* Byte of the QSPI hex dump */
+    start = fmt_check_ns();
+    for (uint32_t call = 0u; call < FMT_CHECK_TIMED_CALLS; call++)
+    {
+        (void)snprintf(out, sizeof(out), "0x%02X ", (unsigned int)byte);
+    }
+    ns[0] = fmt_check_ns() - start;
+    start = fmt_check_ns();
+    for (uint32_t call = 0u; call < FMT_CHECK_TIMED_CALLS; call++)
+    {
+        (void)console_fmt_snprintf(out, sizeof(out), "0x%02X ", (unsigned int)byte);
+    }
+    ns[1] = fmt_check_ns() - start;
+    start = fmt_check_ns();
+    for (uint32_t call = 0u; call < FMT_CHECK_TIMED_CALLS; call++)
+    {
+        (void)console_fmt_hex(&out[2], byte, 2u, true);
+    }
+    ns[2] = fmt_check_ns() - start;
+    printf("fmt_check: \"0x%%02X \": snprintf %.1f ns, console_fmt %.1f ns, fast path %.1f ns\n",
+           (double)ns[0] / FMT_CHECK_TIMED_CALLS, (double)ns[1] / FMT_CHECK_TIMED_CALLS,
+           (double)ns[2] / FMT_CHECK_TIMED_CALLS);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the random formats, the formats of the demos, the fast paths and the
+*  timing.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if every check passed, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    char out[CONSOLE_FMT_DEC_MAX + 32u];
+    char expected[CONSOLE_FMT_DEC_MAX + 32u];
+    uint32_t length;
+
+    srand(1u);
+    for (uint32_t run = 0u; run < FMT_CHECK_RUNS; run++)
+    {
+        fmt_check_run();
+    }
+
+    /* Formats of the demos, with several conversions */
+    FMT_CHECK_CALL("%s (%u bytes):\r\n", FMT_CHECK_OUT_SIZE, "Received Data", 256u);
+    FMT_CHECK_CALL("%d bytes received  with identifier %d\r\n\r\n", FMT_CHECK_OUT_SIZE, 8, 0x7FF);
+    FMT_CHECK_CALL("Channel %u %s: %4lumV at %lu.%06lus\r\n", FMT_CHECK_OUT_SIZE, 1u, "above", 3300ul, 12ul, 345ul);
+    FMT_CHECK_CALL("[%10lu us] %s: %.*s\r\n", FMT_CHECK_OUT_SIZE, 4294967295ul, "CM7_1", 5, "offload worker");
+
+    /* Fast paths against the formats they replace */
+    for (int64_t value = -2147483648ll; value <= 2147483647ll; value += 65521)
+    {
+        for (uint32_t width = 0u; width <= 12u; width += 4u)
+        {
+            fmt_check_cases++;
+            length = console_fmt_dec(out, (int32_t)value, width);
+            out[length] = '\0';
+            (void)snprintf(expected, sizeof(expected), "%*ld", (int)width, (long)value);
+            if (0 != strcmp(out, expected))
+            {
+                fmt_check_failures++;
+                printf("FAIL console_fmt_dec %lld width %u: \"%s\"\n", (long long)value, width, out);
+            }
+        }
+    }
+    for (uint32_t digits = 1u; digits <= CONSOLE_FMT_HEX_MAX; digits++)
+    {
+        for (uint64_t value = 0u; value <= 0xFFFFFFFFu; value = (value * 3u) + 1u)
+        {
+            fmt_check_cases++;
+            length = console_fmt_hex(out, (uint32_t)value, digits, (0u != (digits % 2u)));
+            out[length] = '\0';
+            (void)snprintf(expected, sizeof(expected), (0u != (digits % 2u)) ? "%0*lX" : "%0*lx", (int)digits,
+                           (unsigned long)value);
+            if (0 != strcmp(out, expected))
+            {
+                fmt_check_failures++;
+                printf("FAIL console_fmt_hex 0x%lx digits %u: \"%s\"\n", (unsigned long)value, digits, out);
+            }
+        }
+    }
+
+    fmt_check_time();
+
+    printf("fmt_check: %u cases, %u failures\n", fmt_check_cases, fmt_check_failures);
+
+    return (0u == fmt_check_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
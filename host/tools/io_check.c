@@ -0,0 +1,863 @@
+/*******************************************************************************
+* File Name:   io_check.c
+*
+* Description: Host check of the I/O co-processor messages of shared/ipc_io.c,
+*              over the real rings of shared/ipc_ring.c. Fixed cases cover
+*              the key classification, the button events, the rejection of
+*              malformed messages, the full event ring, the chunking of the
+*              console output with a partial write into a full ring, and both
+*              rings while their indices wrap at 2^32. Then a thread standing
+*              for CM0+ posts events and a thread standing for CM7_0 writes
+*              console text, each to a consumer thread that checks every
+*              event and every character. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ipc_io.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define IO_CHECK_PRINT              (10u)
+
+/* Events and console characters of the threaded runs */
+#define IO_CHECK_EVENTS             (1000000u)
+#define IO_CHECK_TEXT               (4000000u)
+
+/* Longest write of the threaded console run, several messages */
+#define IO_CHECK_WRITE_MAX          (3u * IPC_MSG_PAYLOAD_SIZE + 7u)
+
+#define IO_CHECK(condition, what) \
+    io_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Results of a threaded run, written by the consumer */
+typedef struct
+{
+    uint32_t received;              /* Events or characters received */
+    uint32_t errors;                /* Received with wrong contents */
+} io_check_run_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void io_check_expect(bool condition, const char *what, int line);
+static char io_check_char(uint32_t index);
+static void io_check_event_of(uint32_t index, uint16_t *type, ipc_io_event_t *event);
+static bool io_check_post(ipc_ring_t *ring, uint32_t index);
+static bool io_check_pop_event(ipc_ring_t *ring, uint16_t *type, ipc_io_event_t *event);
+static void io_check_keys(void);
+static void io_check_buttons(void);
+static void io_check_malformed(void);
+static void io_check_event_full(void);
+static void io_check_console(void);
+static void io_check_console_full(void);
+static void io_check_wrap(void);
+static void *io_check_event_producer(void *arg);
+static void *io_check_event_consumer(void *arg);
+static void *io_check_console_producer(void *arg);
+static void *io_check_console_consumer(void *arg);
+static void io_check_threads(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* CM0+ to CM7_0 event ring and CM7_0 to CM0+ console ring */
+static ipc_ring_t io_check_events;
+static ipc_ring_t io_check_console_ring;
+
+/* Set by the producers when done, so that lost messages end the runs */
+static bool io_check_events_done;
+static bool io_check_console_done;
+
+static uint32_t io_check_cases = 0u;
+static uint32_t io_check_failures = 0u;
+
+
+/*******************************************************************************
+* Function Name: io_check_expect
+********************************************************************************
+* Summary:
+*  Counts a check and prints the first failures.
+*
+* Parameters:
+*  condition: result of the check
+*  what: description of the check
+*  line: source line of the check
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_expect(bool condition, const char *what, int line)
+{
+    io_check_cases++;
+    if (!condition)
+    {
+        io_check_failures++;
+        if (io_check_failures <= IO_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_check_char
+********************************************************************************
+* Summary:
+*  Returns the console character at a position of the test text.
+*
+* Parameters:
+*  index: position in the text
+*
+* Return:
+*  char: printable character depending on the position
+*
+*******************************************************************************/
+static char io_check_char(uint32_t index)
+{
+    return (char)(' ' + ((index * 2654435761u) >> 24) % 95u);
+}
+
+/*******************************************************************************
+* Function Name: io_check_event_of
+********************************************************************************
+* Summary:
+*  Returns the event of a position of the threaded event stream: keys of
+*  both kinds and presses of both buttons with a duration depending on it.
+*
+* Parameters:
+*  index: position in the stream
+*  type: returns the IPC_IO_EVT_* code
+*  event: returns the payload
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_event_of(uint32_t index, uint16_t *type, ipc_io_event_t *event)
+{
+    event->reserved = 0u;
+    event->held_ms = 0u;
+    if (0u == (index % 3u))
+    {
+        *type = IPC_IO_EVT_BUTTON;
+        event->code = (0u == (index & 1u)) ? IPC_IO_BUTTON1 : IPC_IO_BUTTON2;
+        event->held_ms = (uint16_t)(index * 40503u);
+    }
+    else
+    {
+        event->code = (uint8_t)(index * 7u);
+        *type = ((event->code >= (uint8_t)IPC_IO_DEMO_KEY_FIRST) && (event->code <= (uint8_t)IPC_IO_DEMO_KEY_LAST)) ?
+                IPC_IO_EVT_DEMO_SELECT : IPC_IO_EVT_KEY;
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_check_post
+********************************************************************************
+* Summary:
+*  Posts the event of a position of the stream, as the CM0+ console and
+*  button handlers do.
+*
+* Parameters:
+*  ring: event ring
+*  index: position in the stream
+*
+* Return:
+*  true if the event was queued
+*
+*******************************************************************************/
+static bool io_check_post(ipc_ring_t *ring, uint32_t index)
+{
+    uint16_t type;
+    ipc_io_event_t event;
+
+    io_check_event_of(index, &type, &event);
+    if (IPC_IO_EVT_BUTTON == type)
+    {
+        return ipc_io_post_button(ring, event.code, event.held_ms);
+    }
+
+    return ipc_io_post_key(ring, event.code);
+}
+
+/*******************************************************************************
+* Function Name: io_check_pop_event
+********************************************************************************
+* Summary:
+*  Pops and decodes an event, as io_client_dispatch() does.
+*
+* Parameters:
+*  ring: event ring
+*  type: returns the IPC_IO_EVT_* code
+*  event: returns the payload
+*
+* Return:
+*  true if a valid event was popped
+*
+*******************************************************************************/
+static bool io_check_pop_event(ipc_ring_t *ring, uint16_t *type, ipc_io_event_t *event)
+{
+    ipc_msg_t msg;
+
+    return ipc_ring_pop(ring, &msg) && ipc_io_get_event(&msg, type, event);
+}
+
+/*******************************************************************************
+* Function Name: io_check_keys
+********************************************************************************
+* Summary:
+*  Checks that only the keys '1'..'9' select a demo.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_keys(void)
+{
+    uint16_t type;
+    ipc_io_event_t event;
+    bool classified = true;
+
+    ipc_ring_init(&io_check_events);
+    for (uint32_t key = 0u; key <= UINT8_MAX; key++)
+    {
+        uint16_t expected = ((key >= '1') && (key <= '9')) ? IPC_IO_EVT_DEMO_SELECT : IPC_IO_EVT_KEY;
+
+        if (!ipc_io_post_key(&io_check_events, (uint8_t)key) ||
+            !io_check_pop_event(&io_check_events, &type, &event) ||
+            (type != expected) || (event.code != key) || (0u != event.held_ms))
+        {
+            classified = false;
+        }
+    }
+    IO_CHECK(classified, "keys '1'..'9' select a demo, the others are plain keys");
+    IO_CHECK(0u == ipc_ring_count(&io_check_events), "one message per key");
+}
+
+/*******************************************************************************
+* Function Name: io_check_buttons
+********************************************************************************
+* Summary:
+*  Checks the button number and the press duration of the button events.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_buttons(void)
+{
+    static const uint16_t held[] = { 0u, 1u, 250u, 1234u, 65535u };
+    uint16_t type;
+    ipc_io_event_t event;
+    bool intact = true;
+
+    ipc_ring_init(&io_check_events);
+    for (uint32_t index = 0u; index < (sizeof(held) / sizeof(held[0])); index++)
+    {
+        uint8_t button = (0u == (index & 1u)) ? IPC_IO_BUTTON1 : IPC_IO_BUTTON2;
+
+        if (!ipc_io_post_button(&io_check_events, button, held[index]) ||
+            !io_check_pop_event(&io_check_events, &type, &event) ||
+            (IPC_IO_EVT_BUTTON != type) || (button != event.code) || (held[index] != event.held_ms))
+        {
+            intact = false;
+        }
+    }
+    IO_CHECK(intact, "button events keep the button and the press duration");
+}
+
+/*******************************************************************************
+* Function Name: io_check_malformed
+********************************************************************************
+* Summary:
+*  Checks that the event decoder rejects the messages of another length or
+*  opcode, the console text among them.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_malformed(void)
+{
+    ipc_msg_t msg;
+    ipc_io_event_t event = { .code = '5', .reserved = 0u, .held_ms = 0u };
+    uint16_t type = 0u;
+
+    memset(&msg, 0, sizeof(msg));
+    memcpy(msg.payload, &event, sizeof(event));
+    msg.length = sizeof(ipc_io_event_t);
+
+    msg.opcode = IPC_IO_EVT_DEMO_SELECT;
+    IO_CHECK(ipc_io_get_event(&msg, &type, &event) && (IPC_IO_EVT_DEMO_SELECT == type), "first event opcode");
+    msg.opcode = IPC_IO_EVT_BUTTON;
+    IO_CHECK(ipc_io_get_event(&msg, &type, &event) && (IPC_IO_EVT_BUTTON == type), "last event opcode");
+    msg.opcode = IPC_IO_EVT_DEMO_SELECT - 1u;
+    IO_CHECK(!ipc_io_get_event(&msg, &type, &event), "opcode below the events rejected");
+    msg.opcode = IPC_IO_EVT_BUTTON + 1u;
+    IO_CHECK(!ipc_io_get_event(&msg, &type, &event), "opcode above the events rejected");
+    msg.opcode = IPC_IO_CONSOLE_TEXT;
+    IO_CHECK(!ipc_io_get_event(&msg, &type, &event), "console text is not an event");
+
+    msg.opcode = IPC_IO_EVT_KEY;
+    msg.length = sizeof(ipc_io_event_t) - 1u;
+    IO_CHECK(!ipc_io_get_event(&msg, &type, &event), "short event rejected");
+    msg.length = sizeof(ipc_io_event_t) + 1u;
+    IO_CHECK(!ipc_io_get_event(&msg, &type, &event), "long event rejected");
+}
+
+/*******************************************************************************
+* Function Name: io_check_event_full
+********************************************************************************
+* Summary:
+*  Checks that posting into a full event ring fails without dropping or
+*  altering the queued events, and that one pop makes room for one event.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_event_full(void)
+{
+    uint16_t type;
+    uint16_t expected_type;
+    ipc_io_event_t event;
+    ipc_io_event_t expected;
+    uint32_t index;
+    bool in_order = true;
+
+    ipc_ring_init(&io_check_events);
+    for (index = 0u; index < IPC_RING_DEPTH; index++)
+    {
+        IO_CHECK(io_check_post(&io_check_events, index), "post into an event ring with room");
+    }
+    IO_CHECK(!ipc_io_post_key(&io_check_events, 'a'), "key into the full ring fails");
+    IO_CHECK(!ipc_io_post_button(&io_check_events, IPC_IO_BUTTON1, 10u), "button into the full ring fails");
+    IO_CHECK(IPC_RING_DEPTH == ipc_ring_count(&io_check_events), "refused posts leave the ring");
+
+    IO_CHECK(io_check_pop_event(&io_check_events, &type, &event), "pop from the full ring");
+    IO_CHECK(io_check_post(&io_check_events, IPC_RING_DEPTH), "post after a pop");
+    IO_CHECK(!io_check_post(&io_check_events, IPC_RING_DEPTH + 1u), "ring full again");
+
+    for (index = 1u; index <= IPC_RING_DEPTH; index++)
+    {
+        io_check_event_of(index, &expected_type, &expected);
+        if (!io_check_pop_event(&io_check_events, &type, &event) || (type != expected_type) ||
+            (0 != memcmp(&event, &expected, sizeof(event))))
+        {
+            in_order = false;
+        }
+    }
+    IO_CHECK(in_order, "events of the full ring come out in order and intact");
+    IO_CHECK(!io_check_pop_event(&io_check_events, &type, &event), "drained event ring is empty");
+}
+
+/*******************************************************************************
+* Function Name: io_check_console
+********************************************************************************
+* Summary:
+*  Checks the split of the console output into messages of at most
+*  IPC_MSG_PAYLOAD_SIZE characters.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_console(void)
+{
+    static const uint32_t lengths[] = { 1u, IPC_MSG_PAYLOAD_SIZE - 1u, IPC_MSG_PAYLOAD_SIZE,
+                                        IPC_MSG_PAYLOAD_SIZE + 1u, 2u * IPC_MSG_PAYLOAD_SIZE + 5u };
+    char text[IPC_RING_DEPTH * IPC_MSG_PAYLOAD_SIZE];
+    char received[sizeof(text)];
+    ipc_msg_t msg;
+
+    for (uint32_t index = 0u; index < sizeof(text); index++)
+    {
+        text[index] = io_check_char(index);
+    }
+
+    ipc_ring_init(&io_check_console_ring);
+    IO_CHECK(0u == ipc_io_write_console(&io_check_console_ring, text, 0u), "empty write queues nothing");
+    IO_CHECK(0u == ipc_ring_count(&io_check_console_ring), "empty write sends no message");
+
+    for (uint32_t index = 0u; index < (sizeof(lengths) / sizeof(lengths[0])); index++)
+    {
+        uint32_t length = lengths[index];
+        uint32_t messages = (length + IPC_MSG_PAYLOAD_SIZE - 1u) / IPC_MSG_PAYLOAD_SIZE;
+        uint32_t offset = 0u;
+        bool chunks_ok = true;
+
+        IO_CHECK(length == ipc_io_write_console(&io_check_console_ring, text, length), "whole write queued");
+        IO_CHECK(messages == ipc_ring_count(&io_check_console_ring), "one message per full or last chunk");
+        while (ipc_ring_pop(&io_check_console_ring, &msg))
+        {
+            uint32_t chunk = length - offset;
+
+            if (chunk > IPC_MSG_PAYLOAD_SIZE)
+            {
+                chunk = IPC_MSG_PAYLOAD_SIZE;
+            }
+            if ((IPC_IO_CONSOLE_TEXT != msg.opcode) || (chunk != msg.length))
+            {
+                chunks_ok = false;
+                break;
+            }
+            memcpy(&received[offset], msg.payload, msg.length);
+            offset += msg.length;
+        }
+        IO_CHECK(chunks_ok, "console messages are full chunks but the last");
+        IO_CHECK((offset == length) && (0 == memcmp(received, text, length)), "console text intact");
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_check_console_full
+********************************************************************************
+* Summary:
+*  Checks a write into a nearly full console ring: only the chunks that fit
+*  are queued, and the remaining text is queued once the ring drains, as the
+*  retry loop of io_client_write() does.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_console_full(void)
+{
+    char text[5u * IPC_MSG_PAYLOAD_SIZE + 3u];
+    char received[sizeof(text)];
+    uint32_t sent;
+    uint32_t offset = 0u;
+    ipc_msg_t msg;
+
+    for (uint32_t index = 0u; index < sizeof(text); index++)
+    {
+        text[index] = io_check_char(index + 1000u);
+    }
+
+    ipc_ring_init(&io_check_console_ring);
+    for (uint32_t index = 0u; index < (IPC_RING_DEPTH - 2u); index++)
+    {
+        IO_CHECK(1u == ipc_io_write_console(&io_check_console_ring, "x", 1u), "fill the console ring");
+    }
+
+    sent = ipc_io_write_console(&io_check_console_ring, text, sizeof(text));
+    IO_CHECK((2u * IPC_MSG_PAYLOAD_SIZE) == sent, "partial write queues the chunks that fit");
+    IO_CHECK(IPC_RING_DEPTH == ipc_ring_count(&io_check_console_ring), "console ring full");
+    IO_CHECK(0u == ipc_io_write_console(&io_check_console_ring, &text[sent], sizeof(text) - sent),
+             "write into the full ring queues nothing");
+
+    /* CM0+ sends the padding, then the text while CM7_0 retries */
+    for (uint32_t index = 0u; index < (IPC_RING_DEPTH - 2u); index++)
+    {
+        (void)ipc_ring_pop(&io_check_console_ring, &msg);
+    }
+    while (offset < sizeof(text))
+    {
+        if (sent < sizeof(text))
+        {
+            sent += ipc_io_write_console(&io_check_console_ring, &text[sent], sizeof(text) - sent);
+        }
+        if (!ipc_ring_pop(&io_check_console_ring, &msg) || ((offset + msg.length) > sizeof(text)))
+        {
+            break;
+        }
+        memcpy(&received[offset], msg.payload, msg.length);
+        offset += msg.length;
+    }
+    IO_CHECK((sizeof(text) == offset) && (0 == memcmp(received, text, sizeof(text))),
+             "text of the partial write and its retry intact");
+}
+
+/*******************************************************************************
+* Function Name: io_check_wrap
+********************************************************************************
+* Summary:
+*  Fills and drains both rings while their free-running indices wrap at 2^32.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_wrap(void)
+{
+    char text[IPC_RING_DEPTH * IPC_MSG_PAYLOAD_SIZE];
+    char received[sizeof(text)];
+    uint16_t type;
+    uint16_t expected_type;
+    ipc_io_event_t event;
+    ipc_io_event_t expected;
+    ipc_msg_t msg;
+    uint32_t posted = 0u;
+    uint32_t taken = 0u;
+    bool events_ok = true;
+    bool text_ok = true;
+
+    ipc_ring_init(&io_check_events);
+    io_check_events.head = UINT32_MAX - (IPC_RING_DEPTH / 2u);
+    io_check_events.tail = io_check_events.head;
+    for (uint32_t round = 0u; round < 4u; round++)
+    {
+        while (io_check_post(&io_check_events, posted))
+        {
+            posted++;
+        }
+        while (io_check_pop_event(&io_check_events, &type, &event))
+        {
+            io_check_event_of(taken, &expected_type, &expected);
+            if ((type != expected_type) || (0 != memcmp(&event, &expected, sizeof(event))))
+            {
+                events_ok = false;
+            }
+            taken++;
+        }
+    }
+    IO_CHECK((posted == (4u * IPC_RING_DEPTH)) && (taken == posted), "event ring full and empty across the wrap");
+    IO_CHECK(events_ok, "events in order and intact across the wrap");
+
+    ipc_ring_init(&io_check_console_ring);
+    io_check_console_ring.head = UINT32_MAX - 2u;
+    io_check_console_ring.tail = io_check_console_ring.head;
+    for (uint32_t round = 0u; round < 4u; round++)
+    {
+        uint32_t offset = 0u;
+
+        for (uint32_t index = 0u; index < sizeof(text); index++)
+        {
+            text[index] = io_check_char((round * sizeof(text)) + index);
+        }
+        if (sizeof(text) != ipc_io_write_console(&io_check_console_ring, text, sizeof(text)))
+        {
+            text_ok = false;
+        }
+        while (ipc_ring_pop(&io_check_console_ring, &msg) && ((offset + msg.length) <= sizeof(text)))
+        {
+            memcpy(&received[offset], msg.payload, msg.length);
+            offset += msg.length;
+        }
+        if ((offset != sizeof(text)) || (0 != memcmp(received, text, sizeof(text))))
+        {
+            text_ok = false;
+        }
+    }
+    IO_CHECK(text_ok, "console ring fills exactly and keeps the text across the wrap");
+}
+
+/*******************************************************************************
+* Function Name: io_check_event_producer
+********************************************************************************
+* Summary:
+*  Thread standing for the CM0+ handlers: posts the event stream, retrying
+*  while the ring is full.
+*
+* Parameters:
+*  arg: unused
+*
+* Return:
+*  NULL
+*
+*******************************************************************************/
+static void *io_check_event_producer(void *arg)
+{
+    (void)arg;
+
+    for (uint32_t index = 0u; index < IO_CHECK_EVENTS; index++)
+    {
+        while (!io_check_post(&io_check_events, index))
+        {
+            sched_yield();
+        }
+    }
+    __atomic_store_n(&io_check_events_done, true, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: io_check_event_consumer
+********************************************************************************
+* Summary:
+*  Thread standing for the doorbell handler of CM7_0: decodes the event
+*  stream and compares each event with the one of its position.
+*
+* Parameters:
+*  arg: io_check_run_t receiving the results
+*
+* Return:
+*  NULL
+*
+*******************************************************************************/
+static void *io_check_event_consumer(void *arg)
+{
+    io_check_run_t *run = (io_check_run_t *)arg;
+    ipc_msg_t msg;
+    uint16_t type;
+    uint16_t expected_type;
+    ipc_io_event_t event;
+    ipc_io_event_t expected;
+
+    while (run->received < IO_CHECK_EVENTS)
+    {
+        if (!ipc_ring_pop(&io_check_events, &msg))
+        {
+            if (__atomic_load_n(&io_check_events_done, __ATOMIC_ACQUIRE) &&
+                (0u == ipc_ring_count(&io_check_events)))
+            {
+                /* Events were lost */
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+        io_check_event_of(run->received, &expected_type, &expected);
+        if (!ipc_io_get_event(&msg, &type, &event) || (type != expected_type) ||
+            (0 != memcmp(&event, &expected, sizeof(event))))
+        {
+            run->errors++;
+        }
+        run->received++;
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: io_check_console_producer
+********************************************************************************
+* Summary:
+*  Thread standing for CM7_0: writes the test text in pieces of varying
+*  length, with the retry loop of io_client_write().
+*
+* Parameters:
+*  arg: unused
+*
+* Return:
+*  NULL
+*
+*******************************************************************************/
+static void *io_check_console_producer(void *arg)
+{
+    char piece[IO_CHECK_WRITE_MAX];
+    uint32_t position = 0u;
+
+    (void)arg;
+
+    while (position < IO_CHECK_TEXT)
+    {
+        uint32_t length = 1u + ((position * 2246822519u) >> 16) % IO_CHECK_WRITE_MAX;
+        uint32_t sent = 0u;
+
+        if (length > (IO_CHECK_TEXT - position))
+        {
+            length = IO_CHECK_TEXT - position;
+        }
+        for (uint32_t index = 0u; index < length; index++)
+        {
+            piece[index] = io_check_char(position + index);
+        }
+        while (sent < length)
+        {
+            uint32_t queued = ipc_io_write_console(&io_check_console_ring, &piece[sent], length - sent);
+
+            if (0u == queued)
+            {
+                sched_yield();
+            }
+            sent += queued;
+        }
+        position += length;
+    }
+    __atomic_store_n(&io_check_console_done, true, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: io_check_console_consumer
+********************************************************************************
+* Summary:
+*  Thread standing for the console transmitter of CM0+: checks every
+*  character received against the test text.
+*
+* Parameters:
+*  arg: io_check_run_t receiving the results
+*
+* Return:
+*  NULL
+*
+*******************************************************************************/
+static void *io_check_console_consumer(void *arg)
+{
+    io_check_run_t *run = (io_check_run_t *)arg;
+    ipc_msg_t msg;
+
+    while (run->received < IO_CHECK_TEXT)
+    {
+        if (!ipc_ring_pop(&io_check_console_ring, &msg))
+        {
+            if (__atomic_load_n(&io_check_console_done, __ATOMIC_ACQUIRE) &&
+                (0u == ipc_ring_count(&io_check_console_ring)))
+            {
+                /* Characters were lost */
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+        if ((IPC_IO_CONSOLE_TEXT != msg.opcode) || (0u == msg.length) || (msg.length > IPC_MSG_PAYLOAD_SIZE))
+        {
+            run->errors++;
+            continue;
+        }
+        for (uint32_t index = 0u; index < msg.length; index++)
+        {
+            if ((char)msg.payload[index] != io_check_char(run->received + index))
+            {
+                run->errors++;
+            }
+        }
+        run->received += msg.length;
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: io_check_threads
+********************************************************************************
+* Summary:
+*  Runs the event stream and the console stream at the same time, each with
+*  its own producer and consumer thread.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_check_threads(void)
+{
+    pthread_t threads[4];
+    io_check_run_t events = { 0u, 0u };
+    io_check_run_t console = { 0u, 0u };
+
+    ipc_ring_init(&io_check_events);
+    ipc_ring_init(&io_check_console_ring);
+    io_check_events_done = false;
+    io_check_console_done = false;
+
+    IO_CHECK(0 == pthread_create(&threads[0], NULL, io_check_event_consumer, &events), "event consumer thread");
+    IO_CHECK(0 == pthread_create(&threads[1], NULL, io_check_console_consumer, &console), "console consumer thread");
+    IO_CHECK(0 == pthread_create(&threads[2], NULL, io_check_event_producer, NULL), "event producer thread");
+    IO_CHECK(0 == pthread_create(&threads[3], NULL, io_check_console_producer, NULL), "console producer thread");
+    for (uint32_t index = 0u; index < 4u; index++)
+    {
+        (void)pthread_join(threads[index], NULL);
+    }
+
+    printf("io_check: %u events, %u errors; %u console characters, %u errors\n",
+           events.received, events.errors, console.received, console.errors);
+    IO_CHECK((IO_CHECK_EVENTS == events.received) && (0u == events.errors), "threaded event stream intact");
+    IO_CHECK((IO_CHECK_TEXT == console.received) && (0u == console.errors), "threaded console text intact");
+    IO_CHECK((0u == ipc_ring_count(&io_check_events)) && (0u == ipc_ring_count(&io_check_console_ring)),
+             "both rings drained");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if every check passed, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    io_check_keys();
+    io_check_buttons();
+    io_check_malformed();
+    io_check_event_full();
+    io_check_console();
+    io_check_console_full();
+    io_check_wrap();
+    io_check_threads();
+
+    printf("io_check: %u cases, %u failures\n", io_check_cases, io_check_failures);
+
+    return (0u == io_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,829 @@
+/*******************************************************************************
+* File Name:   log_check.c
+*
+* Description: Host check of the per-core log rings of shared/ipc_log.c. The
+*              log code is compiled as it is; its cache maintenance calls land
+*              in a model of the D-cache of the owner core, in which an
+*              invalidate discards the lines still dirty. Fixed cases cover
+*              the empty and full rings, the dropped count, a record reserved
+*              but not committed, the merge order and the indices wrapping at
+*              2^32, and a drain that interrupts a writer of its own core in
+*              the middle of a record. Then one writer thread per core logs
+*              numbered records, some of them slowly, while a consumer thread
+*              merges the rings and pauses now and then so that they fill
+*              up: a lost, repeated, reordered or torn record is caught.
+*              Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ipc_log.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define LOG_CHECK_PRINT             (10u)
+
+/* Rings, one per core, and the ring of the core that drains them */
+#define LOG_CHECK_RINGS             (3u)
+#define LOG_CHECK_LOCAL             (1u)
+
+/* Records written by each writer thread */
+#define LOG_CHECK_RECORDS           (300000u)
+
+/* One record in this many is filled slowly, giving up the CPU in between */
+#define LOG_CHECK_SLOW              (7u)
+
+/* The consumer pauses once every this many merges, for this long */
+#define LOG_CHECK_PAUSE_PASSES      (64u)
+#define LOG_CHECK_PAUSE_NS          (200000)
+
+/* Dirty lines the cache model can hold */
+#define LOG_CHECK_DIRTY_MAX         (16u)
+
+/* Written to the memory behind a discarded dirty line */
+#define LOG_CHECK_STALE             (0xA5u)
+
+/* Characters of the record number at the start of the text */
+#define LOG_CHECK_NUMBER            (8u)
+
+#define LOG_CHECK(condition, what) \
+    log_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Writer thread of one core */
+typedef struct
+{
+    uint8_t  core;                  /* Ring written */
+    uint32_t full;                  /* Reservations refused by a full ring */
+} log_check_writer_t;
+
+/* Consumer state of the threaded run */
+typedef struct
+{
+    uint32_t next[LOG_CHECK_RINGS];     /* Next record number expected per ring */
+    uint32_t stamp[LOG_CHECK_RINGS];    /* Timestamp of the last record per ring */
+    uint32_t received;                  /* Records passed to the sink */
+    uint32_t errors;                    /* Records lost, repeated or torn */
+} log_check_consumer_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void log_check_expect(bool condition, const char *what, int line);
+static uint32_t log_check_clock(void);
+static void log_check_dirty(volatile void *addr, uint32_t size);
+static void log_check_fill(char *text, uint8_t core, uint32_t number, uint32_t *length);
+static bool log_check_record_ok(const ipc_log_record_t *record, uint8_t core, uint32_t number);
+static void log_check_collect(const ipc_log_record_t *record, void *arg);
+static void log_check_fixed(void);
+static void log_check_order(void);
+static void log_check_wrap(void);
+static void log_check_interrupted(void);
+static void *log_check_writer(void *arg);
+static void log_check_verify(const ipc_log_record_t *record, void *arg);
+static void log_check_threads(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ipc_log_ring_t log_check_ring[LOG_CHECK_RINGS];
+static ipc_log_ring_t *const log_check_rings[LOG_CHECK_RINGS] =
+{
+    &log_check_ring[0], &log_check_ring[1], &log_check_ring[2]
+};
+
+/* Shared timebase of the writers */
+static uint32_t log_check_time = 0u;
+
+/* D-cache model of the owner core, off during the threaded run */
+static bool log_check_cache = false;
+static uintptr_t log_check_dirty_line[LOG_CHECK_DIRTY_MAX];
+static uint32_t log_check_dirty_count = 0u;
+
+/* Records passed to the sink by the fixed cases */
+static ipc_log_record_t log_check_out[2u * IPC_LOG_DEPTH];
+static uint32_t log_check_out_count = 0u;
+
+/* Writer threads done */
+static uint32_t log_check_finished = 0u;
+
+static uint32_t log_check_cases = 0u;
+static uint32_t log_check_failures = 0u;
+
+
+/*******************************************************************************
+* Function Name: log_check_expect
+********************************************************************************
+* Summary:
+*  Counts a check and prints the first failures.
+*
+* Parameters:
+*  condition: result of the check
+*  what: description of the check
+*  line: source line of the check
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_expect(bool condition, const char *what, int line)
+{
+    log_check_cases++;
+    if (!condition)
+    {
+        log_check_failures++;
+        if (log_check_failures <= LOG_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: log_check_clock
+********************************************************************************
+* Summary:
+*  Timestamp source of all the writers: increments at each reading.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: timestamp
+*
+*******************************************************************************/
+static uint32_t log_check_clock(void)
+{
+    return __atomic_fetch_add(&log_check_time, 1u, __ATOMIC_SEQ_CST);
+}
+
+/*******************************************************************************
+* Function Name: log_check_dirty
+********************************************************************************
+* Summary:
+*  Marks the lines of a range as written by the owner core and not cleaned.
+*
+* Parameters:
+*  addr: start of the range
+*  size: size of the range in bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_dirty(volatile void *addr, uint32_t size)
+{
+    uintptr_t line = (uintptr_t)addr & ~(uintptr_t)(IPC_RING_CACHE_LINE - 1u);
+
+    for (; line < ((uintptr_t)addr + size); line += IPC_RING_CACHE_LINE)
+    {
+        if (log_check_dirty_count < LOG_CHECK_DIRTY_MAX)
+        {
+            log_check_dirty_line[log_check_dirty_count++] = line;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: ipc_cache_clean
+********************************************************************************
+* Summary:
+*  D-cache model: the dirty lines of the range are written back.
+*
+* Parameters:
+*  addr: start of the range
+*  size: size of the range in bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_cache_clean(volatile void *addr, uint32_t size)
+{
+    uint32_t index = 0u;
+
+    if (!log_check_cache)
+    {
+        return;
+    }
+
+    while (index < log_check_dirty_count)
+    {
+        uintptr_t line = log_check_dirty_line[index];
+
+        if (((line + IPC_RING_CACHE_LINE) > (uintptr_t)addr) && (line < ((uintptr_t)addr + size)))
+        {
+            log_check_dirty_line[index] = log_check_dirty_line[--log_check_dirty_count];
+        }
+        else
+        {
+            index++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: ipc_cache_invalidate
+********************************************************************************
+* Summary:
+*  D-cache model: the dirty lines of the range are discarded, the memory
+*  behind them never received the data written.
+*
+* Parameters:
+*  addr: start of the range
+*  size: size of the range in bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_cache_invalidate(volatile void *addr, uint32_t size)
+{
+    uint32_t index = 0u;
+
+    if (!log_check_cache)
+    {
+        return;
+    }
+
+    while (index < log_check_dirty_count)
+    {
+        uintptr_t line = log_check_dirty_line[index];
+
+        if (((line + IPC_RING_CACHE_LINE) > (uintptr_t)addr) && (line < ((uintptr_t)addr + size)))
+        {
+            memset((void *)line, LOG_CHECK_STALE, IPC_RING_CACHE_LINE);
+            log_check_dirty_line[index] = log_check_dirty_line[--log_check_dirty_count];
+        }
+        else
+        {
+            index++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: log_check_fill
+********************************************************************************
+* Summary:
+*  Builds the text of a record: its number in hex, then characters depending
+*  on the core and the number, over a length depending on the number.
+*
+* Parameters:
+*  text: IPC_LOG_TEXT_SIZE characters to fill
+*  core: writing core
+*  number: record number of the writer
+*  length: returns the number of valid characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_fill(char *text, uint8_t core, uint32_t number, uint32_t *length)
+{
+    uint32_t hash = (number * 2654435761u) ^ ((uint32_t)core << 24);
+    char digits[LOG_CHECK_NUMBER + 1u];
+
+    (void)snprintf(digits, sizeof(digits), "%08lx", (unsigned long)number);
+    memcpy(text, digits, LOG_CHECK_NUMBER);
+    for (uint32_t index = LOG_CHECK_NUMBER; index < IPC_LOG_TEXT_SIZE; index++)
+    {
+        text[index] = (char)('a' + ((hash >> ((index & 3u) * 8u)) + index) % 26u);
+    }
+    *length = LOG_CHECK_NUMBER + (number % (IPC_LOG_TEXT_SIZE - LOG_CHECK_NUMBER + 1u));
+}
+
+/*******************************************************************************
+* Function Name: log_check_record_ok
+********************************************************************************
+* Summary:
+*  Compares a record passed to the sink with the one a writer built.
+*
+* Parameters:
+*  record: record received
+*  core: expected writing core
+*  number: expected record number
+*
+* Return:
+*  bool: true if the core, the length and the text match
+*
+*******************************************************************************/
+static bool log_check_record_ok(const ipc_log_record_t *record, uint8_t core, uint32_t number)
+{
+    char text[IPC_LOG_TEXT_SIZE];
+    uint32_t length;
+
+    log_check_fill(text, core, number, &length);
+
+    return (record->core == core) && (record->length == length) &&
+           (record->seq == (record->index + 1u)) && (0 == memcmp(record->text, text, length));
+}
+
+/*******************************************************************************
+* Function Name: log_check_collect
+********************************************************************************
+* Summary:
+*  Sink of the fixed cases: keeps the records in log_check_out.
+*
+* Parameters:
+*  record: record of any ring
+*  arg: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_collect(const ipc_log_record_t *record, void *arg)
+{
+    (void)arg;
+
+    if (log_check_out_count < (sizeof(log_check_out) / sizeof(log_check_out[0])))
+    {
+        log_check_out[log_check_out_count] = *record;
+    }
+    log_check_out_count++;
+}
+
+/*******************************************************************************
+* Function Name: log_check_fixed
+********************************************************************************
+* Summary:
+*  Checks the empty and full ring, the dropped count and a record reserved
+*  but not committed, which holds back the records after it.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_fixed(void)
+{
+    ipc_log_ring_t *ring = &log_check_ring[0];
+    ipc_log_record_t *pending;
+    ipc_log_record_t record;
+    char text[IPC_LOG_TEXT_SIZE];
+    uint32_t length;
+    bool intact = true;
+
+    ipc_log_init(ring);
+    LOG_CHECK(!ipc_log_peek(ring, &record, false), "new ring is empty");
+    LOG_CHECK(0u == ipc_log_dropped(ring), "new ring dropped nothing");
+
+    for (uint32_t number = 0u; number < IPC_LOG_DEPTH; number++)
+    {
+        log_check_fill(text, 0u, number, &length);
+        LOG_CHECK(ipc_log_write(ring, 0u, log_check_clock, text, length), "write into a ring with room");
+    }
+    log_check_fill(text, 0u, IPC_LOG_DEPTH, &length);
+    LOG_CHECK(!ipc_log_write(ring, 0u, log_check_clock, text, length), "write into the full ring fails");
+    LOG_CHECK(NULL == ipc_log_reserve(ring, 0u, log_check_clock), "reserve in the full ring fails");
+    LOG_CHECK(2u == ipc_log_dropped(ring), "refused records counted as dropped");
+
+    for (uint32_t number = 0u; number < IPC_LOG_DEPTH; number++)
+    {
+        if (!ipc_log_peek(ring, &record, false) || !log_check_record_ok(&record, 0u, number))
+        {
+            intact = false;
+        }
+        ipc_log_consume(ring);
+    }
+    LOG_CHECK(intact, "records come out in order and intact");
+    LOG_CHECK(!ipc_log_peek(ring, &record, false), "drained ring is empty");
+
+    /* A reserved record holds back the committed records after it */
+    pending = ipc_log_reserve(ring, 0u, log_check_clock);
+    LOG_CHECK(NULL != pending, "reserve after the drain");
+    log_check_fill(text, 0u, 100u, &length);
+    LOG_CHECK(ipc_log_write(ring, 0u, log_check_clock, text, length), "write after a pending record");
+    LOG_CHECK(!ipc_log_peek(ring, &record, false), "pending record not visible");
+    if (NULL != pending)
+    {
+        log_check_fill(pending->text, 0u, 99u, &length);
+        pending->length = (uint8_t)length;
+        ipc_log_commit(ring, pending);
+    }
+    LOG_CHECK(ipc_log_peek(ring, &record, false) && log_check_record_ok(&record, 0u, 99u),
+              "committed record visible");
+    ipc_log_consume(ring);
+    LOG_CHECK(ipc_log_peek(ring, &record, false) && log_check_record_ok(&record, 0u, 100u),
+              "record after it visible");
+    ipc_log_consume(ring);
+
+    memset(text, 'x', sizeof(text));
+    LOG_CHECK(ipc_log_write(ring, 0u, log_check_clock, text, 2u * IPC_LOG_TEXT_SIZE), "long message written");
+    LOG_CHECK(ipc_log_peek(ring, &record, false) && (IPC_LOG_TEXT_SIZE == record.length),
+              "long message truncated");
+    ipc_log_consume(ring);
+}
+
+/*******************************************************************************
+* Function Name: log_check_order
+********************************************************************************
+* Summary:
+*  Checks that the merge passes the records of all the rings in timestamp
+*  order and empties them.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_order(void)
+{
+    char text[IPC_LOG_TEXT_SIZE];
+    uint32_t length;
+    uint32_t written = 0u;
+    bool ordered = true;
+
+    for (uint32_t core = 0u; core < LOG_CHECK_RINGS; core++)
+    {
+        ipc_log_init(&log_check_ring[core]);
+    }
+
+    /* Interleave the writers unevenly */
+    for (uint32_t number = 0u; number < 20u; number++)
+    {
+        uint8_t core = (uint8_t)((number * number) % LOG_CHECK_RINGS);
+
+        log_check_fill(text, core, number, &length);
+        if (ipc_log_write(&log_check_ring[core], core, log_check_clock, text, length))
+        {
+            written++;
+        }
+    }
+
+    log_check_out_count = 0u;
+    LOG_CHECK(written == ipc_log_merge(log_check_rings, LOG_CHECK_RINGS, LOG_CHECK_LOCAL, log_check_collect, NULL),
+              "merge passes every record");
+    LOG_CHECK(written == log_check_out_count, "sink called once per record");
+    for (uint32_t index = 0u; index < log_check_out_count; index++)
+    {
+        uint32_t number = index;
+
+        if (!log_check_record_ok(&log_check_out[index], (uint8_t)((number * number) % LOG_CHECK_RINGS), number) ||
+            ((0u != index) && ((int32_t)(log_check_out[index].stamp - log_check_out[index - 1u].stamp) <= 0)))
+        {
+            ordered = false;
+        }
+    }
+    LOG_CHECK(ordered, "merged records in timestamp order and intact");
+    LOG_CHECK(0u == ipc_log_merge(log_check_rings, LOG_CHECK_RINGS, LOG_CHECK_LOCAL, log_check_collect, NULL),
+              "merged rings are empty");
+}
+
+/*******************************************************************************
+* Function Name: log_check_wrap
+********************************************************************************
+* Summary:
+*  Fills and drains a ring while its free-running indices wrap at 2^32.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_wrap(void)
+{
+    ipc_log_ring_t *ring = &log_check_ring[2];
+    ipc_log_record_t record;
+    char text[IPC_LOG_TEXT_SIZE];
+    uint32_t length;
+    uint32_t written = 0u;
+    uint32_t read = 0u;
+    bool in_order = true;
+
+    /* Start one and a half rings before the wrap: every slot then holds an
+     * older record when the index reaches 2^32 - 1, as after a long run */
+    ipc_log_init(ring);
+    ring->head = UINT32_MAX - IPC_LOG_DEPTH - (IPC_LOG_DEPTH / 2u);
+    ring->tail = ring->head;
+
+    for (uint32_t round = 0u; round < 4u; round++)
+    {
+        for (;;)
+        {
+            log_check_fill(text, 2u, written, &length);
+            if (!ipc_log_write(ring, 2u, log_check_clock, text, length))
+            {
+                break;
+            }
+            written++;
+        }
+        while (ipc_log_peek(ring, &record, false))
+        {
+            if (!log_check_record_ok(&record, 2u, read))
+            {
+                in_order = false;
+            }
+            ipc_log_consume(ring);
+            read++;
+        }
+    }
+    LOG_CHECK((4u * IPC_LOG_DEPTH) == written, "ring holds IPC_LOG_DEPTH records across the wrap");
+    LOG_CHECK(read == written, "every record read across the wrap");
+    LOG_CHECK(in_order, "records in order and intact across the wrap");
+}
+
+/*******************************************************************************
+* Function Name: log_check_interrupted
+********************************************************************************
+* Summary:
+*  A writer of the owner core has reserved a record and filled half of it,
+*  still in its D-cache, when the drain runs on the same core. The drain must
+*  not discard these lines: the record is complete once committed.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_interrupted(void)
+{
+    ipc_log_ring_t *local = &log_check_ring[LOG_CHECK_LOCAL];
+    ipc_log_record_t *pending;
+    char text[IPC_LOG_TEXT_SIZE];
+    uint32_t length;
+
+    for (uint32_t core = 0u; core < LOG_CHECK_RINGS; core++)
+    {
+        ipc_log_init(&log_check_ring[core]);
+    }
+    log_check_cache = true;
+    log_check_dirty_count = 0u;
+
+    log_check_fill(text, LOG_CHECK_LOCAL, 1u, &length);
+    (void)ipc_log_write(local, LOG_CHECK_LOCAL, log_check_clock, text, length);
+
+    pending = ipc_log_reserve(local, LOG_CHECK_LOCAL, log_check_clock);
+    LOG_CHECK(NULL != pending, "reserve on the owner core");
+    if (NULL == pending)
+    {
+        log_check_cache = false;
+        return;
+    }
+    log_check_fill(text, LOG_CHECK_LOCAL, 2u, &length);
+    log_check_dirty(pending, sizeof(ipc_log_record_t));
+    memcpy(pending->text, text, length / 2u);
+
+    /* The drain interrupts the writer */
+    log_check_out_count = 0u;
+    LOG_CHECK(1u == ipc_log_merge(log_check_rings, LOG_CHECK_RINGS, LOG_CHECK_LOCAL, log_check_collect, NULL),
+              "drain passes the committed record only");
+
+    memcpy(&pending->text[length / 2u], &text[length / 2u], length - (length / 2u));
+    pending->length = (uint8_t)length;
+    ipc_log_commit(local, pending);
+
+    LOG_CHECK(1u == ipc_log_merge(log_check_rings, LOG_CHECK_RINGS, LOG_CHECK_LOCAL, log_check_collect, NULL),
+              "record passed once committed");
+    LOG_CHECK((2u == log_check_out_count) && log_check_record_ok(&log_check_out[0], LOG_CHECK_LOCAL, 1u) &&
+              log_check_record_ok(&log_check_out[1], LOG_CHECK_LOCAL, 2u),
+              "record interrupted by the drain of its own core intact");
+    LOG_CHECK(0u == log_check_dirty_count, "record cleaned by the commit");
+
+    log_check_cache = false;
+}
+
+/*******************************************************************************
+* Function Name: log_check_writer
+********************************************************************************
+* Summary:
+*  Writer thread of one core: logs the numbered records, retrying while the
+*  ring is full. Every LOG_CHECK_SLOW-th record gives up the CPU between its
+*  reservation and its commit.
+*
+* Parameters:
+*  arg: log_check_writer_t of the core
+*
+* Return:
+*  NULL
+*
+*******************************************************************************/
+static void *log_check_writer(void *arg)
+{
+    log_check_writer_t *writer = (log_check_writer_t *)arg;
+    ipc_log_ring_t *ring = &log_check_ring[writer->core];
+    char text[IPC_LOG_TEXT_SIZE];
+    uint32_t length;
+
+    for (uint32_t number = 0u; number < LOG_CHECK_RECORDS; number++)
+    {
+        ipc_log_record_t *record;
+
+        log_check_fill(text, writer->core, number, &length);
+        while (NULL == (record = ipc_log_reserve(ring, writer->core, log_check_clock)))
+        {
+            writer->full++;
+            sched_yield();
+        }
+
+        memcpy(record->text, text, length / 2u);
+        if (0u == (number % LOG_CHECK_SLOW))
+        {
+            sched_yield();
+        }
+        memcpy(&record->text[length / 2u], &text[length / 2u], length - (length / 2u));
+        record->length = (uint8_t)length;
+        ipc_log_commit(ring, record);
+    }
+    (void)__atomic_fetch_add(&log_check_finished, 1u, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: log_check_verify
+********************************************************************************
+* Summary:
+*  Sink of the threaded run: checks that each ring delivers every record
+*  once, in order, intact and with increasing timestamps.
+*
+* Parameters:
+*  record: record of any ring
+*  arg: log_check_consumer_t
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_verify(const ipc_log_record_t *record, void *arg)
+{
+    log_check_consumer_t *consumer = (log_check_consumer_t *)arg;
+    uint8_t core = record->core;
+
+    consumer->received++;
+    if (core >= LOG_CHECK_RINGS)
+    {
+        consumer->errors++;
+        return;
+    }
+
+    if (!log_check_record_ok(record, core, consumer->next[core]) ||
+        ((0u != consumer->next[core]) && ((int32_t)(record->stamp - consumer->stamp[core]) <= 0)))
+    {
+        consumer->errors++;
+    }
+    consumer->next[core]++;
+    consumer->stamp[core] = record->stamp;
+}
+
+/*******************************************************************************
+* Function Name: log_check_threads
+********************************************************************************
+* Summary:
+*  Runs one writer thread per ring while this thread drains them, as the
+*  owner core does.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void log_check_threads(void)
+{
+    pthread_t threads[LOG_CHECK_RINGS];
+    log_check_writer_t writer[LOG_CHECK_RINGS];
+    log_check_consumer_t consumer;
+    uint32_t full = 0u;
+    uint32_t dropped = 0u;
+    uint32_t passes = 0u;
+    bool complete = true;
+    const struct timespec pause = { 0, LOG_CHECK_PAUSE_NS };
+
+    memset(&consumer, 0, sizeof(consumer));
+    log_check_finished = 0u;
+    for (uint32_t core = 0u; core < LOG_CHECK_RINGS; core++)
+    {
+        ipc_log_init(&log_check_ring[core]);
+        writer[core].core = (uint8_t)core;
+        writer[core].full = 0u;
+    }
+    for (uint32_t core = 0u; core < LOG_CHECK_RINGS; core++)
+    {
+        LOG_CHECK(0 == pthread_create(&threads[core], NULL, log_check_writer, &writer[core]), "writer thread");
+    }
+
+    /* Drain until the writers are done and a last merge finds nothing */
+    for (;;)
+    {
+        bool done = (LOG_CHECK_RINGS == __atomic_load_n(&log_check_finished, __ATOMIC_ACQUIRE));
+
+        if ((0u == ipc_log_merge(log_check_rings, LOG_CHECK_RINGS, LOG_CHECK_LOCAL, log_check_verify, &consumer)) &&
+            done)
+        {
+            break;
+        }
+        /* Now and then let the writers run ahead, so that the rings fill up */
+        if (0u == (++passes % LOG_CHECK_PAUSE_PASSES))
+        {
+            (void)nanosleep(&pause, NULL);
+        }
+        sched_yield();
+    }
+    for (uint32_t core = 0u; core < LOG_CHECK_RINGS; core++)
+    {
+        (void)pthread_join(threads[core], NULL);
+    }
+
+    for (uint32_t core = 0u; core < LOG_CHECK_RINGS; core++)
+    {
+        full += writer[core].full;
+        dropped += ipc_log_dropped(&log_check_ring[core]);
+        if (LOG_CHECK_RECORDS != consumer.next[core])
+        {
+            complete = false;
+        }
+    }
+
+    printf("log_check: %u writers, %u records, %u errors, %u refused while full\n",
+           LOG_CHECK_RINGS, consumer.received, consumer.errors, full);
+    LOG_CHECK(complete && ((LOG_CHECK_RINGS * LOG_CHECK_RECORDS) == consumer.received),
+              "every record of every writer received once");
+    LOG_CHECK(0u == consumer.errors, "records in order, intact and with increasing timestamps");
+    LOG_CHECK(dropped == full, "dropped count matches the refused reservations");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the fixed cases and the threaded run.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if all checks pass, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    printf("log_check: %u records of %u bytes per ring\n", IPC_LOG_DEPTH, (unsigned int)sizeof(ipc_log_record_t));
+
+    log_check_fixed();
+    log_check_order();
+    log_check_wrap();
+    log_check_interrupted();
+    log_check_threads();
+
+    printf("log_check: %u cases, %u failures\n", log_check_cases, log_check_failures);
+
+    return (0u == log_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,512 @@
+/*******************************************************************************
+* File Name:   param_check.c
+*
+* Description: Host check of the parameter snapshot (param.h). Round trips
+*              the defaults, the limits and random valid sets, rejects every
+*              single-bit flip, truncation and out-of-range value without
+*              touching the values in use, loads older and newer snapshots,
+*              and saves and loads the parameters through the simulated work
+*              flash. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "cyhal.h"
+#include "cycfg.h"
+#include "crc32.h"
+#include "param.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define PARAM_CHECK_PRINT           (10u)
+
+/* Random parameter sets round tripped */
+#define PARAM_CHECK_RANDOM_SETS     (10000u)
+
+#define PARAM_CHECK(condition, what) \
+    param_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void param_check_expect(bool condition, const char *what, int line);
+static uint32_t param_check_rand(uint32_t *state);
+static bool param_check_round_trip(const uint32_t *values);
+static void param_check_sets(void);
+static void param_check_corrupt(void);
+static void param_check_range(void);
+static void param_check_versions(void);
+static void param_check_flash(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t param_check_cases = 0u;
+static uint32_t param_check_failures = 0u;
+
+
+/* Counts a check and prints the first failures */
+static void param_check_expect(bool condition, const char *what, int line)
+{
+    param_check_cases++;
+    if (!condition)
+    {
+        param_check_failures++;
+        if (param_check_failures <= PARAM_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/* xorshift32, the same sequence on every run */
+static uint32_t param_check_rand(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+/* The simulated HAL is linked without the CAN FD demo that CANFD_config refers to */
+void canfd_rx_callback(bool rxFIFOMsg, uint8_t msgBufOrRxFIFONum, cy_stc_canfd_rx_buffer_t *basemsg)
+{
+    (void)rxFIFOMsg;
+    (void)msgBufOrRxFIFONum;
+    (void)basemsg;
+}
+
+/*******************************************************************************
+* Function Name: param_check_round_trip
+********************************************************************************
+* Summary:
+*  Serializes a parameter set and reads it back into a buffer filled with
+*  another value.
+*
+* Parameters:
+*  values: valid parameter set
+*
+* Return:
+*  bool: true if the snapshot has the expected size and reads back equal
+*
+*******************************************************************************/
+static bool param_check_round_trip(const uint32_t *values)
+{
+    uint8_t snapshot[PARAM_SNAPSHOT_MAX_SIZE];
+    uint32_t loaded[PARAM_NUM];
+    uint32_t expected = PARAM_SNAPSHOT_HEADER_SIZE + PARAM_SNAPSHOT_CRC_SIZE;
+    uint32_t length;
+
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        expected += (uint32_t)param_get_desc((param_id_t)index)->type;
+    }
+    length = param_serialize(values, snapshot, sizeof(snapshot));
+    memset(loaded, 0xA5, sizeof(loaded));
+
+    return (expected == length) && (CY_RSLT_SUCCESS == param_deserialize(snapshot, length, loaded)) &&
+           (0 == memcmp(values, loaded, sizeof(loaded)));
+}
+
+/*******************************************************************************
+* Function Name: param_check_sets
+********************************************************************************
+* Summary:
+*  Round trips the defaults, every parameter at its maximum and at its
+*  minimum, and random valid sets.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_check_sets(void)
+{
+    uint32_t values[PARAM_NUM];
+    uint32_t state = 0x2545F491u;
+    uint32_t valid = 0u;
+    bool matched = true;
+
+    param_get_defaults(values);
+    PARAM_CHECK(CY_RSLT_SUCCESS == param_validate(values), "the defaults are valid");
+    PARAM_CHECK(param_check_round_trip(values), "round trip of the defaults");
+
+    /* The limits, with the press counts increasing and a non-empty window */
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        values[index] = param_get_desc((param_id_t)index)->max;
+    }
+    values[PARAM_QUICK_PRESS_COUNT] -= 2u;
+    values[PARAM_SHORT_PRESS_COUNT] -= 1u;
+    values[PARAM_ADC_WINDOW_LOW_MV] -= 1u;
+    PARAM_CHECK(param_check_round_trip(values), "round trip of the maxima");
+
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        values[index] = param_get_desc((param_id_t)index)->min;
+    }
+    values[PARAM_SHORT_PRESS_COUNT] += 1u;
+    values[PARAM_LONG_PRESS_COUNT] += 2u;
+    values[PARAM_ADC_WINDOW_HIGH_MV] += 1u;
+    PARAM_CHECK(param_check_round_trip(values), "round trip of the minima");
+
+    /* Random values within the limits; the invalid orders are rejected */
+    for (uint32_t set = 0u; set < PARAM_CHECK_RANDOM_SETS; set++)
+    {
+        for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+        {
+            const param_desc_t *desc = param_get_desc((param_id_t)index);
+            uint32_t span = desc->max - desc->min;
+
+            values[index] = desc->min + ((span == UINT32_MAX) ? param_check_rand(&state) :
+                                         (param_check_rand(&state) % (span + 1u)));
+        }
+        if (CY_RSLT_SUCCESS == param_validate(values))
+        {
+            valid++;
+            matched = matched && param_check_round_trip(values);
+        }
+    }
+    PARAM_CHECK(matched, "round trip of random sets");
+    PARAM_CHECK(valid > (PARAM_CHECK_RANDOM_SETS / 16u), "random sets cover valid values");
+}
+
+/*******************************************************************************
+* Function Name: param_check_corrupt
+********************************************************************************
+* Summary:
+*  Flips each bit of a snapshot and truncates it. Every corruption is
+*  rejected and leaves the values of the caller unchanged.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_check_corrupt(void)
+{
+    uint8_t snapshot[PARAM_SNAPSHOT_MAX_SIZE];
+    uint32_t values[PARAM_NUM];
+    uint32_t loaded[PARAM_NUM];
+    uint32_t defaults[PARAM_NUM];
+    uint32_t length;
+    bool rejected = true;
+    bool unchanged = true;
+
+    param_get_defaults(defaults);
+    memcpy(values, defaults, sizeof(values));
+    values[PARAM_CAN_ID] = 0x123u;
+    values[PARAM_BAUD_RATE] = 921600u;
+    length = param_serialize(values, snapshot, sizeof(snapshot));
+
+    for (uint32_t bit = 0u; bit < (8u * length); bit++)
+    {
+        memcpy(loaded, defaults, sizeof(loaded));
+        snapshot[bit / 8u] ^= (uint8_t)(1u << (bit % 8u));
+        rejected = rejected && (PARAM_RSLT_ERR_SNAPSHOT == param_deserialize(snapshot, length, loaded));
+        unchanged = unchanged && (0 == memcmp(loaded, defaults, sizeof(loaded)));
+        snapshot[bit / 8u] ^= (uint8_t)(1u << (bit % 8u));
+    }
+    PARAM_CHECK(rejected, "every single-bit flip is rejected");
+    PARAM_CHECK(unchanged, "a rejected snapshot leaves the values");
+
+    rejected = true;
+    unchanged = true;
+    for (uint32_t size = 0u; size < length; size++)
+    {
+        memcpy(loaded, defaults, sizeof(loaded));
+        rejected = rejected && (PARAM_RSLT_ERR_SNAPSHOT == param_deserialize(snapshot, size, loaded));
+        unchanged = unchanged && (0 == memcmp(loaded, defaults, sizeof(loaded)));
+    }
+    PARAM_CHECK(rejected, "every truncation is rejected");
+    PARAM_CHECK(unchanged, "a truncated snapshot leaves the values");
+
+    /* Erased flash */
+    memset(snapshot, 0xFF, sizeof(snapshot));
+    memcpy(loaded, defaults, sizeof(loaded));
+    PARAM_CHECK(PARAM_RSLT_ERR_SNAPSHOT == param_deserialize(snapshot, sizeof(snapshot), loaded),
+                "erased flash is rejected");
+    PARAM_CHECK(0 == memcmp(loaded, defaults, sizeof(loaded)), "erased flash leaves the values");
+}
+
+/*******************************************************************************
+* Function Name: param_check_range
+********************************************************************************
+* Summary:
+*  Rejects each parameter just past its limits, the press counts out of
+*  order and an empty alarm window, in param_validate(), param_set() and in
+*  a snapshot with a valid CRC.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_check_range(void)
+{
+    uint8_t snapshot[PARAM_SNAPSHOT_MAX_SIZE];
+    uint32_t values[PARAM_NUM];
+    uint32_t loaded[PARAM_NUM];
+    uint32_t defaults[PARAM_NUM];
+    uint32_t length;
+    bool rejected = true;
+    bool unchanged = true;
+    bool accepted = true;
+
+    param_get_defaults(defaults);
+    param_reset();
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        const param_desc_t *desc = param_get_desc((param_id_t)index);
+
+        memcpy(values, defaults, sizeof(values));
+        if (desc->max < UINT32_MAX)
+        {
+            values[index] = desc->max + 1u;
+            rejected = rejected && (PARAM_RSLT_ERR_RANGE == param_validate(values));
+            rejected = rejected && (PARAM_RSLT_ERR_RANGE == param_set((param_id_t)index, desc->max + 1u));
+
+            /* Written with a valid CRC, as by another firmware */
+            length = param_serialize(values, snapshot, sizeof(snapshot));
+            memcpy(loaded, defaults, sizeof(loaded));
+            rejected = rejected && (PARAM_RSLT_ERR_RANGE == param_deserialize(snapshot, length, loaded));
+            unchanged = unchanged && (0 == memcmp(loaded, defaults, sizeof(loaded)));
+        }
+        if (desc->min > 0u)
+        {
+            values[index] = desc->min - 1u;
+            rejected = rejected && (PARAM_RSLT_ERR_RANGE == param_validate(values));
+            rejected = rejected && (PARAM_RSLT_ERR_RANGE == param_set((param_id_t)index, desc->min - 1u));
+        }
+        unchanged = unchanged && (param_get((param_id_t)index) == defaults[index]);
+    }
+    PARAM_CHECK(rejected, "a value past its limits is rejected");
+    PARAM_CHECK(unchanged, "a rejected value leaves the parameters");
+
+    /* The press counts must increase and the window must not be empty */
+    PARAM_CHECK(PARAM_RSLT_ERR_RANGE == param_set(PARAM_QUICK_PRESS_COUNT, defaults[PARAM_SHORT_PRESS_COUNT]),
+                "a quick press as long as a short press is rejected");
+    PARAM_CHECK(PARAM_RSLT_ERR_RANGE == param_set(PARAM_LONG_PRESS_COUNT, defaults[PARAM_SHORT_PRESS_COUNT]),
+                "a long press as long as a short press is rejected");
+    PARAM_CHECK(PARAM_RSLT_ERR_RANGE == param_set(PARAM_ADC_WINDOW_LOW_MV, defaults[PARAM_ADC_WINDOW_HIGH_MV]),
+                "an empty alarm window is rejected");
+
+    /* Values at the limits are taken */
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        const param_desc_t *desc = param_get_desc((param_id_t)index);
+
+        param_reset();
+        if (CY_RSLT_SUCCESS == param_set((param_id_t)index, desc->min))
+        {
+            accepted = accepted && (desc->min == param_get((param_id_t)index));
+        }
+        param_reset();
+        if (CY_RSLT_SUCCESS == param_set((param_id_t)index, desc->max))
+        {
+            accepted = accepted && (desc->max == param_get((param_id_t)index));
+        }
+    }
+    PARAM_CHECK(accepted, "an accepted value is in use");
+    param_reset();
+    PARAM_CHECK(CY_RSLT_SUCCESS == param_set(PARAM_CAN_DLC, 0u), "a value at the minimum is accepted");
+    PARAM_CHECK(CY_RSLT_SUCCESS == param_set(PARAM_ADC_DELAY_MS, 10000u), "a value at the maximum is accepted");
+    param_reset();
+}
+
+/*******************************************************************************
+* Function Name: param_check_versions
+********************************************************************************
+* Summary:
+*  Loads a snapshot of an older firmware, with fewer parameters, and of a
+*  newer one, with more. The missing parameters keep the values given, the
+*  unknown ones are ignored, and another snapshot version is rejected.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_check_versions(void)
+{
+    uint8_t snapshot[PARAM_SNAPSHOT_MAX_SIZE];
+    uint32_t values[PARAM_NUM];
+    uint32_t loaded[PARAM_NUM];
+    uint32_t defaults[PARAM_NUM];
+    uint32_t length;
+    uint32_t payload;
+    uint32_t last;
+    uint32_t crc;
+
+    param_get_defaults(defaults);
+    memcpy(values, defaults, sizeof(values));
+    values[PARAM_CAN_ID] = 0x456u;
+    values[PARAM_CONSOLE_UI] = 1u;
+    length = param_serialize(values, snapshot, sizeof(snapshot));
+    payload = length - PARAM_SNAPSHOT_HEADER_SIZE - PARAM_SNAPSHOT_CRC_SIZE;
+
+    /* Older: without the last parameter */
+    last = (uint32_t)param_get_desc((param_id_t)(PARAM_NUM - 1u))->type;
+    snapshot[5] = (uint8_t)(PARAM_NUM - 1u);
+    snapshot[6] = (uint8_t)(payload - last);
+    snapshot[7] = (uint8_t)((payload - last) >> 8);
+    crc = crc32_compute(snapshot, PARAM_SNAPSHOT_HEADER_SIZE + payload - last);
+    for (uint32_t byte = 0u; byte < PARAM_SNAPSHOT_CRC_SIZE; byte++)
+    {
+        snapshot[PARAM_SNAPSHOT_HEADER_SIZE + payload - last + byte] = (uint8_t)(crc >> (8u * byte));
+    }
+    memcpy(loaded, defaults, sizeof(loaded));
+    PARAM_CHECK(CY_RSLT_SUCCESS == param_deserialize(snapshot, length - last, loaded), "an older snapshot loads");
+    PARAM_CHECK((0x456u == loaded[PARAM_CAN_ID]) && (defaults[PARAM_CONSOLE_UI] == loaded[PARAM_CONSOLE_UI]),
+                "a parameter missing in an older snapshot keeps its value");
+
+    /* Newer: one more 32-bit parameter */
+    length = param_serialize(values, snapshot, sizeof(snapshot));
+    snapshot[5] = (uint8_t)(PARAM_NUM + 1u);
+    snapshot[6] = (uint8_t)(payload + 4u);
+    snapshot[7] = (uint8_t)((payload + 4u) >> 8);
+    memset(&snapshot[PARAM_SNAPSHOT_HEADER_SIZE + payload], 0xEE, 4u);
+    crc = crc32_compute(snapshot, PARAM_SNAPSHOT_HEADER_SIZE + payload + 4u);
+    for (uint32_t byte = 0u; byte < PARAM_SNAPSHOT_CRC_SIZE; byte++)
+    {
+        snapshot[PARAM_SNAPSHOT_HEADER_SIZE + payload + 4u + byte] = (uint8_t)(crc >> (8u * byte));
+    }
+    memset(loaded, 0, sizeof(loaded));
+    PARAM_CHECK(CY_RSLT_SUCCESS == param_deserialize(snapshot, length + 4u, loaded), "a newer snapshot loads");
+    PARAM_CHECK(0 == memcmp(loaded, values, sizeof(loaded)), "an unknown parameter is ignored");
+
+    /* Another layout version */
+    length = param_serialize(values, snapshot, sizeof(snapshot));
+    snapshot[4] = (uint8_t)(PARAM_SNAPSHOT_VERSION + 1u);
+    crc = crc32_compute(snapshot, length - PARAM_SNAPSHOT_CRC_SIZE);
+    for (uint32_t byte = 0u; byte < PARAM_SNAPSHOT_CRC_SIZE; byte++)
+    {
+        snapshot[length - PARAM_SNAPSHOT_CRC_SIZE + byte] = (uint8_t)(crc >> (8u * byte));
+    }
+    memcpy(loaded, defaults, sizeof(loaded));
+    PARAM_CHECK(PARAM_RSLT_ERR_SNAPSHOT == param_deserialize(snapshot, length, loaded),
+                "another snapshot version is rejected");
+    PARAM_CHECK(0 == memcmp(loaded, defaults, sizeof(loaded)), "another version leaves the values");
+
+    /* A buffer too small for the snapshot */
+    PARAM_CHECK(0u == param_serialize(values, snapshot, length - 1u), "serialize into a short buffer fails");
+}
+
+/*******************************************************************************
+* Function Name: param_check_flash
+********************************************************************************
+* Summary:
+*  Loads from the erased work flash, then saves changed parameters, resets
+*  them and loads them back, twice so that the second save erases the first.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_check_flash(void)
+{
+    uint32_t defaults[PARAM_NUM];
+    bool loaded = true;
+
+    param_get_defaults(defaults);
+    PARAM_CHECK(CY_RSLT_SUCCESS != param_load(), "the erased flash holds no snapshot");
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        loaded = loaded && (defaults[index] == param_get((param_id_t)index));
+    }
+    PARAM_CHECK(loaded, "the defaults are used without a snapshot");
+
+    for (uint32_t round = 0u; round < 2u; round++)
+    {
+        PARAM_CHECK(CY_RSLT_SUCCESS == param_set(PARAM_CAN_ID, 0x100u + round), "set of the CAN identifier");
+        PARAM_CHECK(CY_RSLT_SUCCESS == param_set(PARAM_LONG_PRESS_COUNT, 300u + round), "set of the long press");
+        PARAM_CHECK(CY_RSLT_SUCCESS == param_save(), "save into the work flash");
+        param_reset();
+        PARAM_CHECK(0x100u != param_get(PARAM_CAN_ID), "the reset restores the defaults");
+        PARAM_CHECK(CY_RSLT_SUCCESS == param_load(), "load from the work flash");
+        PARAM_CHECK((0x100u + round) == param_get(PARAM_CAN_ID), "the saved CAN identifier is loaded");
+        PARAM_CHECK((300u + round) == param_get(PARAM_LONG_PRESS_COUNT), "the saved long press is loaded");
+        PARAM_CHECK(defaults[PARAM_BAUD_RATE] == param_get(PARAM_BAUD_RATE), "an unchanged parameter is loaded");
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the cases. The flash case expects an erased work flash, see the
+*  param_check target of the Makefile.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if all checks pass, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    param_check_sets();
+    param_check_corrupt();
+    param_check_range();
+    param_check_versions();
+    param_check_flash();
+
+    printf("param_check: %u cases, %u failures\n", param_check_cases, param_check_failures);
+
+    return (0u == param_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,358 @@
+/*******************************************************************************
+* File Name:   pool_bench.c
+*
+* Description: Host benchmark of the block pools of block_pool.c against
+*              malloc() and free() of the host C library. 1 to 8 threads
+*              each take a burst of blocks and release them, over and over,
+*              from one shared pool or from the heap; the tool reports the
+*              time per allocation and release pair under that contention.
+*              Every pool block carries an owner word that is swapped on
+*              allocation, so a block handed out twice is caught. A pool
+*              smaller than the demand checks the empty pool path, and the
+*              free list and statistics are checked after each run. Exits
+*              with 1 on an error.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "block_pool.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Block of the CAN FD receive pool, and blocks held by a thread at a time */
+#define POOL_BENCH_BLOCK_SIZE       (72u)
+#define POOL_BENCH_BURST            (4u)
+
+/* Threads of the largest run, and allocation and release pairs per thread */
+#define POOL_BENCH_MAX_THREADS      (8u)
+#define POOL_BENCH_PAIRS            (1000000u)
+
+/* Blocks of the pool large enough for every thread, and of the one that
+ * runs out with all threads */
+#define POOL_BENCH_BLOCKS           (POOL_BENCH_MAX_THREADS * POOL_BENCH_BURST)
+#define POOL_BENCH_SCARCE_BLOCKS    (POOL_BENCH_BLOCKS / 2u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Work of one thread */
+typedef struct
+{
+    pthread_t            thread;
+    pthread_barrier_t   *start;
+    block_pool_t        *pool;          /* NULL to use malloc() */
+    uint32_t             id;            /* Owner word, never 0 */
+    uint32_t             pairs;
+    uint32_t             fails;
+    uint32_t             errors;
+} pool_bench_worker_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint64_t pool_bench_ns(void);
+static void *pool_bench_worker(void *arg);
+static double pool_bench_run(block_pool_t *pool, uint32_t threads, uint32_t *fails, uint32_t *errors);
+static uint32_t pool_bench_check(block_pool_t *pool, uint32_t pairs, uint32_t fails);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+BLOCK_POOL_DEFINE(pool_bench_pool, POOL_BENCH_BLOCK_SIZE, POOL_BENCH_BLOCKS);
+BLOCK_POOL_DEFINE(pool_bench_scarce, POOL_BENCH_BLOCK_SIZE, POOL_BENCH_SCARCE_BLOCKS);
+
+
+/* Monotonic time in nanoseconds */
+static uint64_t pool_bench_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: pool_bench_worker
+********************************************************************************
+* Summary:
+*  Takes POOL_BENCH_BURST blocks, writes them and releases them until the
+*  pairs of the thread are done. A pool block is claimed by swapping its
+*  owner word from 0, and given back by clearing it before the release.
+*
+* Parameters:
+*  arg: pool_bench_worker_t of the thread
+*
+* Return:
+*  void*: NULL
+*
+*******************************************************************************/
+static void *pool_bench_worker(void *arg)
+{
+    pool_bench_worker_t *worker = (pool_bench_worker_t *)arg;
+    uint32_t *held[POOL_BENCH_BURST];
+    uint32_t done;
+    uint32_t index;
+
+    (void)pthread_barrier_wait(worker->start);
+
+    for (done = 0u; done < worker->pairs; done += POOL_BENCH_BURST)
+    {
+        for (index = 0u; index < POOL_BENCH_BURST; index++)
+        {
+            if (NULL == worker->pool)
+            {
+                held[index] = malloc(POOL_BENCH_BLOCK_SIZE);
+                held[index][0] = worker->id;
+            }
+            else
+            {
+                held[index] = block_pool_alloc(worker->pool);
+                if (NULL == held[index])
+                {
+                    worker->fails++;
+                }
+                else if (0u != __atomic_exchange_n(&held[index][0], worker->id, __ATOMIC_ACQ_REL))
+                {
+                    worker->errors++;
+                }
+            }
+            if (NULL != held[index])
+            {
+                held[index][1] = done + index;
+            }
+        }
+        for (index = 0u; index < POOL_BENCH_BURST; index++)
+        {
+            if (NULL == held[index])
+            {
+                continue;
+            }
+            if ((worker->id != held[index][0]) || ((done + index) != held[index][1]))
+            {
+                worker->errors++;
+            }
+            if (NULL == worker->pool)
+            {
+                free(held[index]);
+            }
+            else
+            {
+                __atomic_store_n(&held[index][0], 0u, __ATOMIC_RELEASE);
+                if (!block_pool_free(worker->pool, held[index]))
+                {
+                    worker->errors++;
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: pool_bench_run
+********************************************************************************
+* Summary:
+*  Runs the workers on one pool, or on the heap, from a common start.
+*
+* Parameters:
+*  pool: pool, NULL for malloc()
+*  threads: number of threads
+*  fails: allocations from an empty pool, summed over the threads
+*  errors: blocks found with another owner or other contents, added
+*
+* Return:
+*  double: ns per allocation and release pair of one thread
+*
+*******************************************************************************/
+static double pool_bench_run(block_pool_t *pool, uint32_t threads, uint32_t *fails, uint32_t *errors)
+{
+    pool_bench_worker_t workers[POOL_BENCH_MAX_THREADS];
+    pthread_barrier_t start;
+    uint64_t begin;
+    uint32_t index;
+
+    if (NULL != pool)
+    {
+        block_pool_init(pool);
+        memset(pool->storage, 0, (size_t)pool->block_size * pool->block_count);
+    }
+    (void)pthread_barrier_init(&start, NULL, threads + 1u);
+    for (index = 0u; index < threads; index++)
+    {
+        workers[index] = (pool_bench_worker_t){ .start = &start, .pool = pool, .id = index + 1u,
+                                                .pairs = POOL_BENCH_PAIRS };
+        (void)pthread_create(&workers[index].thread, NULL, pool_bench_worker, &workers[index]);
+    }
+    (void)pthread_barrier_wait(&start);
+    begin = pool_bench_ns();
+    *fails = 0u;
+    for (index = 0u; index < threads; index++)
+    {
+        (void)pthread_join(workers[index].thread, NULL);
+        *fails += workers[index].fails;
+        *errors += workers[index].errors;
+    }
+    (void)pthread_barrier_destroy(&start);
+
+    return (double)(pool_bench_ns() - begin) / (double)POOL_BENCH_PAIRS;
+}
+
+/*******************************************************************************
+* Function Name: pool_bench_check
+********************************************************************************
+* Summary:
+*  Checks the statistics of a pool after a run, that its free list holds
+*  every block once, and that foreign and double releases are rejected.
+*
+* Parameters:
+*  pool: pool of the run
+*  pairs: pairs attempted by all threads
+*  fails: allocations from an empty pool
+*
+* Return:
+*  uint32_t: number of failed checks
+*
+*******************************************************************************/
+static uint32_t pool_bench_check(block_pool_t *pool, uint32_t pairs, uint32_t fails)
+{
+    static void *taken[POOL_BENCH_BLOCKS];
+    block_pool_stats_t stats;
+    uint32_t errors = 0u;
+    uint32_t count;
+    uint32_t index;
+
+    block_pool_get_stats(pool, &stats);
+    if ((0u != stats.in_use) || (stats.peak > stats.block_count) || (stats.fails != fails) ||
+        ((stats.allocs + stats.fails) != pairs) || (0u != stats.bad_frees))
+    {
+        printf("  %s statistics: %u in use, peak %u of %u, %u allocated, %u failed (%u counted), %u bad frees\n",
+               stats.name, stats.in_use, stats.peak, stats.block_count, stats.allocs, stats.fails, fails,
+               stats.bad_frees);
+        errors++;
+    }
+
+    /* Each block once, then an empty pool */
+    for (count = 0u; NULL != (taken[count] = block_pool_alloc(pool)); count++)
+    {
+        for (index = 0u; index < count; index++)
+        {
+            if (taken[index] == taken[count])
+            {
+                errors++;
+            }
+        }
+        if (count == stats.block_count)
+        {
+            break;
+        }
+    }
+    if (count != stats.block_count)
+    {
+        printf("  %s free list holds %u of %u blocks\n", stats.name, count, stats.block_count);
+        errors++;
+    }
+    for (index = 0u; index < count; index++)
+    {
+        (void)block_pool_free(pool, taken[index]);
+    }
+
+    /* A block of the middle of another block, then a double release */
+    if ((count > 0u) &&
+        (block_pool_free(pool, (uint8_t *)taken[0] + 4u) || block_pool_free(pool, taken[0])))
+    {
+        printf("  %s accepted a bad release\n", stats.name);
+        errors++;
+    }
+
+    return errors;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Times the pool and malloc() with 1, 2, 4 and 8 threads, then runs all
+*  threads on the scarce pool.
+*
+*******************************************************************************/
+int main(void)
+{
+    uint32_t errors = 0u;
+    uint32_t fails;
+    uint32_t threads;
+    double pool_ns;
+    double heap_ns;
+
+    printf("pool_bench: %u-byte blocks, %u held per thread, %u pairs per thread, %ld CPUs\n",
+           POOL_BENCH_BLOCK_SIZE, POOL_BENCH_BURST, POOL_BENCH_PAIRS, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("threads  block_pool ns/pair  malloc ns/pair  block_pool Mpairs/s  malloc Mpairs/s\n");
+    for (threads = 1u; threads <= POOL_BENCH_MAX_THREADS; threads *= 2u)
+    {
+        pool_ns = pool_bench_run(&pool_bench_pool, threads, &fails, &errors);
+        errors += pool_bench_check(&pool_bench_pool, threads * POOL_BENCH_PAIRS, fails);
+        if (0u != fails)
+        {
+            printf("  %u allocations failed with enough blocks for every thread\n", fails);
+            errors++;
+        }
+        heap_ns = pool_bench_run(NULL, threads, &fails, &errors);
+        printf("%7u  %18.1f  %14.1f  %19.1f  %15.1f\n", threads, pool_ns, heap_ns,
+               (double)threads * 1000.0 / pool_ns, (double)threads * 1000.0 / heap_ns);
+    }
+
+    (void)pool_bench_run(&pool_bench_scarce, POOL_BENCH_MAX_THREADS, &fails, &errors);
+    errors += pool_bench_check(&pool_bench_scarce, POOL_BENCH_MAX_THREADS * POOL_BENCH_PAIRS, fails);
+    printf("scarce pool: %u blocks for %u threads of %u, %u allocations found it empty\n",
+           POOL_BENCH_SCARCE_BLOCKS, POOL_BENCH_MAX_THREADS, POOL_BENCH_BURST, fails);
+
+    printf("pool_bench: %u errors\n", errors);
+
+    return (0u == errors) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,242 @@
+/*******************************************************************************
+* File Name:   pwm_phase_check.c
+*
+* Description: Host model of the trigger phase arithmetic of the PWM
+*              synchronized ADC sampling (pwm_phase.h). Sweeps counter clocks,
+*              PWM frequencies and trigger phases, compares the registers
+*              against a floating-point model and checks the delay and time
+*              conversions. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "pwm_phase.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define PWM_PHASE_CHECK_PRINT       (10u)
+
+/* Step of the phase sweep, a prime so that every low bit pattern is hit */
+#define PWM_PHASE_CHECK_STEP        (251u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void pwm_phase_check_fail(const char *what, uint32_t clock_hz, uint32_t frequency_hz, uint32_t phase,
+                                 const pwm_phase_t *timing);
+static void pwm_phase_check_timing(uint32_t clock_hz, uint32_t frequency_hz, uint32_t phase);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Counter clocks: the demo's, other divider outputs and a slow clock where a
+ * period has fewer counts than the phase has steps */
+static const uint32_t pwm_phase_check_clocks[] = { 100000000u, 80000000u, 8000000u, 1000000u, 32768u };
+
+static const uint32_t pwm_phase_check_frequencies[] = { 1u, 50u, 1000u, 9999u, 10000u, 33333u, 100000u };
+
+static uint32_t pwm_phase_check_cases = 0u;
+static uint32_t pwm_phase_check_failures = 0u;
+
+
+/* Counts a failure and prints the first ones */
+static void pwm_phase_check_fail(const char *what, uint32_t clock_hz, uint32_t frequency_hz, uint32_t phase,
+                                 const pwm_phase_t *timing)
+{
+    pwm_phase_check_failures++;
+    if (pwm_phase_check_failures <= PWM_PHASE_CHECK_PRINT)
+    {
+        printf("FAIL %s: clock %u Hz, %u Hz, phase %u, period %u, compare %u\n", what, clock_hz, frequency_hz,
+               phase, (NULL != timing) ? timing->period : 0u, (NULL != timing) ? timing->compare : 0u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: pwm_phase_check_timing
+********************************************************************************
+* Summary:
+*  Checks the registers of one clock, frequency and phase: the period is the
+*  one closest to the frequency, the compare is within half a count of the
+*  phase, the delay wraps at the period and the time conversion rounds.
+*
+* Parameters:
+*  clock_hz: counter clock
+*  frequency_hz: PWM frequency
+*  phase: trigger phase, 0 to PWM_PHASE_FULL - 1
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void pwm_phase_check_timing(uint32_t clock_hz, uint32_t frequency_hz, uint32_t phase)
+{
+    pwm_phase_t timing;
+    uint64_t counts;
+    double exact;
+    double error;
+    bool valid = (((uint64_t)clock_hz + (frequency_hz / 2u)) / frequency_hz) >= 2u;
+
+    pwm_phase_check_cases++;
+    if (pwm_phase_init(&timing, clock_hz, frequency_hz, phase) != valid)
+    {
+        pwm_phase_check_fail("init", clock_hz, frequency_hz, phase, NULL);
+        return;
+    }
+    if (!valid)
+    {
+        return;
+    }
+    counts = (uint64_t)timing.period + 1u;
+
+    /* No other period is closer to the frequency */
+    if (llabs((long long)clock_hz - (long long)(counts * frequency_hz)) * 2 > (long long)frequency_hz)
+    {
+        pwm_phase_check_fail("period", clock_hz, frequency_hz, phase, &timing);
+    }
+    if (timing.compare > timing.period)
+    {
+        pwm_phase_check_fail("compare range", clock_hz, frequency_hz, phase, &timing);
+    }
+
+    /* The trigger lands within half a count of the phase, a phase close to
+     * the end of the period on the match at 0 */
+    exact = ((double)counts * phase) / PWM_PHASE_FULL;
+    error = (double)timing.compare - exact;
+    if (error < -((double)counts / 2.0))
+    {
+        error += (double)counts;
+    }
+    if (fabs(error) > 0.5 + 1e-9)
+    {
+        pwm_phase_check_fail("phase error", clock_hz, frequency_hz, phase, &timing);
+    }
+
+    /* With at most one count per phase step, the phase of the registers gives
+     * the registers back */
+    if ((counts <= PWM_PHASE_FULL) && (pwm_phase_compare(timing.period, pwm_phase_actual(&timing)) != timing.compare))
+    {
+        pwm_phase_check_fail("actual phase", clock_hz, frequency_hz, phase, &timing);
+    }
+
+    /* Delays after the trigger, across the wrap */
+    if ((0u != pwm_phase_delay(&timing, timing.compare)) ||
+        (timing.period != pwm_phase_delay(&timing, (timing.compare + timing.period) % (uint32_t)counts)) ||
+        ((timing.period - timing.compare) != pwm_phase_delay(&timing, timing.period)) ||
+        (((uint32_t)counts - timing.compare) % (uint32_t)counts != pwm_phase_delay(&timing, 0u)))
+    {
+        pwm_phase_check_fail("delay", clock_hz, frequency_hz, phase, &timing);
+    }
+
+    /* One period in nanoseconds, rounded */
+    if (llabs((long long)((uint64_t)pwm_phase_counts_to_ns(&timing, (uint32_t)counts) * clock_hz) -
+              (long long)(counts * 1000000000u)) * 2 > (long long)clock_hz)
+    {
+        pwm_phase_check_fail("ns", clock_hz, frequency_hz, phase, &timing);
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the sweep and the checks of the argument ranges and phase macros.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if every check passed, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    pwm_phase_t timing;
+
+    for (uint32_t c = 0u; c < sizeof(pwm_phase_check_clocks) / sizeof(pwm_phase_check_clocks[0]); c++)
+    {
+        uint32_t clock_hz = pwm_phase_check_clocks[c];
+        /* Add the fastest PWMs of the clock, where rounding matters most */
+        uint32_t frequencies[] = { clock_hz / 2u, clock_hz / 3u, (clock_hz / 3u) + 1u, clock_hz };
+
+        for (uint32_t f = 0u; f < (sizeof(pwm_phase_check_frequencies) / sizeof(pwm_phase_check_frequencies[0])) +
+                                  (sizeof(frequencies) / sizeof(frequencies[0])); f++)
+        {
+            uint32_t frequency_hz = (f < sizeof(pwm_phase_check_frequencies) / sizeof(pwm_phase_check_frequencies[0]))
+                ? pwm_phase_check_frequencies[f]
+                : frequencies[f - (sizeof(pwm_phase_check_frequencies) / sizeof(pwm_phase_check_frequencies[0]))];
+
+            for (uint32_t phase = 0u; phase < PWM_PHASE_FULL; phase += PWM_PHASE_CHECK_STEP)
+            {
+                pwm_phase_check_timing(clock_hz, frequency_hz, phase);
+            }
+            pwm_phase_check_timing(clock_hz, frequency_hz, PWM_PHASE_FULL / 2u);
+            pwm_phase_check_timing(clock_hz, frequency_hz, PWM_PHASE_FULL - 1u);
+        }
+    }
+
+    /* Arguments out of range */
+    pwm_phase_check_cases++;
+    if (pwm_phase_init(&timing, 100000000u, 0u, 0u) || pwm_phase_init(&timing, 100000000u, 10000u, PWM_PHASE_FULL) ||
+        pwm_phase_init(&timing, 100000000u, 100000000u, 0u))
+    {
+        pwm_phase_check_fail("range", 100000000u, 0u, 0u, NULL);
+    }
+
+    /* Tenths of a percent survive the conversion to phases and back */
+    for (uint32_t permille = 0u; permille <= 1000u; permille++)
+    {
+        pwm_phase_check_cases++;
+        if (PWM_PHASE_TO_PERMILLE(PWM_PHASE_FROM_PERMILLE(permille)) != permille)
+        {
+            pwm_phase_check_fail("permille", 0u, 0u, permille, NULL);
+        }
+    }
+
+    printf("pwm_phase_check: %u cases, %u failures\n", pwm_phase_check_cases, pwm_phase_check_failures);
+
+    return (0u == pwm_phase_check_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,372 @@
+/*******************************************************************************
+* File Name:   resource_check.c
+*
+* Description: Host check of the resource manager (resource_manager.h) on
+*              the simulated HAL. Acquires, reuses, releases and re-acquires
+*              GPIO and PWM pins as other kinds of resources, and checks the
+*              conflicts between owners, the handles left on failure, the HAL
+*              errors and the full table against the statistics of the
+*              manager and the pin models. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cycfg.h"
+#include "resource_manager.h"
+#include "sim.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define RESOURCE_CHECK_PRINT        (10u)
+
+/* Pins that no other module of the kit uses, to fill the table */
+#define RESOURCE_CHECK_SPARE(index) CYHAL_GET_GPIO(10u + ((index) / 8u), (index) % 8u)
+
+#define RESOURCE_CHECK(condition, what) \
+    resource_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void resource_check_expect(bool condition, const char *what, int line);
+static void resource_check_mark(void);
+static resource_manager_stats_t resource_check_delta(void);
+static void resource_check_gpio(void);
+static void resource_check_pwm(void);
+static void resource_check_hal_error(void);
+static void resource_check_full(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t resource_check_cases = 0u;
+static uint32_t resource_check_failures = 0u;
+
+/* Statistics at the start of the current step */
+static resource_manager_stats_t resource_check_base;
+
+
+/* Counts a check and prints the first failures */
+static void resource_check_expect(bool condition, const char *what, int line)
+{
+    resource_check_cases++;
+    if (!condition)
+    {
+        resource_check_failures++;
+        if (resource_check_failures <= RESOURCE_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/* Starts a step: later deltas are counted from the current statistics */
+static void resource_check_mark(void)
+{
+    resource_manager_get_stats(&resource_check_base);
+}
+
+/* Statistics counted since resource_check_mark() */
+static resource_manager_stats_t resource_check_delta(void)
+{
+    resource_manager_stats_t stats;
+
+    resource_manager_get_stats(&stats);
+    stats.inits -= resource_check_base.inits;
+    stats.reuses -= resource_check_base.reuses;
+    stats.conflicts -= resource_check_base.conflicts;
+    stats.saved_cycles -= resource_check_base.saved_cycles;
+
+    return stats;
+}
+
+/* The manager is linked without the CAN FD demo that CANFD_config refers to */
+void canfd_rx_callback(bool rxFIFOMsg, uint8_t msgBufOrRxFIFONum, cy_stc_canfd_rx_buffer_t *basemsg)
+{
+    (void)rxFIFOMsg;
+    (void)msgBufOrRxFIFONum;
+    (void)basemsg;
+}
+
+/*******************************************************************************
+* Function Name: resource_check_gpio
+********************************************************************************
+* Summary:
+*  Acquires a GPIO, acquires it again as its owner, refuses it to another
+*  owner, ignores the release of another owner, and reuses the parked pin for
+*  the next owner at the output level it asks for.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void resource_check_gpio(void)
+{
+    resource_manager_stats_t delta;
+
+    resource_check_mark();
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, true, "first"), "acquire of a new GPIO");
+    delta = resource_check_delta();
+    RESOURCE_CHECK((1u == delta.inits) && (0u == delta.reuses), "a new GPIO is initialized");
+    RESOURCE_CHECK(cyhal_gpio_read(CYBSP_USER_LED1), "a new GPIO drives its initial level");
+
+    /* A second acquisition of the owner is counted, not initialized */
+    resource_check_mark();
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, true, "first"), "acquire again by the owner");
+    delta = resource_check_delta();
+    RESOURCE_CHECK((0u == delta.inits) && (0u == delta.reuses) && (0u == delta.conflicts),
+                   "an acquisition by the owner touches no handle");
+
+    resource_check_mark();
+    RESOURCE_CHECK(RESOURCE_MANAGER_RSLT_ERR_CONFLICT ==
+                   resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, false, "second"), "a held GPIO is refused to another owner");
+    delta = resource_check_delta();
+    RESOURCE_CHECK((1u == delta.conflicts) && (0u == delta.inits), "the refusal is counted as a conflict");
+    RESOURCE_CHECK(cyhal_gpio_read(CYBSP_USER_LED1), "a refused owner does not change the level");
+
+    /* Only the owner releases, once per acquisition */
+    resource_manager_gpio_release(CYBSP_USER_LED1, "second");
+    resource_manager_gpio_release(CYBSP_USER_LED1, "first");
+    RESOURCE_CHECK(RESOURCE_MANAGER_RSLT_ERR_CONFLICT ==
+                   resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, false, "second"), "the GPIO is held until its last release");
+    RESOURCE_CHECK(cyhal_gpio_read(CYBSP_USER_LED1), "an output is driven until its last release");
+    resource_manager_gpio_release(CYBSP_USER_LED1, "first");
+
+    /* The released pin is parked, and reconfigured for the next owner */
+    sim_gpio_set_input(CYBSP_USER_LED1, true);
+    resource_check_mark();
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, false, "second"), "acquire of a released GPIO");
+    delta = resource_check_delta();
+    RESOURCE_CHECK((0u == delta.inits) && (1u == delta.reuses) && (0u == delta.conflicts),
+                   "a released GPIO is reused");
+    RESOURCE_CHECK(!cyhal_gpio_read(CYBSP_USER_LED1), "a reused GPIO drives the level of the new owner");
+    resource_manager_gpio_release(CYBSP_USER_LED1, "second");
+}
+
+/*******************************************************************************
+* Function Name: resource_check_pwm
+********************************************************************************
+* Summary:
+*  Re-acquires the GPIO of resource_check_gpio() as a PWM, reuses the stopped
+*  PWM, and takes the pin back as a GPIO. A refused acquisition leaves the
+*  handle of the caller unchanged.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void resource_check_pwm(void)
+{
+    cyhal_pwm_t unset;
+    cyhal_pwm_t *pwm = &unset;
+    cyhal_pwm_t *first;
+    resource_manager_stats_t delta;
+
+    /* A held GPIO is refused as a PWM, also to its own owner */
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, false, "gpio"), "acquire of the GPIO");
+    resource_check_mark();
+    RESOURCE_CHECK(RESOURCE_MANAGER_RSLT_ERR_CONFLICT == resource_manager_pwm_acquire(&pwm, CYBSP_USER_LED1, "gpio"),
+                   "a held GPIO is refused as a PWM to its owner");
+    RESOURCE_CHECK(&unset == pwm, "a refused PWM leaves the handle unchanged");
+    RESOURCE_CHECK(RESOURCE_MANAGER_RSLT_ERR_CONFLICT == resource_manager_pwm_acquire(&pwm, CYBSP_USER_LED1, "pwm"),
+                   "a held GPIO is refused as a PWM to another owner");
+    RESOURCE_CHECK(&unset == pwm, "a refused PWM leaves the handle unchanged");
+    RESOURCE_CHECK(2u == resource_check_delta().conflicts, "the refusals are counted as conflicts");
+    resource_manager_gpio_release(CYBSP_USER_LED1, "gpio");
+
+    /* The idle GPIO is freed and the pin initialized as a PWM */
+    resource_check_mark();
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_pwm_acquire(&pwm, CYBSP_USER_LED1, "pwm"),
+                   "acquire of a released GPIO as a PWM");
+    delta = resource_check_delta();
+    RESOURCE_CHECK((1u == delta.inits) && (0u == delta.reuses), "a GPIO acquired as a PWM is initialized");
+    RESOURCE_CHECK((&unset != pwm) && (CYBSP_USER_LED1 == pwm->pin), "the PWM handle is set on success");
+    RESOURCE_CHECK(CYHAL_HWMGR_RSLT_ERR_INUSE == cyhal_gpio_init(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, false), "the PWM holds the pin in the HAL");
+    first = pwm;
+
+    (void)cyhal_pwm_set_duty_cycle(pwm, 50.0f, 1000u);
+    (void)cyhal_pwm_start(pwm);
+    RESOURCE_CHECK(RESOURCE_MANAGER_RSLT_ERR_CONFLICT == resource_manager_gpio_acquire(CYBSP_USER_LED1,
+                   CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, false, "pwm"),
+                   "a held PWM is refused as a GPIO to its owner");
+    RESOURCE_CHECK(pwm->running, "a refused GPIO leaves the PWM running");
+    resource_manager_pwm_release(CYBSP_USER_LED1, "pwm");
+    RESOURCE_CHECK(!first->running, "the last release stops the PWM");
+
+    /* The stopped PWM is handed out again */
+    pwm = &unset;
+    resource_check_mark();
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_pwm_acquire(&pwm, CYBSP_USER_LED1, "other"),
+                   "acquire of a released PWM");
+    delta = resource_check_delta();
+    RESOURCE_CHECK((0u == delta.inits) && (1u == delta.reuses), "a released PWM is reused");
+    RESOURCE_CHECK(first == pwm, "a reused PWM keeps its handle");
+    resource_manager_pwm_release(CYBSP_USER_LED1, "other");
+
+    /* And the pin taken back as a GPIO */
+    resource_check_mark();
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, true, "gpio"), "acquire of a released PWM as a GPIO");
+    delta = resource_check_delta();
+    RESOURCE_CHECK((1u == delta.inits) && (0u == delta.reuses), "a PWM acquired as a GPIO is initialized");
+    RESOURCE_CHECK(cyhal_gpio_read(CYBSP_USER_LED1), "the GPIO drives its initial level");
+    resource_manager_gpio_release(CYBSP_USER_LED1, "gpio");
+}
+
+/*******************************************************************************
+* Function Name: resource_check_hal_error
+********************************************************************************
+* Summary:
+*  Acquires a pin that was initialized outside the manager. The HAL error is
+*  returned, nothing is taken, and the pin is acquired once it is freed.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void resource_check_hal_error(void)
+{
+    cyhal_pwm_t unset;
+    cyhal_pwm_t *pwm = &unset;
+
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == cyhal_gpio_init(CYBSP_USER_LED2, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, false), "initialization outside the manager");
+    resource_check_mark();
+    RESOURCE_CHECK(CYHAL_HWMGR_RSLT_ERR_INUSE == resource_manager_gpio_acquire(CYBSP_USER_LED2,
+                   CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, false, "gpio"), "the GPIO error of the HAL");
+    RESOURCE_CHECK(CYHAL_HWMGR_RSLT_ERR_INUSE == resource_manager_pwm_acquire(&pwm, CYBSP_USER_LED2, "pwm"),
+                   "the PWM error of the HAL");
+    RESOURCE_CHECK(&unset == pwm, "a failed PWM leaves the handle unchanged");
+    RESOURCE_CHECK(0u == resource_check_delta().inits, "a HAL error initializes nothing");
+    cyhal_gpio_free(CYBSP_USER_LED2);
+
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_pwm_acquire(&pwm, CYBSP_USER_LED2, "pwm"),
+                   "acquire after the HAL error");
+    RESOURCE_CHECK(1u == resource_check_delta().inits, "the pin is initialized after the HAL error");
+    resource_manager_pwm_release(CYBSP_USER_LED2, "pwm");
+}
+
+/*******************************************************************************
+* Function Name: resource_check_full
+********************************************************************************
+* Summary:
+*  Fills the table with spare pins. A new pin is refused while the pins
+*  already in the table are still acquired.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void resource_check_full(void)
+{
+    uint32_t acquired = 0u;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    /* LED1 and LED2 hold two entries */
+    for (uint32_t index = 0u; (CY_RSLT_SUCCESS == result) && (index < RESOURCE_MANAGER_ENTRIES); index++)
+    {
+        result = resource_manager_gpio_acquire(RESOURCE_CHECK_SPARE(index), CYHAL_GPIO_DIR_OUTPUT,
+                                               CYHAL_GPIO_DRIVE_STRONG, false, "full");
+        if (CY_RSLT_SUCCESS == result)
+        {
+            acquired++;
+        }
+    }
+    RESOURCE_CHECK(RESOURCE_MANAGER_RSLT_ERR_FULL == result, "a new pin is refused when the table is full");
+    RESOURCE_CHECK((RESOURCE_MANAGER_ENTRIES - 2u) == acquired, "every entry is used before the table is full");
+    RESOURCE_CHECK(CY_RSLT_SUCCESS == resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT,
+                   CYHAL_GPIO_DRIVE_STRONG, false, "gpio"), "a pin of the full table is acquired");
+    resource_manager_gpio_release(CYBSP_USER_LED1, "gpio");
+
+    for (uint32_t index = 0u; index < acquired; index++)
+    {
+        resource_manager_gpio_release(RESOURCE_CHECK_SPARE(index), "full");
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the cases in order; each starts from the table the previous one left.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if all checks pass, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    resource_check_gpio();
+    resource_check_pwm();
+    resource_check_hal_error();
+    resource_check_full();
+
+    printf("resource_check: %u cases, %u failures\n", resource_check_cases, resource_check_failures);
+
+    return (0u == resource_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,574 @@
+/*******************************************************************************
+* File Name:   ring_check.c
+*
+* Description: Host check of the IPC message rings of shared/ipc_ring.c. The
+*              ring code is compiled as it is; on the host its barrier is a
+*              C11 fence and its cache maintenance does nothing, as on a core
+*              without a D-cache. Fixed cases cover the empty and the full
+*              ring and the indices wrapping at 2^32. Then a producer thread
+*              and a consumer thread stand for CM7_0 and CM7_1: every
+*              message carries a sequence number and a payload derived from
+*              it, so a lost, repeated, reordered or torn message is caught.
+*              A request ring and a response ring in both directions give
+*              the round-trip time. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ipc_ring.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define RING_CHECK_PRINT            (10u)
+
+/* Messages of the streaming run and of the round-trip run */
+#define RING_CHECK_MESSAGES         (4000000u)
+#define RING_CHECK_ROUND_TRIPS      (200000u)
+
+/* Opcodes of the messages */
+#define RING_CHECK_OP_DATA          (0x5244u)
+#define RING_CHECK_OP_ECHO          (0x4543u)
+
+#define RING_CHECK(condition, what) \
+    ring_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* One end of a threaded run */
+typedef struct
+{
+    ipc_ring_t *tx;                 /* Ring pushed to, NULL for none */
+    ipc_ring_t *rx;                 /* Ring popped from, NULL for none */
+    uint32_t    first;              /* Sequence number of the first message */
+    uint32_t    count;              /* Messages to send or receive */
+    uint32_t    full;               /* Pushes refused by a full ring */
+    uint32_t    empty;              /* Pops finding an empty ring */
+    uint32_t    errors;             /* Messages received with wrong contents */
+} ring_check_end_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void ring_check_expect(bool condition, const char *what, int line);
+static uint64_t ring_check_ns(void);
+static void ring_check_fill(ipc_msg_t *msg, uint16_t opcode, uint32_t seq);
+static bool ring_check_verify(const ipc_msg_t *msg, uint16_t opcode, uint32_t seq);
+static void ring_check_fixed(void);
+static void ring_check_wrap(void);
+static void *ring_check_producer(void *arg);
+static void *ring_check_consumer(void *arg);
+static void *ring_check_echo(void *arg);
+static void ring_check_stream(uint32_t first);
+static void ring_check_round_trip(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ipc_ring_t ring_check_request;
+static ipc_ring_t ring_check_response;
+
+static uint32_t ring_check_cases = 0u;
+static uint32_t ring_check_failures = 0u;
+
+
+/*******************************************************************************
+* Function Name: ring_check_expect
+********************************************************************************
+* Summary:
+*  Counts a check and prints the first failures.
+*
+* Parameters:
+*  condition: result of the check
+*  what: description of the check
+*  line: source line of the check
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ring_check_expect(bool condition, const char *what, int line)
+{
+    ring_check_cases++;
+    if (!condition)
+    {
+        ring_check_failures++;
+        if (ring_check_failures <= RING_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: ring_check_ns
+********************************************************************************
+* Summary:
+*  Returns the monotonic time.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint64_t: time in nanoseconds
+*
+*******************************************************************************/
+static uint64_t ring_check_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: ring_check_fill
+********************************************************************************
+* Summary:
+*  Builds the message of a sequence number: every field and payload byte
+*  depends on it.
+*
+* Parameters:
+*  msg: message to fill
+*  opcode: opcode of the message
+*  seq: sequence number
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ring_check_fill(ipc_msg_t *msg, uint16_t opcode, uint32_t seq)
+{
+    uint32_t hash = seq * 2654435761u;
+
+    msg->opcode = opcode;
+    msg->length = (uint16_t)(seq % (IPC_MSG_PAYLOAD_SIZE + 1u));
+    msg->seq = seq;
+    msg->stamp = ~seq;
+    for (uint32_t index = 0u; index < IPC_MSG_PAYLOAD_SIZE; index++)
+    {
+        msg->payload[index] = (uint8_t)(hash >> ((index & 3u) * 8u)) ^ (uint8_t)index;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ring_check_verify
+********************************************************************************
+* Summary:
+*  Compares a received message with the one of its expected sequence number.
+*
+* Parameters:
+*  msg: received message
+*  opcode: expected opcode
+*  seq: expected sequence number
+*
+* Return:
+*  bool: true if the whole message matches
+*
+*******************************************************************************/
+static bool ring_check_verify(const ipc_msg_t *msg, uint16_t opcode, uint32_t seq)
+{
+    ipc_msg_t expected;
+
+    ring_check_fill(&expected, opcode, seq);
+
+    return (0 == memcmp(msg, &expected, sizeof(ipc_msg_t)));
+}
+
+/*******************************************************************************
+* Function Name: ring_check_fixed
+********************************************************************************
+* Summary:
+*  Checks the empty and full ring and the order of the messages on one
+*  thread.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ring_check_fixed(void)
+{
+    ipc_msg_t msg;
+    uint32_t seq;
+    bool in_order = true;
+
+    ipc_ring_init(&ring_check_request);
+    RING_CHECK(0u == ipc_ring_count(&ring_check_request), "new ring is empty");
+    RING_CHECK(!ipc_ring_pop(&ring_check_request, &msg), "pop from the empty ring fails");
+
+    for (seq = 0u; seq < IPC_RING_DEPTH; seq++)
+    {
+        ring_check_fill(&msg, RING_CHECK_OP_DATA, seq);
+        RING_CHECK(ipc_ring_push(&ring_check_request, &msg), "push into a ring with room");
+    }
+    RING_CHECK(IPC_RING_DEPTH == ipc_ring_count(&ring_check_request), "count of the full ring");
+    ring_check_fill(&msg, RING_CHECK_OP_DATA, seq);
+    RING_CHECK(!ipc_ring_push(&ring_check_request, &msg), "push into the full ring fails");
+    RING_CHECK(IPC_RING_DEPTH == ipc_ring_count(&ring_check_request), "refused push leaves the count");
+
+    /* One out makes room for exactly one more */
+    RING_CHECK(ipc_ring_pop(&ring_check_request, &msg) && ring_check_verify(&msg, RING_CHECK_OP_DATA, 0u),
+               "oldest message comes out first");
+    ring_check_fill(&msg, RING_CHECK_OP_DATA, IPC_RING_DEPTH);
+    RING_CHECK(ipc_ring_push(&ring_check_request, &msg), "push after a pop");
+    RING_CHECK(!ipc_ring_push(&ring_check_request, &msg), "ring full again");
+
+    for (seq = 1u; seq <= IPC_RING_DEPTH; seq++)
+    {
+        if (!ipc_ring_pop(&ring_check_request, &msg) || !ring_check_verify(&msg, RING_CHECK_OP_DATA, seq))
+        {
+            in_order = false;
+        }
+    }
+    RING_CHECK(in_order, "messages come out in order and intact");
+    RING_CHECK(!ipc_ring_pop(&ring_check_request, &msg), "drained ring is empty");
+    RING_CHECK(0u == ipc_ring_count(&ring_check_request), "count of the drained ring");
+}
+
+/*******************************************************************************
+* Function Name: ring_check_wrap
+********************************************************************************
+* Summary:
+*  Checks the full and empty tests and the slot order while the free-running
+*  indices wrap at 2^32.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ring_check_wrap(void)
+{
+    ipc_msg_t msg;
+    uint32_t pushed = 0u;
+    uint32_t popped = 0u;
+    bool in_order = true;
+    bool count_ok = true;
+
+    ipc_ring_init(&ring_check_request);
+    ring_check_request.head = UINT32_MAX - (IPC_RING_DEPTH / 2u);
+    ring_check_request.tail = ring_check_request.head;
+    RING_CHECK(0u == ipc_ring_count(&ring_check_request), "empty ring just before the wrap");
+
+    /* Fill across the wrap, then drain and refill a few times */
+    for (uint32_t round = 0u; round < 4u; round++)
+    {
+        while (true)
+        {
+            ring_check_fill(&msg, RING_CHECK_OP_DATA, pushed);
+            if (!ipc_ring_push(&ring_check_request, &msg))
+            {
+                break;
+            }
+            pushed++;
+        }
+        if (IPC_RING_DEPTH != ipc_ring_count(&ring_check_request))
+        {
+            count_ok = false;
+        }
+        while (ipc_ring_pop(&ring_check_request, &msg))
+        {
+            if (!ring_check_verify(&msg, RING_CHECK_OP_DATA, popped))
+            {
+                in_order = false;
+            }
+            popped++;
+        }
+    }
+    RING_CHECK(count_ok, "ring holds IPC_RING_DEPTH messages across the wrap");
+    RING_CHECK(pushed == (4u * IPC_RING_DEPTH), "pushes accepted across the wrap");
+    RING_CHECK(popped == pushed, "pops across the wrap");
+    RING_CHECK(in_order, "messages come out in order and intact across the wrap");
+    RING_CHECK(ring_check_request.head == (UINT32_MAX - (IPC_RING_DEPTH / 2u)) + pushed, "indices have wrapped");
+}
+
+/*******************************************************************************
+* Function Name: ring_check_producer
+********************************************************************************
+* Summary:
+*  Pushes the messages of its sequence numbers, retrying while the ring is
+*  full.
+*
+* Parameters:
+*  arg: ring_check_end_t of the thread
+*
+* Return:
+*  void*: NULL
+*
+*******************************************************************************/
+static void *ring_check_producer(void *arg)
+{
+    ring_check_end_t *end = (ring_check_end_t *)arg;
+    ipc_msg_t msg;
+
+    for (uint32_t done = 0u; done < end->count; done++)
+    {
+        ring_check_fill(&msg, RING_CHECK_OP_DATA, end->first + done);
+        while (!ipc_ring_push(end->tx, &msg))
+        {
+            end->full++;
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: ring_check_consumer
+********************************************************************************
+* Summary:
+*  Pops the messages and checks that each one is the next in sequence and
+*  intact.
+*
+* Parameters:
+*  arg: ring_check_end_t of the thread
+*
+* Return:
+*  void*: NULL
+*
+*******************************************************************************/
+static void *ring_check_consumer(void *arg)
+{
+    ring_check_end_t *end = (ring_check_end_t *)arg;
+    ipc_msg_t msg;
+
+    for (uint32_t done = 0u; done < end->count; done++)
+    {
+        while (!ipc_ring_pop(end->rx, &msg))
+        {
+            end->empty++;
+            (void)sched_yield();
+        }
+        if (!ring_check_verify(&msg, RING_CHECK_OP_DATA, end->first + done))
+        {
+            if (end->errors < RING_CHECK_PRINT)
+            {
+                printf("  message %u received as seq %u opcode 0x%04X\n",
+                       end->first + done, msg.seq, msg.opcode);
+            }
+            end->errors++;
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: ring_check_echo
+********************************************************************************
+* Summary:
+*  Answers each request with a response of the same sequence number, as the
+*  offload service of CM7_1 does.
+*
+* Parameters:
+*  arg: ring_check_end_t of the thread
+*
+* Return:
+*  void*: NULL
+*
+*******************************************************************************/
+static void *ring_check_echo(void *arg)
+{
+    ring_check_end_t *end = (ring_check_end_t *)arg;
+    ipc_msg_t msg;
+
+    for (uint32_t done = 0u; done < end->count; done++)
+    {
+        while (!ipc_ring_pop(end->rx, &msg))
+        {
+            end->empty++;
+            (void)sched_yield();
+        }
+        if (!ring_check_verify(&msg, RING_CHECK_OP_DATA, end->first + done))
+        {
+            end->errors++;
+        }
+        ring_check_fill(&msg, RING_CHECK_OP_ECHO, msg.seq);
+        while (!ipc_ring_push(end->tx, &msg))
+        {
+            end->full++;
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: ring_check_stream
+********************************************************************************
+* Summary:
+*  Streams RING_CHECK_MESSAGES messages from a producer thread to a consumer
+*  thread and reports the throughput.
+*
+* Parameters:
+*  first: index of the first message; the indices start there, so a value
+*         close to 2^32 makes them wrap during the run
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ring_check_stream(uint32_t first)
+{
+    ring_check_end_t producer = { .tx = &ring_check_request, .first = first, .count = RING_CHECK_MESSAGES };
+    ring_check_end_t consumer = { .rx = &ring_check_request, .first = first, .count = RING_CHECK_MESSAGES };
+    pthread_t threads[2];
+    uint64_t begin;
+    uint64_t ns;
+
+    ipc_ring_init(&ring_check_request);
+    ring_check_request.head = first;
+    ring_check_request.tail = first;
+
+    begin = ring_check_ns();
+    (void)pthread_create(&threads[0], NULL, ring_check_consumer, &consumer);
+    (void)pthread_create(&threads[1], NULL, ring_check_producer, &producer);
+    (void)pthread_join(threads[1], NULL);
+    (void)pthread_join(threads[0], NULL);
+    ns = ring_check_ns() - begin;
+
+    printf("stream from index 0x%08X: %u messages in %.1f ms, %.1f Mmsg/s, %u pushes found it full, "
+           "%u pops found it empty, %u bad messages\n",
+           first, RING_CHECK_MESSAGES, (double)ns / 1e6, (double)RING_CHECK_MESSAGES * 1e3 / (double)ns,
+           producer.full, consumer.empty, consumer.errors);
+    RING_CHECK(0u == consumer.errors, "every streamed message arrives once, in order and intact");
+    RING_CHECK(0u == ipc_ring_count(&ring_check_request), "ring empty after the stream");
+    RING_CHECK(ring_check_request.head == (first + RING_CHECK_MESSAGES), "head after the stream");
+}
+
+/*******************************************************************************
+* Function Name: ring_check_round_trip
+********************************************************************************
+* Summary:
+*  Sends one request at a time to an echo thread and waits for its response,
+*  and reports the round-trip time.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ring_check_round_trip(void)
+{
+    ring_check_end_t echo = { .tx = &ring_check_response, .rx = &ring_check_request,
+                              .first = 0u, .count = RING_CHECK_ROUND_TRIPS };
+    pthread_t thread;
+    ipc_msg_t msg;
+    uint32_t errors = 0u;
+    uint64_t begin;
+    uint64_t ns;
+
+    ipc_ring_init(&ring_check_request);
+    ipc_ring_init(&ring_check_response);
+    (void)pthread_create(&thread, NULL, ring_check_echo, &echo);
+
+    begin = ring_check_ns();
+    for (uint32_t seq = 0u; seq < RING_CHECK_ROUND_TRIPS; seq++)
+    {
+        ring_check_fill(&msg, RING_CHECK_OP_DATA, seq);
+        while (!ipc_ring_push(&ring_check_request, &msg))
+        {
+            (void)sched_yield();
+        }
+        while (!ipc_ring_pop(&ring_check_response, &msg))
+        {
+            (void)sched_yield();
+        }
+        if (!ring_check_verify(&msg, RING_CHECK_OP_ECHO, seq))
+        {
+            errors++;
+        }
+    }
+    ns = ring_check_ns() - begin;
+    (void)pthread_join(thread, NULL);
+
+    printf("round trip: %u requests, %.0f ns per request and response, %u bad requests, %u bad responses\n",
+           RING_CHECK_ROUND_TRIPS, (double)ns / RING_CHECK_ROUND_TRIPS, echo.errors, errors);
+    RING_CHECK(0u == echo.errors, "every request arrives intact");
+    RING_CHECK(0u == errors, "every response arrives intact");
+    RING_CHECK((0u == ipc_ring_count(&ring_check_request)) && (0u == ipc_ring_count(&ring_check_response)),
+               "both rings empty after the round trips");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the fixed cases, the streams and the round trips.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if all checks pass, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    printf("ring_check: %u slots of %u bytes\n", IPC_RING_DEPTH, (unsigned int)sizeof(ipc_msg_t));
+
+    ring_check_fixed();
+    ring_check_wrap();
+    ring_check_stream(0u);
+    ring_check_stream(UINT32_MAX - (RING_CHECK_MESSAGES / 2u));
+    ring_check_round_trip();
+
+    printf("ring_check: %u cases, %u failures\n", ring_check_cases, ring_check_failures);
+
+    return (0u == ring_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
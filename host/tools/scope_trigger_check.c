@@ -0,0 +1,660 @@
+/*******************************************************************************
+* File Name:   scope_trigger_check.c
+*
+* Description: Host check of the trigger engine of the ADC scope capture
+*              (scope_trigger.c) with the sample files of tools/scope_samples.
+*              Replays each file with every trigger mode, at several levels,
+*              hystereses and block layouts, re-arming after each capture as
+*              the demo does, and compares the trigger samples with a
+*              reference that applies the trigger definitions to the whole
+*              file. Each capture must hold the samples of the file around
+*              its trigger and survive a round trip through the frame
+*              encoder and decoder. Also checks the number of captures of
+*              the noisy edges, the forced trigger, the states and the
+*              configuration errors. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "scope_trigger.h"
+#include "scope_frame.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define SCOPE_TRIGGER_CHECK_PRINT       (10u)
+
+/* Samples of a sample file */
+#define SCOPE_TRIGGER_CHECK_SAMPLES     (4096u)
+
+/* Longest line and path of a sample file */
+#define SCOPE_TRIGGER_CHECK_LINE_SIZE   (256u)
+
+/* Directory of the sample files when none is given */
+#define SCOPE_TRIGGER_CHECK_DIR         "tools/scope_samples"
+
+/* No trigger found */
+#define SCOPE_TRIGGER_CHECK_NONE        (UINT32_MAX)
+
+#define SCOPE_TRIGGER_CHECK(condition, what) \
+    scope_trigger_check_expect((condition), (what), __LINE__)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint16_t    samples[SCOPE_TRIGGER_CHECK_SAMPLES];
+    uint32_t    count;
+} scope_trigger_check_file_t;
+
+/* Expected replay of a sample file */
+typedef struct
+{
+    uint32_t               file;
+    scope_trigger_config_t config;
+    uint32_t               captures;
+    uint32_t               first;       /* Trigger sample of the first capture */
+} scope_trigger_check_case_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void scope_trigger_check_expect(bool condition, const char *what, int line);
+static bool scope_trigger_check_load(const char *dir, scope_trigger_check_file_t *file);
+static bool scope_trigger_check_edge(const uint16_t *samples, uint32_t start, uint32_t index,
+                                     const scope_trigger_config_t *config);
+static uint32_t scope_trigger_check_reference(const scope_trigger_check_file_t *file, uint32_t start,
+                                              const scope_trigger_config_t *config);
+static bool scope_trigger_check_same_header(const scope_frame_header_t *a, const scope_frame_header_t *b);
+static uint32_t scope_trigger_check_replay(const scope_trigger_check_file_t *file,
+                                           const scope_trigger_config_t *config, uint32_t *first);
+static void scope_trigger_check_sweep(const scope_trigger_check_file_t *file);
+static void scope_trigger_check_cases(void);
+static void scope_trigger_check_force(void);
+static void scope_trigger_check_states(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t scope_trigger_check_cases_run = 0u;
+static uint32_t scope_trigger_check_failures = 0u;
+
+static scope_trigger_check_file_t scope_trigger_check_files[] =
+{
+    { .name = "sim_sine.txt" },
+    { .name = "noisy_step.txt" },
+    { .name = "glitch.txt" },
+};
+
+#define SCOPE_TRIGGER_CHECK_FILES   (sizeof(scope_trigger_check_files) / sizeof(scope_trigger_check_files[0]))
+
+/* Ring of the engine and the blocks read from it */
+static uint16_t scope_trigger_check_ring[SCOPE_FRAME_MAX_SAMPLES];
+static uint16_t scope_trigger_check_block[SCOPE_FRAME_MAX_SAMPLES];
+static uint16_t scope_trigger_check_decoded[SCOPE_FRAME_MAX_SAMPLES];
+static uint8_t scope_trigger_check_frame[SCOPE_FRAME_SIZE(SCOPE_FRAME_MAX_SAMPLES)];
+
+
+/* Counts a check and prints the first failures */
+static void scope_trigger_check_expect(bool condition, const char *what, int line)
+{
+    scope_trigger_check_cases_run++;
+    if (!condition)
+    {
+        scope_trigger_check_failures++;
+        if (scope_trigger_check_failures <= SCOPE_TRIGGER_CHECK_PRINT)
+        {
+            printf("FAIL line %d: %s\n", line, what);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_check_load
+********************************************************************************
+* Summary:
+*  Reads a sample file: one sample in ADC counts per line, lines starting
+*  with '#' are comments.
+*
+* Parameters:
+*  dir: directory of the sample files
+*  file: name of the file, receives its samples
+*
+* Return:
+*  bool: false if the file cannot be read, holds no sample or a line is not
+*  a sample
+*
+*******************************************************************************/
+static bool scope_trigger_check_load(const char *dir, scope_trigger_check_file_t *file)
+{
+    char line[SCOPE_TRIGGER_CHECK_LINE_SIZE];
+    FILE *in;
+
+    (void)snprintf(line, sizeof(line), "%s/%s", dir, file->name);
+    in = fopen(line, "r");
+    if (NULL == in)
+    {
+        printf("scope_trigger_check: cannot open %s\n", line);
+        return false;
+    }
+
+    file->count = 0u;
+    while (NULL != fgets(line, sizeof(line), in))
+    {
+        char *end;
+        unsigned long value;
+
+        if ('#' == line[0])
+        {
+            continue;
+        }
+        value = strtoul(line, &end, 10);
+        if ((end == line) || (value > SCOPE_FRAME_SAMPLE_MASK) || (file->count == SCOPE_TRIGGER_CHECK_SAMPLES))
+        {
+            printf("scope_trigger_check: %s: bad line %u\n", file->name, (unsigned int)(file->count + 1u));
+            fclose(in);
+            return false;
+        }
+        file->samples[file->count++] = (uint16_t)value;
+    }
+    fclose(in);
+
+    return (0u != file->count);
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_check_edge
+********************************************************************************
+* Summary:
+*  Reference of the edge triggers: a sample at or past the level is a rising
+*  (falling) edge if the run of samples just before it, all on the other side
+*  of the level, holds one more than the hysteresis away from it. The run
+*  starts at the arming of the capture at the earliest.
+*
+* Parameters:
+*  samples: samples of the file
+*  start: first sample of the capture
+*  index: sample checked
+*  config: trigger
+*
+* Return:
+*  bool: true if the sample is an edge of the trigger mode
+*
+*******************************************************************************/
+static bool scope_trigger_check_edge(const uint16_t *samples, uint32_t start, uint32_t index,
+                                     const scope_trigger_config_t *config)
+{
+    uint32_t level = config->level;
+    bool rising = false;
+    bool falling = false;
+
+    if ((SCOPE_TRIGGER_FALLING != config->mode) && (samples[index] >= level))
+    {
+        for (uint32_t run = index; (run > start) && (samples[run - 1u] < level) && !rising; run--)
+        {
+            rising = ((samples[run - 1u] + (uint32_t)config->hysteresis) < level);
+        }
+    }
+    if ((SCOPE_TRIGGER_RISING != config->mode) && (samples[index] <= level))
+    {
+        for (uint32_t run = index; (run > start) && (samples[run - 1u] > level) && !falling; run--)
+        {
+            falling = (samples[run - 1u] > (level + config->hysteresis));
+        }
+    }
+
+    return rising || falling;
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_check_reference
+********************************************************************************
+* Summary:
+*  Reference of the trigger sample of a capture armed at a sample of the
+*  file: the first sample meeting the trigger that has the pre-trigger
+*  samples of the capture before it.
+*
+* Parameters:
+*  file: samples
+*  start: first sample of the capture
+*  config: trigger and block layout
+*
+* Return:
+*  uint32_t: trigger sample, SCOPE_TRIGGER_CHECK_NONE if the file holds no
+*  complete capture from start on
+*
+*******************************************************************************/
+static uint32_t scope_trigger_check_reference(const scope_trigger_check_file_t *file, uint32_t start,
+                                              const scope_trigger_config_t *config)
+{
+    for (uint32_t index = start + config->pre; (index + config->post) <= file->count; index++)
+    {
+        uint16_t sample = file->samples[index];
+        bool hit;
+
+        switch (config->mode)
+        {
+            case SCOPE_TRIGGER_NONE:
+                hit = true;
+                break;
+            case SCOPE_TRIGGER_ABOVE:
+                hit = (sample >= config->level);
+                break;
+            case SCOPE_TRIGGER_BELOW:
+                hit = (sample <= config->level);
+                break;
+            default:
+                hit = scope_trigger_check_edge(file->samples, start, index, config);
+                break;
+        }
+        if (hit)
+        {
+            return index;
+        }
+    }
+
+    return SCOPE_TRIGGER_CHECK_NONE;
+}
+
+/* Compares the fields of two frame headers, not their padding */
+static bool scope_trigger_check_same_header(const scope_frame_header_t *a, const scope_frame_header_t *b)
+{
+    return (a->flags == b->flags) && (a->mode == b->mode) && (a->sequence == b->sequence) &&
+           (a->samples == b->samples) && (a->trigger_index == b->trigger_index) &&
+           (a->period_ns == b->period_ns) && (a->level == b->level);
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_check_replay
+********************************************************************************
+* Summary:
+*  Feeds a sample file to the engine and re-arms after each capture. Each
+*  capture must be triggered at the sample of the reference, hold the
+*  samples of the file around it and decode unchanged from its frame. The
+*  file must not hold a further capture of the reference.
+*
+* Parameters:
+*  file: samples
+*  config: trigger and block layout
+*  first: receives the trigger sample of the first capture,
+*         SCOPE_TRIGGER_CHECK_NONE without a capture
+*
+* Return:
+*  uint32_t: number of captures, SCOPE_TRIGGER_CHECK_NONE if a capture
+*  differs from the reference
+*
+*******************************************************************************/
+static uint32_t scope_trigger_check_replay(const scope_trigger_check_file_t *file,
+                                           const scope_trigger_config_t *config, uint32_t *first)
+{
+    scope_trigger_t trigger;
+    scope_frame_header_t header =
+    {
+        .mode          = (uint8_t)config->mode,
+        .trigger_index = (uint16_t)config->pre,
+        .period_ns     = 100000u,
+        .level         = config->level,
+    };
+    scope_frame_header_t decoded;
+    uint32_t captures = 0u;
+    uint32_t start = 0u;
+    uint32_t length;
+    uint32_t used;
+
+    *first = SCOPE_TRIGGER_CHECK_NONE;
+    if (!scope_trigger_init(&trigger, config, scope_trigger_check_ring, SCOPE_FRAME_MAX_SAMPLES))
+    {
+        return SCOPE_TRIGGER_CHECK_NONE;
+    }
+    scope_trigger_arm(&trigger);
+
+    for (uint32_t index = 0u; index < file->count; index++)
+    {
+        uint32_t expected;
+        uint32_t at;
+
+        if (!scope_trigger_feed(&trigger, file->samples[index]))
+        {
+            continue;
+        }
+
+        at = (index + 1u) - config->post;
+        expected = scope_trigger_check_reference(file, start, config);
+        header.samples = (uint16_t)scope_trigger_read(&trigger, scope_trigger_check_block);
+        header.flags = trigger.forced ? SCOPE_FRAME_FLAG_FORCED : 0u;
+        length = scope_frame_encode(&header, scope_trigger_check_block, scope_trigger_check_frame,
+                                    sizeof(scope_trigger_check_frame));
+        if ((at != expected) || ((config->pre + config->post) != header.samples) || trigger.forced ||
+            (0 != memcmp(scope_trigger_check_block, &file->samples[at - config->pre],
+                         header.samples * sizeof(uint16_t))) ||
+            (SCOPE_FRAME_OK != scope_frame_decode(scope_trigger_check_frame, length, &decoded,
+                                                  scope_trigger_check_decoded, &used)) ||
+            (used != length) || !scope_trigger_check_same_header(&decoded, &header) ||
+            (0 != memcmp(scope_trigger_check_decoded, scope_trigger_check_block,
+                         header.samples * sizeof(uint16_t))))
+        {
+            return SCOPE_TRIGGER_CHECK_NONE;
+        }
+
+        *first = (0u == captures) ? at : *first;
+        captures++;
+        header.sequence++;
+        start = index + 1u;
+        scope_trigger_arm(&trigger);
+    }
+
+    return (SCOPE_TRIGGER_CHECK_NONE == scope_trigger_check_reference(file, start, config)) ?
+           captures : SCOPE_TRIGGER_CHECK_NONE;
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_check_sweep
+********************************************************************************
+* Summary:
+*  Replays a sample file with every trigger mode at levels across the scale,
+*  with and without hysteresis and with short and long blocks, against the
+*  reference. One case per mode.
+*
+* Parameters:
+*  file: samples
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void scope_trigger_check_sweep(const scope_trigger_check_file_t *file)
+{
+    static const uint16_t levels[] = { 0u, 1024u, 2047u, 2048u, 2049u, 2900u, 4095u };
+    static const uint16_t hystereses[] = { 0u, 24u, 200u };
+    static const uint32_t layouts[][2] = { { 0u, 1u }, { 1u, 1u }, { 16u, 64u }, { 256u, 768u } };
+    char what[SCOPE_TRIGGER_CHECK_LINE_SIZE];
+
+    for (uint32_t mode = 0u; mode < (uint32_t)SCOPE_TRIGGER_MODES; mode++)
+    {
+        uint32_t captures = 0u;
+        bool matched = true;
+
+        for (uint32_t level = 0u; level < (sizeof(levels) / sizeof(levels[0])); level++)
+        {
+            for (uint32_t hysteresis = 0u; hysteresis < (sizeof(hystereses) / sizeof(hystereses[0])); hysteresis++)
+            {
+                for (uint32_t layout = 0u; layout < (sizeof(layouts) / sizeof(layouts[0])); layout++)
+                {
+                    const scope_trigger_config_t config =
+                    {
+                        .mode       = (scope_trigger_mode_t)mode,
+                        .level      = levels[level],
+                        .hysteresis = hystereses[hysteresis],
+                        .pre        = layouts[layout][0],
+                        .post       = layouts[layout][1],
+                    };
+                    uint32_t first;
+                    uint32_t replayed = scope_trigger_check_replay(file, &config, &first);
+
+                    if ((SCOPE_TRIGGER_CHECK_NONE == replayed) && matched)
+                    {
+                        printf("     %s: %s at %u, hysteresis %u, %u + %u samples\n", file->name,
+                               scope_trigger_mode_name(config.mode), config.level, config.hysteresis,
+                               (unsigned int)config.pre, (unsigned int)config.post);
+                        matched = false;
+                    }
+                    captures += matched ? replayed : 0u;
+                }
+            }
+        }
+
+        /* The sweep must not pass by never firing */
+        (void)snprintf(what, sizeof(what), "%s: %s triggers as the reference", file->name,
+                       scope_trigger_mode_name((scope_trigger_mode_t)mode));
+        SCOPE_TRIGGER_CHECK(matched && (0u != captures), what);
+    }
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_check_cases
+********************************************************************************
+* Summary:
+*  Checks the captures of known features of the sample files: the edges of
+*  the recorded sine, the noisy ramps that a hysteresis must take as one
+*  edge each and the spikes and ripple around the level.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void scope_trigger_check_cases(void)
+{
+    /* File, trigger (mode, level, hysteresis, pre, post), captures, first trigger sample */
+    static const scope_trigger_check_case_t cases[] =
+    {
+        /* The frame the demo sent: its trigger at sample 256, then a rising
+         * edge every period of 200 samples */
+        { 0u, { SCOPE_TRIGGER_RISING,  2048u, 24u,  256u, 768u }, 1u, 256u },
+        { 0u, { SCOPE_TRIGGER_RISING,  2048u, 24u,  0u,   100u }, 5u, 56u },
+        { 0u, { SCOPE_TRIGGER_EITHER,  2048u, 24u,  0u,   50u },  10u, 56u },
+        { 0u, { SCOPE_TRIGGER_FALLING, 3500u, 24u,  0u,   1u },   0u, SCOPE_TRIGGER_CHECK_NONE },
+
+        /* One edge per noisy ramp with the hysteresis, a third without it */
+        { 1u, { SCOPE_TRIGGER_RISING,  2048u, 24u,  0u,   1u },   1u, 199u },
+        { 1u, { SCOPE_TRIGGER_FALLING, 2048u, 24u,  0u,   1u },   1u, 401u },
+        { 1u, { SCOPE_TRIGGER_EITHER,  2048u, 24u,  0u,   1u },   2u, 199u },
+        { 1u, { SCOPE_TRIGGER_EITHER,  2048u, 0u,   0u,   1u },   3u, 199u },
+
+        /* Spikes of 152 counts and the level steps are edges with 24 counts
+         * of hysteresis, only the square wave with 200; the ripple of 3
+         * counts after it never is */
+        { 2u, { SCOPE_TRIGGER_RISING,  2048u, 24u,  0u,   1u },   8u, 30u },
+        { 2u, { SCOPE_TRIGGER_RISING,  2048u, 200u, 0u,   1u },   2u, 340u },
+
+        /* A level trigger fires at the first sample of each half period of
+         * the square wave that has the pre-trigger samples before it */
+        { 2u, { SCOPE_TRIGGER_ABOVE,   4000u, 0u,   0u,   20u },  3u, 300u },
+        { 2u, { SCOPE_TRIGGER_BELOW,   0u,    0u,   16u,  4u },   2u, 320u },
+    };
+    char what[SCOPE_TRIGGER_CHECK_LINE_SIZE];
+
+    for (uint32_t index = 0u; index < (sizeof(cases) / sizeof(cases[0])); index++)
+    {
+        const scope_trigger_check_case_t *check = &cases[index];
+        uint32_t first;
+        uint32_t captures = scope_trigger_check_replay(&scope_trigger_check_files[check->file], &check->config,
+                                                       &first);
+
+        (void)snprintf(what, sizeof(what), "%s: %s at %u, hysteresis %u: %u captures from sample %u",
+                       scope_trigger_check_files[check->file].name, scope_trigger_mode_name(check->config.mode),
+                       check->config.level, check->config.hysteresis, (unsigned int)check->captures,
+                       (unsigned int)check->first);
+        SCOPE_TRIGGER_CHECK((check->captures == captures) && (check->first == first), what);
+    }
+}
+/*******************************************************************************
+* Function Name: scope_trigger_check_force
+********************************************************************************
+* Summary:
+*  A forced trigger fires at the first sample that has the pre-trigger
+*  samples before it, even when forced earlier, and does not mark a capture
+*  that its own trigger fired.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void scope_trigger_check_force(void)
+{
+    const scope_trigger_config_t config = { SCOPE_TRIGGER_RISING, 2048u, 24u, 8u, 8u };
+    scope_trigger_t trigger;
+    uint32_t fed = 1u;
+
+    SCOPE_TRIGGER_CHECK(scope_trigger_init(&trigger, &config, scope_trigger_check_ring, SCOPE_FRAME_MAX_SAMPLES),
+                        "init of the forced capture");
+    scope_trigger_arm(&trigger);
+    /* Sample n of the capture is 1000 + n */
+    scope_trigger_feed(&trigger, 1000u);
+    scope_trigger_force(&trigger);
+    while (!scope_trigger_feed(&trigger, (uint16_t)(1000u + fed)))
+    {
+        fed++;
+    }
+    SCOPE_TRIGGER_CHECK(trigger.forced && (15u == fed), "a force fires after the pre-trigger samples");
+    SCOPE_TRIGGER_CHECK((16u == scope_trigger_read(&trigger, scope_trigger_check_block)) &&
+                        (1008u == scope_trigger_check_block[8]), "the forced trigger sample");
+
+    /* An edge after the pre-trigger samples, before the force is seen */
+    scope_trigger_arm(&trigger);
+    for (fed = 0u; fed < 8u; fed++)
+    {
+        scope_trigger_feed(&trigger, 1000u);
+    }
+    scope_trigger_feed(&trigger, 3000u);
+    scope_trigger_force(&trigger);
+    for (fed = 0u; (fed < 7u) && !scope_trigger_done(&trigger); fed++)
+    {
+        scope_trigger_feed(&trigger, 3000u);
+    }
+    SCOPE_TRIGGER_CHECK(scope_trigger_done(&trigger) && !trigger.forced, "an edge is not a forced trigger");
+    scope_trigger_arm(&trigger);
+    SCOPE_TRIGGER_CHECK(!trigger.forced, "arming clears the force");
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_check_states
+********************************************************************************
+* Summary:
+*  Checks the layouts refused by the init, that samples are ignored before
+*  the arming and after the capture, and the names of the modes.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void scope_trigger_check_states(void)
+{
+    scope_trigger_config_t config = { SCOPE_TRIGGER_NONE, 0u, 0u, 4u, 4u };
+    scope_trigger_t trigger;
+    bool done = false;
+
+    config.mode = SCOPE_TRIGGER_MODES;
+    SCOPE_TRIGGER_CHECK(!scope_trigger_init(&trigger, &config, scope_trigger_check_ring, 8u), "unknown mode");
+    config.mode = SCOPE_TRIGGER_NONE;
+    config.post = 0u;
+    SCOPE_TRIGGER_CHECK(!scope_trigger_init(&trigger, &config, scope_trigger_check_ring, 8u), "no post sample");
+    config.pre = 9u;
+    config.post = 1u;
+    SCOPE_TRIGGER_CHECK(!scope_trigger_init(&trigger, &config, scope_trigger_check_ring, 8u), "pre past the ring");
+    config.pre = 4u;
+    config.post = 5u;
+    SCOPE_TRIGGER_CHECK(!scope_trigger_init(&trigger, &config, scope_trigger_check_ring, 8u), "block past the ring");
+    config.post = 4u;
+    SCOPE_TRIGGER_CHECK(scope_trigger_init(&trigger, &config, scope_trigger_check_ring, 8u), "block filling the ring");
+
+    /* Not armed yet */
+    SCOPE_TRIGGER_CHECK(!scope_trigger_feed(&trigger, 1u) && (0u == trigger.count), "a sample before the arming");
+    SCOPE_TRIGGER_CHECK(0u == scope_trigger_read(&trigger, scope_trigger_check_block), "a read before the arming");
+
+    scope_trigger_arm(&trigger);
+    for (uint16_t sample = 10u; sample < 18u; sample++)
+    {
+        SCOPE_TRIGGER_CHECK(!done, "the capture ends with its last sample");
+        done = scope_trigger_feed(&trigger, sample);
+    }
+    SCOPE_TRIGGER_CHECK(done && scope_trigger_feed(&trigger, 99u), "a sample after the capture");
+    SCOPE_TRIGGER_CHECK((8u == scope_trigger_read(&trigger, scope_trigger_check_block)) &&
+                        (10u == scope_trigger_check_block[0]) && (17u == scope_trigger_check_block[7]),
+                        "a sample after the capture is ignored");
+
+    SCOPE_TRIGGER_CHECK((0 == strcmp("either", scope_trigger_mode_name(SCOPE_TRIGGER_EITHER))) &&
+                        (NULL == scope_trigger_mode_name(SCOPE_TRIGGER_MODES)), "names of the modes");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Loads the sample files and runs the cases.
+*
+* Parameters:
+*  argc: argument count
+*  argv: directory of the sample files, tools/scope_samples by default
+*
+* Return:
+*  int: 0 if all checks pass, 1 otherwise, 2 if a sample file is missing
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    const char *dir = (argc > 1) ? argv[1] : SCOPE_TRIGGER_CHECK_DIR;
+
+    for (uint32_t file = 0u; file < SCOPE_TRIGGER_CHECK_FILES; file++)
+    {
+        if (!scope_trigger_check_load(dir, &scope_trigger_check_files[file]))
+        {
+            return 2;
+        }
+    }
+
+    scope_trigger_check_states();
+    scope_trigger_check_force();
+    for (uint32_t file = 0u; file < SCOPE_TRIGGER_CHECK_FILES; file++)
+    {
+        scope_trigger_check_sweep(&scope_trigger_check_files[file]);
+    }
+    scope_trigger_check_cases();
+
+    printf("scope_trigger_check: %u cases, %u failures\n", scope_trigger_check_cases_run,
+           scope_trigger_check_failures);
+
+    return (0u == scope_trigger_check_failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
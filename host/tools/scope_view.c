@@ -0,0 +1,396 @@
+/*******************************************************************************
+* File Name:   scope_view.c
+*
+* Description: PC end of the scope capture of the SAR ADC demo. "decode"
+*              finds the binary frames (scope_frame.h) in the console byte
+*              stream of the kit or of the host simulation, writes their
+*              samples as CSV and passes the text lines around them to
+*              stderr. "replay" runs recorded samples through the trigger
+*              engine of the target (scope_trigger.c) and writes the captures
+*              it fires, encoded and decoded as on the console, in the same
+*              CSV format.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "scope_frame.h"
+#include "scope_trigger.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* 12-bit results against the VDDA reference of the kit */
+#define SCOPE_VIEW_FULL_SCALE       (4096u)
+#define SCOPE_VIEW_VREF_MV          (3300u)
+
+/* Receive buffer of decode, two frames of the largest size */
+#define SCOPE_VIEW_BUFFER_SIZE      (2u * SCOPE_FRAME_SIZE(SCOPE_FRAME_MAX_SAMPLES))
+
+/* Longest line of a replayed sample file */
+#define SCOPE_VIEW_LINE_SIZE        (256u)
+
+/* Field of the counts in the CSV written by decode, from 0 */
+#define SCOPE_VIEW_COUNTS_FIELD     (4u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void scope_view_usage(void);
+static void scope_view_csv(FILE *out, const scope_frame_header_t *header, const uint16_t *samples);
+static int scope_view_decode(const char *path);
+static bool scope_view_parse_sample(const char *line, uint16_t *sample);
+static int scope_view_replay(const char *path, const scope_trigger_config_t *config);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint16_t scope_view_samples[SCOPE_FRAME_MAX_SAMPLES];
+static uint8_t scope_view_frame[SCOPE_FRAME_SIZE(SCOPE_FRAME_MAX_SAMPLES)];
+
+
+static void scope_view_usage(void)
+{
+    fprintf(stderr,
+            "usage: scope_view decode [<file or port>]\n"
+            "       scope_view replay <samples> <none|rising|falling|either|above|below> <level> <pre> <post>"
+            " [<hysteresis>]\n"
+            "decode reads stdin without a file; configure a port first, e.g. stty -F <port> 115200 raw.\n"
+            "replay reads one sample per line in ADC counts, or the CSV written by decode.\n");
+}
+
+/*******************************************************************************
+* Function Name: scope_view_csv
+********************************************************************************
+* Summary:
+*  Writes a capture as a comment line with its header, then one line per
+*  sample: frame, index, samples from the trigger, time from the trigger in
+*  ns, ADC counts and millivolts.
+*
+* Parameters:
+*  out: output stream
+*  header: capture description
+*  samples: samples of the capture
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void scope_view_csv(FILE *out, const scope_frame_header_t *header, const uint16_t *samples)
+{
+    const char *mode = scope_trigger_mode_name((scope_trigger_mode_t)header->mode);
+
+    fprintf(out, "# frame %u, %s trigger at %u counts%s, sample %u of %u, period %lu ns\n",
+            (unsigned int)header->sequence, (NULL != mode) ? mode : "unknown", (unsigned int)header->level,
+            (0u != (header->flags & SCOPE_FRAME_FLAG_FORCED)) ? " (forced)" : "",
+            (unsigned int)header->trigger_index, (unsigned int)header->samples, (unsigned long)header->period_ns);
+    fprintf(out, "frame,index,offset,time_ns,counts,mv\n");
+    for (uint32_t index = 0u; index < header->samples; index++)
+    {
+        long offset = (long)index - (long)header->trigger_index;
+
+        fprintf(out, "%u,%lu,%ld,%lld,%u,%lu\n", (unsigned int)header->sequence, (unsigned long)index, offset,
+                (long long)offset * header->period_ns, (unsigned int)samples[index],
+                (unsigned long)(((uint32_t)samples[index] * SCOPE_VIEW_VREF_MV) / SCOPE_VIEW_FULL_SCALE));
+    }
+    fflush(out);
+}
+
+/*******************************************************************************
+* Function Name: scope_view_decode
+********************************************************************************
+* Summary:
+*  Decodes the frames of a byte stream until its end. A byte that does not
+*  start a valid frame is console text and goes to stderr.
+*
+* Parameters:
+*  path: file or serial port, NULL for stdin
+*
+* Return:
+*  int: exit status, 0 if at least one frame was decoded
+*
+*******************************************************************************/
+static int scope_view_decode(const char *path)
+{
+    static uint8_t buffer[SCOPE_VIEW_BUFFER_SIZE];
+    FILE *in = (NULL != path) ? fopen(path, "rb") : stdin;
+    uint32_t length = 0u;
+    uint32_t frames = 0u;
+    uint32_t dropped = 0u;
+    bool end = false;
+
+    if (NULL == in)
+    {
+        fprintf(stderr, "scope_view: %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+
+    while (!end || (0u != length))
+    {
+        scope_frame_header_t header;
+        scope_frame_status_t status;
+        uint32_t used = 0u;
+
+        if (!end && (length < sizeof(buffer)))
+        {
+            size_t got = fread(&buffer[length], 1u, sizeof(buffer) - length, in);
+
+            /* A port or a pipe returns what has arrived so far */
+            if (0u == got)
+            {
+                end = true;
+            }
+            length += (uint32_t)got;
+        }
+
+        status = scope_frame_decode(buffer, length, &header, scope_view_samples, &used);
+        if (SCOPE_FRAME_OK == status)
+        {
+            scope_view_csv(stdout, &header, scope_view_samples);
+            frames++;
+        }
+        else if ((SCOPE_FRAME_INVALID == status) || end)
+        {
+            /* Text of the console, or the cut-off start of a frame at the end */
+            fputc(buffer[0], stderr);
+            used = 1u;
+            dropped += (SCOPE_FRAME_MAGIC_0 == buffer[0]) ? 1u : 0u;
+        }
+        else
+        {
+            continue;
+        }
+        length -= used;
+        memmove(buffer, &buffer[used], length);
+    }
+
+    if (NULL != path)
+    {
+        fclose(in);
+    }
+    fprintf(stderr, "\nscope_view: %lu frames decoded, %lu possible frame starts rejected\n", (unsigned long)frames,
+            (unsigned long)dropped);
+
+    return (0u != frames) ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: scope_view_parse_sample
+********************************************************************************
+* Summary:
+*  Reads the sample of a line of a recorded file: the first number of a
+*  plain line, the counts field of a CSV line written by decode. Comment
+*  lines and the CSV heading have no sample.
+*
+* Parameters:
+*  line: text line
+*  sample: receives the sample
+*
+* Return:
+*  bool: false if the line has no sample
+*
+*******************************************************************************/
+static bool scope_view_parse_sample(const char *line, uint16_t *sample)
+{
+    const char *field = line;
+    char *end;
+    unsigned long value;
+
+    if (NULL != strchr(line, ','))
+    {
+        for (uint32_t index = 0u; (index < SCOPE_VIEW_COUNTS_FIELD) && (NULL != field); index++)
+        {
+            field = strchr(field, ',');
+            field = (NULL != field) ? (field + 1) : NULL;
+        }
+        if (NULL == field)
+        {
+            return false;
+        }
+    }
+    errno = 0;
+    value = strtoul(field, &end, 0);
+    if ((end == field) || (0 != errno) || (value >= SCOPE_VIEW_FULL_SCALE))
+    {
+        return false;
+    }
+    *sample = (uint16_t)value;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: scope_view_replay
+********************************************************************************
+* Summary:
+*  Feeds the samples of a file to the trigger engine, writes each capture
+*  after a round trip through the frame encoder and decoder, and re-arms at
+*  once, as the demo does. The comment line of each capture gives the line
+*  of the trigger sample among the samples of the file on stderr.
+*
+* Parameters:
+*  path: sample file
+*  config: trigger and block layout
+*
+* Return:
+*  int: exit status, 0 if at least one capture fired
+*
+*******************************************************************************/
+static int scope_view_replay(const char *path, const scope_trigger_config_t *config)
+{
+    static uint16_t ring[SCOPE_FRAME_MAX_SAMPLES];
+    char line[SCOPE_VIEW_LINE_SIZE];
+    scope_trigger_t trigger;
+    scope_frame_header_t header =
+    {
+        .mode  = (uint8_t)config->mode,
+        .level = config->level,
+    };
+    scope_frame_header_t decoded;
+    uint32_t position = 0u;
+    uint32_t length;
+    uint32_t used;
+    FILE *in = fopen(path, "r");
+
+    if (NULL == in)
+    {
+        fprintf(stderr, "scope_view: %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    if (!scope_trigger_init(&trigger, config, ring, SCOPE_FRAME_MAX_SAMPLES))
+    {
+        fprintf(stderr, "scope_view: pre + post must be 1 to %u samples\n", SCOPE_FRAME_MAX_SAMPLES);
+        fclose(in);
+        return 2;
+    }
+    scope_trigger_arm(&trigger);
+
+    while (NULL != fgets(line, sizeof(line), in))
+    {
+        uint16_t sample;
+
+        if (('#' == line[0]) || !scope_view_parse_sample(line, &sample))
+        {
+            continue;
+        }
+        position++;
+        if (!scope_trigger_feed(&trigger, sample))
+        {
+            continue;
+        }
+
+        header.samples = (uint16_t)scope_trigger_read(&trigger, scope_view_samples);
+        header.trigger_index = (uint16_t)config->pre;
+        length = scope_frame_encode(&header, scope_view_samples, scope_view_frame, sizeof(scope_view_frame));
+        if ((0u == length) ||
+            (SCOPE_FRAME_OK != scope_frame_decode(scope_view_frame, length, &decoded, scope_view_samples, &used)) ||
+            (used != length))
+        {
+            fprintf(stderr, "scope_view: frame %u does not decode\n", (unsigned int)header.sequence);
+            fclose(in);
+            return 1;
+        }
+        fprintf(stderr, "scope_view: frame %u triggered by sample %lu of the file\n",
+                (unsigned int)header.sequence, (unsigned long)(position - config->post));
+        scope_view_csv(stdout, &decoded, scope_view_samples);
+        header.sequence++;
+        scope_trigger_arm(&trigger);
+    }
+    fclose(in);
+
+    fprintf(stderr, "scope_view: %lu samples, %u captures\n", (unsigned long)position,
+            (unsigned int)header.sequence);
+
+    return (0u != header.sequence) ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs decode or replay.
+*
+* Parameters:
+*  argc: argument count
+*  argv: arguments, see scope_view_usage()
+*
+* Return:
+*  int: 0 on success, 1 without frame or capture, 2 on a usage error
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    scope_trigger_config_t config = { .hysteresis = 0u };
+
+    if ((argc >= 2) && (0 == strcmp(argv[1], "decode")) && (argc <= 3))
+    {
+        return scope_view_decode((3 == argc) ? argv[2] : NULL);
+    }
+    if ((argc >= 7) && (0 == strcmp(argv[1], "replay")) && (argc <= 8))
+    {
+        for (config.mode = SCOPE_TRIGGER_NONE; config.mode < SCOPE_TRIGGER_MODES; config.mode++)
+        {
+            if (0 == strcmp(argv[3], scope_trigger_mode_name(config.mode)))
+            {
+                break;
+            }
+        }
+        config.level = (uint16_t)strtoul(argv[4], NULL, 0);
+        config.pre = (uint32_t)strtoul(argv[5], NULL, 0);
+        config.post = (uint32_t)strtoul(argv[6], NULL, 0);
+        if (8 == argc)
+        {
+            config.hysteresis = (uint16_t)strtoul(argv[7], NULL, 0);
+        }
+        if (config.mode < SCOPE_TRIGGER_MODES)
+        {
+            return scope_view_replay(argv[2], &config);
+        }
+    }
+
+    scope_view_usage();
+
+    return 2;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,478 @@
+/*******************************************************************************
+* File Name:   term_check.c
+*
+* Description: Host check of the diff-based terminal rendering of the console
+*              layout (term_screen.h). A small VT100 model takes the output
+*              of random edits of the screen model, rendered into buffers of
+*              random sizes, and must show what the model holds after every
+*              render. A session of menu switches and status updates then
+*              compares the bytes sent with those of the line output and of
+*              full redraws. Exits with 1 if a check fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "term_screen.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Failures printed before only counting them */
+#define TERM_CHECK_PRINT            (10u)
+
+/* Random edit sequences, and edits between two renders */
+#define TERM_CHECK_RUNS             (2000u)
+#define TERM_CHECK_EDITS            (40u)
+
+/* Largest render buffer tried, several rows */
+#define TERM_CHECK_OUT_SIZE         (4u * TERM_SCREEN_ROW_MAX_BYTES)
+
+/* Session: demo switches and status updates, one every 100 ms as the SAR
+ * ADC demo does */
+#define TERM_CHECK_SWITCHES         (9u)
+#define TERM_CHECK_UPDATES          (1000u)
+
+/* Rows of the session layout: title, prompt, menu, link and status */
+#define TERM_CHECK_STATUS_ROW       (10u)
+#define TERM_CHECK_LAYOUT_ROWS      (TERM_CHECK_STATUS_ROW + 1u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* What a VT100 shows, for the sequences that the renderer emits */
+typedef struct
+{
+    char     cells[TERM_SCREEN_MAX_ROWS][TERM_SCREEN_COLS];
+    uint32_t row;
+    uint32_t col;
+    bool     wrap;                  /* Last column written, the next character wraps */
+    uint32_t params[2];
+    uint32_t count;
+    uint32_t state;                 /* 0 text, 1 after ESC, 2 in a CSI sequence */
+} term_check_vt_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void term_check_fail(const char *what, uint32_t run);
+static void term_check_vt_reset(term_check_vt_t *vt);
+static void term_check_vt_csi(term_check_vt_t *vt, char final);
+static void term_check_vt_feed(term_check_vt_t *vt, const char *data, uint32_t length);
+static void term_check_random_text(char *text, uint32_t length);
+static void term_check_run(uint32_t run);
+static uint32_t term_check_render_all(term_screen_t *screen, term_check_vt_t *vt, uint32_t size, uint32_t run);
+static void term_check_session(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const term_check_names[] =
+{
+    "LED control", "Smart IO", "GPIO interrupt", "SAR ADC", "QSPI memory",
+    "Crypto", "CAN FD", "Parameter console", "Profiler",
+};
+
+static const char *const term_check_title[] =
+{
+    "******************************************************************",
+    "**  XMC7000 MCU: Running the out-of-the-box (OOB) demo project  **",
+    "******************************************************************",
+};
+
+static uint32_t term_check_cases = 0u;
+static uint32_t term_check_failures = 0u;
+
+
+/* Counts a failure and prints the first ones */
+static void term_check_fail(const char *what, uint32_t run)
+{
+    term_check_failures++;
+    if (term_check_failures <= TERM_CHECK_PRINT)
+    {
+        printf("FAIL %s: run %u\n", what, run);
+    }
+}
+
+/* Terminal with garbage on it and the cursor somewhere, as the renderer
+ * finds it before the first erase */
+static void term_check_vt_reset(term_check_vt_t *vt)
+{
+    for (uint32_t row = 0u; row < TERM_SCREEN_MAX_ROWS; row++)
+    {
+        for (uint32_t col = 0u; col < TERM_SCREEN_COLS; col++)
+        {
+            vt->cells[row][col] = (char)('!' + (rand() % 90));
+        }
+    }
+    vt->row = (uint32_t)rand() % TERM_SCREEN_MAX_ROWS;
+    vt->col = (uint32_t)rand() % TERM_SCREEN_COLS;
+    vt->wrap = false;
+    vt->state = 0u;
+}
+
+/* Executes a CSI sequence: cursor position, erase in line and in display */
+static void term_check_vt_csi(term_check_vt_t *vt, char final)
+{
+    uint32_t row = (vt->count > 0u) ? vt->params[0] : 0u;
+    uint32_t col = (vt->count > 1u) ? vt->params[1] : 0u;
+
+    vt->wrap = false;
+    if ('H' == final)
+    {
+        row = (0u == row) ? 1u : row;
+        col = (0u == col) ? 1u : col;
+        vt->row = (row > TERM_SCREEN_MAX_ROWS) ? (TERM_SCREEN_MAX_ROWS - 1u) : (row - 1u);
+        vt->col = (col > TERM_SCREEN_COLS) ? (TERM_SCREEN_COLS - 1u) : (col - 1u);
+    }
+    else if ('K' == final)
+    {
+        memset(&vt->cells[vt->row][vt->col], ' ', TERM_SCREEN_COLS - vt->col);
+    }
+    else if (('J' == final) && (2u == row))
+    {
+        memset(vt->cells, ' ', sizeof(vt->cells));
+    }
+    else
+    {
+        term_check_fail("unexpected sequence", 0u);
+    }
+}
+
+/* Interprets terminal output */
+static void term_check_vt_feed(term_check_vt_t *vt, const char *data, uint32_t length)
+{
+    for (uint32_t index = 0u; index < length; index++)
+    {
+        char c = data[index];
+
+        if (1u == vt->state)
+        {
+            vt->state = ('[' == c) ? 2u : 0u;
+            vt->count = 0u;
+            vt->params[0] = 0u;
+            vt->params[1] = 0u;
+        }
+        else if (2u == vt->state)
+        {
+            if ((c >= '0') && (c <= '9'))
+            {
+                vt->count = (0u == vt->count) ? 1u : vt->count;
+                vt->params[vt->count - 1u] = (vt->params[vt->count - 1u] * 10u) + (uint32_t)(c - '0');
+            }
+            else if ((';' == c) && (vt->count < 2u))
+            {
+                vt->count = (0u == vt->count) ? 2u : (vt->count + 1u);
+            }
+            else
+            {
+                term_check_vt_csi(vt, c);
+                vt->state = 0u;
+            }
+        }
+        else if ('\x1b' == c)
+        {
+            vt->state = 1u;
+        }
+        else if (((uint8_t)c < 0x20u) || (0x7F == (uint8_t)c))
+        {
+            term_check_fail("control character", 0u);
+        }
+        else
+        {
+            if (vt->wrap)
+            {
+                vt->col = 0u;
+                vt->row = (vt->row < (TERM_SCREEN_MAX_ROWS - 1u)) ? (vt->row + 1u) : vt->row;
+                vt->wrap = false;
+            }
+            vt->cells[vt->row][vt->col] = c;
+            if (vt->col < (TERM_SCREEN_COLS - 1u))
+            {
+                vt->col++;
+            }
+            else
+            {
+                vt->wrap = true;
+            }
+        }
+    }
+}
+
+/* Text biased to blanks and repeated letters, so that edits often leave
+ * cells unchanged; with control characters now and then */
+static void term_check_random_text(char *text, uint32_t length)
+{
+    for (uint32_t index = 0u; index < length; index++)
+    {
+        uint32_t pick = (uint32_t)rand() % 16u;
+
+        text[index] = (pick < 6u) ? ' ' : ((pick < 14u) ? (char)('a' + (pick % 3u)) :
+                      ((pick < 15u) ? '\t' : (char)('!' + (rand() % 90))));
+    }
+    text[length] = '\0';
+}
+
+/*******************************************************************************
+* Function Name: term_check_render_all
+********************************************************************************
+* Summary:
+*  Renders until the model is clean, into buffers of the given size, feeds
+*  the output to the terminal model and checks the rows of the area.
+*
+* Parameters:
+*  screen: screen model
+*  vt: terminal model
+*  size: render buffer size, at least TERM_SCREEN_ROW_MAX_BYTES + 4
+*  run: run number for the failure report
+*
+* Return:
+*  uint32_t: bytes sent
+*
+*******************************************************************************/
+static uint32_t term_check_render_all(term_screen_t *screen, term_check_vt_t *vt, uint32_t size, uint32_t run)
+{
+    static char out[TERM_CHECK_OUT_SIZE];
+    uint32_t total = 0u;
+    uint32_t length;
+
+    while (term_screen_dirty(screen))
+    {
+        length = term_screen_render(screen, out, size);
+        if ((0u == length) || (length > size))
+        {
+            term_check_fail((0u == length) ? "no progress" : "overflow", run);
+            return total;
+        }
+        term_check_vt_feed(vt, out, length);
+        total += length;
+    }
+
+    term_check_cases++;
+    if (0u != term_screen_render(screen, out, size))
+    {
+        term_check_fail("output when clean", run);
+    }
+    for (uint32_t row = 0u; row < screen->rows; row++)
+    {
+        if (0 != memcmp(vt->cells[row], screen->want[row], TERM_SCREEN_COLS))
+        {
+            term_check_fail("screen differs", run);
+            break;
+        }
+    }
+
+    return total;
+}
+
+/*******************************************************************************
+* Function Name: term_check_run
+********************************************************************************
+* Summary:
+*  One sequence of random edits and renders. Between renders the terminal
+*  may have its cursor moved by other output, or be reset entirely.
+*
+* Parameters:
+*  run: run number, also the seed
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void term_check_run(uint32_t run)
+{
+    static term_screen_t screen;
+    term_check_vt_t vt;
+    char text[TERM_SCREEN_COLS + 1u];
+
+    srand(run);
+    term_screen_init(&screen, 1u + ((uint32_t)rand() % TERM_SCREEN_MAX_ROWS));
+    term_check_vt_reset(&vt);
+
+    for (uint32_t step = 0u; step < TERM_CHECK_EDITS; step++)
+    {
+        uint32_t edits = 1u + ((uint32_t)rand() % 8u);
+        uint32_t size = TERM_SCREEN_ROW_MAX_BYTES + 4u +
+                        ((uint32_t)rand() % (TERM_CHECK_OUT_SIZE - TERM_SCREEN_ROW_MAX_BYTES - 3u));
+
+        for (uint32_t edit = 0u; edit < edits; edit++)
+        {
+            uint32_t row = (uint32_t)rand() % TERM_SCREEN_MAX_ROWS;
+            uint32_t col = (uint32_t)rand() % TERM_SCREEN_COLS;
+            uint32_t width = 1u + ((uint32_t)rand() % TERM_SCREEN_COLS);
+
+            term_check_random_text(text, (uint32_t)rand() % (width + 1u));
+            term_screen_put(&screen, row, col, width, text);
+        }
+        if (0u == ((uint32_t)rand() % 16u))
+        {
+            term_screen_clear(&screen);
+        }
+        if (0u == ((uint32_t)rand() % 8u))
+        {
+            vt.row = (uint32_t)rand() % TERM_SCREEN_MAX_ROWS;
+            vt.col = (uint32_t)rand() % TERM_SCREEN_COLS;
+            vt.wrap = false;
+            term_screen_cursor_moved(&screen);
+        }
+        if (0u == ((uint32_t)rand() % 32u))
+        {
+            term_check_vt_reset(&vt);
+            term_screen_invalidate(&screen);
+        }
+
+        (void)term_check_render_all(&screen, &vt, size, run);
+    }
+}
+
+/*******************************************************************************
+* Function Name: term_check_session
+********************************************************************************
+* Summary:
+*  Draws a layout like the console menu, switches the selected demo and
+*  updates a millivolt status line, and reports the bytes of the diff
+*  rendering against printing a line per update and against redrawing the
+*  whole layout.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void term_check_session(void)
+{
+    static term_screen_t screen;
+    term_check_vt_t vt;
+    char text[TERM_SCREEN_COLS + 1u];
+    uint32_t count = sizeof(term_check_names) / sizeof(term_check_names[0]);
+    uint32_t diff_bytes = 0u;
+    uint32_t line_bytes = 0u;
+    uint32_t full_bytes = 0u;
+    int32_t millivolts = 1650;
+
+    srand(1u);
+    term_screen_init(&screen, TERM_CHECK_LAYOUT_ROWS);
+    term_check_vt_reset(&vt);
+
+    for (uint32_t demo = 0u; demo < TERM_CHECK_SWITCHES; demo++)
+    {
+        uint32_t full;
+
+        /* The menu, as drawn by the layout and as printed line by line after
+         * a clear of the screen */
+        line_bytes += 4u;
+        for (uint32_t row = 0u; row < 3u; row++)
+        {
+            (void)snprintf(text, sizeof(text), "%s", term_check_title[row]);
+            term_screen_put(&screen, row, 0u, TERM_SCREEN_COLS, text);
+            line_bytes += (uint32_t)strlen(text) + 2u;
+        }
+        (void)snprintf(text, sizeof(text), "Enter an option from 1 - %u to run the selected demo:", count);
+        term_screen_put(&screen, 3u, 0u, TERM_SCREEN_COLS, text);
+        line_bytes += (uint32_t)strlen(text) + 4u;
+        for (uint32_t index = 0u; index < count; index++)
+        {
+            (void)snprintf(text, sizeof(text), "%c %u. %s", (index == demo) ? '>' : ' ', index + 1u,
+                           term_check_names[index]);
+            term_screen_put(&screen, 4u + (index % 5u), (index / 5u) * 34u, 34u, text);
+            line_bytes += (uint32_t)strlen(text) + 2u;
+        }
+        (void)snprintf(text, sizeof(text), "https://github.com/Infineon/Code-Examples-for-ModusToolbox-Software");
+        term_screen_put(&screen, 9u, 0u, TERM_SCREEN_COLS, text);
+        line_bytes += (uint32_t)strlen(text) + 4u;
+        term_screen_put(&screen, TERM_CHECK_STATUS_ROW, 0u, TERM_SCREEN_COLS, "");
+        diff_bytes += term_check_render_all(&screen, &vt, TERM_CHECK_OUT_SIZE, 0u);
+
+        /* A full redraw writes every cell of the layout after an erase */
+        full = 4u + (TERM_CHECK_LAYOUT_ROWS * (TERM_SCREEN_COLS + 2u));
+
+        for (uint32_t update = 0u; update < (TERM_CHECK_UPDATES / TERM_CHECK_SWITCHES); update++)
+        {
+            uint32_t length;
+
+            millivolts += (rand() % 41) - 20;
+            millivolts = (millivolts < 0) ? 0 : ((millivolts > 3300) ? 3300 : millivolts);
+            length = (uint32_t)snprintf(text, sizeof(text), "Channel 0 input: %4dmV", millivolts);
+            term_screen_put(&screen, TERM_CHECK_STATUS_ROW, 0u, TERM_SCREEN_COLS, text);
+
+            /* The cursor is saved and restored around every update */
+            term_screen_cursor_moved(&screen);
+            diff_bytes += 4u + term_check_render_all(&screen, &vt, TERM_CHECK_OUT_SIZE, 0u);
+            line_bytes += length + 2u;
+            full_bytes += full;
+        }
+    }
+
+    printf("term_check: session of %u menus and %u status updates: %u bytes, %u as lines, %u redrawn\n",
+           TERM_CHECK_SWITCHES, (TERM_CHECK_UPDATES / TERM_CHECK_SWITCHES) * TERM_CHECK_SWITCHES,
+           diff_bytes, line_bytes, full_bytes);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the random edit sequences and the session.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: 0 if every check passed, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    for (uint32_t run = 0u; run < TERM_CHECK_RUNS; run++)
+    {
+        term_check_run(run);
+    }
+    term_check_session();
+
+    printf("term_check: %u cases, %u failures\n", term_check_cases, term_check_failures);
+
+    return (0u == term_check_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -43,12 +43,32 @@
 #include "cy_pdl.h"
 #include "cyhal.h"
 #include "cybsp.h"
+#include "boot_time.h"
+#include "mem_guard.h"
+#if IO_COPROCESSOR
+#include "ipc_comm.h"
+#include "ipc_logger.h"
+#include "io_coprocessor.h"
+#endif /* IO_COPROCESSOR */
 
 #define CM7_DUAL    1
 
+#if IO_COPROCESSOR
+/* Doorbell interrupt, on a CPU interrupt line not used by the HAL */
+#define IPC_DOORBELL_CPU_IRQ        (NvicMux4_IRQn)
+#define IPC_DOORBELL_PRIORITY       (3u)
+#endif /* IO_COPROCESSOR */
+
 int main(void)
 {
     cy_rslt_t result;
+#if IO_COPROCESSOR
+    ipc_shared_t *shared;
+    uint32_t intr_status;
+#endif /* IO_COPROCESSOR */
+
+    /* Paint the unused stack before anything runs on it */
+    mem_guard_stack_paint();
 
     /* Initialize the device and board peripherals */
     result = cybsp_init() ;
@@ -57,16 +77,53 @@ int main(void)
         CY_ASSERT(0);
     }
 
+    /* Start the boot timebase as soon as the clocks run */
+    boot_time_start();
+
     /* enable interrupts */
     __enable_irq();
 
-    /* Enable CM7_0/1. CY_CORTEX_M7_APPL_ADDR is calculated in linker script, check it in case of problems. */
+    /* Enable CM7_0/1. CY_CORTEX_M7_APPL_ADDR is calculated in linker script, check it in case of problems.
+     * CM7_1 waits for the shared block of CM7_0 by itself, so both are released back to back. */
     Cy_SysEnableCM7(CORE_CM7_0, CY_CORTEX_M7_0_APPL_ADDR);
+    boot_time_mark(BOOT_PHASE_CM0P_CM7_0);
 #if CM7_DUAL
-    cyhal_system_delay_ms(1);
     Cy_SysEnableCM7(CORE_CM7_1, CY_CORTEX_M7_1_APPL_ADDR);
+    boot_time_mark(BOOT_PHASE_CM0P_CM7_1);
 #endif /* CM7_DUAL */
 
+#if IO_COPROCESSOR
+    /* Serve the console and the buttons of CM7_0 once it publishes the shared block */
+    while (NULL == (shared = ipc_comm_attach()))
+    {
+        Cy_SysLib_Delay(1u);
+    }
+    ipc_comm_doorbell_init(IPC_CORE_CM0P, IPC_DOORBELL_CPU_IRQ, IPC_DOORBELL_PRIORITY, NULL);
+    ipc_logger_attach(shared, IPC_CORE_CM0P);
+    result = io_coprocessor_init(shared);
+    if (result != CY_RSLT_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+    ipc_logger_printf("I/O co-processor ready");
+
+    for(;;)
+    {
+        if (0u == io_coprocessor_poll())
+        {
+            mem_guard_idle(&shared->memory[IPC_CORE_CM0P]);
+
+            /* A doorbell that rings after the check keeps the WFI from sleeping */
+            intr_status = Cy_SysLib_EnterCriticalSection();
+            if (!ipc_comm_doorbell_pending())
+            {
+                Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+            }
+            Cy_SysLib_ExitCriticalSection(intr_status);
+        }
+    }
+#endif /* IO_COPROCESSOR */
+
     for(;;)
     {
         Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
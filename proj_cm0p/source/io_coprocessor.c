@@ -0,0 +1,450 @@
+/*******************************************************************************
+* File Name:   io_coprocessor.c
+*
+* Description: CM0+ I/O co-processor. CM0+ owns the debug UART and the user
+*              buttons: it parses the console input, debounces the buttons and
+*              forwards the resulting events to CM7_0 over the event ring. The
+*              console output of CM7_0 arrives over the console ring and is
+*              written to the UART here.
+*
+*              The UART and the debounce timer interrupts are the only
+*              producers of the event ring. They share one priority, so they
+*              never preempt each other.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "io_coprocessor.h"
+#include "ipc_io.h"
+#include "ipc_logger.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Priority of the UART, button and debounce timer interrupts */
+#define IO_INTERRUPT_PRIORITY       (3u)
+
+#define IO_UART_BAUD_RATE           (115200u)
+
+/* Debounce timer: 10 kHz clock, 10 ms period */
+#define IO_DEBOUNCE_TIMER_FREQ      (10000u)
+#define IO_DEBOUNCE_PERIOD_MS       (10u)
+
+/* Number of user buttons */
+#define IO_BUTTON_NUM               (2u)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    IO_BUTTON_IDLE,                         /* Waiting for a falling edge */
+    IO_BUTTON_DEBOUNCE,                     /* Edge seen, confirming on the next tick */
+    IO_BUTTON_PRESSED,                      /* Held down, counting the duration */
+} io_button_state_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    cyhal_gpio_t                pin;
+    uint8_t                     number;     /* IPC_IO_BUTTON1 or IPC_IO_BUTTON2 */
+    volatile io_button_state_t  state;
+    uint32_t                    held_ticks;
+    cyhal_gpio_callback_data_t  callback_data;
+} io_button_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void io_uart_event_handler(void *handler_arg, cyhal_uart_event_t event);
+static void io_button_handler(void *handler_arg, cyhal_gpio_event_t event);
+static void io_debounce_handler(void *handler_arg, cyhal_timer_event_t event);
+static void io_post_key(uint8_t key);
+static void io_post_button(io_button_t *button);
+static void io_log_sink(const ipc_log_record_t *record, void *arg);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ipc_shared_t *io_shared = NULL;
+static cyhal_uart_t  io_uart;
+static cyhal_timer_t io_debounce_timer;
+
+static io_button_t io_button[IO_BUTTON_NUM] =
+{
+    { .pin = CYBSP_USER_BTN1, .number = IPC_IO_BUTTON1, .state = IO_BUTTON_IDLE },
+    { .pin = CYBSP_USER_BTN2, .number = IPC_IO_BUTTON2, .state = IO_BUTTON_IDLE },
+};
+
+/* Events lost because CM7_0 did not empty the event ring */
+static volatile uint32_t io_dropped_events = 0u;
+
+static const cyhal_uart_cfg_t io_uart_config =
+{
+    .data_bits      = 8u,
+    .stop_bits      = 1u,
+    .parity         = CYHAL_UART_PARITY_NONE,
+    .rx_buffer      = NULL,
+    .rx_buffer_size = 0u
+};
+
+static const cyhal_timer_cfg_t io_debounce_config =
+{
+    .compare_value = 0u,
+    .period        = (IO_DEBOUNCE_TIMER_FREQ / 1000u * IO_DEBOUNCE_PERIOD_MS) - 1u,
+    .direction     = CYHAL_TIMER_DIR_UP,
+    .is_compare    = false,
+    .is_continuous = true,
+    .value         = 0u
+};
+
+
+/*******************************************************************************
+* Function Name: io_coprocessor_init
+********************************************************************************
+* Summary:
+*  Takes over the debug UART and the user buttons and tells CM7_0 that its
+*  console and button events now come from CM0+.
+*
+* Parameters:
+*  shared: inter-processor shared block published by CM7_0
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or the first HAL error
+*
+*******************************************************************************/
+cy_rslt_t io_coprocessor_init(ipc_shared_t *shared)
+{
+    cy_rslt_t result;
+
+    io_shared = shared;
+
+    result = cyhal_uart_init(&io_uart, CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                             NC, NC, NULL, &io_uart_config);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_uart_set_baud(&io_uart, IO_UART_BAUD_RATE, NULL);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    cyhal_uart_register_callback(&io_uart, io_uart_event_handler, NULL);
+    cyhal_uart_enable_event(&io_uart, CYHAL_UART_IRQ_RX_NOT_EMPTY,
+                            IO_INTERRUPT_PRIORITY, true);
+
+    result = cyhal_timer_init(&io_debounce_timer, NC, NULL);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_timer_configure(&io_debounce_timer, &io_debounce_config);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_timer_set_frequency(&io_debounce_timer, IO_DEBOUNCE_TIMER_FREQ);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    cyhal_timer_register_callback(&io_debounce_timer, io_debounce_handler, NULL);
+    cyhal_timer_enable_event(&io_debounce_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT,
+                             IO_INTERRUPT_PRIORITY, true);
+
+    for (uint32_t index = 0u; index < IO_BUTTON_NUM; index++)
+    {
+        result = cyhal_gpio_init(io_button[index].pin, CYHAL_GPIO_DIR_INPUT,
+                                 CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+        io_button[index].callback_data.callback = io_button_handler;
+        io_button[index].callback_data.callback_arg = &io_button[index];
+        cyhal_gpio_register_callback(io_button[index].pin, &io_button[index].callback_data);
+        cyhal_gpio_enable_event(io_button[index].pin, CYHAL_GPIO_IRQ_FALL,
+                                IO_INTERRUPT_PRIORITY, true);
+    }
+
+    ipc_comm_set_flag(&shared->cm0p_ready, 1u);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: io_coprocessor_poll
+********************************************************************************
+* Summary:
+*  Writes the console output queued by CM7_0 and the log records of all the
+*  cores to the debug UART.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: number of console messages and log records written
+*
+*******************************************************************************/
+uint32_t io_coprocessor_poll(void)
+{
+    ipc_msg_t msg;
+    uint32_t  count = 0u;
+
+    while (ipc_ring_pop(&io_shared->console_to_cm0p, &msg))
+    {
+        if (IPC_IO_CONSOLE_TEXT == msg.opcode)
+        {
+            for (uint32_t index = 0u; index < msg.length; index++)
+            {
+                (void)cyhal_uart_putc(&io_uart, msg.payload[index]);
+            }
+        }
+        count++;
+    }
+
+    count += ipc_logger_drain(io_log_sink, NULL);
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: io_uart_event_handler
+********************************************************************************
+* Summary:
+*  Debug UART interrupt. Forwards every received character to CM7_0.
+*
+* Parameters:
+*  handler_arg: user defined argument (unused)
+*  event: uart interrupt event source
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_uart_event_handler(void *handler_arg, cyhal_uart_event_t event)
+{
+    uint8_t key;
+
+    (void)handler_arg;
+
+    if ((event & CYHAL_UART_IRQ_RX_NOT_EMPTY) == CYHAL_UART_IRQ_RX_NOT_EMPTY)
+    {
+        while (0u != cyhal_uart_readable(&io_uart))
+        {
+            if (CY_RSLT_SUCCESS == cyhal_uart_getc(&io_uart, &key, 0u))
+            {
+                io_post_key(key);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_button_handler
+********************************************************************************
+* Summary:
+*  Button falling edge interrupt. Starts the debounce of an idle button;
+*  bounces of a button already being debounced are ignored.
+*
+* Parameters:
+*  handler_arg: io_button_t of the button
+*  event: gpio interrupt event source (unused)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_button_handler(void *handler_arg, cyhal_gpio_event_t event)
+{
+    io_button_t *button = (io_button_t *)handler_arg;
+
+    (void)event;
+
+    if (IO_BUTTON_IDLE == button->state)
+    {
+        button->state = IO_BUTTON_DEBOUNCE;
+        button->held_ticks = 0u;
+        (void)cyhal_timer_start(&io_debounce_timer);
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_debounce_handler
+********************************************************************************
+* Summary:
+*  Debounce timer interrupt, every IO_DEBOUNCE_PERIOD_MS while a button is
+*  active. A press is confirmed if the button is still down one period after
+*  the edge and is reported with its duration once it is released. The timer
+*  stops when all the buttons are idle.
+*
+* Parameters:
+*  handler_arg: user defined argument (unused)
+*  event: timer interrupt event source (unused)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_debounce_handler(void *handler_arg, cyhal_timer_event_t event)
+{
+    bool active = false;
+
+    (void)handler_arg;
+    (void)event;
+
+    for (uint32_t index = 0u; index < IO_BUTTON_NUM; index++)
+    {
+        io_button_t *button = &io_button[index];
+        bool pressed = (CYBSP_BTN_PRESSED == cyhal_gpio_read(button->pin));
+
+        switch (button->state)
+        {
+            case IO_BUTTON_DEBOUNCE:
+                button->state = pressed ? IO_BUTTON_PRESSED : IO_BUTTON_IDLE;
+                button->held_ticks = 1u;
+                break;
+            case IO_BUTTON_PRESSED:
+                if (pressed)
+                {
+                    button->held_ticks++;
+                }
+                else
+                {
+                    io_post_button(button);
+                    button->state = IO_BUTTON_IDLE;
+                }
+                break;
+            default:
+                break;
+        }
+
+        active = active || (IO_BUTTON_IDLE != button->state);
+    }
+
+    if (!active)
+    {
+        (void)cyhal_timer_stop(&io_debounce_timer);
+        (void)cyhal_timer_reset(&io_debounce_timer);
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_post_key
+********************************************************************************
+* Summary:
+*  Queues a console key for CM7_0 and rings its doorbell.
+*
+* Parameters:
+*  key: received character
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_post_key(uint8_t key)
+{
+    if (ipc_io_post_key(&io_shared->io_to_cm7_0, key))
+    {
+        ipc_comm_ring_doorbell(IPC_CORE_CM7_0);
+    }
+    else
+    {
+        io_dropped_events++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_post_button
+********************************************************************************
+* Summary:
+*  Queues a debounced button press for CM7_0 and rings its doorbell.
+*
+* Parameters:
+*  button: released button
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_post_button(io_button_t *button)
+{
+    uint32_t held_ms = button->held_ticks * IO_DEBOUNCE_PERIOD_MS;
+
+    if (held_ms > UINT16_MAX)
+    {
+        held_ms = UINT16_MAX;
+    }
+
+    if (ipc_io_post_button(&io_shared->io_to_cm7_0, button->number, (uint16_t)held_ms))
+    {
+        ipc_comm_ring_doorbell(IPC_CORE_CM7_0);
+    }
+    else
+    {
+        io_dropped_events++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_log_sink
+********************************************************************************
+* Summary:
+*  Writes a log record to the debug UART.
+*
+* Parameters:
+*  record: log record of any core
+*  arg: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_log_sink(const ipc_log_record_t *record, void *arg)
+{
+    char line[IPC_LOGGER_LINE_SIZE];
+    uint32_t length = ipc_logger_format(record, line, sizeof(line));
+
+    (void)arg;
+
+    for (uint32_t index = 0u; index < length; index++)
+    {
+        (void)cyhal_uart_putc(&io_uart, (uint32_t)line[index]);
+    }
+}
+
+/* [] END OF FILE */
@@ -40,11 +40,23 @@
 * so agrees to indemnify Cypress against all liability.
 *******************************************************************************/
 
+#include <stdio.h>
+#include <string.h>
 #include "cy_pdl.h"
 #include "cyhal.h"
 #include "cybsp.h"
 #include "oob_demo.h"
 #include "print_message.h"
+#include "ipc_offload.h"
+#include "profiler.h"
+#include "bench.h"
+#include "placement.h"
+#include "boot_time.h"
+#include "mem_guard.h"
+#include "resource_manager.h"
+#include "param.h"
+#include "console_ui.h"
+#include "watchdog.h"
 #include "cy_retarget_io.h"
 
 
@@ -52,16 +64,20 @@
 * Macros
 ********************************************************************************/
 
+/* Longest numbered demo line of the start-up message */
+#define STARTUP_LINE_SIZE   (48u)
+
 /*******************************************************************************
 * Function Prototypes
 ********************************************************************************/
 void startup_message(void);
+static void start_ipc_offload(void);
 
 /*******************************************************************************
 * Global Variables
 ********************************************************************************/
-/* Demo switch flag */
-bool evtSwitch = true;
+/* Demo events, the first demo starts at once */
+event_flags_t demo_events = EVENT_FLAGS_INIT(EVT_DEMO_SWITCH);
 /* Demo project index */
 uint8_t demoIndex = 1u;
 /* Hibernate reset status */
@@ -74,8 +90,42 @@ int (*demoProject[DEMONUM])(void) = {
     main_sar_adc,
     main_powermode,
     main_qspi_memory,
-    main_canfd
+    main_canfd,
+    main_ipc_offload,
+    main_param_console
+};
+/* Names of the demo projects, in the order of demoProject */
+static const char *const demoNames[DEMONUM] = {
+    "Hello world",
+    "PWM square-wave output",
+    "GPIO interrupt",
+    "SAR ADC basic",
+    "XMC(TM) MCU power modes",
+    "QSPI memory read/write",
+    "CAN FD loopback",
+    "Dual-core IPC offload",
+    "Parameter console"
+};
+/* Start-up message around the demo names. \x1b[2J\x1b[;H - ANSI ESC
+ * sequence for clear screen */
+static const char *const startup_head[] = {
+    "\x1b[2J\x1b[;H",
+    "******************************************************************\r\n",
+    "**  XMC7000 MCU: Running the out-of-the-box (OOB) demo project  **\r\n",
+    "******************************************************************\r\n",
+    "Enter an option from 1 - 9 to run the selected demo:\r\n",
+    "\r\n",
+    "\r\n"
+};
+static const char *const startup_tail[] = {
+    "For more projects visit our code examples repositories:\r\n\n",
+    "https://github.com/Infineon/Code-Examples-for-ModusToolbox-Software\r\n",
+    "For detailed steps refer to the README document\r\n\n",
+    "\r\n",
+    "\r\n"
 };
+/* IPC offload started, it is deferred on a fast boot */
+static bool ipc_offload_started = false;
 
 
 /*******************************************************************************
@@ -93,6 +143,10 @@ int (*demoProject[DEMONUM])(void) = {
 *******************************************************************************/
 void handle_error(void)
 {
+    /* Stop the watchdog kicks, so that it resets the device and the next
+     * boot reports the caller */
+    watchdog_fault((uint32_t)(uintptr_t)__builtin_return_address(0));
+
     /* Disable all interrupts. */
     __disable_irq();
     while(1)
@@ -104,7 +158,8 @@ void handle_error(void)
 * Function Name: startup_message
 ********************************************************************************
 * Summary:
-* prints demo options message on the UART debug port
+* prints demo options message on the UART debug port, or draws the menu of
+* the terminal layout with the console_ui parameter
 *
 * Parameters:
 *  none
@@ -115,26 +170,67 @@ void handle_error(void)
 *******************************************************************************/
 void startup_message(void)
 {
-    /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen */
-    printf("\x1b[2J\x1b[;H");
-    printf("******************************************************************\r\n");
-    printf("**  XMC7000 MCU: Running the out-of-the-box (OOB) demo project  **\r\n");
-    printf("******************************************************************\r\n");
-    printf("Enter an option from 1 - 7 to run the selected demo:\r\n");
-    printf("\r\n");
-    printf("\r\n");
-    printf("1. Hello world\r\n");
-    printf("2. PWM square-wave output\r\n");
-    printf("3. GPIO interrupt\r\n");
-    printf("4. SAR ADC basic\r\n");
-    printf("5. XMC(TM) MCU power modes\r\n");
-    printf("6. QSPI memory read/write\r\n");
-    printf("7. CAN FD loopback\r\n");
-    printf("For more projects visit our code examples repositories:\r\n\n");
-    printf("https://github.com/Infineon/Code-Examples-for-ModusToolbox-Software\r\n");
-    printf("For detailed steps refer to the README document\r\n\n");
-    printf("\r\n");
-    printf("\r\n");
+    char line[STARTUP_LINE_SIZE];
+    uint32_t length = 0u;
+
+    /* Size of the line-based message, which the terminal layout replaces */
+    for (uint32_t index = 0u; index < (sizeof(startup_head) / sizeof(startup_head[0])); index++)
+    {
+        length += (uint32_t)strlen(startup_head[index]);
+    }
+    for (uint32_t index = 0u; index < (uint32_t)DEMONUM; index++)
+    {
+        length += (uint32_t)snprintf(line, sizeof(line), "%lu. %s\r\n", (unsigned long)(index + 1u),
+                                     demoNames[index]);
+    }
+    for (uint32_t index = 0u; index < (sizeof(startup_tail) / sizeof(startup_tail[0])); index++)
+    {
+        length += (uint32_t)strlen(startup_tail[index]);
+    }
+    if (console_ui_menu(demoNames, DEMONUM, demoIndex, length))
+    {
+        return;
+    }
+
+    for (uint32_t index = 0u; index < (sizeof(startup_head) / sizeof(startup_head[0])); index++)
+    {
+        printf("%s", startup_head[index]);
+    }
+    for (uint32_t index = 0u; index < (uint32_t)DEMONUM; index++)
+    {
+        printf("%lu. %s\r\n", (unsigned long)(index + 1u), demoNames[index]);
+    }
+    for (uint32_t index = 0u; index < (sizeof(startup_tail) / sizeof(startup_tail[0])); index++)
+    {
+        printf("%s", startup_tail[index]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: start_ipc_offload
+********************************************************************************
+* Summary:
+* Publishes the shared memory of the inter-processor communication to CM7_1
+* and starts the cross-core logger, once.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void start_ipc_offload(void)
+{
+    if (!ipc_offload_started)
+    {
+        ipc_offload_started = true;
+        if (CY_RSLT_SUCCESS != ipc_offload_init())
+        {
+            printf("IPC shared memory initialization failed.\r\n");
+        }
+        boot_time_mark(BOOT_PHASE_CM7_0_IPC);
+    }
 }
 
 /*******************************************************************************
@@ -143,9 +239,9 @@ void startup_message(void)
 * Summary:
 * The main function performs the following actions:
 *  1. Initial UART component.
-*  2. Show 7 demos navigation interfaces on the UART serial terminal.
+*  2. Show 9 demos navigation interfaces on the UART serial terminal.
 *  3. Enter the "Hello world" demo (default demo) automatically
-*  4. You can enter 1~7 key for change the demos
+*  4. You can enter 1~9 key for change the demos
 *
 *  Please note that resources used for some of the demos are different for different BSPs For eg, demo_helloworld make use of 3 LEDs in case of KIT_XMC72 whereas it uses only 2 LEDs in case of KIT_XMC71.
 *  This is due to hardware limitations and not a device limitation.
@@ -162,6 +258,17 @@ void startup_message(void)
 int main(void)
 {
     cy_rslt_t result;
+    bool fast_boot;
+
+    /* Paint the unused stack before anything runs on it */
+    mem_guard_stack_paint();
+
+    /* Take the first CM7_0 mark on the boot timebase started by CM0+ */
+    boot_time_attach();
+
+    /* Load the TCM sections and map the non-cacheable section, before any
+     * placed handler or buffer is used */
+    placement_init();
 
     /* Initialize the device and board peripherals */
     result = cybsp_init() ;
@@ -169,36 +276,82 @@ int main(void)
     {
         CY_ASSERT(0);
     }
+    (void)boot_time_reserve();
+    boot_time_mark(BOOT_PHASE_CM7_0_BSP);
 
     /* Enable global interrupts */
     __enable_irq();
 
+    /* Start the cycle counter of the profiler and the benchmarks */
+    profiler_init();
+
+    /* Restore the demo parameters saved in the work flash, among them the
+     * console baud rate */
+    (void)param_load();
+    boot_time_mark(BOOT_PHASE_CM7_0_PARAMS);
+
     /* Initialize UART port */
     uart_port_initial();
+    boot_time_mark(BOOT_PHASE_CM7_0_CONSOLE);
 
-    /* Check the reset reason */
-    if(CY_SYSLIB_RESET_HIB_WAKEUP == (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HIB_WAKEUP))
+    /* A wake-up from Hibernate is a fast boot: it goes straight back to the
+     * power modes demo without the banner, and the IPC offload waits for the
+     * next demo switch. The I/O co-processor carries the console, so it is
+     * never deferred. */
+    fast_boot = (CY_SYSLIB_RESET_HIB_WAKEUP == (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HIB_WAKEUP));
+    if (!fast_boot || IO_COPROCESSOR || BENCH)
+    {
+        start_ipc_offload();
+    }
+
+#if BENCH
+    /* Benchmark build: run the suite once instead of the demos */
+    return bench_run();
+#else
+    if(fast_boot)
     {
         /*If system reset from Hibernate status, it will return back to power modes demo */
         demoIndex = 5u;
         Hibresetstatus = true;
     }
 
-
+    /* Supervise the demos, and keep the record of the last watchdog reset
+     * for the start-up message */
+    if (CY_RSLT_SUCCESS != watchdog_init())
+    {
+        printf("Watchdog initialization failed.\r\n");
+    }
 
     for (;;)
     {
-        if(evtSwitch)
+        if(0u != event_flags_take(&demo_events, EVT_DEMO_SWITCH))
         {
-            evtSwitch = false;
-            startup_message();
+            if (fast_boot)
+            {
+                /* The power modes demo reports the wake-up itself */
+                fast_boot = false;
+            }
+            else
+            {
+                start_ipc_offload();
+                startup_message();
+                watchdog_print_reset();
+            }
+            resource_manager_switch_report();
+            /* Print the logs posted while the previous demo ended */
+            event_flags_idle();
+            boot_time_mark(BOOT_PHASE_CM7_0_DEMO);
+            /* The set-up of the demo is the first pass of its loop */
+            watchdog_checkin(WATCHDOG_TASK_DEMO);
             (*demoProject[demoIndex-1])();
+            watchdog_end(WATCHDOG_TASK_DEMO);
         }
         else
         {
             /* Will not run here */
         }
     }
+#endif /* BENCH */
 }
 
 /* [] END OF FILE */
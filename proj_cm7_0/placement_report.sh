@@ -0,0 +1,90 @@
+#!/bin/sh
+################################################################################
+# \file placement_report.sh
+# \version 1.0
+#
+# \brief
+# Post-build report of the CM7_0 memory placement: prints the size of the
+# placement sections and the memory each hot symbol was linked to, and the
+# code size of the console formatter against the formatted output of newlib.
+#
+# Usage: placement_report.sh <elf file> <nm tool>
+#
+################################################################################
+# \copyright
+# Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+# 
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# 
+#     http://www.apache.org/licenses/LICENSE-2.0
+# 
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+ELF=$1
+NM=${2:-arm-none-eabi-nm}
+
+# Interrupt handlers, callbacks and buffers on the hot paths
+HOT_SYMBOLS="uart_event_handler isr_timer gpio1_interrupt_handler gpio2_interrupt_handler \
+isr_canfd canfd_rx_callback latency_gpio_pdl_isr latency_timer_pdl_isr bench_gpio_handler \
+canfd_data_buffer tx_buf bench_dma_nocache bench_dma_cached"
+
+# Formatted output of newlib and newlib-nano, floating point included
+LIBC_FORMAT_SYMBOLS="_vfprintf_r _svfprintf_r _vfiprintf_r _svfiprintf_r _printf_i _printf_common \
+_printf_float _dtoa_r __sprint_r __ssprint_r __sfvwrite_r __ssputs_r __sfputs_r _sprintf_r _snprintf_r \
+_vsnprintf_r printf snprintf sprintf"
+
+"$NM" -S "$ELF" | awk -v hot="$HOT_SYMBOLS" -v libc="$LIBC_FORMAT_SYMBOLS" '
+function hex(text,    value, i)
+{
+    value = 0
+    for (i = 1; i <= length(text); i++)
+    {
+        value = value * 16 + index("0123456789abcdef", tolower(substr(text, i, 1))) - 1
+    }
+    return value
+}
+function region(a)
+{
+    if (a < hex("00004000")) return "ITCM"
+    if (a >= hex("20000000") && a < hex("20004000")) return "DTCM"
+    if (a >= hex("10000000") && a < hex("18000000")) return "flash"
+    if (a >= nocache_start && a < nocache_end) return "SRAM non-cacheable"
+    if (a >= hex("28000000") && a < hex("29000000")) return "SRAM"
+    return "other"
+}
+BEGIN {
+    n = split(hot, names, " "); for (i = 1; i <= n; i++) want[names[i]] = 1
+    m = split(libc, libc_names, " "); for (i = 1; i <= m; i++) libc_format[libc_names[i]] = 1
+}
+{
+    sym = $NF
+    addr[sym] = hex($1)
+    size[sym] = (NF == 4) ? hex($2) : 0
+    if ((NF == 4) && (sym ~ /^console_fmt_/)) fmt_size += size[sym]
+    if ((NF == 4) && (sym in libc_format)) libc_size += size[sym]
+}
+END {
+    nocache_start = addr["__cm7_nocache_start__"]
+    nocache_end = addr["__cm7_nocache_end__"]
+    printf "CM7_0 placement: ITCM %d B, DTCM %d B, non-cacheable %d B\n",
+           addr["__cm7_itcm_end__"] - addr["__cm7_itcm_start__"],
+           addr["__cm7_dtcm_end__"] - addr["__cm7_dtcm_start__"],
+           nocache_end - nocache_start
+    for (i = 1; i <= n; i++)
+    {
+        sym = names[i]
+        if (sym in addr)
+        {
+            printf "  %-28s 0x%08x %6d B  %s\n", sym, addr[sym], size[sym], region(addr[sym])
+        }
+    }
+    printf "Console formatter %d B, newlib formatted output %d B\n", fmt_size, libc_size
+}'
@@ -0,0 +1,531 @@
+/******************************************************************************
+* File Name:   adc_pwm_sync.c
+*
+* Description: SAR ADC conversions synchronized to a PWM. The counter runs in
+*              PWM mode with compare 0 for the duty cycle and compare 1 for
+*              the trigger phase. In hardware trigger mode its TR_OUT1 line
+*              pulses on the compare 1 match and starts the scan group of the
+*              SAR through the trigger multiplexer; in software trigger mode
+*              the CC1 interrupt handler starts it, for comparison.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "adc_pwm_sync.h"
+#include "placement.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Same priority as the ADC and GPIO demos */
+#define ADC_PWM_SYNC_INTR_PRIORITY  (7u)
+
+/* CPU interrupt of the group done and CC1 handlers, not used by the HAL */
+#define ADC_PWM_SYNC_CPU_IRQ        (NvicMux3_IRQn)
+
+/* SAR clock and sample time of each channel, in SAR clocks */
+#define ADC_PWM_SYNC_SAR_CLOCK_HZ   (20000000u)
+#define ADC_PWM_SYNC_SAMPLE_TIME    (32u)
+
+/* Trigger multiplexer output to PASS generic trigger input 0, and the generic
+ * trigger of the SAR it drives */
+#define ADC_PWM_SYNC_TRIG_OUT       (TRIG_OUT_MUX_6_PASS_GEN_TR_I0)
+#define ADC_PWM_SYNC_PASS_INPUT     (0u)
+#define ADC_PWM_SYNC_GENERIC        (0u)
+
+/* Resources held between adc_pwm_sync_init() and adc_pwm_sync_free() */
+#define ADC_PWM_SYNC_HELD_SAR       (1u << 0)
+#define ADC_PWM_SYNC_HELD_PWM       (1u << 1)
+#define ADC_PWM_SYNC_HELD_SAR_CLOCK (1u << 2)
+#define ADC_PWM_SYNC_HELD_PWM_CLOCK (1u << 3)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static cy_rslt_t adc_pwm_sync_clock(cyhal_clock_t *clock, uint32_t hz);
+static void adc_pwm_sync_release(void);
+static void adc_pwm_sync_sar_isr(void);
+static void adc_pwm_sync_pwm_isr(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const cyhal_resource_inst_t adc_pwm_sync_sar_rsc = { CYHAL_RSC_ADC, ADC_PWM_SYNC_SAR_INDEX, 0u };
+static cyhal_resource_inst_t adc_pwm_sync_pwm_rsc;
+
+static uint32_t adc_pwm_sync_held = 0u;
+static cyhal_clock_t adc_pwm_sync_sar_clock;
+static cyhal_clock_t adc_pwm_sync_pwm_clock;
+static cy_stc_sar2_channel_config_t adc_pwm_sync_channel_cfg[ADC_PWM_SYNC_CHANNELS];
+
+/* PWM counter and group, read by the handlers */
+static TCPWM_Type *adc_pwm_sync_base = NULL;
+static uint32_t adc_pwm_sync_num = 0u;
+static uint32_t adc_pwm_sync_count = 0u;
+static pwm_phase_t adc_pwm_sync_timing;
+
+static volatile adc_pwm_sync_stats_t adc_pwm_sync_stats;
+
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_init
+********************************************************************************
+* Summary:
+*  Starts a PWM on a TCPWM counter and converts the scan group once per PWM
+*  period, at the trigger phase. The counter clock is ADC_PWM_SYNC_CLOCK_HZ,
+*  so the period and the phase are rounded to 10 ns. The PWM line is not
+*  connected to a pin. The potentiometer pin is set to analog; pins of other
+*  inputs must be set up by the caller.
+*
+* Parameters:
+*  pwm: TCPWM counter to run as the PWM, ADC_PWM_SYNC_PWM_DEFAULT for the
+*       counter routed to the SAR on the kit
+*  config: PWM frequency and duty cycle, trigger phase and mode, scan group
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, ADC_PWM_SYNC_RSLT_ERR_PARAM or the error of a
+*  reservation or of a clock
+*
+*******************************************************************************/
+cy_rslt_t adc_pwm_sync_init(const adc_pwm_sync_pwm_t *pwm, const adc_pwm_sync_config_t *config)
+{
+    const bool hw = (ADC_PWM_SYNC_TRIGGER_HW == config->trigger);
+    cy_stc_sar2_config_t sar_cfg;
+    cy_stc_tcpwm_pwm_config_t pwm_cfg;
+    cy_rslt_t result;
+
+    if ((0u != adc_pwm_sync_count) || (0u == config->count) || (config->count > ADC_PWM_SYNC_CHANNELS) ||
+        (0u == config->frequency_hz) || (config->frequency_hz > ADC_PWM_SYNC_MAX_HZ) ||
+        (config->duty_permille > 1000u) || (config->phase >= PWM_PHASE_FULL))
+    {
+        return ADC_PWM_SYNC_RSLT_ERR_PARAM;
+    }
+
+    /* Refused while the HAL driver or the window alarms hold the SAR */
+    adc_pwm_sync_pwm_rsc.type = CYHAL_RSC_TCPWM;
+    adc_pwm_sync_pwm_rsc.block_num = (uint8_t)pwm->group;
+    adc_pwm_sync_pwm_rsc.channel_num = (uint8_t)pwm->cnt;
+    result = cyhal_hwmgr_reserve(&adc_pwm_sync_sar_rsc);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        adc_pwm_sync_held |= ADC_PWM_SYNC_HELD_SAR;
+        result = cyhal_hwmgr_reserve(&adc_pwm_sync_pwm_rsc);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        adc_pwm_sync_held |= ADC_PWM_SYNC_HELD_PWM;
+        result = adc_pwm_sync_clock(&adc_pwm_sync_sar_clock, ADC_PWM_SYNC_SAR_CLOCK_HZ);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        adc_pwm_sync_held |= ADC_PWM_SYNC_HELD_SAR_CLOCK;
+        result = adc_pwm_sync_clock(&adc_pwm_sync_pwm_clock, ADC_PWM_SYNC_CLOCK_HZ);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        adc_pwm_sync_held |= ADC_PWM_SYNC_HELD_PWM_CLOCK;
+        if (!pwm_phase_init(&adc_pwm_sync_timing, cyhal_clock_get_frequency(&adc_pwm_sync_pwm_clock),
+                            config->frequency_hz, config->phase))
+        {
+            result = ADC_PWM_SYNC_RSLT_ERR_PARAM;
+        }
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        adc_pwm_sync_release();
+        return result;
+    }
+    (void)Cy_SysClk_PeriPclkAssignDivider(ADC_PWM_SYNC_SAR_PCLK, CY_SYSCLK_DIV_16_BIT,
+                                          adc_pwm_sync_sar_clock.channel);
+    (void)Cy_SysClk_PeriPclkAssignDivider(pwm->pclk, CY_SYSCLK_DIV_16_BIT, adc_pwm_sync_pwm_clock.channel);
+    Cy_GPIO_Pin_FastInit(CYHAL_GET_PORTADDR(CYBSP_POT), CYHAL_GET_PIN(CYBSP_POT), CY_GPIO_DM_ANALOG, 0u,
+                         HSIOM_SEL_GPIO);
+
+    memset(&sar_cfg, 0, sizeof(sar_cfg));
+    sar_cfg.msbStretchMode = CY_SAR2_MSB_STRETCH_MODE_1CYCLE;
+    sar_cfg.sarMuxEnable   = true;
+    sar_cfg.adcEnable      = true;
+    sar_cfg.sarIpEnable    = true;
+    for (uint32_t channel = 0u; channel < config->count; channel++)
+    {
+        cy_stc_sar2_channel_config_t *cfg = &adc_pwm_sync_channel_cfg[channel];
+        bool last = ((config->count - 1u) == channel);
+
+        /* Channel 0 waits for the trigger, the others follow it in the group */
+        memset(cfg, 0, sizeof(*cfg));
+        cfg->channelHwEnable        = true;
+        cfg->triggerSelection       = ((0u == channel) && hw) ? CY_SAR2_TRIGGER_GENERIC0 : CY_SAR2_TRIGGER_OFF;
+        cfg->preenptionType         = CY_SAR2_PREEMPTION_FINISH_RESUME;
+        cfg->isGroupEnd             = last;
+        cfg->doneLevel              = CY_SAR2_DONE_LEVEL_PULSE;
+        cfg->pinAddress             = config->inputs[channel];
+        cfg->portAddress            = CY_SAR2_PORT_ADDRESS_SARMUX0;
+        cfg->preconditionMode       = CY_SAR2_PRECONDITION_MODE_OFF;
+        cfg->overlapDiagMode        = CY_SAR2_OVERLAP_DIAG_MODE_OFF;
+        cfg->sampleTime             = ADC_PWM_SYNC_SAMPLE_TIME;
+        cfg->calibrationValueSelect = CY_SAR2_CALIBRATION_VALUE_REGULAR;
+        cfg->postProcessingMode     = CY_SAR2_POST_PROCESSING_MODE_NONE;
+        cfg->resultAlignment        = CY_SAR2_RESULT_ALIGNMENT_RIGHT;
+        cfg->signExtention          = CY_SAR2_SIGN_EXTENTION_UNSIGNED;
+        /* No sample is below 0: the range detection stays quiet */
+        cfg->rangeDetectionMode     = CY_SAR2_RANGE_DETECTION_MODE_BELOW_LO;
+        cfg->interruptMask          = last ? CY_SAR2_INT_GRP_DONE : 0u;
+        sar_cfg.channelConfig[channel] = cfg;
+    }
+
+    memset(&pwm_cfg, 0, sizeof(pwm_cfg));
+    pwm_cfg.pwmMode          = CY_TCPWM_PWM_MODE_PWM;
+    pwm_cfg.clockPrescaler   = CY_TCPWM_PWM_PRESCALER_DIVBY_1;
+    pwm_cfg.pwmAlignment     = CY_TCPWM_PWM_LEFT_ALIGN;
+    pwm_cfg.runMode          = CY_TCPWM_PWM_CONTINUOUS;
+    pwm_cfg.period0          = adc_pwm_sync_timing.period;
+    pwm_cfg.compare0         = (uint32_t)(((((uint64_t)adc_pwm_sync_timing.period + 1u) * config->duty_permille) +
+                                           500u) / 1000u);
+    pwm_cfg.compare1         = adc_pwm_sync_timing.compare;
+    pwm_cfg.interruptSources = hw ? CY_TCPWM_INT_NONE : CY_TCPWM_INT_ON_CC1;
+    pwm_cfg.invertPWMOut     = CY_TCPWM_PWM_INVERT_DISABLE;
+    pwm_cfg.invertPWMOutN    = CY_TCPWM_PWM_INVERT_DISABLE;
+    pwm_cfg.killMode         = CY_TCPWM_PWM_STOP_ON_KILL;
+    pwm_cfg.swapInputMode    = CY_TCPWM_INPUT_LEVEL;
+    pwm_cfg.swapInput        = CY_TCPWM_INPUT_0;
+    pwm_cfg.reloadInputMode  = CY_TCPWM_INPUT_LEVEL;
+    pwm_cfg.reloadInput      = CY_TCPWM_INPUT_0;
+    pwm_cfg.startInputMode   = CY_TCPWM_INPUT_LEVEL;
+    pwm_cfg.startInput       = CY_TCPWM_INPUT_0;
+    pwm_cfg.killInputMode    = CY_TCPWM_INPUT_LEVEL;
+    pwm_cfg.killInput        = CY_TCPWM_INPUT_0;
+    pwm_cfg.countInputMode   = CY_TCPWM_INPUT_LEVEL;
+    pwm_cfg.countInput       = CY_TCPWM_INPUT_1;
+    pwm_cfg.trigger0Event    = CY_TCPWM_CNT_TRIGGER_ON_DISABLED;
+    pwm_cfg.trigger1Event    = hw ? CY_TCPWM_CNT_TRIGGER_ON_CC1_MATCH : CY_TCPWM_CNT_TRIGGER_ON_DISABLED;
+
+    adc_pwm_sync_base = pwm->base;
+    adc_pwm_sync_num = (pwm->group << 8) | pwm->cnt;
+    adc_pwm_sync_count = config->count;
+    adc_pwm_sync_get_stats(NULL, true);
+
+    Cy_SAR2_SetReferenceBufferMode(PASS0_EPASS_MMIO, CY_SAR2_REF_BUF_MODE_ON);
+    (void)Cy_SAR2_Init(ADC_PWM_SYNC_SAR, &sar_cfg);
+    if (hw)
+    {
+        Cy_SAR2_SetGenericTriggerInput(PASS0_EPASS_MMIO, ADC_PWM_SYNC_SAR_INDEX, ADC_PWM_SYNC_GENERIC,
+                                       ADC_PWM_SYNC_PASS_INPUT);
+        (void)Cy_TrigMux_Connect(pwm->trig_line, ADC_PWM_SYNC_TRIG_OUT, false, TRIGGER_TYPE_EDGE);
+    }
+    (void)Cy_TCPWM_PWM_Init(adc_pwm_sync_base, adc_pwm_sync_num, &pwm_cfg);
+
+    {
+        const cy_stc_sysint_t sar_intr_cfg =
+        {
+            .intrSrc      = ((uint32_t)ADC_PWM_SYNC_CPU_IRQ << 16) | (ADC_PWM_SYNC_SAR_IRQ + config->count - 1u),
+            .intrPriority = ADC_PWM_SYNC_INTR_PRIORITY,
+        };
+        const cy_stc_sysint_t pwm_intr_cfg =
+        {
+            .intrSrc      = ((uint32_t)ADC_PWM_SYNC_CPU_IRQ << 16) |
+                            ((0u == pwm->group) ? ((uint32_t)tcpwm_0_interrupts_0_IRQn + pwm->cnt)
+                                                : ((uint32_t)tcpwm_0_interrupts_256_IRQn + pwm->cnt)),
+            .intrPriority = ADC_PWM_SYNC_INTR_PRIORITY,
+        };
+
+        (void)Cy_SysInt_Init(&sar_intr_cfg, adc_pwm_sync_sar_isr);
+        if (!hw)
+        {
+            (void)Cy_SysInt_Init(&pwm_intr_cfg, adc_pwm_sync_pwm_isr);
+        }
+    }
+    NVIC_EnableIRQ(ADC_PWM_SYNC_CPU_IRQ);
+
+    Cy_SAR2_Enable(ADC_PWM_SYNC_SAR);
+    Cy_TCPWM_PWM_Enable(adc_pwm_sync_base, adc_pwm_sync_num);
+    Cy_TCPWM_TriggerStart_Single(adc_pwm_sync_base, adc_pwm_sync_num);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_free
+********************************************************************************
+* Summary:
+*  Stops the PWM and the conversions and releases the counter, the SAR and
+*  their clocks. The trigger multiplexer output stays connected; its input is
+*  idle while the counter is disabled.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_pwm_sync_free(void)
+{
+    if (0u == adc_pwm_sync_count)
+    {
+        return;
+    }
+
+    NVIC_DisableIRQ(ADC_PWM_SYNC_CPU_IRQ);
+    Cy_TCPWM_PWM_Disable(adc_pwm_sync_base, adc_pwm_sync_num);
+    Cy_SAR2_Disable(ADC_PWM_SYNC_SAR);
+    Cy_SAR2_DeInit(ADC_PWM_SYNC_SAR);
+    adc_pwm_sync_release();
+    adc_pwm_sync_count = 0u;
+}
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_set_phase
+********************************************************************************
+* Summary:
+*  Moves the trigger while the PWM runs, and restarts the statistics, whose
+*  delays are counted from the trigger. The period at which the new compare
+*  value is written may see no trigger or two.
+*
+* Parameters:
+*  phase: trigger phase, 1/PWM_PHASE_FULL of the period
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or ADC_PWM_SYNC_RSLT_ERR_PARAM
+*
+*******************************************************************************/
+cy_rslt_t adc_pwm_sync_set_phase(uint32_t phase)
+{
+    uint32_t compare;
+    uint32_t saved;
+
+    if ((0u == adc_pwm_sync_count) || (phase >= PWM_PHASE_FULL))
+    {
+        return ADC_PWM_SYNC_RSLT_ERR_PARAM;
+    }
+
+    compare = pwm_phase_compare(adc_pwm_sync_timing.period, phase);
+    saved = Cy_SysLib_EnterCriticalSection();
+    Cy_TCPWM_PWM_SetCompare1Val(adc_pwm_sync_base, adc_pwm_sync_num, compare);
+    adc_pwm_sync_timing.compare = compare;
+    adc_pwm_sync_get_stats(NULL, true);
+    Cy_SysLib_ExitCriticalSection(saved);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_get_timing
+********************************************************************************
+* Summary:
+*  Copies the clock, period and compare registers of the running PWM, for the
+*  phase and frequency it achieves.
+*
+* Parameters:
+*  timing: receives the registers
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_pwm_sync_get_timing(pwm_phase_t *timing)
+{
+    *timing = adc_pwm_sync_timing;
+}
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics of the groups converted since the last reset. The
+*  spread between the shortest and the longest delay bounds the jitter of the
+*  conversions against the PWM, plus the entry jitter of the handler.
+*
+* Parameters:
+*  stats: receives the statistics, NULL to only reset them
+*  reset: restart the statistics
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_pwm_sync_get_stats(adc_pwm_sync_stats_t *stats, bool reset)
+{
+    uint32_t saved = Cy_SysLib_EnterCriticalSection();
+
+    if (NULL != stats)
+    {
+        *stats = adc_pwm_sync_stats;
+    }
+    if (reset)
+    {
+        adc_pwm_sync_stats.groups = 0u;
+        adc_pwm_sync_stats.delay_min = 0xFFFFFFFFu;
+        adc_pwm_sync_stats.delay_max = 0u;
+        adc_pwm_sync_stats.delay_total = 0u;
+    }
+    Cy_SysLib_ExitCriticalSection(saved);
+}
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_clock
+********************************************************************************
+* Summary:
+*  Allocates and starts a 16-bit peripheral clock divider.
+*
+* Parameters:
+*  clock: receives the divider
+*  hz: frequency
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or the error of the clock, with the divider
+*  freed
+*
+*******************************************************************************/
+static cy_rslt_t adc_pwm_sync_clock(cyhal_clock_t *clock, uint32_t hz)
+{
+    cy_rslt_t result = cyhal_clock_allocate(clock, CYHAL_CLOCK_BLOCK_PERIPHERAL1_16BIT);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_clock_set_frequency(clock, hz, NULL);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = cyhal_clock_set_enabled(clock, true, true);
+        }
+        if (CY_RSLT_SUCCESS != result)
+        {
+            cyhal_clock_free(clock);
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_release
+********************************************************************************
+* Summary:
+*  Frees the reservations and clocks held, after a failed init or at the free.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void adc_pwm_sync_release(void)
+{
+    if (0u != (adc_pwm_sync_held & ADC_PWM_SYNC_HELD_PWM_CLOCK))
+    {
+        cyhal_clock_free(&adc_pwm_sync_pwm_clock);
+    }
+    if (0u != (adc_pwm_sync_held & ADC_PWM_SYNC_HELD_SAR_CLOCK))
+    {
+        cyhal_clock_free(&adc_pwm_sync_sar_clock);
+    }
+    if (0u != (adc_pwm_sync_held & ADC_PWM_SYNC_HELD_PWM))
+    {
+        cyhal_hwmgr_free(&adc_pwm_sync_pwm_rsc);
+    }
+    if (0u != (adc_pwm_sync_held & ADC_PWM_SYNC_HELD_SAR))
+    {
+        cyhal_hwmgr_free(&adc_pwm_sync_sar_rsc);
+    }
+    adc_pwm_sync_held = 0u;
+}
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_sar_isr
+********************************************************************************
+* Summary:
+*  Group done interrupt of the last channel: stores the results and the
+*  delay from the trigger to the handler, read from the PWM counter first.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void adc_pwm_sync_sar_isr(void)
+{
+    uint32_t counter = Cy_TCPWM_PWM_GetCounter(adc_pwm_sync_base, adc_pwm_sync_num);
+    uint32_t last = adc_pwm_sync_count - 1u;
+    uint32_t delay;
+
+    if (0u == (Cy_SAR2_Channel_GetInterruptStatusMasked(ADC_PWM_SYNC_SAR, last) & CY_SAR2_INT_GRP_DONE))
+    {
+        return;
+    }
+    Cy_SAR2_Channel_ClearInterrupt(ADC_PWM_SYNC_SAR, last, CY_SAR2_INT_GRP_DONE);
+
+    for (uint32_t channel = 0u; channel <= last; channel++)
+    {
+        adc_pwm_sync_stats.results[channel] = Cy_SAR2_Channel_GetResult(ADC_PWM_SYNC_SAR, channel, NULL);
+    }
+
+    delay = pwm_phase_delay(&adc_pwm_sync_timing, counter);
+    adc_pwm_sync_stats.groups++;
+    adc_pwm_sync_stats.delay_total += delay;
+    if (delay < adc_pwm_sync_stats.delay_min)
+    {
+        adc_pwm_sync_stats.delay_min = delay;
+    }
+    if (delay > adc_pwm_sync_stats.delay_max)
+    {
+        adc_pwm_sync_stats.delay_max = delay;
+    }
+}
+
+/*******************************************************************************
+* Function Name: adc_pwm_sync_pwm_isr
+********************************************************************************
+* Summary:
+*  CC1 interrupt of the software trigger mode: starts the scan group at the
+*  trigger point, with the entry latency of the handler added to the delay.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void adc_pwm_sync_pwm_isr(void)
+{
+    Cy_TCPWM_ClearInterrupt(adc_pwm_sync_base, adc_pwm_sync_num, CY_TCPWM_INT_ON_CC1);
+    Cy_SAR2_Channel_SoftwareTrigger(ADC_PWM_SYNC_SAR, 0u);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,138 @@
+/******************************************************************************
+* File Name:   adc_pwm_sync.h
+*
+* Description: SAR ADC conversions synchronized to a PWM. A TCPWM counter in
+*              PWM mode pulses its TR_OUT1 line when it reaches compare 1,
+*              and the trigger multiplexer routes the pulse to a generic
+*              trigger of the SAR, which converts its scan group at the same
+*              phase of every PWM period without the CPU. The group done
+*              interrupt collects the results and the delay from the trigger.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _ADC_PWM_SYNC_H_
+#define _ADC_PWM_SYNC_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "pwm_phase.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* SAR converting the scan group, the SAR of the potentiometer */
+#define ADC_PWM_SYNC_SAR            (PASS0_SAR1)
+#define ADC_PWM_SYNC_SAR_INDEX      (1u)
+#define ADC_PWM_SYNC_SAR_IRQ        ((uint32_t)pass_0_interrupts_sar_32_IRQn)
+#define ADC_PWM_SYNC_SAR_PCLK       (PCLK_PASS0_CLOCK_SAR1)
+#define ADC_PWM_SYNC_POT_INPUT      (CY_SAR2_PIN_ADDRESS_AN0)
+
+/* Channels of the scan group */
+#define ADC_PWM_SYNC_CHANNELS       (4u)
+
+/* PWM counter of the demo: a 32-bit counter of TCPWM group 1 next to the
+ * boot timebase. Its TR_OUT1 line goes through trigger group 6 to the PASS
+ * generic trigger input 0, which drives generic trigger 0 of the SAR. */
+#define ADC_PWM_SYNC_PWM_DEFAULT                        \
+{                                                       \
+    .base       = TCPWM0,                               \
+    .group      = 1u,                                   \
+    .cnt        = 2u,                                   \
+    .pclk       = PCLK_TCPWM0_CLOCKS258,                \
+    .trig_line  = TRIG_IN_MUX_6_TCPWM_0_TR_OUT1258,     \
+}
+
+/* Clock of the PWM counter: the phase resolution is one period of it */
+#define ADC_PWM_SYNC_CLOCK_HZ       (100000000u)
+
+/* Highest PWM frequency: the handler runs once per period */
+#define ADC_PWM_SYNC_MAX_HZ         (100000u)
+
+/* A frequency, a phase, a duty cycle or a group size is out of range, or the
+ * conversions are already running */
+#define ADC_PWM_SYNC_RSLT_ERR_PARAM (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x18u))
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    ADC_PWM_SYNC_TRIGGER_HW = 0u,   /* TR_OUT1 through the trigger multiplexer */
+    ADC_PWM_SYNC_TRIGGER_SW,        /* CC1 interrupt, the handler starts the group */
+} adc_pwm_sync_trigger_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* TCPWM counter run as the PWM */
+typedef struct
+{
+    TCPWM_Type   *base;
+    uint32_t      group;
+    uint32_t      cnt;              /* Counter in the group */
+    en_clk_dst_t  pclk;             /* Peripheral clock of the counter */
+    uint32_t      trig_line;        /* Trigger multiplexer input of its TR_OUT1 */
+} adc_pwm_sync_pwm_t;
+
+typedef struct
+{
+    uint32_t               frequency_hz;
+    uint16_t               duty_permille;   /* PWM line high from the period start */
+    uint32_t               phase;           /* Trigger phase, 1/PWM_PHASE_FULL of the period */
+    adc_pwm_sync_trigger_t trigger;
+    const cy_en_sar2_pin_address_t *inputs; /* Scan group, converted in order */
+    uint32_t               count;
+} adc_pwm_sync_config_t;
+
+typedef struct
+{
+    uint32_t groups;                /* Scan groups converted */
+    uint32_t delay_min;             /* PWM counts from the trigger to the handler */
+    uint32_t delay_max;
+    uint64_t delay_total;
+    uint16_t results[ADC_PWM_SYNC_CHANNELS];    /* Last group, ADC counts */
+} adc_pwm_sync_stats_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t adc_pwm_sync_init(const adc_pwm_sync_pwm_t *pwm, const adc_pwm_sync_config_t *config);
+extern void adc_pwm_sync_free(void);
+extern cy_rslt_t adc_pwm_sync_set_phase(uint32_t phase);
+extern void adc_pwm_sync_get_timing(pwm_phase_t *timing);
+extern void adc_pwm_sync_get_stats(adc_pwm_sync_stats_t *stats, bool reset);
+
+#endif
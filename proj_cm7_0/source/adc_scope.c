@@ -0,0 +1,334 @@
+/******************************************************************************
+* File Name:   adc_scope.c
+*
+* Description: Oscilloscope capture of the SAR ADC. A single channel group
+*              converts continuously and its group done interrupt hands each
+*              result to the trigger engine. The handler posts EVT_ADC_SCOPE
+*              when a capture is complete.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "adc_scope.h"
+#include "oob_demo.h"
+#include "boot_time.h"
+#include "placement.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Same priority as the ADC and GPIO demos */
+#define ADC_SCOPE_INTR_PRIORITY     (7u)
+
+/* CPU interrupt of the group done handler, shared with the PWM synchronized
+ * sampling, which needs the same SAR */
+#define ADC_SCOPE_CPU_IRQ           (NvicMux3_IRQn)
+
+/* SAR clock */
+#define ADC_SCOPE_CLOCK_HZ          (20000000u)
+
+/* Sample time, in SAR clocks */
+#define ADC_SCOPE_SAMPLE_TIME       (32u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void adc_scope_isr(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const cyhal_resource_inst_t adc_scope_rsc = { CYHAL_RSC_ADC, 1u, 0u };
+
+static cyhal_clock_t adc_scope_clock;
+static cy_stc_sar2_channel_config_t adc_scope_channel_cfg;
+static bool adc_scope_running = false;
+
+/* Trigger engine and its ring, fed by the handler while armed */
+static scope_trigger_t adc_scope_trigger;
+static uint16_t adc_scope_buffer[ADC_SCOPE_SAMPLES];
+
+/* boot_time_now() at the first and the last sample of a capture */
+static volatile uint32_t adc_scope_first_us = 0u;
+static volatile uint32_t adc_scope_last_us = 0u;
+
+
+/*******************************************************************************
+* Function Name: adc_scope_init
+********************************************************************************
+* Summary:
+*  Sets up the SAR for continuous conversion of one input and arms the first
+*  capture. The potentiometer pin is set to analog; the pin of another input
+*  must be set up by the caller.
+*
+* Parameters:
+*  config: input, trigger and block layout
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, ADC_SCOPE_RSLT_ERR_PARAM or the error of the
+*  SAR reservation or of its clock
+*
+*******************************************************************************/
+cy_rslt_t adc_scope_init(const adc_scope_config_t *config)
+{
+    cy_stc_sar2_config_t sar_cfg;
+    cy_rslt_t result;
+
+    if (adc_scope_running ||
+        !scope_trigger_init(&adc_scope_trigger, &config->trigger, adc_scope_buffer, ADC_SCOPE_SAMPLES))
+    {
+        return ADC_SCOPE_RSLT_ERR_PARAM;
+    }
+
+    /* Refused while the HAL driver, the window alarms or the PWM synchronized
+     * sampling hold the SAR */
+    result = cyhal_hwmgr_reserve(&adc_scope_rsc);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    result = cyhal_clock_allocate(&adc_scope_clock, CYHAL_CLOCK_BLOCK_PERIPHERAL1_16BIT);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_clock_set_frequency(&adc_scope_clock, ADC_SCOPE_CLOCK_HZ, NULL);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = cyhal_clock_set_enabled(&adc_scope_clock, true, true);
+        }
+        if (CY_RSLT_SUCCESS != result)
+        {
+            cyhal_clock_free(&adc_scope_clock);
+        }
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        cyhal_hwmgr_free(&adc_scope_rsc);
+        return result;
+    }
+    (void)Cy_SysClk_PeriPclkAssignDivider(ADC_SCOPE_SAR_PCLK, CY_SYSCLK_DIV_16_BIT, adc_scope_clock.channel);
+    Cy_GPIO_Pin_FastInit(CYHAL_GET_PORTADDR(CYBSP_POT), CYHAL_GET_PIN(CYBSP_POT), CY_GPIO_DM_ANALOG, 0u,
+                         HSIOM_SEL_GPIO);
+
+    memset(&sar_cfg, 0, sizeof(sar_cfg));
+    sar_cfg.msbStretchMode = CY_SAR2_MSB_STRETCH_MODE_1CYCLE;
+    sar_cfg.sarMuxEnable   = true;
+    sar_cfg.adcEnable      = true;
+    sar_cfg.sarIpEnable    = true;
+
+    /* A group of one channel that restarts as soon as it is done */
+    memset(&adc_scope_channel_cfg, 0, sizeof(adc_scope_channel_cfg));
+    adc_scope_channel_cfg.channelHwEnable        = true;
+    adc_scope_channel_cfg.triggerSelection       = CY_SAR2_TRIGGER_CONTINUOUS;
+    adc_scope_channel_cfg.preenptionType         = CY_SAR2_PREEMPTION_FINISH_RESUME;
+    adc_scope_channel_cfg.isGroupEnd             = true;
+    adc_scope_channel_cfg.doneLevel              = CY_SAR2_DONE_LEVEL_PULSE;
+    adc_scope_channel_cfg.pinAddress             = config->input;
+    adc_scope_channel_cfg.portAddress            = CY_SAR2_PORT_ADDRESS_SARMUX0;
+    adc_scope_channel_cfg.preconditionMode       = CY_SAR2_PRECONDITION_MODE_OFF;
+    adc_scope_channel_cfg.overlapDiagMode        = CY_SAR2_OVERLAP_DIAG_MODE_OFF;
+    adc_scope_channel_cfg.sampleTime             = ADC_SCOPE_SAMPLE_TIME;
+    adc_scope_channel_cfg.calibrationValueSelect = CY_SAR2_CALIBRATION_VALUE_REGULAR;
+    adc_scope_channel_cfg.postProcessingMode     = CY_SAR2_POST_PROCESSING_MODE_NONE;
+    adc_scope_channel_cfg.resultAlignment        = CY_SAR2_RESULT_ALIGNMENT_RIGHT;
+    adc_scope_channel_cfg.signExtention          = CY_SAR2_SIGN_EXTENTION_UNSIGNED;
+    /* No sample is below 0: the range detection stays quiet */
+    adc_scope_channel_cfg.rangeDetectionMode     = CY_SAR2_RANGE_DETECTION_MODE_BELOW_LO;
+    /* Unmasked by adc_scope_arm() */
+    adc_scope_channel_cfg.interruptMask          = 0u;
+    sar_cfg.channelConfig[0] = &adc_scope_channel_cfg;
+
+    Cy_SAR2_SetReferenceBufferMode(PASS0_EPASS_MMIO, CY_SAR2_REF_BUF_MODE_ON);
+    (void)Cy_SAR2_Init(ADC_SCOPE_SAR, &sar_cfg);
+    {
+        const cy_stc_sysint_t intr_cfg =
+        {
+            .intrSrc      = ((uint32_t)ADC_SCOPE_CPU_IRQ << 16) | ADC_SCOPE_SAR_IRQ,
+            .intrPriority = ADC_SCOPE_INTR_PRIORITY,
+        };
+
+        (void)Cy_SysInt_Init(&intr_cfg, adc_scope_isr);
+    }
+    NVIC_EnableIRQ(ADC_SCOPE_CPU_IRQ);
+    adc_scope_running = true;
+
+    Cy_SAR2_Enable(ADC_SCOPE_SAR);
+    Cy_SAR2_Channel_SoftwareTrigger(ADC_SCOPE_SAR, 0u);
+    adc_scope_arm();
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: adc_scope_free
+********************************************************************************
+* Summary:
+*  Stops the conversions and releases the SAR, its clock and its interrupt.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_scope_free(void)
+{
+    if (!adc_scope_running)
+    {
+        return;
+    }
+
+    NVIC_DisableIRQ(ADC_SCOPE_CPU_IRQ);
+    Cy_SAR2_Disable(ADC_SCOPE_SAR);
+    Cy_SAR2_DeInit(ADC_SCOPE_SAR);
+    cyhal_clock_free(&adc_scope_clock);
+    cyhal_hwmgr_free(&adc_scope_rsc);
+    event_flags_clear(&demo_events, EVT_ADC_SCOPE);
+    adc_scope_running = false;
+}
+
+/*******************************************************************************
+* Function Name: adc_scope_arm
+********************************************************************************
+* Summary:
+*  Starts a new capture, dropping the one in the buffer. The first samples
+*  fill the pre-trigger part, then the trigger is awaited.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_scope_arm(void)
+{
+    /* A handler still pending sees the masked status and returns */
+    Cy_SAR2_Channel_SetInterruptMask(ADC_SCOPE_SAR, 0u, 0u);
+    Cy_SAR2_Channel_ClearInterrupt(ADC_SCOPE_SAR, 0u, CY_SAR2_INT_GRP_DONE);
+    event_flags_clear(&demo_events, EVT_ADC_SCOPE);
+    scope_trigger_arm(&adc_scope_trigger);
+    Cy_SAR2_Channel_SetInterruptMask(ADC_SCOPE_SAR, 0u, CY_SAR2_INT_GRP_DONE);
+}
+
+/*******************************************************************************
+* Function Name: adc_scope_force
+********************************************************************************
+* Summary:
+*  Forces the trigger of the capture in progress, for a capture without a
+*  trigger: it fires at the next sample that has the pre-trigger samples before
+*  it.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_scope_force(void)
+{
+    scope_trigger_force(&adc_scope_trigger);
+}
+
+/*******************************************************************************
+* Function Name: adc_scope_read
+********************************************************************************
+* Summary:
+*  Copies a complete capture. The sample period is measured from the first
+*  to the last sample fed to the trigger engine, pre-trigger fill included.
+*
+* Parameters:
+*  capture: receives the layout and timing of the capture
+*  samples: receives the samples, oldest first, up to ADC_SCOPE_SAMPLES
+*
+* Return:
+*  bool: false if the capture is not complete
+*
+*******************************************************************************/
+bool adc_scope_read(adc_scope_capture_t *capture, uint16_t *samples)
+{
+    uint32_t fed = adc_scope_trigger.count;
+
+    if (!scope_trigger_done(&adc_scope_trigger))
+    {
+        return false;
+    }
+
+    capture->samples = scope_trigger_read(&adc_scope_trigger, samples);
+    capture->trigger_index = adc_scope_trigger.config.pre;
+    capture->period_ns = (fed > 1u) ? (((adc_scope_last_us - adc_scope_first_us) * 1000u) / (fed - 1u)) : 0u;
+    capture->forced = adc_scope_trigger.forced;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: adc_scope_isr
+********************************************************************************
+* Summary:
+*  Group done interrupt: feeds the result to the trigger engine, and masks
+*  itself and posts EVT_ADC_SCOPE when the capture is complete.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void adc_scope_isr(void)
+{
+    if (0u == (Cy_SAR2_Channel_GetInterruptStatusMasked(ADC_SCOPE_SAR, 0u) & CY_SAR2_INT_GRP_DONE))
+    {
+        return;
+    }
+    Cy_SAR2_Channel_ClearInterrupt(ADC_SCOPE_SAR, 0u, CY_SAR2_INT_GRP_DONE);
+
+    if (0u == adc_scope_trigger.count)
+    {
+        adc_scope_first_us = boot_time_now();
+    }
+    if (scope_trigger_feed(&adc_scope_trigger, Cy_SAR2_Channel_GetResult(ADC_SCOPE_SAR, 0u, NULL)))
+    {
+        adc_scope_last_us = boot_time_now();
+        Cy_SAR2_Channel_SetInterruptMask(ADC_SCOPE_SAR, 0u, 0u);
+        event_flags_set(&demo_events, EVT_ADC_SCOPE);
+    }
+}
+
+
+/* [] END OF FILE */
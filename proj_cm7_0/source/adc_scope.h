@@ -0,0 +1,94 @@
+/******************************************************************************
+* File Name:   adc_scope.h
+*
+* Description: Oscilloscope capture of the SAR ADC. The SAR converts one
+*              input continuously at its full rate and the group done
+*              interrupt feeds every sample to the trigger engine, until the
+*              pre-trigger and post-trigger samples of a capture are in. The
+*              interrupt is masked from then until the capture is re-armed.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _ADC_SCOPE_H_
+#define _ADC_SCOPE_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "scope_trigger.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* SAR converting the input, the SAR of the potentiometer */
+#define ADC_SCOPE_SAR               (PASS0_SAR1)
+#define ADC_SCOPE_SAR_IRQ           ((uint32_t)pass_0_interrupts_sar_32_IRQn)
+#define ADC_SCOPE_SAR_PCLK          (PCLK_PASS0_CLOCK_SAR1)
+#define ADC_SCOPE_POT_INPUT         (CY_SAR2_PIN_ADDRESS_AN0)
+
+/* Largest capture, pre-trigger and post-trigger samples together */
+#define ADC_SCOPE_SAMPLES           (1024u)
+
+/* A trigger setting or the block layout is out of range, or the capture is
+ * already running */
+#define ADC_SCOPE_RSLT_ERR_PARAM    (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x19u))
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    cy_en_sar2_pin_address_t input;
+    scope_trigger_config_t   trigger;   /* pre + post up to ADC_SCOPE_SAMPLES */
+} adc_scope_config_t;
+
+typedef struct
+{
+    uint32_t samples;               /* pre + post */
+    uint32_t trigger_index;         /* Index of the trigger sample, pre */
+    uint32_t period_ns;             /* Sample period measured over the capture */
+    bool     forced;                /* adc_scope_force() fired the trigger */
+} adc_scope_capture_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t adc_scope_init(const adc_scope_config_t *config);
+extern void adc_scope_free(void);
+extern void adc_scope_arm(void);
+extern void adc_scope_force(void);
+extern bool adc_scope_read(adc_scope_capture_t *capture, uint16_t *samples);
+
+#endif
@@ -0,0 +1,511 @@
+/******************************************************************************
+* File Name:   adc_window.c
+*
+* Description: Window comparator alarms of the SAR ADC, with the range
+*              detection of the SAR driven through the PDL.
+*
+*              Each channel is armed for the crossing that can come next:
+*              inside the window it watches for a sample outside of it, and
+*              after an alarm it watches for a sample back past the limit by
+*              ADC_WINDOW_HYSTERESIS. The handler re-arms the channel with two
+*              register writes, so a sample that stays on one side of a limit
+*              costs no interrupt.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "adc_window.h"
+#include "oob_demo.h"
+#include "boot_time.h"
+#include "profiler.h"
+#include "placement.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Same priority as the ADC and GPIO demos */
+#define ADC_WINDOW_INTR_PRIORITY    (7u)
+
+/* CPU interrupt of the range detection, not used by the HAL */
+#define ADC_WINDOW_CPU_IRQ          (NvicMux5_IRQn)
+
+/* SAR clock */
+#define ADC_WINDOW_CLOCK_HZ         (20000000u)
+
+/* Sample time of each channel, in SAR clocks */
+#define ADC_WINDOW_SAMPLE_TIME      (32u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void adc_window_arm(uint32_t channel);
+static void adc_window_isr(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const cyhal_resource_inst_t adc_window_rsc = { CYHAL_RSC_ADC, 1u, 0u };
+
+static cyhal_clock_t adc_window_clock;
+static cy_stc_sar2_channel_config_t adc_window_channel_cfg[ADC_WINDOW_CHANNELS];
+static uint32_t adc_window_count = 0u;
+
+/* Limits and zone of each channel, read by the handler */
+static volatile uint16_t adc_window_low[ADC_WINDOW_CHANNELS];
+static volatile uint16_t adc_window_high[ADC_WINDOW_CHANNELS];
+static volatile adc_window_zone_t adc_window_zone[ADC_WINDOW_CHANNELS];
+
+/* Queue written by the handler only, read by the main loop only */
+static adc_window_event_t adc_window_queue[ADC_WINDOW_EVENTS];
+static volatile uint32_t adc_window_head = 0u;
+static volatile uint32_t adc_window_tail = 0u;
+
+static volatile adc_window_stats_t adc_window_stats;
+
+
+/*******************************************************************************
+* Function Name: adc_window_init
+********************************************************************************
+* Summary:
+*  Sets up the SAR for continuous conversion of the given channels, each with
+*  its window, and enables the range interrupts. A sample outside a window
+*  raises an alarm as soon as it is converted. The potentiometer pin is set
+*  to analog; pins of other inputs must be set up by the caller.
+*
+* Parameters:
+*  channels: input and limits of each channel, from channel 0
+*  count: number of channels, 1 to ADC_WINDOW_CHANNELS
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, ADC_WINDOW_RSLT_ERR_PARAM or the error of the
+*  SAR reservation or of its clock
+*
+*******************************************************************************/
+cy_rslt_t adc_window_init(const adc_window_channel_t *channels, uint32_t count)
+{
+    cy_stc_sar2_config_t sar_cfg;
+    cy_rslt_t result;
+
+    if ((0u != adc_window_count) || (0u == count) || (count > ADC_WINDOW_CHANNELS))
+    {
+        return ADC_WINDOW_RSLT_ERR_PARAM;
+    }
+    for (uint32_t channel = 0u; channel < count; channel++)
+    {
+        if ((channels[channel].low > channels[channel].high) ||
+            (channels[channel].high > ADC_WINDOW_FULL_SCALE))
+        {
+            return ADC_WINDOW_RSLT_ERR_PARAM;
+        }
+    }
+
+    /* Refused while the HAL driver of the SAR ADC demo holds the block */
+    result = cyhal_hwmgr_reserve(&adc_window_rsc);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    result = cyhal_clock_allocate(&adc_window_clock, CYHAL_CLOCK_BLOCK_PERIPHERAL1_16BIT);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_clock_set_frequency(&adc_window_clock, ADC_WINDOW_CLOCK_HZ, NULL);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = cyhal_clock_set_enabled(&adc_window_clock, true, true);
+        }
+        if (CY_RSLT_SUCCESS != result)
+        {
+            cyhal_clock_free(&adc_window_clock);
+        }
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        cyhal_hwmgr_free(&adc_window_rsc);
+        return result;
+    }
+    (void)Cy_SysClk_PeriPclkAssignDivider(ADC_WINDOW_SAR_PCLK, CY_SYSCLK_DIV_16_BIT, adc_window_clock.channel);
+    Cy_GPIO_Pin_FastInit(CYHAL_GET_PORTADDR(CYBSP_POT), CYHAL_GET_PIN(CYBSP_POT), CY_GPIO_DM_ANALOG, 0u,
+                         HSIOM_SEL_GPIO);
+
+    memset(&sar_cfg, 0, sizeof(sar_cfg));
+    sar_cfg.preconditionTime    = 0u;
+    sar_cfg.powerupTime         = 0u;
+    sar_cfg.enableIdlePowerDown = false;
+    sar_cfg.msbStretchMode      = CY_SAR2_MSB_STRETCH_MODE_1CYCLE;
+    sar_cfg.enableHalfLsbConv   = false;
+    sar_cfg.sarMuxEnable        = true;
+    sar_cfg.adcEnable           = true;
+    sar_cfg.sarIpEnable         = true;
+
+    adc_window_head = 0u;
+    adc_window_tail = 0u;
+    memset((void *)&adc_window_stats, 0, sizeof(adc_window_stats));
+    for (uint32_t channel = 0u; channel < count; channel++)
+    {
+        cy_stc_sar2_channel_config_t *cfg = &adc_window_channel_cfg[channel];
+
+        /* Channel 0 restarts the group as soon as its last channel is done */
+        memset(cfg, 0, sizeof(*cfg));
+        cfg->channelHwEnable            = true;
+        cfg->triggerSelection           = (0u == channel) ? CY_SAR2_TRIGGER_CONTINUOUS : CY_SAR2_TRIGGER_OFF;
+        cfg->channelPriority            = 0u;
+        cfg->preenptionType             = CY_SAR2_PREEMPTION_FINISH_RESUME;
+        cfg->isGroupEnd                 = ((count - 1u) == channel);
+        cfg->doneLevel                  = CY_SAR2_DONE_LEVEL_PULSE;
+        cfg->pinAddress                 = channels[channel].input;
+        cfg->portAddress                = CY_SAR2_PORT_ADDRESS_SARMUX0;
+        cfg->preconditionMode           = CY_SAR2_PRECONDITION_MODE_OFF;
+        cfg->overlapDiagMode            = CY_SAR2_OVERLAP_DIAG_MODE_OFF;
+        cfg->sampleTime                 = ADC_WINDOW_SAMPLE_TIME;
+        cfg->calibrationValueSelect     = CY_SAR2_CALIBRATION_VALUE_REGULAR;
+        cfg->postProcessingMode         = CY_SAR2_POST_PROCESSING_MODE_NONE;
+        cfg->resultAlignment            = CY_SAR2_RESULT_ALIGNMENT_RIGHT;
+        cfg->signExtention              = CY_SAR2_SIGN_EXTENTION_UNSIGNED;
+        cfg->rangeDetectionMode         = CY_SAR2_RANGE_DETECTION_MODE_OUTSIDE_RANGE;
+        cfg->rangeDetectionLoThreshold  = channels[channel].low;
+        cfg->rangeDetectionHiThreshold  = channels[channel].high;
+        cfg->interruptMask              = CY_SAR2_INT_CH_RANGE;
+        sar_cfg.channelConfig[channel]  = cfg;
+
+        adc_window_low[channel] = channels[channel].low;
+        adc_window_high[channel] = channels[channel].high;
+        adc_window_zone[channel] = ADC_WINDOW_INSIDE;
+    }
+    adc_window_count = count;
+
+    Cy_SAR2_SetReferenceBufferMode(PASS0_EPASS_MMIO, CY_SAR2_REF_BUF_MODE_ON);
+    (void)Cy_SAR2_Init(ADC_WINDOW_SAR, &sar_cfg);
+
+    for (uint32_t channel = 0u; channel < count; channel++)
+    {
+        const cy_stc_sysint_t intr_cfg =
+        {
+            .intrSrc      = ((uint32_t)ADC_WINDOW_CPU_IRQ << 16) | (ADC_WINDOW_SAR_IRQ + channel),
+            .intrPriority = ADC_WINDOW_INTR_PRIORITY,
+        };
+
+        (void)Cy_SysInt_Init(&intr_cfg, adc_window_isr);
+    }
+    NVIC_EnableIRQ(ADC_WINDOW_CPU_IRQ);
+
+    Cy_SAR2_Enable(ADC_WINDOW_SAR);
+    Cy_SAR2_Channel_SoftwareTrigger(ADC_WINDOW_SAR, 0u);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_free
+********************************************************************************
+* Summary:
+*  Stops the conversions and releases the SAR, its clock and its interrupts.
+*  Queued events are dropped.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_window_free(void)
+{
+    if (0u == adc_window_count)
+    {
+        return;
+    }
+
+    NVIC_DisableIRQ(ADC_WINDOW_CPU_IRQ);
+    Cy_SAR2_Disable(ADC_WINDOW_SAR);
+    Cy_SAR2_DeInit(ADC_WINDOW_SAR);
+    cyhal_clock_free(&adc_window_clock);
+    cyhal_hwmgr_free(&adc_window_rsc);
+
+    adc_window_count = 0u;
+    adc_window_head = 0u;
+    adc_window_tail = 0u;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_set_limits
+********************************************************************************
+* Summary:
+*  Changes the window of a channel while it converts. The channel is armed
+*  again as if its samples were inside the new window, so a sample outside of
+*  it raises a new alarm.
+*
+* Parameters:
+*  channel: channel given to adc_window_init()
+*  low: sample values below it are below the window, in ADC counts
+*  high: sample values from it up are above the window, in ADC counts
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or ADC_WINDOW_RSLT_ERR_PARAM
+*
+*******************************************************************************/
+cy_rslt_t adc_window_set_limits(uint32_t channel, uint16_t low, uint16_t high)
+{
+    if ((channel >= adc_window_count) || (low > high) || (high > ADC_WINDOW_FULL_SCALE))
+    {
+        return ADC_WINDOW_RSLT_ERR_PARAM;
+    }
+
+    NVIC_DisableIRQ(ADC_WINDOW_CPU_IRQ);
+    adc_window_low[channel] = low;
+    adc_window_high[channel] = high;
+    adc_window_zone[channel] = ADC_WINDOW_INSIDE;
+    Cy_SAR2_Channel_ClearInterrupt(ADC_WINDOW_SAR, channel, CY_SAR2_INT_CH_RANGE);
+    adc_window_arm(channel);
+    NVIC_EnableIRQ(ADC_WINDOW_CPU_IRQ);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_read_event
+********************************************************************************
+* Summary:
+*  Takes the oldest crossing from the queue.
+*
+* Parameters:
+*  event: receives the crossing
+*
+* Return:
+*  bool: false if the queue is empty
+*
+*******************************************************************************/
+bool adc_window_read_event(adc_window_event_t *event)
+{
+    uint32_t tail = adc_window_tail;
+
+    if (tail == adc_window_head)
+    {
+        return false;
+    }
+    *event = adc_window_queue[tail];
+    __DMB();
+    adc_window_tail = (tail + 1u) % ADC_WINDOW_EVENTS;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_get_stats
+********************************************************************************
+* Summary:
+*  Copies the counters of the range interrupts: the interrupts taken, the
+*  crossings dropped on a full queue and the cycles spent in the handler.
+*
+* Parameters:
+*  stats: receives the counters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void adc_window_get_stats(adc_window_stats_t *stats)
+{
+    uint32_t saved = Cy_SysLib_EnterCriticalSection();
+
+    *stats = adc_window_stats;
+    Cy_SysLib_ExitCriticalSection(saved);
+}
+
+/*******************************************************************************
+* Function Name: adc_window_mv_to_counts
+********************************************************************************
+* Summary:
+*  Converts millivolts to ADC counts, rounded and clipped to the full scale,
+*  for the limits of a window.
+*
+* Parameters:
+*  mv: voltage in millivolts
+*
+* Return:
+*  uint16_t: counts, at most ADC_WINDOW_FULL_SCALE
+*
+*******************************************************************************/
+uint16_t adc_window_mv_to_counts(uint32_t mv)
+{
+    uint32_t counts = ((mv * ADC_WINDOW_FULL_SCALE) + (ADC_WINDOW_VREF_MV / 2u)) / ADC_WINDOW_VREF_MV;
+
+    return (uint16_t)((counts < ADC_WINDOW_FULL_SCALE) ? counts : ADC_WINDOW_FULL_SCALE);
+}
+
+/*******************************************************************************
+* Function Name: adc_window_counts_to_mv
+********************************************************************************
+* Summary:
+*  Converts ADC counts to millivolts, rounded.
+*
+* Parameters:
+*  counts: sample or limit in counts
+*
+* Return:
+*  uint32_t: voltage in millivolts
+*
+*******************************************************************************/
+uint32_t adc_window_counts_to_mv(uint16_t counts)
+{
+    return (((uint32_t)counts * ADC_WINDOW_VREF_MV) + (ADC_WINDOW_FULL_SCALE / 2u)) / ADC_WINDOW_FULL_SCALE;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_arm
+********************************************************************************
+* Summary:
+*  Programs the range detection of a channel for the crossing out of its
+*  current zone: outside the window from inside of it, and back past the
+*  limit by ADC_WINDOW_HYSTERESIS after an alarm.
+*
+* Parameters:
+*  channel: channel to arm
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void adc_window_arm(uint32_t channel)
+{
+    uint32_t low = adc_window_low[channel];
+    uint32_t high = adc_window_high[channel];
+    uint32_t mode;
+
+    switch (adc_window_zone[channel])
+    {
+        case ADC_WINDOW_BELOW:
+            /* Fires for sample >= low + hysteresis */
+            mode = CY_SAR2_RANGE_DETECTION_MODE_ABOVE_HI;
+            high = low + ADC_WINDOW_HYSTERESIS;
+            low = 0u;
+            break;
+        case ADC_WINDOW_ABOVE:
+            /* Fires for sample < high - hysteresis */
+            mode = CY_SAR2_RANGE_DETECTION_MODE_BELOW_LO;
+            low = (high > ADC_WINDOW_HYSTERESIS) ? (high - ADC_WINDOW_HYSTERESIS) : 0u;
+            high = ADC_WINDOW_FULL_SCALE;
+            break;
+        default:
+            mode = CY_SAR2_RANGE_DETECTION_MODE_OUTSIDE_RANGE;
+            break;
+    }
+
+    ADC_WINDOW_SAR->CH[channel].RANGE_CTL = _VAL2FLD(PASS_SAR_CH_RANGE_CTL_RANGE_LO, low) |
+                                            _VAL2FLD(PASS_SAR_CH_RANGE_CTL_RANGE_HI, high);
+    CY_REG32_CLR_SET(ADC_WINDOW_SAR->CH[channel].POST_CTL, PASS_SAR_CH_POST_CTL_RANGE_MODE, mode);
+}
+
+/*******************************************************************************
+* Function Name: adc_window_isr
+********************************************************************************
+* Summary:
+*  Range interrupt of the channels: queues the crossing with its sample and
+*  time, re-arms the channel for the next crossing and posts EVT_ADC_WINDOW.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void adc_window_isr(void)
+{
+    uint32_t cycles = profiler_cycles();
+    uint32_t time_us = boot_time_now();
+    bool queued = false;
+
+    for (uint32_t channel = 0u; channel < adc_window_count; channel++)
+    {
+        uint32_t status;
+        uint16_t sample;
+        adc_window_zone_t zone;
+
+        if (0u == (Cy_SAR2_Channel_GetInterruptStatusMasked(ADC_WINDOW_SAR, channel) & CY_SAR2_INT_CH_RANGE))
+        {
+            continue;
+        }
+        sample = Cy_SAR2_Channel_GetResult(ADC_WINDOW_SAR, channel, &status);
+        Cy_SAR2_Channel_ClearInterrupt(ADC_WINDOW_SAR, channel, CY_SAR2_INT_CH_RANGE);
+        adc_window_stats.interrupts++;
+
+        if (sample < adc_window_low[channel])
+        {
+            zone = ADC_WINDOW_BELOW;
+        }
+        else if (sample >= adc_window_high[channel])
+        {
+            zone = ADC_WINDOW_ABOVE;
+        }
+        else
+        {
+            zone = ADC_WINDOW_INSIDE;
+        }
+
+        /* A result converted before the last re-arm may repeat the zone */
+        if (zone != adc_window_zone[channel])
+        {
+            uint32_t head = adc_window_head;
+            uint32_t next = (head + 1u) % ADC_WINDOW_EVENTS;
+
+            adc_window_zone[channel] = zone;
+            if (next != adc_window_tail)
+            {
+                adc_window_queue[head].channel = (uint8_t)channel;
+                adc_window_queue[head].zone = zone;
+                adc_window_queue[head].sample = sample;
+                adc_window_queue[head].time_us = time_us;
+                adc_window_queue[head].cycles = cycles;
+                __DMB();
+                adc_window_head = next;
+                queued = true;
+            }
+            else
+            {
+                adc_window_stats.dropped++;
+            }
+        }
+        adc_window_arm(channel);
+    }
+
+    if (queued)
+    {
+        event_flags_set(&demo_events, EVT_ADC_WINDOW);
+    }
+    adc_window_stats.isr_cycles += profiler_cycles() - cycles;
+}
+
+/* [] END OF FILE */
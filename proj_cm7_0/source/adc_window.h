@@ -0,0 +1,126 @@
+/******************************************************************************
+* File Name:   adc_window.h
+*
+* Description: Window comparator alarms of the SAR ADC. The channels convert
+*              continuously in hardware, and the range detection of the SAR
+*              raises an interrupt only when a sample leaves the window
+*              between the low and the high limit of its channel, or comes
+*              back into it. Each crossing is queued as an event carrying the
+*              sample and its timestamp, and posts EVT_ADC_WINDOW.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _ADC_WINDOW_H_
+#define _ADC_WINDOW_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* SAR converting the potentiometer (CYBSP_POT, P12_0): input 0 of SAR 1 */
+#define ADC_WINDOW_SAR              (PASS0_SAR1)
+#define ADC_WINDOW_SAR_IRQ          ((uint32_t)pass_0_interrupts_sar_32_IRQn)
+#define ADC_WINDOW_SAR_PCLK         (PCLK_PASS0_CLOCK_SAR1)
+#define ADC_WINDOW_POT_INPUT        (CY_SAR2_PIN_ADDRESS_AN0)
+
+/* Logical channels, converted in one continuous group from channel 0 */
+#define ADC_WINDOW_CHANNELS         (4u)
+
+/* 12-bit results against the VDDA reference */
+#define ADC_WINDOW_FULL_SCALE       (4096u)
+#define ADC_WINDOW_VREF_MV          (3300u)
+
+/* A sample must move this far back into the window to end an alarm, so that
+ * noise on a limit does not raise an interrupt per conversion */
+#define ADC_WINDOW_HYSTERESIS       (24u)
+
+/* Crossings queued for the main loop */
+#define ADC_WINDOW_EVENTS           (16u)
+
+/* A channel or a limit is out of range, or the SAR is in use */
+#define ADC_WINDOW_RSLT_ERR_PARAM   (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x17u))
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+/* Position of the last sample relative to the window */
+typedef enum
+{
+    ADC_WINDOW_INSIDE = 0u,         /* low <= sample < high */
+    ADC_WINDOW_BELOW,               /* sample < low */
+    ADC_WINDOW_ABOVE,               /* sample >= high */
+} adc_window_zone_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    cy_en_sar2_pin_address_t input; /* Analog input of ADC_WINDOW_SAR */
+    uint16_t                 low;   /* Limits, in ADC counts */
+    uint16_t                 high;
+} adc_window_channel_t;
+
+typedef struct
+{
+    uint8_t           channel;
+    adc_window_zone_t zone;         /* Zone entered */
+    uint16_t          sample;       /* Result that crossed, in ADC counts */
+    uint32_t          time_us;      /* boot_time_now() in the handler */
+    uint32_t          cycles;       /* profiler_cycles() at the handler entry */
+} adc_window_event_t;
+
+typedef struct
+{
+    uint32_t interrupts;            /* Range interrupts handled */
+    uint32_t dropped;               /* Events lost to a full queue */
+    uint64_t isr_cycles;            /* CPU cycles spent in the handler */
+} adc_window_stats_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t adc_window_init(const adc_window_channel_t *channels, uint32_t count);
+extern void adc_window_free(void);
+extern cy_rslt_t adc_window_set_limits(uint32_t channel, uint16_t low, uint16_t high);
+extern bool adc_window_read_event(adc_window_event_t *event);
+extern void adc_window_get_stats(adc_window_stats_t *stats);
+extern uint16_t adc_window_mv_to_counts(uint32_t mv);
+extern uint32_t adc_window_counts_to_mv(uint16_t counts);
+
+#endif
@@ -0,0 +1,1870 @@
+/******************************************************************************
+* File Name:   bench.c
+*
+* Description: Benchmark suite of CM7_0, run once by main() in the BENCH=1
+*              build. Each benchmark sets up its peripheral, measures it with
+*              the DWT cycle counter (or the low-power counter of the
+*              transition profiler for the power modes), releases it and
+*              prints its result as one JSON object per line, e.g.
+*
+*              {"bench":"qspi_read","platform":"target","unit":"B/s",...}
+*
+*              Lines that do not start with '{' are regular console output.
+*              On the host simulation the same code measures the simulated
+*              peripherals, so the results are only comparable between runs
+*              of the same platform.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#if !defined(__arm__)
+#include <pthread.h>
+#endif /* !defined(__arm__) */
+#include "bench.h"
+#include "profiler.h"
+#include "power_manager.h"
+#include "pm_profiler.h"
+#include "io_client.h"
+#include "print_message.h"
+#include "oob_demo.h"
+#include "pin.h"
+#include "placement.h"
+#include "cycfg.h"
+#include "cycfg_qspi_memslot.h"
+#include "cy_serial_flash_qspi.h"
+#include "event_flags.h"
+#include "param.h"
+#include "adc_window.h"
+#include "adc_pwm_sync.h"
+#include "adc_scope.h"
+#include "scope_frame.h"
+#include "edge_stats.h"
+#include "console_fmt.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(__arm__)
+#define BENCH_PLATFORM              "target"
+#else
+#define BENCH_PLATFORM              "host"
+#endif /* defined(__arm__) */
+
+/* Longest wait for an interrupt of a benchmark */
+#define BENCH_TIMEOUT_MS            (100u)
+
+/* UART TX: bytes sent, in lines of BENCH_UART_LINE_SIZE characters */
+#define BENCH_UART_BYTES            (4096u)
+#define BENCH_UART_LINE_SIZE        (64u)
+
+/* GPIO ISR latency: edges written to the LED pin, whose input buffer sees
+ * them as well */
+#define BENCH_GPIO_PIN              CYBSP_USER_LED1
+#define BENCH_GPIO_SAMPLES          (64u)
+
+/* GPIO toggle: cycles per toggle of the LED pin, averaged over batches */
+#define BENCH_TOGGLE_BATCHES        (32u)
+#define BENCH_TOGGLE_PER_BATCH      (32u)
+
+/* DMA buffers: bytes written, made visible to a DMA and read back after a
+ * DMA write, in a cacheable buffer with cache maintenance and in the
+ * non-cacheable section */
+#define BENCH_DMA_BYTES             (2048u)
+#define BENCH_DMA_ROUNDS            (16u)
+
+/* ADC sample rate: conversions of the potentiometer channel */
+#define BENCH_ADC_SAMPLES           (1000u)
+
+/* ADC alarms: window crossings forced by moving the limits, polled reads,
+ * and the time the CPU is watched while the input stays inside */
+#define BENCH_ADC_ALARMS            (32u)
+#define BENCH_ADC_IDLE_MS           (20u)
+
+/* PWM synchronized ADC: conversions of each trigger mode at a 10 kHz PWM,
+ * triggered at a quarter of the period */
+#define BENCH_ADC_SYNC_HZ           (10000u)
+#define BENCH_ADC_SYNC_PERMILLE     (250u)
+#define BENCH_ADC_SYNC_MS           (50u)
+
+/* ADC scope: one capture of the potentiometer without trigger, then the
+ * trigger engine fed the captured block again and the frame encoded */
+#define BENCH_ADC_SCOPE_PRE         (256u)
+#define BENCH_ADC_SCOPE_TIMEOUT_MS  (500u)
+
+/* Edge statistics: periods of a 200 kHz, 25 % input at the 100 MHz capture
+ * clock with a few ticks of jitter, starting shortly before the counter
+ * wraps, reduced BENCH_EDGE_ROUNDS times */
+#define BENCH_EDGE_PERIODS          (1024u)
+#define BENCH_EDGE_PERIOD_TICKS     (500u)
+#define BENCH_EDGE_HIGH_TICKS       (125u)
+#define BENCH_EDGE_JITTER_TICKS     (8u)
+#define BENCH_EDGE_ROUNDS           (16u)
+
+/* Console formatter: calls of each formatter on the formats of the SAR ADC
+ * reading and of a byte of the QSPI hex dump */
+#define BENCH_FMT_CALLS             (64u)
+#define BENCH_FMT_LINE_SIZE         (32u)
+
+/* QSPI: bytes programmed and read back in the sector used by the QSPI demo */
+#define BENCH_QSPI_BYTES            (4096u)
+#define BENCH_QSPI_SLOT             (0u)
+#define BENCH_QSPI_FREQUENCY_HZ     (50000000lu)
+
+/* CAN FD: frames sent one after the other in internal loop-back mode */
+#define BENCH_CANFD_FRAMES          (200u)
+#define BENCH_CANFD_ID              (0x55u)
+#define BENCH_CANFD_DLC             (8u)
+#define BENCH_CANFD_BUFFER_INDEX    (0u)
+
+/* Power modes: transitions per mode, each ended by a low-power timer match */
+#define BENCH_PM_CYCLES             (16u)
+#define BENCH_PM_WAKE_US            (2000u)
+
+/* Event flags: BENCH_EVENT_POSTS posts spread over BENCH_EVENT_PRODUCERS
+ * bits, by a timer interrupt on the target and by as many threads on the
+ * host, while the main loop takes them and toggles a bit of its own. Every
+ * post that found its bit clear must be taken exactly once. */
+#define BENCH_EVENT_POSTS           (30000u)
+#define BENCH_EVENT_PRODUCERS       (3u)
+#define BENCH_EVENT_MAIN_BIT        (1UL << 31)
+#define BENCH_EVENT_TIMER_HZ        (1000000u)
+#define BENCH_EVENT_TIMER_PERIOD    (9u)
+#define BENCH_EVENT_TIMEOUT_MS      (2000u)
+
+/* Parameter snapshot: serialize and deserialize round trips of a set of
+ * non-default values */
+#define BENCH_PARAM_ROUNDS          (64u)
+
+#define BENCH_INTR_PRIORITY         (2u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* One benchmark of the suite */
+typedef struct
+{
+    const char *name;
+    cy_rslt_t (*run)(void);
+} bench_case_t;
+
+/* Minimum, maximum and total of repeated measurements */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} bench_stat_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static cy_rslt_t bench_uart_tx(void);
+static cy_rslt_t bench_gpio_isr_latency(void);
+static cy_rslt_t bench_gpio_toggle(void);
+static cy_rslt_t bench_dma_buffer(void);
+static cy_rslt_t bench_adc_sample_rate(void);
+static cy_rslt_t bench_adc_window(void);
+static cy_rslt_t bench_adc_pwm_sync(void);
+static cy_rslt_t bench_adc_scope(void);
+static cy_rslt_t bench_edge_stats(void);
+static cy_rslt_t bench_console_fmt(void);
+static cy_rslt_t bench_qspi(void);
+static cy_rslt_t bench_canfd_loopback(void);
+static cy_rslt_t bench_power_modes(void);
+static cy_rslt_t bench_event_flags(void);
+static cy_rslt_t bench_param_snapshot(void);
+
+static bool bench_wait(volatile bool *flag);
+static bool bench_wait_adc_window(adc_window_event_t *event);
+static uint32_t bench_dma_buffer_pass(uint8_t *buffer, uint32_t *write_cycles, uint32_t *read_cycles);
+/*******************************************************************************
+* Function Name: bench_wait_adc_window
+********************************************************************************
+* Summary:
+*  Waits for a window crossing, at most BENCH_TIMEOUT_MS.
+*
+* Parameters:
+*  event: receives the crossing
+*
+* Return:
+*  bool: true if a crossing was queued in time
+*
+*******************************************************************************/
+static bool bench_wait_adc_window(adc_window_event_t *event)
+{
+    uint32_t timeout = (SystemCoreClock / 1000u) * BENCH_TIMEOUT_MS;
+    uint32_t start = profiler_cycles();
+
+    while (!adc_window_read_event(event))
+    {
+        if ((profiler_cycles() - start) > timeout)
+        {
+            return false;
+        }
+        __NOP();
+    }
+
+    return true;
+}
+
+static void bench_stat_reset(bench_stat_t *stat);
+static void bench_stat_add(bench_stat_t *stat, uint32_t value);
+static void bench_emit_rate(const char *name, const char *unit, uint32_t amount, uint32_t cycles);
+static void bench_emit_stat(const char *name, const char *unit, const bench_stat_t *stat);
+static void bench_emit_pm(const char *name, const pm_prof_stat_t *stat);
+
+static void bench_gpio_handler(void *handler_arg, cyhal_gpio_event_t event);
+static void bench_canfd_isr(void);
+static void bench_canfd_rx(bool rxFIFOMsg, uint8_t msgBufOrRxFIFONum,
+                           cy_stc_canfd_rx_buffer_t *basemsg);
+static void bench_lptimer_handler(void *callback_arg, cyhal_lptimer_event_t event);
+static void bench_event_post(uint32_t producer);
+#if defined(__arm__)
+static void bench_event_timer_handler(void *callback_arg, cyhal_timer_event_t event);
+#else
+static void *bench_event_thread(void *arg);
+#endif /* defined(__arm__) */
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const bench_case_t bench_cases[] =
+{
+    { "uart_tx",            bench_uart_tx },
+    { "gpio_isr_latency",   bench_gpio_isr_latency },
+    { "gpio_toggle",        bench_gpio_toggle },
+    { "dma_buffer",         bench_dma_buffer },
+    { "adc_sample_rate",    bench_adc_sample_rate },
+    { "adc_window",         bench_adc_window },
+    { "adc_pwm_sync",       bench_adc_pwm_sync },
+    { "adc_scope",          bench_adc_scope },
+    { "edge_stats",         bench_edge_stats },
+    { "console_fmt",        bench_console_fmt },
+    { "qspi",               bench_qspi },
+    { "canfd_loopback",     bench_canfd_loopback },
+    { "power_modes",        bench_power_modes },
+    { "event_flags",        bench_event_flags },
+    { "param_snapshot",     bench_param_snapshot },
+};
+
+/* Cycle counter at the entry of the GPIO callback */
+static volatile uint32_t bench_gpio_stamp;
+static volatile bool bench_gpio_flag = false;
+static cyhal_gpio_callback_data_t bench_gpio_callback_data =
+{
+    .callback     = bench_gpio_handler,
+    .callback_arg = NULL,
+};
+
+/* Program and read-back buffers of the QSPI benchmark */
+static uint8_t bench_dma_cached[BENCH_DMA_BYTES] __attribute__((aligned(PLACEMENT_CACHE_LINE)));
+static PLACE_NOCACHE uint8_t bench_dma_nocache[BENCH_DMA_BYTES];
+
+static uint8_t bench_qspi_tx[BENCH_QSPI_BYTES];
+static uint8_t bench_qspi_rx[BENCH_QSPI_BYTES];
+
+static cy_stc_canfd_context_t bench_canfd_context;
+static const cy_stc_sysint_t bench_canfd_irq_cfg =
+{
+    .intrSrc      = (NvicMux2_IRQn << 16) | CANFD_IRQ_0,
+    .intrPriority = BENCH_INTR_PRIORITY,
+};
+/* First data word of the last frame received */
+static volatile uint32_t bench_canfd_sequence;
+static volatile bool bench_canfd_flag = false;
+
+static volatile bool bench_lptimer_flag = false;
+
+static event_flags_t bench_events = EVENT_FLAGS_INIT(0u);
+static volatile uint32_t bench_event_posted[BENCH_EVENT_PRODUCERS];
+static volatile uint32_t bench_event_sets;
+static volatile uint32_t bench_event_done;
+static volatile bool bench_event_stop;
+
+
+/*******************************************************************************
+* Function Name: bench_run
+********************************************************************************
+* Summary:
+*  Runs every benchmark of the suite once, prints a result or an error line
+*  for each and a summary line, and waits for the console to be sent.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int: number of failed benchmarks, 0 if all passed
+*
+*******************************************************************************/
+int bench_run(void)
+{
+    uint32_t failed = 0u;
+    uint32_t count = sizeof(bench_cases) / sizeof(bench_cases[0]);
+
+    printf("{\"bench\":\"suite\",\"platform\":\"%s\",\"event\":\"start\",\"cpu_hz\":%lu,\"count\":%lu}\r\n",
+           BENCH_PLATFORM, (unsigned long)SystemCoreClock, (unsigned long)count);
+
+    for (uint32_t index = 0u; index < count; index++)
+    {
+        cy_rslt_t result = bench_cases[index].run();
+
+        if (CY_RSLT_SUCCESS != result)
+        {
+            printf("{\"bench\":\"%s\",\"platform\":\"%s\",\"error\":\"0x%08lx\"}\r\n",
+                   bench_cases[index].name, BENCH_PLATFORM, (unsigned long)result);
+            failed++;
+        }
+    }
+
+    printf("{\"bench\":\"suite\",\"platform\":\"%s\",\"event\":\"end\",\"passed\":%lu,\"failed\":%lu}\r\n",
+           BENCH_PLATFORM, (unsigned long)(count - failed), (unsigned long)failed);
+
+    while (io_client_tx_active())
+    {
+    }
+
+    return (int)failed;
+}
+
+/*******************************************************************************
+* Function Name: bench_uart_tx
+********************************************************************************
+* Summary:
+*  Console throughput: time to send BENCH_UART_BYTES through stdout until the
+*  last character has left the debug UART (or has been taken by CM0+ with
+*  IO_COPROCESSOR=1).
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+static cy_rslt_t bench_uart_tx(void)
+{
+    char line[BENCH_UART_LINE_SIZE];
+    uint32_t start;
+
+    memset(line, '.', sizeof(line));
+    line[BENCH_UART_LINE_SIZE - 2u] = '\r';
+    line[BENCH_UART_LINE_SIZE - 1u] = '\n';
+
+    while (io_client_tx_active())
+    {
+    }
+
+    start = profiler_cycles();
+    for (uint32_t sent = 0u; sent < BENCH_UART_BYTES; sent += BENCH_UART_LINE_SIZE)
+    {
+        (void)fwrite(line, 1u, sizeof(line), stdout);
+    }
+    (void)fflush(stdout);
+    while (io_client_tx_active())
+    {
+    }
+
+    bench_emit_rate("uart_tx", "B/s", BENCH_UART_BYTES, profiler_cycles() - start);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: bench_gpio_isr_latency
+********************************************************************************
+* Summary:
+*  Cycles from a write to the LED pin to the entry of its HAL GPIO callback,
+*  through the port interrupt and the HAL dispatcher.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the pin initialization error or
+*  BENCH_RSLT_ERR_TIMEOUT
+*
+*******************************************************************************/
+static cy_rslt_t bench_gpio_isr_latency(void)
+{
+    bench_stat_t stat;
+    cy_rslt_t result;
+
+    result = cyhal_gpio_init(BENCH_GPIO_PIN, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, LED_OFF);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    cyhal_gpio_register_callback(BENCH_GPIO_PIN, &bench_gpio_callback_data);
+    cyhal_gpio_enable_event(BENCH_GPIO_PIN, CYHAL_GPIO_IRQ_BOTH, BENCH_INTR_PRIORITY, true);
+
+    bench_stat_reset(&stat);
+    for (uint32_t sample = 0u; sample < BENCH_GPIO_SAMPLES; sample++)
+    {
+        uint32_t start;
+
+        bench_gpio_flag = false;
+        start = profiler_cycles();
+        cyhal_gpio_toggle(BENCH_GPIO_PIN);
+        if (!bench_wait(&bench_gpio_flag))
+        {
+            result = BENCH_RSLT_ERR_TIMEOUT;
+            break;
+        }
+        bench_stat_add(&stat, bench_gpio_stamp - start);
+    }
+
+    cyhal_gpio_enable_event(BENCH_GPIO_PIN, CYHAL_GPIO_IRQ_BOTH, BENCH_INTR_PRIORITY, false);
+    cyhal_gpio_register_callback(BENCH_GPIO_PIN, NULL);
+    cyhal_gpio_free(BENCH_GPIO_PIN);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        bench_emit_stat("gpio_isr_latency", "cycles", &stat);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_gpio_toggle
+********************************************************************************
+* Summary:
+*  Cycles per toggle of the LED pin with cyhal_gpio_toggle() and with
+*  PIN_INV(), which stores the pin mask to the OUT_INV register of its port.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or the pin initialization error
+*
+*******************************************************************************/
+static cy_rslt_t bench_gpio_toggle(void)
+{
+    bench_stat_t hal;
+    bench_stat_t pin;
+    cy_rslt_t result;
+
+    result = cyhal_gpio_init(BENCH_GPIO_PIN, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, LED_OFF);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    bench_stat_reset(&hal);
+    bench_stat_reset(&pin);
+    for (uint32_t batch = 0u; batch < BENCH_TOGGLE_BATCHES; batch++)
+    {
+        uint32_t start = profiler_cycles();
+
+        for (uint32_t toggle = 0u; toggle < BENCH_TOGGLE_PER_BATCH; toggle++)
+        {
+            cyhal_gpio_toggle(BENCH_GPIO_PIN);
+        }
+        bench_stat_add(&hal, (profiler_cycles() - start) / BENCH_TOGGLE_PER_BATCH);
+
+        start = profiler_cycles();
+        for (uint32_t toggle = 0u; toggle < BENCH_TOGGLE_PER_BATCH; toggle++)
+        {
+            PIN_INV(BENCH_GPIO_PIN);
+        }
+        bench_stat_add(&pin, (profiler_cycles() - start) / BENCH_TOGGLE_PER_BATCH);
+    }
+
+    cyhal_gpio_free(BENCH_GPIO_PIN);
+
+    bench_emit_stat("gpio_toggle_hal", "cycles", &hal);
+    bench_emit_stat("gpio_toggle_pin", "cycles", &pin);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: bench_dma_buffer_pass
+********************************************************************************
+* Summary:
+*  Prepares a DMA buffer BENCH_DMA_ROUNDS times: fills it and cleans it from
+*  the D-cache, as before a DMA reads it; then reads it back after
+*  invalidating it, as after a DMA wrote it. The cache operations do nothing
+*  for a buffer of the non-cacheable section.
+*
+* Parameters:
+*  buffer: buffer of BENCH_DMA_BYTES
+*  write_cycles: cycles taken by the fills and cleans
+*  read_cycles: cycles taken by the invalidations and reads
+*
+* Return:
+*  uint32_t: sum of the bytes read, keeps the reads from being optimized out
+*
+*******************************************************************************/
+static uint32_t bench_dma_buffer_pass(uint8_t *buffer, uint32_t *write_cycles, uint32_t *read_cycles)
+{
+    uint32_t sum = 0u;
+    uint32_t start = profiler_cycles();
+
+    for (uint32_t round = 0u; round < BENCH_DMA_ROUNDS; round++)
+    {
+        memset(buffer, (int)round, BENCH_DMA_BYTES);
+        placement_dcache_clean(buffer, BENCH_DMA_BYTES);
+    }
+    *write_cycles = profiler_cycles() - start;
+
+    start = profiler_cycles();
+    for (uint32_t round = 0u; round < BENCH_DMA_ROUNDS; round++)
+    {
+        placement_dcache_invalidate(buffer, BENCH_DMA_BYTES);
+        for (uint32_t index = 0u; index < BENCH_DMA_BYTES; index += sizeof(uint32_t))
+        {
+            sum += *(volatile uint32_t *)&buffer[index];
+        }
+    }
+    *read_cycles = profiler_cycles() - start;
+
+    return sum;
+}
+
+/*******************************************************************************
+* Function Name: bench_dma_buffer
+********************************************************************************
+* Summary:
+*  Throughput of the CPU side of DMA transfers, with a cacheable buffer and
+*  with a buffer of the non-cacheable section. Without PLACEMENT both buffers
+*  are cacheable: compare the results of the two builds.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+static cy_rslt_t bench_dma_buffer(void)
+{
+    uint32_t write_cycles;
+    uint32_t read_cycles;
+    uint32_t bytes = BENCH_DMA_BYTES * BENCH_DMA_ROUNDS;
+
+    (void)bench_dma_buffer_pass(bench_dma_cached, &write_cycles, &read_cycles);
+    bench_emit_rate("dma_buffer_cached_write", "B/s", bytes, write_cycles);
+    bench_emit_rate("dma_buffer_cached_read", "B/s", bytes, read_cycles);
+
+    (void)bench_dma_buffer_pass(bench_dma_nocache, &write_cycles, &read_cycles);
+    bench_emit_rate("dma_buffer_nocache_write", "B/s", bytes, write_cycles);
+    bench_emit_rate("dma_buffer_nocache_read", "B/s", bytes, read_cycles);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: bench_adc_sample_rate
+********************************************************************************
+* Summary:
+*  Single conversions per second of the potentiometer channel, read with
+*  cyhal_adc_read_uv() as the SAR ADC demo does.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or the ADC initialization error
+*
+*******************************************************************************/
+static cy_rslt_t bench_adc_sample_rate(void)
+{
+    static const cyhal_adc_channel_config_t channel_config =
+    {
+        .enable_averaging   = false,
+        .min_acquisition_ns = 1000u,
+        .enabled            = true,
+    };
+    cyhal_adc_t adc;
+    cyhal_adc_channel_t channel;
+    volatile int32_t sink = 0;
+    cy_rslt_t result;
+    uint32_t start;
+
+    result = cyhal_adc_init(&adc, CYBSP_POT, NULL);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    result = cyhal_adc_channel_init_diff(&channel, &adc, CYBSP_POT, CYHAL_ADC_VNEG, &channel_config);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        cyhal_adc_free(&adc);
+        return result;
+    }
+
+    start = profiler_cycles();
+    for (uint32_t sample = 0u; sample < BENCH_ADC_SAMPLES; sample++)
+    {
+        sink = cyhal_adc_read_uv(&channel);
+    }
+    bench_emit_rate("adc_sample_rate", "samples/s", BENCH_ADC_SAMPLES, profiler_cycles() - start);
+    (void)sink;
+
+    cyhal_adc_channel_free(&channel);
+    cyhal_adc_free(&adc);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: bench_adc_window
+********************************************************************************
+* Summary:
+*  Alarm latency and CPU load of the SAR window comparator against the
+*  polling loop of the SAR ADC demo.
+*
+*  The window alarm latency is the time from a limit write that puts the
+*  input outside the window to the entry of the range interrupt handler, so
+*  it holds whatever the potentiometer position; the handler cycles of each
+*  alarm are reported too. The idle load is the share of CPU cycles taken by
+*  the handler while the input stays inside the window. For polling, one
+*  cyhal_adc_read_uv() is timed, its load follows from PARAM_ADC_DELAY_MS,
+*  and a crossing is seen up to one delay late, half of it on average.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the ADC initialization error or
+*  BENCH_RSLT_ERR_TIMEOUT
+*
+*******************************************************************************/
+static cy_rslt_t bench_adc_window(void)
+{
+    static const cyhal_adc_channel_config_t channel_config =
+    {
+        .enable_averaging   = false,
+        .min_acquisition_ns = 1000u,
+        .enabled            = true,
+    };
+    const adc_window_channel_t window =
+    {
+        .input = ADC_WINDOW_POT_INPUT,
+        .low   = 0u,
+        .high  = ADC_WINDOW_FULL_SCALE,
+    };
+    uint32_t delay_ms = param_get(PARAM_ADC_DELAY_MS);
+    cyhal_adc_t adc;
+    cyhal_adc_channel_t channel;
+    volatile int32_t sink = 0;
+    adc_window_event_t event;
+    adc_window_stats_t before;
+    adc_window_stats_t after;
+    bench_stat_t read;
+    bench_stat_t latency;
+    bench_stat_t isr;
+    cy_rslt_t result;
+    uint32_t start;
+    uint64_t load;
+
+    /* Polling: cost of one read of the demo loop */
+    result = cyhal_adc_init(&adc, CYBSP_POT, NULL);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    result = cyhal_adc_channel_init_diff(&channel, &adc, CYBSP_POT, CYHAL_ADC_VNEG, &channel_config);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        cyhal_adc_free(&adc);
+        return result;
+    }
+    bench_stat_reset(&read);
+    for (uint32_t sample = 0u; sample < BENCH_ADC_ALARMS; sample++)
+    {
+        start = profiler_cycles();
+        sink = cyhal_adc_read_uv(&channel);
+        bench_stat_add(&read, profiler_cycles() - start);
+    }
+    (void)sink;
+    cyhal_adc_channel_free(&channel);
+    cyhal_adc_free(&adc);
+
+    /* Window: every sample inside, then alarms forced by the limits */
+    result = adc_window_init(&window, 1u);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    bench_stat_reset(&latency);
+    bench_stat_reset(&isr);
+    for (uint32_t alarm = 0u; alarm < BENCH_ADC_ALARMS; alarm++)
+    {
+        adc_window_get_stats(&before);
+        start = profiler_cycles();
+        (void)adc_window_set_limits(0u, ADC_WINDOW_FULL_SCALE, ADC_WINDOW_FULL_SCALE);
+        if (!bench_wait_adc_window(&event))
+        {
+            result = BENCH_RSLT_ERR_TIMEOUT;
+            break;
+        }
+        adc_window_get_stats(&after);
+        bench_stat_add(&latency, event.cycles - start);
+        bench_stat_add(&isr, (uint32_t)(after.isr_cycles - before.isr_cycles));
+        (void)adc_window_set_limits(0u, 0u, ADC_WINDOW_FULL_SCALE);
+    }
+
+    adc_window_get_stats(&before);
+    start = profiler_cycles();
+    Cy_SysLib_Delay(BENCH_ADC_IDLE_MS);
+    adc_window_get_stats(&after);
+    load = ((after.isr_cycles - before.isr_cycles) * 1000000u) / (profiler_cycles() - start);
+
+    adc_window_free();
+    event_flags_clear(&demo_events, EVT_ADC_WINDOW);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        bench_emit_stat("adc_window_latency", "cycles", &latency);
+        bench_emit_stat("adc_window_isr", "cycles", &isr);
+        printf("{\"bench\":\"adc_window_idle_load\",\"platform\":\"%s\",\"unit\":\"ppm\",\"value\":%lu,"
+               "\"interrupts\":%lu}\r\n", BENCH_PLATFORM, (unsigned long)load,
+               (unsigned long)(after.interrupts - before.interrupts));
+        bench_emit_stat("adc_poll_read", "cycles", &read);
+        load = ((read.total / read.count) * 1000000u) / (((uint64_t)SystemCoreClock / 1000u) * delay_ms);
+        printf("{\"bench\":\"adc_poll_load\",\"platform\":\"%s\",\"unit\":\"ppm\",\"value\":%lu,"
+               "\"period_ms\":%lu,\"latency_avg_us\":%lu,\"latency_max_us\":%lu}\r\n", BENCH_PLATFORM,
+               (unsigned long)load, (unsigned long)delay_ms, (unsigned long)(delay_ms * 500u),
+               (unsigned long)(delay_ms * 1000u));
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_adc_pwm_sync
+********************************************************************************
+* Summary:
+*  Delay from the PWM trigger to the group done handler of the potentiometer
+*  conversion, with the SAR started by the trigger multiplexer and by the CC1
+*  interrupt handler. The spread between the minimum and the maximum is the
+*  jitter of the sampling against the PWM.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the initialization error or
+*  BENCH_RSLT_ERR_TIMEOUT
+*
+*******************************************************************************/
+static cy_rslt_t bench_adc_pwm_sync(void)
+{
+    static const char *const names[] = { "adc_pwm_sync_hw", "adc_pwm_sync_sw" };
+    static const cy_en_sar2_pin_address_t inputs[] = { ADC_PWM_SYNC_POT_INPUT };
+    static const adc_pwm_sync_pwm_t pwm = ADC_PWM_SYNC_PWM_DEFAULT;
+    adc_pwm_sync_config_t config =
+    {
+        .frequency_hz  = BENCH_ADC_SYNC_HZ,
+        .duty_permille = 500u,
+        .phase         = PWM_PHASE_FROM_PERMILLE(BENCH_ADC_SYNC_PERMILLE),
+        .inputs        = inputs,
+        .count         = 1u,
+    };
+    adc_pwm_sync_stats_t stats;
+    pwm_phase_t timing;
+    bench_stat_t delay;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    for (uint32_t mode = 0u; (mode < 2u) && (CY_RSLT_SUCCESS == result); mode++)
+    {
+        config.trigger = (0u == mode) ? ADC_PWM_SYNC_TRIGGER_HW : ADC_PWM_SYNC_TRIGGER_SW;
+        result = adc_pwm_sync_init(&pwm, &config);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            break;
+        }
+        Cy_SysLib_Delay(BENCH_ADC_SYNC_MS);
+        adc_pwm_sync_get_stats(&stats, false);
+        adc_pwm_sync_get_timing(&timing);
+        adc_pwm_sync_free();
+
+        if (0u == stats.groups)
+        {
+            result = BENCH_RSLT_ERR_TIMEOUT;
+            break;
+        }
+        delay.count = stats.groups;
+        delay.min = pwm_phase_counts_to_ns(&timing, stats.delay_min);
+        delay.max = pwm_phase_counts_to_ns(&timing, stats.delay_max);
+        delay.total = (uint64_t)pwm_phase_counts_to_ns(&timing, (uint32_t)(stats.delay_total / stats.groups)) *
+                      stats.groups;
+        bench_emit_stat(names[mode], "ns", &delay);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_adc_scope
+********************************************************************************
+* Summary:
+*  Sample rate of the scope capture of the SAR ADC demo, measured over one
+*  capture of the potentiometer, and the cost of the rest of the path to
+*  the console: the trigger engine per sample, fed the captured block again
+*  with a rising trigger, and the encoding of the block into a frame, which
+*  must decode back to the same samples.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the initialization error,
+*  BENCH_RSLT_ERR_TIMEOUT or BENCH_RSLT_ERR_MISMATCH
+*
+*******************************************************************************/
+static cy_rslt_t bench_adc_scope(void)
+{
+    static uint16_t samples[ADC_SCOPE_SAMPLES];
+    static uint16_t decoded[ADC_SCOPE_SAMPLES];
+    static uint16_t ring[ADC_SCOPE_SAMPLES];
+    static uint8_t frame[SCOPE_FRAME_SIZE(ADC_SCOPE_SAMPLES)];
+    const adc_scope_config_t config =
+    {
+        .input   = ADC_SCOPE_POT_INPUT,
+        .trigger =
+        {
+            .mode = SCOPE_TRIGGER_NONE,
+            .pre  = BENCH_ADC_SCOPE_PRE,
+            .post = ADC_SCOPE_SAMPLES - BENCH_ADC_SCOPE_PRE,
+        },
+    };
+    scope_trigger_config_t replay = config.trigger;
+    scope_frame_header_t header = { .mode = (uint8_t)SCOPE_TRIGGER_RISING };
+    scope_frame_header_t check;
+    adc_scope_capture_t capture;
+    scope_trigger_t trigger;
+    uint32_t waited_ms = 0u;
+    uint32_t length;
+    uint32_t used;
+    uint32_t start;
+    cy_rslt_t result;
+
+    event_flags_clear(&demo_events, EVT_ADC_SCOPE);
+    result = adc_scope_init(&config);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    adc_scope_arm();
+    while ((0u == event_flags_take(&demo_events, EVT_ADC_SCOPE)) && (waited_ms < BENCH_ADC_SCOPE_TIMEOUT_MS))
+    {
+        Cy_SysLib_Delay(1u);
+        waited_ms++;
+    }
+    if (!adc_scope_read(&capture, samples) || (0u == capture.period_ns))
+    {
+        adc_scope_free();
+        return BENCH_RSLT_ERR_TIMEOUT;
+    }
+    adc_scope_free();
+    printf("{\"bench\":\"adc_scope_sample_rate\",\"platform\":\"%s\",\"unit\":\"samples/s\",\"value\":%lu,"
+           "\"period_ns\":%lu}\r\n", BENCH_PLATFORM, (unsigned long)(1000000000u / capture.period_ns),
+           (unsigned long)capture.period_ns);
+
+    /* Rising trigger just above the first sample, so that the edge detection
+     * runs on the samples of a still potentiometer */
+    replay.mode = SCOPE_TRIGGER_RISING;
+    replay.level = (uint16_t)(samples[0] + 1u);
+    (void)scope_trigger_init(&trigger, &replay, ring, ADC_SCOPE_SAMPLES);
+    scope_trigger_arm(&trigger);
+    start = profiler_cycles();
+    for (uint32_t index = 0u; index < capture.samples; index++)
+    {
+        (void)scope_trigger_feed(&trigger, samples[index]);
+    }
+    bench_emit_rate("adc_scope_trigger", "samples/s", capture.samples, profiler_cycles() - start);
+
+    header.samples = (uint16_t)capture.samples;
+    header.trigger_index = (uint16_t)capture.trigger_index;
+    header.period_ns = capture.period_ns;
+    start = profiler_cycles();
+    length = scope_frame_encode(&header, samples, frame, sizeof(frame));
+    bench_emit_rate("adc_scope_encode", "B/s", length, profiler_cycles() - start);
+
+    if ((SCOPE_FRAME_OK != scope_frame_decode(frame, length, &check, decoded, &used)) || (used != length) ||
+        (0 != memcmp(samples, decoded, capture.samples * sizeof(samples[0]))))
+    {
+        result = BENCH_RSLT_ERR_MISMATCH;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_edge_stats
+********************************************************************************
+* Summary:
+*  Reduction rate of the edge statistics of the GPIO edge capture, on
+*  generated periods whose timestamps wrap. The result must match a plain
+*  loop over the periods.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or BENCH_RSLT_ERR_MISMATCH
+*
+*******************************************************************************/
+static cy_rslt_t bench_edge_stats(void)
+{
+    static uint32_t rise[BENCH_EDGE_PERIODS];
+    static uint32_t fall[BENCH_EDGE_PERIODS];
+    static uint32_t next[BENCH_EDGE_PERIODS];
+    edge_stats_t stats;
+    edge_stats_t check;
+    uint32_t time = 0u - (BENCH_EDGE_PERIODS * BENCH_EDGE_PERIOD_TICKS / 2u);
+    uint32_t seed = 1u;
+    uint32_t cycles = 0u;
+    uint32_t start;
+
+    for (uint32_t index = 0u; index < BENCH_EDGE_PERIODS; index++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        rise[index] = time;
+        fall[index] = time + BENCH_EDGE_HIGH_TICKS + ((seed >> 16) % BENCH_EDGE_JITTER_TICKS);
+        time += BENCH_EDGE_PERIOD_TICKS + ((seed >> 24) % BENCH_EDGE_JITTER_TICKS) - (BENCH_EDGE_JITTER_TICKS / 2u);
+        next[index] = time;
+    }
+
+    for (uint32_t round = 0u; round < BENCH_EDGE_ROUNDS; round++)
+    {
+        edge_stats_reset(&stats);
+        start = profiler_cycles();
+        edge_stats_add(&stats, rise, fall, next, BENCH_EDGE_PERIODS);
+        cycles += profiler_cycles() - start;
+    }
+    bench_emit_rate("edge_stats", "periods/s", BENCH_EDGE_PERIODS * BENCH_EDGE_ROUNDS, cycles);
+
+    edge_stats_reset(&check);
+    for (uint32_t index = 0u; index < BENCH_EDGE_PERIODS; index++)
+    {
+        uint32_t high = fall[index] - rise[index];
+        uint32_t period = next[index] - rise[index];
+
+        if (high < check.high_min)
+        {
+            check.high_min = high;
+        }
+        if (high > check.high_max)
+        {
+            check.high_max = high;
+        }
+        if (period < check.period_min)
+        {
+            check.period_min = period;
+        }
+        if (period > check.period_max)
+        {
+            check.period_max = period;
+        }
+        check.high_total += high;
+        check.period_total += period;
+        check.periods++;
+    }
+
+    if ((stats.periods != check.periods) || (stats.high_min != check.high_min) ||
+        (stats.high_max != check.high_max) || (stats.high_total != check.high_total) ||
+        (stats.period_min != check.period_min) || (stats.period_max != check.period_max) ||
+        (stats.period_total != check.period_total))
+    {
+        return BENCH_RSLT_ERR_MISMATCH;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: bench_console_fmt
+********************************************************************************
+* Summary:
+*  Cycles per call of the formatted output of the console hot paths: the
+*  snprintf() of the C library, the integer-only formatter and its fast
+*  paths, on the SAR ADC reading and on a byte of the QSPI hex dump. The
+*  three must produce the same text.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or BENCH_RSLT_ERR_MISMATCH
+*
+*******************************************************************************/
+static cy_rslt_t bench_console_fmt(void)
+{
+    char expected[BENCH_FMT_LINE_SIZE];
+    char line[BENCH_FMT_LINE_SIZE];
+    bench_stat_t libc;
+    bench_stat_t fmt;
+    bench_stat_t fast;
+    uint32_t start;
+    uint32_t length;
+    bool same = true;
+
+    bench_stat_reset(&libc);
+    bench_stat_reset(&fmt);
+    bench_stat_reset(&fast);
+    for (uint32_t call = 0u; call < BENCH_FMT_CALLS; call++)
+    {
+        int32_t millivolts = (int32_t)(call * 53u) - 200;
+
+        start = profiler_cycles();
+        (void)snprintf(expected, sizeof(expected), "Channel 0 input: %4ldmV", (long)millivolts);
+        bench_stat_add(&libc, profiler_cycles() - start);
+
+        start = profiler_cycles();
+        (void)console_fmt_snprintf(line, sizeof(line), "Channel 0 input: %4ldmV", (long)millivolts);
+        bench_stat_add(&fmt, profiler_cycles() - start);
+        same = same && (0 == strcmp(line, expected));
+
+        start = profiler_cycles();
+        memcpy(line, "Channel 0 input: ", 17u);
+        length = 17u + console_fmt_dec(&line[17], millivolts, 4u);
+        memcpy(&line[length], "mV", 3u);
+        bench_stat_add(&fast, profiler_cycles() - start);
+        same = same && (0 == strcmp(line, expected));
+    }
+    bench_emit_stat("console_fmt_adc_libc", "cycles", &libc);
+    bench_emit_stat("console_fmt_adc", "cycles", &fmt);
+    bench_emit_stat("console_fmt_adc_fast", "cycles", &fast);
+
+    bench_stat_reset(&libc);
+    bench_stat_reset(&fmt);
+    bench_stat_reset(&fast);
+    for (uint32_t call = 0u; call < BENCH_FMT_CALLS; call++)
+    {
+        uint8_t byte = (uint8_t)(call * 37u);
+
+        start = profiler_cycles();
+        (void)snprintf(expected, sizeof(expected), "0x%02X ", byte);
+        bench_stat_add(&libc, profiler_cycles() - start);
+
+        start = profiler_cycles();
+        (void)console_fmt_snprintf(line, sizeof(line), "0x%02X ", byte);
+        bench_stat_add(&fmt, profiler_cycles() - start);
+        same = same && (0 == strcmp(line, expected));
+
+        start = profiler_cycles();
+        line[0] = '0';
+        line[1] = 'x';
+        length = 2u + console_fmt_hex(&line[2], byte, 2u, true);
+        line[length++] = ' ';
+        line[length] = '\0';
+        bench_stat_add(&fast, profiler_cycles() - start);
+        same = same && (0 == strcmp(line, expected));
+    }
+    bench_emit_stat("console_fmt_hex_libc", "cycles", &libc);
+    bench_emit_stat("console_fmt_hex", "cycles", &fmt);
+    bench_emit_stat("console_fmt_hex_fast", "cycles", &fast);
+
+    return same ? CY_RSLT_SUCCESS : BENCH_RSLT_ERR_MISMATCH;
+}
+
+/*******************************************************************************
+* Function Name: bench_qspi
+********************************************************************************
+* Summary:
+*  Erase, program and read bandwidth of the QSPI memory, in the sector that
+*  the QSPI demo uses. The data read back is compared with the data written.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the serial flash error or
+*  BENCH_RSLT_ERR_MISMATCH
+*
+*******************************************************************************/
+static cy_rslt_t bench_qspi(void)
+{
+    const cy_stc_smif_mem_device_cfg_t *device = smifMemConfigs[BENCH_QSPI_SLOT]->deviceCfg;
+    uint32_t address = (device->memSize / 2u) - (device->eraseSize * 2u);
+    uint32_t sector;
+    uint32_t start;
+    cy_rslt_t result;
+
+    result = cy_serial_flash_qspi_init(smifMemConfigs[BENCH_QSPI_SLOT],
+            CYBSP_QSPI_D0, CYBSP_QSPI_D1, CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC,
+            NC, NC, CYBSP_QSPI_SCK, CYBSP_QSPI_SS, BENCH_QSPI_FREQUENCY_HZ);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    sector = (uint32_t)cy_serial_flash_qspi_get_erase_size(address);
+
+    for (uint32_t index = 0u; index < BENCH_QSPI_BYTES; index++)
+    {
+        bench_qspi_tx[index] = (uint8_t)(index ^ (index >> 8));
+    }
+
+    start = profiler_cycles();
+    result = cy_serial_flash_qspi_erase(address, sector);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        bench_emit_rate("qspi_erase", "B/s", sector, profiler_cycles() - start);
+
+        start = profiler_cycles();
+        result = cy_serial_flash_qspi_write(address, BENCH_QSPI_BYTES, bench_qspi_tx);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        bench_emit_rate("qspi_program", "B/s", BENCH_QSPI_BYTES, profiler_cycles() - start);
+
+        start = profiler_cycles();
+        result = cy_serial_flash_qspi_read(address, BENCH_QSPI_BYTES, bench_qspi_rx);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        bench_emit_rate("qspi_read", "B/s", BENCH_QSPI_BYTES, profiler_cycles() - start);
+
+        if (0 != memcmp(bench_qspi_tx, bench_qspi_rx, BENCH_QSPI_BYTES))
+        {
+            result = BENCH_RSLT_ERR_MISMATCH;
+        }
+    }
+
+    cy_serial_flash_qspi_deinit();
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_canfd_loopback
+********************************************************************************
+* Summary:
+*  Frames per second through the CAN FD channel of the demo in internal
+*  loop-back mode: each frame is sent once the previous one is received, so
+*  the result includes the transmit call, the bus time and the interrupt.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the CAN FD driver error,
+*  BENCH_RSLT_ERR_TIMEOUT or BENCH_RSLT_ERR_MISMATCH
+*
+*******************************************************************************/
+static cy_rslt_t bench_canfd_loopback(void)
+{
+    cy_stc_canfd_config_t config = CANFD_config;
+    cy_stc_canfd_t0_t t0 = *CANFD_txBuffer_0.t0_f;
+    cy_stc_canfd_t1_t t1 = *CANFD_txBuffer_0.t1_f;
+    uint32_t data[CY_CANFD_DATA_ELEMENTS_MAX / sizeof(uint32_t)] = { 0u };
+    cy_stc_canfd_tx_buffer_t tx_buffer = { &t0, &t1, data };
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_en_canfd_status_t status;
+    uint32_t start;
+
+    config.rxCallback = bench_canfd_rx;
+    t0.id = BENCH_CANFD_ID;
+    t1.dlc = BENCH_CANFD_DLC;
+
+    (void)Cy_SysInt_Init(&bench_canfd_irq_cfg, &bench_canfd_isr);
+    NVIC_EnableIRQ(NvicMux2_IRQn);
+
+    status = Cy_CANFD_Init(CANFD_HW, CAN_HW_CHANNEL, &config, &bench_canfd_context);
+    if (CY_CANFD_SUCCESS != status)
+    {
+        return (cy_rslt_t)status;
+    }
+    (void)Cy_CANFD_ConfigChangesEnable(CANFD_HW, CAN_HW_CHANNEL);
+    Cy_CANFD_TestModeConfig(CANFD_HW, CAN_HW_CHANNEL, CY_CANFD_TEST_MODE_INTERNAL_LOOP_BACK);
+    (void)Cy_CANFD_ConfigChangesDisable(CANFD_HW, CAN_HW_CHANNEL);
+
+    start = profiler_cycles();
+    for (uint32_t frame = 0u; frame < BENCH_CANFD_FRAMES; frame++)
+    {
+        data[0] = frame;
+        bench_canfd_flag = false;
+        status = Cy_CANFD_UpdateAndTransmitMsgBuffer(CANFD_HW, CAN_HW_CHANNEL, &tx_buffer,
+                                                     BENCH_CANFD_BUFFER_INDEX, &bench_canfd_context);
+        if (CY_CANFD_SUCCESS != status)
+        {
+            result = (cy_rslt_t)status;
+            break;
+        }
+        if (!bench_wait(&bench_canfd_flag))
+        {
+            result = BENCH_RSLT_ERR_TIMEOUT;
+            break;
+        }
+        if (frame != bench_canfd_sequence)
+        {
+            result = BENCH_RSLT_ERR_MISMATCH;
+            break;
+        }
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        bench_emit_rate("canfd_loopback", "frames/s", BENCH_CANFD_FRAMES, profiler_cycles() - start);
+    }
+
+    (void)Cy_CANFD_DeInit(CANFD_HW, CAN_HW_CHANNEL, &bench_canfd_context);
+    NVIC_DisableIRQ(NvicMux2_IRQn);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_power_modes
+********************************************************************************
+* Summary:
+*  Sleep and DeepSleep transition times, measured by the transition profiler
+*  over BENCH_PM_CYCLES transitions of each mode. A low-power timer, which
+*  keeps running in DeepSleep, ends each transition.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the low-power timer or profiler error, or
+*  BENCH_RSLT_ERR_TIMEOUT if a transition was rejected every time
+*
+*******************************************************************************/
+static cy_rslt_t bench_power_modes(void)
+{
+    static const char * const names[PM_PROF_STATE_NUM][2] =
+    {
+        { "pm_sleep_entry",     "pm_sleep_exit" },
+        { "pm_deepsleep_entry", "pm_deepsleep_exit" },
+    };
+    cyhal_lptimer_t lptimer;
+    cyhal_lptimer_info_t info;
+    cy_rslt_t result;
+    uint32_t delay;
+
+    (void)cyhal_syspm_init();
+    result = power_manager_init();
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    result = cyhal_lptimer_init(&lptimer);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        power_manager_free();
+        return result;
+    }
+    cyhal_lptimer_get_info(&lptimer, &info);
+    delay = (uint32_t)(((uint64_t)BENCH_PM_WAKE_US * info.frequency_hz) / 1000000u);
+    cyhal_lptimer_register_callback(&lptimer, bench_lptimer_handler, NULL);
+    cyhal_lptimer_enable_event(&lptimer, CYHAL_LPTIMER_COMPARE_MATCH, BENCH_INTR_PRIORITY, true);
+
+    pm_profiler_reset();
+    for (uint32_t state = 0u; state < (uint32_t)PM_PROF_STATE_NUM; state++)
+    {
+        for (uint32_t cycle = 0u; cycle < BENCH_PM_CYCLES; cycle++)
+        {
+            bench_lptimer_flag = false;
+            (void)cyhal_lptimer_set_delay(&lptimer, delay);
+
+            /* Other interrupts may end the transition early, only the one
+             * ended by the timer is a sample */
+            while (!bench_lptimer_flag)
+            {
+                pm_profiler_hold();
+                if (PM_PROF_STATE_SLEEP == (pm_prof_state_t)state)
+                {
+                    (void)power_manager_sleep();
+                }
+                else
+                {
+                    (void)power_manager_deepsleep();
+                }
+                pm_profiler_release(bench_lptimer_flag);
+            }
+        }
+    }
+
+    for (uint32_t state = 0u; state < (uint32_t)PM_PROF_STATE_NUM; state++)
+    {
+        const pm_prof_result_t *profile = pm_profiler_get_result((pm_prof_state_t)state);
+
+        if (0u == profile->entry.count)
+        {
+            result = BENCH_RSLT_ERR_TIMEOUT;
+            continue;
+        }
+        bench_emit_pm(names[state][0], &profile->entry);
+        bench_emit_pm(names[state][1], &profile->exit);
+    }
+
+    cyhal_lptimer_enable_event(&lptimer, CYHAL_LPTIMER_COMPARE_MATCH, BENCH_INTR_PRIORITY, false);
+    cyhal_lptimer_free(&lptimer);
+    power_manager_free();
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_event_flags
+********************************************************************************
+* Summary:
+*  Race check and throughput of the event-flag group. The producers post
+*  while the main loop takes their bits and sets and clears a bit of its own;
+*  a post lost by a torn read-modify-write shows up as a count mismatch.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the timer initialization error,
+*  BENCH_RSLT_ERR_TIMEOUT or BENCH_RSLT_ERR_MISMATCH
+*
+*******************************************************************************/
+static cy_rslt_t bench_event_flags(void)
+{
+    const uint32_t producer_mask = (1UL << BENCH_EVENT_PRODUCERS) - 1u;
+    uint32_t taken[BENCH_EVENT_PRODUCERS] = { 0u };
+    uint32_t timeout = (SystemCoreClock / 1000u) * BENCH_EVENT_TIMEOUT_MS;
+    uint32_t total = 0u;
+    uint32_t start;
+    uint32_t bits;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+#if defined(__arm__)
+    cyhal_timer_t timer;
+    const cyhal_timer_cfg_t timer_cfg =
+    {
+        .compare_value = 0u,
+        .period = BENCH_EVENT_TIMER_PERIOD,
+        .direction = CYHAL_TIMER_DIR_UP,
+        .is_compare = false,
+        .is_continuous = true,
+        .value = 0u
+    };
+#else
+    pthread_t threads[BENCH_EVENT_PRODUCERS];
+#endif /* defined(__arm__) */
+
+    (void)event_flags_clear(&bench_events, 0xFFFFFFFFu);
+    memset((void *)bench_event_posted, 0, sizeof(bench_event_posted));
+    bench_event_sets = 0u;
+    bench_event_done = 0u;
+    bench_event_stop = false;
+
+    start = profiler_cycles();
+#if defined(__arm__)
+    result = cyhal_timer_init(&timer, NC, NULL);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    (void)cyhal_timer_configure(&timer, &timer_cfg);
+    (void)cyhal_timer_set_frequency(&timer, BENCH_EVENT_TIMER_HZ);
+    cyhal_timer_register_callback(&timer, bench_event_timer_handler, NULL);
+    cyhal_timer_enable_event(&timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, BENCH_INTR_PRIORITY, true);
+    (void)cyhal_timer_start(&timer);
+#else
+    for (uint32_t producer = 0u; producer < BENCH_EVENT_PRODUCERS; producer++)
+    {
+        (void)pthread_create(&threads[producer], NULL, bench_event_thread, (void *)(uintptr_t)producer);
+    }
+#endif /* defined(__arm__) */
+
+    /* Take until the producers are done, then once more for the last posts */
+    do
+    {
+        bits = event_flags_take(&bench_events, producer_mask);
+        if (0u == bits)
+        {
+            __NOP();
+        }
+        for (uint32_t producer = 0u; producer < BENCH_EVENT_PRODUCERS; producer++)
+        {
+            if (0u != (bits & (1UL << producer)))
+            {
+                taken[producer]++;
+                total++;
+            }
+        }
+        (void)event_flags_set(&bench_events, BENCH_EVENT_MAIN_BIT);
+        (void)event_flags_clear(&bench_events, BENCH_EVENT_MAIN_BIT);
+
+        if ((profiler_cycles() - start) > timeout)
+        {
+            /* A lost post leaves its producer waiting for the take */
+            result = BENCH_RSLT_ERR_TIMEOUT;
+            bench_event_stop = true;
+            break;
+        }
+    } while ((BENCH_EVENT_PRODUCERS != bench_event_done) || (0u != event_flags_test(&bench_events, producer_mask)));
+
+#if defined(__arm__)
+    cyhal_timer_free(&timer);
+#else
+    for (uint32_t producer = 0u; producer < BENCH_EVENT_PRODUCERS; producer++)
+    {
+        (void)pthread_join(threads[producer], NULL);
+    }
+#endif /* defined(__arm__) */
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    for (uint32_t producer = 0u; producer < BENCH_EVENT_PRODUCERS; producer++)
+    {
+        if (taken[producer] != bench_event_posted[producer])
+        {
+            printf("{\"bench\":\"event_flags\",\"platform\":\"%s\",\"bit\":%lu,\"posted\":%lu,\"taken\":%lu}\r\n",
+                   BENCH_PLATFORM, (unsigned long)producer, (unsigned long)bench_event_posted[producer],
+                   (unsigned long)taken[producer]);
+            result = BENCH_RSLT_ERR_MISMATCH;
+        }
+    }
+
+    bench_emit_rate("event_flags", "events/s", total, profiler_cycles() - start);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_param_snapshot
+********************************************************************************
+* Summary:
+*  Round trip of the parameter snapshot. Every parameter is set to its
+*  maximum, the press counts kept increasing, serialized and read back; a
+*  corrupted snapshot and an out-of-range value must be rejected. The cost
+*  of the deserialize is the boot time of the snapshot without the flash
+*  read.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or BENCH_RSLT_ERR_MISMATCH
+*
+*******************************************************************************/
+static cy_rslt_t bench_param_snapshot(void)
+{
+    uint8_t snapshot[PARAM_SNAPSHOT_MAX_SIZE];
+    uint32_t values[PARAM_NUM];
+    uint32_t loaded[PARAM_NUM];
+    uint32_t length;
+    uint32_t start;
+    bench_stat_t stat;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        values[index] = param_get_desc((param_id_t)index)->max;
+    }
+    values[PARAM_QUICK_PRESS_COUNT] -= 2u;
+    values[PARAM_SHORT_PRESS_COUNT] -= 1u;
+    values[PARAM_ADC_WINDOW_LOW_MV] -= 1u;
+
+    length = param_serialize(values, snapshot, sizeof(snapshot));
+    bench_stat_reset(&stat);
+    for (uint32_t round = 0u; round < BENCH_PARAM_ROUNDS; round++)
+    {
+        memset(loaded, 0, sizeof(loaded));
+        start = profiler_cycles();
+        if ((CY_RSLT_SUCCESS != param_deserialize(snapshot, length, loaded)) ||
+            (0 != memcmp(values, loaded, sizeof(values))))
+        {
+            result = BENCH_RSLT_ERR_MISMATCH;
+        }
+        bench_stat_add(&stat, profiler_cycles() - start);
+    }
+
+    /* A flipped payload bit fails the CRC */
+    snapshot[PARAM_SNAPSHOT_HEADER_SIZE] ^= 0x01u;
+    if (PARAM_RSLT_ERR_SNAPSHOT != param_deserialize(snapshot, length, loaded))
+    {
+        result = BENCH_RSLT_ERR_MISMATCH;
+    }
+
+    /* A value past its maximum is rejected */
+    values[PARAM_CAN_DLC]++;
+    if (PARAM_RSLT_ERR_RANGE != param_validate(values))
+    {
+        result = BENCH_RSLT_ERR_MISMATCH;
+    }
+
+    printf("{\"bench\":\"param_snapshot_size\",\"platform\":\"%s\",\"unit\":\"B\",\"value\":%lu}\r\n",
+           BENCH_PLATFORM, (unsigned long)length);
+    bench_emit_stat("param_snapshot_load", "cycles", &stat);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_wait
+********************************************************************************
+* Summary:
+*  Waits for a flag set by an interrupt, at most BENCH_TIMEOUT_MS.
+*
+* Parameters:
+*  flag: flag to wait for
+*
+* Return:
+*  bool: true if the flag was set in time
+*
+*******************************************************************************/
+static bool bench_wait(volatile bool *flag)
+{
+    uint32_t timeout = (SystemCoreClock / 1000u) * BENCH_TIMEOUT_MS;
+    uint32_t start = profiler_cycles();
+
+    while (!*flag)
+    {
+        if ((profiler_cycles() - start) > timeout)
+        {
+            return false;
+        }
+        __NOP();
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: bench_stat_reset
+********************************************************************************
+* Summary:
+*  Empties a minimum/average/maximum statistic before a series of samples.
+*
+* Parameters:
+*  stat: statistic
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_stat_reset(bench_stat_t *stat)
+{
+    stat->count = 0u;
+    stat->min = UINT32_MAX;
+    stat->max = 0u;
+    stat->total = 0u;
+}
+
+/*******************************************************************************
+* Function Name: bench_stat_add
+********************************************************************************
+* Summary:
+*  Adds a sample to a minimum/average/maximum statistic.
+*
+* Parameters:
+*  stat: statistic
+*  value: sample
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_stat_add(bench_stat_t *stat, uint32_t value)
+{
+    stat->count++;
+    stat->total += value;
+    if (value < stat->min)
+    {
+        stat->min = value;
+    }
+    if (value > stat->max)
+    {
+        stat->max = value;
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_emit_rate
+********************************************************************************
+* Summary:
+*  Prints the result line of a throughput benchmark.
+*
+* Parameters:
+*  name: benchmark name
+*  unit: unit of the rate, per second
+*  amount: bytes, samples or frames processed
+*  cycles: CPU cycles taken
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_emit_rate(const char *name, const char *unit, uint32_t amount, uint32_t cycles)
+{
+    uint64_t rate = (0u != cycles) ? (((uint64_t)amount * SystemCoreClock) / cycles) : 0u;
+
+    printf("{\"bench\":\"%s\",\"platform\":\"%s\",\"unit\":\"%s\",\"value\":%lu,\"n\":%lu,\"cycles\":%lu}\r\n",
+           name, BENCH_PLATFORM, unit, (unsigned long)rate, (unsigned long)amount, (unsigned long)cycles);
+}
+
+/*******************************************************************************
+* Function Name: bench_emit_stat
+********************************************************************************
+* Summary:
+*  Prints the result line of a latency benchmark.
+*
+* Parameters:
+*  name: benchmark name
+*  unit: unit of the measurements
+*  stat: measurements
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_emit_stat(const char *name, const char *unit, const bench_stat_t *stat)
+{
+    uint32_t avg = (0u != stat->count) ? (uint32_t)(stat->total / stat->count) : 0u;
+    uint32_t min = (0u != stat->count) ? stat->min : 0u;
+
+    printf("{\"bench\":\"%s\",\"platform\":\"%s\",\"unit\":\"%s\",\"n\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu}\r\n",
+           name, BENCH_PLATFORM, unit, (unsigned long)stat->count, (unsigned long)min,
+           (unsigned long)avg, (unsigned long)stat->max);
+}
+
+/*******************************************************************************
+* Function Name: bench_emit_pm
+********************************************************************************
+* Summary:
+*  Prints the result line of a transition profiler metric, in microseconds.
+*
+* Parameters:
+*  name: benchmark name
+*  stat: metric, in low-power counter ticks
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_emit_pm(const char *name, const pm_prof_stat_t *stat)
+{
+    bench_stat_t us;
+
+    bench_stat_reset(&us);
+    if (0u != stat->count)
+    {
+        us.count = stat->count;
+        us.min = pm_profiler_ticks_to_us(stat->min);
+        us.max = pm_profiler_ticks_to_us(stat->max);
+        us.total = (uint64_t)pm_profiler_ticks_to_us((uint32_t)(stat->sum / stat->count)) * stat->count;
+    }
+    bench_emit_stat(name, "us", &us);
+}
+
+/*******************************************************************************
+* Function Name: bench_gpio_handler
+********************************************************************************
+* Summary:
+*  GPIO callback of the latency benchmark: stamps its entry.
+*
+* Parameters:
+*  handler_arg: unused
+*  event: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void bench_gpio_handler(void *handler_arg, cyhal_gpio_event_t event)
+{
+    bench_gpio_stamp = profiler_cycles();
+    bench_gpio_flag = true;
+    (void)handler_arg;
+    (void)event;
+}
+
+/*******************************************************************************
+* Function Name: bench_canfd_isr
+********************************************************************************
+* Summary:
+*  Interrupt handler of the CAN FD channel in the loop-back benchmark: runs the
+*  PDL handler, which calls bench_canfd_rx() for each received frame.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_canfd_isr(void)
+{
+    Cy_CANFD_IrqHandler(CANFD_HW, CAN_HW_CHANNEL, &bench_canfd_context);
+}
+
+/*******************************************************************************
+* Function Name: bench_canfd_rx
+********************************************************************************
+* Summary:
+*  CAN FD reception callback of the loop-back benchmark.
+*
+* Parameters:
+*  rxFIFOMsg: message was received in an Rx FIFO
+*  msgBufOrRxFIFONum: unused
+*  basemsg: received message
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_canfd_rx(bool rxFIFOMsg, uint8_t msgBufOrRxFIFONum,
+                           cy_stc_canfd_rx_buffer_t *basemsg)
+{
+    (void)rxFIFOMsg;
+    (void)msgBufOrRxFIFONum;
+
+    if (BENCH_CANFD_ID == basemsg->r0_f->id)
+    {
+        bench_canfd_sequence = basemsg->data_area_f[0];
+        bench_canfd_flag = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_lptimer_handler
+********************************************************************************
+* Summary:
+*  Low-power timer callback of the Sleep and DeepSleep benchmark: flags the end
+*  of a timed transition.
+*
+* Parameters:
+*  callback_arg: unused
+*  event: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_lptimer_handler(void *callback_arg, cyhal_lptimer_event_t event)
+{
+    (void)callback_arg;
+    (void)event;
+    bench_lptimer_flag = true;
+}
+
+/*******************************************************************************
+* Function Name: bench_event_post
+********************************************************************************
+* Summary:
+*  Posts the bit of a producer and counts the posts that found it clear,
+*  which the main loop must take one by one.
+*
+* Parameters:
+*  producer: index of the producer bit
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void bench_event_post(uint32_t producer)
+{
+    uint32_t bit = 1UL << producer;
+
+    if (0u == (event_flags_set(&bench_events, bit) & bit))
+    {
+        bench_event_posted[producer]++;
+    }
+}
+
+#if defined(__arm__)
+/*******************************************************************************
+* Function Name: bench_event_timer_handler
+********************************************************************************
+* Summary:
+*  Timer interrupt of the event flags benchmark on the target: posts the bit of
+*  the next producer at each tick, in turn, until all posts are done.
+*
+* Parameters:
+*  callback_arg: unused
+*  event: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_event_timer_handler(void *callback_arg, cyhal_timer_event_t event)
+{
+    uint32_t sets = bench_event_sets;
+
+    (void)callback_arg;
+    (void)event;
+
+    if (sets < BENCH_EVENT_POSTS)
+    {
+        bench_event_post(sets % BENCH_EVENT_PRODUCERS);
+        bench_event_sets = sets + 1u;
+    }
+    else
+    {
+        bench_event_done = BENCH_EVENT_PRODUCERS;
+    }
+}
+#else
+/*******************************************************************************
+* Function Name: bench_event_thread
+********************************************************************************
+* Summary:
+*  Host producer of the event flags benchmark: a thread plays the interrupt
+*  handler of one bit. It posts again only once the bit was taken, so that no
+*  post merges with the previous one.
+*
+* Parameters:
+*  arg: producer number, 0 to BENCH_EVENT_PRODUCERS - 1
+*
+* Return:
+*  void *: NULL
+*
+*******************************************************************************/
+static void *bench_event_thread(void *arg)
+{
+    uint32_t producer = (uint32_t)(uintptr_t)arg;
+
+    for (uint32_t post = 0u; (post < (BENCH_EVENT_POSTS / BENCH_EVENT_PRODUCERS)) && !bench_event_stop; post++)
+    {
+        bench_event_post(producer);
+        while ((0u != event_flags_test(&bench_events, 1UL << producer)) && !bench_event_stop)
+        {
+            __NOP();
+        }
+    }
+    (void)__atomic_add_fetch(&bench_event_done, 1u, __ATOMIC_SEQ_CST);
+
+    return NULL;
+}
+#endif /* defined(__arm__) */
+
+/* [] END OF FILE */
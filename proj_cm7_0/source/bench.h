@@ -0,0 +1,68 @@
+/******************************************************************************
+* File Name:   bench.h
+*
+* Description: Benchmark suite of CM7_0. Built with BENCH=1, it runs once
+*              instead of the demos and prints one JSON object per line on the
+*              console, then returns from main(). The same suite runs on the
+*              host simulation.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Benchmark build switch, set by the BENCH make variable */
+#ifndef BENCH
+#define BENCH                       (0)
+#endif
+
+/* A benchmark did not see the expected interrupt in time */
+#define BENCH_RSLT_ERR_TIMEOUT      (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x10u))
+/* Data read back differs from the data written */
+#define BENCH_RSLT_ERR_MISMATCH     (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x11u))
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern int bench_run(void);
+
+#endif
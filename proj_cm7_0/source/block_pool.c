@@ -0,0 +1,446 @@
+/******************************************************************************
+* File Name:   block_pool.c
+*
+* Description: Fixed-size block pools and block queues (block_pool.h).
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "block_pool.h"
+#if defined(__arm__)
+#include "placement.h"
+#else
+#define PLACE_ITCM
+#endif
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Link of a block that is in the free list, next to the index + 1 of the
+ * following free block */
+#define BLOCK_POOL_FREE_MARK        (0x8000u)
+#define BLOCK_POOL_LINK_MASK        (0x7FFFu)
+
+#if defined(__arm__)
+/* Orders the block contents against the free list and queue updates */
+#define BLOCK_POOL_BARRIER()        __DMB()
+#define BLOCK_POOL_LINK_GET(pool, i)        ((pool)->links[(i)])
+#define BLOCK_POOL_LINK_SET(pool, i, link)  ((pool)->links[(i)] = (uint16_t)(link))
+#else
+#define BLOCK_POOL_BARRIER()        __atomic_thread_fence(__ATOMIC_SEQ_CST)
+/* A link may be read by a thread that then loses the compare-and-swap */
+#define BLOCK_POOL_LINK_GET(pool, i)        __atomic_load_n(&(pool)->links[(i)], __ATOMIC_RELAXED)
+#define BLOCK_POOL_LINK_SET(pool, i, link)  __atomic_store_n(&(pool)->links[(i)], (uint16_t)(link), __ATOMIC_RELAXED)
+/* Change count of the host head */
+#define BLOCK_POOL_TAG_ONE          ((block_pool_head_t)1u << 32)
+#endif /* defined(__arm__) */
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static inline uint32_t block_pool_add(volatile uint32_t *counter, uint32_t delta);
+static inline void block_pool_max(volatile uint32_t *peak, uint32_t value);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Pools initialized so far, for the statistics */
+static block_pool_t *block_pool_list = NULL;
+
+
+/*******************************************************************************
+* Function Name: block_pool_add
+********************************************************************************
+* Summary:
+*  Adds to a statistics counter atomically.
+*
+* Parameters:
+*  counter: counter of a pool
+*  delta: value to add, (uint32_t)-1 to subtract one
+*
+* Return:
+*  uint32_t: the counter after the update
+*
+*******************************************************************************/
+static inline uint32_t block_pool_add(volatile uint32_t *counter, uint32_t delta)
+{
+#if defined(__arm__)
+    uint32_t value;
+
+    do
+    {
+        value = __LDREXW(counter) + delta;
+    } while (0u != __STREXW(value, counter));
+
+    return value;
+#else
+    return __atomic_add_fetch(counter, delta, __ATOMIC_RELAXED);
+#endif /* defined(__arm__) */
+}
+
+/*******************************************************************************
+* Function Name: block_pool_max
+********************************************************************************
+* Summary:
+*  Raises the peak counter to value atomically.
+*
+* Parameters:
+*  peak: peak counter of a pool
+*  value: new count
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static inline void block_pool_max(volatile uint32_t *peak, uint32_t value)
+{
+#if defined(__arm__)
+    do
+    {
+        if (__LDREXW(peak) >= value)
+        {
+            __CLREX();
+            return;
+        }
+    } while (0u != __STREXW(value, peak));
+#else
+    uint32_t old_value = __atomic_load_n(peak, __ATOMIC_RELAXED);
+
+    while ((old_value < value) &&
+           !__atomic_compare_exchange_n(peak, &old_value, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+#endif /* defined(__arm__) */
+}
+
+/*******************************************************************************
+* Function Name: block_pool_init
+********************************************************************************
+* Summary:
+*  Puts every block of the pool in the free list, clears the statistics and
+*  registers the pool for block_pool_next(). Called in thread mode while no
+*  interrupt handler uses the pool.
+*
+* Parameters:
+*  pool: pool defined with BLOCK_POOL_DEFINE()
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void block_pool_init(block_pool_t *pool)
+{
+    uint32_t index;
+
+    if (pool->block_count > BLOCK_POOL_MAX_BLOCKS)
+    {
+        pool->block_count = BLOCK_POOL_MAX_BLOCKS;
+    }
+    for (index = 0u; index < pool->block_count; index++)
+    {
+        BLOCK_POOL_LINK_SET(pool, index, BLOCK_POOL_FREE_MARK |
+                            (((index + 1u) < pool->block_count) ? (index + 2u) : 0u));
+    }
+    pool->in_use = 0u;
+    pool->peak = 0u;
+    pool->allocs = 0u;
+    pool->fails = 0u;
+    pool->bad_frees = 0u;
+    BLOCK_POOL_BARRIER();
+    pool->head = (0u != pool->block_count) ? 1u : 0u;
+
+    if (!pool->registered)
+    {
+        pool->registered = true;
+        pool->next = block_pool_list;
+        block_pool_list = pool;
+    }
+}
+
+/*******************************************************************************
+* Function Name: block_pool_alloc
+********************************************************************************
+* Summary:
+*  Takes the first block of the free list. Callable from interrupt handlers
+*  and from thread mode. Placed in ITCM with block_pool_free(), which the
+*  hot interrupt handlers call.
+*
+* Parameters:
+*  pool: pool to allocate from
+*
+* Return:
+*  void*: word-aligned block of block_size bytes, NULL if the pool is empty
+*
+*******************************************************************************/
+PLACE_ITCM void *block_pool_alloc(block_pool_t *pool)
+{
+    uint32_t index;
+
+#if defined(__arm__)
+    /* A write of the head by another context, an interrupt handler
+     * included, makes the store exclusive fail */
+    do
+    {
+        index = __LDREXW(&pool->head);
+        if (0u == index)
+        {
+            __CLREX();
+            break;
+        }
+    } while (0u != __STREXW(BLOCK_POOL_LINK_GET(pool, index - 1u) & BLOCK_POOL_LINK_MASK, &pool->head));
+    __DMB();
+#else
+    block_pool_head_t head = __atomic_load_n(&pool->head, __ATOMIC_ACQUIRE);
+    block_pool_head_t next;
+
+    do
+    {
+        index = (uint32_t)(head & BLOCK_POOL_LINK_MASK);
+        if (0u == index)
+        {
+            break;
+        }
+        next = ((head & ~(block_pool_head_t)BLOCK_POOL_LINK_MASK) + BLOCK_POOL_TAG_ONE) |
+               (BLOCK_POOL_LINK_GET(pool, index - 1u) & BLOCK_POOL_LINK_MASK);
+    } while (!__atomic_compare_exchange_n(&pool->head, &head, next, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+#endif /* defined(__arm__) */
+
+    if (0u == index)
+    {
+        (void)block_pool_add(&pool->fails, 1u);
+        return NULL;
+    }
+    BLOCK_POOL_LINK_SET(pool, index - 1u, 0u);
+    block_pool_max(&pool->peak, block_pool_add(&pool->in_use, 1u));
+    (void)block_pool_add(&pool->allocs, 1u);
+
+    return &pool->storage[(index - 1u) * pool->block_size];
+}
+
+/*******************************************************************************
+* Function Name: block_pool_free
+********************************************************************************
+* Summary:
+*  Returns a block to the front of the free list. Callable from interrupt
+*  handlers and from thread mode. A block outside the pool or already free
+*  is counted in bad_frees and ignored.
+*
+* Parameters:
+*  pool: pool the block was allocated from
+*  block: block to release
+*
+* Return:
+*  bool: false if the block was rejected
+*
+*******************************************************************************/
+PLACE_ITCM bool block_pool_free(block_pool_t *pool, void *block)
+{
+    uintptr_t offset = (uintptr_t)block - (uintptr_t)pool->storage;
+    uint32_t index;
+
+    if (((uintptr_t)block < (uintptr_t)pool->storage) ||
+        (offset >= ((uintptr_t)pool->block_size * pool->block_count)) ||
+        (0u != (offset % pool->block_size)))
+    {
+        (void)block_pool_add(&pool->bad_frees, 1u);
+        return false;
+    }
+    index = (uint32_t)(offset / pool->block_size) + 1u;
+    if (0u != (BLOCK_POOL_LINK_GET(pool, index - 1u) & BLOCK_POOL_FREE_MARK))
+    {
+        (void)block_pool_add(&pool->bad_frees, 1u);
+        return false;
+    }
+
+    /* Counted out first, so that in_use never exceeds block_count */
+    (void)block_pool_add(&pool->in_use, (uint32_t)-1);
+
+#if defined(__arm__)
+    uint32_t head;
+
+    /* The link is written outside of the exclusive access */
+    for (;;)
+    {
+        head = pool->head;
+        BLOCK_POOL_LINK_SET(pool, index - 1u, BLOCK_POOL_FREE_MARK | head);
+        __DMB();
+        if (__LDREXW(&pool->head) != head)
+        {
+            __CLREX();
+        }
+        else if (0u == __STREXW(index, &pool->head))
+        {
+            break;
+        }
+    }
+#else
+    block_pool_head_t head = __atomic_load_n(&pool->head, __ATOMIC_RELAXED);
+    block_pool_head_t next;
+
+    do
+    {
+        BLOCK_POOL_LINK_SET(pool, index - 1u, BLOCK_POOL_FREE_MARK | (head & BLOCK_POOL_LINK_MASK));
+        next = ((head & ~(block_pool_head_t)BLOCK_POOL_LINK_MASK) + BLOCK_POOL_TAG_ONE) | index;
+    } while (!__atomic_compare_exchange_n(&pool->head, &head, next, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+#endif /* defined(__arm__) */
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: block_pool_get_stats
+********************************************************************************
+* Summary:
+*  Takes a snapshot of the statistics of a pool. The counters are read one
+*  by one, so they may disagree by the operations that run meanwhile.
+*
+* Parameters:
+*  pool: pool to read
+*  stats: snapshot to fill
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void block_pool_get_stats(const block_pool_t *pool, block_pool_stats_t *stats)
+{
+    stats->name        = pool->name;
+    stats->block_size  = pool->block_size;
+    stats->block_count = pool->block_count;
+    stats->in_use      = pool->in_use;
+    stats->peak        = pool->peak;
+    stats->allocs      = pool->allocs;
+    stats->fails       = pool->fails;
+    stats->bad_frees   = pool->bad_frees;
+}
+
+/*******************************************************************************
+* Function Name: block_pool_next
+********************************************************************************
+* Summary:
+*  Walks the pools initialized so far.
+*
+* Parameters:
+*  pool: current pool, NULL for the first one
+*
+* Return:
+*  const block_pool_t*: next pool, NULL after the last one
+*
+*******************************************************************************/
+const block_pool_t *block_pool_next(const block_pool_t *pool)
+{
+    return (NULL == pool) ? block_pool_list : pool->next;
+}
+
+/*******************************************************************************
+* Function Name: block_queue_reset
+********************************************************************************
+* Summary:
+*  Empties the queue. Called while neither end uses it.
+*
+* Parameters:
+*  queue: queue defined with BLOCK_QUEUE_DEFINE()
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void block_queue_reset(block_queue_t *queue)
+{
+    queue->head = 0u;
+    queue->tail = 0u;
+}
+
+/*******************************************************************************
+* Function Name: block_queue_push
+********************************************************************************
+* Summary:
+*  Appends a block. Called by the producer only, an interrupt handler for
+*  instance.
+*
+* Parameters:
+*  queue: queue
+*  block: block to hand over
+*
+* Return:
+*  bool: false if the queue is full
+*
+*******************************************************************************/
+PLACE_ITCM bool block_queue_push(block_queue_t *queue, void *block)
+{
+    uint32_t head = queue->head;
+
+    if ((head - queue->tail) > queue->mask)
+    {
+        return false;
+    }
+    queue->slots[head & queue->mask] = block;
+    BLOCK_POOL_BARRIER();
+    queue->head = head + 1u;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: block_queue_pop
+********************************************************************************
+* Summary:
+*  Takes the oldest block. Called by the consumer only.
+*
+* Parameters:
+*  queue: queue
+*
+* Return:
+*  void*: block, NULL if the queue is empty
+*
+*******************************************************************************/
+void *block_queue_pop(block_queue_t *queue)
+{
+    uint32_t tail = queue->tail;
+    void *block;
+
+    if (tail == queue->head)
+    {
+        return NULL;
+    }
+    BLOCK_POOL_BARRIER();
+    block = queue->slots[tail & queue->mask];
+    BLOCK_POOL_BARRIER();
+    queue->tail = tail + 1u;
+
+    return block;
+}
+
+/* [] END OF FILE */
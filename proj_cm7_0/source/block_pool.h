@@ -0,0 +1,146 @@
+/******************************************************************************
+* File Name:   block_pool.h
+*
+* Description: Fixed-size block pools and block queues, the static
+*              replacement of malloc() (mem_guard.h) for the items that are
+*              in flight between an interrupt handler and the main loop.
+*              A pool is defined with BLOCK_POOL_DEFINE() and sized in
+*              mem_config.h. Allocation and release are O(1) and lock-free,
+*              and may be called from interrupt handlers: the free list is
+*              popped and pushed with exclusive accesses on the target, and
+*              with a tagged compare-and-swap in the host build. A block
+*              queue hands blocks from one producer to one consumer in
+*              order. Only depends on the C library on the host, so that
+*              host tools can time it against malloc().
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _BLOCK_POOL_H_
+#define _BLOCK_POOL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#if defined(__arm__)
+#include "cy_pdl.h"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Blocks of a pool, the free list links are 15-bit indices */
+#define BLOCK_POOL_MAX_BLOCKS       (0x7FFFu)
+
+/* Words of a block of size bytes, blocks are word aligned */
+#define BLOCK_POOL_WORDS(size)      (((size) + sizeof(uint32_t) - 1u) / sizeof(uint32_t))
+
+/* Defines a pool of count blocks of size bytes, with its storage.
+ * block_pool_init() must run before the first allocation. */
+#define BLOCK_POOL_DEFINE(pool, size, count)                                                  \
+    static uint32_t pool##_storage[(count) * BLOCK_POOL_WORDS(size)];                         \
+    static uint16_t pool##_links[(count)];                                                   \
+    static block_pool_t pool = { #pool, (uint8_t *)pool##_storage, pool##_links,              \
+                                 BLOCK_POOL_WORDS(size) * sizeof(uint32_t), (count), 0u,      \
+                                 0u, 0u, 0u, 0u, 0u, NULL, false }
+
+/* Defines a queue of up to depth blocks, depth a power of 2 */
+#define BLOCK_QUEUE_DEFINE(queue, depth)                                                      \
+    static void *queue##_slots[(depth)];                                                      \
+    static block_queue_t queue = { queue##_slots, (depth) - 1u, 0u, 0u }
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Head of the free list: index + 1 of the first free block, 0 when empty.
+ * The host build keeps a change count in the upper half against ABA. */
+#if defined(__arm__)
+typedef uint32_t block_pool_head_t;
+#else
+typedef uint64_t block_pool_head_t;
+#endif
+
+typedef struct block_pool
+{
+    const char          *name;
+    uint8_t             *storage;       /* block_count blocks of block_size bytes */
+    uint16_t            *links;         /* Next free block of each free block */
+    uint32_t             block_size;
+    uint32_t             block_count;
+    volatile block_pool_head_t head;
+    volatile uint32_t    in_use;        /* Blocks allocated and not freed */
+    volatile uint32_t    peak;          /* Highest in_use since block_pool_init() */
+    volatile uint32_t    allocs;        /* Successful allocations */
+    volatile uint32_t    fails;         /* Allocations from an empty pool */
+    volatile uint32_t    bad_frees;     /* Frees of a foreign or already free block */
+    struct block_pool   *next;          /* Registered pools */
+    bool                 registered;
+} block_pool_t;
+
+/* Single-producer, single-consumer queue of blocks */
+typedef struct
+{
+    void               **slots;
+    uint32_t             mask;          /* Depth - 1 */
+    volatile uint32_t    head;          /* Written by the producer only */
+    volatile uint32_t    tail;          /* Written by the consumer only */
+} block_queue_t;
+
+/* Snapshot of the statistics of a pool */
+typedef struct
+{
+    const char          *name;
+    uint32_t             block_size;
+    uint32_t             block_count;
+    uint32_t             in_use;
+    uint32_t             peak;
+    uint32_t             allocs;
+    uint32_t             fails;
+    uint32_t             bad_frees;
+} block_pool_stats_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void block_pool_init(block_pool_t *pool);
+extern void *block_pool_alloc(block_pool_t *pool);
+extern bool block_pool_free(block_pool_t *pool, void *block);
+extern void block_pool_get_stats(const block_pool_t *pool, block_pool_stats_t *stats);
+extern const block_pool_t *block_pool_next(const block_pool_t *pool);
+
+extern void block_queue_reset(block_queue_t *queue);
+extern bool block_queue_push(block_queue_t *queue, void *block);
+extern void *block_queue_pop(block_queue_t *queue);
+
+#endif
@@ -41,22 +41,25 @@
 
 #include "button.h"
 #include "oob_demo.h"
+#include "io_client.h"
+#include "ipc_io.h"
+#include "resource_manager.h"
 
 /******************************************************************************
  * Macros
  *****************************************************************************/
 #define GPIO_INTERRUPT_PRIORITY (7u)
+/* Owner of the buttons in the resource manager */
+#define BUTTON_OWNER            "button"
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
-volatile bool button1_intr_event = false;
-volatile bool button1_Hysfilter_flag = false;          // Hysteresis filter 1 flag
 /* user button1 call back data */
 cyhal_gpio_callback_data_t btn1_callback_data;
-volatile bool button2_intr_event = false;
-volatile bool button2_Hysfilter_flag = false;          // Hysteresis filter 1 flag
 /* user button2 call back data */
 cyhal_gpio_callback_data_t btn2_callback_data;
+/* Duration of the last press forwarded by CM0+, by button number - 1 */
+static volatile uint16_t button_held[2];
 
 /*******************************************************************************
 * Function Prototypes
@@ -79,18 +82,23 @@ static void button2_interrupt_handler(void *handler_arg, cyhal_gpio_event_t even
 *******************************************************************************/
 void button1_initial()
 {
+    btn1_callback_data.callback = button1_interrupt_handler;
+#if IO_COPROCESSOR
+    /* CM0+ owns the button and forwards the debounced presses */
+    event_flags_clear(&demo_events, EVT_BUTTON1 | EVT_BUTTON1_FILTERED);
+#else
     cy_rslt_t result;
-    result = cyhal_gpio_init(CYBSP_USER_BTN, CYHAL_GPIO_DIR_INPUT,
-                                CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
+    result = resource_manager_gpio_acquire(CYBSP_USER_BTN, CYHAL_GPIO_DIR_INPUT,
+                                CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF, BUTTON_OWNER);
     if (result != CY_RSLT_SUCCESS)
     {
         CY_ASSERT(0);
     }
     /* Configure GPIO interrupt */
-    btn1_callback_data.callback = button1_interrupt_handler;
     cyhal_gpio_register_callback(CYBSP_USER_BTN1, &btn1_callback_data);
     cyhal_gpio_enable_event(CYBSP_USER_BTN1, CYHAL_GPIO_IRQ_FALL,
                                 GPIO_INTERRUPT_PRIORITY, true);
+#endif /* IO_COPROCESSOR */
 }
 
 
@@ -107,9 +115,12 @@ void button1_initial()
 *******************************************************************************/
 static void button1_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
 {
+    uint32_t start = io_client_load_begin();
+
     /* Disable interrupt */
     cyhal_gpio_register_callback(CYBSP_USER_BTN1, NULL);
-    button1_intr_event = true;
+    event_flags_set(&demo_events, EVT_BUTTON1);
+    io_client_load_end(start);
 }
 
 /*******************************************************************************
@@ -127,19 +138,24 @@ static void button1_interrupt_handler(void *handler_arg, cyhal_gpio_event_t even
 *******************************************************************************/
 void button2_initial()
 {
+    btn2_callback_data.callback = button2_interrupt_handler;
+#if IO_COPROCESSOR
+    /* CM0+ owns the button and forwards the debounced presses */
+    event_flags_clear(&demo_events, EVT_BUTTON2 | EVT_BUTTON2_FILTERED);
+#else
     cy_rslt_t result;
-    result = cyhal_gpio_init(CYBSP_USER_BTN2, CYHAL_GPIO_DIR_INPUT,
-                                CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
+    result = resource_manager_gpio_acquire(CYBSP_USER_BTN2, CYHAL_GPIO_DIR_INPUT,
+                                CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF, BUTTON_OWNER);
     if (result != CY_RSLT_SUCCESS)
     {
         CY_ASSERT(0);
     }
     /* Configure GPIO interrupt */
-    btn2_callback_data.callback = button2_interrupt_handler;
     cyhal_gpio_register_callback(CYBSP_USER_BTN2,
                                     &btn2_callback_data);
     cyhal_gpio_enable_event(CYBSP_USER_BTN2, CYHAL_GPIO_IRQ_FALL,
                                     GPIO_INTERRUPT_PRIORITY, true);
+#endif /* IO_COPROCESSOR */
 }
 
 
@@ -156,7 +172,105 @@ void button2_initial()
 *******************************************************************************/
 static void button2_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
 {
+    uint32_t start = io_client_load_begin();
+
     /* Disable interrupt */
     cyhal_gpio_register_callback(CYBSP_USER_BTN2, NULL);
-    button2_intr_event = true;
+    event_flags_set(&demo_events, EVT_BUTTON2);
+    io_client_load_end(start);
+}
+
+/*******************************************************************************
+* Function Name: button1_free
+********************************************************************************
+* Summary:
+* Releases the button1 port. The port stays configured when CM0+ owns it.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void button1_free()
+{
+#if IO_COPROCESSOR
+    event_flags_clear(&demo_events, EVT_BUTTON1 | EVT_BUTTON1_FILTERED);
+#else
+    resource_manager_gpio_release(CYBSP_USER_BTN1, BUTTON_OWNER);
+#endif /* IO_COPROCESSOR */
+}
+
+/*******************************************************************************
+* Function Name: button2_free
+********************************************************************************
+* Summary:
+* Releases the button2 port. The port stays configured when CM0+ owns it.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void button2_free()
+{
+#if IO_COPROCESSOR
+    event_flags_clear(&demo_events, EVT_BUTTON2 | EVT_BUTTON2_FILTERED);
+#else
+    resource_manager_gpio_release(CYBSP_USER_BTN2, BUTTON_OWNER);
+#endif /* IO_COPROCESSOR */
+}
+
+/*******************************************************************************
+* Function Name: button_post_event
+********************************************************************************
+* Summary:
+* Called for a button press forwarded by the CM0+ I/O co-processor. The press
+* is already debounced and released, so the demos see a regular press. Its
+* duration is kept for button_held_ms().
+*
+* Parameters:
+*  button: IPC_IO_BUTTON1 or IPC_IO_BUTTON2
+*  held_ms: time the button was held down
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void button_post_event(uint8_t button, uint16_t held_ms)
+{
+    if ((IPC_IO_BUTTON1 == button) && (NULL != btn1_callback_data.callback))
+    {
+        button_held[0] = held_ms;
+        event_flags_set(&demo_events, EVT_BUTTON1);
+    }
+    else if ((IPC_IO_BUTTON2 == button) && (NULL != btn2_callback_data.callback))
+    {
+        button_held[1] = held_ms;
+        event_flags_set(&demo_events, EVT_BUTTON2);
+    }
+}
+
+/*******************************************************************************
+* Function Name: button_held_ms
+********************************************************************************
+* Summary:
+* Returns how long the last press forwarded by CM0+ was held. Read it after
+* taking the EVT_BUTTON1 or EVT_BUTTON2 event of the press.
+*
+* Parameters:
+*  button: IPC_IO_BUTTON1 or IPC_IO_BUTTON2
+*
+* Return:
+*  uint16_t: press duration in ms
+*
+*******************************************************************************/
+uint16_t button_held_ms(uint8_t button)
+{
+    return (IPC_IO_BUTTON2 == button) ? button_held[1] : button_held[0];
 }
+
+/* [] END OF FILE */
@@ -53,15 +53,15 @@
 *******************************************************************************/
 extern void button1_initial();
 extern void button2_initial();
+extern void button1_free();
+extern void button2_free();
+extern void button_post_event(uint8_t button, uint16_t held_ms);
+extern uint16_t button_held_ms(uint8_t button);
 
 
 /*******************************************************************************
 * External Variables
 *******************************************************************************/
-extern volatile bool button1_intr_event;
-extern volatile bool button1_Hysfilter_flag;
-extern volatile bool button2_intr_event;
-extern volatile bool button2_Hysfilter_flag;
 /* UART received command */
 extern uint8_t    recCmd;
 /* user button2 call back data */
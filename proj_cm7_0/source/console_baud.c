@@ -0,0 +1,431 @@
+/******************************************************************************
+* File Name:   console_baud.c
+*
+* Description: Baud-rate change handshake of the debug console, see
+*              console_baud.h. The caller feeds the received characters and
+*              polls the state machine with a millisecond time.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "console_baud.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Token of the PC that confirms the new rate */
+#define CONSOLE_BAUD_SYNC_TOKEN         "SYNC"
+#define CONSOLE_BAUD_SYNC_TOKEN_LENGTH  (sizeof(CONSOLE_BAUD_SYNC_TOKEN) - 1u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void console_baud_start(console_baud_t *ctx, const console_baud_port_t *port, bool device,
+                               uint32_t old_baud, uint32_t new_baud, uint32_t now_ms);
+static void console_baud_send(const console_baud_t *ctx, const char *word);
+static void console_baud_enter(console_baud_t *ctx, console_baud_state_t state, uint32_t now_ms);
+static void console_baud_fail(console_baud_t *ctx, console_baud_error_t error);
+static bool console_baud_line_is(const console_baud_t *ctx, const char *word);
+
+
+/*******************************************************************************
+* Function Name: console_baud_device_start
+********************************************************************************
+* Summary:
+*  Starts the device end after the "baud <rate>" command: sends READY at the
+*  old rate. The UART switches once READY has left.
+*
+* Parameters:
+*  ctx: handshake
+*  port: UART of the console
+*  old_baud: current rate
+*  new_baud: requested rate
+*  now_ms: current time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_baud_device_start(console_baud_t *ctx, const console_baud_port_t *port,
+                               uint32_t old_baud, uint32_t new_baud, uint32_t now_ms)
+{
+    console_baud_start(ctx, port, true, old_baud, new_baud, now_ms);
+    console_baud_send(ctx, "READY");
+    console_baud_enter(ctx, CONSOLE_BAUD_DRAIN, now_ms);
+}
+
+/*******************************************************************************
+* Function Name: console_baud_pc_start
+********************************************************************************
+* Summary:
+*  Starts the PC end: sends the "baud <rate>" command at the old rate and
+*  waits for READY.
+*
+* Parameters:
+*  ctx: handshake
+*  port: serial port of the PC
+*  old_baud: current rate
+*  new_baud: requested rate
+*  now_ms: current time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_baud_pc_start(console_baud_t *ctx, const console_baud_port_t *port,
+                           uint32_t old_baud, uint32_t new_baud, uint32_t now_ms)
+{
+    char command[CONSOLE_BAUD_LINE_SIZE];
+    int length;
+
+    console_baud_start(ctx, port, false, old_baud, new_baud, now_ms);
+    length = snprintf(command, sizeof(command), "baud %lu\r", (unsigned long)new_baud);
+    port->write(port->arg, command, (uint32_t)length);
+    console_baud_enter(ctx, CONSOLE_BAUD_READY, now_ms);
+}
+
+/*******************************************************************************
+* Function Name: console_baud_rx
+********************************************************************************
+* Summary:
+*  Takes a received character. The device looks for the SYNC token, which
+*  may follow characters garbled while the two ends ran at different rates;
+*  the PC collects lines and looks for the READY, OK and FAIL answers.
+*
+* Parameters:
+*  ctx: handshake
+*  data: received character
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_baud_rx(console_baud_t *ctx, uint8_t data)
+{
+    if (ctx->device)
+    {
+        if (CONSOLE_BAUD_SYNC != ctx->state)
+        {
+            return;
+        }
+        if (ctx->line_length == CONSOLE_BAUD_SYNC_TOKEN_LENGTH)
+        {
+            memmove(ctx->line, &ctx->line[1], CONSOLE_BAUD_SYNC_TOKEN_LENGTH - 1u);
+            ctx->line_length--;
+        }
+        ctx->line[ctx->line_length++] = (char)data;
+        if ((ctx->line_length == CONSOLE_BAUD_SYNC_TOKEN_LENGTH) &&
+            (0 == memcmp(ctx->line, CONSOLE_BAUD_SYNC_TOKEN, CONSOLE_BAUD_SYNC_TOKEN_LENGTH)))
+        {
+            ctx->heard = true;
+        }
+        return;
+    }
+
+    if (('\r' != data) && ('\n' != data))
+    {
+        if (ctx->line_length < (CONSOLE_BAUD_LINE_SIZE - 1u))
+        {
+            ctx->line[ctx->line_length++] = (char)data;
+        }
+        return;
+    }
+
+    ctx->line[ctx->line_length] = '\0';
+    if ((CONSOLE_BAUD_READY == ctx->state) && console_baud_line_is(ctx, "READY"))
+    {
+        ctx->heard = true;
+    }
+    else if ((CONSOLE_BAUD_SYNC == ctx->state) && console_baud_line_is(ctx, "OK"))
+    {
+        ctx->heard = true;
+    }
+    else if (console_baud_line_is(ctx, "FAIL"))
+    {
+        ctx->refused = true;
+    }
+    ctx->line_length = 0u;
+}
+
+/*******************************************************************************
+* Function Name: console_baud_poll
+********************************************************************************
+* Summary:
+*  Advances the handshake. Call it every few milliseconds until it returns
+*  CONSOLE_BAUD_DONE or CONSOLE_BAUD_FAILED; after a failure the UART is back
+*  at the old rate.
+*
+* Parameters:
+*  ctx: handshake
+*  now_ms: current time
+*
+* Return:
+*  console_baud_state_t: state of the handshake
+*
+*******************************************************************************/
+console_baud_state_t console_baud_poll(console_baud_t *ctx, uint32_t now_ms)
+{
+    const console_baud_port_t *port = ctx->port;
+    bool expired = ((now_ms - ctx->start_ms) >= CONSOLE_BAUD_SYNC_MS);
+
+    switch (ctx->state)
+    {
+        case CONSOLE_BAUD_READY:
+            if (ctx->refused)
+            {
+                console_baud_fail(ctx, CONSOLE_BAUD_ERROR_REFUSED);
+            }
+            else if (ctx->heard)
+            {
+                ctx->actual_baud = port->set_baud(port->arg, ctx->new_baud);
+                if (!console_baud_rate_ok(ctx->new_baud, ctx->actual_baud))
+                {
+                    console_baud_fail(ctx, CONSOLE_BAUD_ERROR_RATE);
+                }
+                else
+                {
+                    console_baud_enter(ctx, CONSOLE_BAUD_SYNC, now_ms);
+                    ctx->retry_ms = now_ms - CONSOLE_BAUD_RETRY_MS;
+                }
+            }
+            else if (expired)
+            {
+                console_baud_fail(ctx, CONSOLE_BAUD_ERROR_TIMEOUT);
+            }
+            break;
+
+        case CONSOLE_BAUD_DRAIN:
+            if (port->tx_idle(port->arg))
+            {
+                ctx->actual_baud = port->set_baud(port->arg, ctx->new_baud);
+                if (!console_baud_rate_ok(ctx->new_baud, ctx->actual_baud))
+                {
+                    console_baud_fail(ctx, CONSOLE_BAUD_ERROR_RATE);
+                }
+                else
+                {
+                    console_baud_enter(ctx, CONSOLE_BAUD_SYNC, now_ms);
+                }
+            }
+            break;
+
+        case CONSOLE_BAUD_SYNC:
+            if (ctx->heard)
+            {
+                if (ctx->device)
+                {
+                    console_baud_send(ctx, "OK");
+                }
+                ctx->state = CONSOLE_BAUD_DONE;
+            }
+            else if (ctx->refused)
+            {
+                console_baud_fail(ctx, CONSOLE_BAUD_ERROR_REFUSED);
+            }
+            else if (expired)
+            {
+                console_baud_fail(ctx, CONSOLE_BAUD_ERROR_TIMEOUT);
+            }
+            else if (!ctx->device && ((now_ms - ctx->retry_ms) >= CONSOLE_BAUD_RETRY_MS))
+            {
+                port->write(port->arg, CONSOLE_BAUD_SYNC_TOKEN "\r", CONSOLE_BAUD_SYNC_TOKEN_LENGTH + 1u);
+                ctx->retry_ms = now_ms;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return ctx->state;
+}
+
+/*******************************************************************************
+* Function Name: console_baud_rate_ok
+********************************************************************************
+* Summary:
+*  Checks that the rate achieved by a UART is close enough to the request
+*  for the other end to sample it.
+*
+* Parameters:
+*  requested: requested rate
+*  actual: achieved rate, 0 if not supported
+*
+* Return:
+*  bool: true within CONSOLE_BAUD_TOLERANCE_PERCENT
+*
+*******************************************************************************/
+bool console_baud_rate_ok(uint32_t requested, uint32_t actual)
+{
+    uint64_t deviation = (actual > requested) ? (actual - requested) : (requested - actual);
+
+    return (0u != actual) && ((deviation * 100u) <= ((uint64_t)requested * CONSOLE_BAUD_TOLERANCE_PERCENT));
+}
+
+/*******************************************************************************
+* Function Name: console_baud_start
+********************************************************************************
+* Summary:
+*  Clears a handshake and records its end, its rates and its start time. The
+*  local UART still runs at the old rate.
+*
+* Parameters:
+*  ctx: handshake
+*  port: UART of this end
+*  device: true on the device, false on the PC
+*  old_baud: current rate
+*  new_baud: requested rate
+*  now_ms: current time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_baud_start(console_baud_t *ctx, const console_baud_port_t *port, bool device,
+                               uint32_t old_baud, uint32_t new_baud, uint32_t now_ms)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->port = port;
+    ctx->device = device;
+    ctx->old_baud = old_baud;
+    ctx->new_baud = new_baud;
+    ctx->actual_baud = old_baud;
+    ctx->start_ms = now_ms;
+}
+
+/*******************************************************************************
+* Function Name: console_baud_send
+********************************************************************************
+* Summary:
+*  Writes the line "BAUD <new rate> <word>" at the current rate of the port.
+*
+* Parameters:
+*  ctx: handshake
+*  word: READY, OK or FAIL; only the device sends these lines
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_baud_send(const console_baud_t *ctx, const char *word)
+{
+    char line[CONSOLE_BAUD_LINE_SIZE];
+    int length = snprintf(line, sizeof(line), "BAUD %lu %s\r\n", (unsigned long)ctx->new_baud, word);
+
+    ctx->port->write(ctx->port->arg, line, (uint32_t)length);
+}
+
+/*******************************************************************************
+* Function Name: console_baud_enter
+********************************************************************************
+* Summary:
+*  Moves the handshake to a state. Its timeout counts from now, and what was
+*  received in the previous state is dropped.
+*
+* Parameters:
+*  ctx: handshake
+*  state: next state
+*  now_ms: current time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_baud_enter(console_baud_t *ctx, console_baud_state_t state, uint32_t now_ms)
+{
+    ctx->state = state;
+    ctx->start_ms = now_ms;
+    ctx->heard = false;
+    ctx->line_length = 0u;
+}
+
+/*******************************************************************************
+* Function Name: console_baud_fail
+********************************************************************************
+* Summary:
+*  Ends the handshake at the old rate. The device reports the failure there,
+*  where the PC listens again.
+*
+* Parameters:
+*  ctx: handshake
+*  error: cause
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_baud_fail(console_baud_t *ctx, console_baud_error_t error)
+{
+    if (ctx->actual_baud != ctx->old_baud)
+    {
+        ctx->actual_baud = ctx->port->set_baud(ctx->port->arg, ctx->old_baud);
+    }
+    if (ctx->device)
+    {
+        console_baud_send(ctx, "FAIL");
+    }
+    ctx->error = error;
+    ctx->state = CONSOLE_BAUD_FAILED;
+}
+
+/*******************************************************************************
+* Function Name: console_baud_line_is
+********************************************************************************
+* Summary:
+*  Checks the last received line against "BAUD <new rate> <word>". Garbage
+*  received before it at the old rate is skipped, nothing may follow it.
+*
+* Parameters:
+*  ctx: handshake in progress
+*  word: READY, OK or FAIL
+*
+* Return:
+*  bool: true if the line ends with the expected words
+*
+*******************************************************************************/
+static bool console_baud_line_is(const console_baud_t *ctx, const char *word)
+{
+    char expected[CONSOLE_BAUD_LINE_SIZE];
+    const char *found;
+
+    (void)snprintf(expected, sizeof(expected), "BAUD %lu %s", (unsigned long)ctx->new_baud, word);
+    found = strstr(ctx->line, expected);
+
+    return (NULL != found) && ('\0' == found[strlen(expected)]);
+}
+
+/* [] END OF FILE */
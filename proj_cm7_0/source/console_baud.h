@@ -0,0 +1,130 @@
+/******************************************************************************
+* File Name:   console_baud.h
+*
+* Description: Baud-rate change handshake of the debug console. Both ends run
+*              the same state machine, the device in the parameter console and
+*              the PC in host/tools/baud_switch.c. Only depends on the C
+*              library; the UART is reached through a port of callbacks.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _CONSOLE_BAUD_H_
+#define _CONSOLE_BAUD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* The handshake, with <rate> in decimal:
+ *   PC:     "baud <rate>\r"                at the old rate
+ *   device: "BAUD <rate> READY\r\n"        at the old rate, then switches
+ *   PC:     switches, sends "SYNC\r" every CONSOLE_BAUD_RETRY_MS
+ *   device: "BAUD <rate> OK\r\n"           at the new rate
+ * Either end goes back to the old rate if the other end is not heard within
+ * CONSOLE_BAUD_SYNC_MS; the device then sends "BAUD <rate> FAIL\r\n". */
+#define CONSOLE_BAUD_SYNC_MS            (1000u)
+#define CONSOLE_BAUD_RETRY_MS           (50u)
+
+/* Largest deviation of the rate the UART divider achieves, in percent */
+#define CONSOLE_BAUD_TOLERANCE_PERCENT  (2u)
+
+/* Longest handshake line, terminator included */
+#define CONSOLE_BAUD_LINE_SIZE          (32u)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    CONSOLE_BAUD_IDLE = 0u,
+    CONSOLE_BAUD_READY,                 /* PC: waiting for READY */
+    CONSOLE_BAUD_DRAIN,                 /* Device: READY still in the TX FIFO */
+    CONSOLE_BAUD_SYNC,                  /* Both: at the new rate, not confirmed */
+    CONSOLE_BAUD_DONE,
+    CONSOLE_BAUD_FAILED,
+} console_baud_state_t;
+
+typedef enum
+{
+    CONSOLE_BAUD_ERROR_NONE = 0u,
+    CONSOLE_BAUD_ERROR_RATE,            /* The UART cannot run at the rate */
+    CONSOLE_BAUD_ERROR_TIMEOUT,         /* The other end was not heard */
+    CONSOLE_BAUD_ERROR_REFUSED,         /* The device answered FAIL */
+} console_baud_error_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    /* Switches the UART, returns the rate achieved or 0 if not supported */
+    uint32_t (*set_baud)(void *arg, uint32_t baud);
+    void     (*write)(void *arg, const char *text, uint32_t length);
+    /* True once the last character written has left */
+    bool     (*tx_idle)(void *arg);
+    void      *arg;
+} console_baud_port_t;
+
+typedef struct
+{
+    const console_baud_port_t *port;
+    bool                  device;       /* Device or PC end */
+    console_baud_state_t  state;
+    console_baud_error_t  error;
+    uint32_t              old_baud;
+    uint32_t              new_baud;
+    uint32_t              actual_baud;  /* Rate achieved by the local UART */
+    uint32_t              start_ms;     /* Start of the current state */
+    uint32_t              retry_ms;     /* PC: last SYNC sent */
+    bool                  heard;        /* Expected line or token received */
+    bool                  refused;
+    char                  line[CONSOLE_BAUD_LINE_SIZE];
+    uint32_t              line_length;
+} console_baud_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void console_baud_device_start(console_baud_t *ctx, const console_baud_port_t *port,
+                                      uint32_t old_baud, uint32_t new_baud, uint32_t now_ms);
+extern void console_baud_pc_start(console_baud_t *ctx, const console_baud_port_t *port,
+                                  uint32_t old_baud, uint32_t new_baud, uint32_t now_ms);
+extern void console_baud_rx(console_baud_t *ctx, uint8_t data);
+extern console_baud_state_t console_baud_poll(console_baud_t *ctx, uint32_t now_ms);
+extern bool console_baud_rate_ok(uint32_t requested, uint32_t actual);
+
+#endif
@@ -0,0 +1,701 @@
+/******************************************************************************
+* File Name:   console_fmt.c
+*
+* Description: Integer-only formatter of the console output.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "console_fmt.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Flags of a conversion specification */
+#define CONSOLE_FMT_LEFT            (0x01u)     /* '-' */
+#define CONSOLE_FMT_PLUS            (0x02u)     /* '+' */
+#define CONSOLE_FMT_SPACE           (0x04u)     /* ' ' */
+#define CONSOLE_FMT_ALT             (0x08u)     /* '#' */
+#define CONSOLE_FMT_ZERO            (0x10u)     /* '0' */
+
+/* Digits of the largest conversion, a 64-bit value in octal */
+#define CONSOLE_FMT_DIGITS          (22u)
+
+/* Precision not given */
+#define CONSOLE_FMT_NO_PRECISION    (-1)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    CONSOLE_FMT_INT = 0u,
+    CONSOLE_FMT_CHAR,               /* hh */
+    CONSOLE_FMT_SHORT,              /* h */
+    CONSOLE_FMT_LONG,               /* l */
+    CONSOLE_FMT_LONG_LONG,          /* ll, j */
+    CONSOLE_FMT_SIZE,               /* z, t */
+} console_fmt_length_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Output in progress */
+typedef struct
+{
+    console_fmt_sink_t sink;        /* NULL: truncate at the end of the buffer */
+    void     *arg;
+    char     *buffer;
+    uint32_t size;
+    uint32_t used;
+    uint32_t total;                 /* Characters produced, including those cut */
+} console_fmt_out_t;
+
+/* A conversion specification */
+typedef struct
+{
+    uint32_t flags;
+    uint32_t width;
+    int32_t  precision;
+    console_fmt_length_t length;
+} console_fmt_spec_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void console_fmt_put(console_fmt_out_t *out, const char *text, uint32_t length);
+static void console_fmt_pad(console_fmt_out_t *out, char c, uint32_t count);
+static void console_fmt_integer(console_fmt_out_t *out, const console_fmt_spec_t *spec, char conversion,
+                                uint64_t value, bool negative);
+static void console_fmt_field(console_fmt_out_t *out, const console_fmt_spec_t *spec, const char *text,
+                              uint32_t length);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char console_fmt_digits_lower[] = "0123456789abcdef";
+static const char console_fmt_digits_upper[] = "0123456789ABCDEF";
+
+
+/*******************************************************************************
+* Function Name: console_fmt_vformat
+********************************************************************************
+* Summary:
+*  Formats like vsnprintf(), into a buffer that the sink drains each time it
+*  is full and once at the end. Without a sink, the output is cut at the
+*  end of the buffer and terminated, as vsnprintf() does. Floating-point
+*  conversions and %n are not supported: their specification is copied to
+*  the output and no argument is taken.
+*
+* Parameters:
+*  sink: receives the output, NULL to keep it in the buffer
+*  arg: passed to the sink
+*  buffer: output buffer
+*  size: size of buffer, at least 1 with a sink
+*  format: format string
+*  args: arguments
+*
+* Return:
+*  uint32_t: characters produced, without the terminator, including those
+*  cut without a sink
+*
+*******************************************************************************/
+uint32_t console_fmt_vformat(console_fmt_sink_t sink, void *arg, char *buffer, uint32_t size,
+                             const char *format, va_list args)
+{
+    console_fmt_out_t out = { sink, arg, buffer, size, 0u, 0u };
+    console_fmt_spec_t spec;
+    const char *start;
+
+    while ('\0' != *format)
+    {
+        /* Text up to the next specification */
+        start = format;
+        while (('\0' != *format) && ('%' != *format))
+        {
+            format++;
+        }
+        console_fmt_put(&out, start, (uint32_t)(format - start));
+        if ('\0' == *format)
+        {
+            break;
+        }
+        start = format++;
+
+        spec.flags = 0u;
+        spec.width = 0u;
+        spec.precision = CONSOLE_FMT_NO_PRECISION;
+        spec.length = CONSOLE_FMT_INT;
+
+        for (;;)
+        {
+            uint32_t flag = ('-' == *format) ? CONSOLE_FMT_LEFT : ('+' == *format) ? CONSOLE_FMT_PLUS :
+                            (' ' == *format) ? CONSOLE_FMT_SPACE : ('#' == *format) ? CONSOLE_FMT_ALT :
+                            ('0' == *format) ? CONSOLE_FMT_ZERO : 0u;
+
+            if (0u == flag)
+            {
+                break;
+            }
+            spec.flags |= flag;
+            format++;
+        }
+
+        if ('*' == *format)
+        {
+            int width = va_arg(args, int);
+
+            if (width < 0)
+            {
+                spec.flags |= CONSOLE_FMT_LEFT;
+                width = -width;
+            }
+            spec.width = (uint32_t)width;
+            format++;
+        }
+        while ((*format >= '0') && (*format <= '9'))
+        {
+            spec.width = (spec.width * 10u) + (uint32_t)(*format++ - '0');
+        }
+
+        if ('.' == *format)
+        {
+            format++;
+            spec.precision = 0;
+            if ('*' == *format)
+            {
+                int precision = va_arg(args, int);
+
+                spec.precision = (precision < 0) ? CONSOLE_FMT_NO_PRECISION : precision;
+                format++;
+            }
+            while ((*format >= '0') && (*format <= '9'))
+            {
+                spec.precision = (spec.precision * 10) + (*format++ - '0');
+            }
+        }
+
+        switch (*format)
+        {
+            case 'h':
+                format++;
+                spec.length = ('h' == *format) ? CONSOLE_FMT_CHAR : CONSOLE_FMT_SHORT;
+                format += (CONSOLE_FMT_CHAR == spec.length) ? 1 : 0;
+                break;
+            case 'l':
+                format++;
+                spec.length = ('l' == *format) ? CONSOLE_FMT_LONG_LONG : CONSOLE_FMT_LONG;
+                format += (CONSOLE_FMT_LONG_LONG == spec.length) ? 1 : 0;
+                break;
+            case 'j':
+                format++;
+                spec.length = CONSOLE_FMT_LONG_LONG;
+                break;
+            case 'z':
+            case 't':
+                format++;
+                spec.length = CONSOLE_FMT_SIZE;
+                break;
+            default:
+                break;
+        }
+
+        switch (*format)
+        {
+            case 'd':
+            case 'i':
+            {
+                int64_t value;
+
+                switch (spec.length)
+                {
+                    case CONSOLE_FMT_CHAR:      value = (signed char)va_arg(args, int);      break;
+                    case CONSOLE_FMT_SHORT:     value = (short)va_arg(args, int);            break;
+                    case CONSOLE_FMT_LONG:      value = va_arg(args, long);                  break;
+                    case CONSOLE_FMT_LONG_LONG: value = va_arg(args, long long);             break;
+                    case CONSOLE_FMT_SIZE:      value = va_arg(args, ptrdiff_t);             break;
+                    default:                    value = va_arg(args, int);                   break;
+                }
+                console_fmt_integer(&out, &spec, 'd', (value < 0) ? (0u - (uint64_t)value) : (uint64_t)value,
+                                    value < 0);
+                break;
+            }
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+            {
+                uint64_t value;
+
+                switch (spec.length)
+                {
+                    case CONSOLE_FMT_CHAR:      value = (unsigned char)va_arg(args, unsigned int);  break;
+                    case CONSOLE_FMT_SHORT:     value = (unsigned short)va_arg(args, unsigned int); break;
+                    case CONSOLE_FMT_LONG:      value = va_arg(args, unsigned long);                break;
+                    case CONSOLE_FMT_LONG_LONG: value = va_arg(args, unsigned long long);           break;
+                    case CONSOLE_FMT_SIZE:      value = va_arg(args, size_t);                       break;
+                    default:                    value = va_arg(args, unsigned int);                 break;
+                }
+                spec.flags &= ~(CONSOLE_FMT_PLUS | CONSOLE_FMT_SPACE);
+                console_fmt_integer(&out, &spec, *format, value, false);
+                break;
+            }
+            case 'p':
+            {
+                uintptr_t value = (uintptr_t)va_arg(args, void *);
+
+                spec.flags |= CONSOLE_FMT_ALT;
+                console_fmt_integer(&out, &spec, 'x', value, false);
+                break;
+            }
+            case 'c':
+            {
+                char c = (char)va_arg(args, int);
+
+                console_fmt_field(&out, &spec, &c, 1u);
+                break;
+            }
+            case 's':
+            {
+                const char *text = va_arg(args, const char *);
+                uint32_t length = 0u;
+
+                text = (NULL == text) ? "(null)" : text;
+                while (('\0' != text[length]) &&
+                       ((spec.precision < 0) || (length < (uint32_t)spec.precision)))
+                {
+                    length++;
+                }
+                console_fmt_field(&out, &spec, text, length);
+                break;
+            }
+            case '%':
+                console_fmt_put(&out, "%", 1u);
+                break;
+            case '\0':
+                /* Specification cut by the end of the format */
+                console_fmt_put(&out, start, (uint32_t)(format - start));
+                format--;
+                break;
+            default:
+                console_fmt_put(&out, start, (uint32_t)(format + 1 - start));
+                break;
+        }
+        format++;
+    }
+
+    if (NULL != out.sink)
+    {
+        if (0u != out.used)
+        {
+            out.sink(out.arg, out.buffer, out.used);
+        }
+    }
+    else if (0u != out.size)
+    {
+        out.buffer[out.used] = '\0';
+    }
+
+    return out.total;
+}
+
+/*******************************************************************************
+* Function Name: console_fmt_vsnprintf
+********************************************************************************
+* Summary:
+*  vsnprintf() of the formatter: formats into a buffer, cut and terminated at
+*  its end.
+*
+* Parameters:
+*  out: buffer
+*  size: size of the buffer, terminator included; 0 writes nothing
+*  format: format string
+*  args: arguments of the format
+*
+* Return:
+*  uint32_t: length of the whole output, without the terminator, even if cut
+*
+*******************************************************************************/
+uint32_t console_fmt_vsnprintf(char *out, uint32_t size, const char *format, va_list args)
+{
+    return console_fmt_vformat(NULL, NULL, out, size, format, args);
+}
+
+/*******************************************************************************
+* Function Name: console_fmt_snprintf
+********************************************************************************
+* Summary:
+*  snprintf() of the formatter: formats into a buffer, cut and terminated at
+*  its end.
+*
+* Parameters:
+*  out: buffer
+*  size: size of the buffer, terminator included; 0 writes nothing
+*  format: format string
+*  ...: arguments of the format
+*
+* Return:
+*  uint32_t: length of the whole output, without the terminator, even if cut
+*
+*******************************************************************************/
+uint32_t console_fmt_snprintf(char *out, uint32_t size, const char *format, ...)
+{
+    va_list args;
+    uint32_t length;
+
+    va_start(args, format);
+    length = console_fmt_vformat(NULL, NULL, out, size, format, args);
+    va_end(args);
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: console_fmt_dec
+********************************************************************************
+* Summary:
+*  Fast path of a decimal field, as "%*ld": the value right-aligned in the
+*  width with blanks. Not terminated.
+*
+* Parameters:
+*  out: receives the field, the larger of width and CONSOLE_FMT_DEC_MAX
+*  characters at most
+*  value: value
+*  width: minimum width
+*
+* Return:
+*  uint32_t: field length
+*
+*******************************************************************************/
+uint32_t console_fmt_dec(char *out, int32_t value, uint32_t width)
+{
+    char digits[CONSOLE_FMT_DEC_MAX];
+    uint32_t magnitude = (value < 0) ? (0u - (uint32_t)value) : (uint32_t)value;
+    uint32_t count = 0u;
+    uint32_t length = 0u;
+
+    do
+    {
+        digits[count++] = (char)('0' + (magnitude % 10u));
+        magnitude /= 10u;
+    } while (0u != magnitude);
+    if (value < 0)
+    {
+        digits[count++] = '-';
+    }
+
+    while (width > count)
+    {
+        out[length++] = ' ';
+        width--;
+    }
+    while (0u != count)
+    {
+        out[length++] = digits[--count];
+    }
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: console_fmt_hex
+********************************************************************************
+* Summary:
+*  Fast path of a hexadecimal field, as "%0*lX" or "%0*lx": at least the
+*  given number of digits, with leading zeros. Not terminated.
+*
+* Parameters:
+*  out: receives up to CONSOLE_FMT_HEX_MAX digits
+*  value: value
+*  digits: minimum number of digits, 1 to CONSOLE_FMT_HEX_MAX
+*  upper: upper-case digits
+*
+* Return:
+*  uint32_t: field length
+*
+*******************************************************************************/
+uint32_t console_fmt_hex(char *out, uint32_t value, uint32_t digits, bool upper)
+{
+    const char *table = upper ? console_fmt_digits_upper : console_fmt_digits_lower;
+    uint32_t count = 1u;
+
+    while ((count < CONSOLE_FMT_HEX_MAX) && (0u != (value >> (4u * count))))
+    {
+        count++;
+    }
+    count = (digits > count) ? ((digits < CONSOLE_FMT_HEX_MAX) ? digits : CONSOLE_FMT_HEX_MAX) : count;
+
+    for (uint32_t index = count; index > 0u; index--)
+    {
+        out[index - 1u] = table[value & 0x0Fu];
+        value >>= 4;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: console_fmt_put
+********************************************************************************
+* Summary:
+*  Adds characters to the output. Without a sink the characters past the end of
+*  the buffer are cut, leaving room for the terminator; with a sink a full
+*  buffer is drained to it and reused.
+*
+* Parameters:
+*  out: output in progress
+*  text: characters, not terminated
+*  length: number of characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_fmt_put(console_fmt_out_t *out, const char *text, uint32_t length)
+{
+    uint32_t count;
+
+    out->total += length;
+
+    if (NULL == out->sink)
+    {
+        count = (out->size > (out->used + 1u)) ? (out->size - out->used - 1u) : 0u;
+        count = (length < count) ? length : count;
+        memcpy(&out->buffer[out->used], text, count);
+        out->used += count;
+        return;
+    }
+
+    while (0u != length)
+    {
+        count = out->size - out->used;
+        count = (length < count) ? length : count;
+        memcpy(&out->buffer[out->used], text, count);
+        out->used += count;
+        text += count;
+        length -= count;
+        if (out->used == out->size)
+        {
+            out->sink(out->arg, out->buffer, out->used);
+            out->used = 0u;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_fmt_pad
+********************************************************************************
+* Summary:
+*  Adds a blank or a zero several times, in runs of up to 16 characters.
+*
+* Parameters:
+*  out: output in progress
+*  c: ' ' or '0'
+*  count: number of characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_fmt_pad(console_fmt_out_t *out, char c, uint32_t count)
+{
+    static const char blanks[] = "                ";
+    static const char zeros[] = "0000000000000000";
+    const char *run = ('0' == c) ? zeros : blanks;
+
+    while (0u != count)
+    {
+        uint32_t length = (count < (sizeof(blanks) - 1u)) ? count : (sizeof(blanks) - 1u);
+
+        console_fmt_put(out, run, length);
+        count -= length;
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_fmt_integer
+********************************************************************************
+* Summary:
+*  Converts an integer: sign or prefix, zeros up to the precision, digits,
+*  and padding up to the width.
+*
+* Parameters:
+*  out: output
+*  spec: specification
+*  conversion: 'd', 'u', 'o', 'x' or 'X'
+*  value: magnitude
+*  negative: the value is negative
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_fmt_integer(console_fmt_out_t *out, const console_fmt_spec_t *spec, char conversion,
+                                uint64_t value, bool negative)
+{
+    char digits[CONSOLE_FMT_DIGITS];
+    char *first = &digits[CONSOLE_FMT_DIGITS];
+    const char *table = ('X' == conversion) ? console_fmt_digits_upper : console_fmt_digits_lower;
+    const char *prefix = "";
+    uint32_t count;
+    uint32_t zeros = 0u;
+    uint32_t length;
+    bool zero = (0u == value);
+
+    /* Digits from the last one; none for a zero with a zero precision */
+    if (!zero || (0 != spec->precision))
+    {
+        if (('x' == conversion) || ('X' == conversion))
+        {
+            do
+            {
+                *--first = table[value & 0x0Fu];
+                value >>= 4;
+            } while (0u != value);
+        }
+        else if ('o' == conversion)
+        {
+            do
+            {
+                *--first = (char)('0' + (value & 0x07u));
+                value >>= 3;
+            } while (0u != value);
+        }
+        else
+        {
+            uint32_t small;
+
+            /* 32-bit divisions once the value fits, the common case */
+            while (value > UINT32_MAX)
+            {
+                *--first = (char)('0' + (value % 10u));
+                value /= 10u;
+            }
+            small = (uint32_t)value;
+            do
+            {
+                *--first = (char)('0' + (small % 10u));
+                small /= 10u;
+            } while (0u != small);
+        }
+    }
+    count = (uint32_t)(&digits[CONSOLE_FMT_DIGITS] - first);
+
+    if (negative)
+    {
+        prefix = "-";
+    }
+    else if (0u != (spec->flags & CONSOLE_FMT_PLUS))
+    {
+        prefix = "+";
+    }
+    else if (0u != (spec->flags & CONSOLE_FMT_SPACE))
+    {
+        prefix = " ";
+    }
+    else if ((0u != (spec->flags & CONSOLE_FMT_ALT)) && !zero && (('x' == conversion) || ('X' == conversion)))
+    {
+        prefix = ('X' == conversion) ? "0X" : "0x";
+    }
+
+    if ((spec->precision >= 0) && ((uint32_t)spec->precision > count))
+    {
+        zeros = (uint32_t)spec->precision - count;
+    }
+    /* The alternate octal form starts with a zero */
+    if ((0u != (spec->flags & CONSOLE_FMT_ALT)) && ('o' == conversion) && (0u == zeros) &&
+        ((0u == count) || ('0' != *first)))
+    {
+        zeros = 1u;
+    }
+    length = (uint32_t)strlen(prefix) + zeros + count;
+
+    if ((0u != (spec->flags & CONSOLE_FMT_ZERO)) && (0u == (spec->flags & CONSOLE_FMT_LEFT)) &&
+        (spec->precision < 0) && (spec->width > length))
+    {
+        zeros += spec->width - length;
+        length = spec->width;
+    }
+
+    if ((0u == (spec->flags & CONSOLE_FMT_LEFT)) && (spec->width > length))
+    {
+        console_fmt_pad(out, ' ', spec->width - length);
+    }
+    console_fmt_put(out, prefix, (uint32_t)strlen(prefix));
+    console_fmt_pad(out, '0', zeros);
+    console_fmt_put(out, first, count);
+    if ((0u != (spec->flags & CONSOLE_FMT_LEFT)) && (spec->width > length))
+    {
+        console_fmt_pad(out, ' ', spec->width - length);
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_fmt_field
+********************************************************************************
+* Summary:
+*  Adds a text padded with blanks to the width of the specification, on the
+*  left or, with the '-' flag, on the right.
+*
+* Parameters:
+*  out: output in progress
+*  spec: conversion specification
+*  text: characters, not terminated
+*  length: number of characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_fmt_field(console_fmt_out_t *out, const console_fmt_spec_t *spec, const char *text,
+                              uint32_t length)
+{
+    uint32_t pad = (spec->width > length) ? (spec->width - length) : 0u;
+
+    if (0u == (spec->flags & CONSOLE_FMT_LEFT))
+    {
+        console_fmt_pad(out, ' ', pad);
+    }
+    console_fmt_put(out, text, length);
+    if (0u != (spec->flags & CONSOLE_FMT_LEFT))
+    {
+        console_fmt_pad(out, ' ', pad);
+    }
+}
+
+
+/* [] END OF FILE */
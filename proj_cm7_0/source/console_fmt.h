@@ -0,0 +1,80 @@
+/******************************************************************************
+* File Name:   console_fmt.h
+*
+* Description: Integer-only formatter of the console output, in place of the
+*              formatted I/O of the C library on the hot paths. It handles
+*              the conversions d, i, u, o, x, X, c, s, p and %% with their
+*              flags, width, precision and length modifiers as the C library
+*              does, and has no floating point. It keeps no state and uses a
+*              fixed, small amount of stack: the output goes to a caller
+*              buffer, which a sink drains when it fills. Only depends on the
+*              C library, so that host tools can check it against the
+*              snprintf of the host.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _CONSOLE_FMT_H_
+#define _CONSOLE_FMT_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Characters of console_fmt_dec() for an int32_t without padding, and of
+ * console_fmt_hex() */
+#define CONSOLE_FMT_DEC_MAX         (11u)
+#define CONSOLE_FMT_HEX_MAX         (8u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Receives the output each time the buffer is full and at the end */
+typedef void (*console_fmt_sink_t)(void *arg, const char *text, uint32_t length);
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern uint32_t console_fmt_vformat(console_fmt_sink_t sink, void *arg, char *buffer, uint32_t size,
+                                    const char *format, va_list args);
+extern uint32_t console_fmt_vsnprintf(char *out, uint32_t size, const char *format, va_list args);
+extern uint32_t console_fmt_snprintf(char *out, uint32_t size, const char *format, ...)
+    __attribute__((format(printf, 3, 4)));
+extern uint32_t console_fmt_dec(char *out, int32_t value, uint32_t width);
+extern uint32_t console_fmt_hex(char *out, uint32_t value, uint32_t digits, bool upper);
+
+#endif
@@ -0,0 +1,306 @@
+/******************************************************************************
+* File Name:   console_ui.c
+*
+* Description: Terminal layout of the console.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "console_ui.h"
+#include "term_screen.h"
+#include "param.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Rows of the fixed area */
+#define CONSOLE_UI_PROMPT_ROW       (3u)
+#define CONSOLE_UI_MENU_ROW         (4u)
+#define CONSOLE_UI_LINK_ROW         (CONSOLE_UI_MENU_ROW + CONSOLE_UI_MENU_ROWS)
+
+/* Width of a menu column */
+#define CONSOLE_UI_MENU_WIDTH       (34u)
+
+/* Output buffer, rendered in pieces; holds a row and the cursor save,
+ * scroll region and restore sequences around it */
+#define CONSOLE_UI_OUT_SIZE         (TERM_SCREEN_ROW_MAX_BYTES + 32u)
+
+#define CONSOLE_UI_SAVE_CURSOR      "\x1b" "7"
+#define CONSOLE_UI_RESTORE_CURSOR   "\x1b" "8"
+#define CONSOLE_UI_RESET_REGION     "\x1b[r"
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static bool console_ui_enabled(void);
+static uint32_t console_ui_flush(bool keep_cursor);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static term_screen_t console_ui_screen;
+static bool console_ui_ready = false;
+
+/* The scroll region is set on the terminal */
+static bool console_ui_region = false;
+
+static char console_ui_out[CONSOLE_UI_OUT_SIZE];
+static console_ui_stats_t console_ui_stats;
+
+
+/*******************************************************************************
+* Function Name: console_ui_menu
+********************************************************************************
+* Summary:
+*  Draws the demo menu with the selected demo marked, blanks the status line
+*  and clears the scrolling rows below, with the cursor at their top. On a
+*  demo switch only the marker moves; the first menu erases the terminal.
+*  Without the console_ui parameter nothing is drawn, and the scroll region
+*  of an earlier menu is removed.
+*
+* Parameters:
+*  names: demo names, shown numbered from 1
+*  count: number of demos, up to 2 * CONSOLE_UI_MENU_ROWS
+*  selected: running demo, from 1
+*  line_bytes: size of the line-based menu that the caller would print
+*
+* Return:
+*  bool: true if the menu was drawn, false if the caller prints its lines
+*
+*******************************************************************************/
+bool console_ui_menu(const char *const *names, uint32_t count, uint32_t selected, uint32_t line_bytes)
+{
+    char line[TERM_SCREEN_COLS + 1u];
+    char *out = console_ui_out;
+    uint32_t length;
+
+    if (!console_ui_enabled())
+    {
+        return false;
+    }
+
+    term_screen_put(&console_ui_screen, 0u, 0u, TERM_SCREEN_COLS,
+                    "******************************************************************");
+    term_screen_put(&console_ui_screen, 1u, 0u, TERM_SCREEN_COLS,
+                    "**  XMC7000 MCU: Running the out-of-the-box (OOB) demo project  **");
+    term_screen_put(&console_ui_screen, 2u, 0u, TERM_SCREEN_COLS,
+                    "******************************************************************");
+    (void)snprintf(line, sizeof(line), "Enter an option from 1 - %lu to run the selected demo:",
+                   (unsigned long)count);
+    term_screen_put(&console_ui_screen, CONSOLE_UI_PROMPT_ROW, 0u, TERM_SCREEN_COLS, line);
+    for (uint32_t index = 0u; (index < count) && (index < (2u * CONSOLE_UI_MENU_ROWS)); index++)
+    {
+        (void)snprintf(line, sizeof(line), "%c %lu. %s", ((index + 1u) == selected) ? '>' : ' ',
+                       (unsigned long)(index + 1u), names[index]);
+        term_screen_put(&console_ui_screen, CONSOLE_UI_MENU_ROW + (index % CONSOLE_UI_MENU_ROWS),
+                        (index / CONSOLE_UI_MENU_ROWS) * CONSOLE_UI_MENU_WIDTH, CONSOLE_UI_MENU_WIDTH, line);
+    }
+    term_screen_put(&console_ui_screen, CONSOLE_UI_LINK_ROW, 0u, TERM_SCREEN_COLS,
+                    "https://github.com/Infineon/Code-Examples-for-ModusToolbox-Software");
+    term_screen_put(&console_ui_screen, CONSOLE_UI_STATUS_ROW, 0u, TERM_SCREEN_COLS, "");
+
+    console_ui_stats.bytes += console_ui_flush(false);
+
+    /* Scrolling rows under the fixed ones, cleared, cursor at their top */
+    length = (uint32_t)snprintf(out, CONSOLE_UI_OUT_SIZE, "\x1b[%lu;%lur\x1b[%lu;1H\x1b[J",
+                                (unsigned long)(CONSOLE_UI_ROWS + 1u), (unsigned long)CONSOLE_UI_TERM_ROWS,
+                                (unsigned long)(CONSOLE_UI_ROWS + 1u));
+    (void)fwrite(out, 1u, length, stdout);
+    (void)fflush(stdout);
+    console_ui_region = true;
+
+    console_ui_stats.renders++;
+    console_ui_stats.bytes += length;
+    console_ui_stats.line_bytes += line_bytes;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: console_ui_status
+********************************************************************************
+* Summary:
+*  Shows a live value on the status line instead of printing a line for it.
+*  Only the characters that differ from the last status are sent, and the
+*  cursor of the scrolling output is restored afterwards.
+*
+* Parameters:
+*  text: status, cut at the terminal width
+*  line_bytes: size of the line the caller would print
+*
+* Return:
+*  bool: true if the status line was updated, false if the caller prints
+*  its line
+*
+*******************************************************************************/
+bool console_ui_status(const char *text, uint32_t line_bytes)
+{
+    if (!console_ui_enabled() || !console_ui_region)
+    {
+        return false;
+    }
+
+    term_screen_put(&console_ui_screen, CONSOLE_UI_STATUS_ROW, 0u, TERM_SCREEN_COLS, text);
+    console_ui_stats.bytes += console_ui_flush(true);
+    console_ui_stats.renders++;
+    console_ui_stats.line_bytes += line_bytes;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: console_ui_invalidate
+********************************************************************************
+* Summary:
+*  Redraws the whole layout, scroll region included, at the next menu: after
+*  the terminal was reset, reconnected or given its full scrolling area
+*  back.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_ui_invalidate(void)
+{
+    term_screen_invalidate(&console_ui_screen);
+    console_ui_region = false;
+}
+
+/*******************************************************************************
+* Function Name: console_ui_get_stats
+********************************************************************************
+* Summary:
+*  Reads the counters of the screen updates, for the ui command.
+*
+* Parameters:
+*  stats: receives the counters and the console_ui parameter
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_ui_get_stats(console_ui_stats_t *stats)
+{
+    *stats = console_ui_stats;
+    stats->enabled = (0u != param_get(PARAM_CONSOLE_UI));
+}
+
+/*******************************************************************************
+* Function Name: console_ui_enabled
+********************************************************************************
+* Summary:
+*  Follows the console_ui parameter: sets up the screen model when it is
+*  set, and gives the terminal its full scrolling area back when it was
+*  cleared.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  bool: the parameter is set
+*
+*******************************************************************************/
+static bool console_ui_enabled(void)
+{
+    if (0u == param_get(PARAM_CONSOLE_UI))
+    {
+        if (console_ui_region)
+        {
+            printf(CONSOLE_UI_RESET_REGION);
+            console_ui_invalidate();
+        }
+        return false;
+    }
+
+    if (!console_ui_ready)
+    {
+        term_screen_init(&console_ui_screen, CONSOLE_UI_ROWS);
+        console_ui_ready = true;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: console_ui_flush
+********************************************************************************
+* Summary:
+*  Sends the changes of the screen model, a few rows at a time.
+*
+* Parameters:
+*  keep_cursor: save the cursor before and restore it after each piece
+*
+* Return:
+*  uint32_t: bytes sent
+*
+*******************************************************************************/
+static uint32_t console_ui_flush(bool keep_cursor)
+{
+    const uint32_t wrap = keep_cursor ? (sizeof(CONSOLE_UI_SAVE_CURSOR) - 1u) : 0u;
+    uint32_t sent = 0u;
+
+    /* The scrolling output moved the cursor since the last flush */
+    term_screen_cursor_moved(&console_ui_screen);
+    while (term_screen_dirty(&console_ui_screen))
+    {
+        uint32_t length = term_screen_render(&console_ui_screen, &console_ui_out[wrap],
+                                             CONSOLE_UI_OUT_SIZE - (2u * wrap));
+
+        if (0u == length)
+        {
+            break;
+        }
+        if (keep_cursor)
+        {
+            memcpy(console_ui_out, CONSOLE_UI_SAVE_CURSOR, wrap);
+            memcpy(&console_ui_out[wrap + length], CONSOLE_UI_RESTORE_CURSOR, wrap);
+            length += 2u * wrap;
+            term_screen_cursor_moved(&console_ui_screen);
+        }
+        (void)fwrite(console_ui_out, 1u, length, stdout);
+        sent += length;
+    }
+    (void)fflush(stdout);
+
+    return sent;
+}
+
+
+/* [] END OF FILE */
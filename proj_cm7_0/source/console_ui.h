@@ -0,0 +1,83 @@
+/******************************************************************************
+* File Name:   console_ui.h
+*
+* Description: Terminal layout of the console when the console_ui parameter
+*              is set: the demo menu and a status line stay at the top of
+*              the terminal, drawn through a screen model (term_screen.c)
+*              that sends only the cells that change, and the output of the
+*              demos scrolls in the rows below. Without the parameter the
+*              console stays line based, as logs and scripts expect.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _CONSOLE_UI_H_
+#define _CONSOLE_UI_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Rows of the terminal assumed, those of a VT100 */
+#define CONSOLE_UI_TERM_ROWS        (24u)
+
+/* Fixed rows at the top: title, prompt, menu in two columns, link, and the
+ * status line; the demos scroll in the rows below */
+#define CONSOLE_UI_MENU_ROWS        (5u)
+#define CONSOLE_UI_STATUS_ROW       (10u)
+#define CONSOLE_UI_ROWS             (CONSOLE_UI_STATUS_ROW + 1u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    bool     enabled;               /* console_ui parameter */
+    uint32_t renders;               /* Menu and status updates drawn */
+    uint32_t bytes;                 /* Bytes they sent */
+    uint32_t line_bytes;            /* Bytes of the line output they replaced */
+} console_ui_stats_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern bool console_ui_menu(const char *const *names, uint32_t count, uint32_t selected, uint32_t line_bytes);
+extern bool console_ui_status(const char *text, uint32_t line_bytes);
+extern void console_ui_invalidate(void);
+extern void console_ui_get_stats(console_ui_stats_t *stats);
+
+#endif
@@ -0,0 +1,341 @@
+/******************************************************************************
+* File Name:   deadline.c
+*
+* Description: Deadline accounting of the watchdog service, see deadline.h.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "deadline.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t deadline_now(const deadline_monitor_t *monitor, uint32_t now_us);
+static bool deadline_pop(deadline_monitor_t *monitor, uint32_t now_us, deadline_miss_t *miss);
+
+
+/* Time on the clock of the runs: it stands still while paused */
+static uint32_t deadline_now(const deadline_monitor_t *monitor, uint32_t now_us)
+{
+    return monitor->paused ? monitor->pause_us : now_us;
+}
+
+/*******************************************************************************
+* Function Name: deadline_pop
+********************************************************************************
+* Summary:
+*  Ends the innermost run, accounts it to its task and stops it from
+*  counting against the runs around it.
+*
+* Parameters:
+*  monitor: monitor with at least one run in progress
+*  now_us: time on the clock of the runs
+*  miss: receives the run if it is over budget and no miss was stored in it
+*        yet, may be NULL
+*
+* Return:
+*  bool: false if the run was over budget
+*
+*******************************************************************************/
+static bool deadline_pop(deadline_monitor_t *monitor, uint32_t now_us, deadline_miss_t *miss)
+{
+    uint32_t level = monitor->depth - 1u;
+    deadline_task_t *task = &monitor->task[monitor->running[level]];
+    uint32_t ran_us = now_us - monitor->start_us[level];
+    bool in_time = (ran_us <= task->budget_us);
+
+    task->runs++;
+    if (ran_us > task->longest_us)
+    {
+        task->longest_us = ran_us;
+    }
+    if (!in_time)
+    {
+        task->misses++;
+        if ((NULL != miss) && (DEADLINE_NO_TASK == miss->task))
+        {
+            miss->task = monitor->running[level];
+            miss->ran_us = ran_us;
+            miss->budget_us = task->budget_us;
+        }
+    }
+
+    /* The runs around it did not run meanwhile */
+    monitor->depth = level;
+    for (uint32_t outer = 0u; outer < level; outer++)
+    {
+        monitor->start_us[outer] += ran_us;
+    }
+
+    return in_time;
+}
+
+/*******************************************************************************
+* Function Name: deadline_init
+********************************************************************************
+* Summary:
+*  Sets the budgets of the tasks and clears the runs and statistics.
+*
+* Parameters:
+*  monitor: monitor to initialize
+*  budget_us: budget of each task, below 2^31 us
+*  count: number of tasks, at most DEADLINE_MAX_TASKS are kept
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void deadline_init(deadline_monitor_t *monitor, const uint32_t *budget_us, uint32_t count)
+{
+    memset(monitor, 0, sizeof(*monitor));
+    monitor->task_count = (count < DEADLINE_MAX_TASKS) ? count : DEADLINE_MAX_TASKS;
+    for (uint32_t index = 0u; index < monitor->task_count; index++)
+    {
+        monitor->task[index].budget_us = budget_us[index];
+    }
+}
+
+/*******************************************************************************
+* Function Name: deadline_begin
+********************************************************************************
+* Summary:
+*  Starts a run of a task, nested in the run in progress if any.
+*
+* Parameters:
+*  monitor: monitor
+*  task: task index
+*  now_us: current time
+*
+* Return:
+*  bool: false if the task does not exist, is already running or the runs
+*  are nested DEADLINE_MAX_DEPTH deep; the run is then not timed
+*
+*******************************************************************************/
+bool deadline_begin(deadline_monitor_t *monitor, uint32_t task, uint32_t now_us)
+{
+    if (task >= monitor->task_count)
+    {
+        return false;
+    }
+    for (uint32_t level = 0u; level < monitor->depth; level++)
+    {
+        if (task == monitor->running[level])
+        {
+            return false;
+        }
+    }
+    if (monitor->depth >= DEADLINE_MAX_DEPTH)
+    {
+        monitor->overflows++;
+        return false;
+    }
+
+    monitor->running[monitor->depth] = (uint8_t)task;
+    monitor->start_us[monitor->depth] = deadline_now(monitor, now_us);
+    monitor->depth++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: deadline_end
+********************************************************************************
+* Summary:
+*  Ends the run of a task. Runs still in progress inside it end with it.
+*
+* Parameters:
+*  monitor: monitor
+*  task: task index
+*  now_us: current time
+*  miss: receives the innermost run that was over budget, task
+*        DEADLINE_NO_TASK if none; may be NULL
+*
+* Return:
+*  bool: false if a run ended over budget, true as well if the task was not
+*  running
+*
+*******************************************************************************/
+bool deadline_end(deadline_monitor_t *monitor, uint32_t task, uint32_t now_us, deadline_miss_t *miss)
+{
+    bool in_time = true;
+    uint32_t level = monitor->depth;
+
+    if (NULL != miss)
+    {
+        miss->task = DEADLINE_NO_TASK;
+        miss->ran_us = 0u;
+        miss->budget_us = 0u;
+    }
+    while ((0u != level) && (task != monitor->running[level - 1u]))
+    {
+        level--;
+    }
+    if (0u == level)
+    {
+        return true;
+    }
+
+    now_us = deadline_now(monitor, now_us);
+    while (monitor->depth >= level)
+    {
+        if (!deadline_pop(monitor, now_us, miss))
+        {
+            in_time = false;
+        }
+    }
+
+    return in_time;
+}
+
+/*******************************************************************************
+* Function Name: deadline_checkin
+********************************************************************************
+* Summary:
+*  Ends the run of a periodic task, if it was running, and starts the next.
+*
+* Parameters:
+*  monitor: monitor
+*  task: task index
+*  now_us: current time
+*  miss: as for deadline_end()
+*
+* Return:
+*  bool: false if the run that ended was over budget
+*
+*******************************************************************************/
+bool deadline_checkin(deadline_monitor_t *monitor, uint32_t task, uint32_t now_us, deadline_miss_t *miss)
+{
+    bool in_time = deadline_end(monitor, task, now_us, miss);
+
+    (void)deadline_begin(monitor, task, now_us);
+
+    return in_time;
+}
+
+/*******************************************************************************
+* Function Name: deadline_check
+********************************************************************************
+* Summary:
+*  Checks the innermost run in progress against its budget. The runs around
+*  it are stopped, so they cannot miss their deadline meanwhile. Does not
+*  change the monitor, so an interrupt handler may call it.
+*
+* Parameters:
+*  monitor: monitor
+*  now_us: current time
+*  run: receives the innermost run so far, task DEADLINE_NO_TASK if none
+*
+* Return:
+*  bool: false if that run is over budget
+*
+*******************************************************************************/
+bool deadline_check(const deadline_monitor_t *monitor, uint32_t now_us, deadline_miss_t *run)
+{
+    uint32_t level;
+
+    run->task = DEADLINE_NO_TASK;
+    run->ran_us = 0u;
+    run->budget_us = 0u;
+    if (0u == monitor->depth)
+    {
+        return true;
+    }
+
+    level = monitor->depth - 1u;
+    run->task = monitor->running[level];
+    run->ran_us = deadline_now(monitor, now_us) - monitor->start_us[level];
+    run->budget_us = monitor->task[run->task].budget_us;
+
+    return (run->ran_us <= run->budget_us);
+}
+
+/*******************************************************************************
+* Function Name: deadline_pause
+********************************************************************************
+* Summary:
+*  Stops the clock of the runs, for a wait that is not part of any task such
+*  as a low-power mode.
+*
+* Parameters:
+*  monitor: monitor
+*  now_us: current time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void deadline_pause(deadline_monitor_t *monitor, uint32_t now_us)
+{
+    if (!monitor->paused)
+    {
+        monitor->paused = true;
+        monitor->pause_us = now_us;
+    }
+}
+
+/*******************************************************************************
+* Function Name: deadline_resume
+********************************************************************************
+* Summary:
+*  Restarts the clock of the runs after deadline_pause(). The pause does not
+*  count against any run.
+*
+* Parameters:
+*  monitor: monitor
+*  now_us: current time
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void deadline_resume(deadline_monitor_t *monitor, uint32_t now_us)
+{
+    uint32_t paused_us;
+
+    if (monitor->paused)
+    {
+        paused_us = now_us - monitor->pause_us;
+        for (uint32_t level = 0u; level < monitor->depth; level++)
+        {
+            monitor->start_us[level] += paused_us;
+        }
+        monitor->paused = false;
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,108 @@
+/******************************************************************************
+* File Name:   deadline.h
+*
+* Description: Deadline accounting of the watchdog service (watchdog.h). Each
+*              task has a budget, the longest run it may take. A run starts
+*              with deadline_begin() or deadline_checkin() and ends with
+*              deadline_end() or the next check-in. Runs nest: a task started
+*              inside another one stops the clock of the outer task until it
+*              ends, so each budget only covers the task's own work, and only
+*              the innermost run can miss its deadline. Times are the
+*              microseconds of a free-running 32-bit counter given by the
+*              caller. Only depends on the C library, so that the host can
+*              check the accounting.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _DEADLINE_H_
+#define _DEADLINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Tasks of a monitor, and runs nested in one another */
+#define DEADLINE_MAX_TASKS          (8u)
+#define DEADLINE_MAX_DEPTH          (4u)
+
+/* Task of a deadline_miss_t when no run is in progress */
+#define DEADLINE_NO_TASK            (0xFFu)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Budget and run statistics of one task */
+typedef struct
+{
+    uint32_t budget_us;             /* Longest run allowed, below 2^31 */
+    uint32_t runs;                  /* Runs ended */
+    uint32_t longest_us;            /* Longest run ended */
+    uint32_t misses;                /* Runs ended over the budget */
+} deadline_task_t;
+
+typedef struct
+{
+    deadline_task_t task[DEADLINE_MAX_TASKS];
+    uint32_t task_count;
+    uint32_t depth;                         /* Runs in progress */
+    uint8_t  running[DEADLINE_MAX_DEPTH];   /* Their tasks, the innermost last */
+    uint32_t start_us[DEADLINE_MAX_DEPTH];  /* Their starts, moved on by nested runs and pauses */
+    uint32_t overflows;                     /* Runs not timed, nested too deep */
+    bool     paused;
+    uint32_t pause_us;
+} deadline_monitor_t;
+
+/* A run, in progress or ended */
+typedef struct
+{
+    uint32_t task;                  /* DEADLINE_NO_TASK if none */
+    uint32_t ran_us;
+    uint32_t budget_us;
+} deadline_miss_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void deadline_init(deadline_monitor_t *monitor, const uint32_t *budget_us, uint32_t count);
+extern bool deadline_begin(deadline_monitor_t *monitor, uint32_t task, uint32_t now_us);
+extern bool deadline_end(deadline_monitor_t *monitor, uint32_t task, uint32_t now_us, deadline_miss_t *miss);
+extern bool deadline_checkin(deadline_monitor_t *monitor, uint32_t task, uint32_t now_us, deadline_miss_t *miss);
+extern bool deadline_check(const deadline_monitor_t *monitor, uint32_t now_us, deadline_miss_t *run);
+extern void deadline_pause(deadline_monitor_t *monitor, uint32_t now_us);
+extern void deadline_resume(deadline_monitor_t *monitor, uint32_t now_us);
+
+#endif
@@ -44,6 +44,7 @@
 * Include header files
 ******************************************************************************/
 #include <stdio.h>
+#include <string.h>
 #include "cy_pdl.h"
 #include "cycfg.h"
 #include "cybsp.h"
@@ -51,23 +52,40 @@
 #include "print_message.h"
 #include "button.h"
 #include "oob_demo.h"
+#include "profiler.h"
+#include "pin.h"
+#include "placement.h"
+#include "resource_manager.h"
+#include "param.h"
+#include "console_fmt.h"
+#include "io_client.h"
+#include "block_pool.h"
+#include "mem_config.h"
+#include "watchdog.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
 
-
-/* CAN channel number */
-# if defined(KIT_XMC71_V1) || defined(KIT_XMC71_V2)
-#define CAN_HW_CHANNEL          0
-#else
-#define CAN_HW_CHANNEL          1
-#endif
 #define CAN_BUFFER_INDEX        0
-/* CAN address*/
-#define CAN_ID                  1
-/* CAN data length code, frame has 8 data bytes in this example */
-#define CAN_DLC                 8
+/* Owner of the LED and transceiver standby pin in the resource manager */
+#define CANFD_OWNER             "canfd"
+
+/* Received data line: the head, " 0x%x " for each of up to 15 bytes of a
+ * 4-bit DLC, and two line ends */
+#define CANFD_RX_DATA_HEAD      "Rx Data : "
+#define CANFD_RX_LINE_SIZE      (sizeof(CANFD_RX_DATA_HEAD) + (15u * 6u) + 4u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Frame received by canfd_rx_callback(), in a block of canfd_rx_pool */
+typedef struct
+{
+    uint32_t id;
+    uint32_t dlc;
+    uint8_t  data[CY_CANFD_DATA_ELEMENTS_MAX];
+} canfd_rx_frame_t;
 
 
 /*******************************************************************************
@@ -90,12 +108,9 @@ cy_stc_sysint_t canfd_irq_cfg =
 /* This is a shared context structure, unique for each canfd channel */
 cy_stc_canfd_context_t canfd_context; 
 
-/* Variable CANFD receive interrupt status */
-bool canfdRevIntrFlag = false;
-
 
 /* Array to hold the data bytes of the CANFD frame */
-uint8_t canfd_data_buffer[CY_CANFD_DATA_ELEMENTS_MAX];
+PLACE_DTCM uint8_t canfd_data_buffer[CY_CANFD_DATA_ELEMENTS_MAX];
 
 const uint32_t CANFD_OriginalData[] =
 {
@@ -103,10 +118,12 @@ const uint32_t CANFD_OriginalData[] =
     [CANFD_DATA_1] = 0x08070605U,
 };
 
-/* Variable to hold the data length code of the CANFD frame */
-int canfd_dlc;
-/* Variable to hold the Identifier of the CANFD frame */
-int canfd_id;
+/* Received frames on their way from the interrupt handler to the main loop */
+BLOCK_POOL_DEFINE(canfd_rx_pool, sizeof(canfd_rx_frame_t), MEM_CONFIG_CANFD_RX_BLOCKS);
+BLOCK_QUEUE_DEFINE(canfd_rx_queue, MEM_CONFIG_CANFD_RX_BLOCKS);
+
+PROFILER_ZONE_DEFINE(canfd_rx_callback);
+PROFILER_COUNTER_DEFINE(canfd_rx_frames);
 /*******************************************************************************
 * Function Name: main
 ********************************************************************************
@@ -127,6 +144,10 @@ int canfd_id;
 int main_canfd(void)
 {
     cy_en_canfd_status_t status;
+    cy_rslt_t result;
+    char line[CANFD_RX_LINE_SIZE];
+    uint32_t length;
+    canfd_rx_frame_t *frame;
 
     printf("****************** Running CAN FD loopback demo ******************\r\n");
     printf("In this demo, to send 8-bytes CAN FD frame, connect the CAN FD analyzer \r\n");
@@ -139,12 +160,30 @@ int main_canfd(void)
     printf("\r\n");
 
     /* Setting device Identifier and send buffer*/
-    CANFD_T0RegisterBuffer_0.id = CAN_ID;
+    CANFD_T0RegisterBuffer_0.id = param_get(PARAM_CAN_ID);
     CANFD_txBuffer_0.data_area_f = (uint32_t *)canfd_data_buffer;
     /*Initialize USER_BTN1*/
     button1_initial();
-    cyhal_gpio_init(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_OFF);
-    cyhal_gpio_init(CYBSP_CANFD_STB, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_ON);
+    result = resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG,
+                                           CYBSP_LED_STATE_OFF, CANFD_OWNER);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = resource_manager_gpio_acquire(CYBSP_CANFD_STB, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG,
+                                               CYBSP_LED_STATE_ON, CANFD_OWNER);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("The user LED or the CAN transceiver pin is not available, error 0x%08lx. Select another demo.\r\n",
+               (unsigned long)result);
+        button1_free();
+        resource_manager_gpio_release(CYBSP_USER_LED1, CANFD_OWNER);
+        resource_manager_gpio_release(CYBSP_CANFD_STB, CANFD_OWNER);
+        return 0;
+    }
+
+    /* Empty frame pool and queue before the first reception */
+    block_pool_init(&canfd_rx_pool);
+    block_queue_reset(&canfd_rx_queue);
 
     /* Hook the interrupt service routine and enable the interrupt */
     (void) Cy_SysInt_Init(&canfd_irq_cfg, &isr_canfd);
@@ -157,26 +196,34 @@ int main_canfd(void)
         CY_ASSERT(0);
     }
 
-    while(!evtSwitch)
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
     {
-        if(button1_intr_event == true)
+        /* Sleep until a frame, a press or a demo switch. A pending press
+         * keeps polling for the button release, which raises no interrupt. */
+        if (0u == event_flags_test(&demo_events, EVT_BUTTON1))
+        {
+            watchdog_end(WATCHDOG_TASK_DEMO);
+            event_flags_wait_any(&demo_events, EVT_DEMO_SWITCH | EVT_BUTTON1 | EVT_CANFD_RX, false);
+        }
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+
+        if (0u != event_flags_test(&demo_events, EVT_BUTTON1))
          {
-             if(button1_Hysfilter_flag == false)
+             if (0u == event_flags_test(&demo_events, EVT_BUTTON1_FILTERED))
              {
                  /* Hysteresis filter */
                  Cy_SysLib_Delay(10u);
-                 button1_Hysfilter_flag = true;
+                 event_flags_set(&demo_events, EVT_BUTTON1_FILTERED);
              }
              /* wait for button release*/
              if(cyhal_gpio_read(CYBSP_USER_BTN1) == true)
              {
                  /* Assign the user defined data buffer to CANFD data area */
                  memcpy(canfd_data_buffer, CANFD_OriginalData, sizeof(CANFD_OriginalData));
-                 CANFD_txBuffer_0.t1_f->dlc = CAN_DLC;
-                 if(button1_intr_event == true)
+                 CANFD_txBuffer_0.t1_f->dlc = param_get(PARAM_CAN_DLC);
+                 if (0u != event_flags_take(&demo_events, EVT_BUTTON1))
                  {
-                     button1_intr_event = false;
-                     button1_Hysfilter_flag = false;
+                     event_flags_clear(&demo_events, EVT_BUTTON1_FILTERED);
                      /* Enable interrupt */
                      cyhal_gpio_register_callback(CYBSP_USER_BTN1, &btn1_callback_data);
                  }
@@ -190,33 +237,43 @@ int main_canfd(void)
                 printf("CAN FD frame sent\r\n\r\n");
              }
         }
-        if(canfdRevIntrFlag == true)
+        if (0u != event_flags_take(&demo_events, EVT_CANFD_RX))
         {
-            canfdRevIntrFlag = false;
-            printf("%d bytes received  with identifier %d\r\n\r\n",
-                                                        canfd_dlc,
-                                                        canfd_id);
-
-            printf("Rx Data : ");
-            for (uint8_t msg_idx = 0; msg_idx < canfd_dlc; msg_idx++)
+            /* Every frame received since the last pass, oldest first */
+            while (NULL != (frame = block_queue_pop(&canfd_rx_queue)))
             {
-                printf(" 0x%x ", canfd_data_buffer[msg_idx]);
-                canfd_data_buffer[msg_idx]+=1;
+                console_printf("%d bytes received  with identifier %d\r\n\r\n",
+                                                            (int)frame->dlc,
+                                                            (int)frame->id);
+
+                /* The whole line is built with the hex fast path and sent once */
+                length = sizeof(CANFD_RX_DATA_HEAD) - 1u;
+                memcpy(line, CANFD_RX_DATA_HEAD, length);
+                for (uint8_t msg_idx = 0; msg_idx < frame->dlc; msg_idx++)
+                {
+                    memcpy(&line[length], " 0x", 3u);
+                    length += 3u;
+                    length += console_fmt_hex(&line[length], frame->data[msg_idx], 1u, false);
+                    line[length++] = ' ';
+                    canfd_data_buffer[msg_idx] = frame->data[msg_idx] + 1u;
+                }
+                memcpy(&line[length], "\r\n\r\n", 4u);
+                io_client_write(line, length + 4u);
+                CANFD_txBuffer_0.t1_f->dlc = frame->dlc;
+                (void)block_pool_free(&canfd_rx_pool, frame);
+                /* Sending CANFD frame to other node */
+                status = Cy_CANFD_UpdateAndTransmitMsgBuffer(CANFD_HW,
+                                                        CAN_HW_CHANNEL,
+                                                        &CANFD_txBuffer_0,
+                                                        CAN_BUFFER_INDEX,
+                                                        &canfd_context);
             }
-            printf("\r\n\r\n");
-            CANFD_txBuffer_0.t1_f->dlc = canfd_dlc;
-            /* Sending CANFD frame to other node */
-            status = Cy_CANFD_UpdateAndTransmitMsgBuffer(CANFD_HW,
-                                                    CAN_HW_CHANNEL,
-                                                    &CANFD_txBuffer_0,
-                                                    CAN_BUFFER_INDEX,
-                                                    &canfd_context);
         }
     }
     Cy_CANFD_DeInit(CANFD_HW, CAN_HW_CHANNEL, &canfd_context);
-    cyhal_gpio_free(CYBSP_USER_BTN1);
-    cyhal_gpio_free(CYBSP_USER_LED1);
-    cyhal_gpio_free(CYBSP_CANFD_STB);
+    button1_free();
+    resource_manager_gpio_release(CYBSP_USER_LED1, CANFD_OWNER);
+    resource_manager_gpio_release(CYBSP_CANFD_STB, CANFD_OWNER);
     return 0;
 }
 
@@ -231,7 +288,7 @@ int main_canfd(void)
 *    
 *
 *******************************************************************************/
-void isr_canfd(void)
+PLACE_ITCM void isr_canfd(void)
 {
     /* Just call the IRQ handler with the current channel number and context */
     Cy_CANFD_IrqHandler(CANFD_HW, CAN_HW_CHANNEL, &canfd_context);
@@ -249,11 +306,13 @@ void isr_canfd(void)
 *    basemsg                        Message buffer
 *
 *******************************************************************************/
-void canfd_rx_callback (bool                        rxFIFOMsg, 
+PLACE_ITCM void canfd_rx_callback (bool                        rxFIFOMsg, 
                         uint8_t                     msgBufOrRxFIFONum, 
                         cy_stc_canfd_rx_buffer_t*   basemsg)
 {
+    canfd_rx_frame_t *frame;
 
+    PROFILER_ZONE_BEGIN(canfd_rx_callback);
 
     /* Message was received in Rx FIFO */
     if (rxFIFOMsg == true)
@@ -262,17 +321,25 @@ void canfd_rx_callback (bool                        rxFIFOMsg,
         if(CY_CANFD_RTR_DATA_FRAME == basemsg->r0_f->rtr) 
         {
             /* Toggle the user LED */
-            cyhal_gpio_toggle(CYBSP_USER_LED1);
-            /* Get the CAN DLC and ID from received message */
-            canfd_dlc = basemsg->r1_f->dlc;
-            canfd_id  = basemsg->r0_f->id;
-            memcpy(canfd_data_buffer, basemsg->data_area_f, canfd_dlc);
-            /* Print the received message by UART */
-            canfdRevIntrFlag = true;
+            PIN_INV(CYBSP_USER_LED1);
+            /* Queue the frame for the main loop; with the pool exhausted it
+             * is dropped and counted in the pool statistics */
+            frame = block_pool_alloc(&canfd_rx_pool);
+            if (NULL != frame)
+            {
+                frame->dlc = basemsg->r1_f->dlc;
+                frame->id  = basemsg->r0_f->id;
+                memcpy(frame->data, basemsg->data_area_f, frame->dlc);
+                (void)block_queue_push(&canfd_rx_queue, frame);
+                /* Print the received message by UART */
+                event_flags_set(&demo_events, EVT_CANFD_RX);
+            }
+            PROFILER_COUNT(canfd_rx_frames, 1u);
         }
     }
     /* These parameters are not used in this snippet */
     (void)msgBufOrRxFIFONum;
+    PROFILER_ZONE_END(canfd_rx_callback);
 }
 
 /* [] END OF FILE */
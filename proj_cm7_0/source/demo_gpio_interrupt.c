@@ -45,6 +45,16 @@
 #include "cybsp.h"
 #include "print_message.h"
 #include "oob_demo.h"
+#include "latency.h"
+#include "pin.h"
+#include "placement.h"
+#include "resource_manager.h"
+#include "param.h"
+#include "edge_capture.h"
+#include "edge_stats.h"
+#include "watchdog.h"
+#include "button.h"
+#include "io_client.h"
 
 
 /******************************************************************************
@@ -52,24 +62,59 @@
  *****************************************************************************/
 #define GPIO_INTERRUPT_PRIORITY   (7u)
 
+/* Console command running the interrupt latency harness */
+#define GPIO_CMD_LATENCY          'l'
+
+/* Console commands starting and stopping the edge capture of the button of
+ * the edge_input parameter, and exporting the last periods read */
+#define GPIO_CMD_EDGE             'e'
+#define GPIO_CMD_EDGE_EXPORT      'x'
+
+/* Edge capture: period of the ring reads, short enough for the ring to hold
+ * the periods of a 400 kHz input, and of the statistics */
+#define GPIO_EDGE_POLL_MS         (2u)
+#define GPIO_EDGE_REPORT_MS       (500u)
+
+/* Owner of the LED and buttons in the resource manager */
+#define GPIO_INTR_OWNER           "gpio_interrupt"
+
+/* Events that end the sleep of the demo loop. With IO_COPROCESSOR=1 the
+ * buttons belong to CM0+, which forwards the debounced presses. */
+#if IO_COPROCESSOR
+#define GPIO_INTR_EVENTS          (EVT_DEMO_SWITCH | EVT_CONSOLE_KEY | EVT_BUTTON1 | EVT_BUTTON2)
+#else
+#define GPIO_INTR_EVENTS          (EVT_DEMO_SWITCH | EVT_CONSOLE_KEY | EVT_GPIO1 | EVT_GPIO2)
+#endif /* IO_COPROCESSOR */
+
 
 /*******************************************************************************
 * Function Prototypes
 ********************************************************************************/
+#if !IO_COPROCESSOR
 static void gpio1_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event);
 static void gpio2_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event);
+#endif /* !IO_COPROCESSOR */
+static void gpio_edge_capture(void);
+static void gpio_edge_report(const edge_stats_t *stats);
+static void gpio_edge_export(uint32_t count);
 
 /*******************************************************************************
 * Global Variables
 ********************************************************************************/
-volatile bool gpio1_intr_flag = false;               // Button 1 interrupt flag
-volatile bool gpio1_Hysfilter_flag = false;          // Hysteresis filter 1 flag
+bool gpio1_Hysfilter_flag = false;                   // Hysteresis filter 1 flag
 cyhal_gpio_callback_data_t gpio1_btn_callback_data;  // user button1 call back data
 
-volatile bool gpio2_intr_flag = false;               // Button 2 interrupt flag
-volatile bool gpio2_Hysfilter_flag = false;          // Hysteresis filter 2 flag
+bool gpio2_Hysfilter_flag = false;                   // Hysteresis filter 2 flag
 cyhal_gpio_callback_data_t gpio2_btn_callback_data;  // user button2 call back data
 
+/* Capture inputs of the buttons, by edge_input - 1 */
+static const edge_capture_input_t gpio_edge_inputs[] = { EDGE_CAPTURE_INPUT_BTN1, EDGE_CAPTURE_INPUT_BTN2 };
+
+/* Last periods read from the capture ring */
+static uint32_t gpio_edge_rise[EDGE_CAPTURE_RING_SIZE];
+static uint32_t gpio_edge_fall[EDGE_CAPTURE_RING_SIZE];
+static uint32_t gpio_edge_next[EDGE_CAPTURE_RING_SIZE];
+
 /*******************************************************************************
 * Function Name: main
 ********************************************************************************
@@ -88,24 +133,45 @@ int main_gpio_interrupt(void)
     printf("****************** Running GPIO interrupt demo ******************\r\n");
     printf("GPIO Interrupt demo started successfully. \r\n");
     printf("Press the USER BTN1 button to turn off USER LED and press the USER BTN2 button to turn on USER LED. \r\n");
+    printf("Press 'l' to measure the interrupt latency. \r\n");
+    printf("Press 'e' to capture the edges of the button of the edge_input parameter. \r\n");
     printf("\r\n");
     /* Initialize the User LED */
-    cyhal_gpio_init(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_OFF);
-
-    /* Initialize the user button */
-    result = cyhal_gpio_init(CYBSP_USER_BTN1, CYHAL_GPIO_DIR_INPUT,
-                                    CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
-    if (result != CY_RSLT_SUCCESS)
+    result = resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG,
+                                           CYBSP_LED_STATE_OFF, GPIO_INTR_OWNER);
+#if !IO_COPROCESSOR
+    /* Initialize the user buttons */
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = resource_manager_gpio_acquire(CYBSP_USER_BTN1, CYHAL_GPIO_DIR_INPUT, CYHAL_GPIO_DRIVE_PULLUP,
+                                               CYBSP_BTN_OFF, GPIO_INTR_OWNER);
+    }
+    if (CY_RSLT_SUCCESS == result)
     {
-        CY_ASSERT(0);
+        result = resource_manager_gpio_acquire(CYBSP_USER_BTN2, CYHAL_GPIO_DIR_INPUT, CYHAL_GPIO_DRIVE_PULLUP,
+                                               CYBSP_BTN_OFF, GPIO_INTR_OWNER);
     }
-    result = cyhal_gpio_init(CYBSP_USER_BTN2, CYHAL_GPIO_DIR_INPUT,
-                                    CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
-    if (result != CY_RSLT_SUCCESS)
+#endif /* !IO_COPROCESSOR */
+    if (CY_RSLT_SUCCESS != result)
     {
-        CY_ASSERT(0);
+        printf("The user LED or buttons are not available, error 0x%08lx. Select another demo.\r\n",
+               (unsigned long)result);
+#if !IO_COPROCESSOR
+        resource_manager_gpio_release(CYBSP_USER_BTN1, GPIO_INTR_OWNER);
+        resource_manager_gpio_release(CYBSP_USER_BTN2, GPIO_INTR_OWNER);
+#endif /* !IO_COPROCESSOR */
+        resource_manager_gpio_release(CYBSP_USER_LED1, GPIO_INTR_OWNER);
+        return 0;
     }
 
+#if IO_COPROCESSOR
+    /* Take the presses of the buttons from CM0+ */
+    button1_initial();
+    button2_initial();
+
+    /* Turn on LEDs by system default status */
+    PIN_WRITE(CYBSP_USER_LED1, LED_ON);
+#else
     /* Configure GPIO1 interrupt */
     gpio1_btn_callback_data.callback = gpio1_interrupt_handler;
     cyhal_gpio_register_callback(CYBSP_USER_BTN1, &gpio1_btn_callback_data);
@@ -116,12 +182,48 @@ int main_gpio_interrupt(void)
     cyhal_gpio_enable_event(CYBSP_USER_BTN2, CYHAL_GPIO_IRQ_FALL, GPIO_INTERRUPT_PRIORITY, true);
 
     /* Turn on LEDs by system default status */
-    gpio2_intr_flag = true;
+    event_flags_set(&demo_events, EVT_GPIO2);
+#endif /* IO_COPROCESSOR */
 
-    while(!evtSwitch)
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
     {
+        /* Sleep until the next event. A pending press keeps polling for the
+         * button release, which raises no interrupt. */
+        if (0u == event_flags_test(&demo_events, EVT_GPIO1 | EVT_GPIO2))
+        {
+            watchdog_end(WATCHDOG_TASK_DEMO);
+            event_flags_wait_any(&demo_events, GPIO_INTR_EVENTS, false);
+        }
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+
+        if (0u != event_flags_take(&demo_events, EVT_CONSOLE_KEY))
+        {
+            if (GPIO_CMD_LATENCY == recCmd)
+            {
+                recCmd = CMD_DEFAULT;
+                latency_run();
+            }
+            else if (GPIO_CMD_EDGE == recCmd)
+            {
+                recCmd = CMD_DEFAULT;
+                gpio_edge_capture();
+            }
+        }
+#if IO_COPROCESSOR
+        /* The presses forwarded by CM0+ are already debounced and released */
+        if (0u != event_flags_take(&demo_events, EVT_BUTTON1))
+        {
+            PIN_WRITE(CYBSP_USER_LED1, LED_OFF);
+            printf("USER LED turned OFF\r\n");
+        }
+        if (0u != event_flags_take(&demo_events, EVT_BUTTON2))
+        {
+            PIN_WRITE(CYBSP_USER_LED1, LED_ON);
+            printf("USER LED turned ON\r\n");
+        }
+#else
         /* Check the interrupt status */
-        if (true == gpio1_intr_flag)
+        if (0u != event_flags_test(&demo_events, EVT_GPIO1))
         {
             if(gpio1_Hysfilter_flag == false)
             {
@@ -133,15 +235,15 @@ int main_gpio_interrupt(void)
             if(cyhal_gpio_read(CYBSP_USER_BTN1) == true)
             {
 
-                gpio1_intr_flag = false;
+                event_flags_clear(&demo_events, EVT_GPIO1);
                 gpio1_Hysfilter_flag = false;
                 /* Enable interrupt */
                 cyhal_gpio_register_callback(CYBSP_USER_BTN1, &gpio1_btn_callback_data);
-                cyhal_gpio_write(CYBSP_USER_LED1, LED_OFF);
+                PIN_WRITE(CYBSP_USER_LED1, LED_OFF);
                 printf("USER LED turned OFF\r\n");
             }
         }
-        if (true == gpio2_intr_flag)
+        if (0u != event_flags_test(&demo_events, EVT_GPIO2))
         {
 
             if(gpio2_Hysfilter_flag == false)
@@ -153,25 +255,188 @@ int main_gpio_interrupt(void)
             /* wait for button release*/
             if(cyhal_gpio_read(CYBSP_USER_BTN2) == true)
             {
-                gpio2_intr_flag = false;
+                event_flags_clear(&demo_events, EVT_GPIO2);
                 gpio2_Hysfilter_flag = true;
                 /* Enable interrupt */
                 cyhal_gpio_register_callback(CYBSP_USER_BTN2, &gpio2_btn_callback_data);
-                cyhal_gpio_write(CYBSP_USER_LED1, LED_ON);
+                PIN_WRITE(CYBSP_USER_LED1, LED_ON);
                 printf("USER LED turned ON\r\n");
             }
 
         }
+#endif /* IO_COPROCESSOR */
     }
 
-    cyhal_gpio_free(CYBSP_USER_BTN1);
-    cyhal_gpio_free(CYBSP_USER_BTN2);
-    cyhal_gpio_free(CYBSP_USER_LED1);
+#if IO_COPROCESSOR
+    button1_free();
+    button2_free();
+#else
+    resource_manager_gpio_release(CYBSP_USER_BTN1, GPIO_INTR_OWNER);
+    resource_manager_gpio_release(CYBSP_USER_BTN2, GPIO_INTR_OWNER);
+#endif /* IO_COPROCESSOR */
+    resource_manager_gpio_release(CYBSP_USER_LED1, GPIO_INTR_OWNER);
 
     return 0;
 }
 
 
+/*******************************************************************************
+* Function Name: gpio_edge_capture
+********************************************************************************
+* Summary:
+*  Captures the edges of a button with the TCPWM timestamps and prints the
+*  frequency, duty cycle and pulse widths every GPIO_EDGE_REPORT_MS. The
+*  falling edge interrupt of the button is off meanwhile, so that a fast
+*  signal on the pin does not flood the demo loop. Returns on 'e' or when
+*  another demo is selected.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void gpio_edge_capture(void)
+{
+    const edge_capture_input_t *input = &gpio_edge_inputs[param_get(PARAM_EDGE_INPUT) - 1u];
+    edge_stats_t stats;
+    uint32_t last = 0u;
+    uint32_t waited_ms = 0u;
+    cy_rslt_t result;
+
+    if (IO_COPROCESSOR)
+    {
+        printf("The buttons belong to the CM0+ I/O co-processor. Build with IO_COPROCESSOR=0 to capture their edges.\r\n");
+        return;
+    }
+
+    cyhal_gpio_enable_event(input->pin, CYHAL_GPIO_IRQ_FALL, GPIO_INTERRUPT_PRIORITY, false);
+    result = edge_capture_init(input);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("Edge capture failed. Error: 0x%08lx\r\n", (unsigned long)result);
+        cyhal_gpio_enable_event(input->pin, CYHAL_GPIO_IRQ_FALL, GPIO_INTERRUPT_PRIORITY, true);
+        return;
+    }
+    printf("Capturing the edges of USER BTN%lu. Press 'x' to export the last periods read, 'e' to stop.\r\n",
+           (unsigned long)param_get(PARAM_EDGE_INPUT));
+    edge_stats_reset(&stats);
+
+    while (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
+    {
+        uint32_t count;
+
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+        event_flags_idle();
+        cyhal_system_delay_ms(GPIO_EDGE_POLL_MS);
+        waited_ms += GPIO_EDGE_POLL_MS;
+
+        count = edge_capture_read(gpio_edge_rise, gpio_edge_fall, gpio_edge_next, EDGE_CAPTURE_RING_SIZE);
+        if (0u != count)
+        {
+            edge_stats_add(&stats, gpio_edge_rise, gpio_edge_fall, gpio_edge_next, count);
+            last = count;
+        }
+        if (waited_ms >= GPIO_EDGE_REPORT_MS)
+        {
+            gpio_edge_report(&stats);
+            edge_stats_reset(&stats);
+            waited_ms = 0u;
+        }
+
+        if (0u != event_flags_take(&demo_events, EVT_CONSOLE_KEY))
+        {
+            if (GPIO_CMD_EDGE_EXPORT == recCmd)
+            {
+                recCmd = CMD_DEFAULT;
+                gpio_edge_export(last);
+            }
+            else if (GPIO_CMD_EDGE == recCmd)
+            {
+                recCmd = CMD_DEFAULT;
+                break;
+            }
+        }
+    }
+
+    edge_capture_free();
+    cyhal_gpio_enable_event(input->pin, CYHAL_GPIO_IRQ_FALL, GPIO_INTERRUPT_PRIORITY, true);
+    printf("Edge capture stopped\r\n");
+}
+
+/*******************************************************************************
+* Function Name: gpio_edge_report
+********************************************************************************
+* Summary:
+*  Prints the statistics of the periods since the last report and the edge
+*  counts of the capture, which are restarted.
+*
+* Parameters:
+*  stats: statistics of the periods
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void gpio_edge_report(const edge_stats_t *stats)
+{
+    edge_capture_counts_t counts;
+    uint32_t duty;
+
+    edge_capture_get_counts(&counts, true);
+    if (0u == stats->periods)
+    {
+        printf("Edges: no period, %lu edges, %lu missed, %lu dropped\r\n", (unsigned long)counts.edges,
+               (unsigned long)counts.missed, (unsigned long)counts.dropped);
+        return;
+    }
+
+    duty = edge_stats_duty_permille(stats);
+    printf("Edges: %lu Hz, duty %lu.%lu %%, high %lu/%lu/%lu ns, period %lu/%lu ns, "
+           "%lu periods, %lu missed, %lu dropped\r\n",
+           (unsigned long)edge_stats_frequency_hz(stats, EDGE_CAPTURE_CLOCK_HZ),
+           (unsigned long)(duty / 10u), (unsigned long)(duty % 10u),
+           (unsigned long)edge_stats_ticks_to_ns(stats->high_min, EDGE_CAPTURE_CLOCK_HZ),
+           (unsigned long)edge_stats_ticks_to_ns(stats->high_total / stats->periods, EDGE_CAPTURE_CLOCK_HZ),
+           (unsigned long)edge_stats_ticks_to_ns(stats->high_max, EDGE_CAPTURE_CLOCK_HZ),
+           (unsigned long)edge_stats_ticks_to_ns(stats->period_min, EDGE_CAPTURE_CLOCK_HZ),
+           (unsigned long)edge_stats_ticks_to_ns(stats->period_max, EDGE_CAPTURE_CLOCK_HZ),
+           (unsigned long)stats->periods, (unsigned long)counts.missed, (unsigned long)counts.dropped);
+}
+
+/*******************************************************************************
+* Function Name: gpio_edge_export
+********************************************************************************
+* Summary:
+*  Prints the last periods read as an edge stream, one "r,<ticks>" or
+*  "f,<ticks>" line per rising or falling edge, for host/tools/edge_bench.
+*  Consecutive periods share their rising edge.
+*
+* Parameters:
+*  count: number of periods in gpio_edge_rise, gpio_edge_fall and
+*         gpio_edge_next
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void gpio_edge_export(uint32_t count)
+{
+    printf("# edges clock_hz=%lu periods=%lu\r\n", (unsigned long)EDGE_CAPTURE_CLOCK_HZ, (unsigned long)count);
+    for (uint32_t index = 0u; index < count; index++)
+    {
+        printf("r,%lu\r\nf,%lu\r\n", (unsigned long)gpio_edge_rise[index], (unsigned long)gpio_edge_fall[index]);
+        /* A period not followed by the next one ends the stream segment */
+        if (((index + 1u) == count) || (gpio_edge_rise[index + 1u] != gpio_edge_next[index]))
+        {
+            printf("r,%lu\r\n", (unsigned long)gpio_edge_next[index]);
+        }
+    }
+    printf("# end\r\n");
+}
+
+#if !IO_COPROCESSOR
 /*******************************************************************************
 * Function Name: gpio1_interrupt_handler
 ********************************************************************************
@@ -183,11 +448,11 @@ int main_gpio_interrupt(void)
 *  cyhal_gpio_event_t (unused)
 *
 *******************************************************************************/
-static void gpio1_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
+static PLACE_ITCM void gpio1_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
 {
     /* Disable interrupt */
     cyhal_gpio_register_callback(CYBSP_USER_BTN1, NULL);
-    gpio1_intr_flag = true;
+    event_flags_set(&demo_events, EVT_GPIO1);
 
 }
 /*******************************************************************************
@@ -201,11 +466,13 @@ static void gpio1_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
 *  cyhal_gpio_event_t (unused)
 *
 *******************************************************************************/
-static void gpio2_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
+static PLACE_ITCM void gpio2_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
 {
     /* Disable interrupt */
     cyhal_gpio_register_callback(CYBSP_USER_BTN2, NULL);
-    gpio2_intr_flag = true;
+    event_flags_set(&demo_events, EVT_GPIO2);
 
 }
+#endif /* !IO_COPROCESSOR */
+
 /* [] END OF FILE */
@@ -47,6 +47,13 @@
 #include "button.h"
 #include "oob_demo.h"
 #include "print_message.h"
+#include "profiler.h"
+#include "pin.h"
+#include "placement.h"
+#include "boot_time.h"
+#include "resource_manager.h"
+#include "param.h"
+#include "watchdog.h"
 
 
 /*******************************************************************************
@@ -55,8 +62,11 @@
 /* LED blink timer clock value in Hz  */
 #define LED_BLINK_TIMER_CLOCK_HZ          (10000)
 
-/* LED blink timer period value */
-#define LED_BLINK_TIMER_PERIOD            (9999)
+/* Owner of the LEDs in the resource manager */
+#define HELLO_WORLD_OWNER                 "hello_world"
+
+/* Events that end the sleep of the demo loop */
+#define HELLO_WORLD_EVENTS                (EVT_DEMO_SWITCH | EVT_CONSOLE_KEY | EVT_BUTTON1 | EVT_BUTTON2 | EVT_TIMER)
 
 
 /*******************************************************************************
@@ -69,8 +79,6 @@ static void led_statemanagement(uint8_t sta);
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
-bool timer_interrupt_flag = false;
-
 bool led_blink_active_flag = true;
 
 /* Variable for storing character read from terminal */
@@ -82,6 +90,8 @@ cyhal_timer_t led_blink_timer;
 /* counter object used for blinking the LED state */
 uint8_t led_statecounter = 0;
 
+PROFILER_ZONE_DEFINE(isr_timer);
+
 /*******************************************************************************
 * Function Name: main
 ********************************************************************************
@@ -101,6 +111,7 @@ uint8_t led_statecounter = 0;
 *******************************************************************************/
 int main_hellowrold(void)
 {
+    cy_rslt_t result;
 
     printf("****************** Running Hello world demo ******************\r\n");
     printf("Hello World!!!\r\n");
@@ -108,11 +119,30 @@ int main_hellowrold(void)
     printf("use either USER BTN1 or USER BTN2 to pause or resume the blinking.\r\n");
     printf("\r\n");
     /* Initialize the User LED */
-    cyhal_gpio_init(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_OFF);
-    cyhal_gpio_init(CYBSP_USER_LED2, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_OFF);
+    result = resource_manager_gpio_acquire(CYBSP_USER_LED1, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG,
+                                           CYBSP_LED_STATE_OFF, HELLO_WORLD_OWNER);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = resource_manager_gpio_acquire(CYBSP_USER_LED2, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG,
+                                               CYBSP_LED_STATE_OFF, HELLO_WORLD_OWNER);
+    }
 #if defined(KIT_XMC72) || defined(KIT_T2GBH)
-    cyhal_gpio_init(CYBSP_USER_LED3, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_OFF);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = resource_manager_gpio_acquire(CYBSP_USER_LED3, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG,
+                                               CYBSP_LED_STATE_OFF, HELLO_WORLD_OWNER);
+    }
+#endif
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("The user LEDs are not available, error 0x%08lx. Select another demo.\r\n", (unsigned long)result);
+        resource_manager_gpio_release(CYBSP_USER_LED1, HELLO_WORLD_OWNER);
+        resource_manager_gpio_release(CYBSP_USER_LED2, HELLO_WORLD_OWNER);
+#if defined(KIT_XMC72) || defined(KIT_T2GBH)
+        resource_manager_gpio_release(CYBSP_USER_LED3, HELLO_WORLD_OWNER);
 #endif
+        return 0;
+    }
 
     /*Initialize GPIO connected to USER BTN1*/
     button1_initial();
@@ -123,37 +153,46 @@ int main_hellowrold(void)
     /* Initialize timer to toggle the LED */
     timer_init();
 
-    while(!evtSwitch)
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
     {
+        boot_time_mark(BOOT_PHASE_CM7_0_POLL);
+
+        /* Sleep until the next event. A pending press keeps polling for the
+         * button release, which raises no interrupt. */
+        if (0u == event_flags_test(&demo_events, EVT_BUTTON1 | EVT_BUTTON2))
+        {
+            watchdog_end(WATCHDOG_TASK_DEMO);
+            event_flags_wait_any(&demo_events, HELLO_WORLD_EVENTS, false);
+        }
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+
         /* Check if either BTN1 or BTN2 key pressed or receive 'Enter key' */
-        if( (button1_intr_event == true) || (button2_intr_event == true))
+        if (0u != event_flags_test(&demo_events, EVT_BUTTON1 | EVT_BUTTON2))
         {
-            if(button1_Hysfilter_flag == false)
+            if (0u == event_flags_test(&demo_events, EVT_BUTTON1_FILTERED))
             {
                 /* Hysteresis filter */
                 Cy_SysLib_Delay(10u);
-                button1_Hysfilter_flag = true;
+                event_flags_set(&demo_events, EVT_BUTTON1_FILTERED);
             }
-            else if(button2_Hysfilter_flag == false)
+            else if (0u == event_flags_test(&demo_events, EVT_BUTTON2_FILTERED))
             {
                 /* Hysteresis filter */
                 Cy_SysLib_Delay(10u);
-                button2_Hysfilter_flag = true;
+                event_flags_set(&demo_events, EVT_BUTTON2_FILTERED);
             }
             /* wait for button release*/
             if((cyhal_gpio_read(CYBSP_USER_BTN1) == true && cyhal_gpio_read(CYBSP_USER_BTN2) == true))
             {
-                if(button1_intr_event == true)
+                if (0u != event_flags_take(&demo_events, EVT_BUTTON1))
                 {
-                    button1_intr_event = false;
-                    button1_Hysfilter_flag = false;
+                    event_flags_clear(&demo_events, EVT_BUTTON1_FILTERED);
                     /* Enable interrupt */
                     cyhal_gpio_register_callback(CYBSP_USER_BTN1, &btn1_callback_data);
                 }
-                if(button2_intr_event == true)
+                if (0u != event_flags_take(&demo_events, EVT_BUTTON2))
                 {
-                    button2_intr_event = false;
-                    button2_Hysfilter_flag = false;
+                    event_flags_clear(&demo_events, EVT_BUTTON2_FILTERED);
                     /* Enable interrupt */
                     cyhal_gpio_register_callback(CYBSP_USER_BTN2, &btn2_callback_data);
                 }
@@ -173,7 +212,7 @@ int main_hellowrold(void)
 
             }
         }
-        else if(recCmd == 0x0D)
+        else if ((0u != event_flags_take(&demo_events, EVT_CONSOLE_KEY)) && (recCmd == 0x0D))
         {
             recCmd = 0xff;
             /* Pause LED blinking by stopping the timer */
@@ -191,10 +230,8 @@ int main_hellowrold(void)
             }
         }
         /* Check if timer elapsed (interrupt fired) and toggle the LED */
-        if (timer_interrupt_flag)
+        if (0u != event_flags_take(&demo_events, EVT_TIMER))
         {
-            /* Clear the flag */
-            timer_interrupt_flag = false;
             led_statecounter++;
             #if defined(KIT_XMC72) || defined(KIT_T2GBH)
             if(led_statecounter>4)
@@ -213,12 +250,12 @@ int main_hellowrold(void)
     }
     /* Un-initialize the User LEDs, timer and button */
     cyhal_timer_free(&led_blink_timer);
-    cyhal_gpio_free(CYBSP_USER_BTN1);
-    cyhal_gpio_free(CYBSP_USER_BTN2);
-    cyhal_gpio_free(CYBSP_USER_LED1);
-    cyhal_gpio_free(CYBSP_USER_LED2);
+    button1_free();
+    button2_free();
+    resource_manager_gpio_release(CYBSP_USER_LED1, HELLO_WORLD_OWNER);
+    resource_manager_gpio_release(CYBSP_USER_LED2, HELLO_WORLD_OWNER);
 #if defined(KIT_XMC72) || defined(KIT_T2GBH)
-    cyhal_gpio_free(CYBSP_USER_LED3);
+    resource_manager_gpio_release(CYBSP_USER_LED3, HELLO_WORLD_OWNER);
 # endif
     led_statecounter = 0;
 
@@ -247,7 +284,7 @@ void timer_init(void)
     const cyhal_timer_cfg_t led_blink_timer_cfg = 
     {
         .compare_value = 0,                 /* Timer compare value, not used */
-        .period = LED_BLINK_TIMER_PERIOD,   /* Defines the timer period */
+        .period = param_get(PARAM_LED_BLINK_PERIOD), /* Defines the timer period */
         .direction = CYHAL_TIMER_DIR_UP,    /* Timer counts up */
         .is_compare = false,                /* Don't use compare mode */
         .is_continuous = true,              /* Run timer indefinitely */
@@ -294,13 +331,16 @@ void timer_init(void)
 *    event            Timer/counter interrupt triggers
 *
 *******************************************************************************/
-static void isr_timer(void *callback_arg, cyhal_timer_event_t event)
+static PLACE_ITCM void isr_timer(void *callback_arg, cyhal_timer_event_t event)
 {
+    PROFILER_ZONE_BEGIN(isr_timer);
+
     (void) callback_arg;
     (void) event;
 
-    /* Set the interrupt flag and process it from the main while(1) loop */
-    timer_interrupt_flag = true;
+    /* Post the timer event and process it from the main while(1) loop */
+    event_flags_set(&demo_events, EVT_TIMER);
+    PROFILER_ZONE_END(isr_timer);
 }
 
 /*******************************************************************************
@@ -325,12 +365,30 @@ static void led_statemanagement(uint8_t sta)
     /* array contains two LEDs display status 000 - 001 - 010 - 011 */
     uint8_t array[] = {0,1,2,3};
 # endif
-    /* Turn on/off the LED depending upon the bit set/cleared*/
-    cyhal_gpio_write(CYBSP_USER_LED1, (array[sta]&0x01) ? LED_ON : LED_OFF);
-    cyhal_gpio_write(CYBSP_USER_LED2, (array[sta]&0x02) ? LED_ON : LED_OFF);
+    uint32_t leds = PIN_MASK(CYBSP_USER_LED1) | PIN_MASK(CYBSP_USER_LED2);
+    uint32_t on = ((array[sta]&0x01) ? PIN_MASK(CYBSP_USER_LED1) : 0u) |
+                  ((array[sta]&0x02) ? PIN_MASK(CYBSP_USER_LED2) : 0u);
+    bool same_port = PIN_SAME_PORT(CYBSP_USER_LED1, CYBSP_USER_LED2);
+#if defined(KIT_XMC72) || defined(KIT_T2GBH)
+    leds |= PIN_MASK(CYBSP_USER_LED3);
+    on |= (array[sta]&0x04) ? PIN_MASK(CYBSP_USER_LED3) : 0u;
+    same_port = same_port && PIN_SAME_PORT(CYBSP_USER_LED1, CYBSP_USER_LED3);
+#endif
+
+    /* Turn on/off the LED depending upon the bit set/cleared. The LEDs are
+     * active low; when they share a port they switch with one store. */
+    if (same_port)
+    {
+        PIN_PORT_WRITE(CYBSP_USER_LED1, leds, ~on);
+    }
+    else
+    {
+        PIN_WRITE(CYBSP_USER_LED1, (array[sta]&0x01) ? LED_ON : LED_OFF);
+        PIN_WRITE(CYBSP_USER_LED2, (array[sta]&0x02) ? LED_ON : LED_OFF);
 #if defined(KIT_XMC72) || defined(KIT_T2GBH)
-    cyhal_gpio_write(CYBSP_USER_LED3, (array[sta]&0x04) ? LED_ON : LED_OFF);
+        PIN_WRITE(CYBSP_USER_LED3, (array[sta]&0x04) ? LED_ON : LED_OFF);
 #endif
+    }
 
 }
 /* [] END OF FILE */
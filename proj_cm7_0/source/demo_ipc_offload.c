@@ -0,0 +1,256 @@
+/*******************************************************************************
+* File Name:   demo_ipc_offload.c
+*
+* Description: Dual-core IPC offload demo. CM7_0 offloads CRC verification, ADC
+*              sample filtering and CAN frame processing to CM7_1 through the
+*              inter-processor message rings, and benchmarks the rings.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "print_message.h"
+#include "oob_demo.h"
+#include "ipc_offload.h"
+#include "io_client.h"
+#include "crc32.h"
+#include "watchdog.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Console command that runs the ring benchmark again */
+#define IPC_CMD_BENCHMARK           'b'
+#define IPC_CMD_IO_LOAD             'i'
+
+/* Size of the buffer verified by CM7_1, whole cache lines */
+#define CRC_BUFFER_SIZE             (1024u)
+
+/* Time CM7_1 has to attach after reset */
+#define IPC_ATTACH_TIMEOUT_MS       (1000u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void ipc_offload_examples(void);
+static void ipc_offload_print_benchmark(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Buffer verified by CM7_1, in SRAM and aligned to the D-cache lines */
+static uint8_t crc_buffer[CRC_BUFFER_SIZE] __attribute__((aligned(IPC_RING_CACHE_LINE)));
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Waits for CM7_1, runs one request of each offloaded work type and the ring
+*  benchmark. Press 'b' to run the benchmark again and 'i' to show the
+*  console and button interrupt load of CM7_0.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main_ipc_offload(void)
+{
+    uint32_t wait_ms = 0u;
+
+    printf("****************** Running dual-core IPC offload demo ******************\r\n");
+    printf("In this demo, CM7_0 offloads CRC verification, ADC filtering and CAN \r\n");
+    printf("frame processing to CM7_1 through lock-free message rings in shared SRAM. \r\n");
+    printf("Press 'b' to run the ring benchmark again. \r\n");
+    printf("Press 'i' to show the console and button interrupt load of CM7_0. \r\n");
+    printf("\r\n");
+
+    while (!ipc_offload_ready() && (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH)) && (wait_ms < IPC_ATTACH_TIMEOUT_MS))
+    {
+        cyhal_system_delay_ms(1u);
+        wait_ms++;
+    }
+
+    if (!ipc_offload_ready())
+    {
+        printf("CM7_1 did not attach to the shared memory.\r\n");
+    }
+    else
+    {
+        ipc_offload_examples();
+        ipc_offload_print_benchmark();
+    }
+
+    while (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
+    {
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+        if (IPC_CMD_BENCHMARK == recCmd)
+        {
+            recCmd = CMD_DEFAULT;
+            ipc_offload_print_benchmark();
+        }
+        else if (IPC_CMD_IO_LOAD == recCmd)
+        {
+            recCmd = CMD_DEFAULT;
+            io_client_print_load();
+        }
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_examples
+********************************************************************************
+* Summary:
+*  Sends one request of each offloaded work type to CM7_1 and prints the
+*  results. The CRC-32 is also calculated locally to compare the cost.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ipc_offload_examples(void)
+{
+    cy_rslt_t result;
+    uint32_t start;
+    uint32_t local_cycles;
+    uint32_t remote_cycles;
+    uint32_t crc;
+    ipc_crc32_rsp_t crc_rsp;
+    ipc_adc_filter_rsp_t adc_rsp;
+    ipc_can_frame_t frame = { .id = 1u, .dlc = 8u, .data = { 1, 2, 3, 4, 5, 6, 7, 8 } };
+    const int16_t samples[IPC_ADC_FILTER_MAX] = { 1650, 1652, 1649, 1655, 1648, 1651, 1653, 1650 };
+
+    for (uint32_t index = 0; index < CRC_BUFFER_SIZE; index++)
+    {
+        crc_buffer[index] = (uint8_t)(index * 7u);
+    }
+
+    start = ipc_offload_cycles();
+    crc = crc32_compute(crc_buffer, CRC_BUFFER_SIZE);
+    local_cycles = ipc_offload_cycles() - start;
+
+    start = ipc_offload_cycles();
+    result = ipc_offload_crc32(crc_buffer, CRC_BUFFER_SIZE, crc, &crc_rsp);
+    remote_cycles = ipc_offload_cycles() - start;
+    if (CY_RSLT_SUCCESS == result)
+    {
+        printf("CRC-32 of %u bytes: 0x%08lX, %s on CM7_1 (local %lu cycles, offloaded %lu cycles)\r\n",
+               CRC_BUFFER_SIZE, (unsigned long)crc_rsp.crc,
+               (0u != crc_rsp.match) ? "verified" : "MISMATCH",
+               (unsigned long)local_cycles, (unsigned long)remote_cycles);
+    }
+    else
+    {
+        printf("CRC-32 offload failed. Error: 0x%08lX\r\n", (unsigned long)result);
+    }
+
+    result = ipc_offload_adc_filter(samples, IPC_ADC_FILTER_MAX, &adc_rsp);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        printf("ADC filter of %u samples: mean %ld mV, min %d mV, max %d mV\r\n",
+               IPC_ADC_FILTER_MAX, (long)adc_rsp.mean, adc_rsp.min, adc_rsp.max);
+    }
+    else
+    {
+        printf("ADC filter offload failed. Error: 0x%08lX\r\n", (unsigned long)result);
+    }
+
+    result = ipc_offload_can_frame(&frame);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        printf("CAN frame processed by CM7_1:");
+        for (uint8_t msg_idx = 0; msg_idx < frame.dlc; msg_idx++)
+        {
+            printf(" 0x%x", frame.data[msg_idx]);
+        }
+        printf("\r\n\r\n");
+    }
+    else
+    {
+        printf("CAN frame offload failed. Error: 0x%08lX\r\n", (unsigned long)result);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_print_benchmark
+********************************************************************************
+* Summary:
+*  Runs the ring benchmark and prints the results.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ipc_offload_print_benchmark(void)
+{
+    cy_rslt_t result;
+    ipc_offload_bench_t bench;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+
+    result = ipc_offload_benchmark(&bench);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("IPC ring benchmark failed. Error: 0x%08lX\r\n", (unsigned long)result);
+        return;
+    }
+
+    printf("IPC ring benchmark, CM7_0 <-> CM7_1 at %lu MHz:\r\n", (unsigned long)cycles_per_us);
+    printf("Round trip, idle rings: min %lu, avg %lu, max %lu cycles\r\n",
+           (unsigned long)bench.latency_min, (unsigned long)bench.latency_avg,
+           (unsigned long)bench.latency_max);
+    printf("Round trip, full rings: avg %lu cycles\r\n", (unsigned long)bench.loaded_latency_avg);
+    printf("Throughput: %lu messages/s, %lu kB/s per direction\r\n",
+           (unsigned long)bench.messages_per_s,
+           (unsigned long)((bench.messages_per_s * sizeof(ipc_msg_t)) / 1024u));
+    printf("\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,761 @@
+/*******************************************************************************
+* File Name:   demo_param_console.c
+*
+* Description: Parameter console demo. Lists, reads and changes the runtime
+*              parameters of the demos from a line-mode console and saves them
+*              to the work flash snapshot loaded at boot. Also changes the
+*              console baud rate and measures its throughput.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "print_message.h"
+#include "oob_demo.h"
+#include "event_flags.h"
+#include "param.h"
+#include "profiler.h"
+#include "io_client.h"
+#include "console_baud.h"
+#include "console_ui.h"
+#include "ipc_offload.h"
+#include "mem_config.h"
+#include "block_pool.h"
+#include "watchdog.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Words of a command line: command, name, value */
+#define PARAM_CONSOLE_MAX_WORDS     (3u)
+
+/* Throughput test: lines of "<7-digit number> <pattern>\r\n" */
+#define PARAM_CONSOLE_STREAM_LINE   (64u)
+#define PARAM_CONSOLE_STREAM_DEF    (16384u)
+#define PARAM_CONSOLE_STREAM_MAX    (1048576u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void param_console_help(void);
+static void param_console_list(void);
+static void param_console_print(param_id_t id);
+static bool param_console_execute(char *line);
+static uint32_t param_console_cycles_to_us(uint32_t cycles);
+static void param_console_baud(const char *text);
+static void param_console_uart(void);
+static void param_console_stream(const char *text);
+static void param_console_ui(void);
+static void param_console_mem(void);
+static void param_console_pools(void);
+static uint32_t param_console_port_set_baud(void *arg, uint32_t baud);
+static void param_console_port_write(void *arg, const char *text, uint32_t length);
+static bool param_console_port_tx_idle(void *arg);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Debug UART as seen by the baud-rate handshake */
+static const console_baud_port_t param_console_port =
+{
+    .set_baud = param_console_port_set_baud,
+    .write    = param_console_port_write,
+    .tx_idle  = param_console_port_tx_idle,
+    .arg      = NULL,
+};
+
+
+/*******************************************************************************
+* Function Name: main_param_console
+********************************************************************************
+* Summary:
+*  Runs the parameter console until "exit" or a demo switch. The digits are
+*  part of the command line here, "exit <n>" starts demo n.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main_param_console(void)
+{
+    char line[CONSOLE_LINE_SIZE];
+
+    printf("********************* Running parameter console demo *******************\r\n");
+    printf("In this demo, the parameters of the other demos can be listed and \r\n");
+    printf("changed, and saved to the work flash snapshot loaded at boot. \r\n");
+    printf("Snapshot load at boot took %lu us. \r\n",
+           (unsigned long)param_console_cycles_to_us(param_get_load_cycles()));
+    param_console_help();
+    printf("> ");
+
+    console_line_begin();
+    while (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
+    {
+        watchdog_end(WATCHDOG_TASK_DEMO);
+        (void)event_flags_wait_any(&demo_events, EVT_DEMO_SWITCH | EVT_CONSOLE_KEY, false);
+        watchdog_begin(WATCHDOG_TASK_DEMO);
+        (void)event_flags_take(&demo_events, EVT_CONSOLE_KEY);
+
+        if (console_line_poll(line, sizeof(line)))
+        {
+            if (param_console_execute(line))
+            {
+                printf("> ");
+            }
+        }
+    }
+    console_line_end();
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: param_console_help
+********************************************************************************
+* Summary:
+*  Prints the console commands.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_help(void)
+{
+    printf("Commands, ended by Enter: \r\n");
+    printf("  list                 show all parameters \r\n");
+    printf("  get <name>           show one parameter \r\n");
+    printf("  set <name> <value>   change a parameter, decimal or 0x hex \r\n");
+    printf("  save                 write the parameters to the work flash \r\n");
+    printf("  load                 read the parameters back from the work flash \r\n");
+    printf("  defaults             restore the defaults, save to keep them \r\n");
+    printf("  baud <rate>          change the console baud rate, see host/tools/baud_switch \r\n");
+    printf("  uart                 show the console receive counters \r\n");
+    printf("  stream [bytes]       send numbered lines and report the throughput \r\n");
+    printf("  ui                   show the bytes sent by the fixed menu and status line \r\n");
+    printf("  mem                  show the stack high-water mark and allocator calls of each core \r\n");
+    printf("  pools                show the block pool statistics \r\n");
+    printf("  watchdog             show the task deadlines and the last watchdog reset \r\n");
+    printf("  profile [clear]      show the profiler hot spots of all demos, or clear them \r\n");
+    printf("  exit [n]             leave the console and start demo n, 1 by default \r\n");
+    printf("\r\n");
+}
+
+/*******************************************************************************
+* Function Name: param_console_list
+********************************************************************************
+* Summary:
+*  Prints all the parameters.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_list(void)
+{
+    printf("%-14s %10s %10s %10s %10s\r\n", "name", "value", "default", "min", "max");
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        param_console_print((param_id_t)index);
+    }
+}
+
+/*******************************************************************************
+* Function Name: param_console_print
+********************************************************************************
+* Summary:
+*  Prints one parameter with its default, range and unit.
+*
+* Parameters:
+*  id: parameter
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_print(param_id_t id)
+{
+    const param_desc_t *desc = param_get_desc(id);
+
+    printf("%-14s %10lu %10lu %10lu %10lu %s\r\n", desc->name,
+           (unsigned long)param_get(id), (unsigned long)desc->def,
+           (unsigned long)desc->min, (unsigned long)desc->max, desc->unit);
+}
+
+/*******************************************************************************
+* Function Name: param_console_execute
+********************************************************************************
+* Summary:
+*  Splits a command line into words and runs the command.
+*
+* Parameters:
+*  line: command line, modified by the split
+*
+* Return:
+*  bool: false if the console was left
+*
+*******************************************************************************/
+static bool param_console_execute(char *line)
+{
+    char *words[PARAM_CONSOLE_MAX_WORDS] = { NULL, NULL, NULL };
+    uint32_t count = 0u;
+    char *save = NULL;
+    char *end = NULL;
+    param_id_t id;
+    uint32_t value;
+    uint32_t start;
+    cy_rslt_t result;
+
+    for (char *word = strtok_r(line, " ", &save);
+         (NULL != word) && (count < PARAM_CONSOLE_MAX_WORDS);
+         word = strtok_r(NULL, " ", &save))
+    {
+        words[count++] = word;
+    }
+
+    if (0u == count)
+    {
+        /* Empty line */
+    }
+    else if (0 == strcmp(words[0], "help"))
+    {
+        param_console_help();
+    }
+    else if (0 == strcmp(words[0], "list"))
+    {
+        param_console_list();
+    }
+    else if ((0 == strcmp(words[0], "get")) || (0 == strcmp(words[0], "set")))
+    {
+        if ((count < 2u) || !param_find(words[1], &id))
+        {
+            printf("Unknown parameter, see list\r\n");
+        }
+        else if ('g' == words[0][0])
+        {
+            param_console_print(id);
+        }
+        else
+        {
+            value = (count < 3u) ? 0u : (uint32_t)strtoul(words[2], &end, 0);
+            if ((count < 3u) || ('\0' != *end))
+            {
+                printf("Usage: set <name> <value>\r\n");
+            }
+            else if (CY_RSLT_SUCCESS != param_set(id, value))
+            {
+                printf("Out of range: %s takes %lu to %lu%s\r\n",
+                       param_get_desc(id)->name, (unsigned long)param_get_desc(id)->min,
+                       (unsigned long)param_get_desc(id)->max,
+                       ((id >= PARAM_QUICK_PRESS_COUNT) && (id <= PARAM_LONG_PRESS_COUNT)) ?
+                       ", quick < short < long" :
+                       ((id >= PARAM_ADC_WINDOW_LOW_MV) && (id <= PARAM_ADC_WINDOW_HIGH_MV)) ?
+                       ", low < high" : "");
+            }
+            else
+            {
+                param_console_print(id);
+                if (PARAM_BAUD_RATE == id)
+                {
+                    printf("The baud rate applies after save and reset\r\n");
+                }
+            }
+        }
+    }
+    else if (0 == strcmp(words[0], "save"))
+    {
+        start = profiler_cycles();
+        result = param_save();
+        start = profiler_cycles() - start;
+        if (CY_RSLT_SUCCESS == result)
+        {
+            printf("Saved to 0x%08lX in %lu us\r\n", (unsigned long)PARAM_FLASH_ADDR,
+                   (unsigned long)param_console_cycles_to_us(start));
+        }
+        else
+        {
+            printf("Save failed: 0x%08lX\r\n", (unsigned long)result);
+        }
+    }
+    else if (0 == strcmp(words[0], "load"))
+    {
+        result = param_load();
+        printf("%s in %lu us\r\n", (CY_RSLT_SUCCESS == result) ? "Loaded" : "No valid snapshot, defaults",
+               (unsigned long)param_console_cycles_to_us(param_get_load_cycles()));
+    }
+    else if (0 == strcmp(words[0], "defaults"))
+    {
+        param_reset();
+        printf("Defaults restored\r\n");
+    }
+    else if (0 == strcmp(words[0], "baud"))
+    {
+        param_console_baud((count < 2u) ? "" : words[1]);
+    }
+    else if (0 == strcmp(words[0], "uart"))
+    {
+        param_console_uart();
+    }
+    else if (0 == strcmp(words[0], "stream"))
+    {
+        param_console_stream((count < 2u) ? "" : words[1]);
+    }
+    else if (0 == strcmp(words[0], "ui"))
+    {
+        param_console_ui();
+    }
+    else if (0 == strcmp(words[0], "mem"))
+    {
+        param_console_mem();
+    }
+    else if (0 == strcmp(words[0], "pools"))
+    {
+        param_console_pools();
+    }
+    else if (0 == strcmp(words[0], "watchdog"))
+    {
+        watchdog_print();
+    }
+    else if (0 == strcmp(words[0], "profile"))
+    {
+        if ((count >= 2u) && (0 == strcmp(words[1], "clear")))
+        {
+            profiler_reset();
+            printf("Profiler cleared\r\n");
+        }
+        else
+        {
+            profiler_print_report();
+        }
+    }
+    else if (0 == strcmp(words[0], "SYNC"))
+    {
+        /* Late token of a baud-rate handshake */
+    }
+    else if (0 == strcmp(words[0], "exit"))
+    {
+        value = (count < 2u) ? 1u : (uint32_t)strtoul(words[1], NULL, 10);
+        if ((value < 1u) || (value >= (uint32_t)DEMONUM))
+        {
+            value = 1u;
+        }
+        demoIndex = (uint8_t)value;
+        event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+        return false;
+    }
+    else
+    {
+        printf("Unknown command, type help\r\n");
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: param_console_cycles_to_us
+********************************************************************************
+* Summary:
+*  Converts CPU cycles to microseconds.
+*
+* Parameters:
+*  cycles: CPU cycles
+*
+* Return:
+*  uint32_t: microseconds
+*
+*******************************************************************************/
+static uint32_t param_console_cycles_to_us(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000u) / SystemCoreClock);
+}
+
+/*******************************************************************************
+* Function Name: param_console_baud
+********************************************************************************
+* Summary:
+*  Device end of the baud-rate handshake (console_baud.h). The characters
+*  received meanwhile go to the software RX buffer of the console. On
+*  success the rate is also set as the baud parameter, saved by "save".
+*
+* Parameters:
+*  text: requested rate
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_baud(const char *text)
+{
+    const param_desc_t *desc = param_get_desc(PARAM_BAUD_RATE);
+    console_baud_t handshake;
+    console_stats_t stats;
+    uint8_t buffer[32];
+    uint32_t now_ms = 0u;
+    uint32_t count;
+    char *end = NULL;
+    uint32_t baud = (uint32_t)strtoul(text, &end, 0);
+
+    if (('\0' == *text) || ('\0' != *end) || (baud < desc->min) || (baud > desc->max))
+    {
+        printf("Usage: baud <rate>, %lu to %lu\r\n", (unsigned long)desc->min, (unsigned long)desc->max);
+        return;
+    }
+    if (IO_COPROCESSOR)
+    {
+        printf("The debug UART belongs to CM0+, the rate cannot be changed\r\n");
+        return;
+    }
+
+    console_get_stats(&stats);
+    console_raw_begin();
+    console_baud_device_start(&handshake, &param_console_port, stats.baud, baud, now_ms);
+    while (CONSOLE_BAUD_SYNC >= console_baud_poll(&handshake, now_ms))
+    {
+        count = console_raw_read(buffer, sizeof(buffer));
+        for (uint32_t index = 0u; index < count; index++)
+        {
+            console_baud_rx(&handshake, buffer[index]);
+        }
+        cyhal_system_delay_ms(1u);
+        now_ms++;
+    }
+    console_raw_end();
+
+    if (CONSOLE_BAUD_DONE == handshake.state)
+    {
+        (void)param_set(PARAM_BAUD_RATE, baud);
+        /* The terminal may have been reconnected at the new rate */
+        console_ui_invalidate();
+        printf("Console at %lu baud, %lu achieved, save to keep it\r\n",
+               (unsigned long)baud, (unsigned long)handshake.actual_baud);
+    }
+    else
+    {
+        printf("Baud rate change failed (%s), console at %lu baud\r\n",
+               (CONSOLE_BAUD_ERROR_RATE == handshake.error) ? "rate not achievable" : "no SYNC",
+               (unsigned long)handshake.actual_baud);
+    }
+}
+
+/*******************************************************************************
+* Function Name: param_console_uart
+********************************************************************************
+* Summary:
+*  Prints the rate and the receive counters of the console.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_uart(void)
+{
+    console_stats_t stats;
+
+    console_get_stats(&stats);
+    printf("Debug UART at %lu baud, flow control %s\r\n", (unsigned long)stats.baud,
+           stats.flow_control ? "RTS/CTS" : "off");
+    printf("Received %lu, errors %lu, dropped %lu, paused %lu times, RX buffer peak %lu of %u\r\n",
+           (unsigned long)stats.rx_bytes, (unsigned long)stats.rx_errors,
+           (unsigned long)stats.rx_overruns, (unsigned long)stats.rx_throttles,
+           (unsigned long)stats.rx_high_water, (unsigned int)CONSOLE_RX_BUFFER_SIZE);
+}
+
+/*******************************************************************************
+* Function Name: param_console_stream
+********************************************************************************
+* Summary:
+*  Sends numbered lines of a known pattern as fast as the console takes
+*  them and reports the sustained throughput against the line rate of
+*  baud / 10. The receiver can check every line for errors.
+*
+* Parameters:
+*  text: bytes to send, rounded up to whole lines
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_stream(const char *text)
+{
+    char line[PARAM_CONSOLE_STREAM_LINE + 1u];
+    console_stats_t stats;
+    uint64_t elapsed_us = 0u;
+    uint32_t bytes = ('\0' == *text) ? PARAM_CONSOLE_STREAM_DEF : (uint32_t)strtoul(text, NULL, 0);
+    uint32_t lines;
+    uint32_t start;
+    uint32_t rate;
+
+    if ((0u == bytes) || (bytes > PARAM_CONSOLE_STREAM_MAX))
+    {
+        printf("Usage: stream [bytes], at most %lu\r\n", (unsigned long)PARAM_CONSOLE_STREAM_MAX);
+        return;
+    }
+    lines = (bytes + PARAM_CONSOLE_STREAM_LINE - 1u) / PARAM_CONSOLE_STREAM_LINE;
+    bytes = lines * PARAM_CONSOLE_STREAM_LINE;
+
+    /* Timed line by line, the cycle counter wraps after a few seconds */
+    for (uint32_t number = 0u; number < lines; number++)
+    {
+        uint32_t length = (uint32_t)snprintf(line, sizeof(line), "%07lu ", (unsigned long)number);
+
+        /* A long stream outlasts the deadline of a pass, each line is one */
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+
+        while (length < (PARAM_CONSOLE_STREAM_LINE - 2u))
+        {
+            line[length] = (char)('A' + ((number + length) % 26u));
+            length++;
+        }
+        line[length++] = '\r';
+        line[length++] = '\n';
+
+        start = profiler_cycles();
+        (void)fwrite(line, 1u, length, stdout);
+        elapsed_us += param_console_cycles_to_us(profiler_cycles() - start);
+    }
+    start = profiler_cycles();
+    while (io_client_tx_active())
+    {
+    }
+    elapsed_us += param_console_cycles_to_us(profiler_cycles() - start);
+
+    console_get_stats(&stats);
+    rate = (0u != elapsed_us) ? (uint32_t)(((uint64_t)bytes * 1000000u) / elapsed_us) : 0u;
+    printf("Sent %lu bytes in %lu us: %lu B/s, %lu%% of the %lu B/s line rate\r\n",
+           (unsigned long)bytes, (unsigned long)elapsed_us, (unsigned long)rate,
+           (unsigned long)(((uint64_t)rate * 100u) / (stats.baud / 10u)), (unsigned long)(stats.baud / 10u));
+}
+
+/*******************************************************************************
+* Function Name: param_console_ui
+********************************************************************************
+* Summary:
+*  Prints what the fixed menu and status line (console_ui.h) sent against
+*  the line output they replaced.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_ui(void)
+{
+    console_ui_stats_t stats;
+
+    console_ui_get_stats(&stats);
+    printf("Console UI %s\r\n", stats.enabled ? "on" : "off, set console_ui 1 to use it");
+    printf("%lu updates sent %lu bytes for %lu bytes of line output, %lu%% saved\r\n",
+           (unsigned long)stats.renders, (unsigned long)stats.bytes, (unsigned long)stats.line_bytes,
+           (stats.line_bytes > stats.bytes) ?
+           (unsigned long)(((uint64_t)(stats.line_bytes - stats.bytes) * 100u) / stats.line_bytes) : 0ul);
+}
+
+
+/*******************************************************************************
+* Function Name: param_console_mem
+********************************************************************************
+* Summary:
+*  Prints the stack high-water mark and the trapped allocator calls of each
+*  core (mem_guard.h). CM7_1 and CM0+ report once they attach to the shared
+*  block.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_mem(void)
+{
+    static const char *const core_name[IPC_CORE_NUM] =
+    {
+        [IPC_CORE_CM0P]  = "CM0+",
+        [IPC_CORE_CM7_0] = "CM7_0",
+        [IPC_CORE_CM7_1] = "CM7_1",
+    };
+    mem_guard_record_t record;
+    uint32_t core;
+    uint32_t free_bytes;
+
+    for (core = 0u; core < IPC_CORE_NUM; core++)
+    {
+        if (!ipc_offload_memory((ipc_core_t)core, &record))
+        {
+            printf("%-6s no record, the core has not attached\r\n", core_name[core]);
+            continue;
+        }
+        if (0u == record.stack_size)
+        {
+            printf("%-6s stack not painted", core_name[core]);
+        }
+        else
+        {
+            free_bytes = record.stack_size - record.stack_used;
+            printf("%-6s stack %lu of %lu B used, %lu B free%s", core_name[core],
+                   (unsigned long)record.stack_used, (unsigned long)record.stack_size,
+                   (unsigned long)free_bytes, (free_bytes < MEM_CONFIG_STACK_HEADROOM) ? " (low)" : "");
+        }
+        if (0u == record.heap_calls)
+        {
+            printf(", no allocator call\r\n");
+        }
+        else
+        {
+            printf(", %lu allocator calls trapped, last %lu B from 0x%08lX\r\n",
+                   (unsigned long)record.heap_calls, (unsigned long)record.heap_size,
+                   (unsigned long)record.heap_caller);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: param_console_pools
+********************************************************************************
+* Summary:
+*  Prints the statistics of the block pools (block_pool.h) initialized so
+*  far.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_pools(void)
+{
+    const block_pool_t *pool;
+    block_pool_stats_t stats;
+
+    pool = block_pool_next(NULL);
+    if (NULL == pool)
+    {
+        printf("No block pool yet, the demos initialize theirs when they start\r\n");
+    }
+    for (; NULL != pool; pool = block_pool_next(pool))
+    {
+        block_pool_get_stats(pool, &stats);
+        printf("%-16s %lu x %lu B, %lu in use, peak %lu, %lu allocated, %lu failed, %lu bad frees\r\n",
+               stats.name, (unsigned long)stats.block_count, (unsigned long)stats.block_size,
+               (unsigned long)stats.in_use, (unsigned long)stats.peak, (unsigned long)stats.allocs,
+               (unsigned long)stats.fails, (unsigned long)stats.bad_frees);
+    }
+}
+
+/*******************************************************************************
+* Function Name: param_console_port_set_baud
+********************************************************************************
+* Summary:
+*  Port of the baud-rate handshake: switches the debug UART.
+*
+* Parameters:
+*  arg: unused
+*  baud: requested rate
+*
+* Return:
+*  uint32_t: rate achieved by the clock divider, 0 if not supported
+*
+*******************************************************************************/
+static uint32_t param_console_port_set_baud(void *arg, uint32_t baud)
+{
+    (void)arg;
+    return console_set_baud(baud);
+}
+
+/*******************************************************************************
+* Function Name: param_console_port_write
+********************************************************************************
+* Summary:
+*  Port of the baud-rate handshake: writes the handshake lines to the console
+*  and flushes them.
+*
+* Parameters:
+*  arg: unused
+*  text: characters, not terminated
+*  length: number of characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void param_console_port_write(void *arg, const char *text, uint32_t length)
+{
+    (void)arg;
+    (void)fwrite(text, 1u, length, stdout);
+    (void)fflush(stdout);
+}
+
+/*******************************************************************************
+* Function Name: param_console_port_tx_idle
+********************************************************************************
+* Summary:
+*  Port of the baud-rate handshake: tells when the console has sent its last
+*  character, so that the rate can change.
+*
+* Parameters:
+*  arg: unused
+*
+* Return:
+*  bool: true if the transmitter is idle
+*
+*******************************************************************************/
+static bool param_console_port_tx_idle(void *arg)
+{
+    (void)arg;
+    return !io_client_tx_active();
+}
+
+/* [] END OF FILE */
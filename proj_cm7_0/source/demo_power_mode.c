@@ -46,15 +46,22 @@
 #include "cy_retarget_io.h"
 #include "print_message.h"
 #include "oob_demo.h"
+#include "pm_profiler.h"
+#include "power_manager.h"
+#include "boot_time.h"
+#include "resource_manager.h"
+#include "param.h"
+#include "watchdog.h"
+#include "button.h"
+#include "io_client.h"
+#include "ipc_io.h"
 
 
 /*******************************************************************************
 * Macros
 ********************************************************************************/
-/* Constants to define LONG and SHORT presses on User Button (x10 = ms) */
-#define QUICK_PRESS_COUNT       2u      /* 20 ms < press < 200 ms */
-#define SHORT_PRESS_COUNT       20u     /* 200 ms < press < 2 sec */
-#define LONG_PRESS_COUNT        200u    /* press > 2 sec */
+/* LONG and SHORT presses on User Button (x10 = ms) are the press_quick (20 ms),
+ * press_short (200 ms) and press_long (2 sec) parameters */
 
 /* PWM LED frequency constants (in Hz) */
 #define PWM_FREQ_HZ             3
@@ -68,6 +75,20 @@
 #define SHORT_GLITCH_DELAY_MS   10u     /* in ms */
 #define LONG_GLITCH_DELAY_MS    200u    /* in ms */
 
+/* Profiler console commands */
+#define PM_CMD_AUTO_CYCLE       'a'     /* Run the automated Sleep/DeepSleep cycles */
+#define PM_CMD_PRINT_CSV        'c'     /* Print the accumulated results as CSV */
+#define PM_CMD_RESET            'r'     /* Clear the accumulated results */
+#define PM_CMD_BOOT_TIME        't'     /* Print the boot-phase timing */
+
+/* Automated mode: number of transitions and RTC wake-up interval */
+#define PM_AUTO_CYCLE_COUNT     50u
+#define PM_AUTO_WAKE_INTERVAL_S 1u
+#define RTC_INTERRUPT_PRIORITY  (3u)
+
+/* Owner of the button and the PWM in the resource manager */
+#define POWER_MODE_OWNER        "power_modes"
+
 typedef enum
 {
     SWITCH_NO_EVENT     = 0u,
@@ -76,10 +97,20 @@ typedef enum
     SWITCH_LONG_PRESS   = 3u,
 } en_switch_event_t;
 
+/* Button of the power modes, and its presses forwarded by CM0+ with
+ * IO_COPROCESSOR=1 */
 #if defined(KIT_XMC71_V1) || defined(KIT_XMC71_V2)
 #define HIB_BTN          CYBSP_USER_BTN2
+#define HIB_BTN_NUMBER   IPC_IO_BUTTON2
+#define HIB_BTN_EVENT    EVT_BUTTON2
+#define HIB_BTN_INITIAL  button2_initial
+#define HIB_BTN_FREE     button2_free
 #else
 #define HIB_BTN          CYBSP_USER_BTN1
+#define HIB_BTN_NUMBER   IPC_IO_BUTTON1
+#define HIB_BTN_EVENT    EVT_BUTTON1
+#define HIB_BTN_INITIAL  button1_initial
+#define HIB_BTN_FREE     button1_free
 #endif
 
 /*****************************************************************************
@@ -89,12 +120,30 @@ en_switch_event_t get_switch_event(void);
 void handle_error(void);
 /* Power callbacks */
 bool pwm_power_callback(cyhal_syspm_callback_state_t state, cyhal_syspm_callback_mode_t mode, void *arg);
+static void power_mode_auto_cycle(uint32_t cycles);
+static void rtc_alarm_handler(void *callback_arg, cyhal_rtc_event_t event);
 
 /*******************************************************************************
 * Global Variables
 ********************************************************************************/
-/* HAL Objects */
-cyhal_pwm_t pwm;
+/* HAL Objects, the PWM is owned by the resource manager */
+cyhal_pwm_t *pwm;
+cyhal_rtc_t pm_rtc;
+
+/* RTC alarm flag of the automated mode */
+volatile bool rtc_alarm_flag = false;
+
+/* Callback declaration for Power Modes, static since the HAL links it into
+ * its callback list until it is unregistered */
+static cyhal_syspm_callback_data_t pwm_callback = {pwm_power_callback,          /* Callback function */
+                                                   (cyhal_syspm_callback_state_t)
+                                                   (CYHAL_SYSPM_CB_CPU_SLEEP |
+                                                    CYHAL_SYSPM_CB_CPU_DEEPSLEEP |
+                                                    CYHAL_SYSPM_CB_SYSTEM_HIBERNATE), /* Power States supported */
+                                                   (cyhal_syspm_callback_mode_t)
+                                                   (CYHAL_SYSPM_CHECK_FAIL),    /* Modes to ignore */
+                                                   NULL,                        /* Callback Argument */
+                                                   NULL};                       /* For internal use */
 
 
 /*******************************************************************************
@@ -120,6 +169,7 @@ cyhal_pwm_t pwm;
 *******************************************************************************/
 int main_powermode(void)
 {
+    cy_rslt_t result = CY_RSLT_SUCCESS;
 
     /* Enable global interrupts */
     __enable_irq();
@@ -137,61 +187,95 @@ int main_powermode(void)
     printf("Short press the USER BTN1 button to enter DeepSleep state.\r\n");
     printf("Long press the USER BTN1 button to enter Hibernate state.\r\n\r\n");
 #endif
+    printf("Press 'a' to cycle Sleep and DeepSleep %u times from the RTC, 'c' to print\r\n", PM_AUTO_CYCLE_COUNT);
+    printf("the transition profile as CSV, 'r' to clear it, and 't' to print the boot phases.\r\n");
     printf("\r\n");
 
 
 
+#if IO_COPROCESSOR
+    /* CM0+ owns the User Button and forwards each press with its duration.
+     * Its IPC doorbell wakes the device. */
+    HIB_BTN_INITIAL();
+#else
     /* Initialize the User Button */
-    cyhal_gpio_init(HIB_BTN, CYHAL_GPIO_DIR_INPUT, CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
-    /* Enable the GPIO interrupt to wake-up the device */
-    cyhal_gpio_enable_event(HIB_BTN, CYHAL_GPIO_IRQ_FALL, CYHAL_ISR_PRIORITY_DEFAULT, true);
+    result = resource_manager_gpio_acquire(HIB_BTN, CYHAL_GPIO_DIR_INPUT, CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF,
+                                           POWER_MODE_OWNER);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        /* Enable the GPIO interrupt to wake-up the device */
+        cyhal_gpio_enable_event(HIB_BTN, CYHAL_GPIO_IRQ_FALL, CYHAL_ISR_PRIORITY_DEFAULT, true);
+    }
+#endif /* IO_COPROCESSOR */
 
     /* Initialize the PWM to control LED brightness */
-    cyhal_pwm_init(&pwm, CYBSP_USER_LED, NULL);
-    cyhal_pwm_set_duty_cycle(&pwm, PWM_50P_DUTY_CYCLE, PWM_FREQ_HZ);
-    cyhal_pwm_start(&pwm);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = resource_manager_pwm_acquire(&pwm, CYBSP_USER_LED, POWER_MODE_OWNER);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("The user button or LED is not available, error 0x%08lx. Select another demo.\r\n",
+               (unsigned long)result);
+        resource_manager_pwm_release(CYBSP_USER_LED, POWER_MODE_OWNER);
+#if IO_COPROCESSOR
+        HIB_BTN_FREE();
+#else
+        resource_manager_gpio_release(HIB_BTN, POWER_MODE_OWNER);
+#endif /* IO_COPROCESSOR */
+        return 0;
+    }
+    cyhal_pwm_set_duty_cycle(pwm, PWM_50P_DUTY_CYCLE, PWM_FREQ_HZ);
+    cyhal_pwm_start(pwm);
 
     /* Check the reset reason */
     if((CY_SYSLIB_RESET_HIB_WAKEUP == (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HIB_WAKEUP)) && Hibresetstatus == true)
     {
         Hibresetstatus = false;
-        /* Wait a bit to avoid glitches from the button press */
-        cyhal_system_delay_ms(LONG_GLITCH_DELAY_MS);
+#if !IO_COPROCESSOR
+        /* Wait for the release of the wake-up press rather than a fixed
+         * LONG_GLITCH_DELAY_MS, so a fast boot reaches the loop sooner. CM0+
+         * only reports presses that start after its own boot. */
+        while (cyhal_gpio_read(HIB_BTN) == CYBSP_BTN_PRESSED)
+        {
+            cyhal_system_delay_ms(SHORT_GLITCH_DELAY_MS);
+        }
+        cyhal_system_delay_ms(SHORT_GLITCH_DELAY_MS);
+#endif /* !IO_COPROCESSOR */
         /* The reset has occurred on a wakeup from Hibernate power mode */
         printf("Wake up from the Hibernate state.\r\n");
     }
 
-    /* Callback declaration for Power Modes */
-    cyhal_syspm_callback_data_t pwm_callback = {pwm_power_callback,             /* Callback function */
-                                               (cyhal_syspm_callback_state_t)
-                                               (CYHAL_SYSPM_CB_CPU_SLEEP |
-                                                CYHAL_SYSPM_CB_CPU_DEEPSLEEP |
-                                                CYHAL_SYSPM_CB_SYSTEM_HIBERNATE), /* Power States supported */
-                                               (cyhal_syspm_callback_mode_t)
-                                               (CYHAL_SYSPM_CHECK_FAIL),        /* Modes to ignore */
-                                                NULL,                           /* Callback Argument */
-                                                NULL};                          /* For internal use */
     /* Initialize the System Power Management */
     cyhal_syspm_init();
     /* Power Management Callback registration */
     cyhal_syspm_register_callback(&pwm_callback);
+    /* Start the power manager and the transition profiler */
+    if (CY_RSLT_SUCCESS != power_manager_init())
+    {
+        printf("Power mode profiler initialization failed.\r\n");
+    }
 
-    while(!evtSwitch)
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
     {
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+        boot_time_mark(BOOT_PHASE_CM7_0_POLL);
+        /* This loop polls, print the logs of the cores here */
+        event_flags_idle();
+
         switch (get_switch_event())
         {
             case SWITCH_QUICK_PRESS:
 
-                /* Print out the information, wait a bit to UART output */
+                /* Print out the information, the power manager drains the UART */
 #if defined(KIT_XMC71_V1) || defined(KIT_XMC71_V2)
                 printf("Device entered into Sleep state. Quickly press the USER BTN2 button to return to Active state.\r\n");
 #else
                 printf("Device entered into Sleep state. Quickly press the USER BTN1 button to return to Active state.\r\n");
 #endif
-                cyhal_system_delay_ms(SHORT_GLITCH_DELAY_MS);
 
                 /* Go to sleep */
-                cyhal_syspm_sleep();
+                power_manager_sleep();
 
                 printf("Wake up from the Sleep state.\r\n");
                 /* Wait a bit to avoid glitches from the button press */
@@ -199,16 +283,15 @@ int main_powermode(void)
                 break;
 
             case SWITCH_SHORT_PRESS:
-                /* Print out the information, wait a bit to UART output */
+                /* Print out the information, the power manager drains the UART */
 #if defined(KIT_XMC71_V1) || defined(KIT_XMC71_V2)
                 printf("Device entered into DeepSleep state. Quickly press the USER BTN2 button to return to Active state.\r\n");
 #else
                 printf("Device entered into DeepSleep state. Quickly press the USER BTN1 button to return to Active state.\r\n");
 #endif
-                cyhal_system_delay_ms(SHORT_GLITCH_DELAY_MS);
 
                 /* Go to deep sleep */
-                cyhal_syspm_deepsleep();
+                power_manager_deepsleep();
 
                 printf("Wake up from the DeepSleep state.\r\n");
                 /* Wait a bit to avoid glitches from the button press */
@@ -216,17 +299,42 @@ int main_powermode(void)
                 break;
 
             case SWITCH_LONG_PRESS:
-                /* Print out the information, wait a bit to UART output */
+                /* Print out the information, the power manager drains the UART */
 #if defined(KIT_XMC71_V1) || defined(KIT_XMC71_V2)
                 printf("Device entered into Hibernate state. Quickly press the USER BTN2 button to wake-up from Hibernate state, and then the MCU resets.\r\n");
 #else
                 printf("Device entered into Hibernate state. Quickly press the USER BTN1 button to wake-up from Hibernate state, and then the MCU resets.\r\n");
 #endif
-                cyhal_system_delay_ms(SHORT_GLITCH_DELAY_MS);
-                /* Wait until the UART Tx is empty before entering Hibernate mode */
-                while (cyhal_uart_is_tx_active(&cy_retarget_io_uart_obj));
                 /* Go to hibernate and Configure a low logic level for the first wakeup-pin */
-                cyhal_syspm_hibernate(CYHAL_SYSPM_HIBERNATE_PINA_LOW);
+                power_manager_hibernate(CYHAL_SYSPM_HIBERNATE_PINA_LOW);
+                break;
+
+            default:
+                break;
+        }
+
+        /* Check the profiler commands */
+        switch (recCmd)
+        {
+            case PM_CMD_AUTO_CYCLE:
+                recCmd = CMD_DEFAULT;
+                power_mode_auto_cycle(PM_AUTO_CYCLE_COUNT);
+                break;
+
+            case PM_CMD_PRINT_CSV:
+                recCmd = CMD_DEFAULT;
+                pm_profiler_print_csv();
+                break;
+
+            case PM_CMD_RESET:
+                recCmd = CMD_DEFAULT;
+                pm_profiler_reset();
+                printf("Power mode profile cleared.\r\n");
+                break;
+
+            case PM_CMD_BOOT_TIME:
+                recCmd = CMD_DEFAULT;
+                boot_time_print();
                 break;
 
             default:
@@ -234,12 +342,16 @@ int main_powermode(void)
         }
     }
     /* Stop the PWM before quit this demo */
-    cyhal_pwm_stop(&pwm);
+    cyhal_pwm_stop(pwm);
+    power_manager_free();
     cyhal_syspm_unregister_callback(&pwm_callback);
-    /* Un-initialize the User buttons and PWM*/
-    cyhal_pwm_free(&pwm);
-    cyhal_gpio_free(HIB_BTN);
-    cyhal_gpio_free(CYBSP_USER_LED);
+    /* Release the User button and PWM*/
+    resource_manager_pwm_release(CYBSP_USER_LED, POWER_MODE_OWNER);
+#if IO_COPROCESSOR
+    HIB_BTN_FREE();
+#else
+    resource_manager_gpio_release(HIB_BTN, POWER_MODE_OWNER);
+#endif /* IO_COPROCESSOR */
     return 0;
 }
 
@@ -262,26 +374,39 @@ en_switch_event_t get_switch_event(void)
     en_switch_event_t event = SWITCH_NO_EVENT;
     uint32_t pressCount = 0;
 
-    /* Check if User button is pressed */
-    while (cyhal_gpio_read(HIB_BTN) == CYBSP_BTN_PRESSED)
+#if IO_COPROCESSOR
+    /* CM0+ reports the press once it is released, with its duration */
+    if (0u != event_flags_take(&demo_events, HIB_BTN_EVENT))
     {
-        /* Wait for 10 ms */
-        cyhal_system_delay_ms(10);
+        /* Each count represents 10 ms */
+        pressCount = button_held_ms(HIB_BTN_NUMBER) / 10u;
+    }
+#else
+    /* Check if User button is pressed. A button held down for good, or a
+     * pin stuck low, would keep the demo here. */
+    WATCHDOG_SCOPE(WATCHDOG_TASK_BUTTON)
+    {
+        while (cyhal_gpio_read(HIB_BTN) == CYBSP_BTN_PRESSED)
+        {
+            /* Wait for 10 ms */
+            cyhal_system_delay_ms(10);
 
-        /* Increment counter. Each count represents 10 ms */
-        pressCount++;
+            /* Increment counter. Each count represents 10 ms */
+            pressCount++;
+        }
     }
+#endif /* IO_COPROCESSOR */
 
     /* Check for how long the button was pressed */
-    if (pressCount > LONG_PRESS_COUNT)
+    if (pressCount > param_get(PARAM_LONG_PRESS_COUNT))
     {
         event = SWITCH_LONG_PRESS;
     }
-    else if (pressCount > SHORT_PRESS_COUNT)
+    else if (pressCount > param_get(PARAM_SHORT_PRESS_COUNT))
     {
         event = SWITCH_SHORT_PRESS;
     }
-    else if (pressCount > QUICK_PRESS_COUNT)
+    else if (pressCount > param_get(PARAM_QUICK_PRESS_COUNT))
     {
         event = SWITCH_QUICK_PRESS;
     }
@@ -292,6 +417,97 @@ en_switch_event_t get_switch_event(void)
     return event;
 }
 
+/*******************************************************************************
+* Function Name: power_mode_auto_cycle
+********************************************************************************
+* Summary:
+*  Alternates Sleep and DeepSleep without button presses. Each transition is
+*  ended by an RTC alarm, which keeps running in DeepSleep. The loop stops
+*  early on a demo switch and prints the profile as CSV when done.
+*
+* Parameters:
+*  cycles: number of transitions to perform
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void power_mode_auto_cycle(uint32_t cycles)
+{
+    cy_rslt_t result;
+    uint32_t done;
+
+    result = cyhal_rtc_init(&pm_rtc);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("RTC initialization failed. Error: %lu\r\n", (unsigned long)result);
+        return;
+    }
+    cyhal_rtc_register_callback(&pm_rtc, rtc_alarm_handler, NULL);
+    cyhal_rtc_enable_event(&pm_rtc, CYHAL_RTC_ALARM, RTC_INTERRUPT_PRIORITY, true);
+
+    printf("Cycling Sleep and DeepSleep %lu times, wake-up every %u s...\r\n",
+           (unsigned long)cycles, PM_AUTO_WAKE_INTERVAL_S);
+
+    for (done = 0; (done < cycles) && (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH)); done++)
+    {
+        pm_prof_state_t state = ((done & 1u) == 0u) ? PM_PROF_STATE_SLEEP : PM_PROF_STATE_DEEPSLEEP;
+
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+        rtc_alarm_flag = false;
+        result = cyhal_rtc_set_alarm_by_seconds(&pm_rtc, PM_AUTO_WAKE_INTERVAL_S);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            printf("RTC alarm setup failed. Error: %lu\r\n", (unsigned long)result);
+            break;
+        }
+
+        /* Stay in the low-power state until the RTC alarm fires. Only the
+         * transition it ends is a sample, other wake-ups are just counted. */
+        while (!rtc_alarm_flag && (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH)))
+        {
+            pm_profiler_hold();
+            if (PM_PROF_STATE_SLEEP == state)
+            {
+                power_manager_sleep();
+            }
+            else
+            {
+                power_manager_deepsleep();
+            }
+            pm_profiler_release(rtc_alarm_flag);
+        }
+    }
+
+    cyhal_rtc_enable_event(&pm_rtc, CYHAL_RTC_ALARM, RTC_INTERRUPT_PRIORITY, false);
+    cyhal_rtc_free(&pm_rtc);
+
+    printf("Completed %lu of %lu cycles.\r\n", (unsigned long)done, (unsigned long)cycles);
+    pm_profiler_print_csv();
+}
+
+/*******************************************************************************
+* Function Name: rtc_alarm_handler
+********************************************************************************
+* Summary:
+*  RTC alarm handler of the automated mode.
+*
+* Parameters:
+*  callback_arg: user argument (not used)
+*  event: RTC event (not used)
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void rtc_alarm_handler(void *callback_arg, cyhal_rtc_event_t event)
+{
+    (void) callback_arg;
+    (void) event;
+
+    rtc_alarm_flag = true;
+}
+
 /*******************************************************************************
 * Function Name: pwm_power_callback
 ********************************************************************************
@@ -313,16 +529,16 @@ bool pwm_power_callback(cyhal_syspm_callback_state_t state, cyhal_syspm_callback
     (void) arg;
 
     /* Stop the PWM before applying any changes */
-    cyhal_pwm_stop(&pwm);
+    cyhal_pwm_stop(pwm);
 
     if (mode == CYHAL_SYSPM_BEFORE_TRANSITION)
     {
         if (state == CYHAL_SYSPM_CB_CPU_SLEEP)
         {
             /* Before going to Sleep Mode, set LED brightness to 10% */
-            cyhal_pwm_set_duty_cycle(&pwm, PWM_10P_DUTY_CYCLE, PWM_DIM_FREQ_HZ);
+            cyhal_pwm_set_duty_cycle(pwm, PWM_10P_DUTY_CYCLE, PWM_DIM_FREQ_HZ);
             /* Restart the PWM */
-            cyhal_pwm_start(&pwm);
+            cyhal_pwm_start(pwm);
         }
     }
     else if (mode == CYHAL_SYSPM_AFTER_TRANSITION)
@@ -332,7 +548,7 @@ bool pwm_power_callback(cyhal_syspm_callback_state_t state, cyhal_syspm_callback
             case CYHAL_SYSPM_CB_CPU_SLEEP:
             case CYHAL_SYSPM_CB_CPU_DEEPSLEEP:
                 /* After waking up, set the blink pattern */
-                cyhal_pwm_set_duty_cycle(&pwm, PWM_50P_DUTY_CYCLE, PWM_FREQ_HZ);
+                cyhal_pwm_set_duty_cycle(pwm, PWM_50P_DUTY_CYCLE, PWM_FREQ_HZ);
                 break;
 
             default:
@@ -340,7 +556,7 @@ bool pwm_power_callback(cyhal_syspm_callback_state_t state, cyhal_syspm_callback
         }
 
         /* Restart the PWM */
-        cyhal_pwm_start(&pwm);
+        cyhal_pwm_start(pwm);
     }
 
     return true;
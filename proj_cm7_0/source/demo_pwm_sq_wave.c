@@ -47,31 +47,37 @@
 #include "print_message.h"
 #include "button.h"
 #include "oob_demo.h"
+#include "resource_manager.h"
+#include "param.h"
+#include "watchdog.h"
 
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-/* PWM Frequency = 1, 10, 100, 1K, 10K, 100K and 1MHz */
-#define PWM_FREQUENCY_1Hz    (1u)
-#define PWM_FREQUENCY_10Hz   (10u)
-#define PWM_FREQUENCY_100Hz  (100u)
-#define PWM_FREQUENCY_1KHz   (1000u)
-#define PWM_FREQUENCY_10KHz  (10000u)
-#define PWM_FREQUENCY_100KHz (100000u)
-#define PWM_FREQUENCY_1MKHz  (1000000u)
+/* PWM frequency steps, PARAM_PWM_FREQUENCY_0 to _6: 1, 10, 100, 1K, 10K, 100K
+ * and 1MHz by default */
+#define PWM_FREQUENCY_STEPS  (7u)
 /* PWM Duty-cycle = 50% */
 #define PWM_DUTY_CYCLE (50.0f)
 
+/* Owner of the PWM in the resource manager */
+#define PWM_SQ_WAVE_OWNER    "pwm_square_wave"
+
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
-/* PWM object */
-static cyhal_pwm_t pwm_led_control;
+/* PWM object, owned by the resource manager */
+static cyhal_pwm_t *pwm_led_control;
 
 static uint8_t button_counter = 0;
 
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void pwm_sq_wave_print_frequency(uint32_t frequency);
+
 /*******************************************************************************
 * Function Name: main
 ********************************************************************************
@@ -90,6 +96,7 @@ int main_pwm_square_wave(void)
 {
     /* API return code */
     cy_rslt_t result;
+    uint32_t frequency;
 
     printf("****************** Running PWM square-wave output demo ******************\r\n");
     printf("In this demo, the PWM output of 50%% duty cycle at 1 Hz generated on USER LED2\r\n");
@@ -98,26 +105,28 @@ int main_pwm_square_wave(void)
 #endif
     printf("Press the USER BTN1 or USER BTN2 button to switch the PWM frequency at 1 Hz, 10 Hz, 100 Hz, \r\n");
     printf("1 kHz, 10 kHz, 100 kHz, or 1 MHz. The USER LED2 will blink depending on the selected frequency. \r\n");
+    printf("The frequencies are the pwm_hz_0 to pwm_hz_6 parameters of the parameter console. \r\n");
     printf("\r\n");
+    /* Initialize the PWM */
+    result = resource_manager_pwm_acquire(&pwm_led_control, CYBSP_USER_LED2, PWM_SQ_WAVE_OWNER);
+    if(CY_RSLT_SUCCESS != result)
+    {
+        printf("USER LED2 is not available for the PWM, error 0x%08lx. Select another demo.\r\n",
+               (unsigned long)result);
+        return 0;
+    }
+
     /*Initialize USER_BTN1*/
     button1_initial();
 
     /*Initialize USER_BTN2*/
     button2_initial();
 
-    /* Initialize the PWM */
-    result = cyhal_pwm_init(&pwm_led_control, CYBSP_USER_LED2, NULL);
-    if(CY_RSLT_SUCCESS != result)
-    {
-        printf("API cyhal_pwm_init failed with error code: %lu\r\n", (unsigned long) result);
-        CY_ASSERT(false);
-    }
-
     /* In this example, PWM output is routed to the user LED2 on the kit.
         See HAL API Reference document for API details. */
 
     /* Set the PWM output frequency and duty cycle */
-    result = cyhal_pwm_set_duty_cycle(&pwm_led_control, PWM_DUTY_CYCLE, PWM_FREQUENCY_1Hz);
+    result = cyhal_pwm_set_duty_cycle(pwm_led_control, PWM_DUTY_CYCLE, param_get(PARAM_PWM_FREQUENCY_0));
     if(CY_RSLT_SUCCESS != result)
     {
         printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
@@ -125,10 +134,10 @@ int main_pwm_square_wave(void)
     }
 
     /* Stop current pwm */
-    result = cyhal_pwm_stop(&pwm_led_control);
+    result = cyhal_pwm_stop(pwm_led_control);
 
     /* Start the PWM */
-    result = cyhal_pwm_start(&pwm_led_control);
+    result = cyhal_pwm_start(pwm_led_control);
     if(CY_RSLT_SUCCESS != result)
     {
         printf("API cyhal_pwm_start failed with error code: %lu\r\n", (unsigned long) result);
@@ -136,131 +145,99 @@ int main_pwm_square_wave(void)
     }
 
     /* Loop infinitely */
-    while(!evtSwitch)
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
     {
-        if( (button1_intr_event == true) || (button2_intr_event == true))
+        /* Sleep until a press or a demo switch. A pending press returns at
+         * once, so the loop keeps polling for the button release. */
+        watchdog_end(WATCHDOG_TASK_DEMO);
+        if (0u != (event_flags_wait_any(&demo_events, EVT_DEMO_SWITCH | EVT_BUTTON1 | EVT_BUTTON2, false)
+                   & (EVT_BUTTON1 | EVT_BUTTON2)))
         {
-            if(button1_Hysfilter_flag == false)
+            watchdog_begin(WATCHDOG_TASK_DEMO);
+            if (0u == event_flags_test(&demo_events, EVT_BUTTON1_FILTERED))
             {
                 /* Hysteresis filter */
                 Cy_SysLib_Delay(10u);
-                button1_Hysfilter_flag = true;
+                event_flags_set(&demo_events, EVT_BUTTON1_FILTERED);
             }
-            else if(button2_Hysfilter_flag == false)
+            else if (0u == event_flags_test(&demo_events, EVT_BUTTON2_FILTERED))
             {
                 /* Hysteresis filter */
                 Cy_SysLib_Delay(10u);
-                button2_Hysfilter_flag = true;
+                event_flags_set(&demo_events, EVT_BUTTON2_FILTERED);
             }
             /* wait for button release*/
             if((cyhal_gpio_read(CYBSP_USER_BTN1) == true && cyhal_gpio_read(CYBSP_USER_BTN2) == true))
             {
-                if(button1_intr_event == true)
+                if (0u != event_flags_take(&demo_events, EVT_BUTTON1))
                 {
-                    button1_intr_event = false;
-                    button1_Hysfilter_flag = false;
+                    event_flags_clear(&demo_events, EVT_BUTTON1_FILTERED);
                     /* Enable interrupt */
                     cyhal_gpio_register_callback(CYBSP_USER_BTN1, &btn1_callback_data);
                 }
-                if(button2_intr_event == true)
+                if (0u != event_flags_take(&demo_events, EVT_BUTTON2))
                 {
-                    button2_intr_event = false;
-                    button2_Hysfilter_flag = false;
+                    event_flags_clear(&demo_events, EVT_BUTTON2_FILTERED);
                     /* Enable interrupt */
                     cyhal_gpio_register_callback(CYBSP_USER_BTN2, &btn2_callback_data);
                 }
                 button_counter++;
-                 if(button_counter > 6)
+                 if(button_counter >= PWM_FREQUENCY_STEPS)
                  {
                      button_counter = 0;
                  }
-                 switch(button_counter)
+                 /* The frequency steps are runtime parameters */
+                 frequency = param_get((param_id_t)(PARAM_PWM_FREQUENCY_0 + button_counter));
+                 result = cyhal_pwm_set_duty_cycle(pwm_led_control, PWM_DUTY_CYCLE, (uint32_t)frequency);
+                 pwm_sq_wave_print_frequency(frequency);
+                 if(CY_RSLT_SUCCESS != result)
                  {
-                     case 0:
-                     result = cyhal_pwm_set_duty_cycle(&pwm_led_control, PWM_DUTY_CYCLE, PWM_FREQUENCY_1Hz);
-                     printf("PWM 1 Hz frequency is running.\r\n");
-                     if(CY_RSLT_SUCCESS != result)
-                     {
-                         printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
-                         CY_ASSERT(false);
-                     }
-                     break;
-
-                     case 1:
-                     result = cyhal_pwm_set_duty_cycle(&pwm_led_control, PWM_DUTY_CYCLE, PWM_FREQUENCY_10Hz);
-                     printf("PWM 10 Hz frequency is running.\r\n");
-                     if(CY_RSLT_SUCCESS != result)
-                     {
-                         printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
-                         CY_ASSERT(false);
-                     }
-                     break;
-
-                     case 2:
-                     result = cyhal_pwm_set_duty_cycle(&pwm_led_control, PWM_DUTY_CYCLE, PWM_FREQUENCY_100Hz);
-                     printf("PWM 100 Hz frequency is running.\r\n");
-                     if(CY_RSLT_SUCCESS != result)
-                     {
-                         printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
-                         CY_ASSERT(false);
-                     }
-                     break;
-
-                     case 3:
-                     result = cyhal_pwm_set_duty_cycle(&pwm_led_control, PWM_DUTY_CYCLE, PWM_FREQUENCY_1KHz);
-                     printf("PWM 1 kHz frequency is running.\r\n");
-                     if(CY_RSLT_SUCCESS != result)
-                     {
-                         printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
-                         CY_ASSERT(false);
-                     }
-                     break;
-
-                     case 4:
-                     result = cyhal_pwm_set_duty_cycle(&pwm_led_control, PWM_DUTY_CYCLE, PWM_FREQUENCY_10KHz);
-                     printf("PWM 10 kHz frequency is running.\r\n");
-                     if(CY_RSLT_SUCCESS != result)
-                     {
-                         printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
-                         CY_ASSERT(false);
-                     }
-                     break;
-                     case 5:
-                     result = cyhal_pwm_set_duty_cycle(&pwm_led_control, PWM_DUTY_CYCLE, PWM_FREQUENCY_100KHz);
-                     printf("PWM 100 kHz frequency is running.\r\n");
-                     if(CY_RSLT_SUCCESS != result)
-                     {
-                         printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
-                         CY_ASSERT(false);
-                     }
-                     break;
-                     case 6:
-                     result = cyhal_pwm_set_duty_cycle(&pwm_led_control, PWM_DUTY_CYCLE, PWM_FREQUENCY_1MKHz);
-                     printf("PWM 1 MHz frequency is running.\r\n");
-                     if(CY_RSLT_SUCCESS != result)
-                     {
-                         printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
-                         CY_ASSERT(false);
-                     }
-                     break;
-                     default:
-                     break;
+                     printf("API cyhal_pwm_set_duty_cycle failed with error code: %lu\r\n", (unsigned long) result);
+                     CY_ASSERT(false);
                  }
 
             }
         }
     }
     /* Stop the PWM before quit this demo */
-    cyhal_pwm_stop(&pwm_led_control);
-    /* Un-initialize the User buttons and PWM*/
-    cyhal_pwm_free(&pwm_led_control);
-    cyhal_gpio_free(CYBSP_USER_BTN1);
-    cyhal_gpio_free(CYBSP_USER_BTN2);
-    cyhal_gpio_free(CYBSP_USER_LED2);
+    cyhal_pwm_stop(pwm_led_control);
+    /* Release the User buttons and PWM*/
+    resource_manager_pwm_release(CYBSP_USER_LED2, PWM_SQ_WAVE_OWNER);
+    button1_free();
+    button2_free();
     button_counter = 0;
-    button1_intr_event = false;
+    event_flags_clear(&demo_events, EVT_BUTTON1 | EVT_BUTTON1_FILTERED);
     return 0;
 }
 
+/*******************************************************************************
+* Function Name: pwm_sq_wave_print_frequency
+********************************************************************************
+* Summary:
+*  Prints the running frequency in Hz, kHz or MHz, whichever divides it.
+*
+* Parameters:
+*  frequency: PWM frequency in Hz
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void pwm_sq_wave_print_frequency(uint32_t frequency)
+{
+    if ((frequency >= 1000000u) && (0u == (frequency % 1000000u)))
+    {
+        printf("PWM %lu MHz frequency is running.\r\n", (unsigned long)(frequency / 1000000u));
+    }
+    else if ((frequency >= 1000u) && (0u == (frequency % 1000u)))
+    {
+        printf("PWM %lu kHz frequency is running.\r\n", (unsigned long)(frequency / 1000u));
+    }
+    else
+    {
+        printf("PWM %lu Hz frequency is running.\r\n", (unsigned long)frequency);
+    }
+}
+
 
 /* [] END OF FILE */
@@ -49,6 +49,11 @@
 #include "cy_serial_flash_qspi.h"
 #include "print_message.h"
 #include "oob_demo.h"
+#include "profiler.h"
+#include "resource_manager.h"
+#include "param.h"
+#include "mem_config.h"
+#include "watchdog.h"
 #include <inttypes.h>
 #include <string.h>
 
@@ -56,19 +61,28 @@
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-#define PACKET_SIZE             (64u)     /* Memory Read/Write size */
+#define PACKET_SIZE             (MEM_CONFIG_QSPI_PACKET_SIZE) /* Memory Read/Write size */
 
 /* Used when an array of data is printed on the console */
 #define NUM_BYTES_PER_LINE      (16u)
 #define LED_TOGGLE_DELAY_MSEC   (1000u)   /* LED blink delay */
 #define MEM_SLOT_NUM            (0u)      /* Slot number of the memory to use */
-#define QSPI_BUS_FREQUENCY_HZ   (50000000lu)
 #define FLASH_DATA_AFTER_ERASE  (0xFFu)   /* Flash data after erase */
+#define QSPI_MEMORY_OWNER       "qspi_memory" /* Owner in the resource manager */
 
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
+PROFILER_ZONE_DEFINE(qspi_erase);
+PROFILER_ZONE_DEFINE(qspi_read);
+PROFILER_ZONE_DEFINE(qspi_write);
+PROFILER_COUNTER_DEFINE(qspi_read_bytes);
+PROFILER_COUNTER_DEFINE(qspi_write_bytes);
+
+/* Packet buffers, static so that the demo stack stays small */
+static uint8_t qspi_tx_buf[PACKET_SIZE];
+static uint8_t qspi_rx_buf[PACKET_SIZE];
 
 
 /*******************************************************************************
@@ -106,6 +120,7 @@ void check_status(char *message, uint32_t status)
 
         /* On failure, turn the LED ON */
         cyhal_gpio_write(CYBSP_USER_LED, CYBSP_LED_STATE_ON);
+        watchdog_fault((uint32_t)(uintptr_t)__builtin_return_address(0));
         CY_ASSERT(false);
     }
 }
@@ -128,18 +143,9 @@ void check_status(char *message, uint32_t status)
 *******************************************************************************/
 void print_array(char *message, uint8_t *buf, uint32_t size)
 {
-    printf("%s (%"PRIu32" bytes):\r\n", message, size);
-    printf("-------------------------\r\n");
-
-    for (uint32_t index = 0; index < size; index++)
-    {
-        printf("0x%02X ", buf[index]);
-
-        if (0u == ((index + 1) % NUM_BYTES_PER_LINE))
-        {
-            printf("\r\n");
-        }
-    }
+    console_printf("%s (%"PRIu32" bytes):\r\n", message, size);
+    console_printf("-------------------------\r\n");
+    console_hex_dump(buf, size, NUM_BYTES_PER_LINE);
 }
 
 
@@ -163,8 +169,6 @@ void print_array(char *message, uint8_t *buf, uint32_t size)
 int main_qspi_memory(void)
 {
     cy_rslt_t result;
-    uint8_t tx_buf[PACKET_SIZE];
-    uint8_t rx_buf[PACKET_SIZE];
     uint32_t ext_mem_address;
     size_t sectorSize;
 
@@ -180,14 +184,17 @@ int main_qspi_memory(void)
 
 
     /* Initialize the User LED */
-    result = cyhal_gpio_init(CYBSP_USER_LED, CYHAL_GPIO_DIR_OUTPUT,
-              CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_OFF);
+    result = resource_manager_gpio_acquire(CYBSP_USER_LED, CYHAL_GPIO_DIR_OUTPUT,
+              CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_OFF, QSPI_MEMORY_OWNER);
     check_status("User LED initialization failed", result);
 
-    /* Initialize the Serial flash */
-    result = cy_serial_flash_qspi_init(smifMemConfigs[MEM_SLOT_NUM],
-            CYBSP_QSPI_D0, CYBSP_QSPI_D1, CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC,
-            NC, NC, CYBSP_QSPI_SCK, CYBSP_QSPI_SS, QSPI_BUS_FREQUENCY_HZ);
+    /* Initialize the Serial flash. The QSPI operations wait on the memory
+     * with no time-out, the watchdog supervises them. */
+    WATCHDOG_SCOPE(WATCHDOG_TASK_QSPI)
+    {
+        result = resource_manager_qspi_acquire(smifMemConfigs[MEM_SLOT_NUM], param_get(PARAM_QSPI_BUS_FREQUENCY),
+                                               QSPI_MEMORY_OWNER);
+    }
     check_status("Serial Flash initialization failed", result);
 
     /* Use last sector to erase for flash operation */
@@ -196,68 +203,89 @@ int main_qspi_memory(void)
 
     sectorSize = cy_serial_flash_qspi_get_erase_size(ext_mem_address);
     printf("\r\n");
-    printf("Total Flash Size:%u bytes\r\n",cy_serial_flash_qspi_get_size());
+    printf("Total Flash Size:%u bytes\r\n", (unsigned int)cy_serial_flash_qspi_get_size());
 
     /* Erase before write */
     printf("\r\n");
-    printf("1. Erasing %u bytes of memory\r\n", sectorSize);
-    result = cy_serial_flash_qspi_erase(ext_mem_address, sectorSize);
+    printf("1. Erasing %u bytes of memory\r\n", (unsigned int)sectorSize);
+    WATCHDOG_SCOPE(WATCHDOG_TASK_QSPI)
+    PROFILER_SCOPE(qspi_erase)
+    {
+        result = cy_serial_flash_qspi_erase(ext_mem_address, sectorSize);
+    }
     check_status("Erasing memory failed", result);
 
     /* Read after Erase to confirm that all data is 0xFF */
     printf("\r\n");
     printf("2.Reading after Erase & verifying that each byte is 0xFF\r\n");
-    result = cy_serial_flash_qspi_read(ext_mem_address, PACKET_SIZE, rx_buf);
+    WATCHDOG_SCOPE(WATCHDOG_TASK_QSPI)
+    PROFILER_SCOPE(qspi_read)
+    {
+        result = cy_serial_flash_qspi_read(ext_mem_address, PACKET_SIZE, qspi_rx_buf);
+    }
+    PROFILER_COUNT(qspi_read_bytes, PACKET_SIZE);
     check_status("Reading memory failed", result);
 
     printf("\r\n");
-    print_array("Received Data", rx_buf, PACKET_SIZE);
-    memset(tx_buf, FLASH_DATA_AFTER_ERASE, PACKET_SIZE);
+    print_array("Received Data", qspi_rx_buf, PACKET_SIZE);
+    memset(qspi_tx_buf, FLASH_DATA_AFTER_ERASE, PACKET_SIZE);
     check_status("Flash contains data other than 0xFF after erase",
-            memcmp(tx_buf, rx_buf, PACKET_SIZE));
+            memcmp(qspi_tx_buf, qspi_rx_buf, PACKET_SIZE));
 
     /* Prepare the TX buffer */
     for (uint32_t index = 0; index < PACKET_SIZE; index++)
     {
-        tx_buf[index] = (uint8_t)index;
+        qspi_tx_buf[index] = (uint8_t)index;
     }
 
     /* Write the content of the TX buffer to the memory */
     printf("\r\n");
     printf("3. Writing data to memory\r\n");
-    result = cy_serial_flash_qspi_write(ext_mem_address, PACKET_SIZE, tx_buf);
+    WATCHDOG_SCOPE(WATCHDOG_TASK_QSPI)
+    PROFILER_SCOPE(qspi_write)
+    {
+        result = cy_serial_flash_qspi_write(ext_mem_address, PACKET_SIZE, qspi_tx_buf);
+    }
+    PROFILER_COUNT(qspi_write_bytes, PACKET_SIZE);
     check_status("Writing to memory failed", result);
 
     printf("\r\n");
-    print_array("Written Data", tx_buf, PACKET_SIZE);
+    print_array("Written Data", qspi_tx_buf, PACKET_SIZE);
 
     /* Read back after Write for verification */
     printf("\r\n");
     printf("4. Reading back for verification\r\n");
-    result = cy_serial_flash_qspi_read(ext_mem_address, PACKET_SIZE, rx_buf);
+    WATCHDOG_SCOPE(WATCHDOG_TASK_QSPI)
+    PROFILER_SCOPE(qspi_read)
+    {
+        result = cy_serial_flash_qspi_read(ext_mem_address, PACKET_SIZE, qspi_rx_buf);
+    }
+    PROFILER_COUNT(qspi_read_bytes, PACKET_SIZE);
     check_status("Reading memory failed", result);
 
     printf("\r\n");
-    print_array("Received Data", rx_buf, PACKET_SIZE);
+    print_array("Received Data", qspi_rx_buf, PACKET_SIZE);
 
     /* Check if the transmitted and received arrays are equal */
     check_status("Read data does not match with written data. Read/Write "
-            "operation failed.", memcmp(tx_buf, rx_buf, PACKET_SIZE));
+            "operation failed.", memcmp(qspi_tx_buf, qspi_rx_buf, PACKET_SIZE));
 
     printf("\r\n");
     printf("=========================================================\r\n");
     printf("SUCCESS: Read data matches with written data!\r\n");
     printf("=========================================================\r\n");
 
-    while(!evtSwitch)
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
     {
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+        event_flags_idle();
         cyhal_gpio_toggle(CYBSP_USER_LED);
         cyhal_system_delay_ms(LED_TOGGLE_DELAY_MSEC);
     }
 
 
-    cyhal_gpio_free(CYBSP_USER_LED);
-    cy_serial_flash_qspi_deinit();
+    resource_manager_gpio_release(CYBSP_USER_LED, QSPI_MEMORY_OWNER);
+    resource_manager_qspi_release(QSPI_MEMORY_OWNER);
 
     return 0;
 }
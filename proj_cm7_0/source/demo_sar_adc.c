@@ -44,6 +44,7 @@
 * Include header files
 ******************************************************************************/
 #include <stdio.h>
+#include <string.h>
 #include "cy_pdl.h"
 #include "cycfg.h"
 #include "cybsp.h"
@@ -51,6 +52,16 @@
 #include "print_message.h"
 #include "button.h"
 #include "oob_demo.h"
+#include "profiler.h"
+#include "param.h"
+#include "adc_window.h"
+#include "adc_pwm_sync.h"
+#include "adc_scope.h"
+#include "scope_frame.h"
+#include "console_ui.h"
+#include "console_fmt.h"
+#include "io_client.h"
+#include "watchdog.h"
 
 /*******************************************************************************
 * Macros
@@ -58,10 +69,44 @@
 /* Channel 0 input pin */
 #define VPLUS_CHANNEL_0             CYBSP_POT
 
+/* Reading line: the head, a 4-wide decimal field of up to
+ * CONSOLE_FMT_DEC_MAX characters, "mV" and the line end */
+#define ADC_LINE_HEAD               "Channel 0 input: "
+#define ADC_LINE_SIZE               (sizeof(ADC_LINE_HEAD) + CONSOLE_FMT_DEC_MAX + 4u)
+
+/* Switch between polling and the window alarms, between polling and the
+ * PWM synchronized sampling, the trigger of the synchronized sampling, and
+ * switch between polling and the scope capture */
+#define ADC_CMD_WINDOW              'w'
+#define ADC_CMD_SYNC                'p'
+#define ADC_CMD_TRIGGER             't'
+#define ADC_CMD_SCOPE               'o'
+
+/* Events that end the wait of the window alarm mode */
+#define ADC_WINDOW_WAIT_EVENTS      (EVT_DEMO_SWITCH | EVT_CONSOLE_KEY | EVT_ADC_WINDOW)
+
+/* PWM synchronized sampling: duty cycle of the PWM and report period */
+#define ADC_SYNC_DUTY_PERMILLE      (500u)
+#define ADC_SYNC_REPORT_MS          (500u)
+
+/* Scope capture: trigger hysteresis in ADC counts, wait before a capture is
+ * triggered anyway, as in the auto mode of an oscilloscope, and poll period
+ * of the loop */
+#define ADC_SCOPE_HYSTERESIS        (24u)
+#define ADC_SCOPE_AUTO_MS           (200u)
+#define ADC_SCOPE_POLL_MS           (10u)
+
 
 /*******************************************************************************
 *       Enumerated Types
 *******************************************************************************/
+typedef enum
+{
+    ADC_MODE_POLL = 0u,             /* HAL reads every PARAM_ADC_DELAY_MS */
+    ADC_MODE_WINDOW,                /* Window alarms of the SAR */
+    ADC_MODE_SYNC,                  /* Conversions triggered by a PWM */
+    ADC_MODE_SCOPE,                 /* Triggered captures sent as binary frames */
+} adc_mode_t;
 
 
 /*******************************************************************************
@@ -74,6 +119,12 @@ void adc_single_channel_init(void);
 /* Function to read input voltage from channel 0 */
 void adc_single_channel_process(void);
 
+static adc_mode_t adc_next_mode(adc_mode_t mode);
+static adc_mode_t adc_poll_mode(void);
+static adc_mode_t adc_window_mode(void);
+static adc_mode_t adc_sync_mode(void);
+static adc_mode_t adc_scope_mode(void);
+
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
@@ -83,6 +134,15 @@ cyhal_adc_t adc_obj;
 /* ADC Channel 0 Object */
 cyhal_adc_channel_t adc_chan_0_obj;
 
+PROFILER_ZONE_DEFINE(adc_single_channel_process);
+
+/* Trigger of the PWM synchronized sampling, kept across mode switches */
+static adc_pwm_sync_trigger_t adc_sync_trigger = ADC_PWM_SYNC_TRIGGER_HW;
+
+/* Last scope capture and its frame */
+static uint16_t adc_scope_samples[ADC_SCOPE_SAMPLES];
+static uint8_t adc_scope_frame[SCOPE_FRAME_SIZE(ADC_SCOPE_SAMPLES)];
+
 /* Default ADC configuration */
 const cyhal_adc_config_t adc_config = {
         .resolution = 12u,
@@ -111,15 +171,106 @@ const cyhal_adc_config_t adc_config = {
 *******************************************************************************/
 int main_sar_adc(void)
 {
-    /* Variable to capture return value of functions */
-    cy_rslt_t result;
-
     /* Print message */
     printf("****************** Running SAR ADC basic demo ******************\r\n");
     printf("In this demo, the ADC is configured in single channel configuration. \r\n");
     printf("Rotate the potentiometer and observe the ADC input voltage change. \r\n");
+    printf("Press 'w' to switch between polling and the window alarms of the SAR. \r\n");
+    printf("Press 'p' to switch between polling and sampling synchronized to a PWM. \r\n");
+    printf("Press 'o' to switch between polling and binary scope captures. \r\n");
     printf("\r\n");
 
+    adc_mode_t mode = ADC_MODE_POLL;
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
+    {
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+        switch (mode)
+        {
+            case ADC_MODE_WINDOW:
+                mode = adc_window_mode();
+                break;
+            case ADC_MODE_SYNC:
+                mode = adc_sync_mode();
+                break;
+            case ADC_MODE_SCOPE:
+                mode = adc_scope_mode();
+                break;
+            default:
+                mode = adc_poll_mode();
+                break;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: adc_next_mode
+********************************************************************************
+* Summary:
+*  Takes a pending console key and returns the mode it selects: 'w', 'p' and
+*  'o' enter the window alarms, the synchronized sampling and the scope
+*  capture, or leave them for polling. 't' switches the trigger of the synchronized sampling.
+*
+* Parameters:
+*  mode: running mode
+*
+* Return:
+*  adc_mode_t: mode to run, the running one if no mode key was pressed
+*
+*******************************************************************************/
+static adc_mode_t adc_next_mode(adc_mode_t mode)
+{
+    adc_mode_t next = mode;
+
+    if (0u == event_flags_take(&demo_events, EVT_CONSOLE_KEY))
+    {
+        return mode;
+    }
+    if (ADC_CMD_WINDOW == recCmd)
+    {
+        next = (ADC_MODE_WINDOW == mode) ? ADC_MODE_POLL : ADC_MODE_WINDOW;
+        recCmd = CMD_DEFAULT;
+    }
+    else if (ADC_CMD_SYNC == recCmd)
+    {
+        next = (ADC_MODE_SYNC == mode) ? ADC_MODE_POLL : ADC_MODE_SYNC;
+        recCmd = CMD_DEFAULT;
+    }
+    else if (ADC_CMD_SCOPE == recCmd)
+    {
+        next = (ADC_MODE_SCOPE == mode) ? ADC_MODE_POLL : ADC_MODE_SCOPE;
+        recCmd = CMD_DEFAULT;
+    }
+    else if ((ADC_CMD_TRIGGER == recCmd) && (ADC_MODE_SYNC == mode))
+    {
+        adc_sync_trigger = (ADC_PWM_SYNC_TRIGGER_HW == adc_sync_trigger) ? ADC_PWM_SYNC_TRIGGER_SW
+                                                                          : ADC_PWM_SYNC_TRIGGER_HW;
+        recCmd = CMD_DEFAULT;
+    }
+
+    return next;
+}
+
+/*******************************************************************************
+* Function Name: adc_poll_mode
+********************************************************************************
+* Summary:
+*  Reads and prints the input voltage every PARAM_ADC_DELAY_MS through the
+*  HAL, until another demo or mode is selected.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  adc_mode_t: mode selected
+*
+*******************************************************************************/
+static adc_mode_t adc_poll_mode(void)
+{
+    /* Variable to capture return value of functions */
+    cy_rslt_t result;
+    adc_mode_t next = ADC_MODE_POLL;
+
     /* Initialize Channel 0 */
     adc_single_channel_init();
 
@@ -131,17 +282,279 @@ int main_sar_adc(void)
         CY_ASSERT(0);
     }
 
-    while(!evtSwitch)
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
     {
         /* Sample input voltage at channel 0 */
         adc_single_channel_process();
 
-        /* 200ms delay between scans */
-        cyhal_system_delay_ms(200);
+        /* Delay between scans, 200 ms by default and up to 10 s, longer
+         * than a pass may take: it is an idle wait */
+        watchdog_end(WATCHDOG_TASK_DEMO);
+        event_flags_idle();
+        cyhal_system_delay_ms(param_get(PARAM_ADC_DELAY_MS));
+        watchdog_begin(WATCHDOG_TASK_DEMO);
+
+        next = adc_next_mode(ADC_MODE_POLL);
+        if (ADC_MODE_POLL != next)
+        {
+            break;
+        }
     }
     cyhal_adc_free(&adc_obj);
     cyhal_gpio_free(CYBSP_POT);
-    return 0;
+
+    return next;
+}
+
+/*******************************************************************************
+* Function Name: adc_window_mode
+********************************************************************************
+* Summary:
+*  Lets the SAR convert the potentiometer continuously and compare it with
+*  the window of the adc_low_mv and adc_high_mv parameters. The CPU sleeps
+*  until a sample leaves the window or comes back into it, and prints each
+*  crossing with its sample and time. Returns when another demo or mode is
+*  selected.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  adc_mode_t: mode selected
+*
+*******************************************************************************/
+static adc_mode_t adc_window_mode(void)
+{
+    static const char *const zone_names[] = { "back inside", "below", "above" };
+    adc_window_channel_t channel =
+    {
+        .input = ADC_WINDOW_POT_INPUT,
+        .low   = adc_window_mv_to_counts(param_get(PARAM_ADC_WINDOW_LOW_MV)),
+        .high  = adc_window_mv_to_counts(param_get(PARAM_ADC_WINDOW_HIGH_MV)),
+    };
+    adc_window_event_t event;
+    adc_window_stats_t stats;
+    adc_mode_t next = ADC_MODE_WINDOW;
+    cy_rslt_t result;
+
+    event_flags_clear(&demo_events, EVT_ADC_WINDOW);
+    result = adc_window_init(&channel, 1u);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("ADC window alarms failed. Error: 0x%08lx\r\n", (unsigned long)result);
+        return ADC_MODE_POLL;
+    }
+    printf("Window alarms: an interrupt for each crossing of %lumV and %lumV. Press 'w' to poll again.\r\n",
+           (unsigned long)param_get(PARAM_ADC_WINDOW_LOW_MV), (unsigned long)param_get(PARAM_ADC_WINDOW_HIGH_MV));
+
+    while(0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
+    {
+        watchdog_end(WATCHDOG_TASK_DEMO);
+        (void)event_flags_wait_any(&demo_events, ADC_WINDOW_WAIT_EVENTS, false);
+        watchdog_begin(WATCHDOG_TASK_DEMO);
+
+        if (0u != event_flags_take(&demo_events, EVT_ADC_WINDOW))
+        {
+            while (adc_window_read_event(&event))
+            {
+                printf("Channel %u %s: %4lumV at %lu.%06lus\r\n", (unsigned int)event.channel,
+                       zone_names[event.zone], (unsigned long)adc_window_counts_to_mv(event.sample),
+                       (unsigned long)(event.time_us / 1000000u), (unsigned long)(event.time_us % 1000000u));
+            }
+        }
+        next = adc_next_mode(ADC_MODE_WINDOW);
+        if (ADC_MODE_WINDOW != next)
+        {
+            break;
+        }
+    }
+
+    adc_window_get_stats(&stats);
+    adc_window_free();
+    printf("Window alarms stopped: %lu interrupts, %lu cycles in the handler, %lu events dropped\r\n",
+           (unsigned long)stats.interrupts, (unsigned long)stats.isr_cycles, (unsigned long)stats.dropped);
+
+    return next;
+}
+
+/*******************************************************************************
+* Function Name: adc_sync_mode
+********************************************************************************
+* Summary:
+*  Runs a PWM at the pwm_hz_4 parameter and converts the potentiometer at the
+*  adc_phase parameter of each period, triggered by the PWM counter in
+*  hardware or by its interrupt handler. Prints the PWM timing, the last
+*  sample and the spread of the delays from the trigger to the end of the
+*  conversion every ADC_SYNC_REPORT_MS, until another demo or mode is
+*  selected. 't' restarts it with the other trigger.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  adc_mode_t: mode selected
+*
+*******************************************************************************/
+static adc_mode_t adc_sync_mode(void)
+{
+    static const cy_en_sar2_pin_address_t inputs[] = { ADC_PWM_SYNC_POT_INPUT };
+    static const adc_pwm_sync_pwm_t pwm = ADC_PWM_SYNC_PWM_DEFAULT;
+    adc_pwm_sync_config_t config =
+    {
+        .frequency_hz  = param_get(PARAM_PWM_FREQUENCY_4),
+        .duty_permille = ADC_SYNC_DUTY_PERMILLE,
+        .phase         = PWM_PHASE_FROM_PERMILLE(param_get(PARAM_ADC_SYNC_PHASE)),
+        .inputs        = inputs,
+        .count         = sizeof(inputs) / sizeof(inputs[0]),
+    };
+    adc_pwm_sync_stats_t stats;
+    pwm_phase_t timing;
+    adc_mode_t next = ADC_MODE_SYNC;
+    uint32_t phase;
+    cy_rslt_t result;
+
+    while ((ADC_MODE_SYNC == next) && (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH)))
+    {
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+        config.trigger = adc_sync_trigger;
+        result = adc_pwm_sync_init(&pwm, &config);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            printf("PWM synchronized sampling failed. Error: 0x%08lx\r\n", (unsigned long)result);
+            return ADC_MODE_POLL;
+        }
+        adc_pwm_sync_get_timing(&timing);
+        phase = PWM_PHASE_TO_PERMILLE(pwm_phase_actual(&timing));
+        printf("PWM %luHz, %s trigger at %lu.%lu%% of the period (compare %lu of %lu). "
+               "Press 't' to switch the trigger, 'p' to poll again.\r\n",
+               (unsigned long)pwm_phase_frequency(&timing),
+               (ADC_PWM_SYNC_TRIGGER_HW == config.trigger) ? "hardware" : "software",
+               (unsigned long)(phase / 10u), (unsigned long)(phase % 10u),
+               (unsigned long)timing.compare, (unsigned long)timing.period + 1u);
+
+        while (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
+        {
+            watchdog_checkin(WATCHDOG_TASK_DEMO);
+            event_flags_idle();
+            cyhal_system_delay_ms(ADC_SYNC_REPORT_MS);
+
+            adc_pwm_sync_get_stats(&stats, true);
+            if (0u == stats.groups)
+            {
+                printf("No conversion\r\n");
+            }
+            else
+            {
+                printf("Channel 0 input: %4lumV, %lu conversions, trigger to end of conversion %lu-%luns\r\n",
+                       (unsigned long)adc_window_counts_to_mv(stats.results[0]), (unsigned long)stats.groups,
+                       (unsigned long)pwm_phase_counts_to_ns(&timing, stats.delay_min),
+                       (unsigned long)pwm_phase_counts_to_ns(&timing, stats.delay_max));
+            }
+
+            next = adc_next_mode(ADC_MODE_SYNC);
+            if ((ADC_MODE_SYNC != next) || (config.trigger != adc_sync_trigger))
+            {
+                break;
+            }
+        }
+        adc_pwm_sync_free();
+    }
+
+    return next;
+}
+
+/*******************************************************************************
+* Function Name: adc_scope_mode
+********************************************************************************
+* Summary:
+*  Captures the potentiometer at the full rate of the SAR around the trigger
+*  of the scope_trigger, scope_level and scope_pre parameters, and sends each
+*  capture as a binary frame (scope_frame.h) on the console, for
+*  host/tools/scope_view. Without a trigger for ADC_SCOPE_AUTO_MS, a capture
+*  is forced and flagged as such. Returns when another demo or mode is
+*  selected.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  adc_mode_t: mode selected
+*
+*******************************************************************************/
+static adc_mode_t adc_scope_mode(void)
+{
+    uint32_t pre = param_get(PARAM_SCOPE_PRE);
+    adc_scope_config_t config =
+    {
+        .input   = ADC_SCOPE_POT_INPUT,
+        .trigger =
+        {
+            .mode       = (scope_trigger_mode_t)param_get(PARAM_SCOPE_TRIGGER),
+            .level      = adc_window_mv_to_counts(param_get(PARAM_SCOPE_LEVEL_MV)),
+            .hysteresis = ADC_SCOPE_HYSTERESIS,
+            .pre        = pre,
+            .post       = ADC_SCOPE_SAMPLES - pre,
+        },
+    };
+    scope_frame_header_t header =
+    {
+        .mode  = (uint8_t)config.trigger.mode,
+        .level = config.trigger.level,
+    };
+    adc_scope_capture_t capture;
+    adc_mode_t next = ADC_MODE_SCOPE;
+    uint32_t waited_ms = 0u;
+    uint32_t length;
+    cy_rslt_t result;
+
+    result = adc_scope_init(&config);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("ADC scope capture failed. Error: 0x%08lx\r\n", (unsigned long)result);
+        return ADC_MODE_POLL;
+    }
+    printf("Scope: %s trigger at %lumV, %lu of %lu samples before it. Binary frames follow, "
+           "decode them with scope_view. Press 'o' to poll again.\r\n",
+           scope_trigger_mode_name(config.trigger.mode), (unsigned long)param_get(PARAM_SCOPE_LEVEL_MV),
+           (unsigned long)pre, (unsigned long)ADC_SCOPE_SAMPLES);
+
+    while (0u == event_flags_test(&demo_events, EVT_DEMO_SWITCH))
+    {
+        watchdog_checkin(WATCHDOG_TASK_DEMO);
+        event_flags_idle();
+        cyhal_system_delay_ms(ADC_SCOPE_POLL_MS);
+        waited_ms += ADC_SCOPE_POLL_MS;
+
+        if (0u != event_flags_take(&demo_events, EVT_ADC_SCOPE))
+        {
+            (void)adc_scope_read(&capture, adc_scope_samples);
+            header.flags = capture.forced ? SCOPE_FRAME_FLAG_FORCED : 0u;
+            header.samples = (uint16_t)capture.samples;
+            header.trigger_index = (uint16_t)capture.trigger_index;
+            header.period_ns = capture.period_ns;
+            length = scope_frame_encode(&header, adc_scope_samples, adc_scope_frame, sizeof(adc_scope_frame));
+            (void)fwrite(adc_scope_frame, 1u, length, stdout);
+            (void)fflush(stdout);
+            header.sequence++;
+
+            adc_scope_arm();
+            waited_ms = 0u;
+        }
+        else if (waited_ms >= ADC_SCOPE_AUTO_MS)
+        {
+            adc_scope_force();
+        }
+
+        next = adc_next_mode(ADC_MODE_SCOPE);
+        if (ADC_MODE_SCOPE != next)
+        {
+            break;
+        }
+    }
+    adc_scope_free();
+    printf("\r\nScope stopped after %u captures\r\n", (unsigned int)header.sequence);
+
+    return next;
 }
 /*******************************************************************************
  * Function Name: adc_single_channel_init
@@ -207,10 +620,24 @@ void adc_single_channel_process(void)
 {
     /* Variable to store ADC conversion result from channel 0 */
     int32_t adc_result_0 = 0;
+    char line[ADC_LINE_SIZE];
+    uint32_t length;
+    PROFILER_ZONE_BEGIN(adc_single_channel_process);
 
-    /* Read input voltage, convert it to millivolts and print input voltage */
+    /* Read input voltage, convert it to millivolts and print input voltage,
+     * on the status line of the terminal layout */
     adc_result_0 = cyhal_adc_read_uv(&adc_chan_0_obj)/1000;
-    printf("Channel 0 input: %4ldmV\r\n", (long int)adc_result_0);
+    length = sizeof(ADC_LINE_HEAD) - 1u;
+    memcpy(line, ADC_LINE_HEAD, length);
+    length += console_fmt_dec(&line[length], adc_result_0, 4u);
+    memcpy(&line[length], "mV", 3u);
+    length += 2u;
+    if (!console_ui_status(line, length + 2u))
+    {
+        memcpy(&line[length], "\r\n", 2u);
+        io_client_write(line, length + 2u);
+    }
+    PROFILER_ZONE_END(adc_single_channel_process);
 }
 
 
@@ -0,0 +1,477 @@
+/******************************************************************************
+* File Name:   edge_capture.c
+*
+* Description: Edge capture of a pin with hardware timestamps.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "edge_capture.h"
+#include "placement.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* 32-bit capture counter of TCPWM group 1, next to the PWM of the
+ * synchronized sampling */
+#define EDGE_CAPTURE_TCPWM          (TCPWM0)
+#define EDGE_CAPTURE_GROUP          (1u)
+#define EDGE_CAPTURE_CNT            (3u)
+#define EDGE_CAPTURE_NUM            ((EDGE_CAPTURE_GROUP << 8) | EDGE_CAPTURE_CNT)
+#define EDGE_CAPTURE_PCLK           (PCLK_TCPWM0_CLOCKS259)
+#define EDGE_CAPTURE_TCPWM_IRQ      ((uint32_t)tcpwm_0_interrupts_256_IRQn + EDGE_CAPTURE_CNT)
+
+/* Trigger multiplexer output to the all-counter input 0 of TCPWM0, selected
+ * by both capture inputs of the counter */
+#define EDGE_CAPTURE_TRIG_OUT       (TRIG_OUT_MUX_5_TCPWM_0_TR_ALL_CNT_IN0)
+#define EDGE_CAPTURE_TRIG_INPUT     (CY_TCPWM_INPUT_TRIG(0u))
+
+/* Same priority as the ADC and GPIO demos, on a CPU interrupt not used by
+ * the HAL */
+#define EDGE_CAPTURE_INTR_PRIORITY  (7u)
+#define EDGE_CAPTURE_CPU_IRQ        (NvicMux7_IRQn)
+
+/* Resources held between edge_capture_init() and edge_capture_free() */
+#define EDGE_CAPTURE_HELD_COUNTER   (1u << 0)
+#define EDGE_CAPTURE_HELD_CLOCK     (1u << 1)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void edge_capture_release(void);
+static void edge_capture_rise(uint32_t time);
+static void edge_capture_fall(uint32_t time);
+static void edge_capture_isr(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const cyhal_resource_inst_t edge_capture_rsc = { CYHAL_RSC_TCPWM, EDGE_CAPTURE_GROUP, EDGE_CAPTURE_CNT };
+
+static uint32_t edge_capture_held = 0u;
+static cyhal_clock_t edge_capture_clock;
+static edge_capture_input_t edge_capture_input;
+static bool edge_capture_running = false;
+
+/* Periods queued by the handler, one array per edge so that they are read
+ * out in the layout of edge_stats_add() */
+static uint32_t edge_capture_rise_ring[EDGE_CAPTURE_RING_SIZE];
+static uint32_t edge_capture_fall_ring[EDGE_CAPTURE_RING_SIZE];
+static uint32_t edge_capture_next_ring[EDGE_CAPTURE_RING_SIZE];
+static volatile uint32_t edge_capture_head = 0u;
+static volatile uint32_t edge_capture_tail = 0u;
+
+/* Period being assembled by the handler, and the last counts it read */
+static bool edge_capture_have_rise = false;
+static bool edge_capture_have_fall = false;
+static uint32_t edge_capture_last_rise = 0u;
+static uint32_t edge_capture_last_fall = 0u;
+static uint32_t edge_capture_cc0 = 0u;
+static uint32_t edge_capture_cc1 = 0u;
+
+static volatile edge_capture_counts_t edge_capture_counts;
+
+
+/*******************************************************************************
+* Function Name: edge_capture_init
+********************************************************************************
+* Summary:
+*  Starts the capture of a pin. The pin is switched to its trigger input
+*  function, so that its edges reach the counter without the CPU; reading
+*  the pin through the GPIO driver keeps working, and its GPIO interrupt
+*  should be disabled by the caller for fast signals.
+*
+* Parameters:
+*  input: pin and its trigger input function
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, EDGE_CAPTURE_RSLT_ERR_PARAM or the error of
+*  the reservation or of the clock
+*
+*******************************************************************************/
+cy_rslt_t edge_capture_init(const edge_capture_input_t *input)
+{
+    const cy_stc_tcpwm_counter_config_t counter_cfg =
+    {
+        .period            = 0xFFFFFFFFu,
+        .clockPrescaler    = CY_TCPWM_COUNTER_PRESCALER_DIVBY_1,
+        .runMode           = CY_TCPWM_COUNTER_CONTINUOUS,
+        .countDirection    = CY_TCPWM_COUNTER_COUNT_UP,
+        .compareOrCapture  = CY_TCPWM_COUNTER_MODE_CAPTURE,
+        .interruptSources  = CY_TCPWM_INT_ON_CC0 | CY_TCPWM_INT_ON_CC1,
+        .captureInputMode  = CY_TCPWM_INPUT_RISINGEDGE,
+        .captureInput      = EDGE_CAPTURE_TRIG_INPUT,
+        .capture1InputMode = CY_TCPWM_INPUT_FALLINGEDGE,
+        .capture1Input     = EDGE_CAPTURE_TRIG_INPUT,
+        .reloadInputMode   = CY_TCPWM_INPUT_LEVEL,
+        .reloadInput       = CY_TCPWM_INPUT_0,
+        .startInputMode    = CY_TCPWM_INPUT_LEVEL,
+        .startInput        = CY_TCPWM_INPUT_0,
+        .stopInputMode     = CY_TCPWM_INPUT_LEVEL,
+        .stopInput         = CY_TCPWM_INPUT_0,
+        .countInputMode    = CY_TCPWM_INPUT_LEVEL,
+        .countInput        = CY_TCPWM_INPUT_1,
+    };
+    const cy_stc_sysint_t intr_cfg =
+    {
+        .intrSrc      = ((uint32_t)EDGE_CAPTURE_CPU_IRQ << 16) | EDGE_CAPTURE_TCPWM_IRQ,
+        .intrPriority = EDGE_CAPTURE_INTR_PRIORITY,
+    };
+    cy_rslt_t result;
+
+    if (edge_capture_running)
+    {
+        return EDGE_CAPTURE_RSLT_ERR_PARAM;
+    }
+
+    result = cyhal_hwmgr_reserve(&edge_capture_rsc);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        edge_capture_held |= EDGE_CAPTURE_HELD_COUNTER;
+        result = cyhal_clock_allocate(&edge_capture_clock, CYHAL_CLOCK_BLOCK_PERIPHERAL1_16BIT);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        edge_capture_held |= EDGE_CAPTURE_HELD_CLOCK;
+        result = cyhal_clock_set_frequency(&edge_capture_clock, EDGE_CAPTURE_CLOCK_HZ, NULL);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_clock_set_enabled(&edge_capture_clock, true, true);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        edge_capture_release();
+        return result;
+    }
+    (void)Cy_SysClk_PeriPclkAssignDivider(EDGE_CAPTURE_PCLK, CY_SYSCLK_DIV_16_BIT, edge_capture_clock.channel);
+
+    edge_capture_input = *input;
+    edge_capture_head = 0u;
+    edge_capture_tail = 0u;
+    edge_capture_have_rise = false;
+    edge_capture_have_fall = false;
+    edge_capture_cc0 = 0u;
+    edge_capture_cc1 = 0u;
+    edge_capture_get_counts(NULL, true);
+    edge_capture_running = true;
+
+    (void)Cy_TCPWM_Counter_Init(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM, &counter_cfg);
+    (void)Cy_TrigMux_Connect(input->trig_line, EDGE_CAPTURE_TRIG_OUT, false, TRIGGER_TYPE_EDGE);
+    Cy_GPIO_SetHSIOM(CYHAL_GET_PORTADDR(input->pin), CYHAL_GET_PIN(input->pin), input->hsiom);
+    (void)Cy_SysInt_Init(&intr_cfg, edge_capture_isr);
+    NVIC_EnableIRQ(EDGE_CAPTURE_CPU_IRQ);
+    Cy_TCPWM_Counter_Enable(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM);
+    Cy_TCPWM_TriggerStart_Single(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: edge_capture_free
+********************************************************************************
+* Summary:
+*  Stops the capture, gives the pin back to the GPIO driver and releases the
+*  counter and its clock. Periods still queued are discarded.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void edge_capture_free(void)
+{
+    if (!edge_capture_running)
+    {
+        return;
+    }
+
+    NVIC_DisableIRQ(EDGE_CAPTURE_CPU_IRQ);
+    Cy_TCPWM_Counter_Disable(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM);
+    Cy_GPIO_SetHSIOM(CYHAL_GET_PORTADDR(edge_capture_input.pin), CYHAL_GET_PIN(edge_capture_input.pin),
+                     HSIOM_SEL_GPIO);
+    edge_capture_release();
+    edge_capture_running = false;
+}
+
+/*******************************************************************************
+* Function Name: edge_capture_read
+********************************************************************************
+* Summary:
+*  Takes the oldest periods from the ring. Each period is the timestamp of
+*  a rising edge, of the falling edge after it and of the next rising edge,
+*  in ticks of EDGE_CAPTURE_CLOCK_HZ; the counter wraps every 2^32 ticks.
+*
+* Parameters:
+*  rise: receives the rising edges
+*  fall: receives the falling edges
+*  next: receives the rising edges ending the periods
+*  max: room in each array
+*
+* Return:
+*  uint32_t: number of periods
+*
+*******************************************************************************/
+uint32_t edge_capture_read(uint32_t *rise, uint32_t *fall, uint32_t *next, uint32_t max)
+{
+    uint32_t tail = edge_capture_tail;
+    uint32_t head = edge_capture_head;
+    uint32_t count = 0u;
+
+    while ((tail != head) && (count < max))
+    {
+        rise[count] = edge_capture_rise_ring[tail];
+        fall[count] = edge_capture_fall_ring[tail];
+        next[count] = edge_capture_next_ring[tail];
+        count++;
+        tail = (tail + 1u) % EDGE_CAPTURE_RING_SIZE;
+    }
+    __DMB();
+    edge_capture_tail = tail;
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: edge_capture_get_counts
+********************************************************************************
+* Summary:
+*  Copies the edge counts since the last reset.
+*
+* Parameters:
+*  counts: receives the counts, NULL to only reset them
+*  reset: restart the counts
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void edge_capture_get_counts(edge_capture_counts_t *counts, bool reset)
+{
+    uint32_t saved = Cy_SysLib_EnterCriticalSection();
+
+    if (NULL != counts)
+    {
+        *counts = edge_capture_counts;
+    }
+    if (reset)
+    {
+        edge_capture_counts.edges = 0u;
+        edge_capture_counts.missed = 0u;
+        edge_capture_counts.dropped = 0u;
+    }
+    Cy_SysLib_ExitCriticalSection(saved);
+}
+
+/*******************************************************************************
+* Function Name: edge_capture_release
+********************************************************************************
+* Summary:
+*  Frees the reservation and the clock held, after a failed init or at the
+*  free.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void edge_capture_release(void)
+{
+    if (0u != (edge_capture_held & EDGE_CAPTURE_HELD_CLOCK))
+    {
+        cyhal_clock_free(&edge_capture_clock);
+    }
+    if (0u != (edge_capture_held & EDGE_CAPTURE_HELD_COUNTER))
+    {
+        cyhal_hwmgr_free(&edge_capture_rsc);
+    }
+    edge_capture_held = 0u;
+}
+
+/*******************************************************************************
+* Function Name: edge_capture_rise
+********************************************************************************
+* Summary:
+*  Rising edge: ends the period started by the last rising edge, which is
+*  queued if its falling edge was seen, and starts the next one.
+*
+* Parameters:
+*  time: timestamp of the edge
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void edge_capture_rise(uint32_t time)
+{
+    if (edge_capture_have_rise && edge_capture_have_fall)
+    {
+        uint32_t head = edge_capture_head;
+        uint32_t next = (head + 1u) % EDGE_CAPTURE_RING_SIZE;
+
+        if (next != edge_capture_tail)
+        {
+            edge_capture_rise_ring[head] = edge_capture_last_rise;
+            edge_capture_fall_ring[head] = edge_capture_last_fall;
+            edge_capture_next_ring[head] = time;
+            __DMB();
+            edge_capture_head = next;
+        }
+        else
+        {
+            edge_capture_counts.dropped++;
+        }
+    }
+    else if (edge_capture_have_rise)
+    {
+        /* Two rising edges: the falling edge between them was lost */
+        edge_capture_counts.missed++;
+    }
+    edge_capture_last_rise = time;
+    edge_capture_have_rise = true;
+    edge_capture_have_fall = false;
+}
+
+/*******************************************************************************
+* Function Name: edge_capture_fall
+********************************************************************************
+* Summary:
+*  Falling edge: completes the high time of the period being assembled. A
+*  second falling edge means the rising edge between them was lost; the period
+*  is dropped and counted as missed.
+*
+* Parameters:
+*  time: timestamp of the edge
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void edge_capture_fall(uint32_t time)
+{
+    if (edge_capture_have_fall)
+    {
+        /* Two falling edges: the rising edge between them was lost */
+        edge_capture_counts.missed++;
+        edge_capture_have_rise = false;
+        edge_capture_have_fall = false;
+    }
+    else if (edge_capture_have_rise)
+    {
+        edge_capture_last_fall = time;
+        edge_capture_have_fall = true;
+    }
+    else
+    {
+        /* High when the capture started: no period before the next rise */
+    }
+}
+
+/*******************************************************************************
+* Function Name: edge_capture_isr
+********************************************************************************
+* Summary:
+*  CC0 and CC1 interrupt of the counter. The edges of both registers are
+*  handled in time order. A buffer register that differs from the count
+*  read last time means that the counter latched an edge that the handler
+*  never saw; the period being assembled is abandoned then.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void edge_capture_isr(void)
+{
+    uint32_t pending = Cy_TCPWM_GetInterruptStatusMasked(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM);
+    bool rise = (0u != (pending & CY_TCPWM_INT_ON_CC0));
+    bool fall = (0u != (pending & CY_TCPWM_INT_ON_CC1));
+    uint32_t cc0 = edge_capture_cc0;
+    uint32_t cc1 = edge_capture_cc1;
+
+    Cy_TCPWM_ClearInterrupt(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM, pending);
+
+    if (rise)
+    {
+        if (Cy_TCPWM_Counter_GetCapture0BufVal(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM) != edge_capture_cc0)
+        {
+            edge_capture_counts.missed++;
+            edge_capture_have_rise = false;
+            edge_capture_have_fall = false;
+        }
+        cc0 = Cy_TCPWM_Counter_GetCapture0Val(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM);
+        edge_capture_cc0 = cc0;
+        edge_capture_counts.edges++;
+    }
+    if (fall)
+    {
+        if (Cy_TCPWM_Counter_GetCapture1BufVal(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM) != edge_capture_cc1)
+        {
+            edge_capture_counts.missed++;
+            edge_capture_have_rise = false;
+            edge_capture_have_fall = false;
+        }
+        cc1 = Cy_TCPWM_Counter_GetCapture1Val(EDGE_CAPTURE_TCPWM, EDGE_CAPTURE_NUM);
+        edge_capture_cc1 = cc1;
+        edge_capture_counts.edges++;
+    }
+
+    /* Both pending: the earlier edge first, the counts may have wrapped */
+    if (rise && fall && ((int32_t)(cc0 - cc1) > 0))
+    {
+        edge_capture_fall(cc1);
+        edge_capture_rise(cc0);
+    }
+    else
+    {
+        if (rise)
+        {
+            edge_capture_rise(cc0);
+        }
+        if (fall)
+        {
+            edge_capture_fall(cc1);
+        }
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,106 @@
+/******************************************************************************
+* File Name:   edge_capture.h
+*
+* Description: Edge capture of a pin with hardware timestamps. The pin
+*              drives a TCPWM counter in capture mode through the trigger
+*              multiplexer: a rising edge latches the count into CC0, a
+*              falling edge into CC1. The capture handler pairs the edges
+*              into periods and queues them in a ring read by the
+*              application, so that the timestamps do not depend on the
+*              interrupt latency.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _EDGE_CAPTURE_H_
+#define _EDGE_CAPTURE_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Trigger input functions of the user buttons, the inputs of the kit that
+ * reach trigger group 5 */
+#define EDGE_CAPTURE_INPUT_BTN1                         \
+{                                                       \
+    .pin        = CYBSP_USER_BTN1,                      \
+    .hsiom      = P21_4_PERI_TR_IO_INPUT22,             \
+    .trig_line  = TRIG_IN_MUX_5_PERI_TR_IO_INPUT22,     \
+}
+#define EDGE_CAPTURE_INPUT_BTN2                         \
+{                                                       \
+    .pin        = CYBSP_USER_BTN2,                      \
+    .hsiom      = P17_3_PERI_TR_IO_INPUT17,             \
+    .trig_line  = TRIG_IN_MUX_5_PERI_TR_IO_INPUT17,     \
+}
+
+/* Clock of the capture counter: one timestamp tick is 10 ns */
+#define EDGE_CAPTURE_CLOCK_HZ       (100000000u)
+
+/* Periods queued between two reads */
+#define EDGE_CAPTURE_RING_SIZE      (1024u)
+
+/* The capture is already running */
+#define EDGE_CAPTURE_RSLT_ERR_PARAM (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x1Au))
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Pin and its trigger input function */
+typedef struct
+{
+    cyhal_gpio_t pin;
+    uint32_t     hsiom;             /* HSIOM function of the trigger input */
+    uint32_t     trig_line;         /* Trigger multiplexer input it drives */
+} edge_capture_input_t;
+
+typedef struct
+{
+    uint32_t edges;                 /* Edges captured */
+    uint32_t missed;                /* Edges lost before the handler read them */
+    uint32_t dropped;               /* Periods lost to a full ring */
+} edge_capture_counts_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t edge_capture_init(const edge_capture_input_t *input);
+extern void edge_capture_free(void);
+extern uint32_t edge_capture_read(uint32_t *rise, uint32_t *fall, uint32_t *next, uint32_t max);
+extern void edge_capture_get_counts(edge_capture_counts_t *counts, bool reset);
+
+#endif
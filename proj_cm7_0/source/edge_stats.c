@@ -0,0 +1,252 @@
+/******************************************************************************
+* File Name:   edge_stats.c
+*
+* Description: Pulse statistics of captured edges.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stddef.h>
+#include "edge_stats.h"
+
+
+/*******************************************************************************
+* Function Name: edge_stats_reset
+********************************************************************************
+* Summary:
+*  Empties the statistics.
+*
+* Parameters:
+*  stats: statistics
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void edge_stats_reset(edge_stats_t *stats)
+{
+    stats->periods = 0u;
+    stats->high_min = 0xFFFFFFFFu;
+    stats->high_max = 0u;
+    stats->high_total = 0u;
+    stats->period_min = 0xFFFFFFFFu;
+    stats->period_max = 0u;
+    stats->period_total = 0u;
+}
+
+/*******************************************************************************
+* Function Name: edge_stats_add
+********************************************************************************
+* Summary:
+*  Adds periods to the statistics. The timestamps are counts of a free
+*  running counter and may wrap between the edges of a period. Each lane
+*  keeps its own minimum, maximum and totals over every EDGE_STATS_LANES-th
+*  period, with the minimum and maximum as selects instead of branches, so
+*  that the compiler can map the lanes to vector registers; the lanes are
+*  combined at the end.
+*
+* Parameters:
+*  stats: statistics
+*  rise: rising edge of each period
+*  fall: falling edge after it
+*  next: rising edge ending the period
+*  periods: number of periods
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void edge_stats_add(edge_stats_t *stats, const uint32_t *rise, const uint32_t *fall,
+                    const uint32_t *next, uint32_t periods)
+{
+    uint32_t high_min[EDGE_STATS_LANES];
+    uint32_t high_max[EDGE_STATS_LANES];
+    uint64_t high_total[EDGE_STATS_LANES];
+    uint32_t period_min[EDGE_STATS_LANES];
+    uint32_t period_max[EDGE_STATS_LANES];
+    uint64_t period_total[EDGE_STATS_LANES];
+    uint32_t blocks = periods / EDGE_STATS_LANES;
+    uint32_t index;
+
+    for (uint32_t lane = 0u; lane < EDGE_STATS_LANES; lane++)
+    {
+        high_min[lane] = stats->high_min;
+        high_max[lane] = stats->high_max;
+        high_total[lane] = 0u;
+        period_min[lane] = stats->period_min;
+        period_max[lane] = stats->period_max;
+        period_total[lane] = 0u;
+    }
+
+    for (uint32_t block = 0u; block < blocks; block++)
+    {
+        const uint32_t base = block * EDGE_STATS_LANES;
+
+        for (uint32_t lane = 0u; lane < EDGE_STATS_LANES; lane++)
+        {
+            uint32_t high = fall[base + lane] - rise[base + lane];
+            uint32_t period = next[base + lane] - rise[base + lane];
+
+            high_min[lane] = (high < high_min[lane]) ? high : high_min[lane];
+            high_max[lane] = (high > high_max[lane]) ? high : high_max[lane];
+            high_total[lane] += high;
+            period_min[lane] = (period < period_min[lane]) ? period : period_min[lane];
+            period_max[lane] = (period > period_max[lane]) ? period : period_max[lane];
+            period_total[lane] += period;
+        }
+    }
+
+    /* The periods left over go through lane 0 */
+    for (index = blocks * EDGE_STATS_LANES; index < periods; index++)
+    {
+        uint32_t high = fall[index] - rise[index];
+        uint32_t period = next[index] - rise[index];
+
+        high_min[0] = (high < high_min[0]) ? high : high_min[0];
+        high_max[0] = (high > high_max[0]) ? high : high_max[0];
+        high_total[0] += high;
+        period_min[0] = (period < period_min[0]) ? period : period_min[0];
+        period_max[0] = (period > period_max[0]) ? period : period_max[0];
+        period_total[0] += period;
+    }
+
+    for (uint32_t lane = 0u; lane < EDGE_STATS_LANES; lane++)
+    {
+        stats->high_min = (high_min[lane] < stats->high_min) ? high_min[lane] : stats->high_min;
+        stats->high_max = (high_max[lane] > stats->high_max) ? high_max[lane] : stats->high_max;
+        stats->high_total += high_total[lane];
+        stats->period_min = (period_min[lane] < stats->period_min) ? period_min[lane] : stats->period_min;
+        stats->period_max = (period_max[lane] > stats->period_max) ? period_max[lane] : stats->period_max;
+        stats->period_total += period_total[lane];
+    }
+    stats->periods += periods;
+}
+
+/*******************************************************************************
+* Function Name: edge_stats_merge
+********************************************************************************
+* Summary:
+*  Adds the statistics of other periods, reduced separately.
+*
+* Parameters:
+*  stats: statistics, updated
+*  more: statistics added
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void edge_stats_merge(edge_stats_t *stats, const edge_stats_t *more)
+{
+    stats->periods += more->periods;
+    stats->high_min = (more->high_min < stats->high_min) ? more->high_min : stats->high_min;
+    stats->high_max = (more->high_max > stats->high_max) ? more->high_max : stats->high_max;
+    stats->high_total += more->high_total;
+    stats->period_min = (more->period_min < stats->period_min) ? more->period_min : stats->period_min;
+    stats->period_max = (more->period_max > stats->period_max) ? more->period_max : stats->period_max;
+    stats->period_total += more->period_total;
+}
+
+/*******************************************************************************
+* Function Name: edge_stats_frequency_hz
+********************************************************************************
+* Summary:
+*  Returns the average frequency of the periods, rounded.
+*
+* Parameters:
+*  stats: statistics
+*  clock_hz: clock of the timestamps
+*
+* Return:
+*  uint32_t: frequency, 0 without a period
+*
+*******************************************************************************/
+uint32_t edge_stats_frequency_hz(const edge_stats_t *stats, uint32_t clock_hz)
+{
+    if (0u == stats->period_total)
+    {
+        return 0u;
+    }
+
+    return (uint32_t)((((uint64_t)clock_hz * stats->periods) + (stats->period_total / 2u)) / stats->period_total);
+}
+
+/*******************************************************************************
+* Function Name: edge_stats_duty_permille
+********************************************************************************
+* Summary:
+*  Returns the average duty cycle: the share of the time the input was high,
+*  rounded.
+*
+* Parameters:
+*  stats: statistics
+*
+* Return:
+*  uint32_t: duty cycle in permille, 0 without a period
+*
+*******************************************************************************/
+uint32_t edge_stats_duty_permille(const edge_stats_t *stats)
+{
+    if (0u == stats->period_total)
+    {
+        return 0u;
+    }
+
+    return (uint32_t)(((stats->high_total * 1000u) + (stats->period_total / 2u)) / stats->period_total);
+}
+
+/*******************************************************************************
+* Function Name: edge_stats_ticks_to_ns
+********************************************************************************
+* Summary:
+*  Converts a duration in timestamp ticks to nanoseconds, rounded down and
+*  saturated.
+*
+* Parameters:
+*  ticks: duration in ticks, below 2^64 / 10^9
+*  clock_hz: clock of the timestamps
+*
+* Return:
+*  uint32_t: duration in nanoseconds, 0xFFFFFFFF if longer
+*
+*******************************************************************************/
+uint32_t edge_stats_ticks_to_ns(uint64_t ticks, uint32_t clock_hz)
+{
+    uint64_t ns = (ticks * 1000000000u) / clock_hz;
+
+    return (ns > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)ns;
+}
+
+
+/* [] END OF FILE */
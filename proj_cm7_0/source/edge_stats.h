@@ -0,0 +1,81 @@
+/******************************************************************************
+* File Name:   edge_stats.h
+*
+* Description: Pulse statistics of captured edges. A period is a rising edge,
+*              the falling edge after it and the next rising edge, given as
+*              three arrays of timestamps so that the reduction runs over
+*              independent lanes without a branch per edge. Only depends on
+*              the C library, so that the host runs it on recorded streams.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _EDGE_STATS_H_
+#define _EDGE_STATS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Periods reduced side by side, the vector width the compiler may use */
+#define EDGE_STATS_LANES            (8u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t periods;
+    uint32_t high_min;              /* Timestamp ticks from rise to fall */
+    uint32_t high_max;
+    uint64_t high_total;
+    uint32_t period_min;            /* Timestamp ticks from rise to the next rise */
+    uint32_t period_max;
+    uint64_t period_total;
+} edge_stats_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void edge_stats_reset(edge_stats_t *stats);
+extern void edge_stats_add(edge_stats_t *stats, const uint32_t *rise, const uint32_t *fall,
+                           const uint32_t *next, uint32_t periods);
+extern void edge_stats_merge(edge_stats_t *stats, const edge_stats_t *more);
+extern uint32_t edge_stats_frequency_hz(const edge_stats_t *stats, uint32_t clock_hz);
+extern uint32_t edge_stats_duty_permille(const edge_stats_t *stats);
+extern uint32_t edge_stats_ticks_to_ns(uint64_t ticks, uint32_t clock_hz);
+
+#endif
@@ -0,0 +1,289 @@
+/******************************************************************************
+* File Name:   event_flags.c
+*
+* Description: Event-flag group of CM7_0. The read-modify-write of the flag
+*              word retries its exclusive store until no interrupt touched the
+*              word in between. A set also signals an event (SEV), so a wait
+*              that checked the flags just before the interrupt returns from
+*              WFE at once instead of sleeping until the next interrupt.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "event_flags.h"
+#include "placement.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static volatile event_flags_idle_hook_t event_flags_idle_hook = NULL;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t event_flags_update(event_flags_t *group, uint32_t set_mask, uint32_t clear_mask);
+
+/*******************************************************************************
+* Function Name: event_flags_update
+********************************************************************************
+* Summary:
+*  Atomically clears then sets bits of the group. The host build uses the
+*  compiler atomics instead of the exclusive accesses. Placed in ITCM with
+*  event_flags_set(), which the hot interrupt handlers call.
+*
+* Parameters:
+*  group: event-flag group
+*  set_mask: bits to set
+*  clear_mask: bits to clear
+*
+* Return:
+*  uint32_t: the bits before the update
+*
+*******************************************************************************/
+static PLACE_ITCM uint32_t event_flags_update(event_flags_t *group, uint32_t set_mask, uint32_t clear_mask)
+{
+    uint32_t old_bits;
+
+#if defined(__arm__)
+    do
+    {
+        old_bits = __LDREXW(&group->bits);
+    } while (0u != __STREXW((old_bits & ~clear_mask) | set_mask, &group->bits));
+    __DMB();
+#else
+    old_bits = __atomic_load_n(&group->bits, __ATOMIC_SEQ_CST);
+    while (!__atomic_compare_exchange_n(&group->bits, &old_bits, (old_bits & ~clear_mask) | set_mask,
+                                        true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+    {
+    }
+#endif /* defined(__arm__) */
+
+    return old_bits;
+}
+
+/*******************************************************************************
+* Function Name: event_flags_set
+********************************************************************************
+* Summary:
+*  Posts events. Callable from interrupt handlers and from thread mode.
+*
+* Parameters:
+*  group: event-flag group
+*  mask: events to post
+*
+* Return:
+*  uint32_t: the bits before the update. A bit of mask already set there
+*            means the event merged with one not taken yet.
+*
+*******************************************************************************/
+PLACE_ITCM uint32_t event_flags_set(event_flags_t *group, uint32_t mask)
+{
+    uint32_t old_bits = event_flags_update(group, mask, 0u);
+
+    /* Wake a waiter that checked the flags before this update */
+    __DSB();
+    __SEV();
+
+    return old_bits;
+}
+
+/*******************************************************************************
+* Function Name: event_flags_clear
+********************************************************************************
+* Summary:
+*  Drops events without handling them.
+*
+* Parameters:
+*  group: event-flag group
+*  mask: events to drop
+*
+* Return:
+*  uint32_t: the bits before the update
+*
+*******************************************************************************/
+uint32_t event_flags_clear(event_flags_t *group, uint32_t mask)
+{
+    return event_flags_update(group, 0u, mask);
+}
+
+/*******************************************************************************
+* Function Name: event_flags_test
+********************************************************************************
+* Summary:
+*  Reads events without consuming them.
+*
+* Parameters:
+*  group: event-flag group
+*  mask: events to read
+*
+* Return:
+*  uint32_t: the pending events of mask
+*
+*******************************************************************************/
+uint32_t event_flags_test(const event_flags_t *group, uint32_t mask)
+{
+    return group->bits & mask;
+}
+
+/*******************************************************************************
+* Function Name: event_flags_take
+********************************************************************************
+* Summary:
+*  Consumes the pending events of mask in one atomic step, so an event posted
+*  right after the read stays pending for the next take.
+*
+* Parameters:
+*  group: event-flag group
+*  mask: events to consume
+*
+* Return:
+*  uint32_t: the consumed events, 0 if none of mask was pending
+*
+*******************************************************************************/
+uint32_t event_flags_take(event_flags_t *group, uint32_t mask)
+{
+    if (0u == (group->bits & mask))
+    {
+        /* Nothing to consume, skip the exclusive access */
+        return 0u;
+    }
+
+    return event_flags_update(group, 0u, mask) & mask;
+}
+
+/*******************************************************************************
+* Function Name: event_flags_wait_any
+********************************************************************************
+* Summary:
+*  Sleeps in WFE until at least one event of mask is pending. Do not call it
+*  with the interrupts masked: the handlers that post the events must run.
+*
+* Parameters:
+*  group: event-flag group
+*  mask: events to wait for
+*  clear: true to consume the events returned
+*
+* Return:
+*  uint32_t: the pending events of mask
+*
+*******************************************************************************/
+uint32_t event_flags_wait_any(event_flags_t *group, uint32_t mask, bool clear)
+{
+    uint32_t bits;
+
+    for (;;)
+    {
+        bits = clear ? event_flags_take(group, mask) : event_flags_test(group, mask);
+        if (0u != bits)
+        {
+            return bits;
+        }
+        event_flags_idle();
+        __WFE();
+    }
+}
+
+/*******************************************************************************
+* Function Name: event_flags_wait_all
+********************************************************************************
+* Summary:
+*  Sleeps in WFE until every event of mask is pending. The handlers only set
+*  bits, so the events found pending are still pending when they are taken.
+*
+* Parameters:
+*  group: event-flag group
+*  mask: events to wait for
+*  clear: true to consume the events of mask
+*
+* Return:
+*  uint32_t: mask
+*
+*******************************************************************************/
+uint32_t event_flags_wait_all(event_flags_t *group, uint32_t mask, bool clear)
+{
+    while (mask != event_flags_test(group, mask))
+    {
+        event_flags_idle();
+        __WFE();
+    }
+
+    return clear ? event_flags_take(group, mask) : mask;
+}
+
+/*******************************************************************************
+* Function Name: event_flags_set_idle_hook
+********************************************************************************
+* Summary:
+*  Registers the work to run in thread mode before each WFE of the waits, for
+*  the interrupt handlers that post it instead of doing it themselves. The
+*  hook must not wait on an event-flag group.
+*
+* Parameters:
+*  hook: function to call, NULL for none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void event_flags_set_idle_hook(event_flags_idle_hook_t hook)
+{
+    event_flags_idle_hook = hook;
+}
+
+/*******************************************************************************
+* Function Name: event_flags_idle
+********************************************************************************
+* Summary:
+*  Runs the idle hook. Also called by the demo loops that poll instead of
+*  waiting. An event posted while the hook runs also sets the event register,
+*  so the following WFE returns at once.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void event_flags_idle(void)
+{
+    event_flags_idle_hook_t hook = event_flags_idle_hook;
+
+    if (NULL != hook)
+    {
+        hook();
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,80 @@
+/******************************************************************************
+* File Name:   event_flags.h
+*
+* Description: Event-flag group shared by the interrupt handlers and the demo
+*              loops. Each event is one bit of a 32-bit word that is set and
+*              cleared with exclusive accesses (LDREX/STREX), so an event
+*              posted by an interrupt is never lost by a concurrent clear of
+*              another bit. The waits sleep in WFE between the checks.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _EVENT_FLAGS_H_
+#define _EVENT_FLAGS_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Static initializer of a group with the given bits already set */
+#define EVENT_FLAGS_INIT(bits)          { (bits) }
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    volatile uint32_t bits;         /* One bit per event, set while pending */
+} event_flags_t;
+
+/* Work run in thread mode each time a wait is about to sleep */
+typedef void (*event_flags_idle_hook_t)(void);
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern uint32_t event_flags_set(event_flags_t *group, uint32_t mask);
+extern uint32_t event_flags_clear(event_flags_t *group, uint32_t mask);
+extern uint32_t event_flags_test(const event_flags_t *group, uint32_t mask);
+extern uint32_t event_flags_take(event_flags_t *group, uint32_t mask);
+extern uint32_t event_flags_wait_any(event_flags_t *group, uint32_t mask, bool clear);
+extern uint32_t event_flags_wait_all(event_flags_t *group, uint32_t mask, bool clear);
+extern void event_flags_set_idle_hook(event_flags_idle_hook_t hook);
+extern void event_flags_idle(void);
+
+#endif
@@ -0,0 +1,454 @@
+/*******************************************************************************
+* File Name:   io_client.c
+*
+* Description: Console and button input of CM7_0. By default CM7_0 services the
+*              debug UART and the button interrupts itself. With
+*              IO_COPROCESSOR=1 the CM0+ owns them: the console keys and the
+*              debounced button presses arrive as events over the IPC event
+*              ring, handled in the doorbell interrupt, and the console output
+*              is sent to CM0+ over the console ring.
+*
+*              Both paths record the time spent in their interrupts, so the
+*              load removed from CM7_0 can be compared between the two builds.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include "io_client.h"
+#include "ipc_io.h"
+#include "ipc_logger.h"
+#include "button.h"
+#include "print_message.h"
+#include "oob_demo.h"
+#include "cy_retarget_io.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Time CM0+ has to take over the console after the shared block is published */
+#define IO_CLIENT_ATTACH_TIMEOUT_MS (100u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Shared block, set once CM0+ serves the console */
+static ipc_shared_t *io_client_shared = NULL;
+
+static io_client_load_t io_client_load;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void io_client_log_sink(const ipc_log_record_t *record, void *arg);
+static void io_client_service(void);
+
+
+/*******************************************************************************
+* Function Name: io_client_init
+********************************************************************************
+* Summary:
+*  Registers the log drain as the idle work of the event-flag waits. With
+*  IO_COPROCESSOR=1, also waits for CM0+ to take over the debug UART and the
+*  buttons and redirects the console output to it.
+*
+* Parameters:
+*  shared: inter-processor shared block
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void io_client_init(ipc_shared_t *shared)
+{
+    event_flags_set_idle_hook(io_client_service);
+
+#if IO_COPROCESSOR
+    for (uint32_t wait = 0u; wait < IO_CLIENT_ATTACH_TIMEOUT_MS; wait++)
+    {
+        if (0u != ipc_comm_get_flag(&shared->cm0p_ready))
+        {
+            /* Every printf() is handed to CM0+ at once, as with retarget-io */
+            setvbuf(stdout, NULL, _IONBF, 0);
+            io_client_shared = shared;
+            break;
+        }
+        Cy_SysLib_Delay(1u);
+    }
+#else
+    (void)shared;
+#endif /* IO_COPROCESSOR */
+}
+
+/*******************************************************************************
+* Function Name: io_client_dispatch
+********************************************************************************
+* Summary:
+*  Doorbell callback. Applies the console and button events forwarded by CM0+
+*  the same way the local UART and button interrupts do. The log records are
+*  printed later in thread mode, the debug UART output blocks.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void io_client_dispatch(void)
+{
+    ipc_msg_t      msg;
+    ipc_io_event_t event;
+    bool           line_key;
+    uint16_t       type;
+    uint32_t       start;
+
+    event_flags_set(&demo_events, EVT_LOG);
+
+    if (NULL == io_client_shared)
+    {
+        return;
+    }
+
+    start = io_client_load_begin();
+    while (ipc_ring_pop(&io_client_shared->io_to_cm7_0, &msg))
+    {
+        if (!ipc_io_get_event(&msg, &type, &event))
+        {
+            continue;
+        }
+
+        switch (type)
+        {
+            case IPC_IO_EVT_DEMO_SELECT:
+                recCmd = event.code;
+                line_key = console_line_rx(event.code);
+                event_flags_set(&demo_events, EVT_CONSOLE_KEY);
+                if (line_key)
+                {
+                    /* A digit typed in the parameter console */
+                    break;
+                }
+                if (((event.code & 0x0F) <= DEMONUM) && (demoIndex != (event.code & 0x0F)))
+                {
+                    /* Set demoIndex */
+                    demoIndex = event.code & 0x0F;
+                    /* Post the demo switch event */
+                    event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+                }
+                break;
+            case IPC_IO_EVT_KEY:
+                recCmd = event.code;
+                (void)console_line_rx(event.code);
+                event_flags_set(&demo_events, EVT_CONSOLE_KEY);
+                break;
+            case IPC_IO_EVT_BUTTON:
+                button_post_event(event.code, event.held_ms);
+                break;
+            default:
+                break;
+        }
+    }
+    io_client_load_end(start);
+}
+
+/*******************************************************************************
+* Function Name: io_client_service
+********************************************************************************
+* Summary:
+*  Idle hook of the event-flag waits. Prints the log records of all the cores
+*  announced by the doorbell when CM7_0 owns the console.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_client_service(void)
+{
+    if (0u != event_flags_take(&demo_events, EVT_LOG))
+    {
+        (void)ipc_logger_drain(io_client_log_sink, NULL);
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_client_tx_active
+********************************************************************************
+* Summary:
+*  Checks whether console output is still waiting to be sent.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  true while the debug UART (or the CM0+ console ring) is not empty
+*
+*******************************************************************************/
+bool io_client_tx_active(void)
+{
+#if IO_COPROCESSOR
+    return (NULL != io_client_shared) &&
+           (0u != ipc_ring_count(&io_client_shared->console_to_cm0p));
+#else
+    return cyhal_uart_is_tx_active(&cy_retarget_io_uart_obj);
+#endif /* IO_COPROCESSOR */
+}
+
+/*******************************************************************************
+* Function Name: io_client_load_begin
+********************************************************************************
+* Summary:
+*  Called on entry of a console or button interrupt.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: DWT cycle counter, to pass to io_client_load_end()
+*
+*******************************************************************************/
+uint32_t io_client_load_begin(void)
+{
+    return DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: io_client_load_end
+********************************************************************************
+* Summary:
+*  Called on exit of a console or button interrupt. Records its duration.
+*
+* Parameters:
+*  start: value returned by io_client_load_begin()
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void io_client_load_end(uint32_t start)
+{
+    uint32_t cycles = DWT->CYCCNT - start;
+
+    io_client_load.count++;
+    io_client_load.cycles_total += cycles;
+    if (cycles > io_client_load.cycles_max)
+    {
+        io_client_load.cycles_max = cycles;
+    }
+}
+
+/*******************************************************************************
+* Function Name: io_client_get_load
+********************************************************************************
+* Summary:
+*  Returns the interrupt load recorded since the last reset.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  const io_client_load_t*: recorded load
+*
+*******************************************************************************/
+const io_client_load_t *io_client_get_load(void)
+{
+    return &io_client_load;
+}
+
+/*******************************************************************************
+* Function Name: io_client_reset_load
+********************************************************************************
+* Summary:
+*  Clears the recorded interrupt load.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void io_client_reset_load(void)
+{
+    uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+
+    io_client_load.count = 0u;
+    io_client_load.cycles_max = 0u;
+    io_client_load.cycles_total = 0u;
+    Cy_SysLib_ExitCriticalSection(intr_status);
+}
+
+/*******************************************************************************
+* Function Name: io_client_print_load
+********************************************************************************
+* Summary:
+*  Prints the console and button interrupt load of CM7_0.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void io_client_print_load(void)
+{
+    io_client_load_t load;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+    uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+
+    load = io_client_load;
+    Cy_SysLib_ExitCriticalSection(intr_status);
+
+#if IO_COPROCESSOR
+    printf("Console and buttons on the CM0+ I/O co-processor (IPC doorbell interrupts)\r\n");
+#else
+    printf("Console and buttons on CM7_0 (UART and GPIO interrupts)\r\n");
+#endif /* IO_COPROCESSOR */
+    printf("  Interrupts : %lu\r\n", (unsigned long)load.count);
+    printf("  Average    : %lu cycles\r\n",
+           (unsigned long)((0u != load.count) ? (load.cycles_total / load.count) : 0u));
+    printf("  Maximum    : %lu cycles\r\n", (unsigned long)load.cycles_max);
+    printf("  Total      : %lu us\r\n", (unsigned long)(load.cycles_total / cycles_per_us));
+}
+
+/*******************************************************************************
+* Function Name: io_client_log_sink
+********************************************************************************
+* Summary:
+*  Writes a log record to the debug UART. Only called when CM7_0 is the log
+*  owner, that is when it owns the debug UART.
+*
+* Parameters:
+*  record: log record of any core
+*  arg: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void io_client_log_sink(const ipc_log_record_t *record, void *arg)
+{
+#if IO_COPROCESSOR
+    (void)record;
+#else
+    char line[IPC_LOGGER_LINE_SIZE];
+    uint32_t length = ipc_logger_format(record, line, sizeof(line));
+
+    for (uint32_t index = 0u; index < length; index++)
+    {
+        (void)cyhal_uart_putc(&cy_retarget_io_uart_obj, (uint32_t)line[index]);
+    }
+#endif /* IO_COPROCESSOR */
+    (void)arg;
+}
+
+/*******************************************************************************
+* Function Name: io_client_write
+********************************************************************************
+* Summary:
+*  Sends console output without going through stdio: into the console ring
+*  of CM0+, waiting for room, with IO_COPROCESSOR=1, and to the debug UART
+*  otherwise. Output is dropped if CM0+ never took over the console.
+*
+* Parameters:
+*  text: characters to send
+*  length: number of characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void io_client_write(const char *text, uint32_t length)
+{
+#if IO_COPROCESSOR
+    uint32_t sent = 0u;
+
+    if (NULL == io_client_shared)
+    {
+        return;
+    }
+
+    while (sent < length)
+    {
+        uint32_t queued = ipc_io_write_console(&io_client_shared->console_to_cm0p, &text[sent], length - sent);
+
+        /* A full ring is already being drained, no need to ring again */
+        if (0u != queued)
+        {
+            ipc_comm_ring_doorbell(IPC_CORE_CM0P);
+            sent += queued;
+        }
+    }
+#else
+    for (uint32_t index = 0u; index < length; index++)
+    {
+        (void)cyhal_uart_putc(&cy_retarget_io_uart_obj, (uint32_t)text[index]);
+    }
+#endif /* IO_COPROCESSOR */
+}
+
+#if IO_COPROCESSOR
+/*******************************************************************************
+* Function Name: _write
+********************************************************************************
+* Summary:
+*  Newlib output hook, replaces the retarget-io one. Queues the console output
+*  for CM0+, see io_client_write().
+*
+* Parameters:
+*  fd: file descriptor (unused, stdout and stderr both go to the console)
+*  ptr: characters to send
+*  len: number of characters
+*
+* Return:
+*  int: number of characters consumed
+*
+*******************************************************************************/
+int _write(int fd, const char *ptr, int len)
+{
+    (void)fd;
+    io_client_write(ptr, (uint32_t)len);
+
+    return len;
+}
+#endif /* IO_COPROCESSOR */
+
+/* [] END OF FILE */
@@ -0,0 +1,81 @@
+/******************************************************************************
+* File Name:   io_client.h
+*
+* Description: Console and button input of CM7_0, either serviced by local
+*              interrupts or received from the CM0+ I/O co-processor, and the
+*              measurement of the interrupt load it puts on CM7_0.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _IO_CLIENT_H_
+#define _IO_CLIENT_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "ipc_comm.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#ifndef IO_COPROCESSOR
+#define IO_COPROCESSOR              (0)
+#endif
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Console and button interrupt load of CM7_0 */
+typedef struct
+{
+    uint32_t count;                 /* Interrupts serviced */
+    uint32_t cycles_max;            /* Longest interrupt, in CM7_0 clock cycles */
+    uint64_t cycles_total;
+} io_client_load_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void io_client_init(ipc_shared_t *shared);
+extern void io_client_dispatch(void);
+extern bool io_client_tx_active(void);
+extern void io_client_write(const char *text, uint32_t length);
+extern uint32_t io_client_load_begin(void);
+extern void io_client_load_end(uint32_t start);
+extern const io_client_load_t *io_client_get_load(void);
+extern void io_client_reset_load(void);
+extern void io_client_print_load(void);
+
+#endif
@@ -0,0 +1,475 @@
+/*******************************************************************************
+* File Name:   ipc_offload.c
+*
+* Description: CM7_0 client of the work offloaded to CM7_1. Owns the shared block
+*              with the message rings, sends requests and waits for the responses,
+*              and benchmarks the rings with the DWT cycle counter.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "ipc_offload.h"
+#include "io_client.h"
+#include "ipc_logger.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Doorbell interrupt, on a CPU interrupt line not used by the HAL */
+#define IPC_DOORBELL_CPU_IRQ        (NvicMux4_IRQn)
+#define IPC_DOORBELL_PRIORITY       (4u)
+
+/* Time CM7_1 has to answer a request */
+#define IPC_OFFLOAD_TIMEOUT_MS      (10u)
+
+/* Number of messages of the latency and throughput benchmarks */
+#define IPC_BENCH_LATENCY_COUNT     (1000u)
+#define IPC_BENCH_THROUGHPUT_COUNT  (10000u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t ipc_offload_timeout_cycles(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Shared block in SRAM, visible to all cores */
+CY_SECTION_SHAREDMEM static ipc_shared_t ipc_shared;
+
+static bool     ipc_offload_published = false;
+static uint32_t ipc_offload_seq = 0u;
+
+
+/*******************************************************************************
+* Function Name: ipc_offload_init
+********************************************************************************
+* Summary:
+*  Starts the cross-core log, publishes the shared block to the other cores
+*  and enables the CM7_0 doorbell interrupt, which also delivers the events of
+*  the CM0+ I/O co-processor. The DWT cycle counter is started by
+*  profiler_init().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: result of the shared block publication
+*
+*******************************************************************************/
+cy_rslt_t ipc_offload_init(void)
+{
+    cy_rslt_t result;
+
+    /* The logs are drained by the core that owns the debug UART */
+    (void)ipc_logger_start(&ipc_shared, IO_COPROCESSOR ? IPC_CORE_CM0P : IPC_CORE_CM7_0);
+
+    result = ipc_comm_publish(&ipc_shared);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        ipc_comm_doorbell_init(IPC_CORE_CM7_0, IPC_DOORBELL_CPU_IRQ, IPC_DOORBELL_PRIORITY,
+                               io_client_dispatch);
+        ipc_offload_published = true;
+        ipc_logger_attach(&ipc_shared, IPC_CORE_CM7_0);
+        io_client_init(&ipc_shared);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_ready
+********************************************************************************
+* Summary:
+*  Checks whether CM7_1 has attached to the shared block.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  true if requests can be sent
+*
+*******************************************************************************/
+bool ipc_offload_ready(void)
+{
+    return ipc_offload_published && (0u != ipc_comm_get_flag(&ipc_shared.cm7_1_ready));
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_memory
+********************************************************************************
+* Summary:
+*  Takes the memory record of a core: measured now for CM7_0, as last
+*  published in the shared block for CM7_1 and CM0+.
+*
+* Parameters:
+*  core: core of the record
+*  record: record to fill
+*
+* Return:
+*  true if the record is valid, false if the core has not published one
+*
+*******************************************************************************/
+bool ipc_offload_memory(ipc_core_t core, mem_guard_record_t *record)
+{
+    if (IPC_CORE_CM7_0 == core)
+    {
+        mem_guard_get(record);
+        if (ipc_offload_published)
+        {
+            mem_guard_publish(&ipc_shared.memory[IPC_CORE_CM7_0]);
+        }
+        return true;
+    }
+
+    return ipc_offload_published && mem_guard_read(&ipc_shared.memory[core], record);
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_cycles
+********************************************************************************
+* Summary:
+*  Returns the DWT cycle counter.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: CM7_0 clock cycles
+*
+*******************************************************************************/
+uint32_t ipc_offload_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_call
+********************************************************************************
+* Summary:
+*  Sends a request to CM7_1 and waits for its response. Responses of earlier
+*  requests that timed out are discarded.
+*
+* Parameters:
+*  msg: request on entry (opcode, length and payload), response on return
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or one of the IPC_OFFLOAD_RSLT_ERR_* codes
+*
+*******************************************************************************/
+cy_rslt_t ipc_offload_call(ipc_msg_t *msg)
+{
+    uint32_t seq;
+    uint32_t start;
+    uint32_t timeout = ipc_offload_timeout_cycles();
+
+    if (!ipc_offload_ready())
+    {
+        return IPC_OFFLOAD_RSLT_ERR_NOT_READY;
+    }
+
+    seq = ++ipc_offload_seq;
+    msg->seq = seq;
+    start = ipc_offload_cycles();
+    msg->stamp = start;
+
+    while (!ipc_ring_push(&ipc_shared.to_cm7_1, msg))
+    {
+        if ((ipc_offload_cycles() - start) > timeout)
+        {
+            return IPC_OFFLOAD_RSLT_ERR_TIMEOUT;
+        }
+    }
+    ipc_comm_ring_doorbell(IPC_CORE_CM7_1);
+
+    for (;;)
+    {
+        if (ipc_ring_pop(&ipc_shared.to_cm7_0, msg))
+        {
+            if (msg->seq == seq)
+            {
+                break;
+            }
+        }
+        else if ((ipc_offload_cycles() - start) > timeout)
+        {
+            ipc_logger_printf("request %lu timed out", (unsigned long)seq);
+            return IPC_OFFLOAD_RSLT_ERR_TIMEOUT;
+        }
+    }
+
+    return (0u != (msg->opcode & IPC_OP_ERROR)) ? IPC_OFFLOAD_RSLT_ERR_REJECTED : CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_adc_filter
+********************************************************************************
+* Summary:
+*  Lets CM7_1 reduce a block of ADC samples to its mean, minimum and maximum.
+*
+* Parameters:
+*  samples: ADC samples
+*  count: number of samples, 1 to IPC_ADC_FILTER_MAX
+*  rsp: filter result
+*
+* Return:
+*  cy_rslt_t: result of the request
+*
+*******************************************************************************/
+cy_rslt_t ipc_offload_adc_filter(const int16_t *samples, uint16_t count,
+                                 ipc_adc_filter_rsp_t *rsp)
+{
+    cy_rslt_t result;
+    ipc_msg_t msg;
+    ipc_adc_filter_req_t req;
+
+    if (count > IPC_ADC_FILTER_MAX)
+    {
+        count = IPC_ADC_FILTER_MAX;
+    }
+    memset(&req, 0, sizeof(req));
+    req.count = count;
+    memcpy(req.sample, samples, count * sizeof(int16_t));
+
+    memset(&msg, 0, sizeof(msg));
+    msg.opcode = IPC_OP_ADC_FILTER;
+    msg.length = sizeof(req);
+    memcpy(msg.payload, &req, sizeof(req));
+
+    result = ipc_offload_call(&msg);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memcpy(rsp, msg.payload, sizeof(ipc_adc_filter_rsp_t));
+    }
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_crc32
+********************************************************************************
+* Summary:
+*  Lets CM7_1 verify the CRC-32 of a buffer. The buffer must be in SRAM; it is
+*  written back from the CM7_0 D-cache before the request is sent.
+*
+* Parameters:
+*  buf: buffer in SRAM
+*  length: size of the buffer in bytes
+*  expected: expected CRC-32
+*  rsp: CRC-32 calculated by CM7_1 and the match flag
+*
+* Return:
+*  cy_rslt_t: result of the request
+*
+*******************************************************************************/
+cy_rslt_t ipc_offload_crc32(const uint8_t *buf, uint32_t length,
+                            uint32_t expected, ipc_crc32_rsp_t *rsp)
+{
+    cy_rslt_t result;
+    ipc_msg_t msg;
+    ipc_crc32_req_t req;
+
+    ipc_cache_clean((volatile void *)buf, length);
+
+    req.addr = (uint32_t)(uintptr_t)buf;
+    req.length = length;
+    req.expected = expected;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.opcode = IPC_OP_CRC32;
+    msg.length = sizeof(req);
+    memcpy(msg.payload, &req, sizeof(req));
+
+    result = ipc_offload_call(&msg);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memcpy(rsp, msg.payload, sizeof(ipc_crc32_rsp_t));
+    }
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_can_frame
+********************************************************************************
+* Summary:
+*  Lets CM7_1 process a received CAN frame into the frame to send back.
+*
+* Parameters:
+*  frame: received frame on entry, processed frame on return
+*
+* Return:
+*  cy_rslt_t: result of the request
+*
+*******************************************************************************/
+cy_rslt_t ipc_offload_can_frame(ipc_can_frame_t *frame)
+{
+    cy_rslt_t result;
+    ipc_msg_t msg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.opcode = IPC_OP_CAN_FRAME;
+    msg.length = sizeof(ipc_can_frame_t);
+    memcpy(msg.payload, frame, sizeof(ipc_can_frame_t));
+
+    result = ipc_offload_call(&msg);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memcpy(frame, msg.payload, sizeof(ipc_can_frame_t));
+    }
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_benchmark
+********************************************************************************
+* Summary:
+*  Measures the round trip of one echo message through idle rings, then the
+*  throughput and the average round trip with the request ring kept full.
+*  The number of messages in flight never exceeds the ring depth, so CM7_1
+*  never waits for space in the response ring.
+*
+* Parameters:
+*  bench: benchmark results
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or one of the IPC_OFFLOAD_RSLT_ERR_* codes
+*
+*******************************************************************************/
+cy_rslt_t ipc_offload_benchmark(ipc_offload_bench_t *bench)
+{
+    cy_rslt_t result;
+    ipc_msg_t msg;
+    uint64_t latency_sum = 0u;
+    uint32_t sent = 0u;
+    uint32_t received = 0u;
+    uint32_t start;
+    uint32_t total;
+    uint32_t last_progress;
+    uint32_t timeout = ipc_offload_timeout_cycles();
+
+    memset(bench, 0, sizeof(ipc_offload_bench_t));
+    bench->latency_min = UINT32_MAX;
+
+    /* Round trip through idle rings */
+    for (uint32_t idx = 0; idx < IPC_BENCH_LATENCY_COUNT; idx++)
+    {
+        memset(&msg, 0, sizeof(msg));
+        msg.opcode = IPC_OP_ECHO;
+        start = ipc_offload_cycles();
+        result = ipc_offload_call(&msg);
+        total = ipc_offload_cycles() - start;
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+        latency_sum += total;
+        if (total < bench->latency_min)
+        {
+            bench->latency_min = total;
+        }
+        if (total > bench->latency_max)
+        {
+            bench->latency_max = total;
+        }
+    }
+    bench->latency_avg = (uint32_t)(latency_sum / IPC_BENCH_LATENCY_COUNT);
+
+    /* Pipelined throughput */
+    latency_sum = 0u;
+    memset(&msg, 0, sizeof(msg));
+    msg.opcode = IPC_OP_ECHO;
+    start = ipc_offload_cycles();
+    last_progress = start;
+    while (received < IPC_BENCH_THROUGHPUT_COUNT)
+    {
+        uint32_t queued = 0u;
+
+        while ((sent < IPC_BENCH_THROUGHPUT_COUNT) && ((sent - received) < IPC_RING_DEPTH))
+        {
+            msg.seq = ++ipc_offload_seq;
+            msg.stamp = ipc_offload_cycles();
+            if (!ipc_ring_push(&ipc_shared.to_cm7_1, &msg))
+            {
+                break;
+            }
+            sent++;
+            queued++;
+        }
+        if (0u != queued)
+        {
+            ipc_comm_ring_doorbell(IPC_CORE_CM7_1);
+        }
+
+        while (ipc_ring_pop(&ipc_shared.to_cm7_0, &msg))
+        {
+            latency_sum += ipc_offload_cycles() - msg.stamp;
+            received++;
+            last_progress = ipc_offload_cycles();
+        }
+
+        if ((ipc_offload_cycles() - last_progress) > timeout)
+        {
+            return IPC_OFFLOAD_RSLT_ERR_TIMEOUT;
+        }
+    }
+    total = ipc_offload_cycles() - start;
+
+    bench->loaded_latency_avg = (uint32_t)(latency_sum / IPC_BENCH_THROUGHPUT_COUNT);
+    bench->messages_per_s = (uint32_t)(((uint64_t)IPC_BENCH_THROUGHPUT_COUNT * SystemCoreClock) / total);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ipc_offload_timeout_cycles
+********************************************************************************
+* Summary:
+*  Returns IPC_OFFLOAD_TIMEOUT_MS in CM7_0 clock cycles.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: timeout in cycles
+*
+*******************************************************************************/
+static uint32_t ipc_offload_timeout_cycles(void)
+{
+    return (SystemCoreClock / 1000u) * IPC_OFFLOAD_TIMEOUT_MS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,88 @@
+/******************************************************************************
+* File Name:   ipc_offload.h
+*
+* Description: CM7_0 client of the work offloaded to CM7_1 over the
+*              inter-processor message rings.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _IPC_OFFLOAD_H_
+#define _IPC_OFFLOAD_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "ipc_comm.h"
+#include "ipc_offload_msg.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* CM7_1 has not attached to the shared block yet */
+#define IPC_OFFLOAD_RSLT_ERR_NOT_READY  (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 1u))
+/* CM7_1 did not answer in time */
+#define IPC_OFFLOAD_RSLT_ERR_TIMEOUT    (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 2u))
+/* CM7_1 rejected the request as malformed */
+#define IPC_OFFLOAD_RSLT_ERR_REJECTED   (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 3u))
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Ring benchmark results, in CM7_0 clock cycles */
+typedef struct
+{
+    uint32_t latency_min;       /* Round trip of one message, idle rings */
+    uint32_t latency_avg;
+    uint32_t latency_max;
+    uint32_t loaded_latency_avg;/* Round trip with the rings kept full */
+    uint32_t messages_per_s;    /* Pipelined echo throughput */
+} ipc_offload_bench_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t ipc_offload_init(void);
+extern bool ipc_offload_ready(void);
+extern bool ipc_offload_memory(ipc_core_t core, mem_guard_record_t *record);
+extern uint32_t ipc_offload_cycles(void);
+extern cy_rslt_t ipc_offload_call(ipc_msg_t *msg);
+extern cy_rslt_t ipc_offload_adc_filter(const int16_t *samples, uint16_t count,
+                                        ipc_adc_filter_rsp_t *rsp);
+extern cy_rslt_t ipc_offload_crc32(const uint8_t *buf, uint32_t length,
+                                   uint32_t expected, ipc_crc32_rsp_t *rsp);
+extern cy_rslt_t ipc_offload_can_frame(ipc_can_frame_t *frame);
+extern cy_rslt_t ipc_offload_benchmark(ipc_offload_bench_t *bench);
+
+#endif
@@ -0,0 +1,608 @@
+/******************************************************************************
+* File Name:   latency.c
+*
+* Description: Interrupt latency harness of CM7_0, comparing the HAL callback
+*              dispatch with PDL handlers for a GPIO edge and a timer terminal
+*              count.
+*
+*              The GPIO edge is made by inverting an output pin and is seen by
+*              the input buffer of the same pin; the cycle counter is read
+*              right before the write. The timer counts from 0 again at its
+*              terminal count, so its value at the handler entry is the
+*              latency in counter clocks.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include "latency.h"
+#include "latency_hist.h"
+#include "profiler.h"
+#include "placement.h"
+#include "resource_manager.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Same priority as the GPIO demo */
+#define LATENCY_INTR_PRIORITY       (7u)
+
+/* CPU interrupt of the PDL handlers, not used by the HAL */
+#define LATENCY_CPU_IRQ             (NvicMux6_IRQn)
+
+/* Owner of the GPIO in the resource manager */
+#define LATENCY_OWNER               "latency"
+
+/* 16-bit TCPWM counter (group 0) of the PDL timer measurement */
+#define LATENCY_TCPWM               (TCPWM0)
+#define LATENCY_TCPWM_GROUP         (0u)
+#define LATENCY_TCPWM_CNT           (10u)
+#define LATENCY_TCPWM_PCLK          ((en_clk_dst_t)((uint32_t)PCLK_TCPWM0_CLOCKS0 + LATENCY_TCPWM_CNT))
+#define LATENCY_TCPWM_IRQ           ((uint32_t)tcpwm_0_interrupts_0_IRQn + LATENCY_TCPWM_CNT)
+
+/* Time given to a handler, in cycles */
+#define LATENCY_TIMEOUT_CYCLES      (SystemCoreClock / 10u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    cy_rslt_t (*run)(uint32_t *entry, uint32_t *main_loop);
+} latency_path_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static cy_rslt_t latency_gpio_pdl(uint32_t *entry, uint32_t *main_loop);
+static cy_rslt_t latency_gpio_hal(uint32_t *entry, uint32_t *main_loop);
+static cy_rslt_t latency_timer_pdl(uint32_t *entry, uint32_t *main_loop);
+static cy_rslt_t latency_timer_hal(uint32_t *entry, uint32_t *main_loop);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* PDL first: the HAL routes the port interrupt again when it enables an event */
+static const latency_path_t latency_paths[] =
+{
+    { "GPIO edge, PDL handler",       latency_gpio_pdl  },
+    { "GPIO edge, HAL callback",      latency_gpio_hal  },
+    { "Timer count, PDL handler",     latency_timer_pdl },
+    { "Timer count, HAL callback",    latency_timer_hal },
+};
+
+#define LATENCY_PATHS               (sizeof(latency_paths) / sizeof(latency_paths[0]))
+
+/* Written by the handlers */
+static volatile bool     latency_flag = false;
+static volatile uint32_t latency_isr_cycles;
+static volatile uint32_t latency_isr_ticks;
+
+static cyhal_timer_t latency_timer;
+
+static uint32_t latency_entry[LATENCY_SAMPLES];
+static uint32_t latency_main_loop[LATENCY_SAMPLES];
+static latency_hist_t latency_entry_hist[LATENCY_PATHS];
+static latency_hist_t latency_main_loop_hist[LATENCY_PATHS];
+
+
+/*******************************************************************************
+* Function Name: latency_wait
+********************************************************************************
+* Summary:
+*  Main loop of the measurements: polls the flag set by the handler.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  bool: true when the handler ran, false on timeout
+*
+*******************************************************************************/
+static bool latency_wait(void)
+{
+    uint32_t start = profiler_cycles();
+
+    while (!latency_flag)
+    {
+        if ((profiler_cycles() - start) > LATENCY_TIMEOUT_CYCLES)
+        {
+            return false;
+        }
+        __NOP();
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: latency_gpio_collect
+********************************************************************************
+* Summary:
+*  Inverts the measurement pin LATENCY_SAMPLES times and records the latency
+*  of the handler and of the main loop for each edge.
+*
+* Parameters:
+*  entry: edge to handler entry, in cycles
+*  main_loop: handler entry to main loop, in cycles
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or LATENCY_RSLT_ERR_TIMEOUT
+*
+*******************************************************************************/
+static cy_rslt_t latency_gpio_collect(uint32_t *entry, uint32_t *main_loop)
+{
+    GPIO_PRT_Type *port = CYHAL_GET_PORTADDR(LATENCY_GPIO_PIN);
+    uint32_t pin = CYHAL_GET_PIN(LATENCY_GPIO_PIN);
+
+    for (uint32_t sample = 0u; sample < LATENCY_SAMPLES; sample++)
+    {
+        uint32_t start;
+
+        latency_flag = false;
+        start = profiler_cycles();
+        Cy_GPIO_Inv(port, pin);
+        if (!latency_wait())
+        {
+            return LATENCY_RSLT_ERR_TIMEOUT;
+        }
+        main_loop[sample] = profiler_cycles() - latency_isr_cycles;
+        entry[sample] = latency_isr_cycles - start;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: latency_timer_collect
+********************************************************************************
+* Summary:
+*  Records the latency of the handler and of the main loop for
+*  LATENCY_SAMPLES terminal counts of a running timer.
+*
+* Parameters:
+*  entry: terminal count to handler entry, in cycles
+*  main_loop: handler entry to main loop, in cycles
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or LATENCY_RSLT_ERR_TIMEOUT
+*
+*******************************************************************************/
+static cy_rslt_t latency_timer_collect(uint32_t *entry, uint32_t *main_loop)
+{
+    uint32_t cycles_per_tick = SystemCoreClock / LATENCY_TIMER_HZ;
+
+    for (uint32_t sample = 0u; sample < LATENCY_SAMPLES; sample++)
+    {
+        latency_flag = false;
+        if (!latency_wait())
+        {
+            return LATENCY_RSLT_ERR_TIMEOUT;
+        }
+        main_loop[sample] = profiler_cycles() - latency_isr_cycles;
+        entry[sample] = latency_isr_ticks * cycles_per_tick;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: latency_gpio_pdl_isr
+********************************************************************************
+* Summary:
+*  Port interrupt handler installed with Cy_SysInt_Init().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void latency_gpio_pdl_isr(void)
+{
+    GPIO_PRT_Type *port = CYHAL_GET_PORTADDR(LATENCY_GPIO_PIN);
+    uint32_t pin = CYHAL_GET_PIN(LATENCY_GPIO_PIN);
+
+    latency_isr_cycles = profiler_cycles();
+    if (0u != Cy_GPIO_GetInterruptStatusMasked(port, pin))
+    {
+        Cy_GPIO_ClearInterrupt(port, pin);
+        latency_flag = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: latency_gpio_pdl
+********************************************************************************
+* Summary:
+*  GPIO edge through a PDL handler on LATENCY_CPU_IRQ.
+*
+* Parameters:
+*  entry: edge to handler entry, in cycles
+*  main_loop: handler entry to main loop, in cycles
+*
+* Return:
+*  cy_rslt_t: result
+*
+*******************************************************************************/
+static cy_rslt_t latency_gpio_pdl(uint32_t *entry, uint32_t *main_loop)
+{
+    GPIO_PRT_Type *port = CYHAL_GET_PORTADDR(LATENCY_GPIO_PIN);
+    uint32_t pin = CYHAL_GET_PIN(LATENCY_GPIO_PIN);
+    const cy_stc_sysint_t intr_cfg =
+    {
+        .intrSrc      = ((uint32_t)LATENCY_CPU_IRQ << 16) |
+                        ((uint32_t)ioss_interrupts_gpio_0_IRQn + CYHAL_GET_PORT(LATENCY_GPIO_PIN)),
+        .intrPriority = LATENCY_INTR_PRIORITY,
+    };
+    cy_rslt_t result;
+
+    result = resource_manager_gpio_acquire(LATENCY_GPIO_PIN, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG,
+                                           CYBSP_LED_STATE_OFF, LATENCY_OWNER);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    Cy_GPIO_SetInterruptEdge(port, pin, CY_GPIO_INTR_BOTH);
+    Cy_GPIO_ClearInterrupt(port, pin);
+    Cy_GPIO_SetInterruptMask(port, pin, 1u);
+    (void)Cy_SysInt_Init(&intr_cfg, latency_gpio_pdl_isr);
+    NVIC_EnableIRQ(LATENCY_CPU_IRQ);
+
+    result = latency_gpio_collect(entry, main_loop);
+
+    NVIC_DisableIRQ(LATENCY_CPU_IRQ);
+    Cy_GPIO_SetInterruptMask(port, pin, 0u);
+    Cy_GPIO_SetInterruptEdge(port, pin, CY_GPIO_INTR_DISABLE);
+    resource_manager_gpio_release(LATENCY_GPIO_PIN, LATENCY_OWNER);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: latency_gpio_hal_callback
+********************************************************************************
+* Summary:
+*  GPIO callback called by the HAL port interrupt handler.
+*
+* Parameters:
+*  handler_arg: unused
+*  event: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void latency_gpio_hal_callback(void *handler_arg, cyhal_gpio_event_t event)
+{
+    (void)handler_arg;
+    (void)event;
+
+    latency_isr_cycles = profiler_cycles();
+    latency_flag = true;
+}
+
+/*******************************************************************************
+* Function Name: latency_gpio_hal
+********************************************************************************
+* Summary:
+*  GPIO edge through the HAL callback dispatch, set up like the GPIO demo.
+*
+* Parameters:
+*  entry: edge to handler entry, in cycles
+*  main_loop: handler entry to main loop, in cycles
+*
+* Return:
+*  cy_rslt_t: result
+*
+*******************************************************************************/
+static cy_rslt_t latency_gpio_hal(uint32_t *entry, uint32_t *main_loop)
+{
+    static cyhal_gpio_callback_data_t callback_data = { .callback = latency_gpio_hal_callback };
+    cy_rslt_t result;
+
+    result = resource_manager_gpio_acquire(LATENCY_GPIO_PIN, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG,
+                                           CYBSP_LED_STATE_OFF, LATENCY_OWNER);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    cyhal_gpio_register_callback(LATENCY_GPIO_PIN, &callback_data);
+    cyhal_gpio_enable_event(LATENCY_GPIO_PIN, CYHAL_GPIO_IRQ_BOTH, LATENCY_INTR_PRIORITY, true);
+
+    result = latency_gpio_collect(entry, main_loop);
+
+    cyhal_gpio_enable_event(LATENCY_GPIO_PIN, CYHAL_GPIO_IRQ_BOTH, LATENCY_INTR_PRIORITY, false);
+    cyhal_gpio_register_callback(LATENCY_GPIO_PIN, NULL);
+    resource_manager_gpio_release(LATENCY_GPIO_PIN, LATENCY_OWNER);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: latency_timer_pdl_isr
+********************************************************************************
+* Summary:
+*  Counter interrupt handler installed with Cy_SysInt_Init().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void latency_timer_pdl_isr(void)
+{
+    latency_isr_cycles = profiler_cycles();
+    latency_isr_ticks = Cy_TCPWM_Counter_GetCounter(LATENCY_TCPWM, LATENCY_TCPWM_CNT);
+    if (0u != (Cy_TCPWM_GetInterruptStatusMasked(LATENCY_TCPWM, LATENCY_TCPWM_CNT) & CY_TCPWM_INT_ON_TC))
+    {
+        Cy_TCPWM_ClearInterrupt(LATENCY_TCPWM, LATENCY_TCPWM_CNT, CY_TCPWM_INT_ON_TC);
+        latency_flag = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: latency_timer_pdl
+********************************************************************************
+* Summary:
+*  Timer terminal count through a PDL handler on LATENCY_CPU_IRQ. The counter
+*  is reserved from the HAL and clocked like the log timebase.
+*
+* Parameters:
+*  entry: terminal count to handler entry, in cycles
+*  main_loop: handler entry to main loop, in cycles
+*
+* Return:
+*  cy_rslt_t: result
+*
+*******************************************************************************/
+static cy_rslt_t latency_timer_pdl(uint32_t *entry, uint32_t *main_loop)
+{
+    const cyhal_resource_inst_t counter_rsc =
+    {
+        CYHAL_RSC_TCPWM, LATENCY_TCPWM_GROUP, LATENCY_TCPWM_CNT
+    };
+    const cy_stc_tcpwm_counter_config_t counter_cfg =
+    {
+        .period           = LATENCY_TIMER_PERIOD - 1u,
+        .clockPrescaler   = CY_TCPWM_COUNTER_PRESCALER_DIVBY_1,
+        .runMode          = CY_TCPWM_COUNTER_CONTINUOUS,
+        .countDirection   = CY_TCPWM_COUNTER_COUNT_UP,
+        .compareOrCapture = CY_TCPWM_COUNTER_MODE_COMPARE,
+        .interruptSources = CY_TCPWM_INT_ON_TC,
+        .captureInputMode = CY_TCPWM_INPUT_LEVEL,
+        .captureInput     = CY_TCPWM_INPUT_0,
+        .reloadInputMode  = CY_TCPWM_INPUT_LEVEL,
+        .reloadInput      = CY_TCPWM_INPUT_0,
+        .startInputMode   = CY_TCPWM_INPUT_LEVEL,
+        .startInput       = CY_TCPWM_INPUT_0,
+        .stopInputMode    = CY_TCPWM_INPUT_LEVEL,
+        .stopInput        = CY_TCPWM_INPUT_0,
+        .countInputMode   = CY_TCPWM_INPUT_LEVEL,
+        .countInput       = CY_TCPWM_INPUT_1,
+    };
+    const cy_stc_sysint_t intr_cfg =
+    {
+        .intrSrc      = ((uint32_t)LATENCY_CPU_IRQ << 16) | LATENCY_TCPWM_IRQ,
+        .intrPriority = LATENCY_INTR_PRIORITY,
+    };
+    cyhal_clock_t clock;
+    cy_rslt_t result;
+
+    result = cyhal_hwmgr_reserve(&counter_rsc);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    result = cyhal_clock_allocate(&clock, CYHAL_CLOCK_BLOCK_PERIPHERAL1_16BIT);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_clock_set_frequency(&clock, LATENCY_TIMER_HZ, NULL);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = cyhal_clock_set_enabled(&clock, true, true);
+        }
+        if (CY_RSLT_SUCCESS == result)
+        {
+            (void)Cy_SysClk_PeriPclkAssignDivider(LATENCY_TCPWM_PCLK, CY_SYSCLK_DIV_16_BIT, clock.channel);
+            (void)Cy_TCPWM_Counter_Init(LATENCY_TCPWM, LATENCY_TCPWM_CNT, &counter_cfg);
+            (void)Cy_SysInt_Init(&intr_cfg, latency_timer_pdl_isr);
+            NVIC_EnableIRQ(LATENCY_CPU_IRQ);
+            Cy_TCPWM_Counter_Enable(LATENCY_TCPWM, LATENCY_TCPWM_CNT);
+            Cy_TCPWM_TriggerStart_Single(LATENCY_TCPWM, LATENCY_TCPWM_CNT);
+
+            result = latency_timer_collect(entry, main_loop);
+
+            Cy_TCPWM_Counter_Disable(LATENCY_TCPWM, LATENCY_TCPWM_CNT);
+            NVIC_DisableIRQ(LATENCY_CPU_IRQ);
+        }
+        cyhal_clock_free(&clock);
+    }
+    cyhal_hwmgr_free(&counter_rsc);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: latency_timer_hal_callback
+********************************************************************************
+* Summary:
+*  Timer callback called by the HAL counter interrupt handler.
+*
+* Parameters:
+*  callback_arg: unused
+*  event: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void latency_timer_hal_callback(void *callback_arg, cyhal_timer_event_t event)
+{
+    (void)callback_arg;
+    (void)event;
+
+    latency_isr_cycles = profiler_cycles();
+    latency_isr_ticks = cyhal_timer_read(&latency_timer);
+    latency_flag = true;
+}
+
+/*******************************************************************************
+* Function Name: latency_timer_hal
+********************************************************************************
+* Summary:
+*  Timer terminal count through the HAL callback dispatch, set up like the
+*  timer of the hello world demo.
+*
+* Parameters:
+*  entry: terminal count to handler entry, in cycles
+*  main_loop: handler entry to main loop, in cycles
+*
+* Return:
+*  cy_rslt_t: result
+*
+*******************************************************************************/
+static cy_rslt_t latency_timer_hal(uint32_t *entry, uint32_t *main_loop)
+{
+    const cyhal_timer_cfg_t timer_cfg =
+    {
+        .compare_value = 0,
+        .period        = LATENCY_TIMER_PERIOD - 1u,
+        .direction     = CYHAL_TIMER_DIR_UP,
+        .is_compare    = false,
+        .is_continuous = true,
+        .value         = 0
+    };
+    cy_rslt_t result;
+
+    result = cyhal_timer_init(&latency_timer, NC, NULL);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    result = cyhal_timer_configure(&latency_timer, &timer_cfg);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_timer_set_frequency(&latency_timer, LATENCY_TIMER_HZ);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        cyhal_timer_register_callback(&latency_timer, latency_timer_hal_callback, NULL);
+        cyhal_timer_enable_event(&latency_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT,
+                                 LATENCY_INTR_PRIORITY, true);
+        result = cyhal_timer_start(&latency_timer);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = latency_timer_collect(entry, main_loop);
+        (void)cyhal_timer_stop(&latency_timer);
+    }
+    cyhal_timer_free(&latency_timer);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: latency_run
+********************************************************************************
+* Summary:
+*  Runs the four measurements, prints the histogram of each and a summary of
+*  the medians and 99th percentiles. The difference between the HAL and the
+*  PDL rows of a source is the cost of the HAL dispatch.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void latency_run(void)
+{
+    bool done[LATENCY_PATHS] = { false };
+
+    printf("Interrupt latency, %lu samples per path, %lu MHz core clock\r\n",
+           (unsigned long)LATENCY_SAMPLES, (unsigned long)(SystemCoreClock / 1000000u));
+
+    for (uint32_t path = 0u; path < LATENCY_PATHS; path++)
+    {
+        char title[64];
+        cy_rslt_t result = latency_paths[path].run(latency_entry, latency_main_loop);
+
+        if (CY_RSLT_SUCCESS != result)
+        {
+            printf("%s: failed, 0x%08lx\r\n", latency_paths[path].name, (unsigned long)result);
+            continue;
+        }
+        done[path] = true;
+
+        latency_hist_build(&latency_entry_hist[path], latency_entry, LATENCY_SAMPLES);
+        latency_hist_build(&latency_main_loop_hist[path], latency_main_loop, LATENCY_SAMPLES);
+        (void)snprintf(title, sizeof(title), "%s, trigger to handler", latency_paths[path].name);
+        latency_hist_print(&latency_entry_hist[path], title, "cycles");
+        (void)snprintf(title, sizeof(title), "%s, handler to main loop", latency_paths[path].name);
+        latency_hist_print(&latency_main_loop_hist[path], title, "cycles");
+        printf("\r\n");
+    }
+
+    printf("%-28s %21s %21s\r\n", "Path (cycles)", "to handler p50/p99", "to main loop p50/p99");
+    for (uint32_t path = 0u; path < LATENCY_PATHS; path++)
+    {
+        if (done[path])
+        {
+            printf("%-28s %10lu/%-10lu %10lu/%-10lu\r\n", latency_paths[path].name,
+                   (unsigned long)latency_entry_hist[path].p50, (unsigned long)latency_entry_hist[path].p99,
+                   (unsigned long)latency_main_loop_hist[path].p50,
+                   (unsigned long)latency_main_loop_hist[path].p99);
+        }
+    }
+    for (uint32_t path = 0u; (path + 1u) < LATENCY_PATHS; path += 2u)
+    {
+        if (done[path] && done[path + 1u])
+        {
+            printf("HAL dispatch overhead, %-5.5s %ld cycles (p50)\r\n", latency_paths[path].name,
+                   (long)latency_entry_hist[path + 1u].p50 - (long)latency_entry_hist[path].p50);
+        }
+    }
+}
+
+/* [] END OF FILE */
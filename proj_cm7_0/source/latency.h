@@ -0,0 +1,75 @@
+/******************************************************************************
+* File Name:   latency.h
+*
+* Description: Interrupt latency harness of CM7_0. Measures the cycles from
+*              an interrupt trigger to the entry of its handler, and from the
+*              handler to the main loop seeing its flag, for a GPIO edge and a
+*              timer terminal count. Each source is taken once through the
+*              HAL callback dispatch and once through a PDL handler installed
+*              with Cy_SysInt_Init(), and the results are printed as
+*              histograms with a summary of the HAL overhead.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _LATENCY_H_
+#define _LATENCY_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Samples of each measurement */
+#define LATENCY_SAMPLES             (256u)
+
+/* Output pin toggled by the GPIO measurements. Its input buffer stays on in
+ * the strong drive mode, so the pin sees its own edges without a wire. */
+#define LATENCY_GPIO_PIN            (CYBSP_USER_LED2)
+
+/* Timer measurements: 50 MHz counter, terminal count every 1 ms */
+#define LATENCY_TIMER_HZ            (50000000u)
+#define LATENCY_TIMER_PERIOD        (50000u)
+
+/* The handler did not run in time */
+#define LATENCY_RSLT_ERR_TIMEOUT    (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x12u))
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void latency_run(void);
+
+#endif
@@ -0,0 +1,173 @@
+/******************************************************************************
+* File Name:   latency_hist.c
+*
+* Description: Statistics and histogram of latency samples.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include "latency_hist.h"
+
+
+/*******************************************************************************
+* Function Name: latency_hist_sort
+********************************************************************************
+* Summary:
+*  Sorts the samples in ascending order. Insertion sort, the sample sets are
+*  a few hundred entries.
+*
+* Parameters:
+*  samples: samples
+*  count: number of samples
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void latency_hist_sort(uint32_t *samples, uint32_t count)
+{
+    for (uint32_t i = 1u; i < count; i++)
+    {
+        uint32_t value = samples[i];
+        uint32_t j = i;
+
+        while ((j > 0u) && (samples[j - 1u] > value))
+        {
+            samples[j] = samples[j - 1u];
+            j--;
+        }
+        samples[j] = value;
+    }
+}
+
+/*******************************************************************************
+* Function Name: latency_hist_build
+********************************************************************************
+* Summary:
+*  Computes the statistics of a set of samples and spreads them over
+*  LATENCY_HIST_BINS bins of equal width between the minimum and the maximum.
+*  The samples are sorted in place.
+*
+* Parameters:
+*  hist: histogram to fill
+*  samples: samples
+*  count: number of samples
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void latency_hist_build(latency_hist_t *hist, uint32_t *samples, uint32_t count)
+{
+    uint64_t total = 0u;
+
+    *hist = (latency_hist_t){ .count = count, .bin_width = 1u };
+    if (0u == count)
+    {
+        return;
+    }
+
+    latency_hist_sort(samples, count);
+    for (uint32_t i = 0u; i < count; i++)
+    {
+        total += samples[i];
+    }
+
+    hist->min = samples[0];
+    hist->max = samples[count - 1u];
+    hist->avg = (uint32_t)(total / count);
+    hist->p50 = samples[(count - 1u) / 2u];
+    hist->p99 = samples[((count - 1u) * 99u) / 100u];
+    hist->bin_width = ((hist->max - hist->min) / LATENCY_HIST_BINS) + 1u;
+
+    for (uint32_t i = 0u; i < count; i++)
+    {
+        hist->bins[(samples[i] - hist->min) / hist->bin_width]++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: latency_hist_print
+********************************************************************************
+* Summary:
+*  Prints the statistics and the histogram as bars, up to the last non-empty
+*  bin.
+*
+* Parameters:
+*  hist: histogram
+*  title: name of the measurement
+*  unit: unit of the samples
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void latency_hist_print(const latency_hist_t *hist, const char *title, const char *unit)
+{
+    uint32_t peak = 1u;
+    uint32_t last = 0u;
+
+    printf("%s (%s)\r\n", title, unit);
+    printf("  n=%lu min=%lu avg=%lu p50=%lu p99=%lu max=%lu\r\n",
+           (unsigned long)hist->count, (unsigned long)hist->min, (unsigned long)hist->avg,
+           (unsigned long)hist->p50, (unsigned long)hist->p99, (unsigned long)hist->max);
+
+    for (uint32_t bin = 0u; bin < LATENCY_HIST_BINS; bin++)
+    {
+        if (hist->bins[bin] > peak)
+        {
+            peak = hist->bins[bin];
+        }
+        if (0u != hist->bins[bin])
+        {
+            last = bin;
+        }
+    }
+
+    for (uint32_t bin = 0u; (0u != hist->count) && (bin <= last); bin++)
+    {
+        uint32_t low = hist->min + (bin * hist->bin_width);
+        uint32_t bar = (hist->bins[bin] * LATENCY_HIST_BAR_WIDTH + peak - 1u) / peak;
+
+        printf("  %8lu-%-8lu |", (unsigned long)low, (unsigned long)(low + hist->bin_width - 1u));
+        for (uint32_t i = 0u; i < LATENCY_HIST_BAR_WIDTH; i++)
+        {
+            putchar((i < bar) ? '#' : ' ');
+        }
+        printf(" %lu\r\n", (unsigned long)hist->bins[bin]);
+    }
+}
+
+/* [] END OF FILE */
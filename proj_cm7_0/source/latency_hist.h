@@ -0,0 +1,77 @@
+/******************************************************************************
+* File Name:   latency_hist.h
+*
+* Description: Statistics and histogram of latency samples. Only depends on
+*              the C library, so that samples captured on the target can be
+*              analysed by the same code on the host.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _LATENCY_HIST_H_
+#define _LATENCY_HIST_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bins between the minimum and the maximum sample */
+#define LATENCY_HIST_BINS           (16u)
+
+/* Width of the longest bar of latency_hist_print() */
+#define LATENCY_HIST_BAR_WIDTH      (40u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t avg;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t bin_width;                     /* Samples per bin, from min */
+    uint32_t bins[LATENCY_HIST_BINS];
+} latency_hist_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void latency_hist_build(latency_hist_t *hist, uint32_t *samples, uint32_t count);
+extern void latency_hist_print(const latency_hist_t *hist, const char *title, const char *unit);
+
+#endif
@@ -0,0 +1,60 @@
+/******************************************************************************
+* File Name:   mem_config.h
+*
+* Description: Sizes of the statically allocated buffers of CM7_0. With the
+*              static memory model (mem_guard.h) nothing is allocated at run
+*              time: every buffer and block pool (block_pool.h) is sized here
+*              or next to its owner, and the build reports the memory budget
+*              (shared/memory_report.sh).
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _MEM_CONFIG_H_
+#define _MEM_CONFIG_H_
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Write and read buffers of the QSPI memory demo */
+#define MEM_CONFIG_QSPI_PACKET_SIZE (64u)
+
+/* CAN FD frames received and not printed yet, block pool and queue of the
+ * CAN FD demo; a power of 2 */
+#define MEM_CONFIG_CANFD_RX_BLOCKS  (8u)
+
+/* Free stack under which the "mem" command of the parameter console warns */
+#define MEM_CONFIG_STACK_HEADROOM   (512u)
+
+#endif
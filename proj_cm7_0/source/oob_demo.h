@@ -43,12 +43,13 @@
 #include "cy_pdl.h"
 #include "cyhal.h"
 #include "cybsp.h"
+#include "event_flags.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
 /* demo project number */
-#define     DEMONUM              7
+#define     DEMONUM              9
 /* default command */
 #define     CMD_DEFAULT          0xFF
 #define     DEM_HELLO_WORD       0x31
@@ -58,6 +59,23 @@
 #define     DEM_IO_POWER         0x35
 #define     DEM_IO_QSPI          0x36
 #define     DEM_IO_CANFD         0x37
+#define     DEM_IPC_OFFLOAD      0x38
+#define     DEM_PARAM_CONSOLE    0x39
+
+/* Events of demo_events, posted by the interrupt handlers */
+#define EVT_DEMO_SWITCH                   (1UL << 0)    /* Another demo was selected */
+#define EVT_CONSOLE_KEY                   (1UL << 1)    /* recCmd holds a new key */
+#define EVT_BUTTON1                       (1UL << 2)    /* USER BTN1 pressed */
+#define EVT_BUTTON1_FILTERED              (1UL << 3)    /* USER BTN1 press passed the hysteresis filter */
+#define EVT_BUTTON2                       (1UL << 4)    /* USER BTN2 pressed */
+#define EVT_BUTTON2_FILTERED              (1UL << 5)    /* USER BTN2 press passed the hysteresis filter */
+#define EVT_GPIO1                         (1UL << 6)    /* GPIO interrupt demo, button 1 edge */
+#define EVT_GPIO2                         (1UL << 7)    /* GPIO interrupt demo, button 2 edge */
+#define EVT_CANFD_RX                      (1UL << 8)    /* CAN FD message received */
+#define EVT_TIMER                         (1UL << 9)    /* Hello world LED timer elapsed */
+#define EVT_ADC_WINDOW                    (1UL << 10)   /* SAR ADC window crossing queued */
+#define EVT_ADC_SCOPE                     (1UL << 11)   /* SAR ADC scope capture complete */
+#define EVT_LOG                           (1UL << 12)   /* Log records of the cores waiting to be printed */
 
 /* LED states */
 #define LED_ON                            (0)
@@ -76,6 +94,13 @@
 #define KIT_XMC71_V2
 #endif
 
+/* CAN FD channel wired to the transceiver of the kit */
+#if defined(KIT_XMC71_V1) || defined(KIT_XMC71_V2)
+#define CAN_HW_CHANNEL          0
+#else
+#define CAN_HW_CHANNEL          1
+#endif
+
 
 /*******************************************************************************
 * External Functions
@@ -87,6 +112,8 @@ extern int main_sar_adc(void);
 extern int main_powermode(void);
 extern int main_qspi_memory(void);
 extern int main_canfd(void);
+extern int main_ipc_offload(void);
+extern int main_param_console(void);
 extern void handle_error(void);
 
 /* Array of demo projects */
@@ -94,8 +121,8 @@ extern int (*demoProject[DEMONUM])(void);
 /*******************************************************************************
 * External Variables
 *******************************************************************************/
-/* demo switch flag */
-extern bool evtSwitch;
+/* Events of the demos, EVT_DEMO_SWITCH asks the running demo to return */
+extern event_flags_t demo_events;
 /* demo project index */
 extern uint8_t demoIndex;
 /* Hibernate reset status */
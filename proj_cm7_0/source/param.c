@@ -0,0 +1,580 @@
+/******************************************************************************
+* File Name:   param.c
+*
+* Description: Demo parameter registry. Each parameter has a type, a range and
+*              a default in one constant table. param_load() copies the work
+*              flash snapshot into RAM and checks its CRC, which takes a few
+*              microseconds; a missing or damaged snapshot, or one with a
+*              value out of range, leaves the defaults in place. Parameters
+*              added after the snapshot was saved keep their defaults.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "param.h"
+#include "crc32.h"
+#include "profiler.h"
+#include "print_message.h"
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static cy_rslt_t param_check_range(param_id_t id, uint32_t value);
+static cy_rslt_t param_find_block(cyhal_flash_t *flash, cyhal_flash_block_info_t *block);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const param_desc_t param_table[PARAM_NUM] =
+{
+    [PARAM_LED_BLINK_PERIOD]   = { "led_period",    PARAM_TYPE_U16,       99u,      65535u,     9999u, "ticks" },
+    [PARAM_PWM_FREQUENCY_0]    = { "pwm_hz_0",      PARAM_TYPE_U32,        1u,    1000000u,        1u, "Hz" },
+    [PARAM_PWM_FREQUENCY_1]    = { "pwm_hz_1",      PARAM_TYPE_U32,        1u,    1000000u,       10u, "Hz" },
+    [PARAM_PWM_FREQUENCY_2]    = { "pwm_hz_2",      PARAM_TYPE_U32,        1u,    1000000u,      100u, "Hz" },
+    [PARAM_PWM_FREQUENCY_3]    = { "pwm_hz_3",      PARAM_TYPE_U32,        1u,    1000000u,     1000u, "Hz" },
+    [PARAM_PWM_FREQUENCY_4]    = { "pwm_hz_4",      PARAM_TYPE_U32,        1u,    1000000u,    10000u, "Hz" },
+    [PARAM_PWM_FREQUENCY_5]    = { "pwm_hz_5",      PARAM_TYPE_U32,        1u,    1000000u,   100000u, "Hz" },
+    [PARAM_PWM_FREQUENCY_6]    = { "pwm_hz_6",      PARAM_TYPE_U32,        1u,    1000000u,  1000000u, "Hz" },
+    [PARAM_QSPI_BUS_FREQUENCY] = { "qspi_hz",       PARAM_TYPE_U32,  1000000u,   50000000u, 50000000u, "Hz" },
+    [PARAM_ADC_DELAY_MS]       = { "adc_delay_ms",  PARAM_TYPE_U16,        1u,      10000u,      200u, "ms" },
+    [PARAM_CAN_ID]             = { "can_id",        PARAM_TYPE_U16,        0u,      0x7FFu,        1u, "" },
+    [PARAM_CAN_DLC]            = { "can_dlc",       PARAM_TYPE_U8,         0u,          8u,        8u, "bytes" },
+    [PARAM_QUICK_PRESS_COUNT]  = { "press_quick",   PARAM_TYPE_U16,        1u,      60000u,        2u, "10 ms" },
+    [PARAM_SHORT_PRESS_COUNT]  = { "press_short",   PARAM_TYPE_U16,        1u,      60000u,       20u, "10 ms" },
+    [PARAM_LONG_PRESS_COUNT]   = { "press_long",    PARAM_TYPE_U16,        1u,      60000u,      200u, "10 ms" },
+    [PARAM_BAUD_RATE]          = { "baud",          PARAM_TYPE_U32,     9600u,    3000000u, BAUD_RATE, "bit/s" },
+    [PARAM_ADC_WINDOW_LOW_MV]  = { "adc_low_mv",    PARAM_TYPE_U16,        0u,       3300u,     1000u, "mV" },
+    [PARAM_ADC_WINDOW_HIGH_MV] = { "adc_high_mv",   PARAM_TYPE_U16,        0u,       3300u,     2300u, "mV" },
+    [PARAM_ADC_SYNC_PHASE]     = { "adc_phase",     PARAM_TYPE_U16,        0u,        999u,      250u, "0.1 %" },
+    [PARAM_SCOPE_TRIGGER]      = { "scope_trigger", PARAM_TYPE_U8,         0u,          5u,        1u, "" },
+    [PARAM_SCOPE_LEVEL_MV]     = { "scope_level",   PARAM_TYPE_U16,        0u,       3300u,     1650u, "mV" },
+    [PARAM_SCOPE_PRE]          = { "scope_pre",     PARAM_TYPE_U16,        0u,       1023u,      256u, "samples" },
+    [PARAM_EDGE_INPUT]         = { "edge_input",    PARAM_TYPE_U8,         1u,          2u,        1u, "button" },
+    [PARAM_CONSOLE_UI]         = { "console_ui",    PARAM_TYPE_U8,         0u,          1u,        0u, "" },
+};
+
+/* Values in use, the defaults until param_load() */
+static uint32_t param_values[PARAM_NUM];
+static bool param_values_set = false;
+
+/* Duration of the last param_load() */
+static uint32_t param_load_cycles = 0u;
+
+
+/*******************************************************************************
+* Function Name: param_load
+********************************************************************************
+* Summary:
+*  Reads the snapshot from the work flash. Called at boot, before the
+*  parameters are used.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the snapshot was applied, else the flash
+*  error or PARAM_RSLT_ERR_SNAPSHOT and the defaults are in use
+*
+*******************************************************************************/
+cy_rslt_t param_load(void)
+{
+    uint8_t snapshot[PARAM_SNAPSHOT_MAX_SIZE];
+    uint32_t values[PARAM_NUM];
+    uint32_t start = profiler_cycles();
+    cyhal_flash_t flash;
+    cy_rslt_t result;
+
+    param_get_defaults(values);
+    result = cyhal_flash_init(&flash);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_flash_read(&flash, PARAM_FLASH_ADDR, snapshot, sizeof(snapshot));
+        cyhal_flash_free(&flash);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = param_deserialize(snapshot, sizeof(snapshot), values);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        param_get_defaults(values);
+    }
+    memcpy(param_values, values, sizeof(param_values));
+    param_values_set = true;
+    param_load_cycles = profiler_cycles() - start;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: param_save
+********************************************************************************
+* Summary:
+*  Erases the snapshot sector and programs the values in use, one flash page
+*  at a time.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or the flash error
+*
+*******************************************************************************/
+cy_rslt_t param_save(void)
+{
+    uint8_t snapshot[PARAM_SNAPSHOT_MAX_SIZE];
+    uint32_t page[PARAM_SNAPSHOT_MAX_SIZE / sizeof(uint32_t)];
+    cyhal_flash_block_info_t block;
+    cyhal_flash_t flash;
+    uint32_t length;
+    cy_rslt_t result;
+
+    length = param_serialize(param_values, snapshot, sizeof(snapshot));
+    result = cyhal_flash_init(&flash);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    result = param_find_block(&flash, &block);
+    if ((CY_RSLT_SUCCESS == result) && ((block.page_size > sizeof(page)) || (length > block.sector_size)))
+    {
+        result = PARAM_RSLT_ERR_SNAPSHOT;
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_flash_erase(&flash, PARAM_FLASH_ADDR);
+    }
+    for (uint32_t offset = 0u; (CY_RSLT_SUCCESS == result) && (offset < length); offset += block.page_size)
+    {
+        uint32_t chunk = ((length - offset) < block.page_size) ? (length - offset) : block.page_size;
+
+        memset(page, block.erase_value, block.page_size);
+        memcpy(page, &snapshot[offset], chunk);
+        result = cyhal_flash_program(&flash, PARAM_FLASH_ADDR + offset, page);
+    }
+    cyhal_flash_free(&flash);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: param_reset
+********************************************************************************
+* Summary:
+*  Restores the defaults in RAM. The flash snapshot is kept until
+*  param_save().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void param_reset(void)
+{
+    param_get_defaults(param_values);
+    param_values_set = true;
+}
+
+/*******************************************************************************
+* Function Name: param_get
+********************************************************************************
+* Summary:
+*  Returns the value in use, the default before param_load().
+*
+* Parameters:
+*  id: parameter
+*
+* Return:
+*  uint32_t: value
+*
+*******************************************************************************/
+uint32_t param_get(param_id_t id)
+{
+    CY_ASSERT(id < PARAM_NUM);
+
+    return param_values_set ? param_values[id] : param_table[id].def;
+}
+
+/*******************************************************************************
+* Function Name: param_set
+********************************************************************************
+* Summary:
+*  Changes a value in RAM after checking its range and, for the press
+*  counts, that quick < short < long still holds, and for the ADC window,
+*  that low < high.
+*
+* Parameters:
+*  id: parameter
+*  value: new value
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or PARAM_RSLT_ERR_RANGE
+*
+*******************************************************************************/
+cy_rslt_t param_set(param_id_t id, uint32_t value)
+{
+    uint32_t values[PARAM_NUM];
+    cy_rslt_t result;
+
+    CY_ASSERT(id < PARAM_NUM);
+
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        values[index] = param_get((param_id_t)index);
+    }
+    values[id] = value;
+
+    result = param_validate(values);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memcpy(param_values, values, sizeof(param_values));
+        param_values_set = true;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: param_get_desc
+********************************************************************************
+* Summary:
+*  Returns the registry entry of a parameter: its console name, type, range,
+*  default and unit.
+*
+* Parameters:
+*  id: parameter
+*
+* Return:
+*  const param_desc_t *: entry, NULL for an unknown parameter
+*
+*******************************************************************************/
+const param_desc_t *param_get_desc(param_id_t id)
+{
+    return (id < PARAM_NUM) ? &param_table[id] : NULL;
+}
+
+/*******************************************************************************
+* Function Name: param_find
+********************************************************************************
+* Summary:
+*  Looks a parameter up by its console name.
+*
+* Parameters:
+*  name: console name
+*  id: receives the parameter
+*
+* Return:
+*  bool: true if found
+*
+*******************************************************************************/
+bool param_find(const char *name, param_id_t *id)
+{
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        if (0 == strcmp(name, param_table[index].name))
+        {
+            *id = (param_id_t)index;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: param_validate
+********************************************************************************
+* Summary:
+*  Checks a full set of values.
+*
+* Parameters:
+*  values: PARAM_NUM values in registry order
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or PARAM_RSLT_ERR_RANGE
+*
+*******************************************************************************/
+cy_rslt_t param_validate(const uint32_t *values)
+{
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        if (CY_RSLT_SUCCESS != param_check_range((param_id_t)index, values[index]))
+        {
+            return PARAM_RSLT_ERR_RANGE;
+        }
+    }
+
+    /* The press classification needs increasing limits */
+    if ((values[PARAM_QUICK_PRESS_COUNT] >= values[PARAM_SHORT_PRESS_COUNT]) ||
+        (values[PARAM_SHORT_PRESS_COUNT] >= values[PARAM_LONG_PRESS_COUNT]))
+    {
+        return PARAM_RSLT_ERR_RANGE;
+    }
+
+    /* The alarm window of the ADC demo must not be empty */
+    if (values[PARAM_ADC_WINDOW_LOW_MV] >= values[PARAM_ADC_WINDOW_HIGH_MV])
+    {
+        return PARAM_RSLT_ERR_RANGE;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: param_get_defaults
+********************************************************************************
+* Summary:
+*  Copies the defaults of all parameters.
+*
+* Parameters:
+*  values: receives PARAM_NUM values in registry order
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void param_get_defaults(uint32_t *values)
+{
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        values[index] = param_table[index].def;
+    }
+}
+
+/*******************************************************************************
+* Function Name: param_serialize
+********************************************************************************
+* Summary:
+*  Builds a snapshot of a set of values.
+*
+* Parameters:
+*  values: PARAM_NUM values in registry order
+*  buffer: receives the snapshot
+*  size: size of buffer
+*
+* Return:
+*  uint32_t: snapshot length, 0 if buffer is too small
+*
+*******************************************************************************/
+uint32_t param_serialize(const uint32_t *values, uint8_t *buffer, uint32_t size)
+{
+    uint32_t length = PARAM_SNAPSHOT_HEADER_SIZE;
+    uint32_t crc;
+
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        length += (uint32_t)param_table[index].type;
+    }
+    if ((length + PARAM_SNAPSHOT_CRC_SIZE) > size)
+    {
+        return 0u;
+    }
+
+    buffer[0] = (uint8_t)PARAM_SNAPSHOT_MAGIC;
+    buffer[1] = (uint8_t)(PARAM_SNAPSHOT_MAGIC >> 8);
+    buffer[2] = (uint8_t)(PARAM_SNAPSHOT_MAGIC >> 16);
+    buffer[3] = (uint8_t)(PARAM_SNAPSHOT_MAGIC >> 24);
+    buffer[4] = PARAM_SNAPSHOT_VERSION;
+    buffer[5] = (uint8_t)PARAM_NUM;
+    buffer[6] = (uint8_t)(length - PARAM_SNAPSHOT_HEADER_SIZE);
+    buffer[7] = (uint8_t)((length - PARAM_SNAPSHOT_HEADER_SIZE) >> 8);
+
+    length = PARAM_SNAPSHOT_HEADER_SIZE;
+    for (uint32_t index = 0u; index < (uint32_t)PARAM_NUM; index++)
+    {
+        for (uint32_t byte = 0u; byte < (uint32_t)param_table[index].type; byte++)
+        {
+            buffer[length++] = (uint8_t)(values[index] >> (8u * byte));
+        }
+    }
+
+    crc = crc32_compute(buffer, length);
+    for (uint32_t byte = 0u; byte < PARAM_SNAPSHOT_CRC_SIZE; byte++)
+    {
+        buffer[length++] = (uint8_t)(crc >> (8u * byte));
+    }
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: param_deserialize
+********************************************************************************
+* Summary:
+*  Reads the values of a snapshot. The values missing from an older snapshot
+*  are left unchanged in values, so the caller fills in the defaults first.
+*
+* Parameters:
+*  buffer: snapshot, possibly followed by unused bytes
+*  size: bytes available in buffer
+*  values: PARAM_NUM values in registry order, updated on success only
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, PARAM_RSLT_ERR_SNAPSHOT or PARAM_RSLT_ERR_RANGE
+*
+*******************************************************************************/
+cy_rslt_t param_deserialize(const uint8_t *buffer, uint32_t size, uint32_t *values)
+{
+    uint32_t loaded[PARAM_NUM];
+    uint32_t magic;
+    uint32_t count;
+    uint32_t payload;
+    uint32_t crc = 0u;
+    uint32_t offset = PARAM_SNAPSHOT_HEADER_SIZE;
+
+    if (size < (PARAM_SNAPSHOT_HEADER_SIZE + PARAM_SNAPSHOT_CRC_SIZE))
+    {
+        return PARAM_RSLT_ERR_SNAPSHOT;
+    }
+    magic = (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+    count = buffer[5];
+    payload = (uint32_t)buffer[6] | ((uint32_t)buffer[7] << 8);
+    if ((PARAM_SNAPSHOT_MAGIC != magic) || (PARAM_SNAPSHOT_VERSION != buffer[4]) ||
+        ((PARAM_SNAPSHOT_HEADER_SIZE + payload + PARAM_SNAPSHOT_CRC_SIZE) > size))
+    {
+        return PARAM_RSLT_ERR_SNAPSHOT;
+    }
+
+    for (uint32_t byte = 0u; byte < PARAM_SNAPSHOT_CRC_SIZE; byte++)
+    {
+        crc |= (uint32_t)buffer[PARAM_SNAPSHOT_HEADER_SIZE + payload + byte] << (8u * byte);
+    }
+    if (crc != crc32_compute(buffer, PARAM_SNAPSHOT_HEADER_SIZE + payload))
+    {
+        return PARAM_RSLT_ERR_SNAPSHOT;
+    }
+
+    /* Parameters of a newer snapshot beyond PARAM_NUM are ignored */
+    memcpy(loaded, values, sizeof(loaded));
+    for (uint32_t index = 0u; (index < count) && (index < (uint32_t)PARAM_NUM); index++)
+    {
+        uint32_t width = (uint32_t)param_table[index].type;
+
+        if ((offset + width) > (PARAM_SNAPSHOT_HEADER_SIZE + payload))
+        {
+            return PARAM_RSLT_ERR_SNAPSHOT;
+        }
+        loaded[index] = 0u;
+        for (uint32_t byte = 0u; byte < width; byte++)
+        {
+            loaded[index] |= (uint32_t)buffer[offset++] << (8u * byte);
+        }
+    }
+
+    if (CY_RSLT_SUCCESS != param_validate(loaded))
+    {
+        return PARAM_RSLT_ERR_RANGE;
+    }
+    memcpy(values, loaded, sizeof(loaded));
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: param_get_load_cycles
+********************************************************************************
+* Summary:
+*  Returns the CPU cycles the last param_load() took, flash read and snapshot
+*  check included.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: cycles, 0 before the load
+*
+*******************************************************************************/
+uint32_t param_get_load_cycles(void)
+{
+    return param_load_cycles;
+}
+
+/*******************************************************************************
+* Function Name: param_check_range
+********************************************************************************
+* Summary:
+*  Checks one value against the range of its parameter.
+*
+* Parameters:
+*  id: parameter
+*  value: value to check
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or PARAM_RSLT_ERR_RANGE
+*
+*******************************************************************************/
+static cy_rslt_t param_check_range(param_id_t id, uint32_t value)
+{
+    const param_desc_t *desc = &param_table[id];
+
+    return ((value < desc->min) || (value > desc->max)) ? PARAM_RSLT_ERR_RANGE : CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: param_find_block
+********************************************************************************
+* Summary:
+*  Finds the flash block that holds PARAM_FLASH_ADDR.
+*
+* Parameters:
+*  flash: initialized flash object
+*  block: receives the block geometry
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or PARAM_RSLT_ERR_SNAPSHOT
+*
+*******************************************************************************/
+static cy_rslt_t param_find_block(cyhal_flash_t *flash, cyhal_flash_block_info_t *block)
+{
+    cyhal_flash_info_t info;
+
+    cyhal_flash_get_info(flash, &info);
+    for (uint32_t index = 0u; index < info.block_count; index++)
+    {
+        if ((PARAM_FLASH_ADDR >= info.blocks[index].start_address) &&
+            (PARAM_FLASH_ADDR < (info.blocks[index].start_address + info.blocks[index].size)))
+        {
+            *block = info.blocks[index];
+            return CY_RSLT_SUCCESS;
+        }
+    }
+
+    return PARAM_RSLT_ERR_SNAPSHOT;
+}
+
+/* [] END OF FILE */
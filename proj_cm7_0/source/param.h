@@ -0,0 +1,142 @@
+/******************************************************************************
+* File Name:   param.h
+*
+* Description: Registry of the demo parameters that can be changed at run
+*              time: LED blink period, PWM frequencies, QSPI bus frequency,
+*              ADC sample delay, CAN FD identifier and length, power modes
+*              button press counts and console baud rate. The values are kept
+*              in RAM and persisted as a compact binary snapshot in the work
+*              flash, which param_load() reads back at boot without parsing.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _PARAM_H_
+#define _PARAM_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Snapshot layout, little endian:
+ *   magic (4) | version (1) | count (1) | payload size (2) |
+ *   values in registry order, each as wide as its type | CRC-32 (4) */
+#define PARAM_SNAPSHOT_MAGIC            (0x314D5250UL)      /* "PRM1" */
+#define PARAM_SNAPSHOT_VERSION          (1u)
+#define PARAM_SNAPSHOT_HEADER_SIZE      (8u)
+#define PARAM_SNAPSHOT_CRC_SIZE         (4u)
+#define PARAM_SNAPSHOT_MAX_SIZE         (128u)
+
+/* Work flash sector holding the snapshot */
+#define PARAM_FLASH_ADDR                (CY_WFLASH_LG_SBM_TOP)
+
+/* A value is outside the range of its parameter, the press counts are not
+ * increasing or the ADC window is empty */
+#define PARAM_RSLT_ERR_RANGE            (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x15u))
+/* The snapshot is missing, truncated or corrupted */
+#define PARAM_RSLT_ERR_SNAPSHOT         (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x16u))
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    PARAM_LED_BLINK_PERIOD = 0u,    /* Hello world LED timer period, 10 kHz ticks */
+    PARAM_PWM_FREQUENCY_0,          /* PWM demo frequency steps, Hz */
+    PARAM_PWM_FREQUENCY_1,
+    PARAM_PWM_FREQUENCY_2,
+    PARAM_PWM_FREQUENCY_3,
+    PARAM_PWM_FREQUENCY_4,
+    PARAM_PWM_FREQUENCY_5,
+    PARAM_PWM_FREQUENCY_6,
+    PARAM_QSPI_BUS_FREQUENCY,       /* QSPI demo bus frequency, Hz */
+    PARAM_ADC_DELAY_MS,             /* SAR ADC demo delay between samples */
+    PARAM_CAN_ID,                   /* CAN FD demo standard identifier */
+    PARAM_CAN_DLC,                  /* CAN FD demo data length code */
+    PARAM_QUICK_PRESS_COUNT,        /* Power modes demo press lengths, 10 ms */
+    PARAM_SHORT_PRESS_COUNT,
+    PARAM_LONG_PRESS_COUNT,
+    PARAM_BAUD_RATE,                /* Debug UART baud rate, applied at boot */
+    PARAM_ADC_WINDOW_LOW_MV,        /* SAR ADC demo alarm window, low < high */
+    PARAM_ADC_WINDOW_HIGH_MV,
+    PARAM_ADC_SYNC_PHASE,           /* SAR ADC demo trigger phase in the PWM period, 0.1 % */
+    PARAM_SCOPE_TRIGGER,            /* SAR ADC demo scope trigger, scope_trigger_mode_t */
+    PARAM_SCOPE_LEVEL_MV,
+    PARAM_SCOPE_PRE,                /* Samples before the trigger, of ADC_SCOPE_SAMPLES */
+    PARAM_EDGE_INPUT,               /* GPIO interrupt demo edge capture button, 1 or 2 */
+    PARAM_CONSOLE_UI,               /* Fixed menu and status line on an ANSI terminal, 0 or 1 */
+    PARAM_NUM
+} param_id_t;
+
+/* Value types, numbered by their size in the snapshot */
+typedef enum
+{
+    PARAM_TYPE_U8  = 1u,
+    PARAM_TYPE_U16 = 2u,
+    PARAM_TYPE_U32 = 4u,
+} param_type_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    const char   *name;             /* Console name */
+    param_type_t  type;
+    uint32_t      min;
+    uint32_t      max;
+    uint32_t      def;              /* Default, used without a valid snapshot */
+    const char   *unit;
+} param_desc_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t param_load(void);
+extern cy_rslt_t param_save(void);
+extern void param_reset(void);
+extern uint32_t param_get(param_id_t id);
+extern cy_rslt_t param_set(param_id_t id, uint32_t value);
+extern const param_desc_t *param_get_desc(param_id_t id);
+extern bool param_find(const char *name, param_id_t *id);
+extern cy_rslt_t param_validate(const uint32_t *values);
+extern void param_get_defaults(uint32_t *values);
+extern uint32_t param_serialize(const uint32_t *values, uint8_t *buffer, uint32_t size);
+extern cy_rslt_t param_deserialize(const uint8_t *buffer, uint32_t size, uint32_t *values);
+extern uint32_t param_get_load_cycles(void);
+
+#endif
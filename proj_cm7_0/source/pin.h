@@ -0,0 +1,192 @@
+/******************************************************************************
+* File Name:   pin.h
+*
+* Description: Output pins written through the OUT_SET, OUT_CLR and OUT_INV
+*              registers of their port. The pin argument of the macros is a
+*              constant such as CYBSP_USER_LED1: port address and bit mask are
+*              resolved by the compiler and each write is a single store,
+*              where cyhal_gpio_write() looks the pin up on every call. The
+*              pins must be initialized with cyhal_gpio_init() first.
+*
+*              On the host, the writes go to the simulated ports and are
+*              recorded in the trace as "gpio_port_out".
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _PIN_H_
+#define _PIN_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PIN_PORT(pin)               (CYHAL_GET_PORTADDR(pin))
+#define PIN_MASK(pin)               (1UL << CYHAL_GET_PIN(pin))
+#define PIN_SAME_PORT(a, b)         (CYHAL_GET_PORT(a) == CYHAL_GET_PORT(b))
+
+#define PIN_SET(pin)                pin_out_set(PIN_PORT(pin), PIN_MASK(pin))
+#define PIN_CLR(pin)                pin_out_clr(PIN_PORT(pin), PIN_MASK(pin))
+#define PIN_INV(pin)                pin_out_inv(PIN_PORT(pin), PIN_MASK(pin))
+#define PIN_WRITE(pin, value)       pin_out_write(PIN_PORT(pin), PIN_MASK(pin), (value))
+
+/* Writes the pins of 'mask', all on the port of 'pin', with one store: bits
+ * of 'value' outside 'mask' are ignored and the other pins are untouched. */
+#define PIN_PORT_WRITE(pin, mask, value) pin_port_write(PIN_PORT(pin), (mask), (value))
+
+/*******************************************************************************
+* Function Name: pin_out_set
+********************************************************************************
+* Summary:
+*  Drives the pins of a port high.
+*
+* Parameters:
+*  port: GPIO port
+*  mask: pins
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static inline void pin_out_set(GPIO_PRT_Type *port, uint32_t mask)
+{
+#if defined(__arm__)
+    GPIO_PRT_OUT_SET(port) = mask;
+#else
+    sim_gpio_port_out(port, mask, 0u, 0u);
+#endif /* defined(__arm__) */
+}
+
+/*******************************************************************************
+* Function Name: pin_out_clr
+********************************************************************************
+* Summary:
+*  Drives the pins of a port low.
+*
+* Parameters:
+*  port: GPIO port
+*  mask: pins
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static inline void pin_out_clr(GPIO_PRT_Type *port, uint32_t mask)
+{
+#if defined(__arm__)
+    GPIO_PRT_OUT_CLR(port) = mask;
+#else
+    sim_gpio_port_out(port, 0u, mask, 0u);
+#endif /* defined(__arm__) */
+}
+
+/*******************************************************************************
+* Function Name: pin_out_inv
+********************************************************************************
+* Summary:
+*  Inverts the pins of a port.
+*
+* Parameters:
+*  port: GPIO port
+*  mask: pins
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static inline void pin_out_inv(GPIO_PRT_Type *port, uint32_t mask)
+{
+#if defined(__arm__)
+    GPIO_PRT_OUT_INV(port) = mask;
+#else
+    sim_gpio_port_out(port, 0u, 0u, mask);
+#endif /* defined(__arm__) */
+}
+
+/*******************************************************************************
+* Function Name: pin_out_write
+********************************************************************************
+* Summary:
+*  Drives the pins of a port to a level.
+*
+* Parameters:
+*  port: GPIO port
+*  mask: pins
+*  value: level, 0 for low
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static inline void pin_out_write(GPIO_PRT_Type *port, uint32_t mask, uint32_t value)
+{
+    if (0u != value)
+    {
+        pin_out_set(port, mask);
+    }
+    else
+    {
+        pin_out_clr(port, mask);
+    }
+}
+
+/*******************************************************************************
+* Function Name: pin_port_write
+********************************************************************************
+* Summary:
+*  Writes several pins of a port at once by inverting those that differ from
+*  the new value. An interrupt writing other pins of the port between the read
+*  and the store is not undone, unlike with a write of OUT.
+*
+* Parameters:
+*  port: GPIO port
+*  mask: pins
+*  value: new levels, one bit per pin
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static inline void pin_port_write(GPIO_PRT_Type *port, uint32_t mask, uint32_t value)
+{
+#if defined(__arm__)
+    GPIO_PRT_OUT_INV(port) = (GPIO_PRT_OUT(port) ^ value) & mask;
+#else
+    sim_gpio_port_out(port, 0u, 0u, (sim_gpio_port_read(port) ^ value) & mask);
+#endif /* defined(__arm__) */
+}
+
+#endif
@@ -0,0 +1,205 @@
+/******************************************************************************
+* File Name:   placement.c
+*
+* Description: Start-up of the CM7_0 TCM and non-cacheable sections, and the
+*              D-cache maintenance of DMA buffers.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "placement.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* MPU region of the non-cacheable section, the highest number wins */
+#define PLACEMENT_MPU_REGION        (15u)
+
+#if PLACEMENT_ENABLED
+_Static_assert(PLACEMENT_NOCACHE_SIZE == 4096u, "the MPU region is set up for 4 KB");
+#endif /* PLACEMENT_ENABLED */
+
+/*******************************************************************************
+* External Variables
+*******************************************************************************/
+#if PLACEMENT_ENABLED
+/* Defined by placement_gcc.ld */
+extern uint32_t __cm7_itcm_start__[];
+extern uint32_t __cm7_itcm_end__[];
+extern uint32_t __cm7_itcm_load__[];
+extern uint32_t __cm7_dtcm_start__[];
+extern uint32_t __cm7_dtcm_end__[];
+extern uint32_t __cm7_dtcm_load__[];
+extern uint8_t  __cm7_nocache_start__[];
+extern uint8_t  __cm7_nocache_end__[];
+#endif /* PLACEMENT_ENABLED */
+
+
+/*******************************************************************************
+* Function Name: placement_init
+********************************************************************************
+* Summary:
+*  Enables the TCMs, copies the code and initialized data of the TCM sections
+*  from flash, and maps the non-cacheable section as normal non-cacheable
+*  memory with the MPU, cleared. Called first in main(), before any placed
+*  function or variable is used.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void placement_init(void)
+{
+#if PLACEMENT_ENABLED
+    SCB->ITCMCR |= SCB_ITCMCR_EN_Msk;
+    SCB->DTCMCR |= SCB_DTCMCR_EN_Msk;
+    __DSB();
+    __ISB();
+
+    memcpy(__cm7_itcm_start__, __cm7_itcm_load__,
+           (size_t)((uint8_t *)__cm7_itcm_end__ - (uint8_t *)__cm7_itcm_start__));
+    memcpy(__cm7_dtcm_start__, __cm7_dtcm_load__,
+           (size_t)((uint8_t *)__cm7_dtcm_end__ - (uint8_t *)__cm7_dtcm_start__));
+    /* The code was copied through the D-side, the I-cache does not cover the
+     * TCM but the pipeline may hold stale instructions */
+    __DSB();
+    __ISB();
+
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)__cm7_nocache_start__, (int32_t)PLACEMENT_NOCACHE_SIZE);
+    ARM_MPU_Disable();
+    ARM_MPU_SetRegion(ARM_MPU_RBAR(PLACEMENT_MPU_REGION, (uint32_t)__cm7_nocache_start__),
+                      ARM_MPU_RASR(1u, ARM_MPU_AP_FULL, 1u, 1u, 0u, 0u, 0u, ARM_MPU_REGION_SIZE_4KB));
+    ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+    memset(__cm7_nocache_start__, 0, PLACEMENT_NOCACHE_SIZE);
+#endif /* PLACEMENT_ENABLED */
+}
+
+/*******************************************************************************
+* Function Name: placement_is_nocache
+********************************************************************************
+* Summary:
+*  Tells whether a buffer lies in the non-cacheable section.
+*
+* Parameters:
+*  addr: start of the buffer
+*
+* Return:
+*  bool: true if no cache maintenance is needed
+*
+*******************************************************************************/
+bool placement_is_nocache(const volatile void *addr)
+{
+#if PLACEMENT_ENABLED
+    return ((const volatile uint8_t *)addr >= __cm7_nocache_start__) &&
+           ((const volatile uint8_t *)addr < __cm7_nocache_end__);
+#else
+    (void)addr;
+    return false;
+#endif /* PLACEMENT_ENABLED */
+}
+
+/*******************************************************************************
+* Function Name: placement_dcache_clean
+********************************************************************************
+* Summary:
+*  Writes the D-cache lines covering a buffer back to SRAM before a DMA reads
+*  it. The range is widened to whole cache lines. No operation for buffers in
+*  the non-cacheable section and on cores without a D-cache.
+*
+* Parameters:
+*  addr: start of the buffer
+*  size: size of the buffer in bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void placement_dcache_clean(const volatile void *addr, uint32_t size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    uint32_t start = (uint32_t)addr & ~(PLACEMENT_CACHE_LINE - 1u);
+    uint32_t end = ((uint32_t)addr + size + PLACEMENT_CACHE_LINE - 1u) & ~(PLACEMENT_CACHE_LINE - 1u);
+
+    if ((0u != size) && !placement_is_nocache(addr))
+    {
+        SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: placement_dcache_invalidate
+********************************************************************************
+* Summary:
+*  Discards the D-cache lines covering a buffer after a DMA has written it.
+*  The range is widened to whole cache lines, so the buffer must be aligned
+*  and sized to PLACEMENT_CACHE_LINE: data of this core sharing its first or
+*  last line would be lost. No operation for buffers in the non-cacheable
+*  section and on cores without a D-cache.
+*
+* Parameters:
+*  addr: start of the buffer
+*  size: size of the buffer in bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void placement_dcache_invalidate(volatile void *addr, uint32_t size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    uint32_t start = (uint32_t)addr & ~(PLACEMENT_CACHE_LINE - 1u);
+    uint32_t end = ((uint32_t)addr + size + PLACEMENT_CACHE_LINE - 1u) & ~(PLACEMENT_CACHE_LINE - 1u);
+
+    CY_ASSERT((0u == ((uint32_t)addr & (PLACEMENT_CACHE_LINE - 1u))) &&
+              (0u == (size & (PLACEMENT_CACHE_LINE - 1u))));
+    if ((0u != size) && !placement_is_nocache(addr))
+    {
+        SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,90 @@
+/******************************************************************************
+* File Name:   placement.h
+*
+* Description: Memory placement of the CM7_0 hot code and data. With
+*              PLACEMENT=1 and GCC_ARM, placement_gcc.ld adds three sections
+*              to the BSP linker script:
+*                .cm7_itcm     code run from the instruction TCM (PLACE_ITCM)
+*                .cm7_dtcm     data in the data TCM (PLACE_DTCM)
+*                .cm7_nocache  buffers in SRAM that the MPU maps non-cacheable,
+*                              for DMA (PLACE_NOCACHE)
+*              The TCMs are private to CM7_0: neither DMA nor the other cores
+*              can use buffers placed there. Without placement the macros keep
+*              the default sections.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _PLACEMENT_H_
+#define _PLACEMENT_H_
+
+#include <stdbool.h>
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Placement build switch, set by the PLACEMENT make variable */
+#ifndef PLACEMENT
+#define PLACEMENT                   (0)
+#endif
+
+/* Size of the non-cacheable section, a power of 2 for the MPU. Keep in line
+ * with placement_gcc.ld. */
+#define PLACEMENT_NOCACHE_SIZE      (4096u)
+
+/* D-cache line of the Cortex-M7 */
+#define PLACEMENT_CACHE_LINE        (32u)
+
+#if PLACEMENT && defined(__arm__) && defined(__GNUC__) && !defined(__ARMCC_VERSION) && !defined(__ICCARM__)
+#define PLACEMENT_ENABLED           (1)
+#define PLACE_ITCM                  __attribute__((section(".cm7_itcm"), noinline))
+#define PLACE_DTCM                  __attribute__((section(".cm7_dtcm")))
+#define PLACE_NOCACHE               __attribute__((section(".cm7_nocache"), aligned(PLACEMENT_CACHE_LINE)))
+#else
+#define PLACEMENT_ENABLED           (0)
+#define PLACE_ITCM
+#define PLACE_DTCM
+#define PLACE_NOCACHE               __attribute__((aligned(PLACEMENT_CACHE_LINE)))
+#endif /* PLACEMENT && GCC_ARM */
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void placement_init(void);
+extern bool placement_is_nocache(const volatile void *addr);
+extern void placement_dcache_clean(const volatile void *addr, uint32_t size);
+extern void placement_dcache_invalidate(volatile void *addr, uint32_t size);
+
+#endif
@@ -0,0 +1,606 @@
+/*******************************************************************************
+* File Name:   pm_profiler.c
+*
+* Description: Timestamps every syspm callback phase with the free-running
+*              low-power timer (MCWDT) and accumulates entry latency, exit
+*              latency and time-in-state of the Sleep and DeepSleep transitions.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include "pm_profiler.h"
+#include "oob_demo.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Sentinel for a phase that has not been reached yet */
+#define PM_PROF_STAMP_NONE      (0xFFFFFFFFu)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Timestamps of the transition that is currently in progress */
+typedef struct
+{
+    bool     active;
+    uint8_t  state;
+    uint32_t t_request;
+    uint32_t t_check;
+    uint32_t t_before;
+    uint32_t t_after;
+    uint32_t io_wait;
+    uint32_t t_resume;
+    cy_rslt_t result;
+} pm_prof_sample_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static bool pm_profiler_callback(cyhal_syspm_callback_state_t state,
+                                 cyhal_syspm_callback_mode_t mode, void *arg);
+static bool pm_profiler_completed(void);
+static void pm_profiler_account(void);
+static void pm_profiler_stat_add(pm_prof_stat_t *stat, uint32_t ticks);
+static void pm_profiler_print_stat(const pm_prof_stat_t *stat);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Free-running low-power counter, keeps counting in DeepSleep */
+static cyhal_lptimer_t pm_prof_lptimer;
+/* Counter frequency and wrap mask */
+static uint32_t pm_prof_freq_hz;
+static uint32_t pm_prof_mask;
+static bool     pm_prof_initialized = false;
+
+static volatile pm_prof_sample_t pm_prof_sample;
+/* Closed samples wait for pm_profiler_release() */
+static bool     pm_prof_held = false;
+static bool     pm_prof_pending = false;
+static pm_prof_result_t pm_prof_result[PM_PROF_STATE_NUM];
+
+static const char * const pm_prof_state_name[PM_PROF_STATE_NUM] =
+{
+    "sleep",
+    "deepsleep",
+};
+
+/* Callback for every phase, including CHECK_FAIL, of Sleep and DeepSleep */
+static cyhal_syspm_callback_data_t pm_prof_callback_data =
+{
+    pm_profiler_callback,                                   /* Callback function */
+    (cyhal_syspm_callback_state_t)
+    (CYHAL_SYSPM_CB_CPU_SLEEP | CYHAL_SYSPM_CB_CPU_DEEPSLEEP), /* Power States supported */
+    (cyhal_syspm_callback_mode_t)0,                         /* Modes to ignore */
+    NULL,                                                   /* Callback Argument */
+    NULL                                                    /* For internal use */
+};
+
+
+/*******************************************************************************
+* Function Name: pm_profiler_init
+********************************************************************************
+* Summary:
+*  Starts the free-running low-power counter, clears the results and registers
+*  the profiler syspm callback. cyhal_syspm_init() must be called first.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: result of the low-power timer initialization
+*
+*******************************************************************************/
+cy_rslt_t pm_profiler_init(void)
+{
+    cy_rslt_t result;
+    cyhal_lptimer_info_t info;
+
+    if (pm_prof_initialized)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    result = cyhal_lptimer_init(&pm_prof_lptimer);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    cyhal_lptimer_get_info(&pm_prof_lptimer, &info);
+    pm_prof_freq_hz = info.frequency_hz;
+    pm_prof_mask = info.max_counter_value;
+
+    pm_profiler_reset();
+    cyhal_syspm_register_callback(&pm_prof_callback_data);
+    pm_prof_initialized = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_free
+********************************************************************************
+* Summary:
+*  Unregisters the profiler callback and releases the low-power timer. The
+*  accumulated results are kept until the next pm_profiler_init().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void pm_profiler_free(void)
+{
+    if (pm_prof_initialized)
+    {
+        cyhal_syspm_unregister_callback(&pm_prof_callback_data);
+        cyhal_lptimer_free(&pm_prof_lptimer);
+        pm_prof_initialized = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_reset
+********************************************************************************
+* Summary:
+*  Clears the accumulated results of all power states.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void pm_profiler_reset(void)
+{
+    memset(pm_prof_result, 0, sizeof(pm_prof_result));
+    for (uint32_t idx = 0; idx < PM_PROF_STATE_NUM; idx++)
+    {
+        pm_prof_result[idx].entry.min = UINT32_MAX;
+        pm_prof_result[idx].check.min = UINT32_MAX;
+        pm_prof_result[idx].residency.min = UINT32_MAX;
+        pm_prof_result[idx].exit.min = UINT32_MAX;
+        pm_prof_result[idx].io_wait.min = UINT32_MAX;
+    }
+    pm_prof_sample.active = false;
+    pm_prof_held = false;
+    pm_prof_pending = false;
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_now
+********************************************************************************
+* Summary:
+*  Returns the current value of the free-running low-power counter, or 0 while
+*  the profiler is not initialized.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: counter ticks
+*
+*******************************************************************************/
+uint32_t pm_profiler_now(void)
+{
+    if (!pm_prof_initialized)
+    {
+        return 0u;
+    }
+    return cyhal_lptimer_read(&pm_prof_lptimer);
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_elapsed
+********************************************************************************
+* Summary:
+*  Returns the ticks elapsed since a pm_profiler_now() timestamp, taking the
+*  counter wrap-around into account.
+*
+* Parameters:
+*  start: earlier counter value
+*
+* Return:
+*  uint32_t: elapsed counter ticks
+*
+*******************************************************************************/
+uint32_t pm_profiler_elapsed(uint32_t start)
+{
+    return (pm_profiler_now() - start) & pm_prof_mask;
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_ticks_to_us
+********************************************************************************
+* Summary:
+*  Converts low-power counter ticks to microseconds.
+*
+* Parameters:
+*  ticks: number of counter ticks
+*
+* Return:
+*  uint32_t: microseconds
+*
+*******************************************************************************/
+uint32_t pm_profiler_ticks_to_us(uint32_t ticks)
+{
+    if (0u == pm_prof_freq_hz)
+    {
+        return 0u;
+    }
+    return (uint32_t)(((uint64_t)ticks * 1000000u) / pm_prof_freq_hz);
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_request
+********************************************************************************
+* Summary:
+*  Opens a new sample. Call immediately before cyhal_syspm_sleep() or
+*  cyhal_syspm_deepsleep().
+*
+* Parameters:
+*  state: power state that is about to be requested
+*  io_wait: ticks spent flushing I/O before the request
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void pm_profiler_request(pm_prof_state_t state, uint32_t io_wait)
+{
+    pm_prof_sample.state = (uint8_t)state;
+    pm_prof_sample.io_wait = io_wait;
+    pm_prof_sample.t_check = PM_PROF_STAMP_NONE;
+    pm_prof_sample.t_before = PM_PROF_STAMP_NONE;
+    pm_prof_sample.t_after = PM_PROF_STAMP_NONE;
+    pm_prof_sample.active = true;
+    pm_prof_sample.t_request = pm_profiler_now();
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_resume
+********************************************************************************
+* Summary:
+*  Closes the open sample and adds it to the results. Call immediately after
+*  cyhal_syspm_sleep() or cyhal_syspm_deepsleep() return.
+*
+* Parameters:
+*  result: return value of the syspm transition call
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void pm_profiler_resume(cy_rslt_t result)
+{
+    uint32_t t_resume = pm_profiler_now();
+
+    if (!pm_prof_sample.active)
+    {
+        return;
+    }
+    pm_prof_sample.active = false;
+    pm_prof_sample.t_resume = t_resume;
+    pm_prof_sample.result = result;
+
+    if (pm_prof_held)
+    {
+        pm_prof_pending = true;
+    }
+    else
+    {
+        pm_profiler_account();
+    }
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_hold
+********************************************************************************
+* Summary:
+*  Keeps the next sample out of the results until pm_profiler_release(), so
+*  that the caller can check the wake-up source first.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void pm_profiler_hold(void)
+{
+    pm_prof_held = true;
+    pm_prof_pending = false;
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_release
+********************************************************************************
+* Summary:
+*  Adds the sample closed since pm_profiler_hold() to the results, or only
+*  counts it as another wake-up. A rejected transition is always counted as
+*  rejected.
+*
+* Parameters:
+*  count: true if the transition ended on the expected wake-up source
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void pm_profiler_release(bool count)
+{
+    if (pm_prof_pending)
+    {
+        if (count || !pm_profiler_completed())
+        {
+            pm_profiler_account();
+        }
+        else
+        {
+            pm_prof_result[pm_prof_sample.state].other_wakes++;
+        }
+    }
+    pm_prof_held = false;
+    pm_prof_pending = false;
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_get_result
+********************************************************************************
+* Summary:
+*  Returns the accumulated results of one power state.
+*
+* Parameters:
+*  state: power state
+*
+* Return:
+*  const pm_prof_result_t*: accumulated results
+*
+*******************************************************************************/
+const pm_prof_result_t *pm_profiler_get_result(pm_prof_state_t state)
+{
+    return &pm_prof_result[state];
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_print_csv
+********************************************************************************
+* Summary:
+*  Prints the accumulated results as a CSV table, one row per power state.
+*  All times are in microseconds.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void pm_profiler_print_csv(void)
+{
+    printf("state,cycles,rejected,other_wakes,"
+           "entry_min_us,entry_avg_us,entry_max_us,"
+           "check_min_us,check_avg_us,check_max_us,"
+           "residency_min_us,residency_avg_us,residency_max_us,"
+           "exit_min_us,exit_avg_us,exit_max_us,"
+           "io_wait_min_us,io_wait_avg_us,io_wait_max_us\r\n");
+
+    for (uint32_t idx = 0; idx < PM_PROF_STATE_NUM; idx++)
+    {
+        printf("%s,%lu,%lu,%lu", pm_prof_state_name[idx],
+               (unsigned long)pm_prof_result[idx].residency.count,
+               (unsigned long)pm_prof_result[idx].rejected,
+               (unsigned long)pm_prof_result[idx].other_wakes);
+        pm_profiler_print_stat(&pm_prof_result[idx].entry);
+        pm_profiler_print_stat(&pm_prof_result[idx].check);
+        pm_profiler_print_stat(&pm_prof_result[idx].residency);
+        pm_profiler_print_stat(&pm_prof_result[idx].exit);
+        pm_profiler_print_stat(&pm_prof_result[idx].io_wait);
+        printf("\r\n");
+    }
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_callback
+********************************************************************************
+* Summary:
+*  Syspm callback that timestamps the CHECK_READY, BEFORE_TRANSITION and
+*  AFTER_TRANSITION phases of the open sample.
+*
+* Parameters:
+*  state - state the system or CPU is being transitioned into
+*  mode  - callback mode
+*  arg   - user argument (not used)
+*
+* Return:
+*  Always true
+*
+*******************************************************************************/
+static bool pm_profiler_callback(cyhal_syspm_callback_state_t state,
+                                 cyhal_syspm_callback_mode_t mode, void *arg)
+{
+    uint32_t now = pm_profiler_now();
+    (void) arg;
+    (void) state;
+
+    if (!pm_prof_sample.active)
+    {
+        return true;
+    }
+
+    switch (mode)
+    {
+        case CYHAL_SYSPM_CHECK_READY:
+            pm_prof_sample.t_check = now;
+            break;
+        case CYHAL_SYSPM_CHECK_FAIL:
+            pm_prof_sample.t_before = PM_PROF_STAMP_NONE;
+            break;
+        case CYHAL_SYSPM_BEFORE_TRANSITION:
+            pm_prof_sample.t_before = now;
+            break;
+        case CYHAL_SYSPM_AFTER_TRANSITION:
+            pm_prof_sample.t_after = now;
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_completed
+********************************************************************************
+* Summary:
+*  Tells whether the closed sample went through the low-power state.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  bool: false if the transition was rejected
+*
+*******************************************************************************/
+static bool pm_profiler_completed(void)
+{
+    return (CY_RSLT_SUCCESS == pm_prof_sample.result) &&
+           (PM_PROF_STAMP_NONE != pm_prof_sample.t_before) &&
+           (PM_PROF_STAMP_NONE != pm_prof_sample.t_after);
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_account
+********************************************************************************
+* Summary:
+*  Adds the closed sample to the results of its power state.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void pm_profiler_account(void)
+{
+    pm_prof_result_t *res = &pm_prof_result[pm_prof_sample.state];
+
+    pm_profiler_stat_add(&res->io_wait, pm_prof_sample.io_wait);
+
+    if (!pm_profiler_completed())
+    {
+        res->rejected++;
+        return;
+    }
+
+    pm_profiler_stat_add(&res->entry,
+                         (pm_prof_sample.t_before - pm_prof_sample.t_request) & pm_prof_mask);
+    if (PM_PROF_STAMP_NONE != pm_prof_sample.t_check)
+    {
+        pm_profiler_stat_add(&res->check,
+                             (pm_prof_sample.t_before - pm_prof_sample.t_check) & pm_prof_mask);
+    }
+    pm_profiler_stat_add(&res->residency,
+                         (pm_prof_sample.t_after - pm_prof_sample.t_before) & pm_prof_mask);
+    pm_profiler_stat_add(&res->exit,
+                         (pm_prof_sample.t_resume - pm_prof_sample.t_after) & pm_prof_mask);
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_stat_add
+********************************************************************************
+* Summary:
+*  Adds one measurement to a min/max/sum accumulator.
+*
+* Parameters:
+*  stat: accumulator
+*  ticks: measured value in counter ticks
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void pm_profiler_stat_add(pm_prof_stat_t *stat, uint32_t ticks)
+{
+    stat->count++;
+    stat->sum += ticks;
+    if (ticks < stat->min)
+    {
+        stat->min = ticks;
+    }
+    if (ticks > stat->max)
+    {
+        stat->max = ticks;
+    }
+}
+
+/*******************************************************************************
+* Function Name: pm_profiler_print_stat
+********************************************************************************
+* Summary:
+*  Prints the min, avg and max columns of one accumulator.
+*
+* Parameters:
+*  stat: accumulator
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void pm_profiler_print_stat(const pm_prof_stat_t *stat)
+{
+    if (0u == stat->count)
+    {
+        printf(",,,");
+        return;
+    }
+    printf(",%lu,%lu,%lu",
+           (unsigned long)pm_profiler_ticks_to_us(stat->min),
+           (unsigned long)pm_profiler_ticks_to_us((uint32_t)(stat->sum / stat->count)),
+           (unsigned long)pm_profiler_ticks_to_us(stat->max));
+}
+
+/* [] END OF FILE */
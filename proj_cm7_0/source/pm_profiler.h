@@ -0,0 +1,102 @@
+/******************************************************************************
+* File Name:   pm_profiler.h
+*
+* Description: Power-mode transition latency and residency profiler.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _PM_PROFILER_H_
+#define _PM_PROFILER_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+/* Power states profiled by the transition profiler */
+typedef enum
+{
+    PM_PROF_STATE_SLEEP     = 0u,
+    PM_PROF_STATE_DEEPSLEEP = 1u,
+    PM_PROF_STATE_NUM       = 2u,
+} pm_prof_state_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Min/max/sum accumulator of one metric, in low-power counter ticks */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} pm_prof_stat_t;
+
+/* Accumulated results of one power state */
+typedef struct
+{
+    pm_prof_stat_t entry;       /* Request to BEFORE_TRANSITION */
+    pm_prof_stat_t check;       /* CHECK_READY to BEFORE_TRANSITION, part of the entry */
+    pm_prof_stat_t residency;   /* BEFORE_TRANSITION to AFTER_TRANSITION */
+    pm_prof_stat_t exit;        /* AFTER_TRANSITION to return to the caller */
+    pm_prof_stat_t io_wait;     /* Console flush before the request */
+    uint32_t       rejected;    /* Transitions refused by a CHECK_READY callback */
+    uint32_t       other_wakes; /* Samples dropped by pm_profiler_release() */
+} pm_prof_result_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t pm_profiler_init(void);
+extern void pm_profiler_free(void);
+extern void pm_profiler_reset(void);
+extern uint32_t pm_profiler_now(void);
+extern uint32_t pm_profiler_elapsed(uint32_t start);
+extern uint32_t pm_profiler_ticks_to_us(uint32_t ticks);
+extern void pm_profiler_request(pm_prof_state_t state, uint32_t io_wait);
+extern void pm_profiler_resume(cy_rslt_t result);
+extern void pm_profiler_hold(void);
+extern void pm_profiler_release(bool count);
+extern const pm_prof_result_t *pm_profiler_get_result(pm_prof_state_t state);
+extern void pm_profiler_print_csv(void);
+
+#endif
@@ -0,0 +1,316 @@
+/*******************************************************************************
+* File Name:   power_manager.c
+*
+* Description: Power manager for the power modes demo. Drains the debug UART
+*              before every low-power entry by sleeping on the TX_EMPTY interrupt,
+*              rejects DeepSleep while the UART is still transmitting, and records
+*              the I/O wait of each transition in the transition profiler.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "power_manager.h"
+#include "pm_profiler.h"
+#include "print_message.h"
+#include "oob_demo.h"
+#include "io_client.h"
+#include "watchdog.h"
+#include "cy_retarget_io.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static bool uart_power_callback(cyhal_syspm_callback_state_t state,
+                                cyhal_syspm_callback_mode_t mode, void *arg);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Set by the UART TX_EMPTY interrupt once the TX FIFO is drained */
+static volatile bool console_drained_flag = false;
+
+/* Rejects DeepSleep and Hibernate while the debug UART is transmitting */
+static cyhal_syspm_callback_data_t uart_callback_data =
+{
+    uart_power_callback,                                    /* Callback function */
+    (cyhal_syspm_callback_state_t)
+    (CYHAL_SYSPM_CB_CPU_DEEPSLEEP |
+     CYHAL_SYSPM_CB_SYSTEM_HIBERNATE),                      /* Power States supported */
+    (cyhal_syspm_callback_mode_t)
+    (CYHAL_SYSPM_CHECK_FAIL |
+     CYHAL_SYSPM_BEFORE_TRANSITION |
+     CYHAL_SYSPM_AFTER_TRANSITION),                         /* Modes to ignore */
+    NULL,                                                   /* Callback Argument */
+    NULL                                                    /* For internal use */
+};
+
+
+/*******************************************************************************
+* Function Name: power_manager_init
+********************************************************************************
+* Summary:
+*  Registers the UART CHECK_READY callback and starts the transition profiler.
+*  cyhal_syspm_init() must be called first.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: result of the profiler initialization
+*
+*******************************************************************************/
+cy_rslt_t power_manager_init(void)
+{
+    cyhal_syspm_register_callback(&uart_callback_data);
+    return pm_profiler_init();
+}
+
+/*******************************************************************************
+* Function Name: power_manager_free
+********************************************************************************
+* Summary:
+*  Unregisters the UART callback and stops the transition profiler.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void power_manager_free(void)
+{
+    pm_profiler_free();
+    cyhal_syspm_unregister_callback(&uart_callback_data);
+}
+
+/*******************************************************************************
+* Function Name: power_manager_flush_console
+********************************************************************************
+* Summary:
+*  Waits until the debug UART has sent every queued character. The CPU sleeps
+*  in WFI until the TX_EMPTY interrupt reports an empty FIFO, then waits for
+*  the last character to leave the shift register (at most one character time).
+*  With IO_COPROCESSOR=1 it waits until CM0+ has taken the queued output; the
+*  UART driver of CM0+ holds off DeepSleep until the characters are sent.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: time spent waiting, in transition profiler ticks
+*
+*******************************************************************************/
+uint32_t power_manager_flush_console(void)
+{
+    uint32_t start;
+    uint32_t intr_status;
+
+    if (!io_client_tx_active())
+    {
+        return 0u;
+    }
+
+    start = pm_profiler_now();
+    watchdog_begin(WATCHDOG_TASK_FLUSH);
+#if IO_COPROCESSOR
+    (void)intr_status;
+    while (io_client_tx_active())
+    {
+    }
+#else
+    console_drained_flag = false;
+    cyhal_uart_enable_event(&cy_retarget_io_uart_obj, CYHAL_UART_IRQ_TX_EMPTY,
+                            INT_PRIORITY, true);
+
+    /* WFI wakes on the pending TX_EMPTY interrupt even while it is masked,
+     * so the flag cannot be set between the check and the WFI unnoticed. */
+    intr_status = Cy_SysLib_EnterCriticalSection();
+    while (!console_drained_flag)
+    {
+        __WFI();
+        Cy_SysLib_ExitCriticalSection(intr_status);
+        intr_status = Cy_SysLib_EnterCriticalSection();
+    }
+    Cy_SysLib_ExitCriticalSection(intr_status);
+
+    /* Wait for the last character in the shift register */
+    while (cyhal_uart_is_tx_active(&cy_retarget_io_uart_obj))
+    {
+    }
+#endif /* IO_COPROCESSOR */
+    watchdog_end(WATCHDOG_TASK_FLUSH);
+
+    return pm_profiler_elapsed(start);
+}
+
+/*******************************************************************************
+* Function Name: power_manager_console_drained
+********************************************************************************
+* Summary:
+*  Called from the UART event handler on TX_EMPTY. Disables the event, which
+*  stays asserted while the FIFO is empty, and wakes up the console flush.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void power_manager_console_drained(void)
+{
+    cyhal_uart_enable_event(&cy_retarget_io_uart_obj, CYHAL_UART_IRQ_TX_EMPTY,
+                            INT_PRIORITY, false);
+    console_drained_flag = true;
+}
+
+/*******************************************************************************
+* Function Name: power_manager_sleep
+********************************************************************************
+* Summary:
+*  Flushes the console and enters Sleep. The transition is profiled.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: result of cyhal_syspm_sleep()
+*
+*******************************************************************************/
+cy_rslt_t power_manager_sleep(void)
+{
+    cy_rslt_t result;
+    uint32_t io_wait = power_manager_flush_console();
+
+    /* The wait for the wake-up is not part of any task */
+    watchdog_suspend();
+    pm_profiler_request(PM_PROF_STATE_SLEEP, io_wait);
+    result = cyhal_syspm_sleep();
+    pm_profiler_resume(result);
+    watchdog_resume();
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: power_manager_deepsleep
+********************************************************************************
+* Summary:
+*  Flushes the console and enters DeepSleep. The transition is profiled.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: result of cyhal_syspm_deepsleep()
+*
+*******************************************************************************/
+cy_rslt_t power_manager_deepsleep(void)
+{
+    cy_rslt_t result;
+    uint32_t io_wait = power_manager_flush_console();
+
+    /* The wait for the wake-up is not part of any task */
+    watchdog_suspend();
+    pm_profiler_request(PM_PROF_STATE_DEEPSLEEP, io_wait);
+    result = cyhal_syspm_deepsleep();
+    pm_profiler_resume(result);
+    watchdog_resume();
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: power_manager_hibernate
+********************************************************************************
+* Summary:
+*  Flushes the console and enters Hibernate. Returns only if the transition
+*  was rejected.
+*
+* Parameters:
+*  wakeup_source: Hibernate wake-up source
+*
+* Return:
+*  cy_rslt_t: result of cyhal_syspm_hibernate()
+*
+*******************************************************************************/
+cy_rslt_t power_manager_hibernate(cyhal_syspm_hibernate_source_t wakeup_source)
+{
+    cy_rslt_t result;
+
+    (void)power_manager_flush_console();
+
+    /* The watchdog would reset the device out of Hibernate */
+    watchdog_suspend();
+    result = cyhal_syspm_hibernate(wakeup_source);
+    watchdog_resume();
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: uart_power_callback
+********************************************************************************
+* Summary:
+*  CHECK_READY callback. DeepSleep stops the UART clock, so the transition is
+*  rejected while characters are still in the TX FIFO or shift register.
+*
+* Parameters:
+*  state - state the system or CPU is being transitioned into
+*  mode  - callback mode
+*  arg   - user argument (not used)
+*
+* Return:
+*  false while the debug UART is transmitting, true otherwise
+*
+*******************************************************************************/
+static bool uart_power_callback(cyhal_syspm_callback_state_t state,
+                                cyhal_syspm_callback_mode_t mode, void *arg)
+{
+    (void) state;
+    (void) arg;
+
+    if (CYHAL_SYSPM_CHECK_READY == mode)
+    {
+        return !io_client_tx_active();
+    }
+
+    return true;
+}
+
+/* [] END OF FILE */
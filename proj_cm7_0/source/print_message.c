@@ -38,29 +38,56 @@
 * so agrees to indemnify Cypress against all liability.
 *******************************************************************************/
 
+#include <stdarg.h>
 #include "print_message.h"
 #include "oob_demo.h"
+#include "power_manager.h"
+#include "io_client.h"
+#include "profiler.h"
+#include "placement.h"
+#include "param.h"
 #include "cy_retarget_io.h"
+#include "console_fmt.h"
 
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
+PROFILER_ZONE_DEFINE(uart_event_handler);
+
 cyhal_uart_t    uart_obj;
-uint8_t         tx_buf[TX_BUF_SIZE];
+PLACE_DTCM uint8_t tx_buf[TX_BUF_SIZE];
 size_t          tx_length = TX_BUF_SIZE;
 /* UART received command. */
 uint8_t         recCmd = 0;
 
-/* Initialize the UART configuration structure. */
-const cyhal_uart_cfg_t uart_config =
-{
-    .data_bits      = DATA_BITS_8,
-    .stop_bits      = STOP_BITS_1,
-    .parity         = CYHAL_UART_PARITY_NONE,
-    .rx_buffer      = NULL,
-    .rx_buffer_size = 0
-};
+/* Line editor: while active, the keys fill console_line instead of
+ * selecting demos. The handler writes the line and its length, the demo loop
+ * echoes it and takes it once console_line_done is set. */
+static volatile bool     console_line_active = false;
+static volatile bool     console_line_done = false;
+static volatile uint32_t console_line_length = 0u;
+static uint32_t          console_line_echoed = 0u;
+static char              console_line[CONSOLE_LINE_SIZE];
+
+/* Software RX buffer of the raw mode. The handler drains the RX FIFO into
+ * it at every interrupt, the reader takes the characters out of it. When it
+ * is full, the handler stops reading: with CONSOLE_FLOW_CONTROL the RX FIFO
+ * then fills and RTS holds the sender back, without it the characters are
+ * dropped and counted. */
+static PLACE_DTCM uint8_t console_rx_buffer[CONSOLE_RX_BUFFER_SIZE];
+static volatile uint32_t  console_rx_head = 0u;
+static volatile uint32_t  console_rx_tail = 0u;
+static volatile bool      console_raw = false;
+static volatile bool      console_rx_throttled = false;
+
+/* Console statistics, reported by console_get_stats() */
+static volatile uint32_t  console_baud_rate = BAUD_RATE;
+static volatile uint32_t  console_rx_bytes = 0u;
+static volatile uint32_t  console_rx_errors = 0u;
+static volatile uint32_t  console_rx_overruns = 0u;
+static volatile uint32_t  console_rx_throttles = 0u;
+static uint32_t           console_rx_high_water = 0u;
 
 
 /*******************************************************************************
@@ -68,12 +95,15 @@ const cyhal_uart_cfg_t uart_config =
 *******************************************************************************/
 void uart_port_initial(void);
 void uart_event_handler(void* handler_arg, cyhal_uart_event_t event);
+static void console_key_rx(uint8_t key);
+static void console_print_sink(void *arg, const char *text, uint32_t length);
 
 /*******************************************************************************
 * Function Name: uart_port_initial
 ********************************************************************************
 * Summary:
-* Initial uart port and register interrupt callback
+* Initial uart port and register interrupt callback. With IO_COPROCESSOR=1 the
+* debug UART belongs to CM0+ and the console is set up by io_client_init().
 *
 * Parameters:
 *  none
@@ -84,10 +114,17 @@ void uart_event_handler(void* handler_arg, cyhal_uart_event_t event);
 *******************************************************************************/
 void uart_port_initial()
 {
+#if !IO_COPROCESSOR
     cy_rslt_t    rslt;
 
     /* Initialize retarget-io to use the debug UART port */
-    rslt = cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX, CY_RETARGET_IO_BAUDRATE);
+    console_baud_rate = param_get(PARAM_BAUD_RATE);
+#if CONSOLE_FLOW_CONTROL
+    rslt = cy_retarget_io_init_fc(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                  CYBSP_DEBUG_UART_CTS, CYBSP_DEBUG_UART_RTS, console_baud_rate);
+#else
+    rslt = cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX, console_baud_rate);
+#endif /* CONSOLE_FLOW_CONTROL */
 
     if(CY_RSLT_SUCCESS != rslt)
     {
@@ -100,8 +137,8 @@ void uart_port_initial()
     cyhal_uart_register_callback(&cy_retarget_io_uart_obj, uart_event_handler, NULL);
 
    /* Enable required UART events. */
-    cyhal_uart_enable_event(&cy_retarget_io_uart_obj,(cyhal_uart_event_t)(CYHAL_UART_IRQ_RX_DONE | CYHAL_UART_IRQ_RX_NOT_EMPTY), INT_PRIORITY, true);
-
+    cyhal_uart_enable_event(&cy_retarget_io_uart_obj,(cyhal_uart_event_t)(CYHAL_UART_IRQ_RX_DONE | CYHAL_UART_IRQ_RX_NOT_EMPTY | CYHAL_UART_IRQ_RX_ERROR), INT_PRIORITY, true);
+#endif /* !IO_COPROCESSOR */
 }
 
 /*******************************************************************************
@@ -118,10 +155,19 @@ void uart_port_initial()
 *  none
 *
 *******************************************************************************/
-void uart_event_handler(void* handler_arg, cyhal_uart_event_t event)
+PLACE_ITCM void uart_event_handler(void* handler_arg, cyhal_uart_event_t event)
 {
+    uint32_t start = io_client_load_begin();
+    PROFILER_ZONE_BEGIN(uart_event_handler);
+
     (void)handler_arg;
 
+    if ((event & CYHAL_UART_IRQ_TX_EMPTY) == CYHAL_UART_IRQ_TX_EMPTY)
+    {
+        /* TX FIFO drained, wake up the pre-sleep console flush */
+        power_manager_console_drained();
+    }
+
     if ((event & CYHAL_UART_IRQ_RX_DONE) == CYHAL_UART_IRQ_RX_DONE)
     {
         handle_error();
@@ -130,77 +176,536 @@ void uart_event_handler(void* handler_arg, cyhal_uart_event_t event)
     }
     else if ((event & CYHAL_UART_IRQ_RX_NOT_EMPTY) == CYHAL_UART_IRQ_RX_NOT_EMPTY)
     {
-        /* Get input command */
-        cyhal_uart_getc(&cy_retarget_io_uart_obj, &recCmd, 1);
-
-        /* Distinguish command */
-        switch(recCmd)
+        /* Drain the RX FIFO: at high baud rates several characters arrive
+         * per interrupt */
+        while (0u != cyhal_uart_readable(&cy_retarget_io_uart_obj))
         {
-            case DEM_HELLO_WORD:
-                if(demoIndex != (DEM_HELLO_WORD & 0x0F))
-                {
-                    /* Set demoIndex */
-                    demoIndex = DEM_HELLO_WORD & 0x0F;
-                    /* Change demo switch flag */
-                    evtSwitch = true;
-                }
-                break;
-            case DEM_PWM_WAVE:
-                if(demoIndex != (DEM_PWM_WAVE & 0x0F))
-                {
-                    /* Set demoIndex */
-                    demoIndex = DEM_PWM_WAVE & 0x0F;
-                    /* Change demo switch flag */
-                    evtSwitch = true;
-                }
-                break;
-            case DEM_IO_INTR:
-                if(demoIndex != (DEM_IO_INTR & 0x0F))
-                {
-                    /* Set demoIndex */
-                    demoIndex = DEM_IO_INTR & 0x0F;
-                    /* Change demo switch flag */
-                    evtSwitch = true;
-                }
-                break;
-            case DEM_IO_ADC:
-                if(demoIndex != (DEM_IO_ADC & 0x0F))
-                {
-                    /* Set demoIndex */
-                    demoIndex = DEM_IO_ADC & 0x0F;
-                    /* Change demo switch flag */
-                    evtSwitch = true;
-                }
-                break;
-            case DEM_IO_POWER:
-                if(demoIndex != (DEM_IO_POWER & 0x0F))
-                {
-                    /* Set demoIndex */
-                    demoIndex = DEM_IO_POWER & 0x0F;
-                    /* Change demo switch flag */
-                    evtSwitch = true;
-                }
-                break;
-            case DEM_IO_QSPI:
-                if(demoIndex != (DEM_IO_QSPI & 0x0F))
+            if (console_raw)
+            {
+                uint32_t used = console_rx_head - console_rx_tail;
+
+                if (used == CONSOLE_RX_BUFFER_SIZE)
                 {
-                    /* Set demoIndex */
-                    demoIndex = DEM_IO_QSPI & 0x0F;
-                    /* Change demo switch flag */
-                    evtSwitch = true;
+#if CONSOLE_FLOW_CONTROL
+                    /* Leave the rest in the FIFO until console_raw_read() */
+                    cyhal_uart_enable_event(&cy_retarget_io_uart_obj, CYHAL_UART_IRQ_RX_NOT_EMPTY,
+                                            INT_PRIORITY, false);
+                    console_rx_throttled = true;
+                    console_rx_throttles++;
+                    break;
+#else
+                    uint8_t dropped;
+
+                    (void)cyhal_uart_getc(&cy_retarget_io_uart_obj, &dropped, 1);
+                    console_rx_overruns++;
+                    continue;
+#endif /* CONSOLE_FLOW_CONTROL */
                 }
-                break;
-            case DEM_IO_CANFD:
-                if(demoIndex != (DEM_IO_CANFD & 0x0F))
+                (void)cyhal_uart_getc(&cy_retarget_io_uart_obj,
+                                      &console_rx_buffer[console_rx_head % CONSOLE_RX_BUFFER_SIZE], 1);
+                console_rx_head++;
+                if ((used + 1u) > console_rx_high_water)
                 {
-                    /* Set demoIndex */
-                    demoIndex = DEM_IO_CANFD & 0x0F;
-                    /* Change demo switch flag */
-                    evtSwitch = true;
+                    console_rx_high_water = used + 1u;
                 }
-                break;
-            default:
-                break;
+            }
+            else
+            {
+                /* Get input command */
+                cyhal_uart_getc(&cy_retarget_io_uart_obj, &recCmd, 1);
+                console_rx_bytes++;
+                console_key_rx(recCmd);
+                continue;
+            }
+            console_rx_bytes++;
+        }
+        if (console_raw)
+        {
+            event_flags_set(&demo_events, EVT_CONSOLE_KEY);
         }
     }
+    if ((event & CYHAL_UART_IRQ_RX_ERROR) == CYHAL_UART_IRQ_RX_ERROR)
+    {
+        /* Frame, parity or RX FIFO overflow error */
+        console_rx_errors++;
+    }
+    PROFILER_ZONE_END(uart_event_handler);
+    io_client_load_end(start);
+}
+
+/*******************************************************************************
+* Function Name: console_key_rx
+********************************************************************************
+* Summary:
+*  Handles a received key: the line editor takes it while active, otherwise
+*  the keys '1' to '9' select a demo. Every key posts EVT_CONSOLE_KEY.
+*
+* Parameters:
+*  key: received character
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static PLACE_ITCM void console_key_rx(uint8_t key)
+{
+    bool line_key;
+
+    line_key = console_line_rx(key);
+    event_flags_set(&demo_events, EVT_CONSOLE_KEY);
+
+    /* Distinguish command, unless the line editor took the key */
+    switch(line_key ? CMD_DEFAULT : key)
+    {
+        case DEM_HELLO_WORD:
+            if(demoIndex != (DEM_HELLO_WORD & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_HELLO_WORD & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        case DEM_PWM_WAVE:
+            if(demoIndex != (DEM_PWM_WAVE & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_PWM_WAVE & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        case DEM_IO_INTR:
+            if(demoIndex != (DEM_IO_INTR & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_IO_INTR & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        case DEM_IO_ADC:
+            if(demoIndex != (DEM_IO_ADC & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_IO_ADC & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        case DEM_IO_POWER:
+            if(demoIndex != (DEM_IO_POWER & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_IO_POWER & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        case DEM_IO_QSPI:
+            if(demoIndex != (DEM_IO_QSPI & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_IO_QSPI & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        case DEM_IO_CANFD:
+            if(demoIndex != (DEM_IO_CANFD & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_IO_CANFD & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        case DEM_IPC_OFFLOAD:
+            if(demoIndex != (DEM_IPC_OFFLOAD & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_IPC_OFFLOAD & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        case DEM_PARAM_CONSOLE:
+            if(demoIndex != (DEM_PARAM_CONSOLE & 0x0F))
+            {
+                /* Set demoIndex */
+                demoIndex = DEM_PARAM_CONSOLE & 0x0F;
+                /* Post the demo switch event */
+                event_flags_set(&demo_events, EVT_DEMO_SWITCH);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_line_begin
+********************************************************************************
+* Summary:
+*  Starts the line editor with an empty line. Until console_line_end(), the
+*  keys, digits included, go to the line and no longer select demos.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_line_begin(void)
+{
+    console_line_done = false;
+    console_line_length = 0u;
+    console_line_echoed = 0u;
+    console_line_active = true;
+}
+
+/*******************************************************************************
+* Function Name: console_line_end
+********************************************************************************
+* Summary:
+*  Stops the line editor, the keys select demos again.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_line_end(void)
+{
+    console_line_active = false;
+}
+
+/*******************************************************************************
+* Function Name: console_line_rx
+********************************************************************************
+* Summary:
+*  Adds a key to the line. Called by the console interrupt handlers. Enter
+*  completes the line, Backspace and Delete erase the last character and
+*  Escape clears the line. Keys are dropped while a completed line waits.
+*
+* Parameters:
+*  key: received character
+*
+* Return:
+*  bool: true if the line editor took the key
+*
+*******************************************************************************/
+bool console_line_rx(uint8_t key)
+{
+    uint32_t length = console_line_length;
+
+    if (!console_line_active)
+    {
+        return false;
+    }
+    if (console_line_done)
+    {
+        return true;
+    }
+
+    if (('\r' == key) || ('\n' == key))
+    {
+        console_line[length] = '\0';
+        console_line_done = true;
+    }
+    else if (('\b' == key) || (0x7F == key))
+    {
+        console_line_length = (0u != length) ? (length - 1u) : 0u;
+    }
+    else if (0x1B == key)
+    {
+        console_line_length = 0u;
+    }
+    else if ((key >= 0x20) && (key < 0x7F) && (length < (CONSOLE_LINE_SIZE - 1u)))
+    {
+        console_line[length] = (char)key;
+        console_line_length = length + 1u;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: console_line_poll
+********************************************************************************
+* Summary:
+*  Echoes the changes of the line since the last call and returns the line
+*  once Enter was received. Called by the demo loop on EVT_CONSOLE_KEY.
+*
+* Parameters:
+*  line: receives the completed line
+*  size: size of line
+*
+* Return:
+*  bool: true if line holds a completed line
+*
+*******************************************************************************/
+bool console_line_poll(char *line, uint32_t size)
+{
+    uint32_t length = console_line_length;
+
+    while (console_line_echoed > length)
+    {
+        printf("\b \b");
+        console_line_echoed--;
+    }
+    if (console_line_echoed < length)
+    {
+        printf("%.*s", (int)(length - console_line_echoed), &console_line[console_line_echoed]);
+        console_line_echoed = length;
+    }
+
+    if (!console_line_done)
+    {
+        (void)fflush(stdout);
+        return false;
+    }
+
+    printf("\r\n");
+    (void)snprintf(line, size, "%s", console_line);
+    console_line_length = 0u;
+    console_line_echoed = 0u;
+    console_line_done = false;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: console_raw_begin
+********************************************************************************
+* Summary:
+*  Starts the raw mode: the received characters go to the software RX
+*  buffer, read with console_raw_read(), instead of the key handling.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_raw_begin(void)
+{
+    console_rx_tail = console_rx_head;
+    console_raw = true;
+}
+
+/*******************************************************************************
+* Function Name: console_raw_end
+********************************************************************************
+* Summary:
+*  Ends the raw mode. Characters left in the software RX buffer are
+*  discarded.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_raw_end(void)
+{
+    console_raw = false;
+    console_rx_tail = console_rx_head;
+    if (console_rx_throttled)
+    {
+        console_rx_throttled = false;
+        cyhal_uart_enable_event(&cy_retarget_io_uart_obj, CYHAL_UART_IRQ_RX_NOT_EMPTY, INT_PRIORITY, true);
+    }
+}
+
+/*******************************************************************************
+* Function Name: console_raw_read
+********************************************************************************
+* Summary:
+*  Takes characters out of the software RX buffer without waiting. Reading
+*  resumes the RX interrupt once half of the buffer is free again.
+*
+* Parameters:
+*  data: receives the characters
+*  size: size of data
+*
+* Return:
+*  uint32_t: number of characters read
+*
+*******************************************************************************/
+uint32_t console_raw_read(uint8_t *data, uint32_t size)
+{
+    uint32_t count = 0u;
+    uint32_t tail = console_rx_tail;
+
+    while ((count < size) && (tail != console_rx_head))
+    {
+        data[count++] = console_rx_buffer[tail % CONSOLE_RX_BUFFER_SIZE];
+        tail++;
+    }
+    console_rx_tail = tail;
+
+    if (console_rx_throttled && ((console_rx_head - tail) <= (CONSOLE_RX_BUFFER_SIZE / 2u)))
+    {
+        console_rx_throttled = false;
+        cyhal_uart_enable_event(&cy_retarget_io_uart_obj, CYHAL_UART_IRQ_RX_NOT_EMPTY, INT_PRIORITY, true);
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: console_set_baud
+********************************************************************************
+* Summary:
+*  Switches the debug UART to another baud rate at once; characters still in
+*  the TX FIFO are garbled. With IO_COPROCESSOR=1 the UART belongs to CM0+
+*  and the rate cannot be changed.
+*
+* Parameters:
+*  baud: requested rate
+*
+* Return:
+*  uint32_t: rate achieved by the clock divider, 0 if not supported
+*
+*******************************************************************************/
+uint32_t console_set_baud(uint32_t baud)
+{
+    uint32_t actual = 0u;
+
+#if !IO_COPROCESSOR
+    if (CY_RSLT_SUCCESS == cyhal_uart_set_baud(&cy_retarget_io_uart_obj, baud, &actual))
+    {
+        console_baud_rate = actual;
+    }
+    else
+    {
+        actual = 0u;
+    }
+#else
+    (void)baud;
+#endif /* !IO_COPROCESSOR */
+
+    return actual;
+}
+
+/*******************************************************************************
+* Function Name: console_get_stats
+********************************************************************************
+* Summary:
+*  Returns the rate and the receive counters of the debug UART since reset.
+*
+* Parameters:
+*  stats: receives the statistics
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_get_stats(console_stats_t *stats)
+{
+    stats->baud = console_baud_rate;
+    stats->rx_bytes = console_rx_bytes;
+    stats->rx_errors = console_rx_errors;
+    stats->rx_overruns = console_rx_overruns;
+    stats->rx_throttles = console_rx_throttles;
+    stats->rx_high_water = console_rx_high_water;
+    stats->flow_control = (0 != CONSOLE_FLOW_CONTROL);
+}
+
+/*******************************************************************************
+* Function Name: console_printf
+********************************************************************************
+* Summary:
+*  printf() of the console hot paths, through the integer-only formatter
+*  (console_fmt.h) instead of the formatted I/O of the C library. The output
+*  is formatted into a stack buffer of CONSOLE_PRINT_CHUNK characters and
+*  sent to the debug UART, or to the console ring of CM0+, each time it
+*  fills.
+*
+* Parameters:
+*  format: format string, without floating-point conversions
+*  ...: arguments
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_printf(const char *format, ...)
+{
+    char buffer[CONSOLE_PRINT_CHUNK];
+    va_list args;
+
+    va_start(args, format);
+    (void)console_fmt_vformat(console_print_sink, NULL, buffer, sizeof(buffer), format, args);
+    va_end(args);
+}
+
+/*******************************************************************************
+* Function Name: console_hex_dump
+********************************************************************************
+* Summary:
+*  Prints bytes as "0x%02X " each, with a line end after every per_line
+*  bytes, without a format string to interpret.
+*
+* Parameters:
+*  data: bytes
+*  count: number of bytes
+*  per_line: bytes per line
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void console_hex_dump(const uint8_t *data, uint32_t count, uint32_t per_line)
+{
+    char buffer[CONSOLE_PRINT_CHUNK];
+    uint32_t length = 0u;
+
+    for (uint32_t index = 0u; index < count; index++)
+    {
+        /* Room for one byte and a line end */
+        if ((length + 7u) > sizeof(buffer))
+        {
+            io_client_write(buffer, length);
+            length = 0u;
+        }
+        buffer[length++] = '0';
+        buffer[length++] = 'x';
+        length += console_fmt_hex(&buffer[length], data[index], 2u, true);
+        buffer[length++] = ' ';
+        if (0u == ((index + 1u) % per_line))
+        {
+            buffer[length++] = '\r';
+            buffer[length++] = '\n';
+        }
+    }
+    io_client_write(buffer, length);
+}
+
+/*******************************************************************************
+* Function Name: console_print_sink
+********************************************************************************
+* Summary:
+*  Sink of the console formatter: writes each full buffer, and the rest at the
+*  end, to the console through the I/O client.
+*
+* Parameters:
+*  arg: unused
+*  text: characters, not terminated
+*  length: number of characters
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void console_print_sink(void *arg, const char *text, uint32_t length)
+{
+    (void)arg;
+    io_client_write(text, length);
 }
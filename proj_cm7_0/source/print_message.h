@@ -59,12 +59,52 @@
 #define INT_PRIORITY    3
 #define TX_BUF_SIZE     100
 
+/* Longest line of the console line editor, terminator included */
+#define CONSOLE_LINE_SIZE   64u
+
+/* Stack buffer of console_printf(), sent each time it fills */
+#define CONSOLE_PRINT_CHUNK     64u
+
+/* Software RX buffer of the raw mode, a power of two */
+#define CONSOLE_RX_BUFFER_SIZE  512u
+
+/* RTS/CTS flow control of the debug UART, set by the CONSOLE_FLOW_CONTROL
+ * make variable */
+#ifndef CONSOLE_FLOW_CONTROL
+#define CONSOLE_FLOW_CONTROL    (0)
+#endif
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t baud;                  /* Rate achieved by the clock divider */
+    uint32_t rx_bytes;              /* Characters received */
+    uint32_t rx_errors;             /* Frame, parity and RX FIFO overflow errors */
+    uint32_t rx_overruns;           /* Dropped, software RX buffer full */
+    uint32_t rx_throttles;          /* RX paused, software RX buffer full */
+    uint32_t rx_high_water;         /* Highest fill of the software RX buffer */
+    bool     flow_control;
+} console_stats_t;
+
 
 /*******************************************************************************
 * External Functions
 *******************************************************************************/
 extern void uart_port_initial(void);
 extern void uart_event_handler(void* handler_arg, cyhal_uart_event_t event);
+extern void console_line_begin(void);
+extern void console_line_end(void);
+extern bool console_line_rx(uint8_t key);
+extern bool console_line_poll(char *line, uint32_t size);
+extern void console_raw_begin(void);
+extern void console_raw_end(void);
+extern uint32_t console_raw_read(uint8_t *data, uint32_t size);
+extern uint32_t console_set_baud(uint32_t baud);
+extern void console_get_stats(console_stats_t *stats);
+extern void console_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+extern void console_hex_dump(const uint8_t *data, uint32_t count, uint32_t per_line);
 
 /*******************************************************************************
 * External Variables
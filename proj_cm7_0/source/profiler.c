@@ -0,0 +1,289 @@
+/*******************************************************************************
+* File Name:   profiler.c
+*
+* Description: Execution time profiler of CM7_0. Zones and counters register
+*              themselves on first use; the report lists the zones by total
+*              time, the hot spots first, followed by the counters.
+*
+*              On the device the time base is the DWT cycle counter. The host
+*              simulation uses clock_gettime() scaled to SystemCoreClock, so
+*              the report reads the same on Linux.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#if !defined(__arm__)
+#include <time.h>
+#endif
+#include "profiler.h"
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static profiler_zone_t *profiler_zones = NULL;
+static profiler_counter_t *profiler_counters = NULL;
+
+
+/*******************************************************************************
+* Function Name: profiler_init
+********************************************************************************
+* Summary:
+*  Starts the DWT cycle counter, also used by the IPC offload benchmark and
+*  the interrupt load measurement. Call once at startup, before any zone.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void profiler_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55u;
+    DWT->CYCCNT = 0u;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+* Function Name: profiler_cycles
+********************************************************************************
+* Summary:
+*  Returns the profiler time base.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: CPU cycles, wrapping
+*
+*******************************************************************************/
+uint32_t profiler_cycles(void)
+{
+#if defined(__arm__)
+    return DWT->CYCCNT;
+#else
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec) *
+                      (SystemCoreClock / 1000000u) / 1000u);
+#endif /* defined(__arm__) */
+}
+
+/*******************************************************************************
+* Function Name: profiler_zone_add
+********************************************************************************
+* Summary:
+*  Records one execution of a zone. Safe from interrupts.
+*
+* Parameters:
+*  zone: zone
+*  cycles: duration of the execution
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void profiler_zone_add(profiler_zone_t *zone, uint32_t cycles)
+{
+    uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+
+    if (!zone->registered)
+    {
+        zone->registered = true;
+        zone->next = profiler_zones;
+        profiler_zones = zone;
+    }
+    zone->count++;
+    zone->total += cycles;
+    if (cycles < zone->min)
+    {
+        zone->min = cycles;
+    }
+    if (cycles > zone->max)
+    {
+        zone->max = cycles;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_status);
+}
+
+/*******************************************************************************
+* Function Name: profiler_counter_add
+********************************************************************************
+* Summary:
+*  Adds to a counter. Safe from interrupts.
+*
+* Parameters:
+*  counter: counter
+*  n: amount to add
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void profiler_counter_add(profiler_counter_t *counter, uint32_t n)
+{
+    uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+
+    if (!counter->registered)
+    {
+        counter->registered = true;
+        counter->next = profiler_counters;
+        profiler_counters = counter;
+    }
+    counter->value += n;
+    Cy_SysLib_ExitCriticalSection(intr_status);
+}
+
+/*******************************************************************************
+* Function Name: profiler_reset
+********************************************************************************
+* Summary:
+*  Clears the zones and counters. They stay registered.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void profiler_reset(void)
+{
+    uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+
+    for (profiler_zone_t *zone = profiler_zones; NULL != zone; zone = zone->next)
+    {
+        zone->count = 0u;
+        zone->min = UINT32_MAX;
+        zone->max = 0u;
+        zone->total = 0u;
+    }
+    for (profiler_counter_t *counter = profiler_counters; NULL != counter; counter = counter->next)
+    {
+        counter->value = 0u;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_status);
+}
+
+/*******************************************************************************
+* Function Name: profiler_print_report
+********************************************************************************
+* Summary:
+*  Prints the zones sorted by total time, with their share of the total of
+*  all zones, then the counters. The values are copied in a critical section
+*  and printed outside of it, into static copies rather than about 1.8 KB of
+*  stack: call it from thread mode only.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void profiler_print_report(void)
+{
+#if PROFILER
+    static profiler_zone_t zones[PROFILER_MAX_ENTRIES];
+    static profiler_counter_t counters[PROFILER_MAX_ENTRIES];
+    uint32_t zone_num = 0u;
+    uint32_t counter_num = 0u;
+    uint64_t grand_total = 0u;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+    uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+
+    for (profiler_zone_t *zone = profiler_zones; (NULL != zone) && (zone_num < PROFILER_MAX_ENTRIES);
+         zone = zone->next)
+    {
+        zones[zone_num++] = *zone;
+    }
+    for (profiler_counter_t *counter = profiler_counters;
+         (NULL != counter) && (counter_num < PROFILER_MAX_ENTRIES); counter = counter->next)
+    {
+        counters[counter_num++] = *counter;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_status);
+
+    /* Insertion sort by decreasing total, the hot spots first */
+    for (uint32_t index = 1u; index < zone_num; index++)
+    {
+        profiler_zone_t zone = zones[index];
+        uint32_t slot = index;
+
+        while ((slot > 0u) && (zones[slot - 1u].total < zone.total))
+        {
+            zones[slot] = zones[slot - 1u];
+            slot--;
+        }
+        zones[slot] = zone;
+    }
+    for (uint32_t index = 0u; index < zone_num; index++)
+    {
+        grand_total += zones[index].total;
+    }
+
+    printf("Hot spots (CPU cycles at %lu MHz)\r\n", (unsigned long)cycles_per_us);
+    printf("%-28s %8s %8s %8s %8s %10s %6s\r\n",
+           "zone", "count", "min", "avg", "max", "total_us", "share");
+    for (uint32_t index = 0u; index < zone_num; index++)
+    {
+        const profiler_zone_t *zone = &zones[index];
+
+        if (0u == zone->count)
+        {
+            continue;
+        }
+        printf("%-28s %8lu %8lu %8lu %8lu %10lu %5lu%%\r\n", zone->name,
+               (unsigned long)zone->count, (unsigned long)zone->min,
+               (unsigned long)(zone->total / zone->count), (unsigned long)zone->max,
+               (unsigned long)(zone->total / cycles_per_us),
+               (unsigned long)((0u != grand_total) ? ((zone->total * 100u) / grand_total) : 0u));
+    }
+    for (uint32_t index = 0u; index < counter_num; index++)
+    {
+        printf("%-28s %8lu\r\n", counters[index].name, (unsigned long)counters[index].value);
+    }
+#else
+    printf("Profiler disabled, build with PROFILER=1\r\n");
+#endif /* PROFILER */
+}
+
+/* [] END OF FILE */
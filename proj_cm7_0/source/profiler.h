@@ -0,0 +1,128 @@
+/******************************************************************************
+* File Name:   profiler.h
+*
+* Description: Execution time profiler of CM7_0, based on the DWT cycle
+*              counter. Zones measure the cycles spent between two points and
+*              keep their count, minimum, maximum and total; counters count
+*              events or bytes. All the macros compile to nothing with
+*              PROFILER=0.
+*
+*              Usage:
+*                PROFILER_ZONE_DEFINE(my_isr);          at file scope
+*                PROFILER_ZONE_BEGIN(my_isr);           in the function
+*                ...
+*                PROFILER_ZONE_END(my_isr);
+*              or, for a block:
+*                PROFILER_SCOPE(my_isr) { ... }
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Profiler build switch, set by the PROFILER make variable */
+#ifndef PROFILER
+#define PROFILER                    (1)
+#endif
+
+/* Number of zones and counters shown in the report */
+#define PROFILER_MAX_ENTRIES        (32u)
+
+#if PROFILER
+#define PROFILER_ZONE_DEFINE(zone)  \
+    static profiler_zone_t profiler_zone_##zone = { #zone, 0u, UINT32_MAX, 0u, 0u, NULL, false }
+#define PROFILER_ZONE_BEGIN(zone)   uint32_t profiler_start_##zone = profiler_cycles()
+#define PROFILER_ZONE_END(zone)     \
+    profiler_zone_add(&profiler_zone_##zone, profiler_cycles() - profiler_start_##zone)
+/* Measures the statement or block that follows. Leaving it with return or
+ * break skips the measurement. */
+#define PROFILER_SCOPE(zone)        \
+    for (uint32_t profiler_scope_start = profiler_cycles(), profiler_scope_once = 1u; \
+         0u != profiler_scope_once; \
+         profiler_zone_add(&profiler_zone_##zone, profiler_cycles() - profiler_scope_start), \
+         profiler_scope_once = 0u)
+
+#define PROFILER_COUNTER_DEFINE(counter) \
+    static profiler_counter_t profiler_counter_##counter = { #counter, 0u, NULL, false }
+#define PROFILER_COUNT(counter, n)  profiler_counter_add(&profiler_counter_##counter, (uint32_t)(n))
+#else
+#define PROFILER_ZONE_DEFINE(zone)  extern profiler_zone_t profiler_zone_##zone
+#define PROFILER_ZONE_BEGIN(zone)   do { } while (0)
+#define PROFILER_ZONE_END(zone)     do { } while (0)
+#define PROFILER_SCOPE(zone)
+#define PROFILER_COUNTER_DEFINE(counter) extern profiler_counter_t profiler_counter_##counter
+#define PROFILER_COUNT(counter, n)  do { } while (0)
+#endif /* PROFILER */
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Execution time of one code section, in CPU cycles */
+typedef struct profiler_zone
+{
+    const char           *name;
+    uint32_t              count;
+    uint32_t              min;
+    uint32_t              max;
+    uint64_t              total;
+    struct profiler_zone *next;         /* Registered zones */
+    bool                  registered;
+} profiler_zone_t;
+
+/* Event or byte counter */
+typedef struct profiler_counter
+{
+    const char              *name;
+    uint32_t                 value;
+    struct profiler_counter *next;      /* Registered counters */
+    bool                     registered;
+} profiler_counter_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void profiler_init(void);
+extern uint32_t profiler_cycles(void);
+extern void profiler_zone_add(profiler_zone_t *zone, uint32_t cycles);
+extern void profiler_counter_add(profiler_counter_t *counter, uint32_t n);
+extern void profiler_reset(void);
+extern void profiler_print_report(void);
+
+#endif
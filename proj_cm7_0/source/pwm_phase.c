@@ -0,0 +1,169 @@
+/******************************************************************************
+* File Name:   pwm_phase.c
+*
+* Description: Timing of a trigger at a fixed phase of a PWM period. The PWM
+*              counter counts up from 0 to its period register and wraps; the
+*              trigger fires when it equals the compare register, so the
+*              phase resolution is one counter clock.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "pwm_phase.h"
+
+
+/*******************************************************************************
+* Function Name: pwm_phase_init
+********************************************************************************
+* Summary:
+*  Computes the period register for the PWM frequency closest to the one
+*  requested and the compare register of the trigger phase.
+*
+* Parameters:
+*  timing: receives the registers
+*  clock_hz: counter clock
+*  frequency_hz: PWM frequency
+*  phase: trigger phase, 0 to PWM_PHASE_FULL - 1
+*
+* Return:
+*  bool: false if the counter cannot run at the frequency with at least two
+*  counts per period, or the phase is out of range
+*
+*******************************************************************************/
+bool pwm_phase_init(pwm_phase_t *timing, uint32_t clock_hz, uint32_t frequency_hz, uint32_t phase)
+{
+    uint64_t counts;
+
+    if ((0u == frequency_hz) || (phase >= PWM_PHASE_FULL))
+    {
+        return false;
+    }
+    counts = ((uint64_t)clock_hz + (frequency_hz / 2u)) / frequency_hz;
+    if ((counts < 2u) || (counts > 0xFFFFFFFFu))
+    {
+        return false;
+    }
+
+    timing->clock_hz = clock_hz;
+    timing->period = (uint32_t)(counts - 1u);
+    timing->compare = pwm_phase_compare(timing->period, phase);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: pwm_phase_compare
+********************************************************************************
+* Summary:
+*  Returns the compare register nearest to a phase. A phase that rounds to
+*  the end of the period wraps to the match at 0.
+*
+* Parameters:
+*  period: period register
+*  phase: trigger phase, 0 to PWM_PHASE_FULL - 1
+*
+* Return:
+*  uint32_t: compare register, 0 to period
+*
+*******************************************************************************/
+uint32_t pwm_phase_compare(uint32_t period, uint32_t phase)
+{
+    uint64_t counts = (uint64_t)period + 1u;
+    uint64_t compare = ((counts * phase) + (PWM_PHASE_FULL / 2u)) / PWM_PHASE_FULL;
+
+    return (compare < counts) ? (uint32_t)compare : 0u;
+}
+
+/*******************************************************************************
+* Function Name: pwm_phase_actual
+********************************************************************************
+* Summary:
+*  Returns the phase the compare register achieves, rounded. It differs from
+*  the requested phase by up to half a counter clock.
+*
+* Parameters:
+*  timing: registers of the PWM
+*
+* Return:
+*  uint32_t: phase, PWM_PHASE_FULL for a full period
+*
+*******************************************************************************/
+uint32_t pwm_phase_actual(const pwm_phase_t *timing)
+{
+    uint64_t counts = (uint64_t)timing->period + 1u;
+
+    return (uint32_t)((((uint64_t)timing->compare * PWM_PHASE_FULL) + (counts / 2u)) / counts);
+}
+
+/*******************************************************************************
+* Function Name: pwm_phase_frequency
+********************************************************************************
+* Summary:
+*  Returns the PWM frequency the period register achieves, rounded.
+*
+* Parameters:
+*  timing: registers of the PWM
+*
+* Return:
+*  uint32_t: frequency in Hz
+*
+*******************************************************************************/
+uint32_t pwm_phase_frequency(const pwm_phase_t *timing)
+{
+    uint64_t counts = (uint64_t)timing->period + 1u;
+
+    return (uint32_t)(((uint64_t)timing->clock_hz + (counts / 2u)) / counts);
+}
+
+/*******************************************************************************
+* Function Name: pwm_phase_counts_to_ns
+********************************************************************************
+* Summary:
+*  Converts counter clocks to nanoseconds, rounded.
+*
+* Parameters:
+*  timing: registers of the PWM
+*  counts: counter clocks, less than 4.29 s worth of them
+*
+* Return:
+*  uint32_t: time in nanoseconds
+*
+*******************************************************************************/
+uint32_t pwm_phase_counts_to_ns(const pwm_phase_t *timing, uint32_t counts)
+{
+    return (uint32_t)((((uint64_t)counts * 1000000000u) + (timing->clock_hz / 2u)) / timing->clock_hz);
+}
+
+
+/* [] END OF FILE */
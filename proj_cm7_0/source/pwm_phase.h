@@ -0,0 +1,104 @@
+/******************************************************************************
+* File Name:   pwm_phase.h
+*
+* Description: Timing of a trigger at a fixed phase of a PWM period: the
+*              period and compare registers of a TCPWM counter for a PWM
+*              frequency and a trigger phase, the phase they achieve and the
+*              delay of an event after the trigger. Only depends on the C
+*              library, so that the host can check the arithmetic.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _PWM_PHASE_H_
+#define _PWM_PHASE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Phases are fractions of the PWM period in units of 1/65536 */
+#define PWM_PHASE_FULL              (65536u)
+
+/* Phase in 1/65536 of the period from tenths of a percent, rounded */
+#define PWM_PHASE_FROM_PERMILLE(permille) \
+    ((uint32_t)((((uint64_t)(permille) * PWM_PHASE_FULL) + 500u) / 1000u))
+
+/* Phase in tenths of a percent, rounded */
+#define PWM_PHASE_TO_PERMILLE(phase) \
+    ((uint32_t)((((uint64_t)(phase) * 1000u) + (PWM_PHASE_FULL / 2u)) / PWM_PHASE_FULL))
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t clock_hz;                      /* Counter clock */
+    uint32_t period;                        /* Period register, period + 1 counts */
+    uint32_t compare;                       /* Compare register of the trigger */
+} pwm_phase_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern bool pwm_phase_init(pwm_phase_t *timing, uint32_t clock_hz, uint32_t frequency_hz, uint32_t phase);
+extern uint32_t pwm_phase_compare(uint32_t period, uint32_t phase);
+extern uint32_t pwm_phase_actual(const pwm_phase_t *timing);
+extern uint32_t pwm_phase_frequency(const pwm_phase_t *timing);
+extern uint32_t pwm_phase_counts_to_ns(const pwm_phase_t *timing, uint32_t counts);
+
+/*******************************************************************************
+* Function Name: pwm_phase_delay
+********************************************************************************
+* Summary:
+*  Counts from the last trigger to a counter value, across the wrap of the
+*  period. Inline, because interrupt handlers call it on every trigger.
+*
+* Parameters:
+*  timing: period and compare registers
+*  counter: counter value read after the trigger
+*
+* Return:
+*  uint32_t: counts, 0 to period
+*
+*******************************************************************************/
+static inline uint32_t pwm_phase_delay(const pwm_phase_t *timing, uint32_t counter)
+{
+    return (counter >= timing->compare) ? (counter - timing->compare)
+                                        : ((counter + timing->period + 1u) - timing->compare);
+}
+
+#endif
@@ -0,0 +1,558 @@
+/*******************************************************************************
+* File Name:   resource_manager.c
+*
+* Description: Peripheral resource manager. The demos acquire their LEDs,
+*              buttons, PWM outputs and the QSPI memory here instead of
+*              initializing and freeing them through the HAL on every demo
+*              switch. A released handle stays initialized: its events are
+*              disabled and a GPIO is parked as high-impedance input, so it
+*              looks freed to the board. The next acquisition of the same kind
+*              reconfigures it, which is much cheaper than a new HAL init.
+*              A handle of another kind on the same pin is freed first.
+*
+*              Each handle has one owner at a time. An acquisition by another
+*              owner is refused and reported, instead of failing later in the
+*              HAL with an init error.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "cy_serial_flash_qspi.h"
+#include "resource_manager.h"
+#include "profiler.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Cycles to microseconds */
+#define RESOURCE_MANAGER_US(cycles)     ((cycles) / (SystemCoreClock / 1000000u))
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    RESOURCE_NONE = 0u,
+    RESOURCE_GPIO,
+    RESOURCE_PWM,
+    RESOURCE_QSPI,
+} resource_type_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    resource_type_t         type;           /* RESOURCE_NONE if the entry is unused */
+    cyhal_gpio_t            pin;            /* GPIO or PWM pin, slave select of the QSPI */
+    const char             *owner;          /* NULL while the handle is idle */
+    uint32_t                refs;           /* Acquisitions of the owner */
+    cyhal_gpio_direction_t  direction;      /* GPIO configuration */
+    cyhal_gpio_drive_mode_t drive_mode;
+    cyhal_pwm_t             pwm;            /* PWM handle */
+    const cy_stc_smif_mem_config_t *mem_config; /* QSPI configuration */
+    uint32_t                hz;
+    uint32_t                init_cycles;    /* Cost of the last HAL initialization */
+} resource_entry_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static resource_entry_t resource_entry[RESOURCE_MANAGER_ENTRIES];
+
+/* Counts since the last switch report */
+static resource_manager_stats_t resource_stats;
+
+
+/*******************************************************************************
+* Function Name: resource_find
+********************************************************************************
+* Summary:
+*  Returns the entry of a pin, or a free entry.
+*
+* Parameters:
+*  pin: GPIO, PWM pin or QSPI slave select
+*
+* Return:
+*  resource_entry_t*: entry of the pin, a free entry, or NULL if the table is full
+*
+*******************************************************************************/
+static resource_entry_t *resource_find(cyhal_gpio_t pin)
+{
+    resource_entry_t *free_entry = NULL;
+
+    for (uint32_t index = 0u; index < RESOURCE_MANAGER_ENTRIES; index++)
+    {
+        resource_entry_t *entry = &resource_entry[index];
+
+        if ((RESOURCE_NONE != entry->type) && (entry->pin == pin))
+        {
+            return entry;
+        }
+        if ((RESOURCE_NONE == entry->type) && (NULL == free_entry))
+        {
+            free_entry = entry;
+        }
+    }
+
+    return free_entry;
+}
+
+/*******************************************************************************
+* Function Name: resource_claim
+********************************************************************************
+* Summary:
+*  Checks the ownership of an entry and takes it for the owner. A held entry
+*  can only be acquired again by its owner and as the same kind of resource.
+*
+* Parameters:
+*  entry: entry of the resource
+*  type: kind of resource requested
+*  owner: name of the acquiring demo or module
+*
+* Return:
+*  bool: true if the owner may use the entry
+*
+*******************************************************************************/
+static bool resource_claim(resource_entry_t *entry, resource_type_t type, const char *owner)
+{
+    if ((NULL != entry->owner) && ((entry->type != type) || (0 != strcmp(entry->owner, owner))))
+    {
+        resource_stats.conflicts++;
+        printf("Resource conflict: P%u_%u is held by %s, requested by %s\r\n",
+               (unsigned int)CYHAL_GET_PORT(entry->pin), (unsigned int)CYHAL_GET_PIN(entry->pin),
+               entry->owner, owner);
+        return false;
+    }
+
+    entry->owner = owner;
+    entry->refs++;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: resource_drop
+********************************************************************************
+* Summary:
+*  Frees the HAL handle of an idle entry, so the pin can be used as another
+*  kind of resource.
+*
+* Parameters:
+*  entry: idle entry
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void resource_drop(resource_entry_t *entry)
+{
+    switch (entry->type)
+    {
+        case RESOURCE_GPIO:
+            cyhal_gpio_free(entry->pin);
+            break;
+
+        case RESOURCE_PWM:
+            cyhal_pwm_free(&entry->pwm);
+            break;
+
+        case RESOURCE_QSPI:
+            cy_serial_flash_qspi_deinit();
+            break;
+
+        default:
+            break;
+    }
+    entry->type = RESOURCE_NONE;
+}
+
+/*******************************************************************************
+* Function Name: resource_account
+********************************************************************************
+* Summary:
+*  Records the cost of an acquisition. A HAL initialization sets the cost a
+*  later reuse of the entry is compared with.
+*
+* Parameters:
+*  entry: acquired entry
+*  cycles: CPU cycles spent in the acquisition
+*  reused: true if the cached handle was reconfigured
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void resource_account(resource_entry_t *entry, uint32_t cycles, bool reused)
+{
+    if (reused)
+    {
+        resource_stats.reuses++;
+        if (entry->init_cycles > cycles)
+        {
+            resource_stats.saved_cycles += entry->init_cycles - cycles;
+        }
+    }
+    else
+    {
+        resource_stats.inits++;
+        entry->init_cycles = cycles;
+    }
+}
+
+/*******************************************************************************
+* Function Name: resource_manager_gpio_acquire
+********************************************************************************
+* Summary:
+*  Acquires a GPIO. A cached GPIO handle is reconfigured; otherwise the pin is
+*  initialized through the HAL.
+*
+* Parameters:
+*  pin: GPIO pin
+*  direction: direction
+*  drive_mode: drive mode
+*  init_val: initial output value
+*  owner: name of the acquiring demo or module
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, RESOURCE_MANAGER_RSLT_ERR_CONFLICT,
+*             RESOURCE_MANAGER_RSLT_ERR_FULL or the HAL error
+*
+*******************************************************************************/
+cy_rslt_t resource_manager_gpio_acquire(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                                        cyhal_gpio_drive_mode_t drive_mode, bool init_val,
+                                        const char *owner)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t start = profiler_cycles();
+    resource_entry_t *entry = resource_find(pin);
+    bool reused;
+
+    if (NULL == entry)
+    {
+        return RESOURCE_MANAGER_RSLT_ERR_FULL;
+    }
+    if (NULL != entry->owner)
+    {
+        return resource_claim(entry, RESOURCE_GPIO, owner) ? CY_RSLT_SUCCESS : RESOURCE_MANAGER_RSLT_ERR_CONFLICT;
+    }
+
+    reused = (RESOURCE_GPIO == entry->type);
+    if (reused)
+    {
+        /* Set the output level before the driver is enabled */
+        cyhal_gpio_write(pin, init_val);
+        result = cyhal_gpio_configure(pin, direction, drive_mode);
+    }
+    else
+    {
+        resource_drop(entry);
+        result = cyhal_gpio_init(pin, direction, drive_mode, init_val);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    entry->type = RESOURCE_GPIO;
+    entry->pin = pin;
+    entry->direction = direction;
+    entry->drive_mode = drive_mode;
+    (void)resource_claim(entry, RESOURCE_GPIO, owner);
+    resource_account(entry, profiler_cycles() - start, reused);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: resource_manager_gpio_release
+********************************************************************************
+* Summary:
+*  Releases a GPIO. After the last release of its owner the callback and the
+*  events are removed and the pin is parked as high-impedance input, as a
+*  freed pin would be, but the handle stays initialized.
+*
+* Parameters:
+*  pin: GPIO pin
+*  owner: name of the owner
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void resource_manager_gpio_release(cyhal_gpio_t pin, const char *owner)
+{
+    resource_entry_t *entry = resource_find(pin);
+
+    if ((NULL == entry) || (RESOURCE_GPIO != entry->type) || (NULL == entry->owner) ||
+        (0 != strcmp(entry->owner, owner)))
+    {
+        return;
+    }
+    if (0u != --entry->refs)
+    {
+        return;
+    }
+
+    cyhal_gpio_enable_event(pin, CYHAL_GPIO_IRQ_BOTH, CYHAL_ISR_PRIORITY_DEFAULT, false);
+    cyhal_gpio_register_callback(pin, NULL);
+    (void)cyhal_gpio_configure(pin, CYHAL_GPIO_DIR_INPUT, CYHAL_GPIO_DRIVE_ANALOG);
+    entry->owner = NULL;
+}
+
+/*******************************************************************************
+* Function Name: resource_manager_pwm_acquire
+********************************************************************************
+* Summary:
+*  Acquires a PWM output. A cached PWM of the pin is reused; its frequency and
+*  duty cycle are set by the caller as after a new init.
+*
+* Parameters:
+*  pwm: receives the PWM handle, owned by the manager. Left unchanged on
+*       failure.
+*  pin: PWM output pin
+*  owner: name of the acquiring demo or module
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, RESOURCE_MANAGER_RSLT_ERR_CONFLICT,
+*             RESOURCE_MANAGER_RSLT_ERR_FULL or the HAL error
+*
+*******************************************************************************/
+cy_rslt_t resource_manager_pwm_acquire(cyhal_pwm_t **pwm, cyhal_gpio_t pin, const char *owner)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t start = profiler_cycles();
+    resource_entry_t *entry = resource_find(pin);
+    bool reused;
+
+    if (NULL == entry)
+    {
+        return RESOURCE_MANAGER_RSLT_ERR_FULL;
+    }
+    if (NULL != entry->owner)
+    {
+        if (!resource_claim(entry, RESOURCE_PWM, owner))
+        {
+            return RESOURCE_MANAGER_RSLT_ERR_CONFLICT;
+        }
+        *pwm = &entry->pwm;
+        return CY_RSLT_SUCCESS;
+    }
+
+    reused = (RESOURCE_PWM == entry->type);
+    if (!reused)
+    {
+        resource_drop(entry);
+        result = cyhal_pwm_init(&entry->pwm, pin, NULL);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+    }
+
+    entry->type = RESOURCE_PWM;
+    entry->pin = pin;
+    (void)resource_claim(entry, RESOURCE_PWM, owner);
+    resource_account(entry, profiler_cycles() - start, reused);
+    *pwm = &entry->pwm;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: resource_manager_pwm_release
+********************************************************************************
+* Summary:
+*  Releases a PWM output. After the last release of its owner the PWM is
+*  stopped but stays initialized.
+*
+* Parameters:
+*  pin: PWM output pin
+*  owner: name of the owner
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void resource_manager_pwm_release(cyhal_gpio_t pin, const char *owner)
+{
+    resource_entry_t *entry = resource_find(pin);
+
+    if ((NULL == entry) || (RESOURCE_PWM != entry->type) || (NULL == entry->owner) ||
+        (0 != strcmp(entry->owner, owner)))
+    {
+        return;
+    }
+    if (0u != --entry->refs)
+    {
+        return;
+    }
+
+    (void)cyhal_pwm_stop(&entry->pwm);
+    entry->owner = NULL;
+}
+
+/*******************************************************************************
+* Function Name: resource_manager_qspi_acquire
+********************************************************************************
+* Summary:
+*  Acquires the serial flash on the QSPI pins of the kit. It is initialized
+*  again only if the memory configuration or the bus frequency changed.
+*
+* Parameters:
+*  mem_config: memory configuration
+*  hz: bus frequency
+*  owner: name of the acquiring demo or module
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, RESOURCE_MANAGER_RSLT_ERR_CONFLICT,
+*             RESOURCE_MANAGER_RSLT_ERR_FULL or the serial flash error
+*
+*******************************************************************************/
+cy_rslt_t resource_manager_qspi_acquire(const cy_stc_smif_mem_config_t *mem_config, uint32_t hz,
+                                        const char *owner)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t start = profiler_cycles();
+    resource_entry_t *entry = resource_find(CYBSP_QSPI_SS);
+    bool reused;
+
+    if (NULL == entry)
+    {
+        return RESOURCE_MANAGER_RSLT_ERR_FULL;
+    }
+    if (NULL != entry->owner)
+    {
+        return resource_claim(entry, RESOURCE_QSPI, owner) ? CY_RSLT_SUCCESS : RESOURCE_MANAGER_RSLT_ERR_CONFLICT;
+    }
+
+    reused = (RESOURCE_QSPI == entry->type) && (entry->mem_config == mem_config) && (entry->hz == hz);
+    if (!reused)
+    {
+        resource_drop(entry);
+        result = cy_serial_flash_qspi_init(mem_config,
+                CYBSP_QSPI_D0, CYBSP_QSPI_D1, CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC,
+                NC, NC, CYBSP_QSPI_SCK, CYBSP_QSPI_SS, hz);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+    }
+
+    entry->type = RESOURCE_QSPI;
+    entry->pin = CYBSP_QSPI_SS;
+    entry->mem_config = mem_config;
+    entry->hz = hz;
+    (void)resource_claim(entry, RESOURCE_QSPI, owner);
+    resource_account(entry, profiler_cycles() - start, reused);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: resource_manager_qspi_release
+********************************************************************************
+* Summary:
+*  Releases the serial flash. It stays initialized.
+*
+* Parameters:
+*  owner: name of the owner
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void resource_manager_qspi_release(const char *owner)
+{
+    resource_entry_t *entry = resource_find(CYBSP_QSPI_SS);
+
+    if ((NULL == entry) || (RESOURCE_QSPI != entry->type) || (NULL == entry->owner) ||
+        (0 != strcmp(entry->owner, owner)))
+    {
+        return;
+    }
+    if (0u == --entry->refs)
+    {
+        entry->owner = NULL;
+    }
+}
+
+/*******************************************************************************
+* Function Name: resource_manager_get_stats
+********************************************************************************
+* Summary:
+*  Returns the counts since the last switch report.
+*
+* Parameters:
+*  stats: receives the counts
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void resource_manager_get_stats(resource_manager_stats_t *stats)
+{
+    *stats = resource_stats;
+}
+
+/*******************************************************************************
+* Function Name: resource_manager_switch_report
+********************************************************************************
+* Summary:
+*  Prints the handles reused and initialized since the last report, which
+*  covers the exit of the previous demo and the entry of the one after it,
+*  and the time the reuses saved. Called on every demo switch.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void resource_manager_switch_report(void)
+{
+    if (0u != (resource_stats.inits + resource_stats.reuses + resource_stats.conflicts))
+    {
+        printf("Last demo switch: %lu handles reused, %lu initialized, %lu conflicts, %lu us saved\r\n\r\n",
+               (unsigned long)resource_stats.reuses, (unsigned long)resource_stats.inits,
+               (unsigned long)resource_stats.conflicts,
+               (unsigned long)RESOURCE_MANAGER_US(resource_stats.saved_cycles));
+    }
+    memset(&resource_stats, 0, sizeof(resource_stats));
+}
+
+/* [] END OF FILE */
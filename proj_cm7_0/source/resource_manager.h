@@ -0,0 +1,89 @@
+/******************************************************************************
+* File Name:   resource_manager.h
+*
+* Description: Peripheral resource manager. Keeps the HAL handles of the LEDs,
+*              buttons, PWM outputs and QSPI memory initialized across demo
+*              switches, reconfigures them on reuse and reports ownership
+*              conflicts.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _RESOURCE_MANAGER_H_
+#define _RESOURCE_MANAGER_H_
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cycfg_qspi_memslot.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of handles the manager keeps */
+#define RESOURCE_MANAGER_ENTRIES        (16u)
+
+/* The resource is held by another owner */
+#define RESOURCE_MANAGER_RSLT_ERR_CONFLICT  (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x13u))
+/* All entries are in use */
+#define RESOURCE_MANAGER_RSLT_ERR_FULL      (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x14u))
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Counts since the last resource_manager_switch_report() */
+typedef struct
+{
+    uint32_t inits;                 /* Handles initialized through the HAL */
+    uint32_t reuses;                /* Cached handles reconfigured instead */
+    uint32_t conflicts;             /* Acquisitions refused */
+    uint64_t saved_cycles;          /* Initialization time avoided by the reuses */
+} resource_manager_stats_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t resource_manager_gpio_acquire(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                                               cyhal_gpio_drive_mode_t drive_mode, bool init_val,
+                                               const char *owner);
+extern void resource_manager_gpio_release(cyhal_gpio_t pin, const char *owner);
+extern cy_rslt_t resource_manager_pwm_acquire(cyhal_pwm_t **pwm, cyhal_gpio_t pin, const char *owner);
+extern void resource_manager_pwm_release(cyhal_gpio_t pin, const char *owner);
+extern cy_rslt_t resource_manager_qspi_acquire(const cy_stc_smif_mem_config_t *mem_config, uint32_t hz,
+                                               const char *owner);
+extern void resource_manager_qspi_release(const char *owner);
+extern void resource_manager_get_stats(resource_manager_stats_t *stats);
+extern void resource_manager_switch_report(void);
+
+#endif
@@ -0,0 +1,264 @@
+/******************************************************************************
+* File Name:   scope_frame.c
+*
+* Description: Encoding and decoding of the binary frames of the oscilloscope
+*              capture.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stddef.h>
+#include "scope_frame.h"
+#include "crc32.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void scope_frame_put16(uint8_t *data, uint32_t value);
+static void scope_frame_put32(uint8_t *data, uint32_t value);
+static uint32_t scope_frame_get16(const uint8_t *data);
+static uint32_t scope_frame_get32(const uint8_t *data);
+
+
+/*******************************************************************************
+* Function Name: scope_frame_encode
+********************************************************************************
+* Summary:
+*  Builds the frame of a capture. Samples are truncated to 12 bits.
+*
+* Parameters:
+*  header: capture description, header->samples samples
+*  samples: samples, oldest first
+*  frame: receives the frame
+*  size: size of frame
+*
+* Return:
+*  uint32_t: frame length, 0 if there are too many samples for the frame
+*  format or for the buffer
+*
+*******************************************************************************/
+uint32_t scope_frame_encode(const scope_frame_header_t *header, const uint16_t *samples,
+                            uint8_t *frame, uint32_t size)
+{
+    uint32_t length = SCOPE_FRAME_HEADER_SIZE;
+    uint32_t crc;
+
+    if ((header->samples > SCOPE_FRAME_MAX_SAMPLES) || (size < SCOPE_FRAME_SIZE((uint32_t)header->samples)))
+    {
+        return 0u;
+    }
+
+    frame[0] = SCOPE_FRAME_MAGIC_0;
+    frame[1] = SCOPE_FRAME_MAGIC_1;
+    frame[2] = SCOPE_FRAME_VERSION;
+    frame[3] = (uint8_t)((header->flags & 0x0Fu) | (header->mode << 4));
+    scope_frame_put16(&frame[4], header->sequence);
+    scope_frame_put16(&frame[6], header->samples);
+    scope_frame_put16(&frame[8], header->trigger_index);
+    scope_frame_put32(&frame[10], header->period_ns);
+    scope_frame_put16(&frame[14], header->level);
+
+    for (uint32_t index = 0u; index < header->samples; index += 2u)
+    {
+        uint32_t first = samples[index] & SCOPE_FRAME_SAMPLE_MASK;
+        uint32_t second = ((index + 1u) < header->samples) ? (samples[index + 1u] & SCOPE_FRAME_SAMPLE_MASK) : 0u;
+
+        frame[length++] = (uint8_t)first;
+        frame[length++] = (uint8_t)((first >> 8) | (second << 4));
+        if ((index + 1u) < header->samples)
+        {
+            frame[length++] = (uint8_t)(second >> 4);
+        }
+    }
+
+    crc = crc32_compute(frame, length);
+    scope_frame_put32(&frame[length], crc);
+
+    return length + SCOPE_FRAME_CRC_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: scope_frame_decode
+********************************************************************************
+* Summary:
+*  Decodes the frame at the start of a byte stream. On SCOPE_FRAME_INVALID
+*  the caller drops the first byte and tries again; on
+*  SCOPE_FRAME_INCOMPLETE it waits for more bytes.
+*
+* Parameters:
+*  data: received bytes
+*  length: number of bytes
+*  header: receives the capture description
+*  samples: receives up to SCOPE_FRAME_MAX_SAMPLES samples
+*  used: receives the frame length on SCOPE_FRAME_OK
+*
+* Return:
+*  scope_frame_status_t: result
+*
+*******************************************************************************/
+scope_frame_status_t scope_frame_decode(const uint8_t *data, uint32_t length, scope_frame_header_t *header,
+                                        uint16_t *samples, uint32_t *used)
+{
+    uint32_t count;
+    uint32_t size;
+    uint32_t offset = SCOPE_FRAME_HEADER_SIZE;
+
+    /* Check what is there of the header before waiting for the rest */
+    if (((length > 0u) && (SCOPE_FRAME_MAGIC_0 != data[0])) ||
+        ((length > 1u) && (SCOPE_FRAME_MAGIC_1 != data[1])) ||
+        ((length > 2u) && (SCOPE_FRAME_VERSION != data[2])))
+    {
+        return SCOPE_FRAME_INVALID;
+    }
+    if (length < SCOPE_FRAME_HEADER_SIZE)
+    {
+        return SCOPE_FRAME_INCOMPLETE;
+    }
+    count = scope_frame_get16(&data[6]);
+    if ((count > SCOPE_FRAME_MAX_SAMPLES) || (scope_frame_get16(&data[8]) > count))
+    {
+        return SCOPE_FRAME_INVALID;
+    }
+    size = SCOPE_FRAME_SIZE(count);
+    if (length < size)
+    {
+        return SCOPE_FRAME_INCOMPLETE;
+    }
+    if (scope_frame_get32(&data[size - SCOPE_FRAME_CRC_SIZE]) != crc32_compute(data, size - SCOPE_FRAME_CRC_SIZE))
+    {
+        return SCOPE_FRAME_INVALID;
+    }
+
+    header->flags = data[3] & 0x0Fu;
+    header->mode = data[3] >> 4;
+    header->sequence = (uint16_t)scope_frame_get16(&data[4]);
+    header->samples = (uint16_t)count;
+    header->trigger_index = (uint16_t)scope_frame_get16(&data[8]);
+    header->period_ns = scope_frame_get32(&data[10]);
+    header->level = (uint16_t)scope_frame_get16(&data[14]);
+
+    for (uint32_t index = 0u; index < count; index += 2u)
+    {
+        samples[index] = (uint16_t)(data[offset] | ((data[offset + 1u] & 0x0Fu) << 8));
+        if ((index + 1u) < count)
+        {
+            samples[index + 1u] = (uint16_t)((data[offset + 1u] >> 4) | (data[offset + 2u] << 4));
+        }
+        offset += 3u;
+    }
+    *used = size;
+
+    return SCOPE_FRAME_OK;
+}
+
+/*******************************************************************************
+* Function Name: scope_frame_put16
+********************************************************************************
+* Summary:
+*  Stores a 16-bit field of the header, least significant byte first.
+*
+* Parameters:
+*  data: first byte of the field
+*  value: value, bits above 15 ignored
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void scope_frame_put16(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+}
+
+/*******************************************************************************
+* Function Name: scope_frame_put32
+********************************************************************************
+* Summary:
+*  Stores a 32-bit field of the header or the CRC, least significant byte
+*  first.
+*
+* Parameters:
+*  data: first byte of the field
+*  value: value
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void scope_frame_put32(uint8_t *data, uint32_t value)
+{
+    scope_frame_put16(&data[0], value);
+    scope_frame_put16(&data[2], value >> 16);
+}
+
+/*******************************************************************************
+* Function Name: scope_frame_get16
+********************************************************************************
+* Summary:
+*  Reads a 16-bit field of the header, least significant byte first.
+*
+* Parameters:
+*  data: first byte of the field
+*
+* Return:
+*  uint32_t: value
+*
+*******************************************************************************/
+static uint32_t scope_frame_get16(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+}
+
+/*******************************************************************************
+* Function Name: scope_frame_get32
+********************************************************************************
+* Summary:
+*  Reads a 32-bit field of the header or the CRC, least significant byte first.
+*
+* Parameters:
+*  data: first byte of the field
+*
+* Return:
+*  uint32_t: value
+*
+*******************************************************************************/
+static uint32_t scope_frame_get32(const uint8_t *data)
+{
+    return scope_frame_get16(&data[0]) | (scope_frame_get16(&data[2]) << 16);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,113 @@
+/******************************************************************************
+* File Name:   scope_frame.h
+*
+* Description: Binary frame of an oscilloscope capture, sent on the debug
+*              UART between the text lines of the console. A frame is a
+*              16-byte header, the 12-bit samples packed two in three bytes,
+*              and a CRC-32 of both; the receiver finds frames in the byte
+*              stream by their magic and CRC. Only depends on the C library
+*              and the CRC, so that the host viewer decodes with the same
+*              code.
+*
+*              Header, little-endian:
+*                0  magic 0xA5 0x5C
+*                2  version
+*                3  flags: bit 0 forced trigger, bits 4-7 trigger mode
+*                4  sequence number
+*                6  samples
+*                8  index of the trigger sample
+*               10  sample period, ns
+*               14  trigger level, ADC counts
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _SCOPE_FRAME_H_
+#define _SCOPE_FRAME_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCOPE_FRAME_MAGIC_0         (0xA5u)
+#define SCOPE_FRAME_MAGIC_1         (0x5Cu)
+#define SCOPE_FRAME_VERSION         (1u)
+
+#define SCOPE_FRAME_HEADER_SIZE     (16u)
+#define SCOPE_FRAME_CRC_SIZE        (4u)
+
+/* Samples of a frame, 12 significant bits each */
+#define SCOPE_FRAME_MAX_SAMPLES     (4096u)
+#define SCOPE_FRAME_SAMPLE_MASK     (0x0FFFu)
+
+#define SCOPE_FRAME_FLAG_FORCED     (0x01u)
+
+/* Bytes of a frame of n samples */
+#define SCOPE_FRAME_SIZE(n)         (SCOPE_FRAME_HEADER_SIZE + ((((n) * 3u) + 1u) / 2u) + SCOPE_FRAME_CRC_SIZE)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    SCOPE_FRAME_OK = 0u,            /* A frame was decoded */
+    SCOPE_FRAME_INCOMPLETE,         /* The bytes so far may start a frame */
+    SCOPE_FRAME_INVALID,            /* No frame starts at the first byte */
+} scope_frame_status_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint8_t  flags;
+    uint8_t  mode;                  /* scope_trigger_mode_t */
+    uint16_t sequence;
+    uint16_t samples;
+    uint16_t trigger_index;
+    uint32_t period_ns;
+    uint16_t level;
+} scope_frame_header_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern uint32_t scope_frame_encode(const scope_frame_header_t *header, const uint16_t *samples,
+                                   uint8_t *frame, uint32_t size);
+extern scope_frame_status_t scope_frame_decode(const uint8_t *data, uint32_t length, scope_frame_header_t *header,
+                                               uint16_t *samples, uint32_t *used);
+
+#endif
@@ -0,0 +1,302 @@
+/******************************************************************************
+* File Name:   scope_trigger.c
+*
+* Description: Trigger engine of the oscilloscope capture. The interrupt
+*              handler of the capture feeds every sample; the main loop arms
+*              the engine, forces the trigger of an auto capture and reads
+*              the block once it is complete.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stddef.h>
+#include "scope_trigger.h"
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const scope_trigger_mode_names[SCOPE_TRIGGER_MODES] =
+{
+    "none", "rising", "falling", "either", "above", "below"
+};
+
+
+/*******************************************************************************
+* Function Name: scope_trigger_init
+********************************************************************************
+* Summary:
+*  Sets up a trigger engine on a sample buffer. The engine stays idle until
+*  scope_trigger_arm().
+*
+* Parameters:
+*  trigger: engine
+*  config: trigger mode, level and block layout
+*  buffer: ring buffer of the samples
+*  size: samples the buffer holds, at least pre + post
+*
+* Return:
+*  bool: false if the mode is unknown, post is 0 or the buffer is too small
+*
+*******************************************************************************/
+bool scope_trigger_init(scope_trigger_t *trigger, const scope_trigger_config_t *config,
+                        uint16_t *buffer, uint32_t size)
+{
+    if ((config->mode >= SCOPE_TRIGGER_MODES) || (0u == config->post) || (config->pre > size) ||
+        (config->post > (size - config->pre)))
+    {
+        return false;
+    }
+
+    trigger->config = *config;
+    trigger->buffer = buffer;
+    trigger->size = config->pre + config->post;
+    trigger->state = SCOPE_TRIGGER_STATE_IDLE;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_arm
+********************************************************************************
+* Summary:
+*  Starts a new capture, dropping the samples of the previous one. Call while
+*  the feeding interrupt is masked, or before it starts.
+*
+* Parameters:
+*  trigger: engine
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void scope_trigger_arm(scope_trigger_t *trigger)
+{
+    trigger->head = 0u;
+    trigger->count = 0u;
+    trigger->remaining = 0u;
+    trigger->force = false;
+    trigger->forced = false;
+    trigger->below = false;
+    trigger->above = false;
+    trigger->state = SCOPE_TRIGGER_STATE_ARMED;
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_force
+********************************************************************************
+* Summary:
+*  Fires the trigger at the next sample that has the pre-trigger samples before
+*  it, as the auto mode of an oscilloscope does without a trigger. The capture
+*  is marked as forced unless its own trigger fires at that sample. May be
+*  called from another context than the feed; arming clears it.
+*
+* Parameters:
+*  trigger: trigger engine
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void scope_trigger_force(scope_trigger_t *trigger)
+{
+    trigger->force = true;
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_feed
+********************************************************************************
+* Summary:
+*  Adds a sample to an armed capture. An edge is qualified by a sample beyond
+*  the hysteresis band on the far side of the level, and a crossing seen
+*  before the pre-trigger samples are in is dropped, so a capture always
+*  shows the edge at the trigger sample.
+*
+* Parameters:
+*  trigger: engine
+*  sample: next sample
+*
+* Return:
+*  bool: true once the capture is complete
+*
+*******************************************************************************/
+bool scope_trigger_feed(scope_trigger_t *trigger, uint16_t sample)
+{
+    const scope_trigger_config_t *config = &trigger->config;
+    bool hit = false;
+
+    if (SCOPE_TRIGGER_STATE_ARMED == trigger->state)
+    {
+        switch (config->mode)
+        {
+            case SCOPE_TRIGGER_RISING:
+            case SCOPE_TRIGGER_FALLING:
+            case SCOPE_TRIGGER_EITHER:
+                if (trigger->below && (sample >= config->level) && (SCOPE_TRIGGER_FALLING != config->mode))
+                {
+                    trigger->below = false;
+                    hit = true;
+                }
+                else if (trigger->above && (sample <= config->level) && (SCOPE_TRIGGER_RISING != config->mode))
+                {
+                    trigger->above = false;
+                    hit = true;
+                }
+                if (((uint32_t)sample + config->hysteresis) < config->level)
+                {
+                    trigger->below = true;
+                }
+                if (sample > ((uint32_t)config->level + config->hysteresis))
+                {
+                    trigger->above = true;
+                }
+                break;
+            case SCOPE_TRIGGER_ABOVE:
+                hit = (sample >= config->level);
+                break;
+            case SCOPE_TRIGGER_BELOW:
+                hit = (sample <= config->level);
+                break;
+            default:
+                hit = true;
+                break;
+        }
+    }
+    else if (SCOPE_TRIGGER_STATE_TRIGGERED != trigger->state)
+    {
+        return (SCOPE_TRIGGER_STATE_DONE == trigger->state);
+    }
+
+    trigger->buffer[trigger->head] = sample;
+    trigger->head = ((trigger->head + 1u) == trigger->size) ? 0u : (trigger->head + 1u);
+    trigger->count++;
+
+    if (SCOPE_TRIGGER_STATE_TRIGGERED == trigger->state)
+    {
+        trigger->remaining--;
+    }
+    else if (trigger->count > config->pre)
+    {
+        if (!hit && trigger->force)
+        {
+            hit = true;
+            trigger->forced = true;
+        }
+        if (hit)
+        {
+            trigger->remaining = config->post - 1u;
+            trigger->state = SCOPE_TRIGGER_STATE_TRIGGERED;
+        }
+    }
+    if ((SCOPE_TRIGGER_STATE_TRIGGERED == trigger->state) && (0u == trigger->remaining))
+    {
+        trigger->state = SCOPE_TRIGGER_STATE_DONE;
+    }
+
+    return (SCOPE_TRIGGER_STATE_DONE == trigger->state);
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_done
+********************************************************************************
+* Summary:
+*  Tells if the capture is complete and can be read.
+*
+* Parameters:
+*  trigger: trigger engine
+*
+* Return:
+*  bool: true once the last post-trigger sample was fed
+*
+*******************************************************************************/
+bool scope_trigger_done(const scope_trigger_t *trigger)
+{
+    return (SCOPE_TRIGGER_STATE_DONE == trigger->state);
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_read
+********************************************************************************
+* Summary:
+*  Copies a complete capture, oldest sample first. The trigger sample is at
+*  index config.pre.
+*
+* Parameters:
+*  trigger: engine
+*  samples: receives pre + post samples
+*
+* Return:
+*  uint32_t: samples copied, 0 if the capture is not complete
+*
+*******************************************************************************/
+uint32_t scope_trigger_read(const scope_trigger_t *trigger, uint16_t *samples)
+{
+    uint32_t index = trigger->head;
+
+    if (!scope_trigger_done(trigger))
+    {
+        return 0u;
+    }
+
+    /* The ring is full: the oldest sample is the next one to be written */
+    for (uint32_t sample = 0u; sample < trigger->size; sample++)
+    {
+        samples[sample] = trigger->buffer[index];
+        index = ((index + 1u) == trigger->size) ? 0u : (index + 1u);
+    }
+
+    return trigger->size;
+}
+
+/*******************************************************************************
+* Function Name: scope_trigger_mode_name
+********************************************************************************
+* Summary:
+*  Returns the name of a trigger mode, as printed by the SAR ADC demo and read
+*  by scope_view.
+*
+* Parameters:
+*  mode: trigger mode
+*
+* Return:
+*  const char *: name, NULL if the mode is unknown
+*
+*******************************************************************************/
+const char *scope_trigger_mode_name(scope_trigger_mode_t mode)
+{
+    return (mode < SCOPE_TRIGGER_MODES) ? scope_trigger_mode_names[mode] : NULL;
+}
+
+
+/* [] END OF FILE */
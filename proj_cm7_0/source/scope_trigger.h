@@ -0,0 +1,112 @@
+/******************************************************************************
+* File Name:   scope_trigger.h
+*
+* Description: Trigger engine of the oscilloscope capture. Samples go into a
+*              ring of pre-trigger plus post-trigger samples; once the ring
+*              holds the pre-trigger samples, a level or an edge of the
+*              input fires the trigger, and the capture is complete when the
+*              post-trigger samples are in. Only depends on the C library,
+*              so that the host can replay recorded samples through it.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _SCOPE_TRIGGER_H_
+#define _SCOPE_TRIGGER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    SCOPE_TRIGGER_NONE = 0u,        /* First sample after the pre-trigger samples */
+    SCOPE_TRIGGER_RISING,           /* From below level - hysteresis to level or above */
+    SCOPE_TRIGGER_FALLING,          /* From above level + hysteresis to level or below */
+    SCOPE_TRIGGER_EITHER,           /* Rising or falling edge */
+    SCOPE_TRIGGER_ABOVE,            /* Any sample at level or above */
+    SCOPE_TRIGGER_BELOW,            /* Any sample at level or below */
+    SCOPE_TRIGGER_MODES
+} scope_trigger_mode_t;
+
+typedef enum
+{
+    SCOPE_TRIGGER_STATE_IDLE = 0u,  /* Not armed, samples are ignored */
+    SCOPE_TRIGGER_STATE_ARMED,      /* Waiting for the pre-trigger samples and the trigger */
+    SCOPE_TRIGGER_STATE_TRIGGERED,  /* Taking the post-trigger samples */
+    SCOPE_TRIGGER_STATE_DONE,       /* Capture complete, samples are ignored */
+} scope_trigger_state_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    scope_trigger_mode_t mode;
+    uint16_t             level;     /* Sample value of the trigger */
+    uint16_t             hysteresis;/* Edges must start this far from the level */
+    uint32_t             pre;       /* Samples kept before the trigger sample */
+    uint32_t             post;      /* Samples from the trigger sample on, at least 1 */
+} scope_trigger_config_t;
+
+typedef struct
+{
+    scope_trigger_config_t config;
+    uint16_t          *buffer;      /* Ring of pre + post samples */
+    uint32_t           size;
+    uint32_t           head;        /* Next sample written */
+    uint32_t           count;       /* Samples since the capture was armed */
+    uint32_t           remaining;   /* Post-trigger samples still to come */
+    volatile uint8_t   state;       /* scope_trigger_state_t */
+    volatile bool      force;       /* Trigger on the next sample it can */
+    bool               forced;      /* The trigger was forced */
+    bool               below;       /* A rising edge may follow */
+    bool               above;       /* A falling edge may follow */
+} scope_trigger_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern bool scope_trigger_init(scope_trigger_t *trigger, const scope_trigger_config_t *config,
+                               uint16_t *buffer, uint32_t size);
+extern void scope_trigger_arm(scope_trigger_t *trigger);
+extern void scope_trigger_force(scope_trigger_t *trigger);
+extern bool scope_trigger_feed(scope_trigger_t *trigger, uint16_t sample);
+extern bool scope_trigger_done(const scope_trigger_t *trigger);
+extern uint32_t scope_trigger_read(const scope_trigger_t *trigger, uint16_t *samples);
+extern const char *scope_trigger_mode_name(scope_trigger_mode_t mode);
+
+#endif
@@ -0,0 +1,409 @@
+/******************************************************************************
+* File Name:   term_screen.c
+*
+* Description: Screen model of an ANSI terminal area.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "term_screen.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Cursor position that matches no cell */
+#define TERM_SCREEN_CURSOR_UNKNOWN  (TERM_SCREEN_MAX_ROWS)
+
+/* Erase to the end of the line, used when it is shorter than the blanks */
+#define TERM_SCREEN_ERASE_LINE      "\x1b[K"
+#define TERM_SCREEN_ERASE_SCREEN    "\x1b[2J"
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t term_screen_number(char *out, uint32_t value);
+static uint32_t term_screen_move(term_screen_t *screen, char *out, uint32_t row, uint32_t col);
+static uint32_t term_screen_render_row(term_screen_t *screen, uint32_t row, char *out);
+
+
+/*******************************************************************************
+* Function Name: term_screen_init
+********************************************************************************
+* Summary:
+*  Sets up a blank model of the top rows of the terminal. Its content on the
+*  terminal is unknown until the first render, which erases the screen.
+*
+* Parameters:
+*  screen: screen model
+*  rows: rows of the area, up to TERM_SCREEN_MAX_ROWS
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void term_screen_init(term_screen_t *screen, uint32_t rows)
+{
+    screen->rows = (rows < TERM_SCREEN_MAX_ROWS) ? rows : TERM_SCREEN_MAX_ROWS;
+    term_screen_clear(screen);
+    term_screen_invalidate(screen);
+}
+
+/*******************************************************************************
+* Function Name: term_screen_invalidate
+********************************************************************************
+* Summary:
+*  Forgets what the terminal shows, after it may have been cleared or reset:
+*  the next render draws every row of the area and moves the cursor first.
+*
+* Parameters:
+*  screen: screen model
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void term_screen_invalidate(term_screen_t *screen)
+{
+    screen->valid = false;
+    term_screen_cursor_moved(screen);
+    screen->cursor_col = 0u;
+}
+
+/*******************************************************************************
+* Function Name: term_screen_cursor_moved
+********************************************************************************
+* Summary:
+*  Forgets the cursor position, after other output moved the cursor. The next
+*  render starts with a cursor move.
+*
+* Parameters:
+*  screen: screen model
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void term_screen_cursor_moved(term_screen_t *screen)
+{
+    screen->cursor_row = TERM_SCREEN_CURSOR_UNKNOWN;
+}
+
+/*******************************************************************************
+* Function Name: term_screen_clear
+********************************************************************************
+* Summary:
+*  Blanks the area in the model. The terminal is only changed by the next
+*  render.
+*
+* Parameters:
+*  screen: screen model
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void term_screen_clear(term_screen_t *screen)
+{
+    memset(screen->want, ' ', sizeof(screen->want));
+}
+
+/*******************************************************************************
+* Function Name: term_screen_put
+********************************************************************************
+* Summary:
+*  Writes text into a field of a row of the model, padded with blanks to the
+*  field width and cut at its end or at the end of the row. Control
+*  characters are shown as blanks.
+*
+* Parameters:
+*  screen: screen model
+*  row: row, from 0
+*  col: first column of the field, from 0
+*  width: columns of the field, TERM_SCREEN_COLS for the rest of the row
+*  text: text
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void term_screen_put(term_screen_t *screen, uint32_t row, uint32_t col, uint32_t width, const char *text)
+{
+    uint32_t end = ((TERM_SCREEN_COLS - col) > width) ? (col + width) : TERM_SCREEN_COLS;
+
+    if ((row >= screen->rows) || (col >= TERM_SCREEN_COLS))
+    {
+        return;
+    }
+
+    for (uint32_t index = col; index < end; index++)
+    {
+        char c = ('\0' != *text) ? *text++ : ' ';
+
+        screen->want[row][index] = (((uint8_t)c < 0x20u) || (0x7F == (uint8_t)c)) ? ' ' : c;
+    }
+}
+
+/*******************************************************************************
+* Function Name: term_screen_dirty
+********************************************************************************
+* Summary:
+*  Tells if a render would emit something: the terminal content is unknown or
+*  differs from the model.
+*
+* Parameters:
+*  screen: screen model
+*
+* Return:
+*  bool: true if a render is needed
+*
+*******************************************************************************/
+bool term_screen_dirty(const term_screen_t *screen)
+{
+    return !screen->valid || (0 != memcmp(screen->want, screen->shown, screen->rows * TERM_SCREEN_COLS));
+}
+
+/*******************************************************************************
+* Function Name: term_screen_render
+********************************************************************************
+* Summary:
+*  Builds the terminal output that brings the area from what it shows to
+*  the model. Rows are rendered whole while at least
+*  TERM_SCREEN_ROW_MAX_BYTES are left; the rows that did not fit stay
+*  pending for the next call. The cursor is left after the last cell
+*  written; callers that share the terminal with scrolling output save and
+*  restore it around the output.
+*
+* Parameters:
+*  screen: screen model
+*  out: receives the output
+*  size: size of out
+*
+* Return:
+*  uint32_t: output length, 0 if nothing changed or there is no room
+*
+*******************************************************************************/
+uint32_t term_screen_render(term_screen_t *screen, char *out, uint32_t size)
+{
+    uint32_t length = 0u;
+
+    if (!screen->valid)
+    {
+        if (size < (sizeof(TERM_SCREEN_ERASE_SCREEN) - 1u + TERM_SCREEN_ROW_MAX_BYTES))
+        {
+            return 0u;
+        }
+        memcpy(out, TERM_SCREEN_ERASE_SCREEN, sizeof(TERM_SCREEN_ERASE_SCREEN) - 1u);
+        length = sizeof(TERM_SCREEN_ERASE_SCREEN) - 1u;
+        memset(screen->shown, ' ', sizeof(screen->shown));
+        screen->valid = true;
+    }
+
+    for (uint32_t row = 0u; row < screen->rows; row++)
+    {
+        if (0 == memcmp(screen->want[row], screen->shown[row], TERM_SCREEN_COLS))
+        {
+            continue;
+        }
+        if ((size - length) < TERM_SCREEN_ROW_MAX_BYTES)
+        {
+            break;
+        }
+        length += term_screen_render_row(screen, row, &out[length]);
+    }
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: term_screen_number
+********************************************************************************
+* Summary:
+*  Writes a decimal number without a terminator.
+*
+* Parameters:
+*  out: receives at most 10 characters
+*  value: number
+*
+* Return:
+*  uint32_t: number of characters written
+*
+*******************************************************************************/
+static uint32_t term_screen_number(char *out, uint32_t value)
+{
+    char digits[10];
+    uint32_t count = 0u;
+
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10u));
+        value /= 10u;
+    } while (0u != value);
+
+    for (uint32_t index = 0u; index < count; index++)
+    {
+        out[index] = digits[count - 1u - index];
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: term_screen_move
+********************************************************************************
+* Summary:
+*  Moves the cursor to a cell with a CUP sequence, unless it is known to be
+*  there already.
+*
+* Parameters:
+*  screen: screen model
+*  out: receives at most 24 characters
+*  row: row, from 0
+*  col: column, from 0
+*
+* Return:
+*  uint32_t: output length, 0 if the cursor is already there
+*
+*******************************************************************************/
+static uint32_t term_screen_move(term_screen_t *screen, char *out, uint32_t row, uint32_t col)
+{
+    uint32_t length = 0u;
+
+    if ((row == screen->cursor_row) && (col == screen->cursor_col))
+    {
+        return 0u;
+    }
+
+    out[length++] = '\x1b';
+    out[length++] = '[';
+    length += term_screen_number(&out[length], row + 1u);
+    out[length++] = ';';
+    length += term_screen_number(&out[length], col + 1u);
+    out[length++] = 'H';
+    screen->cursor_row = row;
+    screen->cursor_col = col;
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: term_screen_render_row
+********************************************************************************
+* Summary:
+*  Renders the changes of one row. Changes closer than TERM_SCREEN_GAP
+*  cells are written as one run with the cells between them; a change after
+*  which the model row is blank erases to the end of the line when that is
+*  shorter than writing the blanks.
+*
+* Parameters:
+*  screen: screen model
+*  row: row with changes
+*  out: receives at most TERM_SCREEN_ROW_MAX_BYTES
+*
+* Return:
+*  uint32_t: output length
+*
+*******************************************************************************/
+static uint32_t term_screen_render_row(term_screen_t *screen, uint32_t row, char *out)
+{
+    char *want = screen->want[row];
+    char *shown = screen->shown[row];
+    uint32_t length = 0u;
+    uint32_t col = 0u;
+
+    while (col < TERM_SCREEN_COLS)
+    {
+        uint32_t start = col;
+        uint32_t end;
+        uint32_t blank_from = TERM_SCREEN_COLS;
+        uint32_t shown_end = start;
+
+        if (want[col] == shown[col])
+        {
+            col++;
+            continue;
+        }
+
+        /* Blank tail of the model and extent of the text still shown */
+        while ((blank_from > start) && (' ' == want[blank_from - 1u]))
+        {
+            blank_from--;
+        }
+        for (uint32_t index = start; index < TERM_SCREEN_COLS; index++)
+        {
+            shown_end = (' ' != shown[index]) ? (index + 1u) : shown_end;
+        }
+        if ((blank_from == start) && ((shown_end - start) > (sizeof(TERM_SCREEN_ERASE_LINE) - 1u)))
+        {
+            length += term_screen_move(screen, &out[length], row, start);
+            memcpy(&out[length], TERM_SCREEN_ERASE_LINE, sizeof(TERM_SCREEN_ERASE_LINE) - 1u);
+            length += sizeof(TERM_SCREEN_ERASE_LINE) - 1u;
+            memset(&shown[start], ' ', TERM_SCREEN_COLS - start);
+            break;
+        }
+
+        end = start + 1u;
+        for (uint32_t index = end; index < TERM_SCREEN_COLS; index++)
+        {
+            if (want[index] != shown[index])
+            {
+                end = index + 1u;
+            }
+            else if ((index + 1u - end) > TERM_SCREEN_GAP)
+            {
+                break;
+            }
+        }
+
+        length += term_screen_move(screen, &out[length], row, start);
+        memcpy(&out[length], &want[start], end - start);
+        memcpy(&shown[start], &want[start], end - start);
+        length += end - start;
+
+        /* In the last column the cursor waits for the next character to
+         * wrap, which terminals handle differently */
+        screen->cursor_col = end;
+        if (TERM_SCREEN_COLS == end)
+        {
+            screen->cursor_row = TERM_SCREEN_CURSOR_UNKNOWN;
+        }
+        col = end;
+    }
+
+    return length;
+}
+
+
+/* [] END OF FILE */
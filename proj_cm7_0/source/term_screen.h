@@ -0,0 +1,94 @@
+/******************************************************************************
+* File Name:   term_screen.h
+*
+* Description: Screen model of an ANSI terminal area. The application writes
+*              the text it wants into the model; rendering compares it with
+*              what the terminal shows and emits only the changed cells,
+*              with cursor addressing between them, so that a redraw of an
+*              unchanged screen costs nothing. Only depends on the C library,
+*              so that the host checks it against a terminal model.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _TERM_SCREEN_H_
+#define _TERM_SCREEN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest area modelled, from the top left corner of the terminal */
+#define TERM_SCREEN_MAX_ROWS        (24u)
+#define TERM_SCREEN_COLS            (80u)
+
+/* Unchanged cells between two changes that are written again rather than
+ * skipped with a cursor move, which takes up to 8 bytes */
+#define TERM_SCREEN_GAP             (6u)
+
+/* Bytes of a cursor move, ESC [ row ; col H */
+#define TERM_SCREEN_MOVE_MAX        (8u)
+
+/* Room that term_screen_render() needs to make progress: the longest
+ * rendering of one row */
+#define TERM_SCREEN_ROW_MAX_BYTES   (TERM_SCREEN_COLS + \
+                                     (((TERM_SCREEN_COLS / (TERM_SCREEN_GAP + 1u)) + 1u) * TERM_SCREEN_MOVE_MAX) + 3u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t rows;
+    char     want[TERM_SCREEN_MAX_ROWS][TERM_SCREEN_COLS];   /* Written by the application */
+    char     shown[TERM_SCREEN_MAX_ROWS][TERM_SCREEN_COLS];  /* On the terminal */
+    bool     valid;                 /* shown is known, false until the first render */
+    uint32_t cursor_row;            /* Cursor after the last render, TERM_SCREEN_MAX_ROWS if unknown */
+    uint32_t cursor_col;
+} term_screen_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void term_screen_init(term_screen_t *screen, uint32_t rows);
+extern void term_screen_invalidate(term_screen_t *screen);
+extern void term_screen_cursor_moved(term_screen_t *screen);
+extern void term_screen_clear(term_screen_t *screen);
+extern void term_screen_put(term_screen_t *screen, uint32_t row, uint32_t col, uint32_t width, const char *text);
+extern bool term_screen_dirty(const term_screen_t *screen);
+extern uint32_t term_screen_render(term_screen_t *screen, char *out, uint32_t size);
+
+#endif
@@ -0,0 +1,617 @@
+/******************************************************************************
+* File Name:   watchdog.c
+*
+* Description: Watchdog service of CM7_0, see watchdog.h.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "boot_time.h"
+#include "watchdog.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Backup registers of the reset record. They keep their value across all
+ * resets but the power-on reset; the HAL RTC keeps its state in the first
+ * set, the record takes the first four registers of the last one. */
+#define WATCHDOG_BREG               (BACKUP->BREG_SET3)
+#define WATCHDOG_BREG_TAG           (0u)    /* Magic, task and cause, written last */
+#define WATCHDOG_BREG_RAN           (1u)
+#define WATCHDOG_BREG_BUDGET        (2u)
+#define WATCHDOG_BREG_CALLER        (3u)
+
+/* Tag of a valid record: magic | task << 8 | cause */
+#define WATCHDOG_MAGIC              (0x57440000u)
+#define WATCHDOG_MAGIC_MASK         (0xFFFF0000u)
+
+/* Clock of the tick timer, and priority of its interrupt: below the
+ * console and the buttons, so that it only measures them */
+#define WATCHDOG_TIMER_HZ           (10000u)
+#define WATCHDOG_INTR_PRIORITY      (7u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if WATCHDOG
+static void watchdog_tick(void *callback_arg, cyhal_timer_event_t event);
+#endif /* WATCHDOG */
+static void watchdog_miss(watchdog_cause_t cause, const deadline_miss_t *run, uint32_t caller);
+static void watchdog_store(watchdog_cause_t cause, const deadline_miss_t *run, uint32_t caller);
+static void watchdog_print_record(const watchdog_record_t *record);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static deadline_monitor_t watchdog_monitor;
+static cyhal_wdt_t        watchdog_wdt;
+static cyhal_timer_t      watchdog_timer;
+static bool               watchdog_started = false;
+static bool               watchdog_suspended = false;
+/* A task missed its deadline or failed: the kicks stop until the reset */
+static volatile bool      watchdog_missed = false;
+
+/* Record of the last reset, and whether the boot report printed it */
+static watchdog_record_t  watchdog_record = { WATCHDOG_CAUSE_NONE, DEADLINE_NO_TASK, 0u, 0u, 0u };
+static bool               watchdog_reported = false;
+
+static const uint32_t watchdog_budget_us[WATCHDOG_TASK_NUM] =
+{
+    WATCHDOG_BUDGET_DEMO_MS * 1000u,
+    WATCHDOG_BUDGET_BUTTON_MS * 1000u,
+    WATCHDOG_BUDGET_FLUSH_MS * 1000u,
+    WATCHDOG_BUDGET_QSPI_MS * 1000u,
+};
+
+static const char * const watchdog_task_name[WATCHDOG_TASK_NUM] =
+{
+    "demo loop",
+    "button hold",
+    "console flush",
+    "QSPI memory",
+};
+
+
+/*******************************************************************************
+* Function Name: watchdog_init
+********************************************************************************
+* Summary:
+*  Reads the record of the last reset out of the backup registers, then
+*  starts the hardware watchdog and the tick that kicks it. The record is
+*  only kept after a watchdog reset.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: result of the watchdog or timer initialization
+*
+*******************************************************************************/
+cy_rslt_t watchdog_init(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t tag = WATCHDOG_BREG[WATCHDOG_BREG_TAG];
+    uint32_t cause = tag & 0xFFu;
+#if WATCHDOG
+    const cyhal_timer_cfg_t timer_cfg =
+    {
+        .compare_value = 0u,
+        .period = ((WATCHDOG_TIMER_HZ / 1000u) * WATCHDOG_TICK_MS) - 1u,
+        .direction = CYHAL_TIMER_DIR_UP,
+        .is_compare = false,
+        .is_continuous = true,
+        .value = 0u
+    };
+#endif /* WATCHDOG */
+
+    if ((0u != (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HWWDT)) &&
+        (WATCHDOG_MAGIC == (tag & WATCHDOG_MAGIC_MASK)) &&
+        (WATCHDOG_CAUSE_NONE != cause) && (cause <= (uint32_t)WATCHDOG_CAUSE_ERROR))
+    {
+        watchdog_record.cause = (watchdog_cause_t)cause;
+        watchdog_record.task = (tag >> 8) & 0xFFu;
+        watchdog_record.ran_ms = WATCHDOG_BREG[WATCHDOG_BREG_RAN];
+        watchdog_record.budget_ms = WATCHDOG_BREG[WATCHDOG_BREG_BUDGET];
+        watchdog_record.caller = WATCHDOG_BREG[WATCHDOG_BREG_CALLER];
+    }
+    WATCHDOG_BREG[WATCHDOG_BREG_TAG] = 0u;
+
+#if WATCHDOG
+    if (watchdog_started)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+    deadline_init(&watchdog_monitor, watchdog_budget_us, WATCHDOG_TASK_NUM);
+
+    /* The watchdog runs from here on, the tick must start within its timeout */
+    result = cyhal_wdt_init(&watchdog_wdt, WATCHDOG_TIMEOUT_MS);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    result = cyhal_timer_init(&watchdog_timer, NC, NULL);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        cyhal_wdt_free(&watchdog_wdt);
+        return result;
+    }
+    (void)cyhal_timer_configure(&watchdog_timer, &timer_cfg);
+    (void)cyhal_timer_set_frequency(&watchdog_timer, WATCHDOG_TIMER_HZ);
+    cyhal_timer_register_callback(&watchdog_timer, watchdog_tick, NULL);
+    cyhal_timer_enable_event(&watchdog_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, WATCHDOG_INTR_PRIORITY, true);
+    (void)cyhal_timer_start(&watchdog_timer);
+    watchdog_started = true;
+#endif /* WATCHDOG */
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: watchdog_begin
+********************************************************************************
+* Summary:
+*  Starts a run of a task. A task started inside another one stops the clock
+*  of the outer task until it ends.
+*
+* Parameters:
+*  task: supervised task
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void watchdog_begin(watchdog_task_t task)
+{
+    uint32_t interrupt_state;
+
+    if (!watchdog_started)
+    {
+        return;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    (void)deadline_begin(&watchdog_monitor, (uint32_t)task, boot_time_now());
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: watchdog_end
+********************************************************************************
+* Summary:
+*  Ends the run of a task, if it is running. A run over budget stops the
+*  kicks, so that the watchdog resets the device.
+*
+* Parameters:
+*  task: supervised task
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void watchdog_end(watchdog_task_t task)
+{
+    uint32_t interrupt_state;
+    deadline_miss_t miss;
+
+    if (!watchdog_started)
+    {
+        return;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    if (!deadline_end(&watchdog_monitor, (uint32_t)task, boot_time_now(), &miss))
+    {
+        watchdog_miss(WATCHDOG_CAUSE_DEADLINE, &miss, 0u);
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: watchdog_checkin
+********************************************************************************
+* Summary:
+*  Ends the run of a periodic task, as watchdog_end(), and starts the next.
+*
+* Parameters:
+*  task: supervised task
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void watchdog_checkin(watchdog_task_t task)
+{
+    uint32_t interrupt_state;
+    deadline_miss_t miss;
+
+    if (!watchdog_started)
+    {
+        return;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    if (!deadline_checkin(&watchdog_monitor, (uint32_t)task, boot_time_now(), &miss))
+    {
+        watchdog_miss(WATCHDOG_CAUSE_DEADLINE, &miss, 0u);
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: watchdog_suspend
+********************************************************************************
+* Summary:
+*  Stops the watchdog and its tick before a low-power mode, whose wait does
+*  not count against any task. The tick would otherwise wake the CPU from
+*  Sleep, and the boot timebase stops in DeepSleep. After a miss the
+*  watchdog keeps running, so that the reset still comes.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void watchdog_suspend(void)
+{
+    uint32_t interrupt_state;
+
+    if (!watchdog_started || watchdog_suspended)
+    {
+        return;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    if (!watchdog_missed)
+    {
+        deadline_pause(&watchdog_monitor, boot_time_now());
+        (void)cyhal_timer_stop(&watchdog_timer);
+        cyhal_wdt_stop(&watchdog_wdt);
+        watchdog_suspended = true;
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: watchdog_resume
+********************************************************************************
+* Summary:
+*  Restarts the watchdog and its tick after watchdog_suspend().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void watchdog_resume(void)
+{
+    uint32_t interrupt_state;
+
+    if (!watchdog_started || !watchdog_suspended)
+    {
+        return;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    cyhal_wdt_start(&watchdog_wdt);
+    cyhal_wdt_kick(&watchdog_wdt);
+    deadline_resume(&watchdog_monitor, boot_time_now());
+    (void)cyhal_timer_start(&watchdog_timer);
+    watchdog_suspended = false;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: watchdog_fault
+********************************************************************************
+* Summary:
+*  Records an error in the task in progress and stops the kicks. Called by
+*  handle_error() and the status checks before they halt, so that the
+*  watchdog resets the device instead.
+*
+* Parameters:
+*  caller: return address of the failing function, 0 if unknown
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void watchdog_fault(uint32_t caller)
+{
+    uint32_t interrupt_state;
+    deadline_miss_t run;
+
+    if (!watchdog_started)
+    {
+        return;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    (void)deadline_check(&watchdog_monitor, boot_time_now(), &run);
+    watchdog_miss(WATCHDOG_CAUSE_ERROR, &run, caller);
+    if (watchdog_suspended)
+    {
+        cyhal_wdt_start(&watchdog_wdt);
+        watchdog_suspended = false;
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: watchdog_last_reset
+********************************************************************************
+* Summary:
+*  Returns the record of the last reset.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  const watchdog_record_t *: cause WATCHDOG_CAUSE_NONE unless the last reset
+*  was a watchdog reset
+*
+*******************************************************************************/
+const watchdog_record_t *watchdog_last_reset(void)
+{
+    return &watchdog_record;
+}
+
+/*******************************************************************************
+* Function Name: watchdog_print_reset
+********************************************************************************
+* Summary:
+*  Prints the record of the last reset once, after the start-up message, if
+*  it was a watchdog reset.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void watchdog_print_reset(void)
+{
+    if (watchdog_reported || (WATCHDOG_CAUSE_NONE == watchdog_record.cause))
+    {
+        return;
+    }
+    watchdog_reported = true;
+
+    printf("Watchdog reset: ");
+    watchdog_print_record(&watchdog_record);
+}
+
+/*******************************************************************************
+* Function Name: watchdog_print
+********************************************************************************
+* Summary:
+*  Prints the budget and the run statistics of each task, and the record of
+*  the last reset.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void watchdog_print(void)
+{
+    deadline_monitor_t monitor;
+    uint32_t interrupt_state;
+
+    if (!watchdog_started)
+    {
+        printf("Watchdog not started\r\n");
+    }
+    else
+    {
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        monitor = watchdog_monitor;
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+        printf("Watchdog timeout %lu ms, tick %lu ms%s\r\n", (unsigned long)WATCHDOG_TIMEOUT_MS,
+               (unsigned long)WATCHDOG_TICK_MS, watchdog_missed ? ", deadline missed, reset pending" : "");
+        printf("  %-14s %10s %8s %11s %7s\r\n", "task", "budget ms", "runs", "longest ms", "misses");
+        for (uint32_t task = 0u; task < (uint32_t)WATCHDOG_TASK_NUM; task++)
+        {
+            printf("  %-14s %10lu %8lu %11lu %7lu\r\n", watchdog_task_name[task],
+                   (unsigned long)(monitor.task[task].budget_us / 1000u), (unsigned long)monitor.task[task].runs,
+                   (unsigned long)(monitor.task[task].longest_us / 1000u), (unsigned long)monitor.task[task].misses);
+        }
+        if (0u != monitor.overflows)
+        {
+            printf("  %lu runs nested too deep to be timed\r\n", (unsigned long)monitor.overflows);
+        }
+    }
+
+    printf("Last reset: ");
+    if (WATCHDOG_CAUSE_NONE == watchdog_record.cause)
+    {
+        printf("not a watchdog reset\r\n");
+    }
+    else
+    {
+        watchdog_print_record(&watchdog_record);
+    }
+}
+
+#if WATCHDOG
+/*******************************************************************************
+* Function Name: watchdog_tick
+********************************************************************************
+* Summary:
+*  Tick timer handler: kicks the watchdog while the task in progress is
+*  within its budget. Stores the run at each tick, so that a reset with the
+*  interrupts blocked still names the task.
+*
+* Parameters:
+*  callback_arg: unused
+*  event: unused
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void watchdog_tick(void *callback_arg, cyhal_timer_event_t event)
+{
+    deadline_miss_t run;
+
+    (void)callback_arg;
+    (void)event;
+
+    if (watchdog_missed)
+    {
+        return;
+    }
+    if (!deadline_check(&watchdog_monitor, boot_time_now(), &run))
+    {
+        watchdog_miss(WATCHDOG_CAUSE_DEADLINE, &run, 0u);
+        return;
+    }
+    watchdog_store(WATCHDOG_CAUSE_RUNNING, &run, 0u);
+    cyhal_wdt_kick(&watchdog_wdt);
+}
+#endif /* WATCHDOG */
+
+/*******************************************************************************
+* Function Name: watchdog_miss
+********************************************************************************
+* Summary:
+*  Stops the kicks for good, so that the watchdog resets the device. Only
+*  the first miss is recorded.
+*
+* Parameters:
+*  cause: WATCHDOG_CAUSE_DEADLINE or WATCHDOG_CAUSE_ERROR
+*  run: task and times of the run in progress
+*  caller: return address of the error handler call, 0 for a deadline
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void watchdog_miss(watchdog_cause_t cause, const deadline_miss_t *run, uint32_t caller)
+{
+    if (!watchdog_missed)
+    {
+        watchdog_missed = true;
+        watchdog_store(cause, run, caller);
+    }
+}
+
+/*******************************************************************************
+* Function Name: watchdog_store
+********************************************************************************
+* Summary:
+*  Writes the record to the backup registers, which keep it across the
+*  reset. The tag is cleared first and written last, so that a record torn
+*  by the reset is never taken as valid.
+*
+* Parameters:
+*  cause: cause the reset would have
+*  run: task and times of the run in progress
+*  caller: return address of the error handler call, 0 otherwise
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void watchdog_store(watchdog_cause_t cause, const deadline_miss_t *run, uint32_t caller)
+{
+    WATCHDOG_BREG[WATCHDOG_BREG_TAG] = 0u;
+    WATCHDOG_BREG[WATCHDOG_BREG_RAN] = run->ran_us / 1000u;
+    WATCHDOG_BREG[WATCHDOG_BREG_BUDGET] = run->budget_us / 1000u;
+    WATCHDOG_BREG[WATCHDOG_BREG_CALLER] = caller;
+    WATCHDOG_BREG[WATCHDOG_BREG_TAG] = WATCHDOG_MAGIC | ((run->task & 0xFFu) << 8) | (uint32_t)cause;
+}
+
+/*******************************************************************************
+* Function Name: watchdog_print_record
+********************************************************************************
+* Summary:
+*  Prints one line describing a reset record, ended by a line break.
+*
+* Parameters:
+*  record: record read back at the start-up
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void watchdog_print_record(const watchdog_record_t *record)
+{
+    const char *name = (record->task < (uint32_t)WATCHDOG_TASK_NUM) ? watchdog_task_name[record->task] : NULL;
+
+    switch (record->cause)
+    {
+        case WATCHDOG_CAUSE_DEADLINE:
+            printf("%s ran %lu ms, over its %lu ms deadline\r\n", (NULL != name) ? name : "unknown task",
+                   (unsigned long)record->ran_ms, (unsigned long)record->budget_ms);
+            break;
+
+        case WATCHDOG_CAUSE_RUNNING:
+            if (NULL != name)
+            {
+                printf("interrupts blocked for over %lu ms in %s, %lu ms into its run\r\n",
+                       (unsigned long)(WATCHDOG_TIMEOUT_MS - WATCHDOG_TICK_MS), name,
+                       (unsigned long)record->ran_ms);
+            }
+            else
+            {
+                printf("interrupts blocked for over %lu ms outside the supervised tasks\r\n",
+                       (unsigned long)(WATCHDOG_TIMEOUT_MS - WATCHDOG_TICK_MS));
+            }
+            break;
+
+        case WATCHDOG_CAUSE_ERROR:
+            printf("error handler called from 0x%08lx in %s\r\n", (unsigned long)record->caller,
+                   (NULL != name) ? name : "no supervised task");
+            break;
+
+        default:
+            printf("unknown cause %lu\r\n", (unsigned long)record->cause);
+            break;
+    }
+}
+
+/* [] END OF FILE */
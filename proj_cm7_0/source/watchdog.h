@@ -0,0 +1,140 @@
+/******************************************************************************
+* File Name:   watchdog.h
+*
+* Description: Watchdog service of CM7_0. The code that can hang is split in
+*              supervised tasks, each with a deadline budget (deadline.h):
+*              a pass of the demo loop, the hold of a button, the console
+*              flush before a low-power mode and the QSPI memory operations.
+*              A periodic tick checks the task in progress and kicks the
+*              hardware watchdog only while it is within its budget. A task
+*              over budget, handle_error() or a failed QSPI status stop the
+*              kicks, and the watchdog resets the device; so do interrupts
+*              blocked for longer than the watchdog timeout. The task and how
+*              long it ran are kept in backup registers across the reset and
+*              printed at the next boot. Compiled out with WATCHDOG=0, and
+*              not started in the benchmark build.
+*
+*              Usage:
+*                watchdog_checkin(WATCHDOG_TASK_DEMO);  each pass of a loop
+*                watchdog_end(WATCHDOG_TASK_DEMO);      before an idle wait
+*                WATCHDOG_SCOPE(WATCHDOG_TASK_QSPI)     around a call
+*                {
+*                    ...
+*                }
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _WATCHDOG_H_
+#define _WATCHDOG_H_
+
+#include "cy_pdl.h"
+#include "deadline.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Watchdog build switch, set by the WATCHDOG make variable */
+#ifndef WATCHDOG
+#define WATCHDOG                    (1)
+#endif
+
+/* Hardware watchdog timeout, and period of the tick that checks the tasks
+ * and kicks it */
+#define WATCHDOG_TIMEOUT_MS         (1000u)
+#define WATCHDOG_TICK_MS            (100u)
+
+/* Deadline budgets of the tasks */
+#define WATCHDOG_BUDGET_DEMO_MS     (5000u)
+#define WATCHDOG_BUDGET_BUTTON_MS   (30000u)
+#define WATCHDOG_BUDGET_FLUSH_MS    (2000u)
+#define WATCHDOG_BUDGET_QSPI_MS     (5000u)
+
+/* Supervises the statement or block that follows as a run of task. Leaving
+ * it with return or break leaves the run open until the task ends again. */
+#define WATCHDOG_SCOPE(task)        \
+    for (uint32_t watchdog_scope_once = (watchdog_begin(task), 1u); \
+         0u != watchdog_scope_once; \
+         watchdog_end(task), watchdog_scope_once = 0u)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+/* Supervised tasks */
+typedef enum
+{
+    WATCHDOG_TASK_DEMO      = 0u,   /* One pass of the loop of a demo */
+    WATCHDOG_TASK_BUTTON    = 1u,   /* Hold of USER BTN1 in the power modes demo */
+    WATCHDOG_TASK_FLUSH     = 2u,   /* Console flush before a low-power mode */
+    WATCHDOG_TASK_QSPI      = 3u,   /* QSPI memory operation */
+    WATCHDOG_TASK_NUM       = 4u,
+} watchdog_task_t;
+
+/* Cause of the last watchdog reset */
+typedef enum
+{
+    WATCHDOG_CAUSE_NONE     = 0u,
+    WATCHDOG_CAUSE_RUNNING  = 1u,   /* Ticks stopped: interrupts blocked in the task */
+    WATCHDOG_CAUSE_DEADLINE = 2u,   /* The task overran its budget */
+    WATCHDOG_CAUSE_ERROR    = 3u,   /* handle_error() or a failed status in the task */
+} watchdog_cause_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Record of the last watchdog reset */
+typedef struct
+{
+    watchdog_cause_t cause;
+    uint32_t         task;          /* DEADLINE_NO_TASK outside any task */
+    uint32_t         ran_ms;        /* Run of the task at the last tick */
+    uint32_t         budget_ms;
+    uint32_t         caller;        /* Return address of the error handler */
+} watchdog_record_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t watchdog_init(void);
+extern void watchdog_begin(watchdog_task_t task);
+extern void watchdog_end(watchdog_task_t task);
+extern void watchdog_checkin(watchdog_task_t task);
+extern void watchdog_suspend(void);
+extern void watchdog_resume(void);
+extern void watchdog_fault(uint32_t caller);
+extern const watchdog_record_t *watchdog_last_reset(void);
+extern void watchdog_print_reset(void);
+extern void watchdog_print(void);
+
+#endif
@@ -1,8 +1,8 @@
 /******************************************************************************
 * File Name:   main.c
 *
-* Description: This is the source code for CM7_1 in the the Multi Core Empty
-*              Application for ModusToolbox.
+* Description: This is the source code for CM7_1 of the XMC7000 Out of Box
+*              demo. CM7_1 executes the work offloaded by CM7_0.
 *
 * Related Document: See README.md
 *
@@ -43,11 +43,47 @@
 #include "cy_pdl.h"
 #include "cyhal.h"
 #include "cybsp.h"
+#include "ipc_comm.h"
+#include "ipc_logger.h"
+#include "mem_guard.h"
+#include "offload_worker.h"
 
 
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Doorbell interrupt, on a CPU interrupt line not used by the HAL */
+#define IPC_DOORBELL_CPU_IRQ        (NvicMux4_IRQn)
+#define IPC_DOORBELL_PRIORITY       (4u)
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* The main function of CM7_1 performs the following actions:
+*  1. Paints the stack for the high-water mark.
+*  2. Waits until CM7_0 publishes the inter-processor shared block.
+*  3. Attaches to the cross-core log.
+*  4. Executes the requests offloaded by CM7_0 and returns the responses.
+*  5. Publishes its memory record and sleeps until the next doorbell
+*     interrupt when there is no request.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  int
+*
+*******************************************************************************/
 int main(void)
 {
     cy_rslt_t result;
+    ipc_shared_t *shared;
+    uint32_t intr_status;
+
+    /* Paint the unused stack before anything runs on it */
+    mem_guard_stack_paint();
 
     /* Initialize the device and board peripherals */
     result = cybsp_init() ;
@@ -58,10 +94,31 @@ int main(void)
 
     /* Enable global interrupts */
     __enable_irq();
-        
+
+    /* Wait for CM7_0 to publish the shared block */
+    while (NULL == (shared = ipc_comm_attach()))
+    {
+        Cy_SysLib_Delay(1u);
+    }
+    ipc_comm_doorbell_init(IPC_CORE_CM7_1, IPC_DOORBELL_CPU_IRQ, IPC_DOORBELL_PRIORITY, NULL);
+    ipc_logger_attach(shared, IPC_CORE_CM7_1);
+    ipc_comm_set_flag(&shared->cm7_1_ready, 1u);
+    ipc_logger_printf("offload worker ready");
+
     for (;;)
     {
-        Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        if (0u == offload_worker_poll(shared))
+        {
+            mem_guard_idle(&shared->memory[IPC_CORE_CM7_1]);
+
+            /* A doorbell that rings after the check keeps the WFI from sleeping */
+            intr_status = Cy_SysLib_EnterCriticalSection();
+            if (!ipc_comm_doorbell_pending())
+            {
+                __WFI();
+            }
+            Cy_SysLib_ExitCriticalSection(intr_status);
+        }
     }
 }
 
@@ -0,0 +1,273 @@
+/*******************************************************************************
+* File Name:   offload_worker.c
+*
+* Description: CM7_1 worker that executes the requests offloaded by CM7_0:
+*              ADC sample filtering, CRC-32 verification and CAN frame processing.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "offload_worker.h"
+#include "ipc_offload_msg.h"
+#include "crc32.h"
+#include "ipc_logger.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void offload_worker_handle(const ipc_msg_t *req, ipc_msg_t *rsp);
+static bool offload_adc_filter(const ipc_msg_t *req, ipc_msg_t *rsp);
+static bool offload_crc32(const ipc_msg_t *req, ipc_msg_t *rsp);
+static bool offload_can_frame(const ipc_msg_t *req, ipc_msg_t *rsp);
+
+
+/*******************************************************************************
+* Function Name: offload_worker_poll
+********************************************************************************
+* Summary:
+*  Executes every queued request and queues the responses. Rings the CM7_0
+*  doorbell once per batch. CM7_0 never has more requests in flight than the
+*  response ring holds, so queuing a response does not block.
+*
+* Parameters:
+*  shared: shared block published by CM7_0
+*
+* Return:
+*  uint32_t: number of requests executed
+*
+*******************************************************************************/
+uint32_t offload_worker_poll(ipc_shared_t *shared)
+{
+    ipc_msg_t req;
+    ipc_msg_t rsp;
+    uint32_t handled = 0u;
+
+    while (ipc_ring_pop(&shared->to_cm7_1, &req))
+    {
+        offload_worker_handle(&req, &rsp);
+        while (!ipc_ring_push(&shared->to_cm7_0, &rsp))
+        {
+        }
+        handled++;
+    }
+
+    if (0u != handled)
+    {
+        ipc_comm_ring_doorbell(IPC_CORE_CM7_0);
+    }
+
+    return handled;
+}
+
+/*******************************************************************************
+* Function Name: offload_worker_handle
+********************************************************************************
+* Summary:
+*  Executes one request. The response echoes the sequence number and the
+*  timestamp of the request.
+*
+* Parameters:
+*  req: request
+*  rsp: response
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void offload_worker_handle(const ipc_msg_t *req, ipc_msg_t *rsp)
+{
+    bool valid;
+
+    memset(rsp, 0, sizeof(ipc_msg_t));
+    rsp->seq = req->seq;
+    rsp->stamp = req->stamp;
+
+    switch (req->opcode)
+    {
+        case IPC_OP_ECHO:
+            rsp->length = req->length;
+            memcpy(rsp->payload, req->payload, IPC_MSG_PAYLOAD_SIZE);
+            valid = true;
+            break;
+
+        case IPC_OP_ADC_FILTER:
+            valid = offload_adc_filter(req, rsp);
+            break;
+
+        case IPC_OP_CRC32:
+            valid = offload_crc32(req, rsp);
+            break;
+
+        case IPC_OP_CAN_FRAME:
+            valid = offload_can_frame(req, rsp);
+            break;
+
+        default:
+            valid = false;
+            break;
+    }
+
+    if (!valid)
+    {
+        ipc_logger_printf("rejected request %lu, opcode 0x%04x",
+                          (unsigned long)req->seq, (unsigned int)req->opcode);
+    }
+    rsp->opcode = req->opcode | IPC_OP_RESPONSE | (valid ? 0u : IPC_OP_ERROR);
+}
+
+/*******************************************************************************
+* Function Name: offload_adc_filter
+********************************************************************************
+* Summary:
+*  Reduces a block of ADC samples to its mean, minimum and maximum.
+*
+* Parameters:
+*  req: ADC filter request
+*  rsp: response
+*
+* Return:
+*  false if the request is malformed
+*
+*******************************************************************************/
+static bool offload_adc_filter(const ipc_msg_t *req, ipc_msg_t *rsp)
+{
+    ipc_adc_filter_req_t in;
+    ipc_adc_filter_rsp_t out;
+    int32_t sum = 0;
+
+    memcpy(&in, req->payload, sizeof(in));
+    if ((0u == in.count) || (in.count > IPC_ADC_FILTER_MAX))
+    {
+        return false;
+    }
+
+    out.min = in.sample[0];
+    out.max = in.sample[0];
+    for (uint32_t idx = 0; idx < in.count; idx++)
+    {
+        sum += in.sample[idx];
+        if (in.sample[idx] < out.min)
+        {
+            out.min = in.sample[idx];
+        }
+        if (in.sample[idx] > out.max)
+        {
+            out.max = in.sample[idx];
+        }
+    }
+    out.mean = sum / (int32_t)in.count;
+
+    rsp->length = sizeof(out);
+    memcpy(rsp->payload, &out, sizeof(out));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: offload_crc32
+********************************************************************************
+* Summary:
+*  Calculates the CRC-32 of an SRAM buffer of CM7_0 and compares it with the
+*  expected value. The stale lines of the buffer are discarded from the CM7_1
+*  D-cache first; CM7_1 never writes the buffer.
+*
+* Parameters:
+*  req: CRC-32 request
+*  rsp: response
+*
+* Return:
+*  false if the request is malformed
+*
+*******************************************************************************/
+static bool offload_crc32(const ipc_msg_t *req, ipc_msg_t *rsp)
+{
+    ipc_crc32_req_t in;
+    ipc_crc32_rsp_t out;
+    const uint8_t *buf;
+
+    memcpy(&in, req->payload, sizeof(in));
+    if ((0u == in.addr) || (0u == in.length))
+    {
+        return false;
+    }
+
+    buf = (const uint8_t *)(uintptr_t)in.addr;
+    ipc_cache_invalidate((volatile void *)buf, in.length);
+    out.crc = crc32_compute(buf, in.length);
+    out.match = (out.crc == in.expected) ? 1u : 0u;
+
+    rsp->length = sizeof(out);
+    memcpy(rsp->payload, &out, sizeof(out));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: offload_can_frame
+********************************************************************************
+* Summary:
+*  Processes a received CAN frame into the frame to send back: every data
+*  byte is incremented, as done by the CAN FD loopback demo.
+*
+* Parameters:
+*  req: CAN frame request
+*  rsp: response carrying the processed frame
+*
+* Return:
+*  false if the request is malformed
+*
+*******************************************************************************/
+static bool offload_can_frame(const ipc_msg_t *req, ipc_msg_t *rsp)
+{
+    ipc_can_frame_t frame;
+
+    memcpy(&frame, req->payload, sizeof(frame));
+    if (frame.dlc > IPC_CAN_DATA_MAX)
+    {
+        return false;
+    }
+
+    for (uint32_t idx = 0; idx < frame.dlc; idx++)
+    {
+        frame.data[idx] += 1u;
+    }
+
+    rsp->length = sizeof(frame);
+    memcpy(rsp->payload, &frame, sizeof(frame));
+    return true;
+}
+
+/* [] END OF FILE */
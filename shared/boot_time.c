@@ -0,0 +1,360 @@
+/*******************************************************************************
+* File Name:   boot_time.c
+*
+* Description: Boot-phase timing. The timebase is a 32-bit TCPWM counter at
+*              1 MHz that CM0+ starts with the PDL as soon as cybsp_init() has
+*              configured the clocks, so it runs before any M7 core is
+*              released. CM0+ publishes the address of its boot record in the
+*              BOOT_TIME_CHAN_ADDR channel; CM7_0 reads it when it prints the
+*              table. When CM0+ did not publish a record (CM7_0 debugged on its
+*              own, host simulation), CM7_0 starts the timebase itself and the
+*              CM0+ phases are reported as not reached.
+*
+*              Reset to the CM0+ clock setup is not measured: no counter runs
+*              across the reset.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include "cyhal.h"
+#include "boot_time.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Timebase counter, a 32-bit counter of TCPWM group 1 next to the log timebase */
+#define BOOT_TIME_TCPWM             (TCPWM0)
+#define BOOT_TIME_GROUP             (1u)
+#define BOOT_TIME_CNT               (1u)
+#define BOOT_TIME_NUM               ((BOOT_TIME_GROUP << 8) | BOOT_TIME_CNT)
+#define BOOT_TIME_PCLK              (PCLK_TCPWM0_CLOCKS257)
+
+/* 16-bit divider of the timebase, set with the PDL because the HAL of CM0+
+ * does not know the reservations of CM7_0. CM7_0 reserves it in its HAL. */
+#define BOOT_TIME_DIVIDER           (7u)
+#define BOOT_TIME_HZ                (1000000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Phases recorded by the calling core */
+static boot_time_record_t boot_time_record =
+{
+    .magic   = 0u,
+    .mark_us = { [0 ... (BOOT_PHASE_NUM - 1u)] = BOOT_TIME_NOT_REACHED },
+};
+
+/* Boot record of CM0+, CM7_0 only, NULL if CM0+ did not publish one */
+static boot_time_record_t *boot_time_cm0p = NULL;
+
+/* Phase names of the table */
+static const char *const boot_time_phase_name[BOOT_PHASE_NUM] =
+{
+    [BOOT_PHASE_CM0P_BSP]      = "CM0+ clocks, timebase start",
+    [BOOT_PHASE_CM0P_CM7_0]    = "CM0+ released CM7_0",
+    [BOOT_PHASE_CM0P_CM7_1]    = "CM0+ released CM7_1",
+    [BOOT_PHASE_CM7_0_MAIN]    = "CM7_0 main()",
+    [BOOT_PHASE_CM7_0_BSP]     = "CM7_0 placement, cybsp_init",
+    [BOOT_PHASE_CM7_0_PARAMS]  = "CM7_0 parameter snapshot",
+    [BOOT_PHASE_CM7_0_CONSOLE] = "CM7_0 debug UART",
+    [BOOT_PHASE_CM7_0_IPC]     = "CM7_0 IPC shared block",
+    [BOOT_PHASE_CM7_0_DEMO]    = "CM7_0 banner, demo entry",
+    [BOOT_PHASE_CM7_0_POLL]    = "CM7_0 first demo poll",
+};
+
+/* Free-running counter of the timebase */
+static const cy_stc_tcpwm_counter_config_t boot_time_timebase_config =
+{
+    .period           = 0xFFFFFFFFu,
+    .clockPrescaler   = CY_TCPWM_COUNTER_PRESCALER_DIVBY_1,
+    .runMode          = CY_TCPWM_COUNTER_CONTINUOUS,
+    .countDirection   = CY_TCPWM_COUNTER_COUNT_UP,
+    .compareOrCapture = CY_TCPWM_COUNTER_MODE_CAPTURE,
+    .interruptSources = CY_TCPWM_INT_NONE,
+    .captureInputMode = CY_TCPWM_INPUT_LEVEL,
+    .captureInput     = CY_TCPWM_INPUT_0,
+    .reloadInputMode  = CY_TCPWM_INPUT_LEVEL,
+    .reloadInput      = CY_TCPWM_INPUT_0,
+    .startInputMode   = CY_TCPWM_INPUT_LEVEL,
+    .startInput       = CY_TCPWM_INPUT_0,
+    .stopInputMode    = CY_TCPWM_INPUT_LEVEL,
+    .stopInput        = CY_TCPWM_INPUT_0,
+    .countInputMode   = CY_TCPWM_INPUT_LEVEL,
+    .countInput       = CY_TCPWM_INPUT_1,
+};
+
+
+/*******************************************************************************
+* Function Name: boot_time_timebase_start
+********************************************************************************
+* Summary:
+*  Clocks the timebase counter at BOOT_TIME_HZ from its divider and starts it.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void boot_time_timebase_start(void)
+{
+    uint32_t source_hz;
+
+    /* Divide by 1 first to read the frequency of the peripheral clock group */
+    (void)Cy_SysClk_PeriPclkSetDivider(BOOT_TIME_PCLK, CY_SYSCLK_DIV_16_BIT, BOOT_TIME_DIVIDER, 0u);
+    source_hz = Cy_SysClk_PeriPclkGetFrequency(BOOT_TIME_PCLK, CY_SYSCLK_DIV_16_BIT, BOOT_TIME_DIVIDER);
+    (void)Cy_SysClk_PeriPclkSetDivider(BOOT_TIME_PCLK, CY_SYSCLK_DIV_16_BIT, BOOT_TIME_DIVIDER,
+                                       (source_hz / BOOT_TIME_HZ) - 1u);
+    (void)Cy_SysClk_PeriPclkEnableDivider(BOOT_TIME_PCLK, CY_SYSCLK_DIV_16_BIT, BOOT_TIME_DIVIDER);
+    (void)Cy_SysClk_PeriPclkAssignDivider(BOOT_TIME_PCLK, CY_SYSCLK_DIV_16_BIT, BOOT_TIME_DIVIDER);
+
+    (void)Cy_TCPWM_Counter_Init(BOOT_TIME_TCPWM, BOOT_TIME_NUM, &boot_time_timebase_config);
+    Cy_TCPWM_Counter_Enable(BOOT_TIME_TCPWM, BOOT_TIME_NUM);
+    Cy_TCPWM_TriggerStart_Single(BOOT_TIME_TCPWM, BOOT_TIME_NUM);
+}
+
+/*******************************************************************************
+* Function Name: boot_time_start
+********************************************************************************
+* Summary:
+*  Starts the timebase, records BOOT_PHASE_CM0P_BSP and publishes the boot
+*  record of CM0+. Called by CM0+ right after cybsp_init(), before the M7
+*  cores are released.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void boot_time_start(void)
+{
+    boot_time_timebase_start();
+    boot_time_mark(BOOT_PHASE_CM0P_BSP);
+    boot_time_record.magic = BOOT_TIME_MAGIC;
+
+    (void)Cy_IPC_Drv_SendMsgWord(Cy_IPC_Drv_GetIpcBaseAddress(BOOT_TIME_CHAN_ADDR),
+                                 0u, (uint32_t)(uintptr_t)&boot_time_record);
+}
+
+/*******************************************************************************
+* Function Name: boot_time_attach
+********************************************************************************
+* Summary:
+*  Looks up the boot record of CM0+ and records BOOT_PHASE_CM7_0_MAIN. Starts
+*  the timebase if CM0+ did not. Called by CM7_0 first thing in main().
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void boot_time_attach(void)
+{
+    uint32_t addr;
+
+    if (CY_IPC_DRV_SUCCESS == Cy_IPC_Drv_ReadMsgWord(
+            Cy_IPC_Drv_GetIpcBaseAddress(BOOT_TIME_CHAN_ADDR), &addr))
+    {
+        boot_time_cm0p = (boot_time_record_t *)(uintptr_t)addr;
+    }
+    else
+    {
+        boot_time_timebase_start();
+    }
+
+    boot_time_mark(BOOT_PHASE_CM7_0_MAIN);
+}
+
+/*******************************************************************************
+* Function Name: boot_time_reserve
+********************************************************************************
+* Summary:
+*  Reserves the timebase counter and its divider in the HAL of CM7_0, so the
+*  demos cannot allocate them. Called after cybsp_init(), which clears the
+*  reservations.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or the HAL error
+*
+*******************************************************************************/
+cy_rslt_t boot_time_reserve(void)
+{
+    cy_rslt_t result;
+    const cyhal_resource_inst_t timebase_rsc =
+    {
+        CYHAL_RSC_TCPWM, BOOT_TIME_GROUP, BOOT_TIME_CNT
+    };
+    const cyhal_resource_inst_t divider_rsc =
+    {
+        CYHAL_RSC_CLOCK, CYHAL_CLOCK_BLOCK_PERIPHERAL1_16BIT, BOOT_TIME_DIVIDER
+    };
+
+    result = cyhal_hwmgr_reserve(&timebase_rsc);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_hwmgr_reserve(&divider_rsc);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: boot_time_now
+********************************************************************************
+* Summary:
+*  Reads the boot timebase.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: microseconds since the timebase started, wraps at 2^32
+*
+*******************************************************************************/
+uint32_t boot_time_now(void)
+{
+    return Cy_TCPWM_Counter_GetCounter(BOOT_TIME_TCPWM, BOOT_TIME_NUM);
+}
+
+/*******************************************************************************
+* Function Name: boot_time_mark
+********************************************************************************
+* Summary:
+*  Records the time a phase is reached. Only the first call of each phase
+*  counts, so marks can sit in loops and in code that runs again later.
+*
+* Parameters:
+*  phase: phase reached by the calling core
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void boot_time_mark(boot_phase_t phase)
+{
+    if ((phase < BOOT_PHASE_NUM) && (BOOT_TIME_NOT_REACHED == boot_time_record.mark_us[phase]))
+    {
+        boot_time_record.mark_us[phase] = boot_time_now();
+    }
+}
+
+/*******************************************************************************
+* Function Name: boot_time_print
+********************************************************************************
+* Summary:
+*  Prints the phases of CM0+ and CM7_0 in time order, with the time spent
+*  since the previous phase. Phases not reached yet, such as the init that a
+*  fast boot defers, are listed at the end.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void boot_time_print(void)
+{
+    uint32_t mark_us[BOOT_PHASE_NUM];
+    uint32_t order[BOOT_PHASE_NUM];
+    uint32_t reached = 0u;
+    uint32_t previous = 0u;
+
+    for (uint32_t phase = 0u; phase < BOOT_PHASE_NUM; phase++)
+    {
+        mark_us[phase] = boot_time_record.mark_us[phase];
+    }
+    if (NULL != boot_time_cm0p)
+    {
+        /* CM0+ has no data cache, drop the lines CM7_0 may hold */
+        ipc_cache_invalidate(boot_time_cm0p, sizeof(boot_time_record_t));
+        if (BOOT_TIME_MAGIC == boot_time_cm0p->magic)
+        {
+            for (uint32_t phase = BOOT_PHASE_CM0P_BSP; phase <= BOOT_PHASE_CM0P_CM7_1; phase++)
+            {
+                mark_us[phase] = boot_time_cm0p->mark_us[phase];
+            }
+        }
+    }
+
+    /* Insertion sort of the reached phases by time */
+    for (uint32_t phase = 0u; phase < BOOT_PHASE_NUM; phase++)
+    {
+        uint32_t pos = reached;
+
+        if (BOOT_TIME_NOT_REACHED == mark_us[phase])
+        {
+            continue;
+        }
+        while ((pos > 0u) && (mark_us[order[pos - 1u]] > mark_us[phase]))
+        {
+            order[pos] = order[pos - 1u];
+            pos--;
+        }
+        order[pos] = phase;
+        reached++;
+    }
+
+    printf("\r\nBoot phases (us since the %s)\r\n",
+           (BOOT_TIME_NOT_REACHED != mark_us[BOOT_PHASE_CM0P_BSP]) ? "CM0+ clock setup" : "CM7_0 main() entry");
+    printf("%-32s %10s %10s\r\n", "Phase", "At", "Delta");
+    for (uint32_t index = 0u; index < reached; index++)
+    {
+        uint32_t phase = order[index];
+
+        printf("%-32s %10lu %10lu\r\n", boot_time_phase_name[phase],
+               (unsigned long)mark_us[phase], (unsigned long)(mark_us[phase] - previous));
+        previous = mark_us[phase];
+    }
+    for (uint32_t phase = 0u; phase < BOOT_PHASE_NUM; phase++)
+    {
+        if (BOOT_TIME_NOT_REACHED == mark_us[phase])
+        {
+            printf("%-32s %10s %10s\r\n", boot_time_phase_name[phase], "-", "-");
+        }
+    }
+    printf("\r\n");
+}
+
+/* [] END OF FILE */
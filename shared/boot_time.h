@@ -0,0 +1,100 @@
+/******************************************************************************
+* File Name:   boot_time.h
+*
+* Description: Boot-phase timing. CM0+ starts a TCPWM counter right after its
+*              clocks are configured and records the release of the M7 cores.
+*              CM7_0 records its own phases on the same counter and prints the
+*              merged per-phase table.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _BOOT_TIME_H_
+#define _BOOT_TIME_H_
+
+#include "cy_pdl.h"
+#include "ipc_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* IPC channel holding the address of the CM0+ boot record, locked for ever */
+#define BOOT_TIME_CHAN_ADDR         (CY_IPC_CHAN_USER + 2u)
+
+/* Marks a boot record written by CM0+ */
+#define BOOT_TIME_MAGIC             (0x544F4F42u)
+
+/* Value of a phase that was not reached yet */
+#define BOOT_TIME_NOT_REACHED       (0xFFFFFFFFu)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+/* Boot phases, in boot order */
+typedef enum
+{
+    BOOT_PHASE_CM0P_BSP = 0u,       /* CM0+ clocks configured, timebase started */
+    BOOT_PHASE_CM0P_CM7_0,          /* CM0+ released CM7_0 */
+    BOOT_PHASE_CM0P_CM7_1,          /* CM0+ released CM7_1 */
+    BOOT_PHASE_CM7_0_MAIN,          /* CM7_0 entered main() */
+    BOOT_PHASE_CM7_0_BSP,           /* CM7_0 TCM placement and cybsp_init() done */
+    BOOT_PHASE_CM7_0_PARAMS,        /* Demo parameters loaded from the work flash */
+    BOOT_PHASE_CM7_0_CONSOLE,       /* Debug UART ready */
+    BOOT_PHASE_CM7_0_IPC,           /* Shared block published, may be deferred */
+    BOOT_PHASE_CM7_0_DEMO,          /* Banner printed or skipped, demo entered */
+    BOOT_PHASE_CM7_0_POLL,          /* First poll of the demo loop */
+    BOOT_PHASE_NUM
+} boot_phase_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Phase timestamps of one core, in microseconds of the boot timebase */
+typedef struct
+{
+    volatile uint32_t magic;
+    volatile uint32_t mark_us[BOOT_PHASE_NUM];
+} __attribute__((aligned(IPC_RING_CACHE_LINE))) boot_time_record_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void boot_time_start(void);
+extern void boot_time_attach(void);
+extern cy_rslt_t boot_time_reserve(void);
+extern uint32_t boot_time_now(void);
+extern void boot_time_mark(boot_phase_t phase);
+extern void boot_time_print(void);
+
+#endif
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* File Name:   crc32.c
+*
+* Description: CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320) calculation
+*              with a 16-entry nibble table, small enough for every core.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "crc32.h"
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint32_t crc32_nibble_table[16] =
+{
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu,
+};
+
+
+/*******************************************************************************
+* Function Name: crc32_compute
+********************************************************************************
+* Summary:
+*  Calculates the CRC-32 of a buffer.
+*
+* Parameters:
+*  data: buffer
+*  length: size of the buffer in bytes
+*
+* Return:
+*  uint32_t: CRC-32 of the buffer
+*
+*******************************************************************************/
+uint32_t crc32_compute(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for (uint32_t index = 0; index < length; index++)
+    {
+        crc ^= data[index];
+        crc = (crc >> 4) ^ crc32_nibble_table[crc & 0x0Fu];
+        crc = (crc >> 4) ^ crc32_nibble_table[crc & 0x0Fu];
+    }
+
+    return crc ^ 0xFFFFFFFFu;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,290 @@
+/*******************************************************************************
+* File Name:   ipc_comm.c
+*
+* Description: Inter-processor communication between the CPU cores. CM7_0 owns
+*              the shared block and publishes its address in a locked IPC channel;
+*              the other cores read the address from the channel. Each core has an
+*              IPC interrupt structure that is used as a doorbell for new messages.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "ipc_comm.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void ipc_comm_doorbell_isr(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* IPC interrupt structure of the calling core */
+static uint32_t ipc_comm_self_intr;
+/* Set by the doorbell interrupt, cleared by ipc_comm_doorbell_pending() */
+static volatile bool ipc_comm_doorbell_flag = false;
+/* Optional handler run by the doorbell interrupt */
+static ipc_comm_callback_t ipc_comm_doorbell_callback = NULL;
+
+/* IPC interrupt structure index of each core */
+static const uint32_t ipc_comm_core_intr[] =
+{
+    [IPC_CORE_CM0P]  = IPC_INTR_CM0P,
+    [IPC_CORE_CM7_0] = IPC_INTR_CM7_0,
+    [IPC_CORE_CM7_1] = IPC_INTR_CM7_1,
+};
+
+
+/*******************************************************************************
+* Function Name: ipc_comm_publish
+********************************************************************************
+* Summary:
+*  Initializes the rings of the shared block and publishes its address in the
+*  IPC_CHAN_SHARED_ADDR channel. Called once by CM7_0. The channel stays
+*  locked, so any number of cores can read the address.
+*
+* Parameters:
+*  shared: shared block in SRAM (not TCM)
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, or the IPC driver status if the channel is busy
+*
+*******************************************************************************/
+cy_rslt_t ipc_comm_publish(ipc_shared_t *shared)
+{
+    cy_en_ipcdrv_status_t status;
+    uint32_t core;
+
+    ipc_ring_init(&shared->to_cm7_1);
+    ipc_ring_init(&shared->to_cm7_0);
+    ipc_ring_init(&shared->io_to_cm7_0);
+    ipc_ring_init(&shared->console_to_cm0p);
+    ipc_comm_set_flag(&shared->cm7_1_ready, 0u);
+    ipc_comm_set_flag(&shared->cm0p_ready, 0u);
+    for (core = 0u; core < IPC_CORE_NUM; core++)
+    {
+        ipc_comm_set_flag(&shared->memory[core].magic, 0u);
+    }
+    ipc_comm_set_flag(&shared->magic, IPC_SHARED_MAGIC);
+
+    status = Cy_IPC_Drv_SendMsgWord(Cy_IPC_Drv_GetIpcBaseAddress(IPC_CHAN_SHARED_ADDR),
+                                    0u, (uint32_t)(uintptr_t)shared);
+
+    return (CY_IPC_DRV_SUCCESS == status) ? CY_RSLT_SUCCESS : (cy_rslt_t)status;
+}
+
+/*******************************************************************************
+* Function Name: ipc_comm_attach
+********************************************************************************
+* Summary:
+*  Returns the shared block published by CM7_0.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  ipc_shared_t*: shared block, or NULL if it is not published yet
+*
+*******************************************************************************/
+ipc_shared_t *ipc_comm_attach(void)
+{
+    uint32_t addr;
+    ipc_shared_t *shared;
+
+    if (CY_IPC_DRV_SUCCESS != Cy_IPC_Drv_ReadMsgWord(
+            Cy_IPC_Drv_GetIpcBaseAddress(IPC_CHAN_SHARED_ADDR), &addr))
+    {
+        return NULL;
+    }
+
+    shared = (ipc_shared_t *)(uintptr_t)addr;
+    if (IPC_SHARED_MAGIC != ipc_comm_get_flag(&shared->magic))
+    {
+        return NULL;
+    }
+
+    return shared;
+}
+
+/*******************************************************************************
+* Function Name: ipc_comm_doorbell_init
+********************************************************************************
+* Summary:
+*  Enables the doorbell interrupt of the calling core.
+*
+* Parameters:
+*  self: calling core
+*  cpu_irq: CPU interrupt line the IPC interrupt is routed to
+*  priority: interrupt priority
+*  callback: handler run by the doorbell interrupt, or NULL
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_comm_doorbell_init(ipc_core_t self, IRQn_Type cpu_irq, uint32_t priority,
+                            ipc_comm_callback_t callback)
+{
+    cy_stc_sysint_t ipc_irq_cfg;
+
+    ipc_comm_self_intr = ipc_comm_core_intr[self];
+    ipc_comm_doorbell_callback = callback;
+
+    ipc_irq_cfg.intrSrc = ((uint32_t)cpu_irq << 16) |
+                          (uint32_t)(cpuss_interrupts_ipc_0_IRQn + ipc_comm_self_intr);
+    ipc_irq_cfg.intrPriority = priority;
+
+    Cy_IPC_Drv_SetInterruptMask(Cy_IPC_Drv_GetIntrBaseAddr(ipc_comm_self_intr),
+                                0u, 1u << IPC_CHAN_DOORBELL);
+    (void) Cy_SysInt_Init(&ipc_irq_cfg, &ipc_comm_doorbell_isr);
+    NVIC_EnableIRQ(cpu_irq);
+}
+
+/*******************************************************************************
+* Function Name: ipc_comm_ring_doorbell
+********************************************************************************
+* Summary:
+*  Generates a doorbell interrupt on another core.
+*
+* Parameters:
+*  target: core to notify
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_comm_ring_doorbell(ipc_core_t target)
+{
+    /* Make the ring updates visible before the interrupt */
+    __DSB();
+    Cy_IPC_Drv_AcquireNotify(Cy_IPC_Drv_GetIpcBaseAddress(IPC_CHAN_DOORBELL),
+                             1u << ipc_comm_core_intr[target]);
+}
+
+/*******************************************************************************
+* Function Name: ipc_comm_doorbell_pending
+********************************************************************************
+* Summary:
+*  Returns and clears the doorbell flag of the calling core.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  true if the doorbell rang since the last call
+*
+*******************************************************************************/
+bool ipc_comm_doorbell_pending(void)
+{
+    bool pending = ipc_comm_doorbell_flag;
+
+    if (pending)
+    {
+        ipc_comm_doorbell_flag = false;
+    }
+    return pending;
+}
+
+/*******************************************************************************
+* Function Name: ipc_comm_set_flag
+********************************************************************************
+* Summary:
+*  Writes a word of the shared block that is written by the calling core only
+*  and makes it visible to the other cores.
+*
+* Parameters:
+*  flag: word in its own cache line
+*  value: value to write
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_comm_set_flag(volatile uint32_t *flag, uint32_t value)
+{
+    *flag = value;
+    ipc_cache_clean(flag, IPC_RING_CACHE_LINE);
+}
+
+/*******************************************************************************
+* Function Name: ipc_comm_get_flag
+********************************************************************************
+* Summary:
+*  Reads a word of the shared block that is written by another core.
+*
+* Parameters:
+*  flag: word in its own cache line
+*
+* Return:
+*  uint32_t: current value in SRAM
+*
+*******************************************************************************/
+uint32_t ipc_comm_get_flag(volatile uint32_t *flag)
+{
+    ipc_cache_invalidate(flag, IPC_RING_CACHE_LINE);
+    return *flag;
+}
+
+/*******************************************************************************
+* Function Name: ipc_comm_doorbell_isr
+********************************************************************************
+* Summary:
+*  Doorbell interrupt handler. Clears the notify event, sets the flag and runs
+*  the registered callback.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void ipc_comm_doorbell_isr(void)
+{
+    IPC_INTR_STRUCT_Type *intr = Cy_IPC_Drv_GetIntrBaseAddr(ipc_comm_self_intr);
+    uint32_t masked = Cy_IPC_Drv_GetInterruptStatusMasked(intr);
+
+    Cy_IPC_Drv_ClearInterrupt(intr, 0u, Cy_IPC_Drv_ExtractAcquireMask(masked));
+    ipc_comm_doorbell_flag = true;
+
+    if (NULL != ipc_comm_doorbell_callback)
+    {
+        ipc_comm_doorbell_callback();
+    }
+}
+
+/* [] END OF FILE */
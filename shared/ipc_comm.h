@@ -0,0 +1,116 @@
+/******************************************************************************
+* File Name:   ipc_comm.h
+*
+* Description: Inter-processor communication between the CPU cores: shared SRAM
+*              block with the message rings, address publication and doorbell
+*              interrupts over the IPC channels.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _IPC_COMM_H_
+#define _IPC_COMM_H_
+
+#include "cy_pdl.h"
+#include "ipc_ring.h"
+#include "ipc_log.h"
+#include "mem_guard.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* IPC channel holding the address of the shared block, locked for ever */
+#define IPC_CHAN_SHARED_ADDR        (CY_IPC_CHAN_USER)
+/* IPC channel used to generate the doorbell notify events */
+#define IPC_CHAN_DOORBELL           (CY_IPC_CHAN_USER + 1u)
+
+/* IPC interrupt structure of each core */
+#define IPC_INTR_CM7_0              (CY_IPC_INTR_USER)
+#define IPC_INTR_CM7_1              (CY_IPC_INTR_USER + 1u)
+#define IPC_INTR_CM0P               (CY_IPC_INTR_USER + 2u)
+
+/* Number of cores, ipc_core_t */
+#define IPC_CORE_NUM                (3u)
+
+/* Marks an initialized shared block */
+#define IPC_SHARED_MAGIC            (0x4F4F4249u)
+
+/*******************************************************************************
+* Enumerated Types
+*******************************************************************************/
+typedef enum
+{
+    IPC_CORE_CM0P  = 0u,
+    IPC_CORE_CM7_0 = 1u,
+    IPC_CORE_CM7_1 = 2u,
+} ipc_core_t;
+
+/* Called from the doorbell interrupt of the calling core */
+typedef void (*ipc_comm_callback_t)(void);
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Shared block, owned and initialized by CM7_0 */
+typedef struct
+{
+    volatile uint32_t magic;                /* Written by CM7_0 */
+    uint8_t           magic_pad[IPC_RING_CACHE_LINE - sizeof(uint32_t)];
+    volatile uint32_t cm7_1_ready;          /* Written by CM7_1 */
+    uint8_t           cm7_1_ready_pad[IPC_RING_CACHE_LINE - sizeof(uint32_t)];
+    volatile uint32_t cm0p_ready;           /* Written by CM0+ (I/O co-processor) */
+    uint8_t           cm0p_ready_pad[IPC_RING_CACHE_LINE - sizeof(uint32_t)];
+    volatile uint32_t log_owner;            /* Core draining the logs, written by CM7_0 */
+    uint8_t           log_owner_pad[IPC_RING_CACHE_LINE - sizeof(uint32_t)];
+    ipc_ring_t        to_cm7_1;             /* CM7_0 requests to CM7_1 */
+    ipc_ring_t        to_cm7_0;             /* CM7_1 responses to CM7_0 */
+    ipc_ring_t        io_to_cm7_0;          /* CM0+ console and button events */
+    ipc_ring_t        console_to_cm0p;      /* CM7_0 console output */
+    ipc_log_ring_t    log[IPC_CORE_NUM];    /* Log ring of each core */
+    mem_guard_record_t memory[IPC_CORE_NUM]; /* Stack and heap record of each core */
+} ipc_shared_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t ipc_comm_publish(ipc_shared_t *shared);
+extern ipc_shared_t *ipc_comm_attach(void);
+extern void ipc_comm_doorbell_init(ipc_core_t self, IRQn_Type cpu_irq, uint32_t priority,
+                                   ipc_comm_callback_t callback);
+extern void ipc_comm_ring_doorbell(ipc_core_t target);
+extern bool ipc_comm_doorbell_pending(void);
+extern void ipc_comm_set_flag(volatile uint32_t *flag, uint32_t value);
+extern uint32_t ipc_comm_get_flag(volatile uint32_t *flag);
+
+#endif
@@ -0,0 +1,205 @@
+/*******************************************************************************
+* File Name:   ipc_io.c
+*
+* Description: Encoding of the console and button events of the CM0+ I/O
+*              co-processor. CM0+ parses the console input and debounces the
+*              buttons; CM7_0 only receives the resulting events.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "ipc_io.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static bool ipc_io_post(ipc_ring_t *ring, uint16_t type, uint8_t code, uint16_t held_ms);
+
+
+/*******************************************************************************
+* Function Name: ipc_io_post_key
+********************************************************************************
+* Summary:
+*  Console parser. Queues a demo selection for the keys '1'..'9' and a plain
+*  key event for any other character.
+*
+* Parameters:
+*  ring: CM0+ to CM7_0 event ring
+*  key: received character
+*
+* Return:
+*  true if the event was queued, false if the ring is full
+*
+*******************************************************************************/
+bool ipc_io_post_key(ipc_ring_t *ring, uint8_t key)
+{
+    uint16_t type = IPC_IO_EVT_KEY;
+
+    if ((key >= (uint8_t)IPC_IO_DEMO_KEY_FIRST) && (key <= (uint8_t)IPC_IO_DEMO_KEY_LAST))
+    {
+        type = IPC_IO_EVT_DEMO_SELECT;
+    }
+
+    return ipc_io_post(ring, type, key, 0u);
+}
+
+/*******************************************************************************
+* Function Name: ipc_io_post_button
+********************************************************************************
+* Summary:
+*  Queues a debounced button press.
+*
+* Parameters:
+*  ring: CM0+ to CM7_0 event ring
+*  button: IPC_IO_BUTTON1 or IPC_IO_BUTTON2
+*  held_ms: time the button was held down
+*
+* Return:
+*  true if the event was queued, false if the ring is full
+*
+*******************************************************************************/
+bool ipc_io_post_button(ipc_ring_t *ring, uint8_t button, uint16_t held_ms)
+{
+    return ipc_io_post(ring, IPC_IO_EVT_BUTTON, button, held_ms);
+}
+
+/*******************************************************************************
+* Function Name: ipc_io_get_event
+********************************************************************************
+* Summary:
+*  Decodes a message of the event ring.
+*
+* Parameters:
+*  msg: message popped from the ring
+*  type: returns the IPC_IO_EVT_* code
+*  event: returns the event payload
+*
+* Return:
+*  true if the message is a valid event
+*
+*******************************************************************************/
+bool ipc_io_get_event(const ipc_msg_t *msg, uint16_t *type, ipc_io_event_t *event)
+{
+    if ((msg->length != sizeof(ipc_io_event_t)) ||
+        (msg->opcode < IPC_IO_EVT_DEMO_SELECT) || (msg->opcode > IPC_IO_EVT_BUTTON))
+    {
+        return false;
+    }
+
+    *type = msg->opcode;
+    memcpy(event, msg->payload, sizeof(ipc_io_event_t));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: ipc_io_write_console
+********************************************************************************
+* Summary:
+*  Splits console output into IPC_IO_CONSOLE_TEXT messages and queues as many
+*  of them as the ring accepts.
+*
+* Parameters:
+*  ring: CM7_0 to CM0+ console ring
+*  text: characters to send
+*  length: number of characters
+*
+* Return:
+*  uint32_t: number of characters queued
+*
+*******************************************************************************/
+uint32_t ipc_io_write_console(ipc_ring_t *ring, const char *text, uint32_t length)
+{
+    ipc_msg_t msg;
+    uint32_t  sent = 0u;
+
+    msg.opcode = IPC_IO_CONSOLE_TEXT;
+    msg.seq = 0u;
+    msg.stamp = 0u;
+
+    while (sent < length)
+    {
+        uint32_t chunk = length - sent;
+
+        if (chunk > IPC_MSG_PAYLOAD_SIZE)
+        {
+            chunk = IPC_MSG_PAYLOAD_SIZE;
+        }
+
+        msg.length = (uint16_t)chunk;
+        memcpy(msg.payload, &text[sent], chunk);
+        if (!ipc_ring_push(ring, &msg))
+        {
+            break;
+        }
+        sent += chunk;
+    }
+
+    return sent;
+}
+
+/*******************************************************************************
+* Function Name: ipc_io_post
+********************************************************************************
+* Summary:
+*  Queues an event message.
+*
+* Parameters:
+*  ring: CM0+ to CM7_0 event ring
+*  type: IPC_IO_EVT_* code
+*  code: key or button number
+*  held_ms: button press duration
+*
+* Return:
+*  true if the event was queued, false if the ring is full
+*
+*******************************************************************************/
+static bool ipc_io_post(ipc_ring_t *ring, uint16_t type, uint8_t code, uint16_t held_ms)
+{
+    ipc_msg_t      msg;
+    ipc_io_event_t event = { .code = code, .reserved = 0u, .held_ms = held_ms };
+
+    msg.opcode = type;
+    msg.length = sizeof(event);
+    msg.seq = 0u;
+    msg.stamp = 0u;
+    memcpy(msg.payload, &event, sizeof(event));
+
+    return ipc_ring_push(ring, &msg);
+}
+
+/* [] END OF FILE */
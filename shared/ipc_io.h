@@ -0,0 +1,88 @@
+/******************************************************************************
+* File Name:   ipc_io.h
+*
+* Description: Console and button events forwarded by the CM0+ I/O co-processor
+*              to CM7_0, and the console output sent back from CM7_0 to CM0+.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _IPC_IO_H_
+#define _IPC_IO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ipc_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Event codes, CM0+ to CM7_0 */
+#define IPC_IO_EVT_DEMO_SELECT      (0x0101u)   /* Demo selection key '1'..'9' */
+#define IPC_IO_EVT_KEY              (0x0102u)   /* Any other console key */
+#define IPC_IO_EVT_BUTTON           (0x0103u)   /* Debounced button press, sent on release */
+
+/* Console output chunk, CM7_0 to CM0+ */
+#define IPC_IO_CONSOLE_TEXT         (0x0110u)
+
+/* Console keys that select a demo */
+#define IPC_IO_DEMO_KEY_FIRST       ('1')
+#define IPC_IO_DEMO_KEY_LAST        ('9')
+
+/* Button numbers of IPC_IO_EVT_BUTTON */
+#define IPC_IO_BUTTON1              (1u)
+#define IPC_IO_BUTTON2              (2u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Payload of the IPC_IO_EVT_* messages */
+typedef struct
+{
+    uint8_t  code;                          /* Key, or button number */
+    uint8_t  reserved;
+    uint16_t held_ms;                       /* Button press duration */
+} ipc_io_event_t;
+
+_Static_assert(sizeof(ipc_io_event_t) <= IPC_MSG_PAYLOAD_SIZE, "IO event too large");
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern bool ipc_io_post_key(ipc_ring_t *ring, uint8_t key);
+extern bool ipc_io_post_button(ipc_ring_t *ring, uint8_t button, uint16_t held_ms);
+extern bool ipc_io_get_event(const ipc_msg_t *msg, uint16_t *type, ipc_io_event_t *event);
+extern uint32_t ipc_io_write_console(ipc_ring_t *ring, const char *text, uint32_t length);
+
+#endif
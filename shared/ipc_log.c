@@ -0,0 +1,344 @@
+/*******************************************************************************
+* File Name:   ipc_log.c
+*
+* Description: Per-core log rings in shared SRAM.
+*
+*              Writing never waits: a record is reserved in a short critical
+*              section (interrupts of the writing core may log as well), filled
+*              and committed by writing its sequence number last. A full ring
+*              counts the record as dropped instead of blocking.
+*
+*              On the Cortex-M7 cores the record is cleaned from the D-cache
+*              before the sequence number is written and cleaned again after,
+*              so a reader that sees the sequence number also sees the text.
+*              The reader invalidates the record before each read, except
+*              in the ring of its own core, whose D-cache holds the latest
+*              data.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "ipc_log.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(__arm__)
+/* Orders the record access against the sequence number and index updates */
+#define IPC_LOG_BARRIER()           __DMB()
+/* Serializes the writers of one core */
+#define IPC_LOG_LOCK(status)        ((status) = Cy_SysLib_EnterCriticalSection())
+#define IPC_LOG_UNLOCK(status)      Cy_SysLib_ExitCriticalSection(status)
+#else
+#define IPC_LOG_BARRIER()           __atomic_thread_fence(__ATOMIC_SEQ_CST)
+/* One writer thread per ring */
+#define IPC_LOG_LOCK(status)        ((status) = 0u)
+#define IPC_LOG_UNLOCK(status)      ((void)(status))
+#endif
+
+#define IPC_LOG_MASK                (IPC_LOG_DEPTH - 1u)
+
+_Static_assert((IPC_LOG_DEPTH & IPC_LOG_MASK) == 0u, "IPC_LOG_DEPTH must be a power of 2");
+_Static_assert(sizeof(ipc_log_record_t) == IPC_LOG_RECORD_SIZE, "ipc_log_record_t size");
+_Static_assert(IPC_LOG_TEXT_SIZE <= UINT8_MAX, "length does not fit the record");
+
+
+/*******************************************************************************
+* Function Name: ipc_log_init
+********************************************************************************
+* Summary:
+*  Empties the ring. Called by one core before the other cores attach.
+*
+* Parameters:
+*  ring: ring in shared SRAM
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_log_init(ipc_log_ring_t *ring)
+{
+    memset(ring, 0, sizeof(ipc_log_ring_t));
+    ipc_cache_clean(ring, sizeof(ipc_log_ring_t));
+}
+
+/*******************************************************************************
+* Function Name: ipc_log_reserve
+********************************************************************************
+* Summary:
+*  Reserves the next record of the ring and stamps it. The timestamp is taken
+*  with the reservation, so the records of one ring are in timestamp order.
+*
+* Parameters:
+*  ring: ring of the calling core
+*  core: calling core, stored in the record
+*  clock: timestamp source
+*
+* Return:
+*  ipc_log_record_t*: record to fill and pass to ipc_log_commit(), or NULL if
+*  the ring is full (the record is counted as dropped)
+*
+*******************************************************************************/
+ipc_log_record_t *ipc_log_reserve(ipc_log_ring_t *ring, uint8_t core, ipc_log_clock_t clock)
+{
+    ipc_log_record_t *record = NULL;
+    uint32_t status;
+    uint32_t head;
+
+    IPC_LOG_LOCK(status);
+    ipc_cache_invalidate(&ring->tail, IPC_RING_CACHE_LINE);
+    head = ring->head;
+
+    if ((head - ring->tail) < IPC_LOG_DEPTH)
+    {
+        ring->head = head + 1u;
+        record = &ring->record[head & IPC_LOG_MASK];
+        record->index = head;
+        record->stamp = clock();
+        record->core = core;
+        record->length = 0u;
+        record->reserved = 0u;
+    }
+    else
+    {
+        ring->dropped++;
+        ipc_cache_clean(&ring->head, IPC_RING_CACHE_LINE);
+    }
+    IPC_LOG_UNLOCK(status);
+
+    return record;
+}
+
+/*******************************************************************************
+* Function Name: ipc_log_commit
+********************************************************************************
+* Summary:
+*  Publishes a record filled after ipc_log_reserve().
+*
+* Parameters:
+*  ring: ring of the calling core
+*  record: reserved record
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_log_commit(ipc_log_ring_t *ring, ipc_log_record_t *record)
+{
+    (void)ring;
+
+    ipc_cache_clean(record, sizeof(ipc_log_record_t));
+    IPC_LOG_BARRIER();
+    record->seq = record->index + 1u;
+    ipc_cache_clean(record, IPC_RING_CACHE_LINE);
+}
+
+/*******************************************************************************
+* Function Name: ipc_log_write
+********************************************************************************
+* Summary:
+*  Writes a message as one record. Longer messages are truncated.
+*
+* Parameters:
+*  ring: ring of the calling core
+*  core: calling core
+*  clock: timestamp source
+*  text: characters, not terminated
+*  length: number of characters
+*
+* Return:
+*  true if the record was written, false if it was dropped
+*
+*******************************************************************************/
+bool ipc_log_write(ipc_log_ring_t *ring, uint8_t core, ipc_log_clock_t clock,
+                   const char *text, uint32_t length)
+{
+    ipc_log_record_t *record = ipc_log_reserve(ring, core, clock);
+
+    if (NULL == record)
+    {
+        return false;
+    }
+
+    if (length > IPC_LOG_TEXT_SIZE)
+    {
+        length = IPC_LOG_TEXT_SIZE;
+    }
+    memcpy(record->text, text, length);
+    record->length = (uint8_t)length;
+    ipc_log_commit(ring, record);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: ipc_log_peek
+********************************************************************************
+* Summary:
+*  Copies the oldest committed record of a ring. Called by the owner core only.
+*  The ring of the owner core itself is read from its D-cache: invalidating
+*  it would discard a record that an interrupted writer of this core has
+*  reserved and not cleaned yet.
+*
+* Parameters:
+*  ring: ring of any core
+*  record: returns the copy
+*  local: true if ring is the ring of the calling core
+*
+* Return:
+*  true if a record was copied, false if the ring is empty or the next
+*  record is not committed yet
+*
+*******************************************************************************/
+bool ipc_log_peek(ipc_log_ring_t *ring, ipc_log_record_t *record, bool local)
+{
+    uint32_t tail = ring->tail;
+    ipc_log_record_t *slot = &ring->record[tail & IPC_LOG_MASK];
+
+    if (!local)
+    {
+        ipc_cache_invalidate(slot, sizeof(ipc_log_record_t));
+    }
+    if (slot->seq != (tail + 1u))
+    {
+        return false;
+    }
+
+    /* Lines fetched speculatively before the sequence number was seen are stale */
+    IPC_LOG_BARRIER();
+    if (!local)
+    {
+        ipc_cache_invalidate(slot, sizeof(ipc_log_record_t));
+    }
+    memcpy(record, slot, sizeof(ipc_log_record_t));
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: ipc_log_consume
+********************************************************************************
+* Summary:
+*  Releases the record returned by the last ipc_log_peek() to the writer.
+*
+* Parameters:
+*  ring: ring of any core
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_log_consume(ipc_log_ring_t *ring)
+{
+    IPC_LOG_BARRIER();
+    ring->tail = ring->tail + 1u;
+    ipc_cache_clean(&ring->tail, IPC_RING_CACHE_LINE);
+}
+
+/*******************************************************************************
+* Function Name: ipc_log_dropped
+********************************************************************************
+* Summary:
+*  Returns the number of records a core could not write.
+*
+* Parameters:
+*  ring: ring of any core
+*
+* Return:
+*  uint32_t: dropped records since the ring was initialized
+*
+*******************************************************************************/
+uint32_t ipc_log_dropped(ipc_log_ring_t *ring)
+{
+    ipc_cache_invalidate(&ring->head, IPC_RING_CACHE_LINE);
+    return ring->dropped;
+}
+
+/*******************************************************************************
+* Function Name: ipc_log_merge
+********************************************************************************
+* Summary:
+*  Passes the committed records of all the rings to the sink, oldest timestamp
+*  first, until the rings are empty. Called by the owner core only.
+*
+* Parameters:
+*  rings: rings to merge
+*  count: number of rings
+*  local: index in rings of the ring of the calling core, count if none
+*  sink: record output
+*  arg: sink argument
+*
+* Return:
+*  uint32_t: number of records passed to the sink
+*
+*******************************************************************************/
+uint32_t ipc_log_merge(ipc_log_ring_t *const rings[], uint32_t count, uint32_t local,
+                       ipc_log_sink_t sink, void *arg)
+{
+    ipc_log_record_t record;
+    ipc_log_record_t oldest;
+    uint32_t oldest_ring;
+    uint32_t merged = 0u;
+
+    for (;;)
+    {
+        oldest_ring = count;
+        for (uint32_t index = 0u; index < count; index++)
+        {
+            if (ipc_log_peek(rings[index], &record, index == local) &&
+                ((oldest_ring == count) || ((int32_t)(record.stamp - oldest.stamp) < 0)))
+            {
+                oldest = record;
+                oldest_ring = index;
+            }
+        }
+
+        if (oldest_ring == count)
+        {
+            break;
+        }
+
+        sink(&oldest, arg);
+        ipc_log_consume(rings[oldest_ring]);
+        merged++;
+    }
+
+    return merged;
+}
+
+/* [] END OF FILE */
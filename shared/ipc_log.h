@@ -0,0 +1,105 @@
+/******************************************************************************
+* File Name:   ipc_log.h
+*
+* Description: Per-core log rings in shared SRAM. Each core writes its own ring
+*              without waiting; one owner core merges the rings by timestamp.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _IPC_LOG_H_
+#define _IPC_LOG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ipc_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of records per ring, power of 2 */
+#define IPC_LOG_DEPTH               (32u)
+/* One record fills two cache lines */
+#define IPC_LOG_RECORD_SIZE         (2u * IPC_RING_CACHE_LINE)
+/* Characters per record, longer messages are truncated */
+#define IPC_LOG_TEXT_SIZE           (IPC_LOG_RECORD_SIZE - 16u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Log record. seq is written last: it holds the ring index + 1 once the
+ * record is complete, so the reader never sees a partly written record. */
+typedef struct
+{
+    volatile uint32_t seq;
+    uint32_t          index;                /* Ring index, set on reserve */
+    uint32_t          stamp;                /* Shared timebase */
+    uint8_t           core;                 /* Writing core, ipc_core_t */
+    uint8_t           length;               /* Valid characters in text */
+    uint16_t          reserved;
+    char              text[IPC_LOG_TEXT_SIZE];
+} __attribute__((aligned(IPC_RING_CACHE_LINE))) ipc_log_record_t;
+
+/* Ring of one core. The indices run freely and wrap at 2^32. */
+typedef struct
+{
+    uint32_t          head;                 /* Written by the writing core only */
+    volatile uint32_t dropped;              /* Records lost because the ring was full */
+    uint8_t           head_pad[IPC_RING_CACHE_LINE - (2u * sizeof(uint32_t))];
+    volatile uint32_t tail;                 /* Written by the owner core only */
+    uint8_t           tail_pad[IPC_RING_CACHE_LINE - sizeof(uint32_t)];
+    ipc_log_record_t  record[IPC_LOG_DEPTH];
+} __attribute__((aligned(IPC_RING_CACHE_LINE))) ipc_log_ring_t;
+
+/* Timestamp source of the writing core */
+typedef uint32_t (*ipc_log_clock_t)(void);
+
+/* Called by ipc_log_merge() for every record, oldest first */
+typedef void (*ipc_log_sink_t)(const ipc_log_record_t *record, void *arg);
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void ipc_log_init(ipc_log_ring_t *ring);
+extern ipc_log_record_t *ipc_log_reserve(ipc_log_ring_t *ring, uint8_t core, ipc_log_clock_t clock);
+extern void ipc_log_commit(ipc_log_ring_t *ring, ipc_log_record_t *record);
+extern bool ipc_log_write(ipc_log_ring_t *ring, uint8_t core, ipc_log_clock_t clock,
+                          const char *text, uint32_t length);
+extern bool ipc_log_peek(ipc_log_ring_t *ring, ipc_log_record_t *record, bool local);
+extern void ipc_log_consume(ipc_log_ring_t *ring);
+extern uint32_t ipc_log_dropped(ipc_log_ring_t *ring);
+extern uint32_t ipc_log_merge(ipc_log_ring_t *const rings[], uint32_t count, uint32_t local,
+                              ipc_log_sink_t sink, void *arg);
+
+#endif
@@ -0,0 +1,316 @@
+/*******************************************************************************
+* File Name:   ipc_logger.c
+*
+* Description: Cross-core logging. Every core writes to its own log ring in the
+*              shared block, so no core ever touches another core's UART. The
+*              core that owns the debug UART (CM7_0, or CM0+ when it runs as
+*              I/O co-processor) is notified through its doorbell and merges
+*              the rings by timestamp.
+*
+*              The timestamps come from one TCPWM counter started by CM7_0 and
+*              read by all cores, so they are monotonic across the cores.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include "cyhal.h"
+#include "ipc_logger.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Timebase counter, a 32-bit counter of TCPWM group 1 */
+#define IPC_LOGGER_TIMEBASE_TCPWM   (TCPWM0)
+#define IPC_LOGGER_TIMEBASE_GROUP   (1u)
+#define IPC_LOGGER_TIMEBASE_CNT     (0u)
+#define IPC_LOGGER_TIMEBASE_NUM     ((IPC_LOGGER_TIMEBASE_GROUP << 8) | IPC_LOGGER_TIMEBASE_CNT)
+#define IPC_LOGGER_TIMEBASE_PCLK    (PCLK_TCPWM0_CLOCKS256)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ipc_shared_t *ipc_logger_shared = NULL;
+static ipc_core_t    ipc_logger_self;
+
+/* Divider clocking the timebase counter, CM7_0 only */
+static cyhal_clock_t ipc_logger_clock;
+
+static const cy_stc_tcpwm_counter_config_t ipc_logger_timebase_config =
+{
+    .period           = 0xFFFFFFFFu,
+    .clockPrescaler   = CY_TCPWM_COUNTER_PRESCALER_DIVBY_1,
+    .runMode          = CY_TCPWM_COUNTER_CONTINUOUS,
+    .countDirection   = CY_TCPWM_COUNTER_COUNT_UP,
+    .compareOrCapture = CY_TCPWM_COUNTER_MODE_CAPTURE,
+    .interruptSources = CY_TCPWM_INT_NONE,
+    .captureInputMode = CY_TCPWM_INPUT_LEVEL,
+    .captureInput     = CY_TCPWM_INPUT_0,
+    .reloadInputMode  = CY_TCPWM_INPUT_LEVEL,
+    .reloadInput      = CY_TCPWM_INPUT_0,
+    .startInputMode   = CY_TCPWM_INPUT_LEVEL,
+    .startInput       = CY_TCPWM_INPUT_0,
+    .stopInputMode    = CY_TCPWM_INPUT_LEVEL,
+    .stopInput        = CY_TCPWM_INPUT_0,
+    .countInputMode   = CY_TCPWM_INPUT_LEVEL,
+    .countInput       = CY_TCPWM_INPUT_1,
+};
+
+static const char *const ipc_logger_core_name[] =
+{
+    [IPC_CORE_CM0P]  = "CM0+",
+    [IPC_CORE_CM7_0] = "CM7_0",
+    [IPC_CORE_CM7_1] = "CM7_1",
+};
+
+
+/*******************************************************************************
+* Function Name: ipc_logger_start
+********************************************************************************
+* Summary:
+*  Empties the log rings, selects the core that drains them and starts the
+*  shared timebase. Called by CM7_0 before the shared block is published. The
+*  timebase counter and its clock divider are reserved in the HAL, so the
+*  demos cannot allocate them.
+*
+* Parameters:
+*  shared: shared block, not published yet
+*  owner: core that owns the debug UART
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or the first HAL error
+*
+*******************************************************************************/
+cy_rslt_t ipc_logger_start(ipc_shared_t *shared, ipc_core_t owner)
+{
+    cy_rslt_t result;
+    const cyhal_resource_inst_t timebase_rsc =
+    {
+        CYHAL_RSC_TCPWM, IPC_LOGGER_TIMEBASE_GROUP, IPC_LOGGER_TIMEBASE_CNT
+    };
+
+    for (uint32_t core = 0u; core < IPC_CORE_NUM; core++)
+    {
+        ipc_log_init(&shared->log[core]);
+    }
+    ipc_comm_set_flag(&shared->log_owner, (uint32_t)owner);
+
+    result = cyhal_hwmgr_reserve(&timebase_rsc);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_clock_allocate(&ipc_logger_clock, CYHAL_CLOCK_BLOCK_PERIPHERAL1_16BIT);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_clock_set_frequency(&ipc_logger_clock, IPC_LOGGER_TIMEBASE_HZ, NULL);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_clock_set_enabled(&ipc_logger_clock, true, true);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    (void)Cy_SysClk_PeriPclkAssignDivider(IPC_LOGGER_TIMEBASE_PCLK, CY_SYSCLK_DIV_16_BIT,
+                                          ipc_logger_clock.channel);
+    (void)Cy_TCPWM_Counter_Init(IPC_LOGGER_TIMEBASE_TCPWM, IPC_LOGGER_TIMEBASE_NUM,
+                                &ipc_logger_timebase_config);
+    Cy_TCPWM_Counter_Enable(IPC_LOGGER_TIMEBASE_TCPWM, IPC_LOGGER_TIMEBASE_NUM);
+    Cy_TCPWM_TriggerStart_Single(IPC_LOGGER_TIMEBASE_TCPWM, IPC_LOGGER_TIMEBASE_NUM);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ipc_logger_attach
+********************************************************************************
+* Summary:
+*  Selects the log ring of the calling core. Messages logged before are lost.
+*
+* Parameters:
+*  shared: published shared block
+*  self: calling core
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_logger_attach(ipc_shared_t *shared, ipc_core_t self)
+{
+    ipc_logger_self = self;
+    ipc_logger_shared = shared;
+}
+
+/*******************************************************************************
+* Function Name: ipc_logger_now
+********************************************************************************
+* Summary:
+*  Reads the shared timebase.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: microseconds since CM7_0 started the timebase, wraps at 2^32
+*
+*******************************************************************************/
+uint32_t ipc_logger_now(void)
+{
+    return Cy_TCPWM_Counter_GetCounter(IPC_LOGGER_TIMEBASE_TCPWM, IPC_LOGGER_TIMEBASE_NUM);
+}
+
+/*******************************************************************************
+* Function Name: ipc_logger_printf
+********************************************************************************
+* Summary:
+*  Formats a message into the log ring of the calling core and notifies the
+*  owner core. Never waits: the message is dropped if the ring is full.
+*  Messages longer than IPC_LOG_TEXT_SIZE are truncated. May be called from
+*  interrupts; use integer conversions only.
+*
+* Parameters:
+*  format: printf format
+*  ...: format arguments
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_logger_printf(const char *format, ...)
+{
+    ipc_log_record_t *record;
+    va_list args;
+    int length;
+
+    if (NULL == ipc_logger_shared)
+    {
+        return;
+    }
+
+    record = ipc_log_reserve(&ipc_logger_shared->log[ipc_logger_self],
+                             (uint8_t)ipc_logger_self, ipc_logger_now);
+    if (NULL == record)
+    {
+        return;
+    }
+
+    va_start(args, format);
+    length = vsnprintf(record->text, IPC_LOG_TEXT_SIZE, format, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        length = 0;
+    }
+    else if (length >= (int)IPC_LOG_TEXT_SIZE)
+    {
+        /* vsnprintf() keeps the last character for the terminator */
+        length = (int)IPC_LOG_TEXT_SIZE - 1;
+    }
+    record->length = (uint8_t)length;
+
+    ipc_log_commit(&ipc_logger_shared->log[ipc_logger_self], record);
+    ipc_comm_ring_doorbell((ipc_core_t)ipc_comm_get_flag(&ipc_logger_shared->log_owner));
+}
+
+/*******************************************************************************
+* Function Name: ipc_logger_drain
+********************************************************************************
+* Summary:
+*  Passes the records of all the cores to the sink, oldest first. Does nothing
+*  unless the calling core is the log owner.
+*
+* Parameters:
+*  sink: record output
+*  arg: sink argument
+*
+* Return:
+*  uint32_t: number of records passed to the sink
+*
+*******************************************************************************/
+uint32_t ipc_logger_drain(ipc_log_sink_t sink, void *arg)
+{
+    ipc_log_ring_t *rings[IPC_CORE_NUM];
+
+    if ((NULL == ipc_logger_shared) ||
+        ((uint32_t)ipc_logger_self != ipc_comm_get_flag(&ipc_logger_shared->log_owner)))
+    {
+        return 0u;
+    }
+
+    for (uint32_t core = 0u; core < IPC_CORE_NUM; core++)
+    {
+        rings[core] = &ipc_logger_shared->log[core];
+    }
+
+    return ipc_log_merge(rings, IPC_CORE_NUM, (uint32_t)ipc_logger_self, sink, arg);
+}
+
+/*******************************************************************************
+* Function Name: ipc_logger_format
+********************************************************************************
+* Summary:
+*  Formats a record as a console line: "[   1234567 us] CM7_1: text".
+*
+* Parameters:
+*  record: record passed to the sink
+*  line: output buffer, IPC_LOGGER_LINE_SIZE bytes recommended
+*  size: size of the buffer
+*
+* Return:
+*  uint32_t: number of characters in the line, without the terminator
+*
+*******************************************************************************/
+uint32_t ipc_logger_format(const ipc_log_record_t *record, char *line, uint32_t size)
+{
+    const char *name = (record->core < IPC_CORE_NUM) ? ipc_logger_core_name[record->core] : "?";
+    int length = snprintf(line, size, "[%10lu us] %s: %.*s\r\n",
+                          (unsigned long)record->stamp, name,
+                          (int)record->length, record->text);
+
+    if (length < 0)
+    {
+        return 0u;
+    }
+
+    return ((uint32_t)length < size) ? (uint32_t)length : (size - 1u);
+}
+
+/* [] END OF FILE */
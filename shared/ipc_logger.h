@@ -0,0 +1,67 @@
+/******************************************************************************
+* File Name:   ipc_logger.h
+*
+* Description: Cross-core logging: printf-style front-end of the per-core log
+*              rings, shared microsecond timebase and owner-side drain.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _IPC_LOGGER_H_
+#define _IPC_LOGGER_H_
+
+#include "cy_pdl.h"
+#include "ipc_comm.h"
+#include "ipc_log.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Shared timebase: 32-bit TCPWM counter (group 1, counter 0) at 1 MHz */
+#define IPC_LOGGER_TIMEBASE_HZ      (1000000u)
+
+/* Size of a formatted record: timestamp, core name, text and line end */
+#define IPC_LOGGER_LINE_SIZE        (IPC_LOG_TEXT_SIZE + 24u)
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern cy_rslt_t ipc_logger_start(ipc_shared_t *shared, ipc_core_t owner);
+extern void ipc_logger_attach(ipc_shared_t *shared, ipc_core_t self);
+extern uint32_t ipc_logger_now(void);
+extern void ipc_logger_printf(const char *format, ...);
+extern uint32_t ipc_logger_drain(ipc_log_sink_t sink, void *arg);
+extern uint32_t ipc_logger_format(const ipc_log_record_t *record, char *line, uint32_t size);
+
+#endif
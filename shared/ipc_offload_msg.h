@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name:   ipc_offload_msg.h
+*
+* Description: Requests and responses of the work offloaded from CM7_0 to CM7_1.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _IPC_OFFLOAD_MSG_H_
+#define _IPC_OFFLOAD_MSG_H_
+
+#include <stdint.h>
+#include "ipc_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Request codes */
+#define IPC_OP_ECHO                 (0x0001u)   /* Returned unchanged, for benchmarks */
+#define IPC_OP_ADC_FILTER           (0x0002u)   /* Mean/min/max of a block of samples */
+#define IPC_OP_CRC32                (0x0003u)   /* CRC-32 verification of an SRAM buffer */
+#define IPC_OP_CAN_FRAME            (0x0004u)   /* CAN frame processing */
+
+/* Set in the code of the response to a request */
+#define IPC_OP_RESPONSE             (0x8000u)
+/* Set in the code of a response to an unknown or malformed request */
+#define IPC_OP_ERROR                (0x4000u)
+
+/* Maximum number of samples per ADC filter request */
+#define IPC_ADC_FILTER_MAX          (8u)
+/* Maximum number of data bytes per CAN frame */
+#define IPC_CAN_DATA_MAX            (8u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint16_t count;
+    int16_t  sample[IPC_ADC_FILTER_MAX];
+} ipc_adc_filter_req_t;
+
+typedef struct
+{
+    int32_t mean;
+    int16_t min;
+    int16_t max;
+} ipc_adc_filter_rsp_t;
+
+/* The buffer must be in SRAM and cleaned from the sender's D-cache */
+typedef struct
+{
+    uint32_t addr;
+    uint32_t length;
+    uint32_t expected;
+} ipc_crc32_req_t;
+
+typedef struct
+{
+    uint32_t crc;
+    uint32_t match;
+} ipc_crc32_rsp_t;
+
+/* Used for both the request and the processed response */
+typedef struct
+{
+    uint32_t id;
+    uint8_t  dlc;
+    uint8_t  data[IPC_CAN_DATA_MAX];
+} ipc_can_frame_t;
+
+_Static_assert(sizeof(ipc_adc_filter_req_t) <= IPC_MSG_PAYLOAD_SIZE, "ADC filter request too large");
+_Static_assert(sizeof(ipc_crc32_req_t) <= IPC_MSG_PAYLOAD_SIZE, "CRC request too large");
+_Static_assert(sizeof(ipc_can_frame_t) <= IPC_MSG_PAYLOAD_SIZE, "CAN frame too large");
+
+#endif
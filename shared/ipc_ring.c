@@ -0,0 +1,234 @@
+/*******************************************************************************
+* File Name:   ipc_ring.c
+*
+* Description: Lock-free single-producer/single-consumer message ring placed in
+*              SRAM shared between the CPU cores. The producer only writes head
+*              and the slots, the consumer only writes tail. On the Cortex-M7
+*              cores the D-cache is maintained explicitly around every access.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "ipc_ring.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(__arm__)
+/* Orders the slot access against the index update */
+#define IPC_RING_BARRIER()          __DMB()
+#else
+#define IPC_RING_BARRIER()          __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+#define IPC_RING_MASK               (IPC_RING_DEPTH - 1u)
+
+/* The ring is sized in whole cache lines */
+_Static_assert((IPC_RING_DEPTH & IPC_RING_MASK) == 0u, "IPC_RING_DEPTH must be a power of 2");
+_Static_assert(sizeof(ipc_msg_t) == IPC_RING_CACHE_LINE, "ipc_msg_t must fill one cache line");
+
+
+/*******************************************************************************
+* Function Name: ipc_cache_clean
+********************************************************************************
+* Summary:
+*  Writes the D-cache lines covering a shared buffer back to SRAM, so that the
+*  other cores see the data. No operation on cores without a D-cache.
+*
+* Parameters:
+*  addr: start of the buffer
+*  size: size of the buffer in bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_cache_clean(volatile void *addr, uint32_t size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)addr, (int32_t)size);
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: ipc_cache_invalidate
+********************************************************************************
+* Summary:
+*  Discards the D-cache lines covering a shared buffer, so that the next read
+*  fetches the data written by the other cores. The buffer must not share a
+*  cache line with data written by this core. No operation on cores without a
+*  D-cache.
+*
+* Parameters:
+*  addr: start of the buffer
+*  size: size of the buffer in bytes
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_cache_invalidate(volatile void *addr, uint32_t size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)addr, (int32_t)size);
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: ipc_ring_init
+********************************************************************************
+* Summary:
+*  Empties the ring. Called by one core before the other core attaches.
+*
+* Parameters:
+*  ring: ring in shared SRAM
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void ipc_ring_init(ipc_ring_t *ring)
+{
+    memset(ring, 0, sizeof(ipc_ring_t));
+    ipc_cache_clean(ring, sizeof(ipc_ring_t));
+}
+
+/*******************************************************************************
+* Function Name: ipc_ring_push
+********************************************************************************
+* Summary:
+*  Copies a message into the ring. Must only be called by the producer core.
+*
+* Parameters:
+*  ring: ring in shared SRAM
+*  msg: message to copy
+*
+* Return:
+*  true if the message was queued, false if the ring is full
+*
+*******************************************************************************/
+bool ipc_ring_push(ipc_ring_t *ring, const ipc_msg_t *msg)
+{
+    uint32_t head = ring->head;
+    ipc_msg_t *slot;
+
+    ipc_cache_invalidate(&ring->tail, IPC_RING_CACHE_LINE);
+    if ((head - ring->tail) >= IPC_RING_DEPTH)
+    {
+        return false;
+    }
+
+    slot = &ring->slot[head & IPC_RING_MASK];
+    memcpy(slot, msg, sizeof(ipc_msg_t));
+    ipc_cache_clean(slot, sizeof(ipc_msg_t));
+
+    /* Publish the slot before the index */
+    IPC_RING_BARRIER();
+    ring->head = head + 1u;
+    ipc_cache_clean(&ring->head, IPC_RING_CACHE_LINE);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: ipc_ring_pop
+********************************************************************************
+* Summary:
+*  Copies the oldest message out of the ring. Must only be called by the
+*  consumer core.
+*
+* Parameters:
+*  ring: ring in shared SRAM
+*  msg: destination of the message
+*
+* Return:
+*  true if a message was read, false if the ring is empty
+*
+*******************************************************************************/
+bool ipc_ring_pop(ipc_ring_t *ring, ipc_msg_t *msg)
+{
+    uint32_t tail = ring->tail;
+    ipc_msg_t *slot;
+
+    ipc_cache_invalidate(&ring->head, IPC_RING_CACHE_LINE);
+    if (ring->head == tail)
+    {
+        return false;
+    }
+
+    /* Read the slot only after the index that published it */
+    IPC_RING_BARRIER();
+    slot = &ring->slot[tail & IPC_RING_MASK];
+    ipc_cache_invalidate(slot, sizeof(ipc_msg_t));
+    memcpy(msg, slot, sizeof(ipc_msg_t));
+
+    /* Release the slot after it is copied */
+    IPC_RING_BARRIER();
+    ring->tail = tail + 1u;
+    ipc_cache_clean(&ring->tail, IPC_RING_CACHE_LINE);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: ipc_ring_count
+********************************************************************************
+* Summary:
+*  Returns the number of queued messages as seen by the calling core.
+*
+* Parameters:
+*  ring: ring in shared SRAM
+*
+* Return:
+*  uint32_t: number of messages
+*
+*******************************************************************************/
+uint32_t ipc_ring_count(ipc_ring_t *ring)
+{
+    ipc_cache_invalidate(&ring->head, IPC_RING_CACHE_LINE);
+    ipc_cache_invalidate(&ring->tail, IPC_RING_CACHE_LINE);
+    return ring->head - ring->tail;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/******************************************************************************
+* File Name:   ipc_ring.h
+*
+* Description: Lock-free single-producer/single-consumer message ring placed in
+*              SRAM shared between the CPU cores.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _IPC_RING_H_
+#define _IPC_RING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__arm__)
+#include "cy_pdl.h"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Cortex-M7 D-cache line size. Every field written by one core only is
+ * placed in its own cache line so that clean/invalidate never discards data
+ * written by the other core. */
+#define IPC_RING_CACHE_LINE         (32u)
+/* Number of messages per ring, power of 2 */
+#define IPC_RING_DEPTH              (16u)
+/* Message payload size, one message fills one cache line */
+#define IPC_MSG_PAYLOAD_SIZE        (20u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Fixed-size message carried by the ring */
+typedef struct
+{
+    uint16_t opcode;                        /* Request or response code */
+    uint16_t length;                        /* Valid payload bytes */
+    uint32_t seq;                           /* Sequence number, echoed in the response */
+    uint32_t stamp;                         /* Sender timestamp, echoed in the response */
+    uint8_t  payload[IPC_MSG_PAYLOAD_SIZE];
+} ipc_msg_t;
+
+/* Ring control block and slots. The indices run freely and wrap at 2^32. */
+typedef struct
+{
+    volatile uint32_t head;                 /* Written by the producer only */
+    uint8_t           head_pad[IPC_RING_CACHE_LINE - sizeof(uint32_t)];
+    volatile uint32_t tail;                 /* Written by the consumer only */
+    uint8_t           tail_pad[IPC_RING_CACHE_LINE - sizeof(uint32_t)];
+    ipc_msg_t         slot[IPC_RING_DEPTH];
+} __attribute__((aligned(IPC_RING_CACHE_LINE))) ipc_ring_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void ipc_ring_init(ipc_ring_t *ring);
+extern bool ipc_ring_push(ipc_ring_t *ring, const ipc_msg_t *msg);
+extern bool ipc_ring_pop(ipc_ring_t *ring, ipc_msg_t *msg);
+extern uint32_t ipc_ring_count(ipc_ring_t *ring);
+extern void ipc_cache_clean(volatile void *addr, uint32_t size);
+extern void ipc_cache_invalidate(volatile void *addr, uint32_t size);
+
+#endif
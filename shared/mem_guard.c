@@ -0,0 +1,442 @@
+/******************************************************************************
+* File Name:   mem_guard.c
+*
+* Description: Allocator traps and stack painting of the static memory model
+*              (mem_guard.h), built into each core project.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stddef.h>
+#include "cy_pdl.h"
+#include "mem_guard.h"
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void *mem_guard_trap(void *caller, size_t size);
+
+/* Link-time replacements of the allocator, see STATIC_MEMORY in common.mk */
+struct _reent;
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t count, size_t size);
+void *__wrap_realloc(void *ptr, size_t size);
+void __wrap_free(void *ptr);
+void *__wrap__malloc_r(struct _reent *reent, size_t size);
+void *__wrap__calloc_r(struct _reent *reent, size_t count, size_t size);
+void *__wrap__realloc_r(struct _reent *reent, void *ptr, size_t size);
+void __wrap__free_r(struct _reent *reent, void *ptr);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Allocator calls trapped by the calling core */
+static volatile uint32_t mem_guard_heap_calls = 0u;
+static volatile uint32_t mem_guard_heap_caller = 0u;
+static volatile uint32_t mem_guard_heap_size = 0u;
+
+/* Calls of mem_guard_idle() */
+static uint32_t mem_guard_idle_passes = 0u;
+
+#if MEM_GUARD_STACK
+/* Bounds of the main stack, from the BSP linker script */
+extern uint32_t __StackLimit;
+extern uint32_t __StackTop;
+#endif /* MEM_GUARD_STACK */
+
+
+/*******************************************************************************
+* Function Name: mem_guard_stack_paint
+********************************************************************************
+* Summary:
+*  Fills the main stack between __StackLimit and the current stack pointer,
+*  less MEM_GUARD_PAINT_MARGIN, with MEM_GUARD_PAINT. Called first thing in
+*  main() of each core, while the stack is nearly empty.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+__attribute__((noinline)) void mem_guard_stack_paint(void)
+{
+#if MEM_GUARD_STACK
+    volatile uint32_t *word = &__StackLimit;
+    uint32_t *end = (uint32_t *)((__get_MSP() - MEM_GUARD_PAINT_MARGIN) & ~(uint32_t)3u);
+
+    while (word < end)
+    {
+        *word++ = MEM_GUARD_PAINT;
+    }
+#endif /* MEM_GUARD_STACK */
+}
+
+/*******************************************************************************
+* Function Name: mem_guard_stack_used
+********************************************************************************
+* Summary:
+*  Scans the painted stack from __StackLimit up to the first word that was
+*  overwritten. The scan reads only the part that was never used.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  uint32_t: high-water mark of the main stack in bytes, 0 if not painted
+*
+*******************************************************************************/
+uint32_t mem_guard_stack_used(void)
+{
+#if MEM_GUARD_STACK
+    const volatile uint32_t *word = &__StackLimit;
+
+    while ((word < &__StackTop) && (MEM_GUARD_PAINT == *word))
+    {
+        word++;
+    }
+
+    return (uint32_t)((uintptr_t)&__StackTop - (uintptr_t)word);
+#else
+    return 0u;
+#endif /* MEM_GUARD_STACK */
+}
+
+/*******************************************************************************
+* Function Name: mem_guard_get
+********************************************************************************
+* Summary:
+*  Takes the memory record of the calling core.
+*
+* Parameters:
+*  record: record to fill
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void mem_guard_get(mem_guard_record_t *record)
+{
+    CY_ASSERT(NULL != record);
+
+#if MEM_GUARD_STACK
+    record->stack_size = (uint32_t)((uintptr_t)&__StackTop - (uintptr_t)&__StackLimit);
+#else
+    record->stack_size = 0u;
+#endif /* MEM_GUARD_STACK */
+    record->stack_used  = mem_guard_stack_used();
+    record->heap_calls  = mem_guard_heap_calls;
+    record->heap_caller = mem_guard_heap_caller;
+    record->heap_size   = mem_guard_heap_size;
+    record->magic       = MEM_GUARD_MAGIC;
+}
+
+/*******************************************************************************
+* Function Name: mem_guard_publish
+********************************************************************************
+* Summary:
+*  Writes the memory record of the calling core to its slot of the shared
+*  block and makes it visible to the other cores.
+*
+* Parameters:
+*  shared_record: slot of the calling core, in its own cache line
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void mem_guard_publish(mem_guard_record_t *shared_record)
+{
+    mem_guard_get(shared_record);
+    ipc_cache_clean(shared_record, sizeof(*shared_record));
+}
+
+/*******************************************************************************
+* Function Name: mem_guard_idle
+********************************************************************************
+* Summary:
+*  Publishes the record of the calling core on the first and then every
+*  MEM_GUARD_PUBLISH_PASSES calls. Called by the main loops of CM7_1 and CM0+
+*  before they sleep, so the stack scan stays off the request path.
+*
+* Parameters:
+*  shared_record: slot of the calling core, in its own cache line
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void mem_guard_idle(mem_guard_record_t *shared_record)
+{
+    if (0u == (mem_guard_idle_passes % MEM_GUARD_PUBLISH_PASSES))
+    {
+        mem_guard_publish(shared_record);
+    }
+    mem_guard_idle_passes++;
+}
+
+/*******************************************************************************
+* Function Name: mem_guard_read
+********************************************************************************
+* Summary:
+*  Reads the memory record published by another core.
+*
+* Parameters:
+*  shared_record: slot of that core in the shared block
+*  record: copy of the record
+*
+* Return:
+*  bool: false if the core has not published a record yet
+*
+*******************************************************************************/
+bool mem_guard_read(const mem_guard_record_t *shared_record, mem_guard_record_t *record)
+{
+    CY_ASSERT((NULL != shared_record) && (NULL != record));
+
+    ipc_cache_invalidate((volatile void *)shared_record, sizeof(*shared_record));
+    if (MEM_GUARD_MAGIC != shared_record->magic)
+    {
+        return false;
+    }
+    record->stack_size  = shared_record->stack_size;
+    record->stack_used  = shared_record->stack_used;
+    record->heap_calls  = shared_record->heap_calls;
+    record->heap_caller = shared_record->heap_caller;
+    record->heap_size   = shared_record->heap_size;
+    record->magic       = MEM_GUARD_MAGIC;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: mem_guard_trap
+********************************************************************************
+* Summary:
+*  Records an allocator call. The Debug build stops in CY_ASSERT with the
+*  caller in heap_caller; the Release build gets NULL, as from an exhausted
+*  heap.
+*
+* Parameters:
+*  caller: return address of the allocator call
+*  size: bytes requested
+*
+* Return:
+*  void*: NULL
+*
+*******************************************************************************/
+static void *mem_guard_trap(void *caller, size_t size)
+{
+    mem_guard_heap_calls++;
+    mem_guard_heap_caller = (uint32_t)(uintptr_t)caller;
+    mem_guard_heap_size = (uint32_t)size;
+    CY_ASSERT(0);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: __wrap_malloc
+********************************************************************************
+* Summary:
+*  Receives the malloc() calls of the application once the linker wraps them
+*  (-Wl,--wrap=malloc) and traps them.
+*
+* Parameters:
+*  size: bytes requested
+*
+* Return:
+*  void*: NULL, if the trap returns
+*
+*******************************************************************************/
+void *__wrap_malloc(size_t size)
+{
+    return mem_guard_trap(__builtin_return_address(0), size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap_calloc
+********************************************************************************
+* Summary:
+*  Receives the calloc() calls of the application once the linker wraps them
+*  and traps them.
+*
+* Parameters:
+*  count: number of elements
+*  size: bytes of an element
+*
+* Return:
+*  void*: NULL, if the trap returns
+*
+*******************************************************************************/
+void *__wrap_calloc(size_t count, size_t size)
+{
+    return mem_guard_trap(__builtin_return_address(0), count * size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap_realloc
+********************************************************************************
+* Summary:
+*  Receives the realloc() calls of the application once the linker wraps them
+*  and traps them, whatever the block.
+*
+* Parameters:
+*  ptr: block to resize, unused
+*  size: bytes requested
+*
+* Return:
+*  void*: NULL, if the trap returns
+*
+*******************************************************************************/
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    (void)ptr;
+    return mem_guard_trap(__builtin_return_address(0), size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap_free
+********************************************************************************
+* Summary:
+*  Receives the free() calls of the application once the linker wraps them.
+*  Freeing NULL is the only allocator call that is not trapped.
+*
+* Parameters:
+*  ptr: block to free
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void __wrap_free(void *ptr)
+{
+    if (NULL != ptr)
+    {
+        (void)mem_guard_trap(__builtin_return_address(0), 0u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: __wrap__malloc_r
+********************************************************************************
+* Summary:
+*  Receives the allocations of newlib itself, such as the buffer of stdio, once
+*  the linker wraps them and traps them.
+*
+* Parameters:
+*  reent: newlib reentrancy context, unused
+*  size: bytes requested
+*
+* Return:
+*  void*: NULL, if the trap returns
+*
+*******************************************************************************/
+void *__wrap__malloc_r(struct _reent *reent, size_t size)
+{
+    (void)reent;
+    return mem_guard_trap(__builtin_return_address(0), size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap__calloc_r
+********************************************************************************
+* Summary:
+*  Receives the zeroed allocations of newlib once the linker wraps them and
+*  traps them.
+*
+* Parameters:
+*  reent: newlib reentrancy context, unused
+*  count: number of elements
+*  size: bytes of an element
+*
+* Return:
+*  void*: NULL, if the trap returns
+*
+*******************************************************************************/
+void *__wrap__calloc_r(struct _reent *reent, size_t count, size_t size)
+{
+    (void)reent;
+    return mem_guard_trap(__builtin_return_address(0), count * size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap__realloc_r
+********************************************************************************
+* Summary:
+*  Receives the reallocations of newlib once the linker wraps them and traps
+*  them, whatever the block.
+*
+* Parameters:
+*  reent: newlib reentrancy context, unused
+*  ptr: block to resize, unused
+*  size: bytes requested
+*
+* Return:
+*  void*: NULL, if the trap returns
+*
+*******************************************************************************/
+void *__wrap__realloc_r(struct _reent *reent, void *ptr, size_t size)
+{
+    (void)reent;
+    (void)ptr;
+    return mem_guard_trap(__builtin_return_address(0), size);
+}
+
+/*******************************************************************************
+* Function Name: __wrap__free_r
+********************************************************************************
+* Summary:
+*  Receives the releases of newlib once the linker wraps them. Freeing NULL is
+*  not trapped.
+*
+* Parameters:
+*  reent: newlib reentrancy context, unused
+*  ptr: block to free
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+void __wrap__free_r(struct _reent *reent, void *ptr)
+{
+    (void)reent;
+    if (NULL != ptr)
+    {
+        (void)mem_guard_trap(__builtin_return_address(0), 0u);
+    }
+}
+
+/* [] END OF FILE */
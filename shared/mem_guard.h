@@ -0,0 +1,104 @@
+/******************************************************************************
+* File Name:   mem_guard.h
+*
+* Description: Static memory model of the cores. With STATIC_MEMORY=1 and
+*              GCC_ARM the Makefiles wrap malloc, calloc, realloc and free
+*              and their reentrant forms at link time (-Wl,--wrap): every
+*              call lands in mem_guard.c, which counts it, keeps the caller
+*              and halts the Debug build, so the newlib allocator is never
+*              linked and the heap cannot fragment. The unused stack is
+*              painted at boot and scanned for the high-water mark. Each
+*              core publishes its record in the shared block (ipc_comm.h).
+*              The stack linker symbols only exist with GCC_ARM; elsewhere
+*              the stack is reported as not painted.
+*
+*
+*******************************************************************************
+* Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef _MEM_GUARD_H_
+#define _MEM_GUARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ipc_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Stack painting needs the __StackLimit and __StackTop symbols of the GCC
+ * linker scripts of the BSP */
+#if defined(__arm__) && defined(__GNUC__) && !defined(__ARMCC_VERSION) && !defined(__ICCARM__)
+#define MEM_GUARD_STACK             (1)
+#else
+#define MEM_GUARD_STACK             (0)
+#endif
+
+/* Word painted over the unused stack */
+#define MEM_GUARD_PAINT             (0xC5C5C5C5u)
+
+/* Bytes below the stack pointer left unpainted, for the frame of the
+ * painting function itself */
+#define MEM_GUARD_PAINT_MARGIN      (64u)
+
+/* Idle passes of a core between two publications of its record */
+#define MEM_GUARD_PUBLISH_PASSES    (64u)
+
+/* Marks a published record */
+#define MEM_GUARD_MAGIC             (0x4D454D47u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Memory record of one core, written by that core only */
+typedef struct
+{
+    volatile uint32_t magic;
+    volatile uint32_t stack_size;   /* Bytes between __StackLimit and __StackTop, 0 if not painted */
+    volatile uint32_t stack_used;   /* High-water mark in bytes */
+    volatile uint32_t heap_calls;   /* Allocator calls trapped */
+    volatile uint32_t heap_caller;  /* Return address of the last trapped call */
+    volatile uint32_t heap_size;    /* Bytes it requested */
+} __attribute__((aligned(IPC_RING_CACHE_LINE))) mem_guard_record_t;
+
+/*******************************************************************************
+* External Functions
+*******************************************************************************/
+extern void mem_guard_stack_paint(void);
+extern uint32_t mem_guard_stack_used(void);
+extern void mem_guard_get(mem_guard_record_t *record);
+extern void mem_guard_publish(mem_guard_record_t *shared_record);
+extern void mem_guard_idle(mem_guard_record_t *shared_record);
+extern bool mem_guard_read(const mem_guard_record_t *shared_record, mem_guard_record_t *record);
+
+#endif
@@ -0,0 +1,138 @@
+#!/bin/sh
+################################################################################
+# \file memory_report.sh
+# \version 1.0
+#
+# \brief
+# Post-build memory budget of one core, from the sections and symbols of its
+# ELF file: flash, SRAM and TCM use, the SRAM split into data, bss, heap,
+# stack and unused bytes, and the largest static objects. With the static
+# memory model (STATIC_MEMORY=1, see shared/mem_guard.h) the build fails if
+# the newlib allocator was linked.
+#
+# Usage: memory_report.sh <elf file> <tool prefix> <core name> <static memory>
+#
+################################################################################
+# \copyright
+# Copyright 2022-2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+ELF=$1
+PREFIX=${2:-arm-none-eabi-}
+CORE=${3:-core}
+STATIC_MEMORY=${4:-1}
+
+# Static objects listed, largest first
+TOP_OBJECTS=8
+
+# Entry points of the newlib and newlib-nano allocators
+ALLOCATOR_SYMBOLS="malloc calloc realloc free _malloc_r _calloc_r _realloc_r _free_r nano_malloc \
+_malloc_r_unlocked"
+
+{
+    "${PREFIX}readelf" -S -W "$ELF" | sed -n 's/^ *\[ *[0-9]*\] */S /p'
+    "${PREFIX}nm" -S "$ELF" | sed 's/^/N /'
+} | awk -v core="$CORE" -v static_memory="$STATIC_MEMORY" -v allocator="$ALLOCATOR_SYMBOLS" \
+        -v top="$TOP_OBJECTS" '
+function hex(text,    value, i)
+{
+    value = 0
+    for (i = 1; i <= length(text); i++)
+    {
+        value = value * 16 + index("0123456789abcdef", tolower(substr(text, i, 1))) - 1
+    }
+    return value
+}
+function region(a)
+{
+    if (a < hex("00100000")) return "ITCM"
+    if (a >= hex("20000000") && a < hex("20100000")) return "DTCM"
+    if (a >= hex("10000000") && a < hex("18000000")) return "flash"
+    if (a >= hex("28000000") && a < hex("29000000")) return "SRAM"
+    return "other"
+}
+BEGIN {
+    n = split(allocator, names, " "); for (i = 1; i <= n; i++) alloc_name[names[i]] = 1
+    objects = 0
+}
+# Sections: name type address offset size entsize flags ...
+$1 == "S" && $8 ~ /A/ {
+    name = $2; type = $3; a = hex($4); size = hex($6); r = region(a)
+    if (size == 0) next
+    used[r] += size
+    if (r == "flash") next
+    if (type == "PROGBITS") { init_copy += size; data[r] += size }
+    else if (name == ".heap") heap_section += size
+    else if (name != ".stack_dummy") bss[r] += size
+    if (name != ".stack_dummy" && name != ".heap" && (!(r in first) || a < first[r])) first[r] = a
+    if (r == "SRAM" && name != ".stack_dummy" && name != ".heap" && a + size > static_end) static_end = a + size
+}
+# Symbols: address [size] type name
+$1 == "N" && NF >= 4 {
+    sym = $NF; type = $(NF - 1)
+    addr[sym] = hex($2)
+    if ((sym in alloc_name) && (type ~ /^[Tt]$/)) linked = linked " " sym
+    if ((NF == 5) && (type ~ /^[bBdD]$/) && (region(hex($2)) != "flash"))
+    {
+        objects++; obj_name[objects] = sym; obj_size[objects] = hex($3); obj_region[objects] = region(hex($2))
+    }
+}
+END {
+    printf "%s memory budget\n", core
+    heap = heap_section
+    printf "  flash  %8d B code and constants, %d B data initializers\n", used["flash"], init_copy
+    if ("__StackTop" in addr && "__StackLimit" in addr)
+    {
+        stack = addr["__StackTop"] - addr["__StackLimit"]
+        if ("__HeapLimit" in addr) heap = addr["__HeapLimit"] - addr["__HeapBase"]
+        total = addr["__StackTop"] - first["SRAM"]
+        unused = addr["__StackLimit"] - static_end - heap
+        printf "  SRAM   %8d B of %d B: data %d, bss %d, heap %d, stack %d, unused %d\n",
+               total - unused, total, data["SRAM"], bss["SRAM"], heap, stack, unused
+    }
+    else
+    {
+        printf "  SRAM   %8d B, no __StackTop/__StackLimit symbols\n", used["SRAM"]
+    }
+    if (used["DTCM"] > 0) printf "  DTCM   %8d B: data %d, bss %d\n", used["DTCM"], data["DTCM"], bss["DTCM"]
+    if (used["ITCM"] > 0) printf "  ITCM   %8d B\n", used["ITCM"]
+
+    # Largest static objects, selection sort of the first entries
+    printf "  Largest static objects:\n"
+    for (i = 1; i <= top && i <= objects; i++)
+    {
+        best = i
+        for (j = i + 1; j <= objects; j++) if (obj_size[j] > obj_size[best]) best = j
+        t = obj_name[i]; obj_name[i] = obj_name[best]; obj_name[best] = t
+        t = obj_size[i]; obj_size[i] = obj_size[best]; obj_size[best] = t
+        t = obj_region[i]; obj_region[i] = obj_region[best]; obj_region[best] = t
+        printf "    %-32s %6d B  %s\n", obj_name[i], obj_size[i], obj_region[i]
+    }
+
+    if (static_memory != 1)
+    {
+        printf "  Static memory model off, heap of %d B available to malloc\n", heap
+    }
+    else if (linked != "")
+    {
+        printf "  ERROR: static memory model, but the allocator is linked:%s\n", linked
+        exit 1
+    }
+    else
+    {
+        printf "  Allocator not linked, the %d B heap section is never used\n", heap
+    }
+}'